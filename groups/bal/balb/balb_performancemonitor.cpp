@@ -15,6 +15,8 @@ BSLS_IDENT_RCSID(balb_performancemonitor_cpp,"$Id$ $CSID$")
 #include <bdlf_bind.h>
 #include <bdlf_placeholder.h>
 
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
 #include <bslmt_writelockguard.h>
 
 #include <bdlt_currenttime.h>
@@ -117,7 +119,11 @@ MeasureData s_measureData[PM::e_NUM_MEASURES] = {
   { PM::e_NUM_PAGEFAULTS,
             "NUM_PAGEFAULTS",  "Page Faults",     "  ", false },
   { PM::e_VIRTUAL_SIZE,
-            "VIRTUAL_SIZE",    "Virtual Size",    "Mb", true  }
+            "VIRTUAL_SIZE",    "Virtual Size",    "Mb", true  },
+  { PM::e_IO_READ,
+            "IO_READ",         "Bytes Read",      "Mb", false },
+  { PM::e_IO_WRITE,
+            "IO_WRITE",        "Bytes Written",   "Mb", false }
 };
 
 bool nearlyEqual(double lhs, double rhs)
@@ -142,6 +148,54 @@ int currentProcessPid()
 }
 #endif
 
+#if defined(BSLS_PLATFORM_OS_LINUX) || defined(BSLS_PLATFORM_OS_CYGWIN)
+int readProcFile(char *buffer, int size, const char *path)
+    // Load into the specified 'buffer' of the specified 'size' at most
+    // 'size - 1' bytes read from the file at the specified 'path', followed by
+    // a null character.  Return the number of bytes read on success, and a
+    // negative value otherwise.  Note that the files read by this function
+    // are small enough to be read by a single 'read' system call, and that
+    // this function is considerably cheaper than reading a file through a
+    // 'bsl::ifstream'.
+{
+    const int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return -1;                                                    // RETURN
+    }
+
+    const ssize_t numBytes = read(fd, buffer, size - 1);
+    close(fd);
+
+    if (numBytes < 0) {
+        return -1;                                                    // RETURN
+    }
+
+    buffer[numBytes] = '\0';
+    return static_cast<int>(numBytes);
+}
+
+bsls::Types::Int64 parseProcField(const char *buffer, const char *name)
+    // Return the value of the field having the specified 'name' in the
+    // specified null-terminated 'buffer' holding lines of the form
+    // "<name>: <value>", or 0 if 'buffer' has no such field.
+{
+    const bsl::size_t nameLength = bsl::strlen(name);
+
+    for (const char *line = buffer; line; line = bsl::strchr(line, '\n')) {
+        if ('\n' == *line) {
+            ++line;
+        }
+        if (0 == bsl::strncmp(line, name, nameLength)
+         && ':'  == line[nameLength]) {
+            long long value = 0;
+            bsl::sscanf(line + nameLength + 1, "%lld", &value);
+            return value;                                             // RETURN
+        }
+    }
+    return 0;
+}
+#endif
+
 }  // close unnamed namespace
 
 namespace balb {
@@ -159,12 +213,14 @@ class PerformanceMonitor::Collector<bsls::Platform::OsLinux> {
     // layout and content of the file system on SunOS or AIX, hence this
     // 'Collector' class template specialization.
 
-    // Note that the Linux implementation is stateless.  However, the
-    // 'Collector' template requires a constructor accepting a single
-    // 'bslma::Allocator' argument.
+    // Note that the state of the Linux implementation is limited to scratch
+    // buffers reused from one collection to the next, so that collecting
+    // per-thread statistics does not allocate memory in the steady state.
 
     // PRIVATE TYPES
 
+    typedef bsl::vector<ThreadStatistics> ThreadData;
+
     struct ProcStatistics {
         // Describes the fields present in /proc/<pid>/stat.  For a complete
         // description of each field, see 'man proc'.
@@ -238,11 +294,35 @@ class PerformanceMonitor::Collector<bsls::Platform::OsLinux> {
         // required for any collected measures.
     };
 
+    // DATA
+    bsl::vector<int> d_tids;        // identifiers of the threads of the pid
+                                    // being collected
+
+    ThreadData       d_threadData;  // statistics of the threads of the pid
+                                    // being collected
+
+    bslmt::Mutex     d_lock;        // serializes access to 'd_tids' and
+                                    // 'd_threadData'
+
     int readProcStat(ProcStatistics *stats, int pid);
         // Load into the specified 'stats' result the fields present for the
         // specified 'pid' in the '/proc/<pid>/stat' virtual file.  Return 0 on
         // success or a non-zero value otherwise.
 
+    int loadThreadIds(bsl::vector<int> *result, int pid);
+        // Load into the specified 'result' the identifiers, in increasing
+        // order, of the threads of the specified 'pid', enumerated from the
+        // '/proc/<pid>/task' directory.  Return 0 on success or a non-zero
+        // value otherwise.
+
+    int readThreadStatistics(ThreadStatistics *stats, int pid, int tid);
+        // Load into the specified 'stats' the cumulative measures present for
+        // the thread having the specified 'tid' of the specified 'pid' in the
+        // 'stat', 'schedstat', and 'status' virtual files of the
+        // '/proc/<pid>/task/<tid>' directory, and set the utilization
+        // measures of 'stats' to 0.  Return 0 on success or a non-zero value
+        // otherwise (e.g., if the thread has exited).
+
     // UNIMPLEMENTED
     Collector(const Collector &);             // = deleted
     Collector& operator=(const Collector &);  // = deleted
@@ -263,10 +343,12 @@ class PerformanceMonitor::Collector<bsls::Platform::OsLinux> {
         // having the specified user-defined 'description'.  Return 0 on
         // success or a non-zero value otherwise.
 
-    int collect(PerformanceMonitor::Statistics *stats);
+    int collect(PerformanceMonitor::Statistics *stats,
+                bool                            collectThreadStatistics);
         // Load into the specified 'stats' the performance statistics collected
-        // for the pid associated with 'stats'.  Return 0 on success or a
-        // non-zero value otherwise.
+        // for the pid associated with 'stats', including the statistics of
+        // each of its threads if the specified 'collectThreadStatistics' is
+        // 'true'.  Return 0 on success or a non-zero value otherwise.
 };
 
 int PerformanceMonitor::Collector<bsls::Platform::OsLinux>
@@ -316,8 +398,117 @@ int PerformanceMonitor::Collector<bsls::Platform::OsLinux>
     return 0;
 }
 
+int PerformanceMonitor::Collector<bsls::Platform::OsLinux>
+::loadThreadIds(bsl::vector<int> *result, int pid)
+{
+    result->clear();
+
+    char path[64];
+    bsl::snprintf(path, sizeof path, "/proc/%d/task", pid);
+
+    DIR *directory = opendir(path);
+    if (!directory) {
+        BSLS_LOG_DEBUG("Failed to open '%s'", path);
+        return -1;                                                    // RETURN
+    }
+
+    while (const dirent *entry = readdir(directory)) {
+        if ('0' <= entry->d_name[0] && entry->d_name[0] <= '9') {
+            result->push_back(bsl::atoi(entry->d_name));
+        }
+    }
+    closedir(directory);
+
+    bsl::sort(result->begin(), result->end());
+    return 0;
+}
+
+int PerformanceMonitor::Collector<bsls::Platform::OsLinux>
+::readThreadStatistics(ThreadStatistics *stats, int pid, int tid)
+{
+    static const double clockTicksPerSec =
+                                   static_cast<double>(sysconf(_SC_CLK_TCK));
+
+    char path[64];
+    char buffer[4096];
+
+    bsl::snprintf(path, sizeof path, "/proc/%d/task/%d/stat", pid, tid);
+    if (readProcFile(buffer, sizeof buffer, path) <= 0) {
+        return -1;                                                    // RETURN
+    }
+
+    // The thread name, which may contain spaces and parentheses, is enclosed
+    // by the first '(' and the last ')' of the line.  The fields following it
+    // are described by 'ProcStatistics'.
+
+    const char *nameBegin = bsl::strchr(buffer, '(');
+    const char *nameEnd   = bsl::strrchr(buffer, ')');
+    if (!nameBegin || !nameEnd || nameEnd < nameBegin) {
+        return -1;                                                    // RETURN
+    }
+
+    unsigned long long minflt, majflt, utime, stime;
+    if (4 != bsl::sscanf(nameEnd + 1,
+                         " %*c %*d %*d %*d %*d %*d %*u %llu %*u %llu %*u"
+                         " %llu %llu",
+                         &minflt,
+                         &majflt,
+                         &utime,
+                         &stime)) {
+        return -1;                                                    // RETURN
+    }
+
+    stats->d_tid = tid;
+    stats->d_name.assign(nameBegin + 1, nameEnd);
+
+    stats->d_cpuTimeUser        = static_cast<double>(utime) /
+                                                              clockTicksPerSec;
+    stats->d_cpuTimeSystem      = static_cast<double>(stime) /
+                                                              clockTicksPerSec;
+    stats->d_numMinorPageFaults = static_cast<bsls::Types::Int64>(minflt);
+    stats->d_numMajorPageFaults = static_cast<bsls::Types::Int64>(majflt);
+    stats->d_cpuUtilUser        = 0;
+    stats->d_cpuUtilSystem      = 0;
+    stats->d_runQueueWaitUtil   = 0;
+
+    // 'schedstat' holds the nanoseconds spent running, the nanoseconds spent
+    // waiting to run, and the number of time slices.  It does not exist
+    // unless the kernel is built with scheduler statistics.
+
+    unsigned long long runTime, waitTime;
+
+    bsl::snprintf(path, sizeof path, "/proc/%d/task/%d/schedstat", pid, tid);
+    if (0 < readProcFile(buffer, sizeof buffer, path)
+     && 2 == bsl::sscanf(buffer, "%llu %llu", &runTime, &waitTime)) {
+        stats->d_runQueueWaitTime = static_cast<double>(waitTime) / 1.0e9;
+    }
+    else {
+        stats->d_runQueueWaitTime = 0;
+    }
+
+    // 'status' is the only file holding the number of context switches of a
+    // thread.
+
+    bsl::snprintf(path, sizeof path, "/proc/%d/task/%d/status", pid, tid);
+    if (0 < readProcFile(buffer, sizeof buffer, path)) {
+        stats->d_numVoluntaryContextSwitches =
+                           parseProcField(buffer, "voluntary_ctxt_switches");
+        stats->d_numInvoluntaryContextSwitches =
+                        parseProcField(buffer, "nonvoluntary_ctxt_switches");
+    }
+    else {
+        stats->d_numVoluntaryContextSwitches   = 0;
+        stats->d_numInvoluntaryContextSwitches = 0;
+    }
+
+    return 0;
+}
+
 PerformanceMonitor::Collector<bsls::Platform::OsLinux>
-::Collector(bslma::Allocator *)
+::Collector(bslma::Allocator *basicAllocator)
+: d_tids(basicAllocator)
+, d_threadData(basicAllocator)
+, d_lock()
 {
 }
 
@@ -383,8 +574,53 @@ int PerformanceMonitor::Collector<bsls::Platform::OsLinux>
 }
 
 int PerformanceMonitor::Collector<bsls::Platform::OsLinux>
-::collect(Statistics *stats)
+::collect(Statistics *stats, bool collectThreadStatistics)
 {
+    bslmt::LockGuard<bslmt::Mutex> collectorGuard(&d_lock);
+
+    // Discover the threads by enumerating the directories in the
+    // /proc/<pid>/task directory, and read the statistics of each of them
+    // before locking 'stats', so that readers of 'stats' are not blocked while
+    // the (possibly many) per-thread files are read.
+
+    loadThreadIds(&d_tids, stats->d_pid);
+
+    const int numThreads = static_cast<int>(d_tids.size());
+
+    if (collectThreadStatistics) {
+        d_threadData.resize(numThreads);
+
+        int numCollected = 0;
+        for (int i = 0; i < numThreads; ++i) {
+            if (0 == readThreadStatistics(&d_threadData[numCollected],
+                                          stats->d_pid,
+                                          d_tids[i])) {
+                ++numCollected;
+            }
+        }
+        d_threadData.resize(numCollected);
+    }
+    else {
+        d_threadData.clear();
+    }
+
+    // Read the number of bytes read and written by the process.  Note that
+    // '/proc/<pid>/io' is readable only by the owner of the process.
+
+    double ioRead  = 0;
+    double ioWrite = 0;
+    {
+        char path[64];
+        char buffer[1024];
+
+        bsl::snprintf(path, sizeof path, "/proc/%d/io", stats->d_pid);
+        if (0 < readProcFile(buffer, sizeof buffer, path)) {
+            ioRead  = static_cast<double>(parseProcField(buffer, "rchar"))
+                    / (1024 * 1024);
+            ioWrite = static_cast<double>(parseProcField(buffer, "wchar"))
+                    / (1024 * 1024);
+        }
+    }
 
     bslmt::WriteLockGuard<bslmt::RWMutex> guard(&stats->d_guard);
 
@@ -400,25 +636,9 @@ int PerformanceMonitor::Collector<bsls::Platform::OsLinux>
 
     static const long clockTicksPerSec = sysconf(_SC_CLK_TCK);
 
-    // Discover the number of threads by enumerating the directories in the
-    // /proc/<pid>/task directory.
-
-    bsl::stringstream taskFilename;
-    taskFilename << "/proc/" << stats->d_pid << "/task";
-    dirent **entry = 0;
-    int numThreads = 0;
-    int numNodes = scandir(taskFilename.str().c_str(), &entry, 0, 0);
-    for (int nodeIndex = 0; nodeIndex < numNodes; ++nodeIndex) {
-        if (DT_DIR == entry[nodeIndex]->d_type &&
-            bsl::strcmp(".",  entry[nodeIndex]->d_name) != 0 &&
-            bsl::strcmp("..", entry[nodeIndex]->d_name) != 0) {
-            ++numThreads;
-        }
-        bsl::free(entry[nodeIndex]);
-    }
-    bsl::free(entry);
-
     stats->d_lstData[e_NUM_THREADS] = numThreads;
+    stats->d_lstData[e_IO_READ]     = ioRead;
+    stats->d_lstData[e_IO_WRITE]    = ioWrite;
 
     static const long pageSize = sysconf(_SC_PAGESIZE);
 
@@ -462,6 +682,44 @@ int PerformanceMonitor::Collector<bsls::Platform::OsLinux>
     stats->d_lstData[e_CPU_TIME_SYSTEM] = cpuTimeS;
     stats->d_lstData[e_CPU_TIME]        = cpuTimeU + cpuTimeS;
 
+    // Calculate the utilization measures of each thread present in the
+    // previous collection.  Both sequences are ordered by thread identifier.
+
+    if (dt > 0) {
+        ThreadData::const_iterator previous = stats->d_threadData.begin();
+        ThreadData::const_iterator end      = stats->d_threadData.end();
+
+        for (ThreadData::iterator it  = d_threadData.begin();
+                                  it != d_threadData.end();
+                                ++it) {
+            while (previous != end && previous->d_tid < it->d_tid) {
+                ++previous;
+            }
+            if (previous == end) {
+                break;
+            }
+            if (previous->d_tid != it->d_tid) {
+                continue;
+            }
+
+            it->d_cpuUtilUser      = bsl::max(
+                        (it->d_cpuTimeUser - previous->d_cpuTimeUser) / dt,
+                        0.0) * 100.0;
+            it->d_cpuUtilSystem    = bsl::max(
+                        (it->d_cpuTimeSystem - previous->d_cpuTimeSystem) / dt,
+                        0.0) * 100.0;
+            it->d_runQueueWaitUtil = bsl::max(
+                  (it->d_runQueueWaitTime - previous->d_runQueueWaitTime) / dt,
+                  0.0) * 100.0;
+        }
+    }
+
+    // Note that 'd_threadData' and 'stats->d_threadData' use the allocator of
+    // the performance monitor, so their elements are exchanged in constant
+    // time.  The exchanged elements are reused by the next collection.
+
+    stats->d_threadData.swap(d_threadData);
+
     stats->d_elapsedTime = elapsedTime;
 
     ++stats->d_numSamples;
@@ -566,9 +824,11 @@ class PerformanceMonitor::Collector<bsls::Platform::OsFreeBsd> {
         // having the specified user-defined 'description'.  Return 0 on
         // success or a non-zero value otherwise.
 
-    int collect(Statistics *stats);
+    int collect(Statistics *stats, bool collectThreadStatistics);
         // Load into the specified 'stats' the performance statistics collected
-        // for the pid associated with 'stats'.  Return 0 on success or a
+        // for the pid associated with 'stats'.  The specified
+        // 'collectThreadStatistics' flag is ignored, as per-thread statistics
+        // are not collected on this platform.  Return 0 on success or a
         // non-zero value otherwise.
 };
 
@@ -645,7 +905,7 @@ int PerformanceMonitor::Collector<bsls::Platform::OsFreeBsd>
 }
 
 int PerformanceMonitor::Collector<bsls::Platform::OsFreeBsd>
-::collect(Statistics *stats)
+::collect(Statistics *stats, bool)
 {
     bslmt::WriteLockGuard<bslmt::RWMutex> guard(&stats->d_guard);
 
@@ -742,9 +1002,11 @@ class PerformanceMonitor::Collector<bsls::Platform::OsDarwin> {
         // having the specified user-defined 'description'.  Return 0 on
         // success or a non-zero value otherwise.
 
-    int collect(Statistics *stats);
+    int collect(Statistics *stats, bool collectThreadStatistics);
         // Load into the specified 'stats' the performance statistics collected
-        // for the pid associated with 'stats'.  Return 0 on success or a
+        // for the pid associated with 'stats'.  The specified
+        // 'collectThreadStatistics' flag is ignored, as per-thread statistics
+        // are not collected on this platform.  Return 0 on success or a
         // non-zero value otherwise.
 };
 
@@ -788,7 +1050,7 @@ int PerformanceMonitor::Collector<bsls::Platform::OsDarwin>
 }
 
 int PerformanceMonitor::Collector<bsls::Platform::OsDarwin>
-::collect(Statistics *stats)
+::collect(Statistics *stats, bool)
 {
     bslmt::WriteLockGuard<bslmt::RWMutex> guard(&stats->d_guard);
 
@@ -887,9 +1149,11 @@ class PerformanceMonitor::Collector<bsls::Platform::OsUnix> {
         // having the specified user-defined 'description'.  Return 0 on
         // success or a non-zero value otherwise.
 
-    int collect(Statistics *stats);
+    int collect(Statistics *stats, bool collectThreadStatistics);
         // Load into the specified 'stats' the performance statistics collected
-        // for the pid associated with 'stats'.  Return 0 on success or a
+        // for the pid associated with 'stats'.  The specified
+        // 'collectThreadStatistics' flag is ignored, as per-thread statistics
+        // are not collected on this platform.  Return 0 on success or a
         // non-zero value otherwise.
 };
 
@@ -949,7 +1213,7 @@ int PerformanceMonitor::Collector<bsls::Platform::OsUnix>
 }
 
 int PerformanceMonitor::Collector<bsls::Platform::OsUnix>
-::collect(Statistics *stats)
+::collect(Statistics *stats, bool)
 {
     bslmt::WriteLockGuard<bslmt::RWMutex> guard(&stats->d_guard);
 
@@ -1192,9 +1456,11 @@ struct PerformanceMonitor::Collector<bsls::Platform::OsWindows> {
         // having the specified user-defined 'description'.  Return 0 on
         // success or a non-zero value otherwise.
 
-    int collect(Statistics *stats);
+    int collect(Statistics *stats, bool collectThreadStatistics);
         // Load into the specified 'stats' the performance statistics collected
-        // for the pid associated with 'stats'.  Return 0 on success or a
+        // for the pid associated with 'stats'.  The specified
+        // 'collectThreadStatistics' flag is ignored, as per-thread statistics
+        // are not collected on this platform.  Return 0 on success or a
         // non-zero value otherwise.
 };
 
@@ -1408,7 +1674,7 @@ int PerformanceMonitor::Collector<bsls::Platform::OsWindows>
 }
 
 int PerformanceMonitor::Collector<bsls::Platform::OsWindows>
-::collect(Statistics *stats)
+::collect(Statistics *stats, bool)
 {
     bslmt::WriteLockGuard<bslmt::RWMutex> guard(&stats->d_guard);
 
@@ -1523,6 +1789,70 @@ int PerformanceMonitor::Collector<bsls::Platform::OsWindows>
 
 #endif
 
+              // ------------------------------------------
+              // class PerformanceMonitor::ThreadStatistics
+              // ------------------------------------------
+
+// CREATORS
+PerformanceMonitor::ThreadStatistics::ThreadStatistics(
+                                              bslma::Allocator *basicAllocator)
+: d_tid(0)
+, d_name(basicAllocator)
+, d_cpuTimeUser(0.0)
+, d_cpuTimeSystem(0.0)
+, d_cpuUtilUser(0.0)
+, d_cpuUtilSystem(0.0)
+, d_runQueueWaitTime(0.0)
+, d_runQueueWaitUtil(0.0)
+, d_numVoluntaryContextSwitches(0)
+, d_numInvoluntaryContextSwitches(0)
+, d_numMinorPageFaults(0)
+, d_numMajorPageFaults(0)
+{
+}
+
+PerformanceMonitor::ThreadStatistics::ThreadStatistics(
+                                      const ThreadStatistics&  original,
+                                      bslma::Allocator        *basicAllocator)
+: d_tid(original.d_tid)
+, d_name(original.d_name, basicAllocator)
+, d_cpuTimeUser(original.d_cpuTimeUser)
+, d_cpuTimeSystem(original.d_cpuTimeSystem)
+, d_cpuUtilUser(original.d_cpuUtilUser)
+, d_cpuUtilSystem(original.d_cpuUtilSystem)
+, d_runQueueWaitTime(original.d_runQueueWaitTime)
+, d_runQueueWaitUtil(original.d_runQueueWaitUtil)
+, d_numVoluntaryContextSwitches(original.d_numVoluntaryContextSwitches)
+, d_numInvoluntaryContextSwitches(original.d_numInvoluntaryContextSwitches)
+, d_numMinorPageFaults(original.d_numMinorPageFaults)
+, d_numMajorPageFaults(original.d_numMajorPageFaults)
+{
+}
+
+// MANIPULATORS
+PerformanceMonitor::ThreadStatistics&
+PerformanceMonitor::ThreadStatistics::operator=(const ThreadStatistics& rhs)
+{
+    d_tid                           = rhs.d_tid;
+    d_name                          = rhs.d_name;
+    d_cpuTimeUser                   = rhs.d_cpuTimeUser;
+    d_cpuTimeSystem                 = rhs.d_cpuTimeSystem;
+    d_cpuUtilUser                   = rhs.d_cpuUtilUser;
+    d_cpuUtilSystem                 = rhs.d_cpuUtilSystem;
+    d_runQueueWaitTime              = rhs.d_runQueueWaitTime;
+    d_runQueueWaitUtil              = rhs.d_runQueueWaitUtil;
+    d_numVoluntaryContextSwitches   = rhs.d_numVoluntaryContextSwitches;
+    d_numInvoluntaryContextSwitches = rhs.d_numInvoluntaryContextSwitches;
+    d_numMinorPageFaults            = rhs.d_numMinorPageFaults;
+    d_numMajorPageFaults            = rhs.d_numMajorPageFaults;
+
+    return *this;
+}
+
+                 // ------------------------------------
+                 // class PerformanceMonitor::Statistics
+                 // ------------------------------------
+
 // CREATORS
 PerformanceMonitor::Statistics::Statistics(bslma::Allocator *basicAllocator)
 : d_pid(0)
@@ -1531,6 +1861,7 @@ PerformanceMonitor::Statistics::Statistics(bslma::Allocator *basicAllocator)
 , d_startTime()
 , d_elapsedTime(0.0)
 , d_numSamples(0)
+, d_threadData(basicAllocator)
 , d_guard()
 {
     reset();
@@ -1539,10 +1870,13 @@ PerformanceMonitor::Statistics::Statistics(bslma::Allocator *basicAllocator)
 PerformanceMonitor::Statistics::Statistics(const Statistics&  original,
                                            bslma::Allocator  *basicAllocator)
 : d_description(original.d_description, basicAllocator)
+, d_threadData(basicAllocator)
 , d_guard()
 {
     bslmt::ReadLockGuard<bslmt::RWMutex> guard(&original.d_guard);
 
+    d_threadData = original.d_threadData;
+
     d_pid = original.d_pid;
     d_startTimeUtc = original.d_startTimeUtc;
     d_startTime = original.d_startTime;
@@ -1633,12 +1967,24 @@ void PerformanceMonitor::Statistics::print(
     BSLS_LOG_WARN("No measure matches description '%s'", measureIdentifier);
 }
 
+void PerformanceMonitor::Statistics::loadThreadStatistics(
+                                  bsl::vector<ThreadStatistics> *result) const
+{
+    BSLS_ASSERT(result);
+
+    bslmt::ReadLockGuard<bslmt::RWMutex> guard(&d_guard);
+
+    result->assign(d_threadData.begin(), d_threadData.end());
+}
+
 void PerformanceMonitor::Statistics::reset()
 {
     bslmt::WriteLockGuard<bslmt::RWMutex> guard(&d_guard);
 
     d_numSamples = 0;
 
+    d_threadData.clear();
+
     bsl::memset(d_lstData, 0, sizeof d_lstData);
     bsl::memset(d_totData, 0, sizeof d_totData);
 
@@ -1657,6 +2003,7 @@ PerformanceMonitor::PerformanceMonitor(bslma::Allocator *basicAllocator)
 , d_scheduler_p(0)
 , d_clock(bdlmt::TimerEventScheduler::Handle(INVALID_TIMER_HANDLE))
 , d_mapGuard()
+, d_threadStatisticsEnabled(false)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
@@ -1670,6 +2017,7 @@ PerformanceMonitor::PerformanceMonitor(
 , d_scheduler_p(scheduler)
 , d_clock(bdlmt::TimerEventScheduler::Handle(INVALID_TIMER_HANDLE))
 , d_mapGuard()
+, d_threadStatisticsEnabled(false)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     if (interval > 0.0) {
@@ -1756,6 +2104,8 @@ void PerformanceMonitor::setCollectionInterval(double interval)
 
 void PerformanceMonitor::collect()
 {
+    const bool collectThreadStatistics = d_threadStatisticsEnabled;
+
     bslmt::ReadLockGuard<bslmt::RWMutex> guard(&d_mapGuard);
 
     for (PidMap::iterator it  = d_pidMap.begin();
@@ -1765,7 +2115,7 @@ void PerformanceMonitor::collect()
         StatisticsPtr& stats     = it->second.first;
         CollectorPtr&  collector = it->second.second;
 
-        collector->collect(stats.get());
+        collector->collect(stats.get(), collectThreadStatistics);
     }
 }
 
@@ -1785,6 +2135,11 @@ void PerformanceMonitor::resetStatistics()
     collect();
 }
 
+void PerformanceMonitor::setThreadStatisticsEnabled(bool value)
+{
+    d_threadStatisticsEnabled = value;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
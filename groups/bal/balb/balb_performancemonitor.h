@@ -18,6 +18,7 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //   balb::PerformanceMonitor: monitor process performance
 //   balb::PerformanceMonitor::Statistics: performance stats
+//   balb::PerformanceMonitor::ThreadStatistics: per-thread performance stats
 //   balb::PerformanceMonitor::ConstIterator: stats iteration
 //
 //@DESCRIPTION: This component provides an application developer the means to
@@ -65,7 +66,63 @@ BSLS_IDENT("$Id: $")
 // Page Faults       e_NUM_PAGEFAULTS     Total number of page faults incurred
 //                                        throughout the lifetime of the
 //                                        process.
+//
+// Bytes Read        e_IO_READ            Number of mega-bytes the process has
+//                                        read through system calls (including
+//                                        reads from sockets and pipes).
+//
+// Bytes Written     e_IO_WRITE           Number of mega-bytes the process has
+//                                        written through system calls
+//                                        (including writes to sockets and
+//                                        pipes).
+//..
+// The 'e_IO_READ' and 'e_IO_WRITE' measures are collected on Linux only, and
+// are 0 on other platforms.
+//
+///Per-Thread Statistics
+///---------------------
+// On Linux, a 'balb::PerformanceMonitor' can also collect statistics for each
+// individual thread of the monitored processes, which is useful to find out
+// which threads consume the CPU time of a process, or are starved of it.
+// Collecting per-thread statistics reads three small files from the '/proc'
+// filesystem for each thread, so it is disabled by default, and is enabled by
+// calling 'setThreadStatisticsEnabled(true)'.  The statistics of the threads
+// of a process are loaded from its 'Statistics' object by
+// 'loadThreadStatistics', as 'balb::PerformanceMonitor::ThreadStatistics'
+// objects holding the following measures:
+//..
+// Measure               Accessor                       Source
+// -------               --------                       ------
+// User CPU Time         cpuTimeUser                    task/<tid>/stat
+//
+// System CPU Time       cpuTimeSystem                  task/<tid>/stat
+//
+// User CPU %            cpuUtilUser                    task/<tid>/stat
+//
+// System CPU %          cpuUtilSystem                  task/<tid>/stat
+//
+// Run-Queue Wait Time   runQueueWaitTime               task/<tid>/schedstat
+//
+// Run-Queue Wait %      runQueueWaitUtil               task/<tid>/schedstat
+//
+// Voluntary Switches    numVoluntaryContextSwitches    task/<tid>/status
+//
+// Involuntary Switches  numInvoluntaryContextSwitches  task/<tid>/status
+//
+// Minor Page Faults     numMinorPageFaults             task/<tid>/stat
+//
+// Major Page Faults     numMajorPageFaults             task/<tid>/stat
 //..
+// Times are in seconds since the thread started, and percentages are relative
+// to the wall time elapsed between the two latest collections (and are 0 for
+// a thread seen for the first time).  The run-queue wait time is the time the
+// thread spent runnable but waiting for a CPU; it is 0 if the kernel does not
+// provide scheduler statistics.  On platforms other than Linux, no per-thread
+// statistics are collected.
+//
+// The 'balm_performancemonitoradapter' component publishes the statistics
+// collected by a 'balb::PerformanceMonitor', including per-thread statistics,
+// through a 'balm::MetricsManager'.
 //
 ///OS-Specific Permissions
 ///-----------------------
@@ -131,6 +188,11 @@ BSLS_IDENT("$Id: $")
 //  assert(0 == rc);
 //  assert(1 == perfmon.numRegisteredPids());
 //..
+// We also enable the collection of the statistics of each thread of the
+// process (see {Per-Thread Statistics}):
+//..
+//  perfmon.setThreadStatisticsEnabled(true);
+//..
 // Next, we print a formatted report of the performance statistics collected
 // for each pid every 5 seconds for half a minute.  Note, that 'Statistics'
 // object can be simultaneously modified by scheduler callback and accessed via
@@ -148,6 +210,18 @@ BSLS_IDENT("$Id: $")
 //
 //      bsl::cout << "PID = " << stats.pid() << ":\n";
 //      stats.print(bsl::cout);
+//
+//      bsl::vector<balb::PerformanceMonitor::ThreadStatistics> threads;
+//      stats.loadThreadStatistics(&threads);
+//
+//      for (bsl::size_t j = 0; j < threads.size(); ++j) {
+//          bsl::cout << "    TID " << threads[j].tid()
+//                    << " (" << threads[j].name() << "): "
+//                    << threads[j].cpuUtilUser() +
+//                                             threads[j].cpuUtilSystem()
+//                    << "% CPU, " << threads[j].runQueueWaitUtil()
+//                    << "% waiting\n";
+//      }
 //  }
 //..
 // Finally, we unregister the process and stop the scheduler to cease
@@ -183,12 +257,14 @@ BSLS_IDENT("$Id: $")
 
 #include <bsls_assert.h>
 #include <bsls_platform.h>
+#include <bsls_types.h>
 
 #include <bsl_iosfwd.h>
 #include <bsl_iterator.h>
 #include <bsl_map.h>
 #include <bsl_memory.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 namespace BloombergLP {
 namespace balb {
@@ -207,6 +283,10 @@ class PerformanceMonitor {
     friend class Statistics;
         // Grant visibility of private types to 'Statistics'.
 
+    class ThreadStatistics;
+    friend class ThreadStatistics;
+        // Grant visibility of private types to 'ThreadStatistics'.
+
     class ConstIterator;
     friend class ConstIterator;
         // Grant visibility of private types to 'ConstIterator'.
@@ -275,6 +355,11 @@ typedef bsls::Platform::OsHpUx OsType;
     mutable bslmt::RWMutex              d_mapGuard;     // serializes write
                                                         // access to 'd_pidMap'
 
+    bsls::AtomicBool                    d_threadStatisticsEnabled;
+                                                        // whether per-thread
+                                                        // statistics are
+                                                        // collected
+
     bslma::Allocator                   *d_allocator_p;  // supplies memory
                                                         // (held)
 
@@ -299,6 +384,8 @@ typedef bsls::Platform::OsHpUx OsType;
         e_NUM_THREADS,       // number of threads
         e_NUM_PAGEFAULTS,    // number of pagefaults (major + minor)
         e_VIRTUAL_SIZE,      // number of MBs in the heap
+        e_IO_READ,           // number of MBs read
+        e_IO_WRITE,          // number of MBs written
         e_NUM_MEASURES
 #ifndef BDE_OMIT_INTERNAL_DEPRECATED
       , BAEA_CPU_TIME        = e_CPU_TIME
@@ -326,6 +413,132 @@ typedef bsls::Platform::OsHpUx OsType;
 #endif // BDE_OMIT_INTERNAL_DEPRECATED
     };
 
+    class ThreadStatistics {
+        // Defines the performance statistics collected for a thread of a
+        // monitored process.  Note that this class is not fully
+        // value-semantic.  It is intended to provide a read-only view of a
+        // set of collected performance statistics.
+
+        // FRIENDS
+        friend class Collector<OsType>;
+            // Grants write-access to the specific 'Collector' instantiation
+            // for the current platform.
+
+        // DATA
+        int                 d_tid;
+                              // thread identifier
+
+        bsl::string         d_name;
+                              // thread name
+
+        double              d_cpuTimeUser;
+                              // user CPU time (seconds)
+
+        double              d_cpuTimeSystem;
+                              // system CPU time (seconds)
+
+        double              d_cpuUtilUser;
+                              // user CPU % since the previous collection
+
+        double              d_cpuUtilSystem;
+                              // system CPU % since the previous collection
+
+        double              d_runQueueWaitTime;
+                              // time spent waiting to run (seconds)
+
+        double              d_runQueueWaitUtil;
+                              // % of the time since the previous collection
+                              // spent waiting to run
+
+        bsls::Types::Int64  d_numVoluntaryContextSwitches;
+                              // num voluntary context switches
+
+        bsls::Types::Int64  d_numInvoluntaryContextSwitches;
+                              // num involuntary context switches
+
+        bsls::Types::Int64  d_numMinorPageFaults;
+                              // num minor page faults
+
+        bsls::Types::Int64  d_numMajorPageFaults;
+                              // num major page faults
+
+      public:
+        // TRAITS
+        BSLMF_NESTED_TRAIT_DECLARATION(ThreadStatistics,
+                                       bslma::UsesBslmaAllocator);
+
+        // CREATORS
+        explicit ThreadStatistics(bslma::Allocator *basicAllocator = 0);
+            // Create an instance of this class having a 'tid' of 0, an empty
+            // 'name', and 0 for all of its measures.  Optionally specify a
+            // 'basicAllocator' used to supply memory.  If 'basicAllocator' is
+            // 0, the currently installed default allocator is used.
+
+        ThreadStatistics(const ThreadStatistics&  original,
+                         bslma::Allocator        *basicAllocator = 0);
+            // Create a 'ThreadStatistics' object having the same statistics
+            // values as the specified 'original' object.  Optionally specify
+            // a 'basicAllocator' used to supply memory.  If 'basicAllocator'
+            // is 0, the currently installed default allocator is used.
+
+        // MANIPULATORS
+        ThreadStatistics& operator=(const ThreadStatistics& rhs);
+            // Assign to this object the statistics values of the specified
+            // 'rhs' object, and return a reference providing modifiable
+            // access to this object.
+
+        // ACCESSORS
+        int tid() const;
+            // Return the identifier of the thread for which these statistics
+            // were collected.
+
+        const bsl::string& name() const;
+            // Return the name of the thread for which these statistics were
+            // collected.
+
+        double cpuTimeUser() const;
+            // Return the number of seconds the thread spent executing
+            // instructions in user mode.
+
+        double cpuTimeSystem() const;
+            // Return the number of seconds the thread spent executing
+            // instructions in kernel mode.
+
+        double cpuUtilUser() const;
+            // Return the percentage of the wall time elapsed between the two
+            // latest collections the thread spent executing instructions in
+            // user mode.
+
+        double cpuUtilSystem() const;
+            // Return the percentage of the wall time elapsed between the two
+            // latest collections the thread spent executing instructions in
+            // kernel mode.
+
+        double runQueueWaitTime() const;
+            // Return the number of seconds the thread spent runnable, but
+            // waiting for a CPU to run on.
+
+        double runQueueWaitUtil() const;
+            // Return the percentage of the wall time elapsed between the two
+            // latest collections the thread spent runnable, but waiting for a
+            // CPU to run on.
+
+        bsls::Types::Int64 numVoluntaryContextSwitches() const;
+            // Return the number of times the thread gave up its CPU (e.g., to
+            // wait for a lock or for I/O).
+
+        bsls::Types::Int64 numInvoluntaryContextSwitches() const;
+            // Return the number of times the thread was preempted.
+
+        bsls::Types::Int64 numMinorPageFaults() const;
+            // Return the number of page faults incurred by the thread that
+            // did not require loading a page from disk.
+
+        bsls::Types::Int64 numMajorPageFaults() const;
+            // Return the number of page faults incurred by the thread that
+            // required loading a page from disk.
+    };
+
     class Statistics {
         // Defines the performance statistics collected for a monitored
         // process.  Note that this class is not fully value-semantic.  It is
@@ -369,6 +582,11 @@ typedef bsls::Platform::OsHpUx OsType;
         double                 d_totData[e_NUM_MEASURES];
                                  // cumulative
 
+        bsl::vector<ThreadStatistics>
+                               d_threadData;
+                                 // latest collected thread data, sorted by
+                                 // thread identifier
+
         mutable bslmt::RWMutex d_guard;
                                  // serialize write access
 
@@ -397,7 +615,7 @@ typedef bsls::Platform::OsHpUx OsType;
         // MANIPULATORS
         void reset();
             // Reset the min, max, and average values collected for each
-            // measure.
+            // measure, and discard the collected per-thread statistics.
 
         // ACCESSORS
         double latestValue(Measure measure) const;
@@ -428,6 +646,16 @@ typedef bsls::Platform::OsHpUx OsType;
         const bdlt::Datetime& startupTime() const;
             // Return the startup time in Coordinated Universal Time.
 
+        void loadThreadStatistics(bsl::vector<ThreadStatistics> *result)
+                                                                      const;
+            // Load into the specified 'result' the latest collected
+            // statistics for each thread of the process identified by the
+            // result of the 'pid()' function, ordered by thread identifier.
+            // Any elements previously contained in 'result' are removed.
+            // Note that 'result' is empty unless the statistics were
+            // collected while per-thread statistics were enabled (see
+            // 'PerformanceMonitor::setThreadStatisticsEnabled').
+
         void print(bsl::ostream& os) const;
             // Print all collected statistics to the specified 'os' stream.
 
@@ -586,6 +814,12 @@ typedef bsls::Platform::OsHpUx OsType;
         // Reset the collected min, max, and average values collected for each
         // measure for each monitored process.
 
+    void setThreadStatisticsEnabled(bool value);
+        // Set whether statistics are collected for each thread of the
+        // monitored processes to the specified 'value'.  Per-thread
+        // statistics are not collected by default.  Note that per-thread
+        // statistics are collected on Linux only.
+
     // ACCESSORS
     ConstIterator begin() const;
         // Return an iterator positioned at the first set of collected
@@ -603,6 +837,10 @@ typedef bsls::Platform::OsHpUx OsType;
 
     int numRegisteredPids() const;
         // Return the number of processes registered for statistics collection.
+
+    bool isThreadStatisticsEnabled() const;
+        // Return 'true' if statistics are collected for each thread of the
+        // monitored processes, and 'false' otherwise.
 };
 
 // ============================================================================
@@ -680,6 +918,87 @@ bool PerformanceMonitor::ConstIterator::operator!=(
     return d_it != rhs.d_it;
 }
 
+              // ------------------------------------------
+              // class PerformanceMonitor::ThreadStatistics
+              // ------------------------------------------
+
+// ACCESSORS
+inline
+int PerformanceMonitor::ThreadStatistics::tid() const
+{
+    return d_tid;
+}
+
+inline
+const bsl::string& PerformanceMonitor::ThreadStatistics::name() const
+{
+    return d_name;
+}
+
+inline
+double PerformanceMonitor::ThreadStatistics::cpuTimeUser() const
+{
+    return d_cpuTimeUser;
+}
+
+inline
+double PerformanceMonitor::ThreadStatistics::cpuTimeSystem() const
+{
+    return d_cpuTimeSystem;
+}
+
+inline
+double PerformanceMonitor::ThreadStatistics::cpuUtilUser() const
+{
+    return d_cpuUtilUser;
+}
+
+inline
+double PerformanceMonitor::ThreadStatistics::cpuUtilSystem() const
+{
+    return d_cpuUtilSystem;
+}
+
+inline
+double PerformanceMonitor::ThreadStatistics::runQueueWaitTime() const
+{
+    return d_runQueueWaitTime;
+}
+
+inline
+double PerformanceMonitor::ThreadStatistics::runQueueWaitUtil() const
+{
+    return d_runQueueWaitUtil;
+}
+
+inline
+bsls::Types::Int64
+PerformanceMonitor::ThreadStatistics::numVoluntaryContextSwitches() const
+{
+    return d_numVoluntaryContextSwitches;
+}
+
+inline
+bsls::Types::Int64
+PerformanceMonitor::ThreadStatistics::numInvoluntaryContextSwitches() const
+{
+    return d_numInvoluntaryContextSwitches;
+}
+
+inline
+bsls::Types::Int64
+PerformanceMonitor::ThreadStatistics::numMinorPageFaults() const
+{
+    return d_numMinorPageFaults;
+}
+
+inline
+bsls::Types::Int64
+PerformanceMonitor::ThreadStatistics::numMajorPageFaults() const
+{
+    return d_numMajorPageFaults;
+}
+
                  // ------------------------------------
                  // class PerformanceMonitor::Statistics
                  // ------------------------------------
@@ -783,6 +1102,12 @@ PerformanceMonitor::numRegisteredPids() const
     return static_cast<int>(d_pidMap.size());
 }
 
+inline
+bool PerformanceMonitor::isThreadStatisticsEnabled() const
+{
+    return d_threadStatisticsEnabled;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -35,9 +35,13 @@
 #include <bslmf_assert.h>
 
 #include <bslmt_barrier.h>
+#include <bslmt_threadattributes.h>
+#include <bslmt_threadgroup.h>
 #include <bslmt_threadutil.h>
 
+#include <bsls_atomic.h>
 #include <bsls_platform.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #if defined(BSLS_PLATFORM_OS_UNIX)
@@ -50,6 +54,7 @@
 #else
 #include <bsl_c_errno.h>
 #include <bsl_c_signal.h>
+#include <fcntl.h>
 #include <unistd.h>
 #include <sys/wait.h>
 #endif
@@ -72,6 +77,26 @@ using namespace bsl;
 // CREATORS
 // [10] Statistics(const Statistics& orig, Allocator *basicAllocator);
 //
+// ACCESSORS
+// [12] void loadThreadStatistics(bsl::vector<ThreadStatistics> *) const;
+//
+//                        // ----------------------
+//                        // class ThreadStatistics
+//                        // ----------------------
+// ACCESSORS
+// [12] int tid() const;
+// [12] const bsl::string& name() const;
+// [12] double cpuTimeUser() const;
+// [12] double cpuTimeSystem() const;
+// [12] double cpuUtilUser() const;
+// [12] double cpuUtilSystem() const;
+// [12] double runQueueWaitTime() const;
+// [12] double runQueueWaitUtil() const;
+// [12] Int64 numVoluntaryContextSwitches() const;
+// [12] Int64 numInvoluntaryContextSwitches() const;
+// [12] Int64 numMinorPageFaults() const;
+// [12] Int64 numMajorPageFaults() const;
+//
 //                           // -------------------
 //                           // class ConstIterator
 //                           // -------------------
@@ -91,13 +116,17 @@ using namespace bsl;
 // [ 8] ConstIterator end() const;
 // [ 9] ConstIterator find(int pid) const;
 // [ 2] int numRegisteredPids() const
+// [12] void setThreadStatisticsEnabled(bool value);
+// [12] bool isThreadStatisticsEnabled() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [11] USAGE EXAMPLE
+// [13] USAGE EXAMPLE
 // [ 3] CONCERN: The Process Start Time is Reasonable
 // [ 5] CONCERN: Statistics are Reset Correctly (DRQS 49280976)
+// [12] CONCERN: I/O Measures are Collected
 // [-1] TESTING VIRTUAL SIZE AND RESIDENT SIZE
 // [-3] DUMMY TEST CASE
+// [-4] PERFORMANCE: COLLECTING PER-THREAD STATISTICS
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -552,6 +581,93 @@ long long controlledCpuBurn()
     return factorial;
 }
 
+class SpinningThread {
+    // This functor burns CPU time until the flag it refers to is set.
+
+    // DATA
+    bsls::AtomicBool *d_done_p;  // flag signaling the thread to exit (held)
+
+  public:
+    // CREATORS
+    explicit SpinningThread(bsls::AtomicBool *done)
+        // Create a functor that runs until the specified 'done' is 'true'.
+    : d_done_p(done)
+    {
+    }
+
+    // ACCESSORS
+    void operator()() const
+        // Burn CPU time until the flag referred to by this object is set.
+    {
+        volatile double x = 1.0;
+        while (!*d_done_p) {
+            x /= 0.999999;
+            x -= 0.000001;
+        }
+    }
+};
+
+class SleepingThread {
+    // This functor repeatedly sleeps until the flag it refers to is set.
+
+    // DATA
+    bsls::AtomicBool *d_done_p;  // flag signaling the thread to exit (held)
+
+  public:
+    // CREATORS
+    explicit SleepingThread(bsls::AtomicBool *done)
+        // Create a functor that runs until the specified 'done' is 'true'.
+    : d_done_p(done)
+    {
+    }
+
+    // ACCESSORS
+    void operator()() const
+        // Sleep, in steps of a millisecond, until the flag referred to by
+        // this object is set.
+    {
+        while (!*d_done_p) {
+            bslmt::ThreadUtil::microSleep(1000);
+        }
+    }
+};
+
+class BlockedThread {
+    // This functor waits on a barrier.
+
+    // DATA
+    bslmt::Barrier *d_barrier_p;  // barrier to wait on (held)
+
+  public:
+    // CREATORS
+    explicit BlockedThread(bslmt::Barrier *barrier)
+        // Create a functor that waits on the specified 'barrier'.
+    : d_barrier_p(barrier)
+    {
+    }
+
+    // ACCESSORS
+    void operator()() const
+        // Wait on the barrier referred to by this object.
+    {
+        d_barrier_p->wait();
+    }
+};
+
+const Obj::ThreadStatistics *findThread(
+                              const bsl::vector<Obj::ThreadStatistics>& stats,
+                              const char                               *name)
+    // Return the address of the first element of the specified 'stats'
+    // having the specified 'name', or 0 if there is no such element.
+{
+    for (bsl::size_t i = 0; i < stats.size(); ++i) {
+        if (stats[i].name() == name) {
+            return &stats[i];                                         // RETURN
+        }
+    }
+    return 0;
+}
+
 ObjIterator advanceIt(const ObjIterator& begin, int n)
     // Return a copy of the specified 'begin', incremented by the specified 'n'
     // elements.
@@ -579,7 +695,7 @@ int main(int argc, char *argv[])
     veryVeryVeryVerbose = (argc > 5);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 11: {
+      case 13: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -625,6 +741,11 @@ int main(int argc, char *argv[])
     ASSERT(0 == rc);
     ASSERT(1 == perfmon.numRegisteredPids());
 //..
+// We also enable the collection of the statistics of each thread of the
+// process (see {Per-Thread Statistics}):
+//..
+    perfmon.setThreadStatisticsEnabled(true);
+//..
 // Next, we print a formatted report of the performance statistics collected
 // for each pid every 5 seconds for half a minute.  Note, that 'Statistics'
 // object can be simultaneously modified by scheduler callback and accessed via
@@ -642,6 +763,18 @@ int main(int argc, char *argv[])
 
         bsl::cout << "PID = " << stats.pid() << ":\n";
         stats.print(bsl::cout);
+
+        bsl::vector<balb::PerformanceMonitor::ThreadStatistics> threads;
+        stats.loadThreadStatistics(&threads);
+
+        for (bsl::size_t j = 0; j < threads.size(); ++j) {
+            bsl::cout << "    TID " << threads[j].tid()
+                      << " (" << threads[j].name() << "): "
+                      << threads[j].cpuUtilUser() +
+                                               threads[j].cpuUtilSystem()
+                      << "% CPU, " << threads[j].runQueueWaitUtil()
+                      << "% waiting\n";
+        }
     }
 //..
 // Finally, we unregister the process and stop the scheduler to cease
@@ -657,6 +790,255 @@ int main(int argc, char *argv[])
     scheduler.stop();
 //..
       } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // TESTING PER-THREAD STATISTICS
+        //
+        // Concerns:
+        //: 1 Per-thread statistics are not collected by default, and
+        //:   'setThreadStatisticsEnabled' enables and disables their
+        //:   collection.
+        //:
+        //: 2 On Linux, the statistics of every thread of the monitored process
+        //:   are loaded, once, ordered by thread identifier, and report the
+        //:   name of the thread.
+        //:
+        //: 3 The CPU time and utilization of a thread spinning on a CPU are
+        //:   reported, and the CPU utilization of a thread seen for the first
+        //:   time is 0.
+        //:
+        //: 4 The context switches of a thread repeatedly sleeping are
+        //:   reported.
+        //:
+        //: 5 Copies of 'Statistics' objects have the same per-thread
+        //:   statistics, and 'reset' discards them.
+        //:
+        //: 6 On Linux, the number of bytes read and written by the process
+        //:   are collected.
+        //:
+        //: 7 The per-thread statistics are allocated from the allocator of
+        //:   the performance monitor.
+        //
+        // Plan:
+        //: 1 Create a performance monitor, register the current process, and
+        //:   verify that no per-thread statistics are loaded after a
+        //:   collection.  (C-1)
+        //:
+        //: 2 Start a spinning and a sleeping thread having known names,
+        //:   enable per-thread statistics, collect twice, and verify the
+        //:   loaded statistics.  (C-2..4, 7)
+        //:
+        //: 3 Copy the statistics, reset them, and verify the per-thread
+        //:   statistics of the copy and of the original.  (C-5)
+        //:
+        //: 4 Write a known number of bytes to '/dev/null', collect, and
+        //:   verify the 'e_IO_READ' and 'e_IO_WRITE' measures.  (C-6)
+        //:
+        //: 5 Disable per-thread statistics, collect, and verify that no
+        //:   per-thread statistics are loaded.  (C-1)
+        //
+        // Testing:
+        //   void setThreadStatisticsEnabled(bool value);
+        //   bool isThreadStatisticsEnabled() const;
+        //   void loadThreadStatistics(bsl::vector<ThreadStatistics> *) const;
+        //   int tid() const;
+        //   const bsl::string& name() const;
+        //   double cpuTimeUser() const;
+        //   double cpuTimeSystem() const;
+        //   double cpuUtilUser() const;
+        //   double cpuUtilSystem() const;
+        //   double runQueueWaitTime() const;
+        //   double runQueueWaitUtil() const;
+        //   Int64 numVoluntaryContextSwitches() const;
+        //   Int64 numInvoluntaryContextSwitches() const;
+        //   Int64 numMinorPageFaults() const;
+        //   Int64 numMajorPageFaults() const;
+        //   CONCERN: I/O Measures are Collected
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING PER-THREAD STATISTICS\n"
+                          << "=============================\n";
+
+        bslma::TestAllocator         ma("monitor", veryVeryVeryVerbose);
+        bslma::TestAllocator         sa("supplied", veryVeryVeryVerbose);
+
+        Obj        mX(&ma);
+        const Obj& X = mX;
+
+        ASSERT(false == X.isThreadStatisticsEnabled());
+
+        ASSERT(0 == mX.registerPid(0, "perfmon"));
+
+        bsl::vector<Obj::ThreadStatistics> threads(&sa);
+
+        mX.collect();
+        X.begin()->loadThreadStatistics(&threads);
+        ASSERT(threads.empty());
+
+        bsls::AtomicBool            done(false);
+        bslmt::ThreadUtil::Handle   spinning;
+        bslmt::ThreadUtil::Handle   sleeping;
+        bslmt::ThreadAttributes     attributes;
+
+        attributes.setThreadName("spinning");
+        ASSERT(0 == bslmt::ThreadUtil::create(&spinning,
+                                              attributes,
+                                              SpinningThread(&done)));
+
+        attributes.setThreadName("sleeping");
+        ASSERT(0 == bslmt::ThreadUtil::create(&sleeping,
+                                              attributes,
+                                              SleepingThread(&done)));
+
+        mX.setThreadStatisticsEnabled(true);
+        ASSERT(true == X.isThreadStatisticsEnabled());
+
+        mX.collect();
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+        {
+            X.begin()->loadThreadStatistics(&threads);
+
+            ASSERTV(threads.size(), 3 <= threads.size());
+            ASSERTV(threads.size(),
+                    X.begin()->latestValue(Obj::e_NUM_THREADS),
+                    static_cast<double>(threads.size()) ==
+                                  X.begin()->latestValue(Obj::e_NUM_THREADS));
+
+            for (bsl::size_t i = 0; i < threads.size(); ++i) {
+                const Obj::ThreadStatistics& T = threads[i];
+
+                if (veryVerbose) {
+                    P_(T.tid()) P_(T.name()) P(T.cpuTimeUser())
+                }
+
+                ASSERTV(i, 0 < T.tid());
+                ASSERTV(i, 0 == i || threads[i - 1].tid() < T.tid());
+                ASSERTV(i, 0 == T.cpuUtilUser());
+                ASSERTV(i, 0 == T.cpuUtilSystem());
+                ASSERTV(i, 0 == T.runQueueWaitUtil());
+                ASSERTV(i, 0 <= T.cpuTimeSystem());
+                ASSERTV(i, 0 <= T.runQueueWaitTime());
+                ASSERTV(i, 0 <= T.numInvoluntaryContextSwitches());
+                ASSERTV(i, 0 <= T.numMajorPageFaults());
+                ASSERTV(i, 0 <= T.numMinorPageFaults());
+            }
+
+            ASSERT(threads[0].tid() == bdls::ProcessUtil::getProcessId());
+            ASSERT(findThread(threads, "spinning"));
+            ASSERT(findThread(threads, "sleeping"));
+        }
+#endif
+
+        bslmt::ThreadUtil::microSleep(0, 1);
+
+        mX.collect();
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+        {
+            const bsls::Types::Int64 NUM_MONITOR_BYTES = ma.numBytesInUse();
+
+            X.begin()->loadThreadStatistics(&threads);
+
+            ASSERT(NUM_MONITOR_BYTES == ma.numBytesInUse());
+            ASSERT(&sa == threads.get_allocator().mechanism());
+
+            const Obj::ThreadStatistics *spinningStats =
+                                               findThread(threads, "spinning");
+            const Obj::ThreadStatistics *sleepingStats =
+                                               findThread(threads, "sleeping");
+
+            ASSERT(spinningStats);
+            ASSERT(sleepingStats);
+
+            if (spinningStats && sleepingStats) {
+                if (veryVerbose) {
+                    P_(spinningStats->cpuUtilUser())
+                    P(spinningStats->cpuTimeUser())
+                    P_(sleepingStats->cpuUtilUser())
+                    P(sleepingStats->numVoluntaryContextSwitches())
+                }
+
+                ASSERT(0 < spinningStats->cpuTimeUser());
+                ASSERT(0 < spinningStats->cpuUtilUser()
+                                             + spinningStats->cpuUtilSystem());
+                ASSERT(sleepingStats->cpuUtilUser()
+                                            + sleepingStats->cpuUtilSystem()
+                     < spinningStats->cpuUtilUser()
+                                            + spinningStats->cpuUtilSystem());
+                ASSERT(0 < sleepingStats->numVoluntaryContextSwitches());
+            }
+
+            if (verbose) cout << "\tTesting copying and resetting" << endl;
+
+            const Obj::Statistics XS(*X.begin(), &sa);
+
+            bsl::vector<Obj::ThreadStatistics> copied(&sa);
+            XS.loadThreadStatistics(&copied);
+
+            ASSERT(copied.size() == threads.size());
+            for (bsl::size_t i = 0; i < copied.size(); ++i) {
+                ASSERTV(i, copied[i].tid()  == threads[i].tid());
+                ASSERTV(i, copied[i].name() == threads[i].name());
+                ASSERTV(i, copied[i].cpuTimeUser() ==
+                                                     threads[i].cpuTimeUser());
+            }
+
+            mX.resetStatistics();
+            XS.loadThreadStatistics(&copied);
+            ASSERT(copied.size() == threads.size());
+
+            // 'resetStatistics' collects the statistics after resetting
+            // them, so the threads are reported as seen for the first time.
+
+            X.begin()->loadThreadStatistics(&threads);
+            ASSERT(3 <= threads.size());
+            for (bsl::size_t i = 0; i < threads.size(); ++i) {
+                ASSERTV(i, 0 == threads[i].cpuUtilUser());
+            }
+        }
+
+        if (verbose) cout << "\tTesting I/O measures" << endl;
+        {
+            mX.collect();
+
+            const double READ    = X.begin()->latestValue(Obj::e_IO_READ);
+            const double WRITTEN = X.begin()->latestValue(Obj::e_IO_WRITE);
+
+            // Reading the '/proc' filesystem is accounted for.
+
+            ASSERTV(READ, 0 < READ);
+
+            const bsl::size_t  SIZE = 1024 * 1024;
+            bsl::vector<char>  buffer(SIZE, 'x', &sa);
+
+            int fd = open("/dev/null", O_WRONLY);
+            ASSERT(0 <= fd);
+            for (int i = 0; i < 4; ++i) {
+                ASSERT(static_cast<ssize_t>(SIZE) ==
+                                               write(fd, buffer.data(), SIZE));
+            }
+            close(fd);
+
+            mX.collect();
+
+            ASSERTV(WRITTEN, X.begin()->latestValue(Obj::e_IO_WRITE),
+                    WRITTEN + 4 <= X.begin()->latestValue(Obj::e_IO_WRITE));
+            ASSERT(READ <= X.begin()->latestValue(Obj::e_IO_READ));
+        }
+#endif
+
+        mX.setThreadStatisticsEnabled(false);
+        ASSERT(false == X.isThreadStatisticsEnabled());
+
+        mX.collect();
+        X.begin()->loadThreadStatistics(&threads);
+        ASSERT(threads.empty());
+
+        done = true;
+        ASSERT(0 == bslmt::ThreadUtil::join(spinning));
+        ASSERT(0 == bslmt::ThreadUtil::join(sleeping));
+      } break;
       case 10: {
         // --------------------------------------------------------------------
         // TESTING STATISTICS COPY CONSTRUCTOR
@@ -1908,6 +2290,65 @@ int main(int argc, char *argv[])
 
         bslmt::ThreadUtil::microSleep(0, 30);
       } break;
+      case -4: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: COLLECTING PER-THREAD STATISTICS
+        //   Measure the time taken by 'collect' for a process having 500
+        //   threads, with and without per-thread statistics.
+        //
+        // Concerns:
+        //:  1 Collecting per-thread statistics for a process having hundreds
+        //:    of threads takes a small fraction of a one-second collection
+        //:    interval.
+        //
+        // Plan:
+        //:  1 Start 500 threads blocked on a barrier, and time a series of
+        //:    collections with per-thread statistics disabled, and then
+        //:    enabled.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: COLLECTING PER-THREAD STATISTICS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "PERFORMANCE: COLLECTING PER-THREAD STATISTICS\n"
+                          << "=============================================\n";
+
+        enum { k_NUM_THREADS = 500, k_NUM_COLLECTIONS = 20 };
+
+        bslmt::Barrier      barrier(k_NUM_THREADS + 1);
+        bslmt::ThreadGroup  threadGroup;
+
+        ASSERT(k_NUM_THREADS == threadGroup.addThreads(BlockedThread(&barrier),
+                                                       k_NUM_THREADS));
+
+        Obj perfmon;
+        ASSERT(0 == perfmon.registerPid(0, "perfmon"));
+
+        for (int enabled = 0; enabled < 2; ++enabled) {
+            perfmon.setThreadStatisticsEnabled(enabled);
+            perfmon.collect();
+
+            bsls::Stopwatch stopwatch;
+            stopwatch.start();
+            for (int i = 0; i < k_NUM_COLLECTIONS; ++i) {
+                perfmon.collect();
+            }
+            stopwatch.stop();
+
+            bsl::vector<Obj::ThreadStatistics> threads;
+            perfmon.begin()->loadThreadStatistics(&threads);
+
+            cout << "Per-thread statistics "
+                 << (enabled ? "enabled: " : "disabled:")
+                 << " threads = " << threads.size()
+                 << ", wall = "
+                 << stopwatch.elapsedTime() * 1000 / k_NUM_COLLECTIONS
+                 << " ms per collection" << endl;
+        }
+
+        barrier.wait();
+        threadGroup.joinAll();
+      } break;
       default: {
         bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
         testStatus = -1;
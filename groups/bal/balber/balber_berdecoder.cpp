@@ -40,6 +40,8 @@ BerDecoder::BerDecoder(const BerDecoderOptions *options,
 , d_logStream(0)
 , d_severity(e_BER_SUCCESS)
 , d_streamBuf(0)
+, d_input_p(0)
+, d_inputLength(0)
 , d_currentDepth(0)
 , d_numUnknownElementsSkipped(0)
 , d_topNode(0)
@@ -230,6 +232,56 @@ int BerDecoder_Node::decode(bsl::vector<unsigned char> *variable,
     }
 }
 
+int BerDecoder_Node::decode(bslstl::StringRef          *variable,
+                            bdlat_TypeCategory::Simple  )
+{
+    if (d_tagType != BerConstants::e_PRIMITIVE) {
+        return logError("Expected PRIMITIVE tag type for 'StringRef'");
+                                                                      // RETURN
+    }
+
+    if (0 == d_decoder->d_input_p) {
+        return logError("'StringRef' can be decoded only from a contiguous "
+                        "input buffer");                              // RETURN
+    }
+
+    if (d_expectedLength < 0) {
+        return logError("'StringRef' with indefinite length "
+                        "is not supported");                          // RETURN
+    }
+
+    bsl::streambuf::pos_type offset = d_decoder->d_streamBuf->pubseekoff(
+                                                          0,
+                                                          bsl::ios_base::cur,
+                                                          bsl::ios_base::in);
+
+    if (offset < 0
+     || d_decoder->d_inputLength - static_cast<bsl::size_t>(offset) <
+                                static_cast<bsl::size_t>(d_expectedLength)) {
+        return logError("Stream error while reading 'StringRef'");
+                                                                      // RETURN
+    }
+
+    variable->assign(d_decoder->d_input_p + static_cast<bsl::size_t>(offset),
+                     d_expectedLength);
+
+    if (0 != d_expectedLength) {
+        const bsl::streambuf::pos_type end =
+                       offset + static_cast<bsl::streamoff>(d_expectedLength);
+
+        if (end != d_decoder->d_streamBuf->pubseekoff(d_expectedLength,
+                                                      bsl::ios_base::cur,
+                                                      bsl::ios_base::in)) {
+            return logError("Stream error while reading 'StringRef'");
+                                                                      // RETURN
+        }
+    }
+
+    d_consumedBodyBytes = d_expectedLength;
+
+    return BerDecoder::e_BER_SUCCESS;
+}
+
 int BerDecoder_Node::readTagHeader()
 {
     if (d_decoder->maxDepthExceeded()) {
@@ -287,11 +339,28 @@ int BerDecoder_Node::skipField()
     }
 
     if (BerUtil::k_INDEFINITE_LENGTH != d_expectedLength) {
-        // We would do this, but not every streambuf is seekable:
-        //..
-        //  d_decoder->d_streamBuf->pubseekoff(d_expectedLength,
-        //                                     bsl::ios_base::cur,
-        //..                                   bsl::ios_base::in);
+        if (d_decoder->d_input_p) {
+            // The input is a contiguous buffer, whose stream buffer is
+            // seekable, so skip the whole field in one step.
+
+            bsl::streambuf *streamBuf = d_decoder->d_streamBuf;
+
+            if (streamBuf->in_avail() < d_expectedLength
+             || bsl::streampos(bsl::streamoff(-1)) ==
+                               streamBuf->pubseekoff(d_expectedLength,
+                                                     bsl::ios_base::cur,
+                                                     bsl::ios_base::in)) {
+                return logError("Error reading stream while skipping field");
+                                                                      // RETURN
+            }
+
+            d_consumedBodyBytes += d_expectedLength;
+
+            return BerDecoder::e_BER_SUCCESS;                         // RETURN
+        }
+
+        // Otherwise we would seek as above, but not every streambuf is
+        // seekable, so read through the field instead.
 
         char buffer[1024];
         int  remainLength = d_expectedLength;
@@ -24,13 +24,48 @@ BSLS_IDENT("$Id: $")
 // that contains a parameterized 'decode' function.  The 'decode' function
 // decodes data read from a specified stream and loads the corresponding object
 // to an object of the parameterized type.  The 'decode' method is overloaded
-// for two types of input streams:
+// for two types of input streams and for a contiguous input buffer:
 //: o 'bsl::streambuf'
 //: o 'bsl::istream'
+//: o 'const char *' and a length
 //
 // This class decodes objects based on the X.690 BER specification and is
 // restricted to types supported by the 'bdlat' framework.
 //
+///Decoding 'bslstl::StringRef' Elements
+///-------------------------------------
+// When the input is supplied as a contiguous buffer, elements of type
+// 'bslstl::StringRef' may be decoded without copying: each such element is
+// loaded with a reference to its content octets within the input buffer.
+// The input buffer must therefore outlive any use of the decoded object.  BER
+// string values are never escaped, so no memory is allocated for these
+// elements.  Decoding a 'bslstl::StringRef' element from a 'bsl::streambuf'
+// or a 'bsl::istream' fails, since the content octets are not guaranteed to
+// remain addressable after being read.
+//
+///Decoding Many Messages Into an Arena
+///------------------------------------
+// A decoded object obtains the memory for its strings and arrays from its own
+// allocator, so decoding a stream of messages, each into a freshly created
+// object, allocates and deallocates memory for every message.  Instead, the
+// object may be held by a 'bdlma::ArenaObject', whose 'reset' method discards
+// the previous message, and all the memory it used, in one step.  Neither
+// 'decode' nor the decoder itself allocates memory per message, so once the
+// arena has grown to fit the largest message, decoding into the held object
+// allocates no memory at all:
+//..
+//  bdlma::ArenaObject<s_baltst::Employee> employee;
+//  balber::BerDecoder                     decoder;
+//
+//  while (receiveMessage(&buffer, &length)) {
+//      employee.reset();
+//      if (0 != decoder.decode(buffer, length, employee.object())) {
+//          // handle error
+//      }
+//      processEmployee(*employee.object());
+//  }
+//..
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -110,6 +145,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlb_variant.h>
 
+#include <bdlsb_fixedmeminstreambuf.h>
 #include <bdlsb_memoutstreambuf.h>
 
 #include <bsls_assert.h>
@@ -117,6 +153,7 @@ BSLS_IDENT("$Id: $")
 #include <bsls_platform.h>
 #include <bsls_review.h>
 
+#include <bsl_cstddef.h>
 #include <bsl_istream.h>
 #include <bsl_ostream.h>
 #include <bsl_vector.h>
@@ -206,6 +243,15 @@ class BerDecoder {
 
     ErrorSeverity                    d_severity;     // error severity level
     bsl::streambuf                  *d_streamBuf;    // held, not owned
+    const char                      *d_input_p;      // contiguous input
+                                                     // underlying
+                                                     // 'd_streamBuf', or 0
+                                                     // if none (held, not
+                                                     // owned)
+
+    bsl::size_t                      d_inputLength;  // length of
+                                                     // 'd_input_p'
+
     int                              d_currentDepth; // current depth
 
     int                              d_numUnknownElementsSkipped;
@@ -256,14 +302,27 @@ class BerDecoder {
     int decode(bsl::streambuf *streamBuf, TYPE *variable);
         // Decode an object of parameterized 'TYPE' from the specified
         // 'streamBuf' and load the result into the specified 'variable'.
-        // Return 0 on success, and a non-zero value otherwise.
+        // Return 0 on success, and a non-zero value otherwise.  Note that
+        // decoding fails if 'TYPE' contains 'bslstl::StringRef' elements.
 
     template <typename TYPE>
     int decode(bsl::istream& stream, TYPE *variable);
         // Decode an object of parameterized 'TYPE' from the specified 'stream'
         // and load the result into the specified modifiable 'variable'.
         // Return 0 on success, and a non-zero value otherwise.  If the
-        // decoding fails 'stream' will be invalidated.
+        // decoding fails 'stream' will be invalidated.  Note that decoding
+        // fails if 'TYPE' contains 'bslstl::StringRef' elements.
+
+    template <typename TYPE>
+    int decode(const char *buffer, bsl::size_t length, TYPE *variable);
+        // Decode an object of parameterized 'TYPE' from the specified
+        // 'buffer' of the specified 'length' and load the result into the
+        // specified 'variable'.  Return 0 on success, and a non-zero value
+        // otherwise.  Elements of 'variable' of type 'bslstl::StringRef' are
+        // loaded with references into 'buffer'; the behavior is undefined if
+        // such an element is used after 'buffer' is modified or destroyed.
+        // The behavior is also undefined unless '0 == length' or 'buffer'
+        // refers to at least 'length' bytes.
 
     void setNumUnknownElementsSkipped(int value);
         // Set the number of unknown elements skipped by the decoder during the
@@ -331,6 +390,7 @@ class BerDecoder_Node {
     int decode(bsl::vector<char> *variable, bdlat_TypeCategory::Array);
     int decode(bsl::vector<unsigned char> *variable,
                bdlat_TypeCategory::Array);
+    int decode(bslstl::StringRef *variable, bdlat_TypeCategory::Simple);
     template <typename TYPE>
     int decode(TYPE *variable, bdlat_TypeCategory::Array);
     template <typename TYPE>
@@ -662,6 +722,25 @@ int BerDecoder::decode(bsl::streambuf *streamBuf, TYPE *variable)
     return rc;
 }
 
+template <typename TYPE>
+int BerDecoder::decode(const char *buffer, bsl::size_t length, TYPE *variable)
+{
+    BSLS_ASSERT(buffer || 0 == length);
+    BSLS_ASSERT(variable);
+
+    bdlsb::FixedMemInStreamBuf streamBuf(buffer, length);
+
+    d_input_p     = buffer;
+    d_inputLength = length;
+
+    int rc = this->decode(&streamBuf, variable);
+
+    d_input_p     = 0;
+    d_inputLength = 0;
+
+    return rc;
+}
+
 inline
 void BerDecoder::setNumUnknownElementsSkipped(int value)
 {
@@ -33,6 +33,7 @@
 #include <bdlat_selectioninfo.h>
 #include <bdlat_valuetypefunctions.h>
 #include <bdlb_string.h>
+#include <bdlma_arenaobject.h>
 #include <bdlsb_memoutstreambuf.h>      // for testing only
 #include <bdlsb_fixedmeminstreambuf.h>  // for testing only
 
@@ -57,10 +58,12 @@
 
 #include <bslim_testutil.h>
 
+#include <bslma_defaultallocatorguard.h>
 #include <bslma_testallocator.h>
 #include <bslma_testallocatormonitor.h>
 
 #include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
 #include <bsl_fstream.h>
 #include <bsl_iostream.h>
 #include <bsl_iomanip.h>
@@ -1479,6 +1482,196 @@ bsl::ostream& MySequenceWithDefaultValues::print(
 }
 
 }  // close package namespace
+}  // close enterprise namespace
+
+                          // ======================
+                          // struct StringRefRecord
+                          // ======================
+
+namespace BloombergLP {
+namespace u {
+
+struct StringRefRecord {
+    // This 'struct' is a sequence of a 'bslstl::StringRef' and an array of
+    // 'bslstl::StringRef', used to test decoding references into the input.
+
+    // CONSTANTS
+    enum {
+        k_NAME_ATTRIBUTE_ID   = 0,
+        k_VALUES_ATTRIBUTE_ID = 1
+    };
+
+    // DATA
+    bslstl::StringRef              d_name;
+    bsl::vector<bslstl::StringRef> d_values;
+};
+
+bdlat_AttributeInfo stringRefRecordInfo(int attributeId)
+    // Return the attribute information of the 'StringRefRecord' attribute
+    // having the specified 'attributeId'.
+{
+    bdlat_AttributeInfo info;
+
+    info.annotation()     = "";
+    info.formattingMode() = bdlat_FormattingMode::e_DEFAULT;
+    info.id()             = attributeId;
+    info.name()           = StringRefRecord::k_NAME_ATTRIBUTE_ID == attributeId
+                          ? "name"
+                          : "values";
+    info.nameLength()     = static_cast<int>(bsl::strlen(info.name()));
+
+    return info;
+}
+
+int stringRefRecordId(const char *attributeName, int attributeNameLength)
+    // Return the id of the 'StringRefRecord' attribute having the specified
+    // 'attributeName' of the specified 'attributeNameLength', or -1 if there
+    // is no such attribute.
+{
+    if (bdlb::String::areEqualCaseless("name",
+                                       attributeName,
+                                       attributeNameLength)) {
+        return StringRefRecord::k_NAME_ATTRIBUTE_ID;                  // RETURN
+    }
+    if (bdlb::String::areEqualCaseless("values",
+                                       attributeName,
+                                       attributeNameLength)) {
+        return StringRefRecord::k_VALUES_ATTRIBUTE_ID;                // RETURN
+    }
+    return -1;
+}
+
+template <class MANIPULATOR>
+int bdlat_sequenceManipulateAttribute(StringRefRecord *object,
+                                      MANIPULATOR&     manipulator,
+                                      int              attributeId)
+{
+    switch (attributeId) {
+      case StringRefRecord::k_NAME_ATTRIBUTE_ID: {
+        return manipulator(&object->d_name,
+                           stringRefRecordInfo(attributeId));         // RETURN
+      }
+      case StringRefRecord::k_VALUES_ATTRIBUTE_ID: {
+        return manipulator(&object->d_values,
+                           stringRefRecordInfo(attributeId));         // RETURN
+      }
+    }
+    return -1;
+}
+
+template <class MANIPULATOR>
+int bdlat_sequenceManipulateAttribute(StringRefRecord *object,
+                                      MANIPULATOR&     manipulator,
+                                      const char      *attributeName,
+                                      int              attributeNameLength)
+{
+    return bdlat_sequenceManipulateAttribute(
+                          object,
+                          manipulator,
+                          stringRefRecordId(attributeName,
+                                            attributeNameLength));
+}
+
+template <class MANIPULATOR>
+int bdlat_sequenceManipulateAttributes(StringRefRecord *object,
+                                       MANIPULATOR&     manipulator)
+{
+    int rc = bdlat_sequenceManipulateAttribute(
+                                       object,
+                                       manipulator,
+                                       StringRefRecord::k_NAME_ATTRIBUTE_ID);
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
+    return bdlat_sequenceManipulateAttribute(
+                                       object,
+                                       manipulator,
+                                       StringRefRecord::k_VALUES_ATTRIBUTE_ID);
+}
+
+template <class ACCESSOR>
+int bdlat_sequenceAccessAttribute(const StringRefRecord& object,
+                                  ACCESSOR&              accessor,
+                                  int                    attributeId)
+{
+    switch (attributeId) {
+      case StringRefRecord::k_NAME_ATTRIBUTE_ID: {
+        return accessor(object.d_name,
+                        stringRefRecordInfo(attributeId));            // RETURN
+      }
+      case StringRefRecord::k_VALUES_ATTRIBUTE_ID: {
+        return accessor(object.d_values,
+                        stringRefRecordInfo(attributeId));            // RETURN
+      }
+    }
+    return -1;
+}
+
+template <class ACCESSOR>
+int bdlat_sequenceAccessAttribute(const StringRefRecord&  object,
+                                  ACCESSOR&               accessor,
+                                  const char             *attributeName,
+                                  int                     attributeNameLength)
+{
+    return bdlat_sequenceAccessAttribute(
+                          object,
+                          accessor,
+                          stringRefRecordId(attributeName,
+                                            attributeNameLength));
+}
+
+template <class ACCESSOR>
+int bdlat_sequenceAccessAttributes(const StringRefRecord& object,
+                                   ACCESSOR&              accessor)
+{
+    int rc = bdlat_sequenceAccessAttribute(
+                                       object,
+                                       accessor,
+                                       StringRefRecord::k_NAME_ATTRIBUTE_ID);
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
+    return bdlat_sequenceAccessAttribute(
+                                       object,
+                                       accessor,
+                                       StringRefRecord::k_VALUES_ATTRIBUTE_ID);
+}
+
+bool bdlat_sequenceHasAttribute(const StringRefRecord&,
+                                int                    attributeId)
+{
+    return StringRefRecord::k_NAME_ATTRIBUTE_ID   == attributeId
+        || StringRefRecord::k_VALUES_ATTRIBUTE_ID == attributeId;
+}
+
+bool bdlat_sequenceHasAttribute(const StringRefRecord&  object,
+                                const char             *attributeName,
+                                int                     attributeNameLength)
+{
+    return bdlat_sequenceHasAttribute(
+                          object,
+                          stringRefRecordId(attributeName,
+                                            attributeNameLength));
+}
+
+void bdlat_valueTypeReset(StringRefRecord *object)
+    // Reset the specified 'object' to the default value, retaining the
+    // capacity of its array.
+{
+    object->d_name.reset();
+    object->d_values.clear();
+}
+
+}  // close namespace u
+
+namespace bdlat_SequenceFunctions {
+
+template <>
+struct IsSequence<u::StringRefRecord> {
+    enum { VALUE = 1 };
+};
+
+}  // close namespace bdlat_SequenceFunctions
 }  // close enterprise namespace
 
 // ============================================================================
@@ -1958,7 +2151,7 @@ int main(int argc, char *argv[])
     bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 21: {
+      case 24: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   Extracted from component header file.
@@ -1983,6 +2176,368 @@ int main(int argc, char *argv[])
 
         if (verbose) bsl::cout << "\nEnd of test." << bsl::endl;
       } break;
+      case 23: {
+        // --------------------------------------------------------------------
+        // TESTING DEFINITE LENGTH ENCODINGS
+        //
+        // Concerns:
+        //: 1 Values encoded with the 'EncodeDefiniteLength' encoder option
+        //:   decode to the original value, from both a 'bsl::streambuf' and a
+        //:   contiguous buffer.
+        //:
+        //: 2 Unknown elements having the definite length form, primitive or
+        //:   constructed, are skipped when decoding from a contiguous buffer,
+        //:   and the decoding of the remaining elements is unaffected.
+        //:
+        //: 3 An unknown element whose length exceeds the remaining input is
+        //:   reported as an error.
+        //
+        // Plan:
+        //: 1 Encode values of several types using the definite length form,
+        //:   and decode them using both 'decode' overloads.  (C-1)
+        //:
+        //: 2 Decode, from a contiguous buffer, encodings of 'MySequence' that
+        //:   contain unknown elements, verifying the decoded value and the
+        //:   number of skipped elements.  (C-2)
+        //:
+        //: 3 Decode an encoding whose unknown element is truncated and verify
+        //:   that decoding fails.  (C-3)
+        //
+        // Testing:
+        //   DEFINITE LENGTH ENCODINGS
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nTESTING DEFINITE LENGTH ENCODINGS"
+                               << "\n================================="
+                               << bsl::endl;
+
+        balber::BerEncoderOptions encoderOptions;
+        encoderOptions.setEncodeDefiniteLength(true);
+
+        balber::BerEncoder definiteEncoder(&encoderOptions);
+
+        if (verbose) bsl::cout << "\nTesting round trips." << bsl::endl;
+        {
+            test::Employee employee;
+            employee.name()                 = "Bob";
+            employee.homeAddress().street() = "Some Street";
+            employee.homeAddress().city()   = "Some City";
+            employee.homeAddress().state()  = "Some State";
+            employee.age()                  = 21;
+
+            bdlsb::MemOutStreamBuf osb;
+            ASSERT(0 == definiteEncoder.encode(&osb, employee));
+
+            test::Employee fromStreamBuf;
+            bdlsb::FixedMemInStreamBuf isb(osb.data(), osb.length());
+            ASSERT(0 == decoder.decode(&isb, &fromStreamBuf));
+            printDiagnostic(decoder);
+            ASSERT(employee == fromStreamBuf);
+
+            test::Employee fromBuffer;
+            ASSERT(0 == decoder.decode(osb.data(), osb.length(), &fromBuffer));
+            printDiagnostic(decoder);
+            ASSERT(employee == fromBuffer);
+        }
+        {
+            test::MySequenceWithArray array;
+            array.attribute1() = 34;
+            for (int i = 0; i < 100; ++i) {
+                array.attribute2().push_back(bsl::string(i, 'x'));
+            }
+
+            bdlsb::MemOutStreamBuf osb;
+            ASSERT(0 == definiteEncoder.encode(&osb, array));
+
+            test::MySequenceWithArray fromBuffer;
+            ASSERT(0 == decoder.decode(osb.data(), osb.length(), &fromBuffer));
+            printDiagnostic(decoder);
+            ASSERT(array == fromBuffer);
+        }
+        {
+            test::MySequenceWithNillable nillable;
+            nillable.attribute1() = 34;
+            nillable.myNillable() = "World!";
+            nillable.attribute2() = "Hello";
+
+            bdlsb::MemOutStreamBuf osb;
+            ASSERT(0 == definiteEncoder.encode(&osb, nillable));
+
+            test::MySequenceWithNillable fromBuffer;
+            ASSERT(0 == decoder.decode(osb.data(), osb.length(), &fromBuffer));
+            printDiagnostic(decoder);
+            ASSERT(nillable == fromBuffer);
+        }
+        {
+            test::MySequenceWithAnonymousChoice anonymousChoice;
+            anonymousChoice.attribute1() = 34;
+            anonymousChoice.choice().makeMyChoice2("World!");
+            anonymousChoice.attribute2() = "Hello";
+
+            bdlsb::MemOutStreamBuf osb;
+            ASSERT(0 == definiteEncoder.encode(&osb, anonymousChoice));
+
+            test::MySequenceWithAnonymousChoice fromBuffer;
+            ASSERT(0 == decoder.decode(osb.data(), osb.length(), &fromBuffer));
+            printDiagnostic(decoder);
+            ASSERT(anonymousChoice == fromBuffer);
+        }
+
+        if (verbose) bsl::cout << "\nTesting skipping unknown elements."
+                               << bsl::endl;
+        {
+            test::MySequence expected;
+            expected.attribute1() = 34;
+            expected.attribute2() = "Hello";
+
+            static const struct {
+                int         d_line;
+                const char *d_data;
+                int         d_numUnknownElements;
+                bool        d_isValid;
+            } DATA[] = {
+                //LN  Data                                  Unknown Valid
+                //--  ------------------------------------  ------- -----
+                { L_, "300A 800122 810548656C6C6F",               0, true  },
+                { L_, "300D 820199 800122 810548656C6C6F",        1, true  },
+                { L_, "300F A203820199 800122 810548656C6C6F",    1, true  },
+                { L_, "3011 800122 A205A203820199 810548656C6C6F",
+                                                                  1, true  },
+                { L_, "3012 800122 A203820199 810548656C6C6F 820100",
+                                                                  2, true  },
+                { L_, "3080 800122 A203820199 810548656C6C6F 0000",
+                                                                  1, true  },
+                { L_, "300F 800122 810548656C6C6F A20582",        0, false },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int i = 0; i < NUM_DATA; ++i) {
+                const int   LINE        = DATA[i].d_line;
+                const int   NUM_UNKNOWN = DATA[i].d_numUnknownElements;
+                const bool  IS_VALID    = DATA[i].d_isValid;
+
+                const bsl::vector<char> data = loadFromHex(DATA[i].d_data);
+
+                test::MySequence value;
+
+                decoder.setNumUnknownElementsSkipped(0);
+                const int rc = decoder.decode(&data[0], data.size(), &value);
+                printDiagnostic(decoder);
+
+                if (IS_VALID) {
+                    ASSERTV(LINE, rc, 0 == rc);
+                    ASSERTV(LINE, expected == value);
+                    ASSERTV(LINE, NUM_UNKNOWN,
+                            decoder.numUnknownElementsSkipped(),
+                            NUM_UNKNOWN ==
+                                         decoder.numUnknownElementsSkipped());
+                }
+                else {
+                    ASSERTV(LINE, 0 != rc);
+                }
+            }
+        }
+      } break;
+      case 22: {
+        // --------------------------------------------------------------------
+        // TESTING DECODING INTO A 'bdlma::ArenaObject'
+        //
+        // Concerns:
+        //: 1 An object held by a 'bdlma::ArenaObject' is decoded correctly
+        //:   after each 'reset'.
+        //:
+        //: 2 Once the arena has grown to fit the message, decoding obtains no
+        //:   memory from the default allocator or from the allocator supplied
+        //:   to the arena.
+        //
+        // Plan:
+        //: 1 Encode an 'Employee' whose strings do not fit in the short string
+        //:   buffer, then repeatedly reset an arena object and decode the
+        //:   encoding into it, from both a 'bsl::streambuf' and a contiguous
+        //:   buffer, checking the decoded value and, after the first few
+        //:   iterations, the allocation counts.  (C-1..2)
+        //
+        // Testing:
+        //   DECODING INTO A 'bdlma::ArenaObject'
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout
+                         << "\nTESTING DECODING INTO A 'bdlma::ArenaObject'"
+                         << "\n============================================"
+                         << bsl::endl;
+
+        bslma::TestAllocator         defaultAllocator("default",
+                                                      veryVeryVerbose);
+        bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+        test::Employee employee(&ta);
+        employee.name()                 = "an employee name too long for "
+                                          "the short string buffer";
+        employee.homeAddress().street() = "a street name too long for the "
+                                          "short string buffer";
+        employee.homeAddress().city()   = "a city name too long for the "
+                                          "short string buffer";
+        employee.age()                  = 42;
+
+        bdlsb::MemOutStreamBuf osb(&ta);
+        ASSERT(0 == encoder.encode(&osb, employee));
+
+        bslma::TestAllocator sa("supplied", veryVeryVerbose);
+        {
+            bdlma::ArenaObject<test::Employee> message(&sa);
+
+            bsls::Types::Int64 numSupplied = 0;
+            bsls::Types::Int64 numDefault  = 0;
+
+            for (int i = 0; i < 20; ++i) {
+                if (4 == i) {
+                    numSupplied = sa.numAllocations();
+                    numDefault  = defaultAllocator.numAllocations();
+                }
+
+                message.reset();
+
+                if (i % 2) {
+                    bdlsb::FixedMemInStreamBuf isb(osb.data(), osb.length());
+                    ASSERTV(i, 0 == decoder.decode(&isb, message.object()));
+                }
+                else {
+                    ASSERTV(i, 0 == decoder.decode(osb.data(),
+                                                   osb.length(),
+                                                   message.object()));
+                }
+                ASSERTV(i, employee == *message.object());
+                ASSERTV(i, message.arena() ==
+                        message.object()->name().get_allocator().mechanism());
+            }
+
+            ASSERTV(numSupplied, sa.numAllocations(),
+                    numSupplied == sa.numAllocations());
+            ASSERTV(numDefault, defaultAllocator.numAllocations(),
+                    numDefault == defaultAllocator.numAllocations());
+        }
+        ASSERT(0 == sa.numBytesInUse());
+      } break;
+      case 21: {
+        // --------------------------------------------------------------------
+        // TESTING DECODING OF 'bslstl::StringRef'
+        //
+        // Concerns:
+        //: 1 Decoding 'bslstl::StringRef' elements from a contiguous buffer
+        //:   loads references to the content octets within that buffer and
+        //:   allocates no memory for the elements.
+        //:
+        //: 2 Empty strings and strings of various lengths are decoded.
+        //:
+        //: 3 Decoding 'bslstl::StringRef' elements from a 'bsl::streambuf'
+        //:   fails.
+        //:
+        //: 4 Decoding fails if the buffer is truncated.
+        //:
+        //: 5 Decoding other types from a contiguous buffer is unaffected.
+        //
+        // Plan:
+        //: 1 Encode sequences holding strings of various lengths and decode
+        //:   them into 'bslstl::StringRef' elements from the encoded buffer.
+        //:   Verify the values, that every element refers to the buffer, and
+        //:   that decoding does not allocate.  (C-1..2)
+        //:
+        //: 2 Decode the same encoding using the 'bsl::streambuf' overload and
+        //:   verify that decoding fails.  (C-3)
+        //:
+        //: 3 Decode every proper prefix of an encoding and verify that
+        //:   decoding fails.  (C-4)
+        //:
+        //: 4 Decode a 'MySequence' from a contiguous buffer.  (C-5)
+        //
+        // Testing:
+        //   int decode(const char *buffer, size_t length, TYPE *variable);
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nTESTING DECODING OF 'bslstl::StringRef'"
+                               << "\n======================================="
+                               << bsl::endl;
+
+        bslma::TestAllocator         defaultAllocator("default",
+                                                      veryVeryVerbose);
+        bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+        const int LENGTHS[] = { 0, 1, 2, 127, 128, 255, 256, 1000, 70000 };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const int LENGTH = LENGTHS[ti];
+
+            bsl::vector<bsl::string> strings(&ta);
+            for (int i = 0; i < 3; ++i) {
+                bsl::string value(&ta);
+                for (int j = 0; j < LENGTH + i; ++j) {
+                    value.push_back(static_cast<char>('a' + (i + j) % 26));
+                }
+                strings.push_back(value);
+            }
+            strings.push_back(bsl::string(&ta));
+
+            u::StringRefRecord record;
+            record.d_name = strings[0];
+            record.d_values.assign(strings.begin(), strings.end());
+
+            bdlsb::MemOutStreamBuf osb(&ta);
+            ASSERTV(LENGTH, 0 == encoder.encode(&osb, record));
+
+            const char        *BEGIN = osb.data();
+            const bsl::size_t  SIZE  = osb.length();
+
+            u::StringRefRecord result;
+            result.d_values.reserve(strings.size());
+
+            {
+                bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+                ASSERTV(LENGTH, 0 == decoder.decode(BEGIN, SIZE, &result));
+                ASSERTV(LENGTH, dam.isTotalSame());
+            }
+
+            ASSERTV(LENGTH, strings[0] == result.d_name);
+            ASSERTV(LENGTH, strings.size() == result.d_values.size());
+
+            for (bsl::size_t i = 0;
+                 i < result.d_values.size() && i < strings.size();
+                 ++i) {
+                const bslstl::StringRef& ref = result.d_values[i];
+
+                ASSERTV(LENGTH, i, strings[i] == ref);
+                if (!ref.isEmpty()) {
+                    ASSERTV(LENGTH, i, BEGIN <= ref.data());
+                    ASSERTV(LENGTH, i,
+                            ref.data() + ref.length() <= BEGIN + SIZE);
+                }
+            }
+
+            bdlsb::FixedMemInStreamBuf isb(BEGIN, SIZE);
+            ASSERTV(LENGTH, 0 != decoder.decode(&isb, &result));
+
+            if (LENGTH <= 256) {
+                for (bsl::size_t n = 0; n < SIZE; ++n) {
+                    ASSERTV(LENGTH, n, 0 != decoder.decode(BEGIN, n, &result));
+                }
+            }
+        }
+
+        if (verbose) bsl::cout << "\nDecoding other types." << bsl::endl;
+        {
+            test::MySequence valueOut;
+            valueOut.attribute1() = 34;
+            valueOut.attribute2() = "Hello";
+
+            bdlsb::MemOutStreamBuf osb;
+            ASSERT(0 == encoder.encode(&osb, valueOut));
+
+            test::MySequence valueIn;
+            ASSERT(0 == decoder.decode(osb.data(), osb.length(), &valueIn));
+            ASSERT(valueOut == valueIn);
+        }
+      } break;
       case 20: {
         // --------------------------------------------------------------------
         // TESTING decoding sequences of maximum size
@@ -26,6 +26,33 @@ balber::BerEncoder::MemOutStream::~MemOutStream()
 {
 }
 
+                  // -----------------------------------------
+                  // class balber::BerEncoder::SizingStreamBuf
+                  // -----------------------------------------
+
+// CREATORS
+balber::BerEncoder::SizingStreamBuf::~SizingStreamBuf()
+{
+}
+
+// PROTECTED MANIPULATORS
+balber::BerEncoder::SizingStreamBuf::int_type
+balber::BerEncoder::SizingStreamBuf::overflow(int_type character)
+{
+    if (!traits_type::eq_int_type(character, traits_type::eof())) {
+        ++d_length;
+    }
+    return traits_type::not_eof(character);
+}
+
+bsl::streamsize
+balber::BerEncoder::SizingStreamBuf::xsputn(const char      *,
+                                            bsl::streamsize  numCharacters)
+{
+    d_length += numCharacters;
+    return numCharacters;
+}
+
 namespace balber {
 
                               // ----------------
@@ -41,6 +68,9 @@ BerEncoder::BerEncoder(const BerEncoderOptions *options,
 , d_severity     (e_BER_SUCCESS)
 , d_streamBuf    (0)
 , d_currentDepth (0)
+, d_lengthMode   (e_INDEFINITE_LENGTH)
+, d_lengths      (d_allocator)
+, d_nextLength   (0)
 {
 }
 
@@ -31,6 +31,30 @@ BSLS_IDENT("$Id: $")
 // This component encodes objects based on the X.690 BER specification.  It can
 // only be used with types supported by the 'bdlat' framework.
 //
+///Definite Length Encoding
+///------------------------
+// By default, constructed elements (sequences, choices, nillable values, and
+// arrays) are encoded using the indefinite length form: a single length octet
+// indicating that the length is unknown, followed by the contents, followed by
+// two end-of-contents octets.  If the 'EncodeDefiniteLength' option of the
+// supplied 'balber::BerEncoderOptions' is set, constructed elements are
+// instead encoded using the definite length form, in which the length octets
+// give the exact length of the contents.  For contents shorter than 128
+// bytes, this saves 2 bytes per constructed element (and a choice that is not
+// anonymous is encoded as two nested constructed elements), and it allows a
+// decoder to skip an unknown element without parsing its contents (see
+// 'balber_berdecoder').
+//
+// To compute the lengths, 'encode' first traverses the value to be encoded,
+// writing to an internal stream buffer that only counts the bytes written, and
+// caches the length of each constructed element; it then traverses the value
+// a second time, writing the cached lengths and the contents to the supplied
+// stream buffer.  Encoding therefore takes roughly twice as long, but, if the
+// value cannot be encoded, nothing is written.  Note that the memory used to
+// cache the lengths is retained by the encoder, so an encoder that is reused
+// for many values allocates no memory once the memory has grown to fit the
+// values having the most constructed elements.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -186,6 +210,10 @@ BSLS_IDENT("$Id: $")
 
 #include <bslma_allocator.h>
 
+#include <bslmf_integralconstant.h>
+#include <bslmf_isarithmetic.h>
+#include <bslmf_metaint.h>
+
 #include <bsl_string.h>
 
 #include <bdlsb_memoutstreambuf.h>
@@ -263,6 +291,62 @@ class BerEncoder {
             // characters appended to the stream, if any.
     };
 
+    class SizingStreamBuf : public bsl::streambuf {
+        // This class provides a stream buffer that discards the characters
+        // written to it, counting them.  It is the target of the sizing pass
+        // that computes the lengths of constructed elements when the definite
+        // length form is used.
+
+        // DATA
+        bsl::streamsize d_length;  // number of characters written
+
+        // NOT IMPLEMENTED
+        SizingStreamBuf(const SizingStreamBuf&);             // = delete;
+        SizingStreamBuf& operator=(const SizingStreamBuf&);  // = delete;
+
+      protected:
+        // PROTECTED MANIPULATORS
+        virtual int_type overflow(int_type character = traits_type::eof());
+            // Count the specified 'character' as written, unless it is
+            // 'traits_type::eof()', and return 'traits_type::not_eof(c)'.
+
+        virtual bsl::streamsize xsputn(const char      *source,
+                                       bsl::streamsize  numCharacters);
+            // Count the specified 'numCharacters' as written, ignoring the
+            // specified 'source', and return 'numCharacters'.
+
+      public:
+        // CREATORS
+        SizingStreamBuf();
+            // Create a stream buffer having a 'length' of 0.
+
+        virtual ~SizingStreamBuf();
+            // Destroy this stream buffer.
+
+        // MANIPULATORS
+        void reset();
+            // Set the 'length' of this stream buffer to 0.
+
+        // ACCESSORS
+        bsl::streamsize length() const;
+            // Return the number of characters written to this stream buffer
+            // since construction or the last call to 'reset'.
+    };
+
+    enum LengthMode {
+        // Enumerates the ways in which the lengths of constructed elements
+        // are handled during a traversal of the value being encoded.
+
+        e_INDEFINITE_LENGTH,  // write indefinite length octets and
+                              // end-of-contents octets
+
+        e_COMPUTE_LENGTHS,    // write to 'd_sizingStreamBuf', caching the
+                              // length of each constructed element in
+                              // 'd_lengths'
+
+        e_DEFINITE_LENGTH     // write the lengths cached in 'd_lengths'
+    };
+
   public:
     // PUBLIC TYPES
     enum ErrorSeverity {
@@ -292,6 +376,23 @@ class BerEncoder {
     bsl::streambuf                   *d_streamBuf;      // held, not owned
     int                               d_currentDepth;   // current depth
 
+    LengthMode                        d_lengthMode;     // how lengths of
+                                                        // constructed
+                                                        // elements are
+                                                        // written
+
+    SizingStreamBuf                   d_sizingStreamBuf;
+        // target of the sizing pass
+
+    bsl::vector<int>                  d_lengths;
+        // contents lengths of the constructed elements of the value being
+        // encoded, in the order in which the elements are written
+
+    bsl::size_t                       d_nextLength;     // index in
+                                                        // 'd_lengths' of the
+                                                        // next length to
+                                                        // write
+
     // NOT IMPLEMENTED
     BerEncoder(const BerEncoder&);             // = delete;
     BerEncoder& operator=(const BerEncoder&);  // = delete;
@@ -315,6 +416,35 @@ class BerEncoder {
         // Return the stream for logging.  Note the if stream has not been
         // created yet, it will be created during this call.
 
+    int putConstructedLength(bsl::size_t *lengthIndex);
+        // Write the length octets of a constructed element whose identifier
+        // octets have just been written, and load into the specified
+        // 'lengthIndex' the value to supply to the matching call to
+        // 'putConstructedEnd'.  Return 0 on success, and a non-zero value
+        // otherwise.  In the 'e_INDEFINITE_LENGTH' mode the indefinite length
+        // octet is written; in the 'e_DEFINITE_LENGTH' mode the next length
+        // cached by the sizing pass is written; and in the
+        // 'e_COMPUTE_LENGTHS' mode a length is reserved in 'd_lengths', to be
+        // computed by 'putConstructedEnd'.
+
+    int putConstructedEnd(bsl::size_t lengthIndex);
+        // Complete the encoding of the constructed element whose length was
+        // written by the call to 'putConstructedLength' that loaded the
+        // specified 'lengthIndex'.  Return 0 on success, and a non-zero value
+        // otherwise.  In the 'e_INDEFINITE_LENGTH' mode the end-of-contents
+        // octets are written; in the 'e_DEFINITE_LENGTH' mode nothing is
+        // written; and in the 'e_COMPUTE_LENGTHS' mode the length of the
+        // contents of the element is cached and its length octets are
+        // counted.
+
+    template <typename TYPE>
+    int encodeValue(const TYPE& value);
+        // Encode the specified 'value' to 'd_streamBuf' using 'd_options',
+        // first computing the lengths of all constructed elements of 'value'
+        // if the definite length form is requested.  Return 0 on success, and
+        // a non-zero value otherwise.  Note that nothing is written to
+        // 'd_streamBuf' if the sizing pass fails.
+
     int encodeImpl(const bsl::vector<char>&  value,
                    BerConstants::TagClass    tagClass,
                    int                       tagNumber,
@@ -327,6 +457,48 @@ class BerEncoder {
                         int                    tagNumber,
                         int                    formattingMode);
 
+    template <typename TYPE>
+    int encodeArrayElements(const TYPE&            value,
+                            BerConstants::TagClass tagClass,
+                            int                    tagNumber,
+                            int                    formattingMode,
+                            bslmf::MetaInt<0>);
+    template <typename TYPE>
+    int encodeArrayElements(const TYPE&            value,
+                            BerConstants::TagClass tagClass,
+                            int                    tagNumber,
+                            int                    formattingMode,
+                            bslmf::MetaInt<1>);
+        // Encode the elements of the specified 'value' array, which is the
+        // contents of the element having the specified 'tagClass' and
+        // 'tagNumber', using the specified 'formattingMode'.  Return 0 on
+        // success, and a non-zero value otherwise.  The overload taking
+        // 'bslmf::MetaInt<1>' is selected for arrays whose elements are
+        // stored contiguously (see 'bdlat_ArrayFunctions') and encodes
+        // elements of arithmetic type without visiting them.
+
+    template <typename TYPE>
+    int encodeContiguousArrayElements(const TYPE&            value,
+                                      BerConstants::TagClass tagClass,
+                                      int                    tagNumber,
+                                      int                    formattingMode,
+                                      bsl::false_type);
+    template <typename TYPE>
+    int encodeContiguousArrayElements(const TYPE&            value,
+                                      BerConstants::TagClass tagClass,
+                                      int                    tagNumber,
+                                      int                    formattingMode,
+                                      bsl::true_type);
+        // Encode the elements of the specified 'value' array, having
+        // contiguous storage, which is the contents of the element having the
+        // specified 'tagClass' and 'tagNumber', using the specified
+        // 'formattingMode'.  Return 0 on success, and a non-zero value
+        // otherwise.  The overload taking 'bsl::true_type' is selected for
+        // arrays of arithmetic types, and writes each element as a primitive
+        // having the universal tag number of the element type, which is
+        // computed once, without visiting it; the encoding is the same as that
+        // produced by visiting the elements.
+
     template <typename TYPE>
     int encodeImpl(const TYPE&                value,
                    BerConstants::TagClass     tagClass,
@@ -576,6 +748,31 @@ int balber::BerEncoder::MemOutStream::length() const
     return static_cast<int>(d_sb.length());
 }
 
+                  // -----------------------------------------
+                  // class balber::BerEncoder::SizingStreamBuf
+                  // -----------------------------------------
+
+// CREATORS
+inline
+balber::BerEncoder::SizingStreamBuf::SizingStreamBuf()
+: d_length(0)
+{
+}
+
+// MANIPULATORS
+inline
+void balber::BerEncoder::SizingStreamBuf::reset()
+{
+    d_length = 0;
+}
+
+// ACCESSORS
+inline
+bsl::streamsize balber::BerEncoder::SizingStreamBuf::length() const
+{
+    return d_length;
+}
+
 namespace balber {
 
                         // ----------------------------
@@ -665,6 +862,107 @@ bsl::ostream& BerEncoder::logStream()
     return *d_logStream;
 }
 
+inline
+int BerEncoder::putConstructedLength(bsl::size_t *lengthIndex)
+{
+    switch (d_lengthMode) {
+      case e_COMPUTE_LENGTHS: {
+        *lengthIndex = d_lengths.size();
+        d_lengths.push_back(static_cast<int>(d_sizingStreamBuf.length()));
+        return 0;                                                     // RETURN
+      }
+      case e_DEFINITE_LENGTH: {
+        BSLS_ASSERT(d_nextLength < d_lengths.size());
+
+        return BerUtil::putLength(d_streamBuf,
+                                  d_lengths[d_nextLength++]);         // RETURN
+      }
+      default: {
+        return BerUtil::putIndefiniteLengthOctet(d_streamBuf);        // RETURN
+      }
+    }
+}
+
+inline
+int BerEncoder::putConstructedEnd(bsl::size_t lengthIndex)
+{
+    switch (d_lengthMode) {
+      case e_COMPUTE_LENGTHS: {
+        // 'd_lengths[lengthIndex]' holds the position at which the contents
+        // of the element started.  Replace it with the length of the
+        // contents, and count the length octets that the writing pass will
+        // put in front of them.
+
+        int& length = d_lengths[lengthIndex];
+
+        length = static_cast<int>(d_sizingStreamBuf.length()) - length;
+        return BerUtil::putLength(&d_sizingStreamBuf, length);        // RETURN
+      }
+      case e_DEFINITE_LENGTH: {
+        return 0;                                                     // RETURN
+      }
+      default: {
+        return BerUtil::putEndOfContentOctets(d_streamBuf);           // RETURN
+      }
+    }
+}
+
+template <typename TYPE>
+int BerEncoder::encodeValue(const TYPE& value)
+{
+    if (!d_options->encodeDefiniteLength()) {
+        d_lengthMode = e_INDEFINITE_LENGTH;
+
+        BerEncoder_UniversalElementVisitor visitor(
+                                              this,
+                                              bdlat_FormattingMode::e_DEFAULT);
+        return visitor(value);                                        // RETURN
+    }
+
+    // Sizing pass: traverse 'value', writing to a stream buffer that only
+    // counts characters, to compute the length of every constructed element.
+
+    bsl::streambuf *streamBuf = d_streamBuf;
+
+    d_lengthMode = e_COMPUTE_LENGTHS;
+    d_streamBuf  = &d_sizingStreamBuf;
+    d_sizingStreamBuf.reset();
+    d_lengths.clear();
+
+    int rc;
+    {
+        BerEncoder_UniversalElementVisitor visitor(
+                                              this,
+                                              bdlat_FormattingMode::e_DEFAULT);
+        rc = visitor(value);
+    }
+
+    d_streamBuf = streamBuf;
+
+    if (rc) {
+        d_lengthMode = e_INDEFINITE_LENGTH;
+        return rc;                                                    // RETURN
+    }
+
+    // Writing pass: traverse 'value' again, writing the cached lengths.  The
+    // constructed elements are visited in the same order in both passes.
+
+    d_lengthMode = e_DEFINITE_LENGTH;
+    d_nextLength = 0;
+
+    {
+        BerEncoder_UniversalElementVisitor visitor(
+                                              this,
+                                              bdlat_FormattingMode::e_DEFAULT);
+        rc = visitor(value);
+    }
+
+    BSLS_ASSERT(rc || d_nextLength == d_lengths.size());
+
+    d_lengthMode = e_INDEFINITE_LENGTH;
+    return rc;
+}
+
 template <typename TYPE>
 int BerEncoder::encode(bsl::streambuf *streamBuf, const TYPE& value)
 {
@@ -684,18 +982,12 @@ int BerEncoder::encode(bsl::streambuf *streamBuf, const TYPE& value)
     if (! d_options) {
         BerEncoderOptions options;  // temporary options object
         d_options = &options;
-        BerEncoder_UniversalElementVisitor visitor(
-                                              this,
-                                              bdlat_FormattingMode::e_DEFAULT);
 
-        rc = visitor(value);
+        rc = encodeValue(value);
         d_options = 0;
     }
     else {
-        BerEncoder_UniversalElementVisitor visitor(
-                                              this,
-                                              bdlat_FormattingMode::e_DEFAULT);
-        rc = visitor(value);
+        rc = encodeValue(value);
     }
 
     d_streamBuf = 0;
@@ -731,11 +1023,14 @@ int BerEncoder::encodeImpl(const TYPE&                value,
 
     const BerConstants::TagType tagType = BerConstants::e_CONSTRUCTED;
 
+    bsl::size_t outerLengthIndex = 0;
+    bsl::size_t innerLengthIndex = 0;
+
     int rc = BerUtil::putIdentifierOctets(d_streamBuf,
                                           tagClass,
                                           tagType,
                                           tagNumber);
-    if (rc | BerUtil::putIndefiniteLengthOctet(d_streamBuf)) {
+    if (rc | putConstructedLength(&outerLengthIndex)) {
         return k_FAILURE;                                             // RETURN
     }
 
@@ -750,7 +1045,7 @@ int BerEncoder::encodeImpl(const TYPE&                value,
                                           BerConstants::e_CONTEXT_SPECIFIC,
                                           tagType,
                                           0);
-        if (rc | BerUtil::putIndefiniteLengthOctet(d_streamBuf)) {
+        if (rc | putConstructedLength(&innerLengthIndex)) {
             return k_FAILURE;
         }
     }
@@ -784,10 +1079,10 @@ int BerEncoder::encodeImpl(const TYPE&                value,
         // Don't waste time checking the result of this call -- the only thing
         // that can go wrong is eof, which will happen again when we call it
         // again below.
-        BerUtil::putEndOfContentOctets(d_streamBuf);
+        putConstructedEnd(innerLengthIndex);
     }
 
-    return BerUtil::putEndOfContentOctets(d_streamBuf);
+    return putConstructedEnd(outerLengthIndex);
 }
 
 template <typename TYPE>
@@ -805,11 +1100,13 @@ int BerEncoder::encodeImpl(const TYPE&                       value,
 
         // nillable is encoded in BER as a sequence with one optional element
 
+        bsl::size_t lengthIndex = 0;
+
         int rc = BerUtil::putIdentifierOctets(d_streamBuf,
                                               tagClass,
                                               BerConstants::e_CONSTRUCTED,
                                               tagNumber);
-        if (rc | BerUtil::putIndefiniteLengthOctet(d_streamBuf)) {
+        if (rc | putConstructedLength(&lengthIndex)) {
             return k_FAILURE;
         }
 
@@ -827,7 +1124,7 @@ int BerEncoder::encodeImpl(const TYPE&                       value,
             }
         } // end of bdlat_NullableValueFunctions::isNull(...)
 
-        return BerUtil::putEndOfContentOctets(d_streamBuf);
+        return putConstructedEnd(lengthIndex);
     } // end of isNillable
 
     if (!bdlat_NullableValueFunctions::isNull(value)) {
@@ -897,17 +1194,19 @@ int BerEncoder::encodeImpl(const TYPE&                  value,
 {
     BerEncoder_Visitor visitor(this);
 
+    bsl::size_t lengthIndex = 0;
+
     int rc = BerUtil::putIdentifierOctets(d_streamBuf,
                                           tagClass,
                                           BerConstants::e_CONSTRUCTED,
                                           tagNumber);
-    rc |= BerUtil::putIndefiniteLengthOctet(d_streamBuf);
+    rc |= putConstructedLength(&lengthIndex);
     if (rc) {
         return rc;
     }
 
     rc = bdlat_SequenceFunctions::accessAttributes(value, visitor);
-    rc |= BerUtil::putEndOfContentOctets(d_streamBuf);
+    rc |= putConstructedEnd(lengthIndex);
 
     return rc;
 }
@@ -965,15 +1264,42 @@ BerEncoder::encodeArrayImpl(const TYPE&             value,
 
     const BerConstants::TagType tagType = BerConstants::e_CONSTRUCTED;
 
+    bsl::size_t lengthIndex = 0;
+
     int rc = BerUtil::putIdentifierOctets(d_streamBuf,
                                           tagClass,
                                           tagType,
                                           tagNumber);
-    rc |= BerUtil::putIndefiniteLengthOctet(d_streamBuf);
+    rc |= putConstructedLength(&lengthIndex);
     if (rc) {
         return k_FAILURE;                                             // RETURN
     }
 
+    typedef typename bdlat_ArrayFunctions::HasContiguousStorage<TYPE>::Type
+                                                          HasContiguousStorage;
+
+    if (0 != encodeArrayElements(value,
+                                 tagClass,
+                                 tagNumber,
+                                 formattingMode,
+                                 HasContiguousStorage())) {
+        return k_FAILURE;                                             // RETURN
+    }
+
+    return putConstructedEnd(lengthIndex);
+}
+
+template <typename TYPE>
+int BerEncoder::encodeArrayElements(const TYPE&            value,
+                                    BerConstants::TagClass tagClass,
+                                    int                    tagNumber,
+                                    int                    formattingMode,
+                                    bslmf::MetaInt<0>)
+{
+    enum { k_FAILURE = -1, k_SUCCESS = 0 };
+
+    const int size = static_cast<int>(bdlat_ArrayFunctions::size(value));
+
     BerEncoder_UniversalElementVisitor visitor(this, formattingMode);
 
     for (int i = 0; i < size; ++i) {
@@ -988,7 +1314,93 @@ BerEncoder::encodeArrayImpl(const TYPE&             value,
         }
     }
 
-    return BerUtil::putEndOfContentOctets(d_streamBuf);
+    return k_SUCCESS;
+}
+
+template <typename TYPE>
+inline
+int BerEncoder::encodeArrayElements(const TYPE&            value,
+                                    BerConstants::TagClass tagClass,
+                                    int                    tagNumber,
+                                    int                    formattingMode,
+                                    bslmf::MetaInt<1>)
+{
+    typedef typename bdlat_ArrayFunctions::ElementType<TYPE>::Type
+                                                                   ElementType;
+
+    return encodeContiguousArrayElements(value,
+                                         tagClass,
+                                         tagNumber,
+                                         formattingMode,
+                                         bsl::is_arithmetic<ElementType>());
+}
+
+template <typename TYPE>
+inline
+int BerEncoder::encodeContiguousArrayElements(
+                                         const TYPE&            value,
+                                         BerConstants::TagClass tagClass,
+                                         int                    tagNumber,
+                                         int                    formattingMode,
+                                         bsl::false_type)
+{
+    return encodeArrayElements(value,
+                               tagClass,
+                               tagNumber,
+                               formattingMode,
+                               bslmf::MetaInt<0>());
+}
+
+template <typename TYPE>
+int BerEncoder::encodeContiguousArrayElements(
+                                         const TYPE&            value,
+                                         BerConstants::TagClass tagClass,
+                                         int                    tagNumber,
+                                         int                    formattingMode,
+                                         bsl::true_type)
+{
+    enum { k_FAILURE = -1, k_SUCCESS = 0 };
+
+    typedef typename bdlat_ArrayFunctions::ElementType<TYPE>::Type
+                                                                   ElementType;
+
+    const int size = static_cast<int>(bdlat_ArrayFunctions::size(value));
+
+    if (0 == size) {
+        return k_SUCCESS;                                             // RETURN
+    }
+
+    const ElementType *elements = bdlat_ArrayFunctions::data(value);
+
+    // The universal tag number of an arithmetic type depends only on the type
+    // and the formatting mode, so the identifier octets are the same for all
+    // elements.
+
+    const BerUniversalTagNumber::Value elementTagNumber =
+                          BerUniversalTagNumber::select(elements[0],
+                                                        formattingMode,
+                                                        d_options);
+
+    for (int i = 0; i < size; ++i) {
+        int rc = BerUtil::putIdentifierOctets(
+                                           d_streamBuf,
+                                           BerConstants::e_UNIVERSAL,
+                                           BerConstants::e_PRIMITIVE,
+                                           static_cast<int>(elementTagNumber));
+        rc |= BerUtil::putValue(d_streamBuf, elements[i], d_options);
+
+        if (rc) {
+            this->logError(BerConstants::e_UNIVERSAL, elementTagNumber);
+            this->logError(tagClass,
+                           tagNumber,
+                           0,  // bdlat_TypeName::name(value),
+                           i);
+
+            return k_FAILURE;                                         // RETURN
+        }
+    }
+
+    return k_SUCCESS;
 }
 
 template <typename TYPE>
@@ -25,6 +25,8 @@
 #include <s_baltst_mysequencewitharray.h>
 #include <s_baltst_mysequencewithnillable.h>
 #include <s_baltst_mysequencewithnullable.h>
+#include <s_baltst_ratsnest.h>
+#include <s_baltst_rawdataunformatted.h>
 #include <s_baltst_sqrt.h>
 #include <s_baltst_timingrequest.h>
 
@@ -60,6 +62,7 @@
 #include <bsl_cctype.h>
 #include <bsl_climits.h>
 #include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
 #include <bsl_fstream.h>
 #include <bsl_iomanip.h>
 #include <bsl_iosfwd.h>
@@ -232,6 +235,115 @@ void printDiagnostic(balber::BerEncoder & encoder)
     }
 }
 
+int reencodeIndefinite(bsl::streambuf *output,
+                       bsl::streambuf *input,
+                       int             length)
+    // Read from the specified 'input' BER elements having the definite length
+    // form and occupying the specified 'length' bytes, and write them to the
+    // specified 'output', re-encoding every constructed element using the
+    // indefinite length form.  Return 0 on success, and a non-zero value
+    // otherwise.
+{
+    int numConsumed = 0;
+
+    while (numConsumed < length) {
+        balber::BerConstants::TagClass tagClass;
+        balber::BerConstants::TagType  tagType;
+        int                            tagNumber;
+        int                            elementLength;
+
+        if (0 != balber::BerUtil::getIdentifierOctets(input,
+                                                      &tagClass,
+                                                      &tagType,
+                                                      &tagNumber,
+                                                      &numConsumed)
+         || 0 != balber::BerUtil::getLength(input,
+                                            &elementLength,
+                                            &numConsumed)
+         || balber::BerUtil::k_INDEFINITE_LENGTH == elementLength) {
+            return -1;                                                // RETURN
+        }
+
+        balber::BerUtil::putIdentifierOctets(output,
+                                             tagClass,
+                                             tagType,
+                                             tagNumber);
+
+        if (balber::BerConstants::e_CONSTRUCTED == tagType) {
+            balber::BerUtil::putIndefiniteLengthOctet(output);
+            if (0 != reencodeIndefinite(output, input, elementLength)) {
+                return -1;                                            // RETURN
+            }
+            balber::BerUtil::putEndOfContentOctets(output);
+        }
+        else {
+            balber::BerUtil::putLength(output, elementLength);
+
+            bsl::vector<char> contents(elementLength + 1);
+            if (elementLength != input->sgetn(&contents[0], elementLength)) {
+                return -1;                                            // RETURN
+            }
+            output->sputn(&contents[0], elementLength);
+        }
+
+        numConsumed += elementLength;
+    }
+
+    return numConsumed == length ? 0 : -1;
+}
+
+template <class TYPE>
+void testDefiniteLength(int line, const TYPE& value)
+    // Encode the specified 'value' using both the indefinite and the definite
+    // length forms, and verify that the definite length encoding is no longer
+    // and, when its constructed elements are re-encoded using the indefinite
+    // length form, identical to the indefinite length encoding.  Use the
+    // specified 'line' to identify failures.
+{
+    balber::BerEncoderOptions options;
+
+    balber::BerEncoder     indefiniteEncoder(&options);
+    bdlsb::MemOutStreamBuf indefinite;
+    ASSERTV(line, 0 == indefiniteEncoder.encode(&indefinite, value));
+
+    options.setEncodeDefiniteLength(true);
+
+    balber::BerEncoder     definiteEncoder(&options);
+    bdlsb::MemOutStreamBuf definite;
+    ASSERTV(line, 0 == definiteEncoder.encode(&definite, value));
+    printDiagnostic(definiteEncoder);
+
+    if (veryVerbose) {
+        P_(line) P(definite.length())
+        printBuffer(definite.data(), static_cast<int>(definite.length()));
+    }
+
+    ASSERTV(line, definite.length(), indefinite.length(),
+            definite.length() <= indefinite.length());
+
+    bdlsb::FixedMemInStreamBuf isb(definite.data(), definite.length());
+    bdlsb::MemOutStreamBuf     reencoded;
+    ASSERTV(line, 0 == reencodeIndefinite(
+                                     &reencoded,
+                                     &isb,
+                                     static_cast<int>(definite.length())));
+
+    ASSERTV(line, reencoded.length(), indefinite.length(),
+            reencoded.length() == indefinite.length());
+    ASSERTV(line, 0 == bsl::memcmp(reencoded.data(),
+                                   indefinite.data(),
+                                   indefinite.length()));
+
+    // Encoding again with the same encoder produces the same octets.
+
+    bdlsb::MemOutStreamBuf again;
+    ASSERTV(line, 0 == definiteEncoder.encode(&again, value));
+    ASSERTV(line, again.length() == definite.length());
+    ASSERTV(line, 0 == bsl::memcmp(again.data(),
+                                   definite.data(),
+                                   definite.length()));
+}
+
 // ============================================================================
 //                     GLOBAL HELPER CLASSES FOR TESTING
 // ----------------------------------------------------------------------------
@@ -813,7 +925,7 @@ int main(int argc, char *argv[])
     bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 14: {
+      case 16: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -837,6 +949,203 @@ int main(int argc, char *argv[])
         usageExample();
 
       } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // TESTING ARRAYS OF FUNDAMENTAL TYPES
+        //
+        // Concerns:
+        //: 1 The elements of a contiguous array of a fundamental type are
+        //:   encoded, in order, as primitive elements having the universal tag
+        //:   number selected for the element type and formatting mode.
+        //:
+        //: 2 The definite length form of an array of a fundamental type has
+        //:   the correct length.
+        //
+        // Plan:
+        //: 1 Encode a sequence having an array of 'unsigned char' with the
+        //:   'e_DEC' formatting mode and compare the encoding with the
+        //:   expected octets.  (C-1)
+        //:
+        //: 2 Using 'testDefiniteLength', verify the encoding of a sequence
+        //:   having large arrays of 'bool', 'double', and 'int'.  (C-2)
+        //
+        // Testing:
+        //   ARRAYS OF FUNDAMENTAL TYPES
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nTESTING ARRAYS OF FUNDAMENTAL TYPES"
+                               << "\n==================================="
+                               << bsl::endl;
+
+        if (verbose) bsl::cout << "\nTesting the expected octets." << endl;
+        {
+            test::RawDataUnformatted value;
+            value.ucharvec().push_back(0);
+            value.ucharvec().push_back(1);
+            value.ucharvec().push_back(127);
+            value.ucharvec().push_back(128);
+            value.ucharvec().push_back(255);
+
+            balber::BerEncoder     encoder;
+            bdlsb::MemOutStreamBuf osb;
+
+            ASSERT(0 == encoder.encode(&osb, value));
+            printDiagnostic(encoder);
+
+            if (veryVerbose) {
+                printBuffer(osb.data(), static_cast<int>(osb.length()));
+            }
+            ASSERT(29 == osb.length());
+            ASSERT(0  == compareBuffers(osb.data(),
+                                        "3080 A0800000 A180"
+                                        "020100 020101 02017F 02020080"
+                                        "020200FF 0000 0000"));
+        }
+
+        if (verbose) bsl::cout << "\nTesting definite lengths." << endl;
+        {
+            test::Sequence4 value;
+            for (int i = 0; i < 100; ++i) {
+                value.element14().push_back(0 == i % 3);
+                value.element15().push_back(i * 0.5 - 20.25);
+                value.element17().push_back(i * 1000003 - 7);
+            }
+
+            testDefiniteLength(L_, value);
+        }
+      } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // TESTING DEFINITE LENGTH ENCODING
+        //
+        // Concerns:
+        //: 1 When the 'EncodeDefiniteLength' option is set, constructed
+        //:   elements (sequences, choices, nillable values, and arrays) are
+        //:   encoded using the definite length form, with lengths that match
+        //:   their contents, including lengths requiring the long form.
+        //:
+        //: 2 Apart from the lengths, the encoding is the same as that
+        //:   produced using the indefinite length form.
+        //:
+        //: 3 Nothing is written if the value cannot be encoded.
+        //:
+        //: 4 An encoder can be reused, in either mode.
+        //
+        // Plan:
+        //: 1 Encode a small sequence and compare the encoding with the
+        //:   expected octets.  (C-1)
+        //:
+        //: 2 For values of several types, nested to various depths, encode the
+        //:   value in both modes, re-encode the constructed elements of the
+        //:   definite length encoding using the indefinite length form, and
+        //:   verify that the result equals the indefinite length encoding.
+        //:   (C-1..2, 4)
+        //:
+        //: 3 Encode a sequence containing an unselected choice, with
+        //:   'DisableUnselectedChoiceEncoding' set, and verify that encoding
+        //:   fails without writing anything.  (C-3)
+        //
+        // Testing:
+        //   DEFINITE LENGTH ENCODING
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nTESTING DEFINITE LENGTH ENCODING"
+                               << "\n================================"
+                               << bsl::endl;
+
+        balber::BerEncoderOptions options;
+        options.setEncodeDefiniteLength(true);
+
+        if (verbose) bsl::cout << "\nTesting the expected octets." << endl;
+        {
+            test::MySequence value;
+            value.attribute1() = 34;
+            value.attribute2() = "Hello";
+
+            balber::BerEncoder     definiteEncoder(&options);
+            bdlsb::MemOutStreamBuf osb;
+
+            ASSERT(0 == definiteEncoder.encode(&osb, value));
+            printDiagnostic(definiteEncoder);
+
+            ASSERT(12 == osb.length());
+            ASSERT(0  == compareBuffers(osb.data(),
+                                        "300A 800122 810548656C6C6F"));
+        }
+
+        if (verbose) bsl::cout << "\nTesting various values." << endl;
+        {
+            const bsl::string LONG(200, 'x');
+
+            test::MySequence sequence;
+            sequence.attribute1() = 34;
+            sequence.attribute2() = "Hello";
+
+            test::Employee employee;
+            employee.name()                 = "Bob";
+            employee.homeAddress().street() = "Some Street";
+            employee.homeAddress().city()   = "Some City";
+            employee.homeAddress().state()  = "Some State";
+            employee.age()                  = 21;
+
+            test::MySequenceWithArray emptyArray;
+            emptyArray.attribute1() = 34;
+
+            test::MySequenceWithArray array;
+            array.attribute1() = 34;
+            array.attribute2().push_back("Hello");
+            array.attribute2().push_back(LONG);
+            for (int i = 0; i < 100; ++i) {
+                array.attribute2().push_back("World");
+            }
+
+            test::MySequenceWithNillable nullNillable;
+            nullNillable.attribute1() = 34;
+            nullNillable.attribute2() = "Hello";
+
+            test::MySequenceWithNillable nillable;
+            nillable.attribute1() = 34;
+            nillable.myNillable() = LONG;
+            nillable.attribute2() = "Hello";
+
+            test::MyChoice choice;
+            choice.makeSelection2(LONG);
+
+            test::MySequenceWithAnonymousChoice anonymousChoice;
+            anonymousChoice.attribute1() = 34;
+            anonymousChoice.choice().makeMyChoice2("World!");
+            anonymousChoice.attribute2() = "Hello";
+
+            testDefiniteLength(L_, sequence);
+            testDefiniteLength(L_, employee);
+            testDefiniteLength(L_, emptyArray);
+            testDefiniteLength(L_, array);
+            testDefiniteLength(L_, nullNillable);
+            testDefiniteLength(L_, nillable);
+            testDefiniteLength(L_, choice);
+            testDefiniteLength(L_, anonymousChoice);
+        }
+
+        if (verbose) bsl::cout << "\nTesting failure." << endl;
+        {
+            options.setDisableUnselectedChoiceEncoding(true);
+
+            test::MySequenceWithAnonymousChoice value;
+            value.attribute1() = 34;
+            value.attribute2() = "Hello";
+
+            balber::BerEncoder     definiteEncoder(&options);
+            bdlsb::MemOutStreamBuf osb;
+
+            ASSERT(0 != definiteEncoder.encode(&osb, value));
+            ASSERT(0 == osb.length());
+
+            value.choice().makeMyChoice1(7);
+
+            ASSERT(0 == definiteEncoder.encode(&osb, value));
+            ASSERT(0 <  osb.length());
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // TESTING 'encode' for date/time components
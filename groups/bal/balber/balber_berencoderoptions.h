@@ -86,6 +86,12 @@ class BerEncoderOptions {
         // try and encoded any element with an unselected choice.  By default
         // the encoder allows unselected choice by eliding from the encoding.
 
+    bool d_encodeDefiniteLength;
+        // This option allows users to control if constructed elements
+        // (sequences, choices, and arrays) are encoded using the definite
+        // length form.  By default constructed elements are encoded using the
+        // indefinite length form, terminated by end-of-contents octets.
+
   public:
     // TYPES
     enum {
@@ -95,6 +101,7 @@ class BerEncoderOptions {
       , e_ATTRIBUTE_ID_ENCODE_DATE_AND_TIME_TYPES_AS_BINARY = 3
       , e_ATTRIBUTE_ID_DATETIME_FRACTIONAL_SECOND_PRECISION = 4
       , e_ATTRIBUTE_ID_DISABLE_UNSELECTED_CHOICE_ENCODING   = 5
+      , e_ATTRIBUTE_ID_ENCODE_DEFINITE_LENGTH               = 6
 #ifndef BDE_OMIT_INTERNAL_DEPRECATED
       , ATTRIBUTE_ID_TRACE_LEVEL                          =
                             e_ATTRIBUTE_ID_TRACE_LEVEL
@@ -111,7 +118,7 @@ class BerEncoderOptions {
     };
 
     enum {
-        k_NUM_ATTRIBUTES = 6
+        k_NUM_ATTRIBUTES = 7
 #ifndef BDE_OMIT_INTERNAL_DEPRECATED
       , NUM_ATTRIBUTES = k_NUM_ATTRIBUTES
 #endif  // BDE_OMIT_INTERNAL_DEPRECATED
@@ -124,6 +131,7 @@ class BerEncoderOptions {
       , e_ATTRIBUTE_INDEX_ENCODE_DATE_AND_TIME_TYPES_AS_BINARY = 3
       , e_ATTRIBUTE_INDEX_DATETIME_FRACTIONAL_SECOND_PRECISION = 4
       , e_ATTRIBUTE_INDEX_DISABLE_UNSELECTED_CHOICE_ENCODING   = 5
+      , e_ATTRIBUTE_INDEX_ENCODE_DEFINITE_LENGTH               = 6
 #ifndef BDE_OMIT_INTERNAL_DEPRECATED
       , ATTRIBUTE_INDEX_TRACE_LEVEL                          =
                          e_ATTRIBUTE_INDEX_TRACE_LEVEL
@@ -146,6 +154,7 @@ class BerEncoderOptions {
     static const bool DEFAULT_INITIALIZER_ENCODE_DATE_AND_TIME_TYPES_AS_BINARY;
     static const int  DEFAULT_INITIALIZER_DATETIME_FRACTIONAL_SECOND_PRECISION;
     static const bool DEFAULT_INITIALIZER_DISABLE_UNSELECTED_CHOICE_ENCODING;
+    static const bool DEFAULT_INITIALIZER_ENCODE_DEFINITE_LENGTH;
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -271,6 +280,16 @@ class BerEncoderOptions {
         // Set the 'DisableUnselectedChoiceEncoding' attribute of this object
         // to the specified 'value'.
 
+    void setEncodeDefiniteLength(bool value);
+        // Set the 'EncodeDefiniteLength' attribute of this object to the
+        // specified 'value'.  If this option is set to 'true' then sequences,
+        // choices, and arrays are encoded with the exact length of their
+        // contents, computed in a sizing pass over the value before any octet
+        // is written, instead of with the indefinite length form.  Note that
+        // the definite length encoding is smaller, and can be skipped by a
+        // decoder without parsing its contents, but requires two traversals
+        // of the value being encoded.
+
     // ACCESSORS
     bsl::ostream& print(bsl::ostream& stream,
                         int           level = 0,
@@ -349,6 +368,10 @@ class BerEncoderOptions {
     bool disableUnselectedChoiceEncoding() const;
         // Return  the value of the non-modifiable
         // 'DatetimeFractionalSecondPrecision' attribute of this object.
+
+    bool encodeDefiniteLength() const;
+        // Return the value of the non-modifiable 'EncodeDefiniteLength'
+        // attribute of this object.
 };
 
 // FREE OPERATORS
@@ -428,6 +451,9 @@ STREAM& BerEncoderOptions::bdexStreamIn(STREAM& stream, int version)
                                              stream,
                                              d_disableUnselectedChoiceEncoding,
                                              1);
+            bslx::InStreamFunctions::bdexStreamIn(stream,
+                                                  d_encodeDefiniteLength,
+                                                  1);
           } break;
           default: {
             stream.invalidate();
@@ -483,6 +509,13 @@ int BerEncoderOptions::manipulateAttributes(MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(
+              &d_encodeDefiniteLength,
+              ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_ENCODE_DEFINITE_LENGTH]);
+    if (ret) {
+        return ret;
+    }
+
     return ret;
 }
 
@@ -525,6 +558,11 @@ int BerEncoderOptions::manipulateAttribute(MANIPULATOR& manipulator, int id)
                         ATTRIBUTE_INFO_ARRAY[
                         e_ATTRIBUTE_INDEX_DISABLE_UNSELECTED_CHOICE_ENCODING]);
       } break;
+      case e_ATTRIBUTE_ID_ENCODE_DEFINITE_LENGTH: {
+        return manipulator(
+              &d_encodeDefiniteLength,
+              ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_ENCODE_DEFINITE_LENGTH]);
+      } break;
       default:
         return k_NOT_FOUND;
     }
@@ -583,6 +621,12 @@ void BerEncoderOptions::setDisableUnselectedChoiceEncoding(bool value)
     d_disableUnselectedChoiceEncoding = value;
 }
 
+inline
+void BerEncoderOptions::setEncodeDefiniteLength(bool value)
+{
+    d_encodeDefiniteLength = value;
+}
+
 // ACCESSORS
 template <class STREAM>
 STREAM& BerEncoderOptions::bdexStreamOut(STREAM& stream, int version) const
@@ -610,6 +654,9 @@ STREAM& BerEncoderOptions::bdexStreamOut(STREAM& stream, int version) const
                                              stream,
                                              d_disableUnselectedChoiceEncoding,
                                              1);
+        bslx::OutStreamFunctions::bdexStreamOut(stream,
+                                                d_encodeDefiniteLength,
+                                                1);
       } break;
       default: {
         stream.invalidate();
@@ -666,6 +713,13 @@ int BerEncoderOptions::accessAttributes(ACCESSOR& accessor) const
         return ret;                                                   // RETURN
     }
 
+    ret = accessor(d_encodeDefiniteLength,
+                   ATTRIBUTE_INFO_ARRAY[
+                                   e_ATTRIBUTE_INDEX_ENCODE_DEFINITE_LENGTH]);
+    if (ret) {
+        return ret;                                                   // RETURN
+    }
+
     return ret;
 }
 
@@ -707,6 +761,11 @@ int BerEncoderOptions::accessAttribute(ACCESSOR& accessor, int id) const
                         ATTRIBUTE_INFO_ARRAY[
                         e_ATTRIBUTE_INDEX_DISABLE_UNSELECTED_CHOICE_ENCODING]);
       } break;
+      case e_ATTRIBUTE_ID_ENCODE_DEFINITE_LENGTH: {
+        return accessor(d_encodeDefiniteLength,
+                        ATTRIBUTE_INFO_ARRAY[
+                                   e_ATTRIBUTE_INDEX_ENCODE_DEFINITE_LENGTH]);
+      } break;
       default:
         return k_NOT_FOUND;
     }
@@ -764,6 +823,12 @@ bool BerEncoderOptions::disableUnselectedChoiceEncoding() const
     return d_disableUnselectedChoiceEncoding;
 }
 
+inline
+bool BerEncoderOptions::encodeDefiniteLength() const
+{
+    return d_encodeDefiniteLength;
+}
+
 }  // close package namespace
 
 // FREE FUNCTIONS
@@ -779,7 +844,8 @@ bool balber::operator==(const BerEncoderOptions& lhs,
          && lhs.datetimeFractionalSecondPrecision() ==
                                         rhs.datetimeFractionalSecondPrecision()
          && lhs.disableUnselectedChoiceEncoding() ==
-                                         rhs.disableUnselectedChoiceEncoding();
+                                          rhs.disableUnselectedChoiceEncoding()
+         && lhs.encodeDefiniteLength()           == rhs.encodeDefiniteLength();
 }
 
 inline
@@ -794,7 +860,8 @@ bool balber::operator!=(const BerEncoderOptions& lhs,
          || lhs.datetimeFractionalSecondPrecision() !=
                                         rhs.datetimeFractionalSecondPrecision()
          || lhs.disableUnselectedChoiceEncoding() !=
-                                         rhs.disableUnselectedChoiceEncoding();
+                                          rhs.disableUnselectedChoiceEncoding()
+         || lhs.encodeDefiniteLength()           != rhs.encodeDefiniteLength();
 }
 
 inline
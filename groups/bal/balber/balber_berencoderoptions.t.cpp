@@ -81,6 +81,7 @@ using namespace bsl;
 // [ 3] setEncodeDateAndTimeTypesAsBinary(bool value);
 // [ 3] setDatetimeFractionalSecondPrecision(int value);
 // [ 3] setDisableUnselectedChoiceEncoding(bool value);
+// [ 3] setEncodeDefiniteLength(bool value);
 //
 // ACCESSORS
 // [10] STREAM& bdexStreamOut(STREAM& stream, int version) const;
@@ -88,6 +89,7 @@ using namespace bsl;
 // [ 4] bool encodeEmptyArrays() const;
 // [ 4] int bdeVersionConformance() const;
 // [ 4] bool encodeDateAndTimeTypesAsBinary() const;
+// [ 4] bool encodeDefiniteLength() const;
 //
 // [ 5] ostream& print(ostream& s, int level = 0, int sPL = 4) const;
 //
@@ -612,6 +614,7 @@ int main(int argc, char *argv[])
         //   bool  encodeDateAndTimeTypesAsBinary() const;
         //   int   datetimeFractionalSecondPrecision() const;
         //   bool  disableUnselectedChoiceEncoding() const;
+        //   bool  encodeDefiniteLength() const;
         // --------------------------------------------------------------------
 
         if (verbose) cout << endl
@@ -666,6 +669,7 @@ int main(int argc, char *argv[])
         //   setEncodeDateAndTimeTypesAsBinary(bool value);
         //   setDatetimeFractionalSecondPrecision(int value);
         //   setDisableUnselectedChoiceEncoding(bool value);
+        //   setEncodeDefiniteLength(bool value);
         // --------------------------------------------------------------------
 
         if (verbose) cout << endl
@@ -705,6 +709,7 @@ int main(int argc, char *argv[])
         const bool  D4   = false;        // 'encodeDateAndTimeTypesAsBinary'
         const int   D5   = 3;            // 'datetimeFractionalSecondPrecision'
         const int   D6   = false;        // 'disableUnselectedChoiceEncoding'
+        const bool  D7   = false;        // 'encodeDefiniteLength'
 
         if (verbose) cout <<
                      "Create an object using the default constructor." << endl;
@@ -726,6 +731,19 @@ int main(int argc, char *argv[])
                      D5 == X.datetimeFractionalSecondPrecision());
         LOOP2_ASSERT(D6, X.disableUnselectedChoiceEncoding(),
                      D6 == X.disableUnselectedChoiceEncoding());
+        LOOP2_ASSERT(D7, X.encodeDefiniteLength(),
+                     D7 == X.encodeDefiniteLength());
+
+        mX.setEncodeDefiniteLength(!D7);
+        ASSERT(!D7 == X.encodeDefiniteLength());
+
+        const Obj Y(X);
+        ASSERT(!D7 == Y.encodeDefiniteLength());
+        ASSERT(X == Y);
+
+        mX.reset();
+        ASSERT(D7 == X.encodeDefiniteLength());
+        ASSERT(X != Y);
       } break;
       case 1: {
         // --------------------------------------------------------------------
@@ -57,6 +57,10 @@ BSLS_IDENT("$Id: $")
 //                                     TEXT             e_BER_UTF8_STRING
 //                                     BASE64           e_BER_OCTET_STRING
 //                                     HEX              e_BER_OCTET_STRING
+//  bslstl::StringRef                  DEFAULT          e_BER_UTF8_STRING
+//                                     TEXT             e_BER_UTF8_STRING
+//                                     BASE64           e_BER_OCTET_STRING
+//                                     HEX              e_BER_OCTET_STRING
 //  bdlt::Date                         DEFAULT          e_BER_VISIBLE_STRING
 //  bdlt::DateTz                       DEFAULT          e_BER_VISIBLE_STRING
 //  bdlt::Datetime                     DEFAULT          e_BER_VISIBLE_STRING
@@ -318,6 +322,7 @@ class BerUniversalTagNumber_Imp {
         // so improves the legibility of this class immensely.
 
     typedef bsl::string         String;
+    typedef bslstl::StringRef   StringRef;
     typedef bsls::Types::Int64  Int64;
     typedef bsls::Types::Uint64 Uint64;
     typedef bdldfp::Decimal64   Decimal64;
@@ -352,6 +357,7 @@ class BerUniversalTagNumber_Imp {
     typedef BerUniversalTagNumber_Sel<double        , SimpleCat> DoubleSel;
     typedef BerUniversalTagNumber_Sel<Decimal64     , SimpleCat> Decimal64Sel;
     typedef BerUniversalTagNumber_Sel<String        , SimpleCat> StringSel;
+    typedef BerUniversalTagNumber_Sel<StringRef     , SimpleCat> StringRefSel;
     typedef BerUniversalTagNumber_Sel<Date          , SimpleCat> DateSel;
     typedef BerUniversalTagNumber_Sel<DateTz        , SimpleCat> DateTzSel;
     typedef BerUniversalTagNumber_Sel<Datetime      , SimpleCat> DatetimeSel;
@@ -405,6 +411,7 @@ class BerUniversalTagNumber_Imp {
     TagVal select(const DoubleSel&                  selector);
     TagVal select(const Decimal64Sel&               selector);
     TagVal select(const StringSel&                  selector);
+    TagVal select(const StringRefSel&               selector);
     TagVal select(const DateSel&                    selector);
     TagVal select(const DateTzSel&                  selector);
     TagVal select(const DatetimeSel&                selector);
@@ -778,6 +785,13 @@ BerUniversalTagNumber_Imp::select(const StringSel&)
     return BerUniversalTagNumber::e_BER_UTF8_STRING;
 }
 
+inline
+BerUniversalTagNumber::Value
+BerUniversalTagNumber_Imp::select(const StringRefSel&)
+{
+    return this->select(StringSel());
+}
+
 inline
 BerUniversalTagNumber::Value
 BerUniversalTagNumber_Imp::select(const DateSel&)
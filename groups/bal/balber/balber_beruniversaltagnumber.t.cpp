@@ -1752,6 +1752,22 @@ int main(int argc, char *argv[])
                                  FM::e_HEX,
                                  Class::e_BER_OCTET_STRING,
                                  &otherTag);
+        TEST_SELECT_WITH_ALT_TAG(bslstl::StringRef,
+                                 FM::e_DEFAULT,
+                                 Class::e_BER_UTF8_STRING,
+                                 &otherTag);
+        TEST_SELECT_WITH_ALT_TAG(bslstl::StringRef,
+                                 FM::e_TEXT,
+                                 Class::e_BER_UTF8_STRING,
+                                 &otherTag);
+        TEST_SELECT_WITH_ALT_TAG(bslstl::StringRef,
+                                 FM::e_BASE64,
+                                 Class::e_BER_OCTET_STRING,
+                                 &otherTag);
+        TEST_SELECT_WITH_ALT_TAG(bslstl::StringRef,
+                                 FM::e_HEX,
+                                 Class::e_BER_OCTET_STRING,
+                                 &otherTag);
         TEST_SELECT_WITH_ALT_TAG(vectorChar,
                                  FM::e_DEFAULT,
                                  Class::e_BER_OCTET_STRING,
@@ -2055,6 +2071,22 @@ int main(int argc, char *argv[])
                                  FM::e_HEX,
                                  Class::e_BER_OCTET_STRING,
                                  &options);
+        TEST_SELECT_WITH_OPTIONS(bslstl::StringRef,
+                                 FM::e_DEFAULT,
+                                 Class::e_BER_UTF8_STRING,
+                                 &options);
+        TEST_SELECT_WITH_OPTIONS(bslstl::StringRef,
+                                 FM::e_TEXT,
+                                 Class::e_BER_UTF8_STRING,
+                                 &options);
+        TEST_SELECT_WITH_OPTIONS(bslstl::StringRef,
+                                 FM::e_BASE64,
+                                 Class::e_BER_OCTET_STRING,
+                                 &options);
+        TEST_SELECT_WITH_OPTIONS(bslstl::StringRef,
+                                 FM::e_HEX,
+                                 Class::e_BER_OCTET_STRING,
+                                 &options);
         TEST_SELECT_WITH_OPTIONS(bdlt::Date,
                                  FM::e_DEFAULT,
                                  Class::e_BER_VISIBLE_STRING,
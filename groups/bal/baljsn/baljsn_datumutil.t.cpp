@@ -24,6 +24,7 @@
 #include <bsls_asserttest.h>
 #include <bsls_compilerfeatures.h>
 #include <bsls_platform.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bdld_datum.h>
@@ -31,6 +32,7 @@
 #include <bdld_datumerror.h>
 #include <bdld_datummaker.h>
 #include <bdld_datummapbuilder.h>
+#include <bdld_datumview.h>
 #include <bdld_manageddatum.h>
 
 #include <bdldfp_decimal.h>
@@ -84,6 +86,7 @@ using namespace bsl;
 // [ 3] BREATHING ENCODE TEST
 // [ 4] BREATHING ROUND-TRIP TEST
 // [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE: JSON VS. 'bdld::DatumView'
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -3733,6 +3736,155 @@ int main(int argc, char *argv[])
         ASSERTV(datum, other, datum == other);
 
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: JSON VS. 'bdld::DatumView'
+        //
+        // Concerns:
+        //: 1 Passing a 'Datum' tree through the binary encoding of
+        //:   'bdld_datumview' is cheaper than a JSON round trip, and reading
+        //:   a value from the encoding does not require decoding it.
+        //
+        // Plan:
+        //: 1 Build an array of records similar to a typical JSON document.
+        //:   An optional argument gives the number of records.
+        //:
+        //: 2 Time, per iteration, encoding to JSON, decoding from JSON,
+        //:   encoding with 'bdld::DatumViewUtil', verifying the encoding with
+        //:   'bdld::DatumViewUtil::view', and converting the view back with
+        //:   'toDatum'.
+        //:
+        //: 3 Time looking up a field of a record, both after decoding the
+        //:   JSON and in place in the binary encoding.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: JSON VS. 'bdld::DatumView'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: JSON VS. 'bdld::DatumView'" << endl
+                          << "=======================================" << endl;
+
+        typedef bdld::DatumViewUtil ViewUtil;
+
+        const int NUM_RECORDS = verbose ? atoi(argv[2]) : 1000;
+        const int ITERATIONS  = NUM_RECORDS < 100
+                              ? 2000
+                              : 200000 / NUM_RECORDS;
+
+        DAB records(&ta);
+        for (int i = 0; i < NUM_RECORDS; ++i) {
+            char name[32];
+            sprintf(name, "instrument-%06d", i);
+
+            DAB tags(&ta);
+            tags.pushBack(D::copyString("equity", &ta));
+            tags.pushBack(D::copyString("listed", &ta));
+
+            DMB record(&ta);
+            record.pushBack("active", D::createBoolean(i % 2));
+            record.pushBack("id",     D::createDouble(i));
+            record.pushBack("name",   D::copyString(name, &ta));
+            record.pushBack("price",  D::createDouble(100.0 + i / 8.0));
+            record.pushBack("size",   D::createDouble(i * 100));
+            record.pushBack("tags",   tags.commit());
+            records.pushBack(record.sortAndCommit());
+        }
+        MD datum(records.commit(), &ta);
+
+        bsl::string       json(&ta);
+        bsl::vector<char> binary(&ta);
+        ASSERT(0 == Util::encode(&json, *datum));
+        ASSERT(0 == ViewUtil::encode(&binary, datum));
+
+        cout << "records: "        << NUM_RECORDS
+             << ", JSON bytes: "   << json.size()
+             << ", binary bytes: " << binary.size() << endl;
+
+        bsls::Stopwatch timer;
+
+        timer.start(true);
+        for (int i = 0; i < ITERATIONS; ++i) {
+            Util::encode(&json, *datum);
+        }
+        timer.stop();
+        const double jsonEncode = timer.accumulatedWallTime() * 1e6
+                                                                  / ITERATIONS;
+
+        MD decoded(&ta);
+        timer.reset();
+        timer.start(true);
+        for (int i = 0; i < ITERATIONS; ++i) {
+            Util::decode(&decoded, json);
+        }
+        timer.stop();
+        const double jsonDecode = timer.accumulatedWallTime() * 1e6
+                                                                  / ITERATIONS;
+        ASSERT(decoded == datum);
+
+        timer.reset();
+        timer.start(true);
+        for (int i = 0; i < ITERATIONS; ++i) {
+            ViewUtil::encode(&binary, datum);
+        }
+        timer.stop();
+        const double binaryEncode = timer.accumulatedWallTime() * 1e6
+                                                                  / ITERATIONS;
+
+        bdld::DatumView view;
+        timer.reset();
+        timer.start(true);
+        for (int i = 0; i < ITERATIONS; ++i) {
+            ViewUtil::view(&view, binary.data(), binary.size());
+        }
+        timer.stop();
+        const double binaryView = timer.accumulatedWallTime() * 1e6
+                                                                  / ITERATIONS;
+
+        MD converted(&ta);
+        timer.reset();
+        timer.start(true);
+        for (int i = 0; i < ITERATIONS; ++i) {
+            converted.adopt(ViewUtil::toDatum(view, &ta));
+        }
+        timer.stop();
+        const double binaryToDatum = timer.accumulatedWallTime() * 1e6
+                                                                  / ITERATIONS;
+        ASSERT(converted == datum);
+
+        const int LOOKUPS = ITERATIONS * 1000;
+        double    sum     = 0;
+
+        timer.reset();
+        timer.start(true);
+        for (int i = 0; i < LOOKUPS; ++i) {
+            const D *price = decoded->theArray()[i % NUM_RECORDS]
+                                                    .theMap().find("price");
+            sum += price->theDouble();
+        }
+        timer.stop();
+        const double datumFind = timer.accumulatedWallTime() * 1e9 / LOOKUPS;
+
+        timer.reset();
+        timer.start(true);
+        for (int i = 0; i < LOOKUPS; ++i) {
+            bdld::DatumView price;
+            ViewUtil::viewUnchecked(binary.data()).theArray()[i % NUM_RECORDS]
+                                             .theMap().find(&price, "price");
+            sum -= price.theDouble();
+        }
+        timer.stop();
+        const double viewFind = timer.accumulatedWallTime() * 1e9 / LOOKUPS;
+        ASSERTV(sum, 0 == sum);
+
+        cout << "JSON encode:             " << jsonEncode    << " us\n"
+             << "JSON decode:             " << jsonDecode    << " us\n"
+             << "DatumViewUtil::encode:   " << binaryEncode  << " us\n"
+             << "DatumViewUtil::view:     " << binaryView    << " us\n"
+             << "DatumViewUtil::toDatum:  " << binaryToDatum << " us\n"
+             << "Datum lookup:            " << datumFind     << " ns\n"
+             << "DatumView lookup:        " << viewFind      << " ns" << endl;
+      } break;
       default: {
         cerr << "WARNING: CASE '" << test << "' NOT FOUND." << endl;
         testStatus = -1;
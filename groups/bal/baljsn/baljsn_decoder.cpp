@@ -8,6 +8,7 @@ BSLS_IDENT_RCSID(baljsn_decoder_cpp,"$Id$ $CSID$")
 
 #include <bsla_fallthrough.h>
 
+#include <bsl_cstring.h>
 #include <bsl_iterator.h>
 
 namespace BloombergLP {
@@ -18,6 +19,63 @@ namespace baljsn {
                                // -------------
 
 // PRIVATE MANIPULATORS
+int Decoder::decodeImp(bslstl::StringRef *value,
+                       int,
+                       bdlat_TypeCategory::Simple)
+{
+    if (Tokenizer::e_ELEMENT_VALUE != d_tokenizer.tokenType()) {
+        d_logStream << "Simple element value was not found\n";
+        return -1;                                                    // RETURN
+    }
+
+    if (!d_input_p) {
+        d_logStream << "String references can be decoded only from a "
+                    << "contiguous buffer\n";
+        return -1;                                                    // RETURN
+    }
+
+    bslstl::StringRef dataValue;
+    if (0 != d_tokenizer.value(&dataValue)
+     || dataValue.length() < 2
+     || '"' != dataValue[0]) {
+        d_logStream << "Error reading string value\n";
+        return -1;                                                    // RETURN
+    }
+
+    // Look for the closing quote, which the tokenizer includes in the value.
+    // If no escape sequence precedes it, refer to the string in the input.
+
+    const char *begin = dataValue.data() + 1;
+    const char *end   = dataValue.data() + dataValue.length();
+    const char *iter  = begin;
+    while (iter < end && '"' != *iter && '\\' != *iter) {
+        ++iter;
+    }
+
+    if (iter < end && '"' == *iter) {
+        const bsls::Types::Uint64 offset = d_tokenizer.valueOffset() + 1;
+        value->assign(d_input_p + offset, iter - begin);
+        return 0;                                                     // RETURN
+    }
+
+    // Otherwise, unescape the string and copy it to the arena.
+
+    const int                                     BAL_BUF_SIZE = 128;
+    bdlma::LocalSequentialAllocator<BAL_BUF_SIZE> bufferAllocator;
+    bsl::string                                   tmpString(&bufferAllocator);
+
+    if (0 != ParserUtil::getValue(&tmpString, dataValue)) {
+        d_logStream << "Error reading string value\n";
+        return -1;                                                    // RETURN
+    }
+
+    char *copy = static_cast<char *>(
+                              d_stringArena_p->allocate(tmpString.length()));
+    bsl::memcpy(copy, tmpString.data(), tmpString.length());
+    value->assign(copy, tmpString.length());
+    return 0;
+}
+
 bsl::ostream& Decoder::logTokenizerError(const char *alternateString)
 {
     const int sts = d_tokenizer.readStatus();
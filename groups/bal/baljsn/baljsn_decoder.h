@@ -15,11 +15,12 @@ BSLS_IDENT("$Id: $")
 //@DESCRIPTION: This component provides a class, 'baljsn::Decoder', for
 // decoding value-semantic objects in the JSON format.  In particular, the
 // 'class' contains a parameterized 'decode' function that decodes an object
-// from a specified stream.  There are two overloaded versions of this
+// from a specified stream.  There are three overloaded versions of this
 // function:
 //
 //: o one that reads from a 'bsl::streambuf'
 //: o one that reads from a 'bsl::istream'
+//: o one that reads from a contiguous buffer
 //
 // This component can be used with types that support the 'bdeat' framework
 // (see the 'bdeat' package for details), which is a compile-time interface for
@@ -55,6 +56,51 @@ BSLS_IDENT("$Id: $")
 // non-UTF-8 with no adverse effects to their clients.  Consequently, this
 // option is 'false' by default to maintain backward compatibility.
 //
+///Decoding 'bslstl::StringRef' Elements
+///--------------------------------------
+// Elements of type 'bslstl::StringRef' can be decoded only by the 'decode'
+// overload reading from a contiguous buffer, which is passed an arena
+// allocator in addition to the buffer.  Such an element is loaded with a
+// reference into the buffer if the JSON string it is decoded from contains no
+// escape sequences, and with a reference to a copy of the unescaped string,
+// in memory supplied by the arena, otherwise.  Most strings are thus decoded
+// without copying or allocating, which makes decoding types that hold many
+// strings significantly cheaper, but the decoded object is valid only as long
+// as the buffer and the memory supplied by the arena are.  Note that the
+// decoder never deallocates memory supplied by the arena: an allocator whose
+// 'deallocate' is a no-op, such as 'bdlma::SequentialAllocator', should be
+// used, and released when the decoded object is no longer used.  Also note
+// that elements of type 'bsl::string' are decoded by all overloads, and are
+// always copied.
+//
+///Decoding Many Messages Into an Arena
+///------------------------------------
+// When a stream of messages is decoded, the memory that each decoded object
+// allocates for its strings and arrays can be supplied by a
+// 'bdlma::ArenaObject', which holds an object constructed on a rewindable
+// arena.  Calling 'reset' before each 'decode' discards the previous message
+// in one step, and the decoder keeps its own buffers from one message to the
+// next, so once the arena has grown to fit the largest message, decoding
+// allocates no memory at all.  The arena of the held object is also suitable
+// as the 'stringArena' of the buffer overload of 'decode', whose
+// 'bslstl::StringRef' elements are then discarded together with the message:
+//..
+//  bdlma::ArenaObject<s_baltst::Employee> employee;
+//  baljsn::Decoder                        decoder;
+//  baljsn::DecoderOptions                 options;
+//
+//  while (receiveMessage(&message)) {  // 'message' is a 'bslstl::StringRef'
+//      employee.reset();
+//      if (0 != decoder.decode(message,
+//                              employee.object(),
+//                              options,
+//                              employee.arena())) {
+//          // handle error
+//      }
+//      processEmployee(*employee.object());
+//  }
+//..
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -160,6 +206,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlma_localsequentialallocator.h>
 
+#include <bdlsb_fixedmeminstreambuf.h>
+
 #include <bslmf_assert.h>
 
 #include <bsls_assert.h>
@@ -195,6 +243,12 @@ class Decoder {
     int                 d_currentDepth;         // current decoding depth
     int                 d_maxDepth;             // max decoding depth
     bool                d_skipUnknownElements;  // skip unknown elements flag
+    const char         *d_input_p;              // input being decoded if it
+                                                // is contiguous, and 0
+                                                // otherwise (held, not owned)
+    bslma::Allocator   *d_stringArena_p;        // arena for unescaped
+                                                // string references (held,
+                                                // not owned)
 
     // FRIENDS
     friend struct Decoder_DecodeImpProxy;
@@ -217,6 +271,9 @@ class Decoder {
     int decodeImp(TYPE *value, int mode, bdlat_TypeCategory::Array);
     template <class TYPE>
     int decodeImp(TYPE *value, int mode, bdlat_TypeCategory::NullableValue);
+    int decodeImp(bslstl::StringRef          *value,
+                  int                         mode,
+                  bdlat_TypeCategory::Simple);
     int decodeImp(bsl::vector<char>         *value,
                   int                        mode,
                   bdlat_TypeCategory::Array);
@@ -271,7 +328,8 @@ class Decoder {
         // types.  Return 0 on success, and a non-zero value otherwise.  Note
         // that this operation internally buffers input from 'streambuf', and
         // if decoding is successful, will attempt to update the input position
-        // of 'streambuf' to the last unprocessed byte.
+        // of 'streambuf' to the last unprocessed byte.  Also note that
+        // decoding fails if 'value' has elements of type 'bslstl::StringRef'.
 
     template <class TYPE>
     int decode(bsl::istream&          stream,
@@ -290,7 +348,28 @@ class Decoder {
         // 'options'.  Return 0 on success, and a non-zero value otherwise.
         // Note that this operation internally buffers input from 'stream', and
         // if decoding is successful, will attempt to update the input position
-        // of 'stream' to the last unprocessed byte.
+        // of 'stream' to the last unprocessed byte.  Also note that decoding
+        // fails if 'value' has elements of type 'bslstl::StringRef'.
+
+    template <class TYPE>
+    int decode(const bslstl::StringRef&  input,
+               TYPE                     *value,
+               const DecoderOptions&     options,
+               bslma::Allocator         *stringArena);
+        // Decode into the specified 'value', of a (template parameter) 'TYPE',
+        // the JSON data in the specified 'input', using the specified
+        // 'options'.  'TYPE' shall be a 'bdeat'-compatible sequence, choice,
+        // or array type, or a 'bdeat'-compatible dynamic type referring to one
+        // of those types.  Load each element of 'value' of type
+        // 'bslstl::StringRef' with a reference into 'input' if the JSON string
+        // it is decoded from has no escape sequences, and with a reference to
+        // the unescaped string, copied to memory supplied by the specified
+        // 'stringArena', otherwise.  Return 0 on success, and a non-zero value
+        // otherwise.  The behavior is undefined unless 'stringArena' is not 0.
+        // Note that those elements of 'value' are valid only as long as
+        // 'input' and the memory supplied by 'stringArena' are, and that this
+        // method never deallocates memory supplied by 'stringArena' (see
+        // {Decoding 'bslstl::StringRef' Elements}).
 
     template <class TYPE>
     int decode(bsl::streambuf *streamBuf, TYPE *value);
@@ -898,6 +977,8 @@ Decoder::Decoder(bslma::Allocator *basicAllocator)
 , d_currentDepth(0)
 , d_maxDepth(0)
 , d_skipUnknownElements(false)
+, d_input_p(0)
+, d_stringArena_p(0)
 {
 }
 
@@ -985,6 +1066,28 @@ int Decoder::decode(bsl::istream&          stream,
     return decode(stream, value, options ? *options : localOpts);
 }
 
+template <class TYPE>
+int Decoder::decode(const bslstl::StringRef&  input,
+                    TYPE                     *value,
+                    const DecoderOptions&     options,
+                    bslma::Allocator         *stringArena)
+{
+    BSLS_ASSERT(value);
+    BSLS_ASSERT(stringArena);
+
+    bdlsb::FixedMemInStreamBuf streamBuf(input.data(), input.length());
+
+    d_input_p       = input.data();
+    d_stringArena_p = stringArena;
+
+    const int rc = decode(&streamBuf, value, options);
+
+    d_input_p       = 0;
+    d_stringArena_p = 0;
+
+    return rc;
+}
+
 template <class TYPE>
 int Decoder::decode(bsl::streambuf *streamBuf, TYPE *value)
 {
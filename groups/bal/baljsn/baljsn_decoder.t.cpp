@@ -22,15 +22,22 @@
 #include <bdlat_typetraits.h>
 #include <bdlat_valuetypefunctions.h>
 #include <bdlb_chartype.h>
+#include <bdlb_nullablevalue.h>
 #include <bdlb_print.h>
 #include <bdlb_printmethods.h>  // for printing vector
 #include <bdlde_utf8util.h>
+#include <bdlma_arenaobject.h>
+#include <bdlma_sequentialallocator.h>
 #include <bdlsb_fixedmeminstreambuf.h>
 #include <bdlsb_fixedmemoutstreambuf.h>
 
 #include <bslmt_testutil.h>
 
 #include <bslim_printer.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bsls_asserttest.h>
+#include <bsls_keyword.h>
 #include <bslmt_threadutil.h>
 
 #include <bsl_string.h>
@@ -71,12 +78,14 @@ namespace test = BloombergLP::s_baltst;
 // [ 4] int decode(bsl::istream& stream, TYPE *v, options);
 // [ 4] int decode(bsl::streambuf *streamBuf, TYPE *v, &options);
 // [ 4] int decode(bsl::istream& stream, TYPE *v, &options);
+// [10] int decode(const StringRef& input, TYPE *v, options, arena);
+// [11] DECODING INTO A 'bdlma::ArenaObject'
 //
 // ACCESSORS
 // [ 4] bsl::string loggedMessages() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 7] USAGE EXAMPLE
+// [12] USAGE EXAMPLE
 // [ 5] MULTI-THREADING TEST CASE
 // [ 6] DRQS 43702912
 
@@ -124,6 +133,13 @@ void aSsErT(bool condition, const char *message, int line)
 #define T_           BSLMT_TESTUTIL_T_  // Print a tab (w/o newline).
 #define L_           BSLMT_TESTUTIL_L_  // current Line number
 
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
 // ============================================================================
 //                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
 // ----------------------------------------------------------------------------
@@ -36495,20 +36511,68 @@ struct IsEnumeration<test::Enumeration0> {
 }  // close enterprise namespace
 
 
+namespace {
+
+                            // ====================
+                            // class ArenaAllocator
+                            // ====================
+
+class ArenaAllocator : public bslma::Allocator {
+    // This class provides an allocator that supplies memory from a sequential
+    // allocator, never deallocates, and counts the allocations made.
+
+    // DATA
+    bdlma::SequentialAllocator d_arena;           // supplies memory
+    int                        d_numAllocations;  // number of allocations
+
+  public:
+    // CREATORS
+    explicit ArenaAllocator(bslma::Allocator *basicAllocator)
+        // Create an arena using the specified 'basicAllocator' to supply
+        // memory.
+    : d_arena(basicAllocator)
+    , d_numAllocations(0)
+    {
+    }
+
+    // MANIPULATORS
+    void *allocate(size_type size) BSLS_KEYWORD_OVERRIDE
+        // Return memory of the specified 'size' from the arena.
+    {
+        ++d_numAllocations;
+        return d_arena.allocate(size);
+    }
+
+    void deallocate(void *) BSLS_KEYWORD_OVERRIDE
+        // Do nothing.
+    {
+    }
+
+    // ACCESSORS
+    int numAllocations() const
+        // Return the number of calls to 'allocate' made on this object.
+    {
+        return d_numAllocations;
+    }
+};
+
+}  // close unnamed namespace
+
 // ============================================================================
 //                               MAIN PROGRAM
 // ----------------------------------------------------------------------------
 
 int main(int argc, char *argv[])
 {
-    int         test = argc > 1 ? atoi(argv[1]) : 0;
-    bool     verbose = argc > 2;
-    bool veryVerbose = argc > 3;
+    int             test = argc > 1 ? atoi(argv[1]) : 0;
+    bool         verbose = argc > 2;
+    bool     veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
 
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 10: {
+      case 12: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -36615,6 +36679,318 @@ int main(int argc, char *argv[])
     ASSERT(21              == employee.age());
 //..
       } break;
+      case 11: {
+        // --------------------------------------------------------------------
+        // TESTING DECODING INTO A 'bdlma::ArenaObject'
+        //
+        // Concerns:
+        //: 1 An object held by a 'bdlma::ArenaObject' is decoded correctly
+        //:   after each 'reset', using either the 'bsl::streambuf' overload or
+        //:   the buffer overload with the held object's arena.
+        //:
+        //: 2 Once the arena has grown to fit the message, decoding obtains no
+        //:   memory from the default allocator, from the decoder's allocator,
+        //:   or from the allocator supplied to the arena.
+        //
+        // Plan:
+        //: 1 Repeatedly reset an arena object and decode into it a JSON
+        //:   'Employee' whose strings, some of which are escaped, do not fit
+        //:   in the short string buffer, alternating between the two
+        //:   overloads.  Check the decoded value and, after the first few
+        //:   iterations, the allocation counts.  (C-1..2)
+        //
+        // Testing:
+        //   DECODING INTO A 'bdlma::ArenaObject'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING DECODING INTO A 'bdlma::ArenaObject'"
+                          << endl
+                          << "============================================"
+                          << endl;
+
+        bslma::TestAllocator         da("default", veryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator ta("test",     veryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVerbose);
+
+        const char JSON[] =
+            "{\n"
+            "\"name\" : \"an employee name too long for the short buffer\",\n"
+            "\"homeAddress\" : {\n"
+            "  \"street\" : \"a \\\"quoted\\\" street name, also too long\",\n"
+            "  \"city\" : \"a city name too long for the short buffer\",\n"
+            "  \"state\" : \"NY\"\n"
+            "},\n"
+            "\"age\" : 42\n"
+            "}";
+
+        test::Employee expected(&ta);
+        expected.name()                 = "an employee name too long for "
+                                          "the short buffer";
+        expected.homeAddress().street() = "a \"quoted\" street name, also too "
+                                          "long";
+        expected.homeAddress().city()   = "a city name too long for the "
+                                          "short buffer";
+        expected.homeAddress().state()  = "NY";
+        expected.age()                  = 42;
+
+        const baljsn::DecoderOptions OPTIONS;
+
+        baljsn::Decoder decoder(&ta);
+        {
+            bdlma::ArenaObject<test::Employee> employee(&sa);
+
+            bsls::Types::Int64 numDefault  = 0;
+            bsls::Types::Int64 numDecoder  = 0;
+            bsls::Types::Int64 numSupplied = 0;
+
+            for (int i = 0; i < 20; ++i) {
+                if (4 == i) {
+                    numDefault  = da.numAllocations();
+                    numDecoder  = ta.numAllocations();
+                    numSupplied = sa.numAllocations();
+                }
+
+                employee.reset();
+
+                if (i % 2) {
+                    bdlsb::FixedMemInStreamBuf isb(JSON, sizeof JSON - 1);
+                    ASSERTV(i, decoder.loggedMessages(),
+                            0 == decoder.decode(&isb,
+                                                employee.object(),
+                                                OPTIONS));
+                }
+                else {
+                    ASSERTV(i, decoder.loggedMessages(),
+                            0 == decoder.decode(bslstl::StringRef(
+                                                            JSON,
+                                                            sizeof JSON - 1),
+                                                employee.object(),
+                                                OPTIONS,
+                                                employee.arena()));
+                }
+                ASSERTV(i, expected == *employee.object());
+            }
+
+            ASSERTV(numDefault, da.numAllocations(),
+                    numDefault == da.numAllocations());
+            ASSERTV(numDecoder, ta.numAllocations(),
+                    numDecoder == ta.numAllocations());
+            ASSERTV(numSupplied, sa.numAllocations(),
+                    numSupplied == sa.numAllocations());
+        }
+        ASSERT(0 == sa.numBytesInUse());
+      } break;
+      case 10: {
+        // --------------------------------------------------------------------
+        // TESTING DECODING OF 'bslstl::StringRef'
+        //
+        // Concerns:
+        //: 1 Decoding from a buffer loads 'bslstl::StringRef' elements having
+        //:   no escape sequences with references into the buffer, without
+        //:   allocating.
+        //:
+        //: 2 Elements having escape sequences are unescaped into memory
+        //:   supplied by the arena, with one allocation each.
+        //:
+        //: 3 Strings of any length, at any position in the buffer, including
+        //:   past the size of the internal buffer of the tokenizer, are
+        //:   referenced correctly.
+        //:
+        //: 4 Nullable 'bslstl::StringRef' elements are supported.
+        //:
+        //: 5 Decoding fails for values that are not strings, for invalid
+        //:   escape sequences, and when decoding 'bslstl::StringRef' elements
+        //:   from a 'bsl::streambuf'.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Decode arrays of strings with and without escape sequences,
+        //:   preceded by strings of various lengths, into a
+        //:   'bsl::vector<bslstl::StringRef>', and verify the values, where
+        //:   they reside, and the number of allocations from the arena and
+        //:   from the default allocator.  (C-1..3)
+        //:
+        //: 2 Decode an array holding strings and nulls into a
+        //:   'bsl::vector<bdlb::NullableValue<bslstl::StringRef> >'.  (C-4)
+        //:
+        //: 3 Verify that decoding fails for invalid input and through the
+        //:   'bsl::streambuf' overload.  (C-5)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-6)
+        //
+        // Testing:
+        //   int decode(const StringRef& input, TYPE *v, options, arena);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING DECODING OF 'bslstl::StringRef'" << endl
+                          << "=======================================" << endl;
+
+        typedef bsl::vector<bslstl::StringRef> Strings;
+
+        bslma::TestAllocator         da("default", veryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator ta("test",  veryVeryVerbose);
+        ArenaAllocator       aa(&ta);
+
+        const baljsn::DecoderOptions OPTIONS;
+
+        if (verbose) cout << "\tStrings with and without escapes." << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_json;       // JSON string
+                const char *d_expected;   // decoded value
+                bool        d_isEscaped;  // has escape sequences
+            } DATA[] = {
+                { L_, "\"\"",            "",            false },
+                { L_, "\"a\"",           "a",           false },
+                { L_, "\"hello world\"", "hello world", false },
+                { L_, "\"\xc3\xa9t\xc3\xa9\"", "\xc3\xa9t\xc3\xa9", false },
+                { L_, "\"a\\nb\"",       "a\nb",        true  },
+                { L_, "\"\\\"\"",        "\"",          true  },
+                { L_, "\"x\\/\"",        "x/",          true  },
+                { L_, "\"\\u00e9\"",     "\xc3\xa9",    true  },
+                { L_, "\"tab\\t\"",      "tab\t",       true  },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            const int PREFIX_LENGTHS[] = { 0, 1, 100, 8189, 8190, 8191, 8192,
+                                           8193, 20000 };
+            const int NUM_PREFIX_LENGTHS = sizeof  PREFIX_LENGTHS
+                                         / sizeof *PREFIX_LENGTHS;
+
+            for (int ti = 0; ti < NUM_PREFIX_LENGTHS; ++ti) {
+                const int PREFIX_LENGTH = PREFIX_LENGTHS[ti];
+
+                if (veryVerbose) { P(PREFIX_LENGTH); }
+
+                bsl::string input("[\"", &ta);
+                input.append(PREFIX_LENGTH, 'p');
+                input += '"';
+
+                int numEscaped = 0;
+                for (int tj = 0; tj < NUM_DATA; ++tj) {
+                    input += ", ";
+                    input += DATA[tj].d_json;
+                    numEscaped += DATA[tj].d_isEscaped;
+                }
+                input += ']';
+
+                const char *const INPUT_BEGIN = input.data();
+                const char *const INPUT_END   = input.data() + input.size();
+
+                Strings value(&ta);
+
+                const int                numArenaAllocations =
+                                                         aa.numAllocations();
+                const bsls::Types::Int64 numDefaultBlocks    =
+                                                         da.numBlocksTotal();
+
+                baljsn::Decoder decoder(&ta);
+                const int rc = decoder.decode(input, &value, OPTIONS, &aa);
+                ASSERTV(PREFIX_LENGTH, decoder.loggedMessages(), 0 == rc);
+                ASSERTV(PREFIX_LENGTH, NUM_DATA + 1 == (int)value.size());
+
+                ASSERTV(PREFIX_LENGTH, numEscaped ==
+                               aa.numAllocations() - numArenaAllocations);
+                ASSERTV(PREFIX_LENGTH,
+                        numDefaultBlocks == da.numBlocksTotal());
+
+                ASSERTV(PREFIX_LENGTH, PREFIX_LENGTH ==
+                                                  (int)value[0].length());
+                ASSERTV(PREFIX_LENGTH,
+                        bsl::string(PREFIX_LENGTH, 'p') == value[0]);
+                ASSERTV(PREFIX_LENGTH, INPUT_BEGIN + 2 == value[0].data());
+
+                for (int tj = 0; tj < NUM_DATA; ++tj) {
+                    const int               LINE     = DATA[tj].d_line;
+                    const bslstl::StringRef EXPECTED = DATA[tj].d_expected;
+                    const bool              ESCAPED  = DATA[tj].d_isEscaped;
+
+                    const bslstl::StringRef& actual = value[tj + 1];
+
+                    ASSERTV(PREFIX_LENGTH, LINE, EXPECTED, actual,
+                            EXPECTED == actual);
+
+                    const bool inInput = INPUT_BEGIN <= actual.data()
+                                      && actual.data() <= INPUT_END;
+                    ASSERTV(PREFIX_LENGTH, LINE, ESCAPED != inInput);
+                }
+            }
+        }
+
+        if (verbose) cout << "\tNullable string references." << endl;
+        {
+            typedef bsl::vector<bdlb::NullableValue<bslstl::StringRef> >
+                                                               NullableStrings;
+
+            const bsl::string INPUT("[\"a\", null, \"b\\tc\", null]", &ta);
+
+            NullableStrings value(&ta);
+
+            baljsn::Decoder decoder(&ta);
+            ASSERT(0 == decoder.decode(INPUT, &value, OPTIONS, &aa));
+            ASSERT(4 == value.size());
+            ASSERT(!value[0].isNull() && "a"    == value[0].value());
+            ASSERT( value[1].isNull());
+            ASSERT(!value[2].isNull() && "b\tc" == value[2].value());
+            ASSERT( value[3].isNull());
+            ASSERT(INPUT.data() + 2 == value[0].value().data());
+        }
+
+        if (verbose) cout << "\tInvalid input." << endl;
+        {
+            const char *INPUTS[] = {
+                "[1]",
+                "[true]",
+                "[\"a\", null]",
+                "[\"\\x\"]",
+                "[\"\\u12\"]",
+                "[\"a\",",
+            };
+            const int NUM_INPUTS = sizeof INPUTS / sizeof *INPUTS;
+
+            for (int ti = 0; ti < NUM_INPUTS; ++ti) {
+                Strings         value(&ta);
+                baljsn::Decoder decoder(&ta);
+
+                ASSERTV(INPUTS[ti],
+                        0 != decoder.decode(INPUTS[ti], &value, OPTIONS, &aa));
+            }
+
+            const bsl::string INPUT("[\"a\"]", &ta);
+
+            bdlsb::FixedMemInStreamBuf isb(INPUT.data(), INPUT.size());
+            Strings                    value(&ta);
+            baljsn::Decoder            decoder(&ta);
+            ASSERT(0 != decoder.decode(&isb, &value, OPTIONS));
+
+            // Decoding 'bsl::string' elements is unaffected.
+
+            bsl::vector<bsl::string> strings(&ta);
+            ASSERT(0 == decoder.decode(INPUT, &strings, OPTIONS, &aa));
+            ASSERT(1 == strings.size() && "a" == strings[0]);
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Strings         value(&ta);
+            baljsn::Decoder decoder(&ta);
+
+            ASSERT_PASS(decoder.decode("[]", &value, OPTIONS, &aa));
+            ASSERT_FAIL(decoder.decode("[]", &value, OPTIONS, 0));
+        }
+      } break;
       case 9: {
         // ------------------------------------------------------------------
         // TESTING UTF-8 DETECTION
@@ -20,7 +20,6 @@ int Encoder_EncodeImplUtil::encodeCharArray(
                                   const EncoderOptions& encoderOptions)
 {
     bsl::string base64String;
-    bdlde::Base64Encoder encoder(0);
     base64String.resize(
        bdlde::Base64Encoder::encodedLength(static_cast<int>(value.size()), 0));
 
@@ -28,21 +27,11 @@ int Encoder_EncodeImplUtil::encodeCharArray(
 
     BSLS_ASSERT(0 == (base64String.length() & 0x03));
 
-    int numOut;
-    int numIn;
-    int rc = encoder.convert(base64String.begin(),
-                             &numOut,
-                             &numIn,
-                             value.begin(),
-                             value.end());
-
-    if (rc < 0) {
-        return rc;                                                    // RETURN
-    }
-
-    rc = encoder.endConvert(base64String.begin() + numOut);
-    if (rc < 0) {
-        return rc;                                                    // RETURN
+    if (!value.empty()) {
+        bdlde::Base64Encoder::encodeBuffer(&base64String[0],
+                                           value.data(),
+                                           static_cast<int>(value.size()),
+                                           0);
     }
 
     return encodeSimpleValue(formatter,
@@ -136,6 +136,7 @@ BSLS_IDENT("$Id: $")
 #include <baljsn_formatter.h>
 #include <baljsn_printutil.h>
 
+#include <bdlat_arrayfunctions.h>
 #include <bdlat_attributeinfo.h>
 #include <bdlat_choicefunctions.h>
 #include <bdlat_customizedtypefunctions.h>
@@ -149,6 +150,10 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlsb_memoutstreambuf.h>
 
+#include <bslmf_integralconstant.h>
+#include <bslmf_isarithmetic.h>
+#include <bslmf_metaint.h>
+
 #include <bsls_assert.h>
 #include <bsls_types.h>
 
@@ -471,6 +476,54 @@ struct Encoder_EncodeImplUtil {
         // package-level documentation of {'bdlat'} for an introduction to the
         // requirements of 'bdlat' type-category concepts.
 
+    template <class TYPE>
+    static int encodeArrayElements(Formatter             *formatter,
+                                   bsl::ostream          *logStream,
+                                   const TYPE&            value,
+                                   const EncoderOptions&  options,
+                                   bslmf::MetaInt<0>);
+    template <class TYPE>
+    static int encodeArrayElements(Formatter             *formatter,
+                                   bsl::ostream          *logStream,
+                                   const TYPE&            value,
+                                   const EncoderOptions&  options,
+                                   bslmf::MetaInt<1>);
+        // Encode the JSON representation of the elements of the specified
+        // non-empty 'value', separated by commas, to the specified JSON
+        // 'formatter'.  Use the specified 'options' to configure aspects of
+        // the JSON representation of the elements.  If this operation is not
+        // successful, load an unspecified, human-readable description of the
+        // error condition to the specified 'logStream'.  Return 0 on success,
+        // and a non-zero value otherwise.  The overload taking
+        // 'bslmf::MetaInt<1>' is selected for arrays that have contiguous
+        // storage (see 'bdlat_ArrayFunctions::HasContiguousStorage').
+
+    template <class TYPE>
+    static int encodeContiguousArrayElements(
+                                         Formatter             *formatter,
+                                         bsl::ostream          *logStream,
+                                         const TYPE&            value,
+                                         const EncoderOptions&  options,
+                                         bsl::false_type);
+    template <class TYPE>
+    static int encodeContiguousArrayElements(
+                                         Formatter             *formatter,
+                                         bsl::ostream          *logStream,
+                                         const TYPE&            value,
+                                         const EncoderOptions&  options,
+                                         bsl::true_type);
+        // Encode the JSON representation of the elements of the specified
+        // non-empty 'value', having contiguous storage, separated by commas,
+        // to the specified JSON 'formatter'.  Use the specified 'options' to
+        // configure aspects of the JSON representation of the elements.  If
+        // this operation is not successful, load an unspecified,
+        // human-readable description of the error condition to the specified
+        // 'logStream'.  Return 0 on success, and a non-zero value otherwise.
+        // The overload taking 'bsl::true_type' is selected for arrays of
+        // arithmetic types, and writes each element directly to the
+        // 'formatter' without visiting it; the JSON representation is the
+        // same as that produced by visiting the elements.
+
                         // Encoding Generalized Members
 
     static int encodeMember(bool                      *memberIsEmpty,
@@ -1585,11 +1638,34 @@ int Encoder_EncodeImplUtil::encodeNonEmptyArray(
                                          const TYPE&            value,
                                          const EncoderOptions&  options)
 {
-    const int size = static_cast<int>(bdlat_ArrayFunctions::size(value));
-    BSLS_ASSERT(0 < size);
+    BSLS_ASSERT(0 < bdlat_ArrayFunctions::size(value));
+
+    typedef typename bdlat_ArrayFunctions::HasContiguousStorage<TYPE>::Type
+                                                          HasContiguousStorage;
 
     formatter->openArray();
 
+    int rc = encodeArrayElements(
+        formatter, logStream, value, options, HasContiguousStorage());
+    if (rc) {
+        return rc;                                                    // RETURN
+    }
+
+    formatter->closeArray();
+
+    return 0;
+}
+
+template <class TYPE>
+int Encoder_EncodeImplUtil::encodeArrayElements(
+                                         Formatter             *formatter,
+                                         bsl::ostream          *logStream,
+                                         const TYPE&            value,
+                                         const EncoderOptions&  options,
+                                         bslmf::MetaInt<0>)
+{
+    const int size = static_cast<int>(bdlat_ArrayFunctions::size(value));
+
     static const bool s_FIRST_VALUE_IS_FIRST_ELEMENT = true;
     Encoder_ValueVisitor visitor(formatter,
                                  logStream,
@@ -1613,7 +1689,69 @@ int Encoder_EncodeImplUtil::encodeNonEmptyArray(
         }
     }
 
-    formatter->closeArray();
+    return 0;
+}
+
+template <class TYPE>
+inline
+int Encoder_EncodeImplUtil::encodeArrayElements(
+                                         Formatter             *formatter,
+                                         bsl::ostream          *logStream,
+                                         const TYPE&            value,
+                                         const EncoderOptions&  options,
+                                         bslmf::MetaInt<1>)
+{
+    typedef typename bdlat_ArrayFunctions::ElementType<TYPE>::Type
+                                                                   ElementType;
+
+    return encodeContiguousArrayElements(formatter,
+                                         logStream,
+                                         value,
+                                         options,
+                                         bsl::is_arithmetic<ElementType>());
+}
+
+template <class TYPE>
+inline
+int Encoder_EncodeImplUtil::encodeContiguousArrayElements(
+                                         Formatter             *formatter,
+                                         bsl::ostream          *logStream,
+                                         const TYPE&            value,
+                                         const EncoderOptions&  options,
+                                         bsl::false_type)
+{
+    return encodeArrayElements(
+        formatter, logStream, value, options, bslmf::MetaInt<0>());
+}
+
+template <class TYPE>
+int Encoder_EncodeImplUtil::encodeContiguousArrayElements(
+                                         Formatter             *formatter,
+                                         bsl::ostream          *,
+                                         const TYPE&            value,
+                                         const EncoderOptions&  options,
+                                         bsl::true_type)
+{
+    const int size = static_cast<int>(bdlat_ArrayFunctions::size(value));
+
+    typedef typename bdlat_ArrayFunctions::ElementType<TYPE>::Type
+                                                                   ElementType;
+
+    const ElementType *elements = bdlat_ArrayFunctions::data(value);
+
+    int rc = formatter->putValue(elements[0], &options);
+    if (rc) {
+        return rc;                                                    // RETURN
+    }
+
+    for (int i = 1; i < size; ++i) {
+        formatter->addArrayElementSeparator();
+
+        rc = formatter->putValue(elements[i], &options);
+        if (rc) {
+            return rc;                                                // RETURN
+        }
+    }
 
     return 0;
 }
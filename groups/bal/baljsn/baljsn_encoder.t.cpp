@@ -63,6 +63,7 @@
 #include <s_baltst_employee.h>
 #include <s_baltst_featuretestmessage.h>
 #include <s_baltst_featuretestmessageutil.h>
+#include <s_baltst_rawdataunformatted.h>
 
 using namespace BloombergLP;
 using bsl::cout;
@@ -508,7 +509,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
-      case 20: {
+      case 21: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -620,6 +621,69 @@ int main(int argc, char *argv[])
     ASSERT(EXP_OUTPUT == os.str());
 //..
       } break;
+      case 20: {
+        // --------------------------------------------------------------------
+        // TESTING ARRAYS OF FUNDAMENTAL TYPES
+        //
+        // Concerns:
+        //: 1 The elements of a contiguous array of a fundamental type are
+        //:   encoded, in order, as comma-separated JSON values, in both the
+        //:   compact and pretty styles.
+        //:
+        //: 2 The representation of each element is the same as that of a
+        //:   single value of the element type.
+        //
+        // Plan:
+        //: 1 Encode a sequence having an array of 'unsigned char' using both
+        //:   encoding styles, and compare the results with the expected
+        //:   JSON.  (C-1..2)
+        //
+        // Testing:
+        //   ARRAYS OF FUNDAMENTAL TYPES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING ARRAYS OF FUNDAMENTAL TYPES" << endl
+                          << "===================================" << endl;
+
+        s_baltst::RawDataUnformatted value;
+        value.ucharvec().push_back(0);
+        value.ucharvec().push_back(1);
+        value.ucharvec().push_back(127);
+        value.ucharvec().push_back(255);
+
+        {
+            baljsn::Encoder    encoder;
+            bsl::ostringstream os;
+
+            ASSERTV(encoder.loggedMessages(), 0 == encoder.encode(os, value));
+            ASSERTV(os.str(),
+                    "{\"charvec\":\"\",\"ucharvec\":[0,1,127,255]}" ==
+                                                                  os.str());
+        }
+
+        {
+            baljsn::EncoderOptions options;
+            options.setEncodingStyle(baljsn::EncoderOptions::e_PRETTY);
+            options.setSpacesPerLevel(2);
+
+            baljsn::Encoder    encoder;
+            bsl::ostringstream os;
+
+            ASSERTV(encoder.loggedMessages(),
+                    0 == encoder.encode(os, value, options));
+            ASSERTV(os.str(),
+                    "{\n"
+                    "  \"charvec\" : \"\",\n"
+                    "  \"ucharvec\" : [\n"
+                    "    0,\n"
+                    "    1,\n"
+                    "    127,\n"
+                    "    255\n"
+                    "  ]\n"
+                    "}\n" == os.str());
+        }
+      } break;
       case 19: {
         // --------------------------------------------------------------------
         // TESTING ENCODING OVERFLOW DETECTION
@@ -624,24 +624,24 @@ int ParserUtil::getValue(bsl::vector<char> *value,
         return -1;                                                    // RETURN
     }
 
-    value->clear();
+    value->resize(bdlde::Base64Decoder::maxDecodedLength(
+                                     static_cast<int>(base64String.length())));
 
-    bdlde::Base64Decoder base64Decoder(true);
-    bsl::back_insert_iterator<bsl::vector<char> > outputIterator(*value);
+    int numOut = 0;
 
-    rc = base64Decoder.convert(outputIterator,
-                               base64String.begin(),
-                               base64String.end());
+    rc = bdlde::Base64Decoder::decodeBuffer(
+                                     value->data(),
+                                     &numOut,
+                                     base64String.data(),
+                                     static_cast<int>(base64String.length()),
+                                     true);
 
     if (rc < 0) {
+        value->clear();
         return rc;                                                    // RETURN
     }
 
-    rc = base64Decoder.endConvert(outputIterator);
-
-    if (rc < 0) {
-        return rc;                                                    // RETURN
-    }
+    value->resize(numOut);
 
     return 0;
 }
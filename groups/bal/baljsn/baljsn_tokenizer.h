@@ -230,10 +230,10 @@ class Tokenizer {
 
     bsl::size_t         d_valueIter;        // cursor for iterating value
 
-    Uint64              d_readOffset;       // unused unless UTF-8 checking is
-                                            // enabled -- offset in the
-                                            // streambuf after the last byte of
-                                            // valid UTF-8 read
+    Uint64              d_readOffset;       // offset in the streambuf after
+                                            // the last byte read (of valid
+                                            // UTF-8, if UTF-8 checking is
+                                            // enabled)
 
     TokenType           d_tokenType;        // token type
 
@@ -422,6 +422,14 @@ class Tokenizer {
         // the current token's type is 'e_ELEMENT_NAME' or 'e_ELEMENT_VALUE' or
         // leave 'data' unmodified otherwise.  Return 0 on success and a
         // non-zero value otherwise.
+
+    bsls::Types::Uint64 valueOffset() const;
+        // Return the position, relative to when 'reset' was called, of the
+        // first character of the value of the current token.  The behavior is
+        // undefined unless the current token's type is 'e_ELEMENT_NAME' or
+        // 'e_ELEMENT_VALUE'.  Note that, if the input of this tokenizer is
+        // contiguous in memory, the value of the current token is found at
+        // this position in that memory.
 };
 
 // ============================================================================
@@ -561,6 +569,15 @@ Tokenizer::TokenType Tokenizer::tokenType() const
     return d_tokenType;
 }
 
+inline
+bsls::Types::Uint64 Tokenizer::valueOffset() const
+{
+    BSLS_ASSERT(e_ELEMENT_NAME  == d_tokenType
+             || e_ELEMENT_VALUE == d_tokenType);
+
+    return d_readOffset - (d_stringBuffer.size() - d_valueBegin);
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
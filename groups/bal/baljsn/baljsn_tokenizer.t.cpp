@@ -64,9 +64,10 @@ using bsl::endl;
 // [17} const char *utf8ErrorMessage(const char *) const;
 // [17] void setAllowNonUtf8StringLiterals(bool);
 // [17] bool allowNonUtf8StringLiterals() const;
+// [18] bsls::Types::Uint64 valueOffset() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [18] USAGE EXAMPLE
+// [19] USAGE EXAMPLE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -489,7 +490,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 18: {
+      case 19: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -611,6 +612,87 @@ int main(int argc, char *argv[])
     ASSERT(10022           == address.d_zipcode);
 //..
       } break;
+      case 18: {
+        // --------------------------------------------------------------------
+        // TESTING 'valueOffset'
+        //
+        // Concerns:
+        //: 1 'valueOffset' returns the position in the input of the first
+        //:   character of the value of the current name or value token.
+        //:
+        //: 2 The position is correct for values that span reloads of the
+        //:   internal buffer, and for values longer than that buffer, both
+        //:   with and without UTF-8 checking.
+        //
+        // Plan:
+        //: 1 For a set of lengths around the size of the internal buffer,
+        //:   create a JSON document having names and values of that length
+        //:   and of short lengths, preceded by padding of several lengths.
+        //:
+        //: 2 Tokenize each document and verify that, for every name and
+        //:   value token, the input at 'valueOffset' holds the value returned
+        //:   by 'value'.  (C-1..2)
+        //
+        // Testing:
+        //   bsls::Types::Uint64 valueOffset() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'valueOffset'" << endl
+                          << "=====================" << endl;
+
+        const int LENGTHS[] = { 1, 10, 1000, 8180, 8190, 8191, 8192, 10000,
+                                20000 };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        const int PADDINGS[] = { 0, 1, 7, 4000 };
+        const int NUM_PADDINGS = sizeof PADDINGS / sizeof *PADDINGS;
+
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+        for (int tj = 0; tj < NUM_PADDINGS; ++tj) {
+        for (int utf8 = 0; utf8 < 2; ++utf8) {
+            const int LENGTH  = LENGTHS[ti];
+            const int PADDING = PADDINGS[tj];
+
+            if (veryVerbose) { P_(LENGTH) P_(PADDING) P(utf8) }
+
+            const bsl::string LONG(LENGTH, 'x');
+
+            bsl::string input(PADDING, ' ');
+            input += "{\"a\":\"b\",\"" + LONG + "\":[1,\"" + LONG
+                   + "\",-12.5,\"\"],\"c\":" + bsl::string(LENGTH, '7')
+                   + ",\"d\":\"" + LONG + "\"}";
+
+            bdlsb::FixedMemInStreamBuf isb(input.data(), input.size());
+
+            baljsn::Tokenizer mX;  const baljsn::Tokenizer& X = mX;
+            mX.reset(&isb);
+            mX.setAllowNonUtf8StringLiterals(!utf8);
+
+            int numValues = 0;
+            while (0 == mX.advanceToNextToken()
+                && baljsn::Tokenizer::e_END_OBJECT != X.tokenType()) {
+                if (baljsn::Tokenizer::e_ELEMENT_NAME  != X.tokenType()
+                 && baljsn::Tokenizer::e_ELEMENT_VALUE != X.tokenType()) {
+                    continue;
+                }
+
+                bslstl::StringRef value;
+                ASSERTV(LENGTH, PADDING, 0 == X.value(&value));
+
+                const bsls::Types::Uint64 offset = X.valueOffset();
+                ASSERTV(LENGTH, PADDING, offset + value.length()
+                                                           <= input.size());
+                ASSERTV(LENGTH, PADDING, numValues,
+                        bslstl::StringRef(input.data() + offset,
+                                          value.length()) == value);
+                ++numValues;
+            }
+            ASSERTV(LENGTH, PADDING, 11 == numValues);
+        }
+        }
+        }
+      } break;
       case 17: {
         // --------------------------------------------------------------------
         // TESTING UTF8
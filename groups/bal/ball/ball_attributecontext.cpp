@@ -83,20 +83,21 @@ AttributeContext_RuleEvaluationCache::update(
 
     RuleSet::MaskType needEvaluations = ~d_evalMask & relevantRulesMask;
 
+    // Evaluate the needed rules together, so that a predicate shared by
+    // several of them is tested once.
+
+    d_resultMask |= rules.evaluate(needEvaluations, attributes);
+
     int i;
 
-    // Get the index, 'i', of each relevant rule to evaluate.
+    // Get the index, 'i', of each relevant rule evaluated.
     while ((i = bdlb::BitUtil::numTrailingUnsetBits(needEvaluations))
                                                  != RuleSet::e_MAX_NUM_RULES) {
-        const Rule *rule;
-
         // 'rules.getRuleById(i)' will return null if rule 'i' has been removed
         // from the category manager's rule set.
 
-        if ((rule = rules.getRuleById(i))) {
-            RuleSet::MaskType result = rule->evaluate(attributes) ? 1 : 0;
-            d_resultMask |= result << i;  // OR in result of evaluation.
-            d_evalMask   |=      1 << i;  // Mark rule as evaluated.
+        if (rules.getRuleById(i)) {
+            d_evalMask |= 1 << i;         // Mark rule as evaluated.
         }
 
         needEvaluations &= ~(1 << i);     // We are done with rule 'i'.
@@ -383,6 +383,18 @@ class AttributeContext_RuleEvaluationCache {
         // Clear any currently cached rule evaluation data, restoring this
         // object to its default constructed state (empty).
 
+    void containerAdded();
+        // Update this cache to reflect that an attribute container has been
+        // added to the attributes for which rules were evaluated.  A rule that
+        // is active remains active when attributes are added, so only the
+        // evaluations of the rules not known to be active are discarded.
+
+    void containerRemoved();
+        // Update this cache to reflect that an attribute container has been
+        // removed from the attributes for which rules were evaluated.  A rule
+        // that is not active remains inactive when attributes are removed, so
+        // only the evaluations of the rules known to be active are discarded.
+
     RuleSet::MaskType update(bsls::Types::Int64            sequenceNumber,
                              RuleSet::MaskType             relevantRulesMask,
                              const RuleSet&                rules,
@@ -713,6 +725,19 @@ void AttributeContext_RuleEvaluationCache::clear()
     d_sequenceNumber = -1;
 }
 
+inline
+void AttributeContext_RuleEvaluationCache::containerAdded()
+{
+    d_evalMask &= d_resultMask;
+}
+
+inline
+void AttributeContext_RuleEvaluationCache::containerRemoved()
+{
+    d_evalMask   &= ~d_resultMask;
+    d_resultMask  = 0;
+}
+
 // ACCESSORS
 inline
 bool AttributeContext_RuleEvaluationCache::isDataAvailable(
@@ -741,7 +766,7 @@ AttributeContext::addAttributes(const AttributeContainer *attributes)
 {
     BSLS_ASSERT(attributes);
 
-    d_ruleCache_p.clear();
+    d_ruleCache_p.containerAdded();
     return d_containerList.pushFront(attributes);
 }
 
@@ -754,7 +779,7 @@ void AttributeContext::clearCache()
 inline
 void AttributeContext::removeAttributes(iterator element)
 {
-    d_ruleCache_p.clear();
+    d_ruleCache_p.containerRemoved();
     d_containerList.remove(element);
 }
 
@@ -82,9 +82,10 @@ using namespace bsl;
 //-----------------------------------------------------------------------------
 // [ 1] AttributeSet
 // [ 6] CONCERN: No false positives from 'hasRelevantActiveRules'.
-// [ 7] (OLD) USAGE EXAMPLE
-// [ 8] USAGE EXAMPLE 1
-// [ 9] USAGE EXAMPLE 2
+// [ 7] CONCERN: Cached rule evaluations survive container changes.
+// [ 8] (OLD) USAGE EXAMPLE
+// [ 9] USAGE EXAMPLE 1
+// [10] USAGE EXAMPLE 2
 
 //=============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -1320,7 +1321,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 9: {
+      case 10: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE 2
         //   Extracted from component header file.
@@ -1371,7 +1372,7 @@ int main(int argc, char *argv[])
         bslmt::ThreadUtil::join(mainThread);
 
       } break;
-      case 8: {
+      case 9: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE 1
         //   Extracted from component header file.
@@ -1403,7 +1404,7 @@ int main(int argc, char *argv[])
         bslmt::ThreadUtil::join(threads[0]);
         bslmt::ThreadUtil::join(threads[1]);
       } break;
-      case 7: {
+      case 8: {
         // --------------------------------------------------------------------
         // TESTING ORIGINAL USAGE EXAMPLE
         //   This test runs the original usage example for this component.  It
@@ -1435,6 +1436,136 @@ int main(int argc, char *argv[])
         bslmt::ThreadUtil::join(mainThread);
 
       } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // CACHED RULE EVALUATIONS ACROSS CONTAINER CHANGES
+        //
+        // Concerns:
+        //: 1 The rule evaluations retained by the cache when an attribute
+        //:   container is added to, or removed from, the context (rather
+        //:   than discarded) are still correct, i.e., 'hasRelevantActiveRules'
+        //:   returns the same result as evaluating the relevant rule against
+        //:   the containers of the context.
+        //:
+        //: 2 This holds for any order of additions and removals, for removals
+        //:   of containers other than the most recently added one, and when
+        //:   only some of the rules have been evaluated since the last change.
+        //
+        // Plan:
+        //: 1 Create a category manager having several categories, each with
+        //:   one relevant rule, where the rules share some predicates and one
+        //:   rule has no predicates.
+        //:
+        //: 2 Perform a pseudo-random sequence of additions and removals of
+        //:   attribute containers to and from the context.  After each step,
+        //:   query 'hasRelevantActiveRules' for a pseudo-random subset of the
+        //:   categories, and verify that the result is that of calling
+        //:   'Rule::evaluate' on the containers of the context.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: Cached rule evaluations survive container changes.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CACHED RULE EVALUATIONS ACROSS CONTAINER CHANGES"
+                          << endl
+                          << "================================================"
+                          << endl;
+
+        {
+            CatMngr manager(&globalAllocator);
+            Obj::initialize(&manager, &globalAllocator);
+
+            Obj *mX = Obj::getContext();  const Obj& X = *mX;
+
+            static const struct {
+                const char *d_category;    // category name (and rule pattern)
+                const char *d_predicates;  // predicates, as name/value pairs
+            } RULES[] = {
+                { "CatA", "x1"     },
+                { "CatB", "y2"     },
+                { "CatC", "x1y2"   },
+                { "CatD", "x1z3"   },
+                { "CatE", ""       },
+                { "CatF", "x4y2"   },
+                { "CatG", "x1y2z3" },
+            };
+            enum { NUM_RULES = sizeof RULES / sizeof *RULES };
+
+            const ball::Category *categories[NUM_RULES];
+            const ball::Rule     *rules[NUM_RULES];
+
+            for (int i = 0; i < NUM_RULES; ++i) {
+                categories[i] = manager.addCategory(RULES[i].d_category,
+                                                    32, 32, 32, 32);
+                ASSERT(categories[i]);
+
+                ball::Rule rule(RULES[i].d_category, 64, 64, 64, 64);
+                for (const char *p = RULES[i].d_predicates; *p; p += 2) {
+                    const char *name = 'x' == p[0] ? "x"
+                                     : 'y' == p[0] ? "y"
+                                     :               "z";
+                    rule.addPredicate(ball::Predicate(name, p[1] - '0'));
+                }
+                ASSERT(0 <= manager.addRule(rule));
+                const int id = manager.ruleSet().ruleId(rule);
+                rules[i] = manager.ruleSet().getRuleById(id);
+                ASSERT(rules[i]);
+            }
+
+            static const char *const CONTAINERS[] = {
+                "x1", "y2", "z3", "x4", "x1y2", "y2z3"
+            };
+            enum { NUM_CONTAINERS = sizeof CONTAINERS / sizeof *CONTAINERS };
+
+            AttributeSet containers[NUM_CONTAINERS];
+            for (int i = 0; i < NUM_CONTAINERS; ++i) {
+                for (const char *p = CONTAINERS[i]; *p; p += 2) {
+                    // 'ball::Attribute' does not copy its name.
+
+                    const char *name = 'x' == p[0] ? "x"
+                                     : 'y' == p[0] ? "y"
+                                     :               "z";
+                    containers[i].insert(ball::Attribute(name, p[1] - '0'));
+                }
+            }
+
+            Obj::iterator iterators[NUM_CONTAINERS];
+            bool          isAdded[NUM_CONTAINERS] = { false };
+
+            unsigned int seed = 0;
+
+            for (int step = 0; step < 1000; ++step) {
+                const int index = rand_r(&seed) % NUM_CONTAINERS;
+
+                if (isAdded[index]) {
+                    mX->removeAttributes(iterators[index]);
+                }
+                else {
+                    iterators[index] = mX->addAttributes(&containers[index]);
+                }
+                isAdded[index] = !isAdded[index];
+
+                for (int i = 0; i < NUM_RULES; ++i) {
+                    if (rand_r(&seed) % 2) {
+                        continue;
+                    }
+
+                    const bool EXP = rules[i]->evaluate(X.containers());
+                    ASSERTV(step, i, EXP,
+                            EXP == X.hasRelevantActiveRules(categories[i]));
+                }
+            }
+
+            for (int i = 0; i < NUM_CONTAINERS; ++i) {
+                if (isAdded[i]) {
+                    mX->removeAttributes(iterators[i]);
+                }
+            }
+
+            ball::AttributeContextProctor proctor;  // destroys context
+        }
+      } break;
       case 6: {
         // --------------------------------------------------------------------
         // NO FALSE POSITIVES FROM 'hasRelevantActiveRules'
@@ -8,6 +8,9 @@ BSLS_IDENT_RCSID(ball_categorymanager_cpp,"$Id$ $CSID$")
 #include <ball_thresholdaggregate.h>
 
 #include <bdlb_bitutil.h>
+#include <bdlb_hashutil.h>
+
+#include <bslma_deallocatorproctor.h>
 
 #include <bslmt_lockguard.h>
 #include <bslmt_readlockguard.h>
@@ -18,9 +21,7 @@ BSLS_IDENT_RCSID(ball_categorymanager_cpp,"$Id$ $CSID$")
 #include <bsls_platform.h>
 
 #include <bsl_algorithm.h>
-#include <bsl_map.h>
-#include <bsl_utility.h>
-#include <bsl_vector.h>
+#include <bsl_cstring.h>
 
 // Note: on Windows -> WinDef.h:#define max(a,b) ...
 #if defined(BSLS_PLATFORM_CMP_MSVC) && defined(max)
@@ -47,15 +48,9 @@ class CategoryProctor {
     // This class facilitates exception neutrality by proctoring memory
     // management for 'Category' objects.
 
-    // PRIVATE TYPES
-    typedef bsl::vector<ball::Category *> CategoryVector;
-
     // DATA
     Category         *d_category_p;    // category object to delete on failure
 
-    CategoryVector   *d_categories_p;  // category collection to rollback on
-                                       // failure
-
     bslma::Allocator *d_allocator_p;   // allocator for the category object
 
   private:
@@ -72,15 +67,11 @@ class CategoryProctor {
         // destroyed and its footprint deallocated.
 
     ~CategoryProctor();
-        // Rollback the owned objects to their initial state on failure.
+        // Destroy the managed category, if any, and deallocate its footprint.
 
     // MANIPULATORS
-    void setCategories(CategoryVector *categories);
-        // Take ownership of the 'categories' object to roll it back on
-        // failure.
-
     void release();
-        // Release the ownership of all objects currently managed by this
+        // Release the ownership of the category currently managed by this
         // proctor.
 };
 
@@ -93,7 +84,6 @@ inline
 CategoryProctor::CategoryProctor(Category         *category,
                                  bslma::Allocator *allocator)
 : d_category_p(category)
-, d_categories_p(0)
 , d_allocator_p(allocator)
 {
 }
@@ -105,32 +95,155 @@ CategoryProctor::~CategoryProctor()
         d_category_p->~Category();
         d_allocator_p->deallocate(d_category_p);
     }
-
-    if (d_categories_p) {
-        d_categories_p->pop_back();
-    }
 }
 
 // MANIPULATORS
 inline
-void CategoryProctor::setCategories(CategoryVector *categories)
+void CategoryProctor::release()
 {
-    d_categories_p = categories;
+    d_category_p = 0;
 }
 
 inline
-void CategoryProctor::release()
+unsigned int hashName(const char *categoryName)
+    // Return the hash value of the specified 'categoryName'.
 {
-    d_category_p   = 0;
-    d_categories_p = 0;
+    return bdlb::HashUtil::hash1(
+                        categoryName,
+                        static_cast<int>(bsl::strlen(categoryName)));
 }
 
 }  // close unnamed namespace
 
-// For convenience, 'CategoryMap' defines the type of a 'CategoryManager' data
-// member.
+                    // ====================================
+                    // struct CategoryManager::CategoryIndex
+                    // ====================================
+
+struct CategoryManager::CategoryIndex {
+    // This 'struct' is an open-addressed hash table, using linear probing, of
+    // the categories in a category manager, keyed by category name.  A slot,
+    // once set, is never changed and the table is never more than half full,
+    // so a search, which ends at the first empty slot, may proceed without
+    // locking concurrently with the (single) thread adding to the table.  A
+    // table that would become more than half full is replaced by a copy
+    // having twice the capacity; the replaced table is retained, and reached
+    // through 'd_next_p', since searches may still be in progress on it.
+
+    // DATA
+    bsls::AtomicPointer<Category> *d_slots_p;   // 'd_capacity' slots, each
+                                                // null or a category
+
+    int                            d_capacity;  // number of slots (a power of
+                                                // 2)
+
+    int                            d_numUsed;   // number of non-null slots
 
-typedef bsl::map<const char *, int> CategoryMap;
+    CategoryIndex                 *d_next_p;    // replaced (smaller) index
+
+    // CLASS METHODS
+    static CategoryIndex *create(int               capacity,
+                                 bslma::Allocator *allocator);
+        // Return the address of a new, empty index having the specified
+        // 'capacity', allocated using the specified 'allocator'.  The
+        // behavior is undefined unless 'capacity' is a power of 2.
+
+    static void destroy(CategoryIndex *index, bslma::Allocator *allocator);
+        // Destroy the specified 'index', and each index it replaced, and
+        // deallocate their memory using the specified 'allocator'.
+
+    // MANIPULATORS
+    void insert(Category *category);
+        // Add the specified 'category' to this index.  The behavior is
+        // undefined unless '2 * (d_numUsed + 1) <= d_capacity' and no
+        // category having the name of 'category' is in this index.
+
+    // ACCESSORS
+    Category *find(const char *categoryName, unsigned int hash) const;
+        // Return the address of the category having the specified
+        // 'categoryName', whose hash value is the specified 'hash', in this
+        // index, or 0 if there is no such category.
+};
+
+                    // ------------------------------------
+                    // struct CategoryManager::CategoryIndex
+                    // ------------------------------------
+
+// CLASS METHODS
+CategoryManager::CategoryIndex *
+CategoryManager::CategoryIndex::create(int               capacity,
+                                       bslma::Allocator *allocator)
+{
+    BSLS_ASSERT(0 < capacity);
+    BSLS_ASSERT(0 == (capacity & (capacity - 1)));
+
+    CategoryIndex *index = static_cast<CategoryIndex *>(
+                                   allocator->allocate(sizeof(CategoryIndex)));
+
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(index, allocator);
+
+    index->d_slots_p = static_cast<bsls::AtomicPointer<Category> *>(
+                  allocator->allocate(capacity *
+                                      sizeof(bsls::AtomicPointer<Category>)));
+    for (int i = 0; i < capacity; ++i) {
+        new (index->d_slots_p + i) bsls::AtomicPointer<Category>();
+    }
+    index->d_capacity = capacity;
+    index->d_numUsed  = 0;
+    index->d_next_p   = 0;
+
+    proctor.release();
+    return index;
+}
+
+void CategoryManager::CategoryIndex::destroy(CategoryIndex    *index,
+                                             bslma::Allocator *allocator)
+{
+    while (index) {
+        CategoryIndex *next = index->d_next_p;
+
+        allocator->deallocate(index->d_slots_p);
+        allocator->deallocate(index);
+
+        index = next;
+    }
+}
+
+// MANIPULATORS
+void CategoryManager::CategoryIndex::insert(Category *category)
+{
+    BSLS_ASSERT(2 * (d_numUsed + 1) <= d_capacity);
+
+    const unsigned int mask = d_capacity - 1;
+
+    unsigned int i = hashName(category->categoryName()) & mask;
+    while (d_slots_p[i].loadRelaxed()) {
+        i = (i + 1) & mask;
+    }
+
+    // Publish 'category', fully constructed, to concurrent searches.
+
+    d_slots_p[i].storeRelease(category);
+    ++d_numUsed;
+}
+
+// ACCESSORS
+Category *
+CategoryManager::CategoryIndex::find(const char   *categoryName,
+                                     unsigned int  hash) const
+{
+    const unsigned int mask = d_capacity - 1;
+
+    for (unsigned int i = hash & mask; ; i = (i + 1) & mask) {
+        Category *category = d_slots_p[i].loadAcquire();
+
+        if (!category) {
+            return 0;                                                 // RETURN
+        }
+        if (0 == bsl::strcmp(category->categoryName(), categoryName)) {
+            return category;                                          // RETURN
+        }
+    }
+}
 
                     // ---------------------
                     // class CategoryManager
@@ -143,7 +256,9 @@ Category *CategoryManager::addNewCategory(const char *categoryName,
                                           int         triggerLevel,
                                           int         triggerAllLevel)
 {
-    // Create a new category and add it to the category registry.
+    // Create a new category and add it to the category registry.  Readers
+    // do not lock, so every allocation is made before the registry is
+    // modified, and each modification is published with release semantics.
 
     Category *category = new (*d_allocator_p) Category(categoryName,
                                                        recordLevel,
@@ -153,25 +268,73 @@ Category *CategoryManager::addNewCategory(const char *categoryName,
                                                        d_allocator_p);
     CategoryProctor proctor(category, d_allocator_p);  // rollback on exception
 
-    d_categories.push_back(category);
-    proctor.setCategories(&d_categories);
+    const int numCategories = d_numCategories.loadRelaxed();
+
+    // Allocate the chunk that will hold 'category', if needed.
+
+    const int chunk = 31 - bdlb::BitUtil::numLeadingUnsetBits(
+           static_cast<bsl::uint32_t>(numCategories / k_FIRST_CHUNK_SIZE + 1));
+
+    BSLS_ASSERT(chunk < k_MAX_NUM_CHUNKS);
+
+    if (!d_chunks[chunk]) {
+        d_chunks[chunk] = static_cast<Category **>(d_allocator_p->allocate(
+                    (k_FIRST_CHUNK_SIZE << chunk) * sizeof(Category *)));
+    }
+
+    // Replace the index if it would become more than half full.  A search
+    // concurrently using the old index finds every category added so far.
+
+    CategoryIndex *index = d_index.loadRelaxed();
+
+    if (!index || 2 * (index->d_numUsed + 1) > index->d_capacity) {
+        const int capacity = index ? 2 * index->d_capacity
+                                   : 2 * k_FIRST_CHUNK_SIZE;
+
+        CategoryIndex *newIndex = CategoryIndex::create(capacity,
+                                                        d_allocator_p);
 
-    d_registry[category->categoryName()] =
-                                     static_cast<int>(d_categories.size() - 1);
+        for (int i = 0; i < numCategories; ++i) {
+            newIndex->insert(categoryAt(i));
+        }
+        newIndex->d_next_p = index;
+
+        d_index.storeRelease(newIndex);
+        index = newIndex;
+    }
+
+    d_chunks[chunk][numCategories - k_FIRST_CHUNK_SIZE * ((1 << chunk) - 1)] =
+                                                                      category;
+    d_numCategories.storeRelease(numCategories + 1);
+
+    index->insert(category);
     proctor.release();
 
     return category;
 }
 
+// PRIVATE ACCESSORS
+Category *CategoryManager::findCategory(const char *categoryName) const
+{
+    BSLS_ASSERT(categoryName);
+
+    const CategoryIndex *index = d_index.loadAcquire();
+
+    return index ? index->find(categoryName, hashName(categoryName)) : 0;
+}
+
 // CREATORS
 CategoryManager::CategoryManager(bslma::Allocator *basicAllocator)
-: d_registry(bdlb::CStringLess(), basicAllocator)
+: d_index(0)
 , d_ruleSetSequenceNumber(
              AtomicOps::incrementInt64Nv(&categoryManagerSequenceNumber) << 48)
 , d_ruleSet(bslma::Default::allocator(basicAllocator))
-, d_categories(basicAllocator)
+, d_numCategories(0)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
+    for (int i = 0; i < k_MAX_NUM_CHUNKS; ++i) {
+        d_chunks[i] = 0;
+    }
 }
 
 CategoryManager::~CategoryManager()
@@ -179,9 +342,17 @@ CategoryManager::~CategoryManager()
     BSLS_ASSERT(d_allocator_p);
 
     for (int i = 0; i < length(); ++i) {
-        d_categories[i]->~Category();
-        d_allocator_p->deallocate(d_categories[i]);
+        Category *category = categoryAt(i);
+
+        category->~Category();
+        d_allocator_p->deallocate(category);
+    }
+
+    for (int i = 0; i < k_MAX_NUM_CHUNKS; ++i) {
+        d_allocator_p->deallocate(d_chunks[i]);
     }
+
+    CategoryIndex::destroy(d_index.loadRelaxed(), d_allocator_p);
 }
 
 // MANIPULATORS
@@ -218,9 +389,7 @@ Category *CategoryManager::addCategory(CategoryHolder *categoryHolder,
     bslmt::WriteLockGuard<bslmt::ReaderWriterLock> registryGuard(
                                                               &d_registryLock);
 
-    CategoryMap::const_iterator iter = d_registry.find(categoryName);
-
-    if (iter != d_registry.end()) {
+    if (findCategory(categoryName)) {
         return 0;                                                     // RETURN
     }
     else {
@@ -269,30 +438,24 @@ Category *CategoryManager::addCategory(CategoryHolder *categoryHolder,
 
 Category *CategoryManager::lookupCategory(const char *categoryName)
 {
-    bslmt::ReadLockGuard<bslmt::ReaderWriterLock> registryGuard(
-                                                              &d_registryLock);
-
-    CategoryMap::const_iterator iter = d_registry.find(categoryName);
-    return iter != d_registry.end() ? d_categories[iter->second] : 0;
+    return findCategory(categoryName);
 }
 
 Category *CategoryManager::lookupCategory(CategoryHolder *categoryHolder,
                                           const char     *categoryName)
 {
-    d_registryLock.lockReadReserveWrite();
+    Category *category = findCategory(categoryName);
 
-    bslmt::WriteLockGuard<bslmt::ReaderWriterLock> registryGuard(
-                                                           &d_registryLock, 1);
+    if (category && categoryHolder && !categoryHolder->category()) {
+        // Linking modifies the list of holders of 'category', which is
+        // serialized with the other modifications of the registry.  Note
+        // that 'linkCategoryHolder' has no effect if another thread linked
+        // 'categoryHolder' in the meantime.
 
-    Category *category = 0;
-    CategoryMap::const_iterator iter = d_registry.find(categoryName);
-    if (iter != d_registry.end()) {
-        category = d_categories[iter->second];
-        if (categoryHolder && !categoryHolder->category()) {
-            d_registryLock.upgradeToWriteLock();
-            CategoryManagerImpUtil::linkCategoryHolder(category,
-                                                       categoryHolder);
-        }
+        bslmt::WriteLockGuard<bslmt::ReaderWriterLock> registryGuard(
+                                                              &d_registryLock);
+
+        CategoryManagerImpUtil::linkCategoryHolder(category, categoryHolder);
     }
 
     return category;
@@ -305,7 +468,7 @@ void CategoryManager::resetCategoryHolders()
 
     const int numCategories = length();
     for (int i = 0; i < numCategories; ++i) {
-        CategoryManagerImpUtil::resetCategoryHolders(d_categories[i]);
+        CategoryManagerImpUtil::resetCategoryHolders(categoryAt(i));
     }
 }
 
@@ -327,9 +490,8 @@ Category *CategoryManager::setThresholdLevels(const char *categoryName,
     d_registryLock.lockReadReserveWrite();
     bslmt::WriteLockGuard<bslmt::ReaderWriterLock> registryGuard(
                                                            &d_registryLock, 1);
-    CategoryMap::iterator iter = d_registry.find(categoryName);
-    if (iter != d_registry.end()) {
-        Category *category = d_categories[iter->second];
+    Category *category = findCategory(categoryName);
+    if (category) {
         category->setLevels(recordLevel,
                             passLevel,
                             triggerLevel,
@@ -340,11 +502,11 @@ Category *CategoryManager::setThresholdLevels(const char *categoryName,
     else {
         d_registryLock.upgradeToWriteLock();
 
-        Category *category = addNewCategory(categoryName,
-                                            recordLevel,
-                                            passLevel,
-                                            triggerLevel,
-                                            triggerAllLevel);
+        category = addNewCategory(categoryName,
+                                  recordLevel,
+                                  passLevel,
+                                  triggerLevel,
+                                  triggerAllLevel);
         registryGuard.release();
         d_registryLock.unlock();
         bslmt::LockGuard<bslmt::Mutex> ruleSetGuard(&d_ruleSetMutex);
@@ -386,7 +548,7 @@ int CategoryManager::addRule(const Rule& value)
     const Rule *rule = d_ruleSet.getRuleById(ruleId);
 
     for (int i = 0; i < length(); ++i) {
-        Category *category = d_categories[i];
+        Category *category = categoryAt(i);
         if (rule->isMatch(category->categoryName())) {
             CategoryManagerImpUtil::enableRule(category, ruleId);
             int threshold = ThresholdAggregate::maxLevel(
@@ -429,7 +591,7 @@ int CategoryManager::removeRule(const Rule& value)
     const Rule *rule = d_ruleSet.getRuleById(ruleId);
 
     for (int i = 0; i < length(); ++i) {
-        Category *category = d_categories[i];
+        Category *category = categoryAt(i);
         if (rule->isMatch(category->categoryName())) {
             CategoryManagerImpUtil::disableRule(category, ruleId);
             CategoryManagerImpUtil::setRuleThreshold(category, 0);
@@ -481,10 +643,11 @@ void CategoryManager::removeAllRules()
     ++d_ruleSetSequenceNumber;
 
     for (int i = 0; i < length(); ++i) {
-        if (d_categories[i]->relevantRuleMask()) {
-            CategoryManagerImpUtil::setRelevantRuleMask(d_categories[i], 0);
-            CategoryManagerImpUtil::setRuleThreshold(d_categories[i], 0);
-            CategoryManagerImpUtil::updateThresholdForHolders(d_categories[i]);
+        Category *category = categoryAt(i);
+        if (category->relevantRuleMask()) {
+            CategoryManagerImpUtil::setRelevantRuleMask(category, 0);
+            CategoryManagerImpUtil::setRuleThreshold(category, 0);
+            CategoryManagerImpUtil::updateThresholdForHolders(category);
         }
     }
     d_ruleSet.removeAllRules();
@@ -493,11 +656,7 @@ void CategoryManager::removeAllRules()
 // ACCESSORS
 const Category *CategoryManager::lookupCategory(const char *categoryName) const
 {
-    bslmt::ReadLockGuard<bslmt::ReaderWriterLock> registryGuard(
-                                                              &d_registryLock);
-
-    CategoryMap::const_iterator iter = d_registry.find(categoryName);
-    return iter != d_registry.end() ? d_categories[iter->second] : 0;
+    return findCategory(categoryName);
 }
 
 }  // close package namespace
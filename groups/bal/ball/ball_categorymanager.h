@@ -48,6 +48,13 @@ BSLS_IDENT("$Id: $")
 // same instance can be safely invoked from any thread concurrently with any
 // other operation.
 //
+// Looking up an existing category by name ('lookupCategory'), and accessing
+// categories by index ('operator[]' and 'length'), do not acquire a lock:
+// categories are never removed from the registry, so the name index and the
+// storage of categories are only ever added to, and each addition is
+// published atomically.  Adding a category, and linking a category holder to
+// a category, are serialized by an internal lock.
+//
 ///Usage
 ///-----
 // The code fragments in the following example illustrate some basic operations
@@ -160,7 +167,7 @@ BSLS_IDENT("$Id: $")
 #include <ball_ruleset.h>
 #include <ball_thresholdaggregate.h>
 
-#include <bdlb_cstringless.h>
+#include <bdlb_bitutil.h>
 
 #include <bslma_allocator.h>
 #include <bslma_default.h>
@@ -169,9 +176,10 @@ BSLS_IDENT("$Id: $")
 #include <bslmt_readlockguard.h>
 #include <bslmt_readerwriterlock.h>
 
+#include <bsls_atomic.h>
 #include <bsls_types.h>
 
-#include <bsl_map.h>
+#include <bsl_cstdint.h>
 #include <bsl_new.h>
 #include <bsl_string.h>
 #include <bsl_vector.h>
@@ -189,11 +197,25 @@ class CategoryManager {
     // threshold levels of existing categories may be accessed and modified
     // directly.
 
+    // PRIVATE TYPES
+    enum {
+        k_FIRST_CHUNK_SIZE = 32,  // number of categories in 'd_chunks[0]'
+
+        k_MAX_NUM_CHUNKS   = 26   // number of chunks needed to hold 'INT_MAX'
+                                  // categories
+    };
+
+    struct CategoryIndex;
+        // This 'struct' (defined in the implementation) is a hash table
+        // mapping category names to categories that may be searched without
+        // locking while it is added to.
+
     // DATA
-    bsl::map<const char *, int, bdlb::CStringLess>
-                                     d_registry;      // mapping names to
-                                                      // indices in
-                                                      // 'd_categories'
+    bsls::AtomicPointer<CategoryIndex>
+                                     d_index;         // mapping names to
+                                                      // categories (owned),
+                                                      // linked to the smaller
+                                                      // indexes it replaced
 
     volatile bsls::Types::Int64      d_ruleSetSequenceNumber;
                                                       // sequence number that
@@ -207,11 +229,19 @@ class CategoryManager {
     bslmt::Mutex                     d_ruleSetMutex;  // serialize access to
                                                       // 'd_ruleset'
 
-    bsl::vector<Category *>          d_categories;    // providing random
-                                                      // access to categories
+    Category                       **d_chunks[k_MAX_NUM_CHUNKS];
+                                                      // providing random
+                                                      // access to categories;
+                                                      // 'd_chunks[i]' holds
+                                                      // 'k_FIRST_CHUNK_SIZE <<
+                                                      // i' categories
+
+    bsls::AtomicInt                  d_numCategories; // number of categories
+                                                      // in 'd_chunks'
 
-    mutable bslmt::ReaderWriterLock  d_registryLock;  // ensuring MT-safety of
-                                                      // category map
+    mutable bslmt::ReaderWriterLock  d_registryLock;  // serializing additions
+                                                      // to the registry and
+                                                      // linking of holders
 
     bslma::Allocator                *d_allocator_p;   // memory allocator
                                                       // (held, not owned)
@@ -237,6 +267,17 @@ class CategoryManager {
         // that the category registry should be properly synchronized before
         // calling this method.
 
+    // PRIVATE ACCESSORS
+    Category *categoryAt(int index) const;
+        // Return the address of the modifiable category at the specified
+        // 'index' in the registry of this category manager.  The behavior is
+        // undefined unless '0 <= index < length()'.
+
+    Category *findCategory(const char *categoryName) const;
+        // Return the address of the modifiable category having the specified
+        // 'categoryName' in the registry of this category manager, or 0 if no
+        // such category exists.  Note that this method does not lock.
+
   public:
     // CREATORS
     explicit CategoryManager(bslma::Allocator *basicAllocator = 0);
@@ -532,12 +573,25 @@ class CategoryManagerManip {
                         // class CategoryManager
                         // ---------------------
 
+// PRIVATE ACCESSORS
+inline
+Category *CategoryManager::categoryAt(int index) const
+{
+    // 'd_chunks[i]' holds the categories having indices in the range
+    // '[k_FIRST_CHUNK_SIZE * (2^i - 1) .. k_FIRST_CHUNK_SIZE * (2^(i+1) - 1))'
+    // (using '^' for exponentiation).
+
+    const int chunk = 31 - bdlb::BitUtil::numLeadingUnsetBits(
+                   static_cast<bsl::uint32_t>(index / k_FIRST_CHUNK_SIZE + 1));
+
+    return d_chunks[chunk][index - k_FIRST_CHUNK_SIZE * ((1 << chunk) - 1)];
+}
+
 // MANIPULATORS
 inline
 Category& CategoryManager::operator[](int index)
 {
-    bslmt::ReadLockGuard<bslmt::ReaderWriterLock> guard(&d_registryLock);
-    return *d_categories[index];
+    return *categoryAt(index);
 }
 
 inline
@@ -550,10 +604,10 @@ template <class CATEGORY_VISITOR>
 void CategoryManager::visitCategories(const CATEGORY_VISITOR& visitor)
 {
     bslmt::ReadLockGuard<bslmt::ReaderWriterLock> guard(&d_registryLock);
-    for (bsl::vector<Category *>::iterator it = d_categories.begin();
-         it != d_categories.end();
-         ++it) {
-        visitor(*it);
+
+    const int numCategories = length();
+    for (int i = 0; i < numCategories; ++i) {
+        visitor(categoryAt(i));
     }
 }
 
@@ -561,15 +615,13 @@ void CategoryManager::visitCategories(const CATEGORY_VISITOR& visitor)
 inline
 int CategoryManager::length() const
 {
-    bslmt::ReadLockGuard<bslmt::ReaderWriterLock> guard(&d_registryLock);
-    return static_cast<int>(d_categories.size());
+    return d_numCategories.loadAcquire();
 }
 
 inline
 const Category& CategoryManager::operator[](int index) const
 {
-    bslmt::ReadLockGuard<bslmt::ReaderWriterLock> guard(&d_registryLock);
-    return *d_categories[index];
+    return *categoryAt(index);
 }
 
 inline
@@ -588,10 +640,10 @@ template <class CATEGORY_VISITOR>
 void CategoryManager::visitCategories(const CATEGORY_VISITOR& visitor) const
 {
     bslmt::ReadLockGuard<bslmt::ReaderWriterLock> guard(&d_registryLock);
-    for (bsl::vector<Category *>::const_iterator it = d_categories.begin();
-         it != d_categories.end();
-         ++it) {
-        visitor(*it);
+
+    const int numCategories = length();
+    for (int i = 0; i < numCategories; ++i) {
+        visitor(static_cast<const Category *>(categoryAt(i)));
     }
 }
 
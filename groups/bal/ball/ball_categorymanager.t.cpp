@@ -132,6 +132,7 @@ using namespace bsl;
 // [13] CONCURRENCY TEST: RULES
 // [14] UNIQUENESS OF INITIAL RULE SET SEQUENCE NUMBER
 // [15] USAGE EXAMPLE
+// [18] CONCURRENCY TEST: LOOKUP
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -596,6 +597,87 @@ extern "C" void *seqNumUniquenessThread(void *args)
 
 }  // close namespace BALL_CATEGORYMANAGER_UNIQUENESS_OF_SEQUENCE_NUMBERS
 
+//                         CASE 18 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace BALL_CATEGORYMANAGER_CONCURRENT_LOOKUP {
+
+enum {
+    k_NUM_CATEGORIES = 5000,  // spans many chunks and index replacements
+    k_NUM_READERS    = 4,
+    k_NUM_HOLDERS    = 8      // per reader
+};
+
+struct ThreadArgs {
+    Obj    *d_cm_p;       // category manager under test
+    Holder *d_holders_p;  // 'k_NUM_HOLDERS' holders, outliving 'd_cm_p'
+};
+
+void makeName(char *buffer, char prefix, int index)
+    // Load into the specified 'buffer' the category name formed from the
+    // specified 'prefix' and 'index'.
+{
+    bsl::sprintf(buffer, "%c%d", prefix, index);
+}
+
+extern "C" void *addCategoriesThread(void *args)
+{
+    Obj *mX = reinterpret_cast<Obj *>(args);
+
+    char name[32];
+    for (int i = 0; i < k_NUM_CATEGORIES; ++i) {
+        makeName(name, 'C', i);
+        ASSERTV(i, 0 != mX->addCategory(name, i % 256, 0, 0, 0));
+    }
+    return 0;
+}
+
+extern "C" void *lookupCategoriesThread(void *args)
+{
+    ThreadArgs *threadArgs = reinterpret_cast<ThreadArgs *>(args);
+
+    Obj&       mX      = *threadArgs->d_cm_p;
+    const Obj& X       = mX;
+    Holder    *holders = threadArgs->d_holders_p;
+
+    char name[32];
+    int  numCategories = 0;
+    int  iteration     = 0;
+
+    while (numCategories < k_NUM_CATEGORIES) {
+        numCategories = X.length();
+
+        // Every category counted by 'length' is accessible by index and by
+        // name, and has its final name and levels.
+
+        const int index = numCategories ? (iteration * 7919) % numCategories
+                                        : 0;
+        if (numCategories) {
+            makeName(name, 'C', index);
+
+            const Entry *category = X.lookupCategory(name);
+            ASSERTV(index, category);
+            ASSERTV(index, &X[index] == category);
+            ASSERTV(index, 0 == bsl::strcmp(name, X[index].categoryName()));
+            ASSERTV(index, index % 256 == X[index].recordLevel());
+
+            Holder& holder = holders[iteration % k_NUM_HOLDERS];
+            if (!holder.category()) {
+                ASSERTV(index, category == mX.lookupCategory(&holder, name));
+                ASSERTV(index, category == holder.category());
+            }
+        }
+
+        makeName(name, 'D', index);
+        ASSERTV(index, 0 == X.lookupCategory(name));
+
+        ++iteration;
+    }
+    return 0;
+}
+
+}  // close namespace BALL_CATEGORYMANAGER_CONCURRENT_LOOKUP
+
 //=============================================================================
 //                                 MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -613,6 +695,96 @@ int main(int argc, char *argv[])
     bslma::TestAllocator testAllocator(veryVeryVerbose);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 18: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST: LOOKUP
+        //
+        // Concerns:
+        //: 1 Categories may be looked up by name, and accessed by index,
+        //:   concurrently with the addition of categories, and every category
+        //:   counted by 'length' is found with its final name and levels.
+        //:
+        //: 2 A name that was never added is not found.
+        //:
+        //: 3 Category holders may be linked by 'lookupCategory' concurrently
+        //:   with the addition of categories.
+        //:
+        //: 4 Addresses of categories are stable, and the indices of categories
+        //:   are the order in which they were added.
+        //:
+        //: 5 All memory is obtained from the supplied allocator, and is
+        //:   released on destruction.
+        //
+        // Plan:
+        //: 1 Using a test allocator, run one thread adding a large number of
+        //:   categories, so that the storage and the name index grow many
+        //:   times, concurrently with several threads that repeatedly look up
+        //:   categories counted by 'length' by name and by index, link
+        //:   category holders, and look up names that are never added.
+        //:   (C-1..3)
+        //:
+        //: 2 After joining the threads, verify each category by index and
+        //:   name.  (C-4)
+        //:
+        //: 3 Verify that the default allocator is not used, and that the test
+        //:   allocator has no memory in use after the category manager is
+        //:   destroyed.  (C-5)
+        //
+        // Testing:
+        //   CONCURRENCY TEST: LOOKUP
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CONCURRENCY TEST: LOOKUP"
+                          << endl << "========================"
+                          << endl;
+
+        using namespace BALL_CATEGORYMANAGER_CONCURRENT_LOOKUP;
+
+        bslma::TestAllocator         da(veryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        Holder holders[k_NUM_READERS][k_NUM_HOLDERS];
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            bslmt::ThreadUtil::Handle writer;
+            bslmt::ThreadUtil::Handle readers[k_NUM_READERS];
+            ThreadArgs                threadArgs[k_NUM_READERS];
+
+            for (int i = 0; i < k_NUM_READERS; ++i) {
+                threadArgs[i].d_cm_p      = &mX;
+                threadArgs[i].d_holders_p = holders[i];
+
+                bslmt::ThreadUtil::create(
+                                     &readers[i],
+                                     lookupCategoriesThread,
+                                     reinterpret_cast<void *>(&threadArgs[i]));
+            }
+            bslmt::ThreadUtil::create(&writer,
+                                      addCategoriesThread,
+                                      reinterpret_cast<void *>(&mX));
+
+            bslmt::ThreadUtil::join(writer, 0);
+            for (int i = 0; i < k_NUM_READERS; ++i) {
+                bslmt::ThreadUtil::join(readers[i], 0);
+            }
+
+            ASSERT(k_NUM_CATEGORIES == X.length());
+
+            char name[32];
+            for (int i = 0; i < k_NUM_CATEGORIES; ++i) {
+                makeName(name, 'C', i);
+                ASSERTV(i, &X[i] == X.lookupCategory(name));
+                ASSERTV(i, 0 == bsl::strcmp(name, X[i].categoryName()));
+            }
+
+            mX.resetCategoryHolders();
+        }
+        ASSERTV(ta.numBytesInUse(), 0 == ta.numBytesInUse());
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
 #ifndef BDE_OMIT_INTERNAL_DEPRECATED
       case 17: {
         // --------------------------------------------------------------------
@@ -16,9 +16,11 @@ BSLS_IDENT_RCSID(ball_fileobserver2_cpp,"$Id$ $CSID$")
 #include <ball_recordstringformatter.h>       // for testing only
 #include <ball_streamobserver.h>              // for testing only
 
+#include <bdlf_bind.h>
 #include <bdlf_memfn.h>
 
 #include <bdls_filesystemutil.h>
+#include <bdls_pathutil.h>
 #include <bdls_processutil.h>
 
 #include <bdlt_currenttime.h>
@@ -27,7 +29,10 @@ BSLS_IDENT_RCSID(ball_fileobserver2_cpp,"$Id$ $CSID$")
 #include <bdlt_localtimeoffset.h>
 #include <bdlt_time.h>
 
+#include <bslma_default.h>
+
 #include <bslmt_lockguard.h>
+#include <bslmt_threadattributes.h>
 
 #include <bsls_assert.h>
 #include <bsls_log.h>
@@ -223,6 +228,34 @@ static void getLogFileName(bsl::string    *logFileName,
     *logFileName = os.str();
 }
 
+static void getStandbyFileName(bsl::string        *standbyFileName,
+                               const bsl::string&  logFileName)
+    // Load, into the specified 'standbyFileName', the name of the standby log
+    // file for the log file having the specified 'logFileName', i.e., that of
+    // a hidden file in the same directory, or the empty string if
+    // 'logFileName' does not name a file.
+{
+    BSLS_ASSERT(standbyFileName);
+
+    bsl::string leaf(standbyFileName->get_allocator());
+
+    if (0 != bdls::PathUtil::getLeaf(&leaf, logFileName)
+     || 0 != bdls::PathUtil::getDirname(standbyFileName, logFileName)) {
+        standbyFileName->clear();
+        return;                                                       // RETURN
+    }
+
+    leaf.insert(leaf.begin(), '.');
+    leaf += ".standby";
+
+    if (standbyFileName->empty()) {
+        *standbyFileName = leaf;
+    }
+    else {
+        bdls::PathUtil::appendRaw(standbyFileName, leaf.c_str());
+    }
+}
+
 static bool hasEscapePattern(const char *logFilePattern)
     // Return 'true' if the specified 'logFilePattern' contains a recognized
     // '%'-escape sequence, and false otherwise.  The recognized escape
@@ -399,6 +432,51 @@ static bdlt::Datetime computeNextRotationTime(
                           // -------------------
 
 // PRIVATE MANIPULATORS
+void FileObserver2::completeRotation(
+                       bdls::FilesystemUtil::FileDescriptor oldLogFile,
+                       int                                  rotationStatus,
+                       const bsl::string&                   rotatedLogFileName)
+{
+    if (0 != bdls::FilesystemUtil::close(oldLogFile)) {
+        char errorBuffer[k_ERROR_BUFFER_SIZE];
+
+        snprintf(errorBuffer,
+                 sizeof errorBuffer,
+                 "Unable to close old log file: %s.",
+                 rotatedLogFileName.c_str());
+        bsls::Log::platformDefaultMessageHandler(bsls::LogSeverity::e_WARN,
+                                                 __FILE__,
+                                                 __LINE__,
+                                                 errorBuffer);
+
+        // Report the failure as 'rotateFile' does when it closes the file.
+
+        if (k_ROTATE_SUCCESS == rotationStatus) {
+            rotationStatus = k_ROTATE_RENAME_ERROR;
+        }
+        else if (k_ROTATE_NEW_LOG_ERROR == rotationStatus) {
+            rotationStatus = k_ROTATE_RENAME_AND_NEW_LOG_ERROR;
+        }
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_rotationCbMutex);
+
+    if (d_onRotationCb) {
+        d_onRotationCb(rotationStatus, rotatedLogFileName);
+    }
+}
+
+void FileObserver2::discardStandbyFile()
+{
+    if (bdls::FilesystemUtil::k_INVALID_FD != d_standbyFd) {
+        bdls::FilesystemUtil::close(d_standbyFd);
+        bdls::FilesystemUtil::remove(d_standbyFileName);
+
+        d_standbyFd = bdls::FilesystemUtil::k_INVALID_FD;
+    }
+    d_standbyFileName.clear();
+}
+
 void FileObserver2::logRecordDefault(bsl::ostream& stream,
                                      const Record& record)
 
@@ -454,6 +532,20 @@ void FileObserver2::logRecordDefault(bsl::ostream& stream,
     stream.flush();
 }
 
+void FileObserver2::requestStandbyFile()
+{
+    bsl::string standbyFileName(d_allocator_p);
+    getStandbyFileName(&standbyFileName, d_logFileName);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_rotationMutex);
+
+    if (standbyFileName != d_standbyFileName) {
+        discardStandbyFile();
+        d_standbyFileName.swap(standbyFileName);
+    }
+    d_rotationCondition.signal();
+}
+
 int FileObserver2::rotateFile(bsl::string *rotatedLogFileName)
 {
     BSLS_ASSERT(rotatedLogFileName);
@@ -466,7 +558,17 @@ int FileObserver2::rotateFile(bsl::string *rotatedLogFileName)
 
     int returnStatus = k_ROTATE_SUCCESS;
 
-    if (0 != d_logStreamBuf.clear()) {
+    typedef bdls::FilesystemUtil FileUtil;
+
+    FileUtil::FileDescriptor oldLogFile = FileUtil::k_INVALID_FD;
+
+    if (d_backgroundRotationFlag) {
+        // Flush the old log file, and leave closing it to the rotation thread.
+
+        oldLogFile = d_logStreamBuf.fileDescriptor();
+        d_logStreamBuf.release();
+    }
+    else if (0 != d_logStreamBuf.clear()) {
         char errorBuffer[k_ERROR_BUFFER_SIZE];
 
         snprintf(errorBuffer,
@@ -527,7 +629,8 @@ int FileObserver2::rotateFile(bsl::string *rotatedLogFileName)
                                                   d_logFileTimestampUtc);
     }
 
-    if (0 != openLogFile(&d_logOutStream, d_logFileName.c_str())) {
+    if ((!d_backgroundRotationFlag || 0 != switchToStandbyFile())
+     && 0 != openLogFile(&d_logOutStream, d_logFileName.c_str())) {
         char errorBuffer[k_ERROR_BUFFER_SIZE];
 
         snprintf(errorBuffer,
@@ -539,9 +642,26 @@ int FileObserver2::rotateFile(bsl::string *rotatedLogFileName)
                                                  __FILE__,
                                                  __LINE__,
                                                  errorBuffer);
-        return k_ROTATE_SUCCESS != returnStatus
-               ? k_ROTATE_RENAME_AND_NEW_LOG_ERROR
-               : k_ROTATE_NEW_LOG_ERROR;                              // RETURN
+        returnStatus = k_ROTATE_SUCCESS != returnStatus
+                       ? k_ROTATE_RENAME_AND_NEW_LOG_ERROR
+                       : k_ROTATE_NEW_LOG_ERROR;
+    }
+
+    if (d_backgroundRotationFlag) {
+        if (d_logStreamBuf.isOpened()) {
+            requestStandbyFile();
+        }
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_rotationMutex);
+
+        d_rotationJobs.emplace_back(bdlf::BindUtil::bindS(
+                                        d_allocator_p,
+                                        &FileObserver2::completeRotation,
+                                        this,
+                                        oldLogFile,
+                                        returnStatus,
+                                        *rotatedLogFileName));
+        d_rotationCondition.signal();
     }
 
     return returnStatus;
@@ -577,6 +697,104 @@ int FileObserver2::rotateIfNecessary(bsl::string           *rotatedLogFileName,
     return 1;
 }
 
+void FileObserver2::rotationThreadEntryPoint()
+{
+    typedef bdls::FilesystemUtil FileUtil;
+
+    d_rotationThreadId.storeRelease(bslmt::ThreadUtil::selfIdAsUint64());
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_rotationMutex);
+
+    while (true) {
+        if (!d_rotationJobs.empty()) {
+            bsl::function<void()> job(bsl::allocator_arg, d_allocator_p);
+            job.swap(d_rotationJobs.front());
+            d_rotationJobs.pop_front();
+
+            bslmt::UnLockGuard<bslmt::Mutex> unlockGuard(&d_rotationMutex);
+            job();
+        }
+        else if (d_rotationThreadDone) {
+            break;
+        }
+        else if (!d_standbyFileName.empty()
+              && FileUtil::k_INVALID_FD == d_standbyFd) {
+            const bsl::string standbyFileName(d_standbyFileName,
+                                              d_allocator_p);
+
+            FileUtil::FileDescriptor fd;
+            {
+                bslmt::UnLockGuard<bslmt::Mutex> unlockGuard(&d_rotationMutex);
+                fd = FileUtil::open(standbyFileName.c_str(),
+                                    FileUtil::e_OPEN_OR_CREATE,
+                                    FileUtil::e_READ_APPEND,
+                                    FileUtil::e_TRUNCATE);
+            }
+
+            // The standby file may have been discarded, or requested for
+            // another log file, while it was being created.
+
+            if (standbyFileName != d_standbyFileName) {
+                if (FileUtil::k_INVALID_FD != fd) {
+                    FileUtil::close(fd);
+                    FileUtil::remove(standbyFileName);
+                }
+            }
+            else if (FileUtil::k_INVALID_FD == fd) {
+                // Do not retry until the next rotation requests a standby
+                // file.
+
+                d_standbyFileName.clear();
+            }
+            else {
+                d_standbyFd = fd;
+            }
+        }
+        else {
+            d_rotationCondition.wait(&d_rotationMutex);
+        }
+    }
+
+    d_rotationThreadId.storeRelease(0);
+}
+
+int FileObserver2::switchToStandbyFile()
+{
+    typedef bdls::FilesystemUtil FileUtil;
+
+    FileUtil::FileDescriptor fd = FileUtil::k_INVALID_FD;
+    bsl::string              standbyFileName(d_allocator_p);
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_rotationMutex);
+
+        if (FileUtil::k_INVALID_FD == d_standbyFd) {
+            return -1;                                                // RETURN
+        }
+
+        fd = d_standbyFd;
+        d_standbyFd = FileUtil::k_INVALID_FD;
+        standbyFileName.swap(d_standbyFileName);
+    }
+
+    // Never replace an existing file (e.g., one that could not be renamed on
+    // rotation) with the standby file.
+
+    if (FileUtil::exists(d_logFileName.c_str())
+     || 0 != bsl::rename(standbyFileName.c_str(), d_logFileName.c_str())) {
+        FileUtil::close(fd);
+        FileUtil::remove(standbyFileName);
+        return -1;                                                    // RETURN
+    }
+
+    if (0 != d_logStreamBuf.reset(fd, true, true, true)) {
+        FileUtil::close(fd);
+        return -1;                                                    // RETURN
+    }
+
+    d_logOutStream.clear();
+    return 0;
+}
+
 // CREATORS
 FileObserver2::FileObserver2(bslma::Allocator *basicAllocator)
 : d_logStreamBuf(bdls::FilesystemUtil::k_INVALID_FD,
@@ -598,17 +816,65 @@ FileObserver2::FileObserver2(bslma::Allocator *basicAllocator)
                  bsl::allocator<FileObserver2::OnFileRotationCallback>(
                                                                basicAllocator))
 , d_rotationCbMutex()
+, d_backgroundRotationFlag(false)
+, d_rotationThread(bslmt::ThreadUtil::invalidHandle())
+, d_rotationThreadMutex()
+, d_rotationJobs(basicAllocator)
+, d_rotationThreadDone(false)
+, d_rotationThreadId(0)
+, d_standbyFileName(basicAllocator)
+, d_standbyFd(bdls::FilesystemUtil::k_INVALID_FD)
+, d_rotationMutex()
+, d_rotationCondition()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
 
 FileObserver2::~FileObserver2()
 {
+    disableBackgroundRotation();
+
     if (d_logStreamBuf.isOpened()) {
         d_logStreamBuf.clear();
     }
 }
 
 // MANIPULATORS
+void FileObserver2::disableBackgroundRotation()
+{
+    if (bslmt::ThreadUtil::selfIdAsUint64() ==
+                                           d_rotationThreadId.loadAcquire()) {
+        // Called from the rotation callback.  The rotation thread cannot join
+        // itself, nor wait for 'd_rotationThreadMutex', which may be held by
+        // a thread joining it.
+
+        return;                                                       // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> threadGuard(&d_rotationThreadMutex);
+
+    if (bslmt::ThreadUtil::invalidHandle() == d_rotationThread) {
+        return;                                                       // RETURN
+    }
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_backgroundRotationFlag = false;
+    }
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_rotationMutex);
+        d_rotationThreadDone = true;
+        d_rotationCondition.signal();
+    }
+
+    bslmt::ThreadUtil::join(d_rotationThread);
+    d_rotationThread = bslmt::ThreadUtil::invalidHandle();
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_rotationMutex);
+    d_rotationThreadDone = false;
+    discardStandbyFile();
+}
+
 void FileObserver2::disableFileLogging()
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
@@ -616,6 +882,11 @@ void FileObserver2::disableFileLogging()
     if (d_logStreamBuf.isOpened()) {
         d_logStreamBuf.clear();
     }
+
+    if (d_backgroundRotationFlag) {
+        bslmt::LockGuard<bslmt::Mutex> rotationGuard(&d_rotationMutex);
+        discardStandbyFile();
+    }
 }
 
 void FileObserver2::disableLifetimeRotation()
@@ -644,6 +915,36 @@ void FileObserver2::disableTimeIntervalRotation()
     d_rotationInterval.setTotalSeconds(0);
 }
 
+int FileObserver2::enableBackgroundRotation()
+{
+    bslmt::LockGuard<bslmt::Mutex> threadGuard(&d_rotationThreadMutex);
+
+    if (bslmt::ThreadUtil::invalidHandle() != d_rotationThread) {
+        return 1;                                                     // RETURN
+    }
+
+    bslmt::ThreadAttributes attributes;
+    if (0 != bslmt::ThreadUtil::createWithAllocator(
+                   &d_rotationThread,
+                   attributes,
+                   bdlf::MemFnUtil::memFn(
+                                      &FileObserver2::rotationThreadEntryPoint,
+                                      this),
+                   d_allocator_p)) {
+        d_rotationThread = bslmt::ThreadUtil::invalidHandle();
+        return -1;                                                    // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    d_backgroundRotationFlag = true;
+
+    if (d_logStreamBuf.isOpened()) {
+        requestStandbyFile();
+    }
+    return 0;
+}
+
 int FileObserver2::enableFileLogging(const char *logFilenamePattern)
 {
     BSLS_ASSERT(logFilenamePattern);
@@ -676,7 +977,12 @@ int FileObserver2::enableFileLogging(const char *logFilenamePattern)
                                                   d_logFileTimestampUtc);
     }
 
-    return openLogFile(&d_logOutStream, d_logFileName.c_str());
+    const int rc = openLogFile(&d_logOutStream, d_logFileName.c_str());
+
+    if (0 == rc && d_backgroundRotationFlag) {
+        requestStandbyFile();
+    }
+    return rc;
 }
 
 int FileObserver2::enableFileLogging(const char *logFilenamePattern,
@@ -696,16 +1002,22 @@ int FileObserver2::enableFileLogging(const char *logFilenamePattern,
 void FileObserver2::forceRotation()
 {
     bsl::string rotatedLogFileName;
+    bool        notifyFlag;
     int         rotationStatus;
     {
         bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
         rotationStatus = rotateFile(&rotatedLogFileName);
+
+        // The rotation thread invokes the callback if background rotation is
+        // enabled.
+
+        notifyFlag = 0 >= rotationStatus && !d_backgroundRotationFlag;
     }
 
     // The file-rotation callback must be invoked without a lock on 'd_mutex'
     // to allow the callback to invoke other manipulators on this object.
 
-    if (0 >= rotationStatus) {
+    if (notifyFlag) {
         bslmt::LockGuard<bslmt::Mutex> guard(&d_rotationCbMutex);
         if (d_onRotationCb) {
             d_onRotationCb(rotationStatus, rotatedLogFileName);
@@ -722,12 +1034,14 @@ void FileObserver2::enablePublishInLocalTime()
 void FileObserver2::publish(const Record& record, const Context&)
 {
     bsl::string rotatedFileName;
+    bool        notifyFlag;
     int         rotationStatus;
 
     {
         bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
         rotationStatus = rotateIfNecessary(&rotatedFileName,
                                            record.fixedFields().timestamp());
+        notifyFlag = 0 >= rotationStatus && !d_backgroundRotationFlag;
 
         if (d_logStreamBuf.isOpened()) {
             d_logFileFunctor(d_logOutStream, record);
@@ -751,7 +1065,7 @@ void FileObserver2::publish(const Record& record, const Context&)
         }
     }
 
-    if (0 >= rotationStatus) {
+    if (notifyFlag) {
         bslmt::LockGuard<bslmt::Mutex> guard(&d_rotationCbMutex);
 
         if (d_onRotationCb) {
@@ -819,6 +1133,13 @@ void FileObserver2::setOnFileRotationCallback(
 }
 
 // ACCESSORS
+bool FileObserver2::isBackgroundRotationEnabled() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_backgroundRotationFlag;
+}
+
 bool FileObserver2::isFileLoggingEnabled() const
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
@@ -23,10 +23,12 @@ BSLS_IDENT("$Id: $")
 //               ( ball::FileObserver2 )
 //                `-------------------'
 //                         |              ctor
+//                         |              disableBackgroundRotation
 //                         |              disableFileLogging
 //                         |              disableTimeIntervalRotation
 //                         |              disableSizeRotation
 //                         |              disablePublishInLocalTime
+//                         |              enableBackgroundRotation
 //                         |              enableFileLogging
 //                         |              enablePublishInLocalTime
 //                         |              forceRotation
@@ -34,6 +36,7 @@ BSLS_IDENT("$Id: $")
 //                         |              rotateOnTimeInterval
 //                         |              setLogFileFunctor
 //                         |              setOnFileRotationCallback
+//                         |              isBackgroundRotationEnabled
 //                         |              isFileLoggingEnabled
 //                         |              isPublishInLocalTimeEnabled
 //                         |              rotationLifetime
@@ -80,6 +83,9 @@ BSLS_IDENT("$Id: $")
 // |             | disableTimeIntervalRotation |                              |
 // |             | setOnFileRotationCallback   |                              |
 // +-------------+-----------------------------+------------------------------+
+// | Background  | enableBackgroundRotation    | isBackgroundRotationEnabled  |
+// | Rotation    | disableBackgroundRotation   |                              |
+// +-------------+-----------------------------+------------------------------+
 //..
 // In general, a 'ball::FileObserver2' object can be dynamically configured
 // throughout its lifetime (in particular, before or after being registered
@@ -238,6 +244,56 @@ BSLS_IDENT("$Id: $")
 // in the filename.  In any case, logging resumes to a new, initially empty,
 // file.
 //
+///Background Rotation
+///- - - - - - - - - -
+// By default, a log file rotation is performed entirely by the thread that
+// triggers it (i.e., the thread calling 'publish' or 'forceRotation'), which
+// closes the old log file, creates the new one, and then invokes the rotation
+// callback, while other threads publishing records wait.  Closing a large file
+// (which may flush it to disk) and running a callback that, e.g., compresses
+// or uploads the rotated file, can take long enough to cause a noticeable
+// latency spike in the publishing threads.
+//
+// Calling 'enableBackgroundRotation' starts a rotation thread, owned by the
+// file observer, that takes over the slow parts of a rotation:
+//
+//: o The rotation thread creates the next log file ahead of time, as an empty
+//:   hidden file in the directory of the current log file (named after it,
+//:   with a leading '.' and a ".standby" suffix), so that a rotation only
+//:   needs to rename that file and switch the stream to it.  If the standby
+//:   file is not available (e.g., because the new log file is in another
+//:   directory), the new log file is opened as usual.
+//:
+//: o The old log file is closed by the rotation thread.
+//:
+//: o The rotation callback is invoked by the rotation thread, after the old
+//:   log file is closed, so it can process (e.g., compress) the rotated file
+//:   without delaying the publication of records.
+//
+// Rotated files are handed to the rotation thread in the order in which they
+// are rotated.  'disableBackgroundRotation' (and the destructor) waits for the
+// rotation thread to finish processing the files rotated so far and removes
+// the standby file, if any, and so must not be called from the rotation
+// callback (it has no effect if it is).  For example, the following compresses
+// each rotated file in the background:
+//..
+//  void compressLogFile(int status, const bsl::string& rotatedFileName)
+//      // Compress the log file having the specified 'rotatedFileName' if the
+//      // specified 'status' is 0.
+//  {
+//      if (0 == status) {
+//          // ... compress 'rotatedFileName' and remove it ...
+//      }
+//  }
+//
+//  ball::FileObserver2 observer;
+//
+//  observer.setOnFileRotationCallback(&compressLogFile);
+//  observer.enableBackgroundRotation();
+//  observer.rotateOnSize(1024 * 128);
+//  observer.enableFileLogging("/var/log/task/task.log");
+//..
+//
 ///Thread Safety
 ///-------------
 // All methods of 'ball::FileObserver2' are thread-safe, and can be called
@@ -306,6 +362,7 @@ BSLS_IDENT("$Id: $")
 #include <ball_severity.h>
 
 #include <bdls_fdstreambuf.h>
+#include <bdls_filesystemutil.h>
 
 #include <bdlt_datetime.h>
 #include <bdlt_datetimeinterval.h>
@@ -315,8 +372,13 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmf_nestedtraitdeclaration.h>
 
+#include <bslmt_condition.h>
 #include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
 
+#include <bsl_deque.h>
 #include <bsl_fstream.h>
 #include <bsl_functional.h>
 #include <bsl_iosfwd.h>
@@ -419,6 +481,59 @@ class FileObserver2 : public Observer {
                                                        // called with 'd_mutex'
                                                        // unlocked
 
+    bool                   d_backgroundRotationFlag;   // 'true' if rotations
+                                                       // are completed by the
+                                                       // rotation thread
+
+    bslmt::ThreadUtil::Handle
+                           d_rotationThread;           // rotation thread, or
+                                                       // an invalid handle if
+                                                       // background rotation
+                                                       // is disabled
+
+    bslmt::Mutex           d_rotationThreadMutex;      // serialize starting
+                                                       // and stopping the
+                                                       // rotation thread
+
+    bsl::deque<bsl::function<void()> >
+                           d_rotationJobs;             // rotated files to be
+                                                       // closed by the
+                                                       // rotation thread
+
+    bool                   d_rotationThreadDone;       // 'true' if the
+                                                       // rotation thread must
+                                                       // exit once
+                                                       // 'd_rotationJobs' is
+                                                       // empty
+
+    bsls::AtomicUint64     d_rotationThreadId;         // id of the rotation
+                                                       // thread while it
+                                                       // runs, or 0
+
+    bsl::string            d_standbyFileName;          // name of the standby
+                                                       // log file that the
+                                                       // rotation thread must
+                                                       // create, or empty
+
+    bdls::FilesystemUtil::FileDescriptor
+                           d_standbyFd;                // standby log file
+                                                       // named
+                                                       // 'd_standbyFileName',
+                                                       // or invalid if not
+                                                       // (yet) created
+
+    bslmt::Mutex           d_rotationMutex;            // serialize access to
+                                                       // 'd_rotationJobs',
+                                                       // 'd_standbyFileName',
+                                                       // and 'd_standbyFd'
+
+    bslmt::Condition       d_rotationCondition;        // signaled when there
+                                                       // is work for the
+                                                       // rotation thread
+
+    bslma::Allocator      *d_allocator_p;              // memory allocator
+                                                       // (held, not owned)
+
   private:
     // NOT IMPLEMENTED
     FileObserver2(const FileObserver2&);
@@ -426,10 +541,30 @@ class FileObserver2 : public Observer {
 
   private:
     // PRIVATE MANIPULATORS
+    void completeRotation(
+                      bdls::FilesystemUtil::FileDescriptor oldLogFile,
+                      int                                  rotationStatus,
+                      const bsl::string&                   rotatedLogFileName);
+        // Close the specified 'oldLogFile' and invoke the rotation callback,
+        // if any, with the specified 'rotationStatus', adjusted if the file
+        // could not be closed, and the specified 'rotatedLogFileName'.  This
+        // method is invoked by the rotation thread.
+
+    void discardStandbyFile();
+        // Close and remove the standby log file, if any, and stop the
+        // rotation thread from creating a new one.  The behavior is undefined
+        // unless the caller acquired the lock on 'd_rotationMutex'.
+
     void logRecordDefault(bsl::ostream& stream, const Record& record);
         // Write the specified log 'record' to the specified output 'stream'
         // using the default record format of this file observer.
 
+    void requestStandbyFile();
+        // Have the rotation thread create a standby log file for the current
+        // log file, discarding the standby file created for another log file,
+        // if any.  The behavior is undefined unless the caller acquired the
+        // lock for this object and background rotation is enabled.
+
     int rotateFile(bsl::string *rotatedLogFileName);
         // Perform a log file rotation by closing the current log file of this
         // file observer, renaming the closed log file if necessary, and
@@ -439,6 +574,8 @@ class FileObserver2 : public Observer {
         // value otherwise.  The existing log file is renamed if the new log
         // filename, as determined by the 'logFilenamePattern' of the latest
         // call to 'enableFileLogging', is the same as the old log filename.
+        // If background rotation is enabled, switch to the standby log file if
+        // it is available, and hand the old log file to the rotation thread.
 
     int rotateIfNecessary(bsl::string           *rotatedLogFileName,
                           const bdlt::Datetime&  currentLogTimeUtc);
@@ -453,6 +590,18 @@ class FileObserver2 : public Observer {
         // and the 'rotateOnSize' methods, respectively.  The behavior is
         // undefined unless the caller acquired the lock for this object.
 
+    void rotationThreadEntryPoint();
+        // Create standby log files and complete the rotations handed to the
+        // rotation thread until 'd_rotationThreadDone' is 'true' and there is
+        // no rotation left to complete.
+
+    int switchToStandbyFile();
+        // Rename the standby log file, if any, to the current log filename
+        // and associate the log stream with it.  Return 0 on success, and a
+        // non-zero value (with the standby file removed) otherwise.  The
+        // behavior is undefined unless the caller acquired the lock for this
+        // object and the log stream is not associated with a file.
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(FileObserver2, bslma::UsesBslmaAllocator);
@@ -473,6 +622,15 @@ class FileObserver2 : public Observer {
         // and destroy this file observer.
 
     // MANIPULATORS
+    void disableBackgroundRotation();
+        // Disable background rotation for this file observer: wait for the
+        // rotation thread to complete the rotations already performed, stop
+        // it, and remove the standby log file, if any.  This method has no
+        // effect if background rotation is not enabled.  Note that the
+        // rotation callback must not call this method: as the rotation thread
+        // cannot wait for itself, this method has no effect when called from
+        // the rotation thread.  See {Background Rotation}.
+
     void disableFileLogging();
         // Disable file logging for this file observer.  This method has no
         // effect if file logging is not enabled.  Note that records
@@ -503,6 +661,15 @@ class FileObserver2 : public Observer {
         // enabled.  Note that this method also affects log filenames (see {Log
         // Filename Patterns}).
 
+    int enableBackgroundRotation();
+        // Enable background rotation for this file observer by starting a
+        // rotation thread that creates the next log file ahead of each
+        // rotation, closes rotated log files, and invokes the rotation
+        // callback.  Return 0 on success, a positive value if background
+        // rotation is already enabled (with no effect), and a negative value
+        // if the rotation thread could not be created.  See {Background
+        // Rotation}.
+
     int enableFileLogging(const char *logFilenamePattern);
         // Enable logging of all records published to this file observer to a
         // file whose name is derived from the specified 'logFilenamePattern'.
@@ -624,9 +791,15 @@ class FileObserver2 : public Observer {
         // behavior is undefined if the supplied function calls either
         // 'setOnFileRotationCallback', 'forceRotation', or 'publish' on this
         // file observer (i.e., the supplied callback should *not* attempt to
-        // write to the 'ball' log).
+        // write to the 'ball' log).  Note that the callback is invoked by the
+        // rotation thread if background rotation is enabled (see {Background
+        // Rotation}).
 
     // ACCESSORS
+    bool isBackgroundRotationEnabled() const;
+        // Return 'true' if background rotation is enabled for this file
+        // observer, and 'false' otherwise.
+
     bool isFileLoggingEnabled() const;
     bool isFileLoggingEnabled(bsl::string *result) const;
         // Return 'true' if file logging is enabled for this file observer, and
@@ -39,6 +39,7 @@
 #include <bslstl_stringref.h>
 
 #include <bsls_assert.h>
+#include <bsls_atomic.h>
 #include <bsls_platform.h>
 #include <bsls_timeinterval.h>
 #include <bsls_types.h>
@@ -49,8 +50,10 @@
 #include <bsl_cstdio.h>
 #include <bsl_cstring.h>
 #include <bsl_ctime.h>
+#include <bsl_fstream.h>
 #include <bsl_iomanip.h>
 #include <bsl_iostream.h>
+#include <bsl_iterator.h>
 #include <bsl_sstream.h>
 
 #ifdef BSLS_PLATFORM_OS_UNIX
@@ -91,11 +94,13 @@ using bsl::flush;
 // [ 1] ~FileObserver2();
 //
 // MANIPULATORS
+// [14] void disableBackgroundRotation();
 // [ 1] void disableFileLogging();
 // [ 2] void disableLifetimeRotation();
 // [ 1] void disablePublishInLocalTime();
 // [ 2] void disableSizeRotation();
 // [ 8] void disableTimeIntervalRotation();
+// [14] int  enableBackgroundRotation();
 // [ 1] int  enableFileLogging(const char *fileName);
 // [ 1] int  enableFileLogging(const char *fileName, bool timestampFlag);
 // [ 1] void enablePublishInLocalTime();
@@ -110,13 +115,14 @@ using bsl::flush;
 // [ 5] void setOnFileRotationCallback(const OnFileRotationCallback&);
 //
 // ACCESSORS
+// [14] bool isBackgroundRotationEnabled() const;
 // [ 1] bool isFileLoggingEnabled() const;
 // [ 1] bool isFileLoggingEnabled(bsl::string *result) const;
 // [ 1] bool isPublishInLocalTimeEnabled() const;
 // [ 2] DatetimeInterval rotationLifetime() const;
 // [ 2] int rotationSize() const;
 // ----------------------------------------------------------------------------
-// [13] USAGE EXAMPLE
+// [15] USAGE EXAMPLE
 // [12] CONCERN: CURRENT LOCAL-TIME OFFSET IN TIMESTAMP
 // [11] CONCERN: TIME CALLBACKS ARE CALLED
 // [10] CONCERN: ROTATION CAN BE ENABLED AFTER FILE LOGGING
@@ -538,6 +544,84 @@ void ReentrantRotationCallback::operator()(int, const bsl::string& )
     d_observer_p->disableFileLogging();
 }
 
+class RotationThreadRecorder {
+    // This class can be used as a functor matching the signature of
+    // 'ball::FileObserver2::OnFileRotationCallback'.  This class forwards
+    // every invocation of the function-call operator to the rotation callback
+    // tester supplied at construction, and records the id of the invoking
+    // thread.
+
+    // DATA
+    RotCb                d_cb;           // forwarded-to callback tester
+    bsls::Types::Uint64 *d_threadId_p;   // id of the last invoking thread
+
+  public:
+    // CREATORS
+    RotationThreadRecorder(const RotCb& cb, bsls::Types::Uint64 *threadId)
+        // Create a rotation callback that forwards to the specified 'cb' and
+        // loads the id of the invoking thread into the specified 'threadId'.
+    : d_cb(cb)
+    , d_threadId_p(threadId)
+    {
+    }
+
+    // MANIPULATORS
+    void operator()(int status, const bsl::string& rotatedFileName)
+        // Invoke the callback tester supplied at construction with the
+        // specified 'status' and 'rotatedFileName', and record the id of the
+        // calling thread.
+    {
+        d_cb(status, rotatedFileName);
+        *d_threadId_p = bslmt::ThreadUtil::selfIdAsUint64();
+    }
+};
+
+class DisablingRotationCallback {
+    // This class can be used as a functor matching the signature of
+    // 'ball::FileObserver2::OnFileRotationCallback'.  This class implements
+    // the function-call operator, that will call 'disableBackgroundRotation'
+    // on the file observer supplied at construction, and count the
+    // invocations.
+
+    // DATA
+    Obj             *d_observer_p;         // observer to disable (held)
+    bsls::AtomicInt *d_numInvocations_p;   // number of invocations (held)
+
+  public:
+    // CREATORS
+    DisablingRotationCallback(Obj *observer, bsls::AtomicInt *numInvocations)
+        // Create a rotation callback for the specified 'observer' that
+        // increments the specified 'numInvocations' on each invocation.
+    : d_observer_p(observer)
+    , d_numInvocations_p(numInvocations)
+    {
+    }
+
+    // MANIPULATORS
+    void operator()(int, const bsl::string&)
+        // Disable background rotation for the observer supplied at
+        // construction, and increment the invocation count.
+    {
+        d_observer_p->disableBackgroundRotation();
+        ++*d_numInvocations_p;
+    }
+};
+
+bool waitForFile(const bsl::string& fileName, bool existFlag)
+    // Wait (for up to 10 seconds) until a file having the specified
+    // 'fileName' exists if the specified 'existFlag' is 'true', and until it
+    // does not exist otherwise.  Return 'true' if it does, and 'false' on
+    // timeout.
+{
+    for (int i = 0; i < 1000; ++i) {
+        if (existFlag == FsUtil::exists(fileName)) {
+            return true;                                              // RETURN
+        }
+        bslmt::ThreadUtil::microSleep(10 * 1000);
+    }
+    return false;
+}
+
 void publishRecord(Obj *observer, const char *message)
     // Publish the specified 'message' to the specified 'observer' object.
 {
@@ -712,7 +796,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:
-      case 14: {
+      case 15: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -788,6 +872,248 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // TESTING BACKGROUND ROTATION
+        //
+        // Concerns:
+        //: 1 Background rotation is disabled by default, and
+        //:   'enableBackgroundRotation' and 'disableBackgroundRotation' toggle
+        //:   it, having no effect if it is already in the requested state.
+        //:
+        //: 2 Once background rotation is enabled, a standby log file is
+        //:   created next to the log file, and is removed when file logging
+        //:   or background rotation is disabled.
+        //:
+        //: 3 On rotation, the records published before and after the
+        //:   rotation are written to the rotated and the new log file,
+        //:   respectively, the standby file becomes the new log file, and the
+        //:   rotation callback is invoked, with the name of the rotated file,
+        //:   by a thread other than the one performing the rotation.
+        //:
+        //: 4 Disabling background rotation waits for the rotation callbacks
+        //:   of the rotations performed so far.
+        //:
+        //: 5 If the standby log file has disappeared, the rotation opens the
+        //:   new log file as usual.
+        //:
+        //: 6 Destroying an observer having background rotation enabled stops
+        //:   the rotation thread and removes the standby file.
+        //:
+        //: 7 Calling 'disableBackgroundRotation' from the rotation callback
+        //:   has no effect (and, in particular, does not deadlock).
+        //
+        // Plan:
+        //: 1 Toggle background rotation and verify the value returned by
+        //:   'isBackgroundRotationEnabled'.  (C-1)
+        //:
+        //: 2 Enable file logging with background rotation enabled and wait
+        //:   for the standby file to appear.  Publish a record, force a
+        //:   rotation, publish another record, disable background rotation,
+        //:   and verify the rotation callback invocations and the content of
+        //:   the log files.  (C-2..4)
+        //:
+        //: 3 Remove the standby file, force a rotation, and verify that
+        //:   logging continues to the new log file.  (C-5)
+        //:
+        //: 4 Destroy an observer having background rotation enabled, and
+        //:   verify that the standby file is removed.  (C-6)
+        //:
+        //: 5 Install a rotation callback calling 'disableBackgroundRotation',
+        //:   force a rotation, wait for the callback, and verify that
+        //:   background rotation is still enabled and can be disabled.  (C-7)
+        //
+        // Testing:
+        //   void disableBackgroundRotation();
+        //   int  enableBackgroundRotation();
+        //   bool isBackgroundRotationEnabled() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING BACKGROUND ROTATION"
+                          << "\n===========================" << endl;
+
+        bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+        TempDirectoryGuard tempDirGuard;
+
+        bsl::string fileName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&fileName, "test.log");
+
+        bsl::string standbyFileName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&standbyFileName, ".test.log.standby");
+
+        if (veryVerbose) cout << "\tEnabling and disabling." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(false == X.isBackgroundRotationEnabled());
+
+            ASSERT(0     == mX.enableBackgroundRotation());
+            ASSERT(true  == X.isBackgroundRotationEnabled());
+
+            ASSERT(0     <  mX.enableBackgroundRotation());
+            ASSERT(true  == X.isBackgroundRotationEnabled());
+
+            mX.disableBackgroundRotation();
+            ASSERT(false == X.isBackgroundRotationEnabled());
+
+            mX.disableBackgroundRotation();
+            ASSERT(false == X.isBackgroundRotationEnabled());
+        }
+
+        if (veryVerbose) cout << "\tRotating in the background." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            RotCb               cb(&ta);
+            bsls::Types::Uint64 callbackThreadId = 0;
+
+            mX.setOnFileRotationCallback(
+                                RotationThreadRecorder(cb, &callbackThreadId));
+
+            ASSERT(0 == mX.enableBackgroundRotation());
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            ASSERT(waitForFile(standbyFileName, true));
+
+            // Mark the standby file, to verify that it becomes the new log
+            // file.
+
+            {
+                bsl::ofstream standby(standbyFileName.c_str(),
+                                      bsl::ios::app);
+                standby << "STANDBY";
+            }
+
+            publishRecord(&mX, "BEFORE ROTATION");
+            mX.forceRotation();
+            publishRecord(&mX, "AFTER ROTATION");
+
+            bsl::string logName;
+            ASSERT(true == X.isFileLoggingEnabled(&logName));
+            ASSERTV(logName, fileName == logName);
+
+            // The standby file is replaced for the next rotation.
+
+            ASSERT(waitForFile(standbyFileName, true));
+
+            mX.disableBackgroundRotation();
+
+            ASSERT(false == FsUtil::exists(standbyFileName));
+
+            ASSERTV(cb.numInvocations(), 1 == cb.numInvocations());
+            ASSERTV(cb.status(),         0 == cb.status());
+            ASSERT(bslmt::ThreadUtil::selfIdAsUint64() != callbackThreadId);
+
+            const bsl::string& rotatedName = cb.rotatedFileName();
+            ASSERTV(rotatedName, 0 == rotatedName.find(fileName + "."));
+
+            bsl::ifstream rotated(rotatedName.c_str());
+            bsl::string   rotatedContent((bsl::istreambuf_iterator<char>(
+                                                                     rotated)),
+                                         bsl::istreambuf_iterator<char>());
+
+            bsl::ifstream current(fileName.c_str());
+            bsl::string   currentContent((bsl::istreambuf_iterator<char>(
+                                                                     current)),
+                                         bsl::istreambuf_iterator<char>());
+
+            ASSERTV(rotatedContent,
+                    bsl::string::npos != rotatedContent.find("BEFORE"));
+            ASSERTV(rotatedContent,
+                    bsl::string::npos == rotatedContent.find("AFTER"));
+            ASSERTV(currentContent,
+                    bsl::string::npos == currentContent.find("BEFORE"));
+            ASSERTV(currentContent,
+                    bsl::string::npos != currentContent.find("AFTER"));
+            ASSERTV(currentContent, 0 == currentContent.find("STANDBY"));
+
+            FsUtil::remove(rotatedName);
+
+            if (veryVerbose) cout << "\tRotating without a standby file."
+                                  << endl;
+
+            // A sleep is required because timestamp resolution is 1 second.
+
+            bslmt::ThreadUtil::microSleep(0, 1);
+
+            cb.reset();
+            ASSERT(0 == mX.enableBackgroundRotation());
+            ASSERT(waitForFile(standbyFileName, true));
+
+            ASSERT(0 == FsUtil::remove(standbyFileName));
+
+            mX.forceRotation();
+            publishRecord(&mX, "AFTER FALLBACK");
+
+            ASSERT(true == X.isFileLoggingEnabled());
+
+            mX.disableBackgroundRotation();
+
+            ASSERTV(cb.numInvocations(), 1 == cb.numInvocations());
+            ASSERTV(cb.status(),         0 == cb.status());
+
+            bsl::ifstream fallback(fileName.c_str());
+            bsl::string   fallbackContent((bsl::istreambuf_iterator<char>(
+                                                                    fallback)),
+                                          bsl::istreambuf_iterator<char>());
+            ASSERTV(fallbackContent,
+                    bsl::string::npos != fallbackContent.find("FALLBACK"));
+            ASSERTV(fallbackContent,
+                    bsl::string::npos == fallbackContent.find("AFTER ROT"));
+
+            if (veryVerbose) cout << "\tDisabling file logging." << endl;
+
+            ASSERT(0 == mX.enableBackgroundRotation());
+            ASSERT(waitForFile(standbyFileName, true));
+
+            mX.disableFileLogging();
+
+            ASSERT(false == FsUtil::exists(standbyFileName));
+
+            FsUtil::remove(cb.rotatedFileName());
+            FsUtil::remove(fileName);
+        }
+
+        if (veryVerbose) cout << "\tDisabling from the callback." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            bsls::AtomicInt numInvocations(0);
+            mX.setOnFileRotationCallback(
+                              DisablingRotationCallback(&mX, &numInvocations));
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+            ASSERT(0 == mX.enableBackgroundRotation());
+            ASSERT(waitForFile(standbyFileName, true));
+
+            mX.forceRotation();
+
+            for (int i = 0; i < 1000 && 0 == numInvocations; ++i) {
+                bslmt::ThreadUtil::microSleep(10 * 1000);
+            }
+            ASSERTV(numInvocations, 1 == numInvocations);
+            ASSERT(true == X.isBackgroundRotationEnabled());
+
+            mX.disableBackgroundRotation();
+            ASSERT(false == X.isBackgroundRotationEnabled());
+
+            mX.disableFileLogging();
+            FsUtil::remove(fileName);
+        }
+
+        if (veryVerbose) cout << "\tDestroying the observer." << endl;
+        {
+            Obj mX(&ta);
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+            ASSERT(0 == mX.enableBackgroundRotation());
+            ASSERT(waitForFile(standbyFileName, true));
+        }
+        ASSERT(false == FsUtil::exists(standbyFileName));
+
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // REPRODUCE BUG FROM DRQS 123123158
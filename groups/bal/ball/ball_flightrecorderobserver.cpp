@@ -0,0 +1,628 @@
+// ball_flightrecorderobserver.cpp                                    -*-C++-*-
+#include <ball_flightrecorderobserver.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_flightrecorderobserver_cpp,"$Id$ $CSID$")
+
+#include <ball_context.h>
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_severity.h>
+
+#include <bdls_filesystemutil.h>
+#include <bdls_memoryutil.h>
+
+#include <bdlt_datetime.h>
+#include <bdlt_epochutil.h>
+
+#include <bslmf_assert.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_types.h>
+
+#include <bslstl_stringref.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+#include <bsl_ostream.h>
+#include <bsl_vector.h>
+
+///Implementation Notes
+///--------------------
+// Records are reserved at consecutive *positions*, which are byte offsets into
+// an unbounded stream of which the ring holds the most recent 'capacity'
+// bytes; the record at position 'p' is stored at offset 'p % capacity' of the
+// ring, wrapping around its end if necessary.  The position following the
+// last reserved record is kept in the file header and advanced atomically.
+//
+// Every record begins with an 8-byte *commit* word, which is written, with
+// release semantics, after the rest of the record, and whose value is the
+// position of the record combined with 'k_COMMIT_KEY'.  Because records are
+// aligned on 8-byte boundaries, and the capacity is a multiple of 8, a commit
+// word never wraps around the end of the ring.  A reader therefore recognizes
+// a complete record by its commit word: a record whose writer was terminated
+// before it was complete still holds the commit word of whatever was stored
+// there before, which, having been written for a different position, does not
+// match.  Since the oldest bytes in the ring generally lie in the middle of a
+// record, and records that were never completed have no reliable length,
+// a reader finds the next record by advancing 8 bytes at a time until it
+// finds a matching commit word.
+//
+// A writer that reserves the range '[p, p + n)' overwrites the bytes of the
+// positions '[p - capacity, p + n - capacity)', which precede the most recent
+// 'capacity' bytes once the reservation is made; hence, the records within
+// the most recent 'capacity' bytes are never overwritten by writers that have
+// already reserved their records.  (A writer that is suspended for as long as
+// it takes the other writers to fill the entire ring may, however, overwrite
+// newer records when it resumes.)
+//
+// A reader may nevertheless copy a record while a writer that has reserved a
+// later range overwrites it, so the reader validates each record it copies
+// as a sequence lock would: writers store every word of a record with
+// release semantics after reserving it, and the reader loads every word of
+// a record with acquire semantics, and then loads the write position again.
+// If the reader observed any word stored by a writer that overwrote the
+// record, it therefore observes the reservation of that writer, and the
+// record, whose position then precedes the new write position by more than
+// 'capacity', is skipped.
+//
+// When a file is reinitialized, the ring is cleared, so that the commit words
+// left by the records of the previous ring, which may match the positions of
+// the new ring, cannot be mistaken for those of complete records.
+
+namespace BloombergLP {
+namespace ball {
+
+namespace {
+
+typedef bsls::Types::Int64               Int64;
+typedef bsls::Types::Uint64              Uint64;
+typedef bsls::AtomicOperations           AtomicOps;
+typedef AtomicOps::AtomicTypes::Uint64   AtomicUint64;
+
+const char         k_MAGIC[8] = { 'B', 'A', 'L', 'L', 'F', 'R', 'E', 'C' };
+const unsigned int k_VERSION  = 1;
+
+const Uint64 k_COMMIT_KEY = 0x5aa5c33c0ff0e11eULL;
+    // value combined with the position of a record to form its commit word
+
+enum {
+    k_HEADER_SIZE   = 64,     // size of the file header, in bytes
+    k_ALIGNMENT     = 8,      // alignment of the records in the ring
+    k_MAX_NAME_SIZE = 0xFFFF  // size of the largest file or category name
+};
+
+struct FileHeader {
+    // This 'struct' defines the layout of the header at the start of a ring
+    // file.
+
+    char          d_magic[8];     // 'k_MAGIC'
+    unsigned int  d_version;      // 'k_VERSION'
+    unsigned int  d_headerSize;   // offset of the ring in the file
+    Uint64        d_capacity;     // size of the ring, in bytes
+    AtomicUint64  d_position;     // position following the last reserved
+                                  // record
+};
+
+BSLMF_ASSERT(sizeof(FileHeader) <= k_HEADER_SIZE);
+
+struct RecordHeader {
+    // This 'struct' defines the layout of the fixed-size header of each
+    // record in the ring, which is followed by the file name, category name,
+    // and message of the record (with no terminating null characters), and
+    // then by padding up to the next 8-byte boundary.
+
+    Uint64         d_commit;          // position of the record combined with
+                                      // 'k_COMMIT_KEY', written last
+    unsigned int   d_length;          // size of the record, including padding
+    int            d_severity;        // severity of the log record
+    Int64          d_timestamp;       // microseconds since the epoch
+    Uint64         d_threadId;        // id of the publishing thread
+    int            d_processId;       // id of the publishing process
+    int            d_lineNumber;      // line number of the log record
+    unsigned short d_fileNameLength;  // length of the file name
+    unsigned short d_categoryLength;  // length of the category name
+    unsigned int   d_messageLength;   // length of the message
+};
+
+BSLMF_ASSERT(0 == sizeof(RecordHeader) % k_ALIGNMENT);
+
+inline
+Uint64 roundUp(Uint64 value, Uint64 multiple)
+    // Return the smallest multiple of the specified 'multiple' that is not
+    // less than the specified 'value'.
+{
+    return (value + multiple - 1) / multiple * multiple;
+}
+
+inline
+AtomicUint64 *ringWord(const char *ring, Uint64 offset)
+    // Return the address of the 8-byte word at the specified 'offset' of the
+    // specified 'ring'.
+{
+    return reinterpret_cast<AtomicUint64 *>(const_cast<char *>(ring) + offset);
+}
+
+Uint64 copyFromRing(void        *data,
+                    const char  *ring,
+                    Uint64       capacity,
+                    Uint64       offset,
+                    bsl::size_t  numBytes)
+    // Copy to the specified 'data' the specified 'numBytes' bytes of the
+    // specified 'ring' having the specified 'capacity', starting at the
+    // specified 'offset' and wrapping around the end of 'ring' if necessary,
+    // loading each 8-byte word of 'ring' with acquire semantics.  Return the
+    // offset following the last byte copied.  The behavior is undefined
+    // unless 'offset' and 'numBytes' are multiples of 'k_ALIGNMENT'.
+{
+    char *bytes = static_cast<char *>(data);
+
+    for (bsl::size_t i = 0; i < numBytes; i += k_ALIGNMENT) {
+        const Uint64 word = AtomicOps::getUint64Acquire(
+                                                     ringWord(ring, offset));
+        bsl::memcpy(bytes + i, &word, k_ALIGNMENT);
+
+        offset += k_ALIGNMENT;
+        if (offset == capacity) {
+            offset = 0;
+        }
+    }
+    return offset;
+}
+
+                            // ================
+                            // class RingWriter
+                            // ================
+
+class RingWriter {
+    // This class provides a mechanism that writes a sequence of bytes to a
+    // ring, wrapping around its end if necessary, storing each 8-byte word of
+    // the ring with release semantics (see {Implementation Notes}).
+
+    // DATA
+    char        *d_ring_p;              // ring written to (held)
+    Uint64       d_capacity;            // capacity of the ring
+    Uint64       d_offset;              // offset of the next word to store
+    char         d_word[k_ALIGNMENT];   // bytes of the next word
+    bsl::size_t  d_numBuffered;         // number of bytes in 'd_word'
+
+    // PRIVATE MANIPULATORS
+    void storeWord(const char *bytes);
+        // Store the 8 bytes at the specified 'bytes' in the next word of the
+        // ring.
+
+  public:
+    // CREATORS
+    RingWriter(char *ring, Uint64 capacity, Uint64 offset);
+        // Create a writer for the specified 'ring' having the specified
+        // 'capacity', whose first word is stored at the specified 'offset'.
+        // The behavior is undefined unless 'offset' is a multiple of
+        // 'k_ALIGNMENT' less than 'capacity'.
+
+    // MANIPULATORS
+    void flush();
+        // Store the bytes written but not yet stored, if any, followed by
+        // null bytes up to a multiple of 'k_ALIGNMENT'.
+
+    void write(const void *data, bsl::size_t numBytes);
+        // Write the specified 'numBytes' bytes from the specified 'data'.
+        // Note that the last 'numBytes % k_ALIGNMENT' bytes written may not be
+        // stored until more bytes are written, or 'flush' is called.
+};
+
+// PRIVATE MANIPULATORS
+inline
+void RingWriter::storeWord(const char *bytes)
+{
+    Uint64 word;
+    bsl::memcpy(&word, bytes, k_ALIGNMENT);
+    AtomicOps::setUint64Release(ringWord(d_ring_p, d_offset), word);
+
+    d_offset += k_ALIGNMENT;
+    if (d_offset == d_capacity) {
+        d_offset = 0;
+    }
+}
+
+// CREATORS
+RingWriter::RingWriter(char *ring, Uint64 capacity, Uint64 offset)
+: d_ring_p(ring)
+, d_capacity(capacity)
+, d_offset(offset)
+, d_numBuffered(0)
+{
+}
+
+// MANIPULATORS
+void RingWriter::flush()
+{
+    if (0 < d_numBuffered) {
+        bsl::memset(d_word + d_numBuffered, 0, k_ALIGNMENT - d_numBuffered);
+        storeWord(d_word);
+        d_numBuffered = 0;
+    }
+}
+
+void RingWriter::write(const void *data, bsl::size_t numBytes)
+{
+    const char *bytes = static_cast<const char *>(data);
+
+    if (0 < d_numBuffered) {
+        const bsl::size_t numCopied = bsl::min<bsl::size_t>(
+                                           numBytes,
+                                           k_ALIGNMENT - d_numBuffered);
+        bsl::memcpy(d_word + d_numBuffered, bytes, numCopied);
+        d_numBuffered += numCopied;
+        bytes         += numCopied;
+        numBytes      -= numCopied;
+
+        if (k_ALIGNMENT != d_numBuffered) {
+            return;                                                   // RETURN
+        }
+        storeWord(d_word);
+        d_numBuffered = 0;
+    }
+
+    for (; k_ALIGNMENT <= numBytes; numBytes -= k_ALIGNMENT) {
+        storeWord(bytes);
+        bytes += k_ALIGNMENT;
+    }
+
+    bsl::memcpy(d_word, bytes, numBytes);
+    d_numBuffered = numBytes;
+}
+
+bool isValidHeader(const FileHeader& header, bsl::size_t size)
+    // Return 'true' if the specified 'header' is the header of a ring file
+    // having the specified 'size', and 'false' otherwise.
+{
+    return 0 == bsl::memcmp(header.d_magic, k_MAGIC, sizeof k_MAGIC)
+        && k_VERSION     == header.d_version
+        && k_HEADER_SIZE == header.d_headerSize
+        && 0 < header.d_capacity
+        && 0 == header.d_capacity % k_ALIGNMENT
+        && header.d_capacity <= size - k_HEADER_SIZE;
+}
+
+}  // close unnamed namespace
+
+                       // ----------------------------
+                       // class FlightRecorderObserver
+                       // ----------------------------
+
+// CLASS METHODS
+int FlightRecorderObserver::printRecords(bsl::ostream& stream,
+                                         const char   *fileName)
+{
+    BSLS_ASSERT(fileName);
+
+    typedef bdls::FilesystemUtil Util;
+
+    Util::FileDescriptor fd = Util::open(fileName,
+                                         Util::e_OPEN,
+                                         Util::e_READ_ONLY);
+    if (Util::k_INVALID_FD == fd) {
+        return -1;                                                    // RETURN
+    }
+
+    const Util::Offset fileSize = Util::getFileSize(fd);
+    if (fileSize < k_HEADER_SIZE) {
+        Util::close(fd);
+        return -2;                                                    // RETURN
+    }
+
+    const bsl::size_t  size = static_cast<bsl::size_t>(fileSize);
+    void              *data;
+    if (0 != Util::map(fd, &data, 0, size, bdls::MemoryUtil::k_ACCESS_READ)) {
+        Util::close(fd);
+        return -3;                                                    // RETURN
+    }
+
+    const int rc = printRecords(stream, static_cast<const char *>(data), size);
+
+    Util::unmap(data, size);
+    Util::close(fd);
+
+    return rc;
+}
+
+int FlightRecorderObserver::printRecords(bsl::ostream& stream,
+                                         const char   *data,
+                                         bsl::size_t   size)
+{
+    BSLS_ASSERT(data);
+
+    if (size < k_HEADER_SIZE) {
+        return -1;                                                    // RETURN
+    }
+
+    const FileHeader& header = *reinterpret_cast<const FileHeader *>(data);
+    if (!isValidHeader(header, size)) {
+        return -1;                                                    // RETURN
+    }
+
+    const char   *ring     = data + k_HEADER_SIZE;
+    const Uint64  capacity = header.d_capacity;
+    const Uint64  end      = AtomicOps::getUint64Acquire(
+                          const_cast<AtomicUint64 *>(&header.d_position));
+
+    Uint64 position = end > capacity ? end - capacity : 0;
+    position        = roundUp(position, k_ALIGNMENT);
+
+    bsl::vector<char> text;
+    int               numRecords = 0;
+
+    while (position + sizeof(RecordHeader) <= end) {
+        const Uint64 offset = position % capacity;
+        const Uint64 commit = position ^ k_COMMIT_KEY;
+
+        if (commit != AtomicOps::getUint64Acquire(ringWord(ring, offset))) {
+            position += k_ALIGNMENT;
+            continue;
+        }
+
+        RecordHeader record;
+        copyFromRing(&record, ring, capacity, offset, sizeof record);
+
+        const Uint64 textLength = static_cast<Uint64>(record.d_fileNameLength)
+                                + record.d_categoryLength
+                                + record.d_messageLength;
+
+        if (record.d_length < sizeof record
+         || 0 != record.d_length % k_ALIGNMENT
+         || record.d_length > end - position
+         || textLength > record.d_length - sizeof record) {
+            position += k_ALIGNMENT;
+            continue;
+        }
+
+        text.resize(static_cast<bsl::size_t>(roundUp(textLength,
+                                                     k_ALIGNMENT)));
+        if (0 < textLength) {
+            copyFromRing(text.data(),
+                         ring,
+                         capacity,
+                         (offset + sizeof record) % capacity,
+                         text.size());
+        }
+
+        // Skip the record, and all others that may have been overwritten, if
+        // a writer that has reserved its record since the loop began may have
+        // overwritten the record while it was being copied.
+
+        const Uint64 newEnd = AtomicOps::getUint64Acquire(
+                              const_cast<AtomicUint64 *>(&header.d_position));
+        if (newEnd - position > capacity) {
+            position = roundUp(newEnd - capacity, k_ALIGNMENT);
+            continue;
+        }
+
+        bdlt::Datetime timestamp = bdlt::EpochUtil::epoch();
+        timestamp.addMicrosecondsIfValid(record.d_timestamp);
+
+        const int bufferSize = 64;
+        char      buffer[bufferSize];
+        const int fractionalSecondPrecision = 6;
+
+        const int numBytesWritten = timestamp.printToBuffer(
+                                                    buffer,
+                                                    bufferSize,
+                                                    fractionalSecondPrecision);
+
+        const char *fileName = text.data();
+        const char *category = fileName + record.d_fileNameLength;
+        const char *message  = category + record.d_categoryLength;
+
+        stream.write(buffer, numBytesWritten);
+        stream << ' '
+               << record.d_processId << ' '
+               << record.d_threadId  << ' '
+               << Severity::toAscii(
+                              static_cast<Severity::Level>(record.d_severity))
+               << ' ';
+        stream.write(fileName, record.d_fileNameLength);
+        stream << ' ' << record.d_lineNumber << ' ';
+        stream.write(category, record.d_categoryLength);
+        stream << ' ';
+        stream.write(message, record.d_messageLength);
+        stream << '\n';
+
+        ++numRecords;
+        position += record.d_length;
+    }
+
+    stream << bsl::flush;
+
+    return numRecords;
+}
+
+// CREATORS
+FlightRecorderObserver::FlightRecorderObserver()
+: d_mapping_p(0)
+, d_mappingSize(0)
+, d_capacity(0)
+, d_maxRecordSize(0)
+{
+}
+
+FlightRecorderObserver::~FlightRecorderObserver()
+{
+    close();
+}
+
+// MANIPULATORS
+void FlightRecorderObserver::close()
+{
+    if (d_mapping_p) {
+        bdls::FilesystemUtil::unmap(d_mapping_p, d_mappingSize);
+
+        d_mapping_p     = 0;
+        d_mappingSize   = 0;
+        d_capacity      = 0;
+        d_maxRecordSize = 0;
+    }
+}
+
+int FlightRecorderObserver::open(const char *fileName, bsl::size_t capacity)
+{
+    BSLS_ASSERT(fileName);
+    BSLS_ASSERT(k_MIN_CAPACITY <= capacity);
+
+    typedef bdls::FilesystemUtil Util;
+
+    if (d_mapping_p) {
+        return 1;                                                     // RETURN
+    }
+
+    const Uint64 fileSize = roundUp(k_HEADER_SIZE + capacity,
+                                    bdls::MemoryUtil::pageSize());
+    const bsl::size_t size = static_cast<bsl::size_t>(fileSize);
+
+    Util::FileDescriptor fd = Util::open(fileName,
+                                         Util::e_OPEN_OR_CREATE,
+                                         Util::e_READ_WRITE);
+    if (Util::k_INVALID_FD == fd) {
+        return -1;                                                    // RETURN
+    }
+
+    // Reserve the disk space for the file, so that writing to the mapped
+    // pages cannot fail for lack of space.
+
+    if (0 != Util::growFile(fd, fileSize, true)) {
+        Util::close(fd);
+        return -2;                                                    // RETURN
+    }
+
+    void *mapping;
+    const int rc = Util::map(fd,
+                             &mapping,
+                             0,
+                             size,
+                             bdls::MemoryUtil::k_ACCESS_READ_WRITE);
+
+    // The mapping remains valid after the file is closed.
+
+    Util::close(fd);
+
+    if (0 != rc) {
+        return -3;                                                    // RETURN
+    }
+
+    FileHeader&  header       = *static_cast<FileHeader *>(mapping);
+    const Uint64 ringCapacity = fileSize - k_HEADER_SIZE;
+
+    if (!isValidHeader(header, size) || ringCapacity != header.d_capacity) {
+        bsl::memset(mapping, 0, size);
+
+        header.d_version    = k_VERSION;
+        header.d_headerSize = k_HEADER_SIZE;
+        header.d_capacity   = ringCapacity;
+        AtomicOps::initUint64(&header.d_position, 0);
+        bsl::memcpy(header.d_magic, k_MAGIC, sizeof k_MAGIC);
+    }
+
+    d_mapping_p     = static_cast<char *>(mapping);
+    d_mappingSize   = size;
+    d_capacity      = static_cast<bsl::size_t>(ringCapacity);
+    d_maxRecordSize = d_capacity / 4 / k_ALIGNMENT * k_ALIGNMENT;
+
+    return 0;
+}
+
+void FlightRecorderObserver::publish(
+                                  const bsl::shared_ptr<const Record>& record,
+                                  const Context&)
+{
+    BSLS_ASSERT(record);
+
+    if (!d_mapping_p) {
+        return;                                                       // RETURN
+    }
+
+    const RecordAttributes& fixedFields = record->fixedFields();
+
+    const char              *fileName = fixedFields.fileName();
+    const char              *category = fixedFields.category();
+    const bslstl::StringRef  message  = fixedFields.messageRef();
+
+    // Truncate the file name, category name, and message, in that order, to
+    // fit in 'd_maxRecordSize' bytes.
+
+    bsl::size_t available = d_maxRecordSize - sizeof(RecordHeader);
+
+    const bsl::size_t fileNameLength = bsl::min<bsl::size_t>(
+                bsl::min<bsl::size_t>(bsl::strlen(fileName), k_MAX_NAME_SIZE),
+                available);
+    available -= fileNameLength;
+
+    const bsl::size_t categoryLength = bsl::min<bsl::size_t>(
+                bsl::min<bsl::size_t>(bsl::strlen(category), k_MAX_NAME_SIZE),
+                available);
+    available -= categoryLength;
+
+    const bsl::size_t messageLength = bsl::min<bsl::size_t>(message.length(),
+                                                            available);
+
+    const Uint64 length = roundUp(sizeof(RecordHeader)
+                                  + fileNameLength
+                                  + categoryLength
+                                  + messageLength,
+                                  k_ALIGNMENT);
+
+    RecordHeader header;
+    header.d_length         = static_cast<unsigned int>(length);
+    header.d_severity       = fixedFields.severity();
+    header.d_timestamp      = (fixedFields.timestamp()
+                               - bdlt::EpochUtil::epoch()).totalMicroseconds();
+    header.d_threadId       = fixedFields.threadID();
+    header.d_processId      = fixedFields.processID();
+    header.d_lineNumber     = fixedFields.lineNumber();
+    header.d_fileNameLength = static_cast<unsigned short>(fileNameLength);
+    header.d_categoryLength = static_cast<unsigned short>(categoryLength);
+    header.d_messageLength  = static_cast<unsigned int>(messageLength);
+
+    // Reserve the space for the record.
+
+    FileHeader&  fileHeader = *reinterpret_cast<FileHeader *>(d_mapping_p);
+    char        *ring       = d_mapping_p + k_HEADER_SIZE;
+
+    const Uint64 position = AtomicOps::addUint64NvAcqRel(
+                                                  &fileHeader.d_position,
+                                                  length) - length;
+    const Uint64 start    = position % d_capacity;
+
+    // Copy all of the record but its commit word, and then commit it.
+
+    const bsl::size_t commitSize = sizeof header.d_commit;
+
+    RingWriter writer(ring, d_capacity, (start + commitSize) % d_capacity);
+    writer.write(reinterpret_cast<char *>(&header) + commitSize,
+                 sizeof header - commitSize);
+    writer.write(fileName, fileNameLength);
+    writer.write(category, categoryLength);
+    writer.write(message.data(), messageLength);
+    writer.flush();
+
+    AtomicOps::setUint64Release(ringWord(ring, start),
+                                position ^ k_COMMIT_KEY);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
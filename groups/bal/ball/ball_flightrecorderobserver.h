@@ -0,0 +1,297 @@
+// ball_flightrecorderobserver.h                                      -*-C++-*-
+#ifndef INCLUDED_BALL_FLIGHTRECORDEROBSERVER
+#define INCLUDED_BALL_FLIGHTRECORDEROBSERVER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an observer that records to a memory-mapped ring file.
+//
+//@CLASSES:
+//  ball::FlightRecorderObserver: observer writing to a mapped ring file
+//
+//@SEE_ALSO: ball_fixedsizerecordbuffer, ball_fileobserver2, ball_observer
+//
+//@DESCRIPTION: This component provides a concrete implementation of the
+// 'ball::Observer' protocol, 'ball::FlightRecorderObserver', that writes the
+// log records it receives as compact binary records into a fixed-size ring
+// held in a memory-mapped file, overwriting the oldest records when the ring
+// is full:
+//..
+//               ,----------------------------.
+//              ( ball::FlightRecorderObserver )
+//               `----------------------------'
+//                             |              ctor
+//                             |              open
+//                             |              close
+//                             |              capacity
+//                             |              isOpen
+//                             |              printRecords
+//                             V
+//                     ,--------------.
+//                    ( ball::Observer )
+//                     `--------------'
+//                                            publish
+//                                            releaseRecords
+//                                            dtor
+//..
+// Like a 'ball::FixedSizeRecordBuffer', a flight recorder retains the most
+// recent log records, so that a detailed trace of what preceded a failure is
+// available without writing every record to a log file.  Unlike that buffer,
+// the records are stored in pages that are shared with the file, which are
+// retained by the operating system (and eventually written to the file) even
+// if the process is killed abruptly (e.g., by 'SIGKILL') or crashes.  The
+// records can then be rendered as text, by this or by another process, using
+// the 'printRecords' class method.  Note that records are *not* guaranteed to
+// survive a failure of the operating system itself.
+//
+///Publishing Records
+///------------------
+// 'publish' neither allocates memory nor takes a lock: each call reserves
+// space for its record in the ring by atomically advancing a write position
+// stored in the file, copies the record into the reserved space, and then
+// marks the record complete.  The cost of publishing a record is therefore
+// little more than that of copying it, which makes it practical to record
+// even 'e_TRACE'-level messages at all times, e.g., by installing a flight
+// recorder as one of the observers of a 'ball::LoggerManager' with a
+// pass-through threshold of 'e_TRACE'.
+//
+// Each record holds the timestamp, process id, thread id, severity, file name,
+// line number, category name, and message of the published log record; user
+// fields and attributes are not recorded.  A record is at most a quarter of
+// the capacity of the ring: the file name, category name, and message of a
+// record that would be larger are truncated, in that order.
+//
+///File Format
+///-----------
+// The file consists of a header, which identifies the file and holds the
+// capacity of the ring and the current write position, followed by the ring.
+// The capacity supplied to 'open' is rounded up so that the size of the file
+// is a multiple of the page size.  Records are written in the native byte
+// order, so a file must be read on a platform having the same byte order and
+// word size as that of the process that wrote it.
+//
+// If the file named in a call to 'open' already holds a ring having the same
+// capacity, new records are appended to the existing ones, so that records
+// written before a crash are not lost when the process is restarted;
+// otherwise, the file is reinitialized, discarding the records it holds.
+//
+///Reading Records
+///---------------
+// 'printRecords' renders the complete records in a ring, oldest first, one
+// per line, in a format similar to that of 'ball::StreamObserver'.  A record
+// that was being written when the process terminated is skipped.  Note that
+// 'printRecords' may be applied to the file of a running process, in which
+// case the records that are overwritten while they are being read are
+// skipped.
+//
+///Thread Safety
+///-------------
+// 'publish' may be called concurrently from any number of threads (and
+// processes that have opened the same file with the same capacity).  'open'
+// and 'close' must not be called concurrently with any other method.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Recording and Printing Log Records
+///- - - - - - - - - - - - - - - - - - - - - - -
+// First, we create a flight recorder and open a ring file (having a capacity
+// of at least 64 kilobytes) for it:
+//..
+//  ball::FlightRecorderObserver recorder;
+//
+//  int rc = recorder.open(fileName, 64 * 1024);
+//  assert(0 == rc);
+//..
+// Then, we create a log record and publish it to the recorder:
+//..
+//  ball::RecordAttributes fixed;
+//  fixed.setTimestamp(bdlt::Datetime(2026, 1, 2, 3, 4, 5, 6));
+//  fixed.setProcessID(1);
+//  fixed.setThreadID(2);
+//  fixed.setSeverity(ball::Severity::e_TRACE);
+//  fixed.setFileName("main.cpp");
+//  fixed.setLineNumber(42);
+//  fixed.setCategory("APP");
+//  fixed.setMessage("Hello, world!");
+//
+//  bsl::shared_ptr<ball::Record> record;
+//  record.createInplace();
+//  record->setFixedFields(fixed);
+//
+//  recorder.publish(record,
+//                   ball::Context(ball::Transmission::e_PASSTHROUGH, 0, 1));
+//..
+// Finally, after the recorder is closed (or after the process that owns it
+// has terminated), we print the records in the file:
+//..
+//  recorder.close();
+//
+//  bsl::ostringstream os;
+//  assert(1 == ball::FlightRecorderObserver::printRecords(os, fileName));
+//  assert("02JAN2026_03:04:05.006000 1 2 TRACE main.cpp 42 APP Hello, world!"
+//         "\n" == os.str());
+//..
+
+#include <balscm_version.h>
+
+#include <ball_observer.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_iosfwd.h>
+#include <bsl_memory.h>
+
+namespace BloombergLP {
+namespace ball {
+
+class Context;
+class Record;
+
+                       // ============================
+                       // class FlightRecorderObserver
+                       // ============================
+
+class FlightRecorderObserver : public Observer {
+    // This class provides a concrete implementation of the 'Observer'
+    // protocol that writes the log records it receives into a fixed-size ring
+    // held in a memory-mapped file.  See {Publishing Records}.
+
+    // DATA
+    char        *d_mapping_p;      // address of the mapped file, or 0 if no
+                                   // file is open
+
+    bsl::size_t  d_mappingSize;    // size of the mapped file
+
+    bsl::size_t  d_capacity;       // size of the ring, in bytes
+
+    bsl::size_t  d_maxRecordSize;  // size, in bytes, of the largest record
+
+    // NOT IMPLEMENTED
+    FlightRecorderObserver(const FlightRecorderObserver&);
+    FlightRecorderObserver& operator=(const FlightRecorderObserver&);
+
+  public:
+    // PUBLIC CONSTANTS
+    enum {
+        k_MIN_CAPACITY = 4096  // smallest capacity accepted by 'open'
+    };
+
+    // CLASS METHODS
+    static int printRecords(bsl::ostream& stream, const char *fileName);
+        // Print to the specified 'stream' the complete records in the ring
+        // held in the file having the specified 'fileName', oldest first, one
+        // per line.  Return the number of records printed on success, and a
+        // negative value, with no effect on 'stream', if the file could not
+        // be read or does not hold a ring.
+
+    static int printRecords(bsl::ostream& stream,
+                            const char   *data,
+                            bsl::size_t   size);
+        // Print to the specified 'stream' the complete records in the ring
+        // held in the specified 'data' having the specified 'size' (in bytes),
+        // e.g., the mapped contents of a ring file, oldest first, one per
+        // line.  Return the number of records printed on success, and a
+        // negative value, with no effect on 'stream', if 'data' does not hold
+        // a ring.  The behavior is undefined unless 'data' is aligned on an
+        // 8-byte boundary.
+
+    // CREATORS
+    FlightRecorderObserver();
+        // Create a flight recorder having no open file.  Records published to
+        // the observer are discarded until a file is opened.
+
+    virtual ~FlightRecorderObserver();
+        // Close the file of this observer, if any, and destroy this observer.
+
+    // MANIPULATORS
+    void close();
+        // Unmap and close the file of this observer, if any.  Records
+        // published to this observer are discarded until a file is opened.
+        // The behavior is undefined if this method is called concurrently
+        // with any other method of this observer.
+
+    int open(const char *fileName, bsl::size_t capacity);
+        // Map the file having the specified 'fileName', creating it if it
+        // does not exist, and write the records subsequently published to
+        // this observer to a ring of at least the specified 'capacity' (in
+        // bytes) held in that file.  If the file already holds a ring of the
+        // same capacity, append the records to those it holds, and otherwise
+        // reinitialize the file.  Return 0 on success, a positive value if a
+        // file is already open (with no effect), and a negative value
+        // otherwise.  The behavior is undefined unless
+        // 'k_MIN_CAPACITY <= capacity', or if this method is called
+        // concurrently with any other method of this observer.
+
+    using Observer::publish;
+
+    virtual void publish(const bsl::shared_ptr<const Record>& record,
+                         const Context&                       context);
+        // Write the specified log 'record' to the ring of this observer, if
+        // a file is open, overwriting the oldest records in the ring as
+        // needed.  The specified 'context' is ignored.  This method neither
+        // allocates memory nor blocks.  The behavior is undefined if 'record'
+        // is modified during the execution of this method.
+
+    virtual void releaseRecords();
+        // Do nothing, as this observer does not retain references to the
+        // records published to it.
+
+    // ACCESSORS
+    bsl::size_t capacity() const;
+        // Return the capacity (in bytes) of the ring of this observer if a
+        // file is open, and 0 otherwise.
+
+    bool isOpen() const;
+        // Return 'true' if this observer has an open file, and 'false'
+        // otherwise.
+};
+
+// ============================================================================
+//                              INLINE DEFINITIONS
+// ============================================================================
+
+                       // ----------------------------
+                       // class FlightRecorderObserver
+                       // ----------------------------
+
+// MANIPULATORS
+inline
+void FlightRecorderObserver::releaseRecords()
+{
+}
+
+// ACCESSORS
+inline
+bsl::size_t FlightRecorderObserver::capacity() const
+{
+    return d_capacity;
+}
+
+inline
+bool FlightRecorderObserver::isOpen() const
+{
+    return 0 != d_mapping_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1313 @@
+// ball_flightrecorderobserver.t.cpp                                  -*-C++-*-
+#include <ball_flightrecorderobserver.h>
+
+#include <ball_context.h>
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_severity.h>
+#include <ball_transmission.h>
+
+#include <bdls_filesystemutil.h>
+#include <bdls_memoryutil.h>
+#include <bdls_pathutil.h>
+
+#include <bdlt_datetime.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_platform.h>
+#include <bsls_review.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_sstream.h>
+#include <bsl_streambuf.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+#include <bsl_c_signal.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#else
+#include <windows.h>
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is an observer that writes log records into a
+// ring held in a memory-mapped file, and a pair of class methods that print
+// the records in such a ring.  We verify that 'open' creates, reuses, or
+// reinitializes the file as documented, that the records that are printed
+// are exactly the most recent records published (including after the ring
+// wraps around, and when records are published concurrently), that records
+// overwritten while they are being read are skipped rather than printed
+// corrupted, and that the records survive the abrupt termination of the
+// publishing process.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 3] static int printRecords(ostream& stream, const char *fileName);
+// [ 3] static int printRecords(ostream&, const char *data, size_t size);
+//
+// CREATORS
+// [ 2] FlightRecorderObserver();
+// [ 2] virtual ~FlightRecorderObserver();
+//
+// MANIPULATORS
+// [ 2] void close();
+// [ 2] int open(const char *fileName, bsl::size_t capacity);
+// [ 3] virtual void publish(const shared_ptr<const Record>&, Context&);
+// [ 2] virtual void releaseRecords();
+//
+// ACCESSORS
+// [ 2] bsl::size_t capacity() const;
+// [ 2] bool isOpen() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: CONCURRENT PUBLICATION
+// [ 5] CONCERN: RECORDS SURVIVE 'SIGKILL'
+// [ 6] CONCERN: READING WHILE THE RING IS OVERWRITTEN
+// [ 7] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef ball::FlightRecorderObserver Obj;
+
+const int k_HEADER_SIZE     = 64;  // size of the header of a ring file
+const int k_POSITION_OFFSET = 24;  // offset of the write position in the
+                                   // header of a ring file
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+namespace {
+
+class TempDirectoryGuard {
+    // This class implements a scoped temporary directory guard.  The guard
+    // tries to create a temporary directory in the system-wide temp directory
+    // and falls back to the current directory.
+
+    // DATA
+    bsl::string       d_dirName;      // path to the created directory
+    bslma::Allocator *d_allocator_p;  // memory allocator (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    TempDirectoryGuard(const TempDirectoryGuard&);
+    TempDirectoryGuard& operator=(const TempDirectoryGuard&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(TempDirectoryGuard,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit TempDirectoryGuard(bslma::Allocator *basicAllocator = 0)
+        // Create temporary directory in the system-wide temp or current
+        // directory.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.
+    : d_dirName(bslma::Default::allocator(basicAllocator))
+    , d_allocator_p(bslma::Default::allocator(basicAllocator))
+    {
+        bsl::string tmpPath(d_allocator_p);
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+        char tmpPathBuf[MAX_PATH];
+        GetTempPath(MAX_PATH, tmpPathBuf);
+        tmpPath.assign(tmpPathBuf);
+#else
+        const char *envTmpPath = bsl::getenv("TMPDIR");
+        if (envTmpPath) {
+            tmpPath.assign(envTmpPath);
+        }
+#endif
+
+        int res = bdls::PathUtil::appendIfValid(&tmpPath, "ball_");
+        ASSERTV(tmpPath, 0 == res);
+
+        res = bdls::FilesystemUtil::createTemporaryDirectory(&d_dirName,
+                                                             tmpPath);
+        ASSERTV(tmpPath, 0 == res);
+    }
+
+    ~TempDirectoryGuard()
+        // Destroy this object and remove the temporary directory (recursively)
+        // created at construction.
+    {
+        bdls::FilesystemUtil::remove(d_dirName, true);
+    }
+
+    // ACCESSORS
+    const bsl::string& getTempDirName() const
+        // Return a 'const' reference to the name of the created temporary
+        // directory.
+    {
+        return d_dirName;
+    }
+};
+
+bsl::string makeFileName(const TempDirectoryGuard& guard, const char *name)
+    // Return the path of the file having the specified 'name' in the
+    // directory of the specified 'guard'.
+{
+    bsl::string fileName = guard.getTempDirName();
+    bdls::PathUtil::appendRaw(&fileName, name);
+    return fileName;
+}
+
+void publishMessage(Obj                *observer,
+                    const char         *message,
+                    bsls::Types::Uint64 threadId = 1)
+    // Publish to the specified 'observer' a record having the specified
+    // 'message' and optionally specified 'threadId'.
+{
+    ball::RecordAttributes fixed;
+    fixed.setTimestamp(bdlt::Datetime(2026, 1, 2, 3, 4, 5, 6, 7));
+    fixed.setProcessID(1);
+    fixed.setThreadID(threadId);
+    fixed.setSeverity(ball::Severity::e_TRACE);
+    fixed.setFileName("file.cpp");
+    fixed.setLineNumber(10);
+    fixed.setCategory("CAT");
+    fixed.setMessage(message);
+
+    bsl::shared_ptr<ball::Record> record;
+    record.createInplace();
+    record->setFixedFields(fixed);
+
+    observer->publish(record,
+                      ball::Context(ball::Transmission::e_PASSTHROUGH, 0, 1));
+}
+
+bsl::vector<bsl::string> splitLines(const bsl::string& text)
+    // Return the lines of the specified 'text', without their terminating
+    // newline characters.
+{
+    bsl::vector<bsl::string> lines;
+    bsl::istringstream       is(text);
+    bsl::string              line;
+    while (bsl::getline(is, line)) {
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+bsl::string messageOf(const bsl::string& line)
+    // Return the message of the specified 'line' printed by 'printRecords'
+    // for a record published by 'publishMessage'.
+{
+    static const char prefix[] = " CAT ";
+    bsl::size_t       pos      = line.find(prefix);
+    return bsl::string::npos == pos ? bsl::string()
+                                    : line.substr(pos + sizeof prefix - 1);
+}
+
+                         // =============================
+                         // struct ConcurrentPublishArgs
+                         // =============================
+
+struct ConcurrentPublishArgs {
+    // This 'struct' holds the arguments of 'concurrentPublish'.
+
+    Obj *d_observer_p;   // observer to publish to
+    int  d_threadId;     // id of the publishing thread
+    int  d_numRecords;   // number of records to publish
+};
+
+extern "C" void *concurrentPublish(void *arg)
+    // Publish to the observer in the specified 'arg', which holds the address
+    // of a 'ConcurrentPublishArgs', the indicated number of records having
+    // the messages "<thread id> <i>" for each 'i' in '[0, numRecords)'.
+{
+    ConcurrentPublishArgs *args = static_cast<ConcurrentPublishArgs *>(arg);
+
+    for (int i = 0; i < args->d_numRecords; ++i) {
+        char message[64];
+        bsl::sprintf(message, "%d %d", args->d_threadId, i);
+        publishMessage(args->d_observer_p, message, args->d_threadId);
+    }
+    return 0;
+}
+
+                         // ==========================
+                         // class OverwritingStreamBuf
+                         // ==========================
+
+class OverwritingStreamBuf : public bsl::streambuf {
+    // This class provides a stream buffer that accumulates the characters
+    // written to it and that, once the first line has been written, simulates
+    // two writers overwriting the second of the 64-byte records in the ring
+    // held in a specified buffer: one that has reserved the space holding the
+    // commit word of that record but not yet written it, and one that has
+    // reserved the space holding its message and written it.
+
+    // DATA
+    bsl::string          d_text;      // characters written
+    char                *d_data_p;    // ring file contents (held)
+    bsls::Types::Uint64  d_capacity;  // capacity of the ring
+    bool                 d_isDone;    // 'true' once the ring is overwritten
+
+  private:
+    // NOT IMPLEMENTED
+    OverwritingStreamBuf(const OverwritingStreamBuf&);
+    OverwritingStreamBuf& operator=(const OverwritingStreamBuf&);
+
+  protected:
+    // PROTECTED MANIPULATORS
+    int_type overflow(int_type c)
+        // Append the specified character 'c' to the text of this stream
+        // buffer, overwriting the ring the first time 'c' is a newline, and
+        // return 'c', or a value other than 'eof' if 'c' is 'eof'.
+    {
+        if (traits_type::eq_int_type(c, traits_type::eof())) {
+            return traits_type::not_eof(c);                           // RETURN
+        }
+
+        d_text.push_back(traits_type::to_char_type(c));
+
+        if ('\n' == traits_type::to_char_type(c) && !d_isDone) {
+            d_isDone = true;
+
+            const bsls::Types::Uint64 position = d_capacity + 128;
+            bsl::memcpy(d_data_p + k_POSITION_OFFSET,
+                        &position,
+                        sizeof position);
+            bsl::memcpy(d_data_p + k_HEADER_SIZE + 64 + 59, "XXXXX", 5);
+        }
+        return c;
+    }
+
+  public:
+    // CREATORS
+    OverwritingStreamBuf(char *data, bsls::Types::Uint64 capacity)
+        // Create a stream buffer that overwrites the ring having the
+        // specified 'capacity' held in the specified 'data'.
+    : d_data_p(data)
+    , d_capacity(capacity)
+    , d_isDone(false)
+    {
+    }
+
+    // ACCESSORS
+    const bsl::string& text() const
+        // Return the characters written to this stream buffer.
+    {
+        return d_text;
+    }
+};
+
+                             // ====================
+                             // struct OverwriteArgs
+                             // ====================
+
+struct OverwriteArgs {
+    // This 'struct' holds the arguments of 'overwrite'.
+
+    Obj             *d_observer_p;  // observer to publish to
+    int              d_threadId;    // id of the publishing thread
+    bsls::AtomicInt *d_done_p;      // publish until this is non-zero
+};
+
+void makeCheckedMessage(bsl::string *result, int sequence)
+    // Load into the specified 'result' a message identifying the specified
+    // 'sequence' number, followed by a number of copies of a character, both
+    // determined by 'sequence'.
+{
+    char prefix[32];
+    bsl::sprintf(prefix, "%d ", sequence);
+    result->assign(prefix);
+    result->append(static_cast<bsl::size_t>(sequence % 500),
+                   static_cast<char>('a' + sequence % 26));
+}
+
+extern "C" void *overwrite(void *arg)
+    // Publish to the observer in the specified 'arg', which holds the address
+    // of an 'OverwriteArgs', records having the messages created by
+    // 'makeCheckedMessage' for successive sequence numbers until the
+    // indicated flag is set.
+{
+    OverwriteArgs *args = static_cast<OverwriteArgs *>(arg);
+
+    bsl::string message;
+    for (int i = 0; 0 == *args->d_done_p; ++i) {
+        makeCheckedMessage(&message, i);
+        publishMessage(args->d_observer_p, message.c_str(), args->d_threadId);
+    }
+    return 0;
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test                = argc > 1 ? atoi(argv[1]) : 0;
+    const bool verbose             = argc > 2;
+    const bool veryVerbose         = argc > 3;
+    const bool veryVeryVerbose     = argc > 4;
+    const bool veryVeryVeryVerbose = argc > 5;
+
+    (void) veryVeryVerbose;
+    (void) veryVeryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nUSAGE EXAMPLE"
+                          << "\n=============" << endl;
+
+        TempDirectoryGuard tempDirGuard;
+        const bsl::string  fileNameStr = makeFileName(tempDirGuard, "ring");
+        const char        *fileName    = fileNameStr.c_str();
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Recording and Printing Log Records
+///- - - - - - - - - - - - - - - - - - - - - - -
+// First, we create a flight recorder and open a ring file (having a capacity
+// of at least 64 kilobytes) for it:
+//..
+    ball::FlightRecorderObserver recorder;
+
+    int rc = recorder.open(fileName, 64 * 1024);
+    ASSERT(0 == rc);
+//..
+// Then, we create a log record and publish it to the recorder:
+//..
+    ball::RecordAttributes fixed;
+    fixed.setTimestamp(bdlt::Datetime(2026, 1, 2, 3, 4, 5, 6));
+    fixed.setProcessID(1);
+    fixed.setThreadID(2);
+    fixed.setSeverity(ball::Severity::e_TRACE);
+    fixed.setFileName("main.cpp");
+    fixed.setLineNumber(42);
+    fixed.setCategory("APP");
+    fixed.setMessage("Hello, world!");
+
+    bsl::shared_ptr<ball::Record> record;
+    record.createInplace();
+    record->setFixedFields(fixed);
+
+    recorder.publish(record,
+                     ball::Context(ball::Transmission::e_PASSTHROUGH, 0, 1));
+//..
+// Finally, after the recorder is closed (or after the process that owns it
+// has terminated), we print the records in the file:
+//..
+    recorder.close();
+
+    bsl::ostringstream os;
+    ASSERT(1 == ball::FlightRecorderObserver::printRecords(os, fileName));
+    ASSERT("02JAN2026_03:04:05.006000 1 2 TRACE main.cpp 42 APP Hello, world!"
+           "\n" == os.str());
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCERN: READING WHILE THE RING IS OVERWRITTEN
+        //
+        // Concerns:
+        //: 1 'printRecords' applied to a ring that is being overwritten
+        //:   prints only intact records: a record overwritten while it is
+        //:   being read is skipped.
+        //
+        // Plan:
+        //: 1 Print the records in a copy of a ring file to a stream buffer
+        //:   that, once the first record is printed, advances the write
+        //:   position and overwrites the message, but not the commit word, of
+        //:   the second record, as writers that have reserved the space it
+        //:   occupies would.  Verify that the second record is skipped.  (C-1)
+        //:
+        //: 2 Publish records, from several threads, to the smallest ring, so
+        //:   that it is overwritten many times over, each record having a
+        //:   message of varying length that can be verified.  Concurrently,
+        //:   print the records in the file repeatedly, and verify that every
+        //:   line printed is that of a record that was published.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: READING WHILE THE RING IS OVERWRITTEN
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCERN: READING WHILE THE RING IS OVERWRITTEN"
+                          << "\n=============================================="
+                          << endl;
+
+        TempDirectoryGuard tempDirGuard;
+
+        if (verbose) cout << "\tOverwriting while printing." << endl;
+        {
+            const bsl::string fileName = makeFileName(tempDirGuard, "copy");
+
+            Obj mX;
+            ASSERT(0 == mX.open(fileName.c_str(), Obj::k_MIN_CAPACITY));
+
+            const bsls::Types::Uint64 capacity = mX.capacity();
+
+            // Records of 48 header bytes, 8 bytes of file name, 3 bytes of
+            // category name, and a 5-byte message take 64 bytes.
+
+            publishMessage(&mX, "rec 0");
+            publishMessage(&mX, "rec 1");
+            publishMessage(&mX, "rec 2");
+            mX.close();
+
+            const bsl::size_t size = static_cast<bsl::size_t>(
+                            bdls::FilesystemUtil::getFileSize(fileName));
+            bsl::vector<bsls::Types::Uint64> data(size / 8 + 1);
+
+            bdls::FilesystemUtil::FileDescriptor fd =
+                                   bdls::FilesystemUtil::open(
+                                           fileName,
+                                           bdls::FilesystemUtil::e_OPEN,
+                                           bdls::FilesystemUtil::e_READ_ONLY);
+            ASSERT(bdls::FilesystemUtil::k_INVALID_FD != fd);
+            ASSERT(static_cast<int>(size) ==
+                   bdls::FilesystemUtil::read(fd,
+                                              data.data(),
+                                              static_cast<int>(size)));
+            bdls::FilesystemUtil::close(fd);
+
+            char *bytes = reinterpret_cast<char *>(data.data());
+
+            OverwritingStreamBuf buffer(bytes, capacity);
+            bsl::ostream         os(&buffer);
+            ASSERTV(buffer.text(), 2 == Obj::printRecords(os, bytes, size));
+
+            const bsl::vector<bsl::string> lines = splitLines(buffer.text());
+            ASSERT(2 == lines.size());
+            if (2 == lines.size()) {
+                ASSERTV(lines[0], "rec 0" == messageOf(lines[0]));
+                ASSERTV(lines[1], "rec 2" == messageOf(lines[1]));
+            }
+        }
+
+        if (verbose) cout << "\tOverwriting concurrently." << endl;
+
+        const bsl::string fileName = makeFileName(tempDirGuard, "ring");
+
+        enum { k_NUM_THREADS = 4, k_NUM_READS = 2000 };
+
+        Obj mX;
+        ASSERT(0 == mX.open(fileName.c_str(), Obj::k_MIN_CAPACITY));
+
+        bsls::AtomicInt           done(0);
+        bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+        OverwriteArgs             args[k_NUM_THREADS];
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            args[i].d_observer_p = &mX;
+            args[i].d_threadId   = i;
+            args[i].d_done_p     = &done;
+            ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                  overwrite,
+                                                  &args[i]));
+        }
+
+        bsl::string expected;
+        int         numPrinted = 0;
+
+        for (int i = 0; i < k_NUM_READS; ++i) {
+            bsl::ostringstream os;
+            const int          rc = Obj::printRecords(os, fileName.c_str());
+            ASSERTV(rc, 0 <= rc);
+
+            const bsl::vector<bsl::string> lines = splitLines(os.str());
+            ASSERTV(rc, lines.size(), rc == static_cast<int>(lines.size()));
+
+            for (bsl::size_t j = 0; j < lines.size(); ++j) {
+                const bsl::string message = messageOf(lines[j]);
+
+                int sequence = -1;
+                bsl::sscanf(message.c_str(), "%d", &sequence);
+                ASSERTV(lines[j], 0 <= sequence);
+                if (0 > sequence) {
+                    continue;
+                }
+
+                makeCheckedMessage(&expected, sequence);
+                ASSERTV(lines[j], expected == message);
+                ASSERTV(lines[j],
+                        0 == lines[j].find("02JAN2026_03:04:05.006007 1 "));
+            }
+            numPrinted += rc;
+        }
+
+        done = 1;
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+        }
+
+        if (verbose) {
+            P(numPrinted);
+        }
+        ASSERT(0 < numPrinted);
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCERN: RECORDS SURVIVE 'SIGKILL'
+        //
+        // Concerns:
+        //: 1 The records published by a process that is killed abruptly can
+        //:   be printed by another process.
+        //
+        // Plan:
+        //: 1 Fork a child process that opens a ring file, publishes a number
+        //:   of records, and then sends itself 'SIGKILL'.  In the parent,
+        //:   wait for the child, and verify that 'printRecords' prints all of
+        //:   the records published by the child.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: RECORDS SURVIVE 'SIGKILL'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCERN: RECORDS SURVIVE 'SIGKILL'"
+                          << "\n==================================" << endl;
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+        TempDirectoryGuard tempDirGuard;
+        const bsl::string  fileName = makeFileName(tempDirGuard, "ring");
+
+        const int NUM_RECORDS = 100;
+
+        pid_t pid = fork();
+        ASSERT(-1 != pid);
+
+        if (0 == pid) {
+            Obj mX;
+            if (0 == mX.open(fileName.c_str(), 64 * 1024)) {
+                for (int i = 0; i < NUM_RECORDS; ++i) {
+                    char message[32];
+                    bsl::sprintf(message, "%d", i);
+                    publishMessage(&mX, message);
+                }
+            }
+            kill(getpid(), SIGKILL);
+            _exit(1);
+        }
+
+        int status = 0;
+        ASSERT(pid == waitpid(pid, &status, 0));
+        ASSERT(WIFSIGNALED(status));
+        ASSERT(SIGKILL == WTERMSIG(status));
+
+        bsl::ostringstream os;
+        ASSERTV(NUM_RECORDS == Obj::printRecords(os, fileName.c_str()));
+
+        const bsl::vector<bsl::string> lines = splitLines(os.str());
+        ASSERTV(lines.size(), NUM_RECORDS == static_cast<int>(lines.size()));
+
+        for (int i = 0; i < static_cast<int>(lines.size()); ++i) {
+            char message[32];
+            bsl::sprintf(message, "%d", i);
+            ASSERTV(i, lines[i], message == messageOf(lines[i]));
+        }
+#else
+        if (verbose) cout << "Skipped on this platform." << endl;
+#endif
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCERN: CONCURRENT PUBLICATION
+        //
+        // Concerns:
+        //: 1 Records published concurrently by several threads are all
+        //:   recorded, intact, and the records of each thread are printed in
+        //:   the order in which they were published.
+        //
+        // Plan:
+        //: 1 Publish records concurrently from several threads to a ring that
+        //:   is large enough to hold all of them, each record identifying its
+        //:   thread and sequence number.  Verify that 'printRecords' prints
+        //:   every record, and that each thread's records are printed in
+        //:   sequence.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: CONCURRENT PUBLICATION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCERN: CONCURRENT PUBLICATION"
+                          << "\n===============================" << endl;
+
+        TempDirectoryGuard tempDirGuard;
+        const bsl::string  fileName = makeFileName(tempDirGuard, "ring");
+
+        enum { k_NUM_THREADS = 8, k_NUM_RECORDS = 2000 };
+
+        Obj mX;
+        ASSERT(0 == mX.open(fileName.c_str(), 4 * 1024 * 1024));
+
+        bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+        ConcurrentPublishArgs     args[k_NUM_THREADS];
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            args[i].d_observer_p = &mX;
+            args[i].d_threadId   = i;
+            args[i].d_numRecords = k_NUM_RECORDS;
+            ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                  concurrentPublish,
+                                                  &args[i]));
+        }
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+        }
+
+        bsl::ostringstream os;
+        const int numPrinted = Obj::printRecords(os, fileName.c_str());
+        ASSERTV(numPrinted, k_NUM_THREADS * k_NUM_RECORDS == numPrinted);
+
+        const bsl::vector<bsl::string> lines = splitLines(os.str());
+        ASSERTV(lines.size(),
+                k_NUM_THREADS * k_NUM_RECORDS == lines.size());
+
+        int next[k_NUM_THREADS] = { 0 };
+        for (bsl::size_t i = 0; i < lines.size(); ++i) {
+            int threadId;
+            int sequence;
+            ASSERTV(lines[i], 2 == bsl::sscanf(messageOf(lines[i]).c_str(),
+                                               "%d %d",
+                                               &threadId,
+                                               &sequence));
+            if (0 <= threadId && threadId < k_NUM_THREADS) {
+                ASSERTV(lines[i], next[threadId] == sequence);
+                next[threadId] = sequence + 1;
+            }
+        }
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERTV(i, next[i], k_NUM_RECORDS == next[i]);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'publish' AND 'printRecords'
+        //
+        // Concerns:
+        //: 1 'printRecords' prints, oldest first, the fields of each record
+        //:   published.
+        //:
+        //: 2 When the ring is full, the oldest records are overwritten, and
+        //:   'printRecords' prints exactly the most recent records, including
+        //:   records that wrap around the end of the ring.
+        //:
+        //: 3 A message too large for a record is truncated.
+        //:
+        //: 4 Records whose writing was not completed are skipped.
+        //:
+        //: 5 'printRecords' returns a negative value for data that is not a
+        //:   ring, and for a file that does not exist.
+        //:
+        //: 6 Records published while no file is open are discarded.
+        //
+        // Plan:
+        //: 1 Publish records and verify the text printed.  (C-1)
+        //:
+        //: 2 Publish many more records than the ring can hold, each having a
+        //:   sequence number and a length depending on that number.  Verify
+        //:   that the records printed have consecutive sequence numbers,
+        //:   ending with the last record published, and that they fill most
+        //:   of the ring.  (C-2)
+        //:
+        //: 3 Publish a record having a message larger than the ring, and
+        //:   verify that its message is truncated.  (C-3)
+        //:
+        //: 4 Copy a ring file into memory, overwrite the commit word of one
+        //:   of its records, and verify that 'printRecords' skips just that
+        //:   record.  (C-4)
+        //:
+        //: 5 Call 'printRecords' for invalid data and a missing file.  (C-5)
+        //:
+        //: 6 Publish a record to an observer with no open file.  (C-6)
+        //
+        // Testing:
+        //   static int printRecords(ostream& stream, const char *fileName);
+        //   static int printRecords(ostream&, const char *data, size_t size);
+        //   virtual void publish(const shared_ptr<const Record>&, Context&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'publish' AND 'printRecords'"
+                          << "\n====================================" << endl;
+
+        TempDirectoryGuard tempDirGuard;
+
+        if (verbose) cout << "\tPrinting the fields of records." << endl;
+        {
+            const bsl::string fileName = makeFileName(tempDirGuard, "fields");
+
+            Obj mX;
+            ASSERT(0 == mX.open(fileName.c_str(), Obj::k_MIN_CAPACITY));
+
+            ball::RecordAttributes fixed;
+            fixed.setTimestamp(bdlt::Datetime(2017, 4, 1));
+            fixed.setProcessID(100);
+            fixed.setThreadID(200);
+            fixed.setSeverity(ball::Severity::e_WARN);
+            fixed.setFileName("test.cpp");
+            fixed.setLineNumber(189);
+            fixed.setCategory("A.B");
+            fixed.setMessage("Log Message");
+
+            bsl::shared_ptr<ball::Record> record;
+            record.createInplace();
+            record->setFixedFields(fixed);
+
+            const ball::Context C(ball::Transmission::e_PASSTHROUGH, 0, 1);
+
+            mX.publish(record, C);
+
+            fixed.setSeverity(ball::Severity::e_ERROR);
+            fixed.setFileName("");
+            fixed.setCategory("");
+            fixed.setMessage("");
+            record->setFixedFields(fixed);
+
+            mX.publish(record, C);
+
+            bsl::ostringstream os;
+            ASSERT(2 == Obj::printRecords(os, fileName.c_str()));
+            ASSERTV(os.str(),
+                    "01APR2017_00:00:00.000000 100 200 WARN test.cpp 189 A.B "
+                    "Log Message\n"
+                    "01APR2017_00:00:00.000000 100 200 ERROR  189  \n"
+                    == os.str());
+        }
+
+        if (verbose) cout << "\tOverwriting the oldest records." << endl;
+        {
+            const bsl::string fileName = makeFileName(tempDirGuard, "wrap");
+
+            Obj mX;
+            ASSERT(0 == mX.open(fileName.c_str(), Obj::k_MIN_CAPACITY));
+
+            const int NUM_RECORDS = 1000;
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                char message[64];
+                bsl::sprintf(message,
+                             "%d %.*s",
+                             i,
+                             i % 17,
+                             "abcdefghijklmnop");
+                publishMessage(&mX, message);
+
+                if (0 != i % 97) {
+                    continue;
+                }
+
+                bsl::ostringstream os;
+                const int          n = Obj::printRecords(os, fileName.c_str());
+
+                const bsl::vector<bsl::string> lines = splitLines(os.str());
+                ASSERTV(i, n, lines.size(), n == (int)lines.size());
+                ASSERTV(i, n, 0 < n);
+
+                // Every record takes fewer than 120 bytes.
+
+                ASSERTV(i, n, n > i || 120 * n > (int)mX.capacity() - 120);
+
+                for (int j = 0; j < n; ++j) {
+                    const int k = i - n + 1 + j;
+                    bsl::sprintf(message,
+                                 "%d %.*s",
+                                 k,
+                                 k % 17,
+                                 "abcdefghijklmnop");
+                    ASSERTV(i, j, lines[j], message == messageOf(lines[j]));
+                }
+            }
+        }
+
+        if (verbose) cout << "\tTruncating messages." << endl;
+        {
+            const bsl::string fileName = makeFileName(tempDirGuard, "trunc");
+
+            Obj mX;
+            ASSERT(0 == mX.open(fileName.c_str(), Obj::k_MIN_CAPACITY));
+
+            const bsl::string longMessage(3 * mX.capacity(), 'x');
+            publishMessage(&mX, longMessage.c_str());
+            publishMessage(&mX, "short");
+
+            bsl::ostringstream os;
+            ASSERT(2 == Obj::printRecords(os, fileName.c_str()));
+
+            const bsl::vector<bsl::string> lines = splitLines(os.str());
+            ASSERT(2 == lines.size());
+            if (2 == lines.size()) {
+                const bsl::string message = messageOf(lines[0]);
+                ASSERTV(message.size(), 0 < message.size());
+                ASSERTV(message.size(), message.size() <= mX.capacity() / 4);
+                ASSERT(bsl::string::npos == message.find_first_not_of('x'));
+                ASSERT("short" == messageOf(lines[1]));
+            }
+        }
+
+        if (verbose) cout << "\tSkipping incomplete records." << endl;
+        {
+            const bsl::string fileName = makeFileName(tempDirGuard, "skip");
+
+            Obj mX;
+            ASSERT(0 == mX.open(fileName.c_str(), Obj::k_MIN_CAPACITY));
+
+            // Records of 48 header bytes, 8 bytes of file name, 3 bytes of
+            // category name, and a 5-byte message take 64 bytes.
+
+            publishMessage(&mX, "rec 0");
+            publishMessage(&mX, "rec 1");
+            publishMessage(&mX, "rec 2");
+            mX.close();
+
+            const bsl::size_t size = static_cast<bsl::size_t>(
+                            bdls::FilesystemUtil::getFileSize(fileName));
+            bsl::vector<bsls::Types::Uint64> data(size / 8 + 1);
+
+            bdls::FilesystemUtil::FileDescriptor fd =
+                                   bdls::FilesystemUtil::open(
+                                           fileName,
+                                           bdls::FilesystemUtil::e_OPEN,
+                                           bdls::FilesystemUtil::e_READ_ONLY);
+            ASSERT(bdls::FilesystemUtil::k_INVALID_FD != fd);
+            ASSERT(static_cast<int>(size) ==
+                   bdls::FilesystemUtil::read(fd,
+                                              data.data(),
+                                              static_cast<int>(size)));
+            bdls::FilesystemUtil::close(fd);
+
+            const char *bytes = reinterpret_cast<const char *>(data.data());
+
+            bsl::ostringstream os;
+            ASSERT(3 == Obj::printRecords(os, bytes, size));
+
+            // Corrupt the commit word of the second record.
+
+            data[(k_HEADER_SIZE + 64) / 8] ^= 1;
+
+            os.str("");
+            ASSERT(2 == Obj::printRecords(os, bytes, size));
+
+            const bsl::vector<bsl::string> lines = splitLines(os.str());
+            ASSERT(2 == lines.size());
+            if (2 == lines.size()) {
+                ASSERTV(lines[0], "rec 0" == messageOf(lines[0]));
+                ASSERTV(lines[1], "rec 2" == messageOf(lines[1]));
+            }
+
+            if (verbose) cout << "\tInvalid data." << endl;
+
+            os.str("");
+            ASSERT(0 > Obj::printRecords(os, bytes, k_HEADER_SIZE - 1));
+            ASSERT(0 > Obj::printRecords(os, bytes, k_HEADER_SIZE));
+
+            data[0] ^= 1;  // corrupt the magic number
+            ASSERT(0 > Obj::printRecords(os, bytes, size));
+            ASSERT(os.str().empty());
+
+            const bsl::string missing = makeFileName(tempDirGuard, "missing");
+            ASSERT(0 > Obj::printRecords(os, missing.c_str()));
+            ASSERT(os.str().empty());
+        }
+
+        if (verbose) cout << "\tPublishing with no open file." << endl;
+        {
+            Obj mX;
+            publishMessage(&mX, "discarded");
+            ASSERT(!mX.isOpen());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bsl::ostringstream os;
+            const char         data[k_HEADER_SIZE] = { 0 };
+
+            ASSERT_FAIL(Obj::printRecords(os, (const char *)0));
+            ASSERT_FAIL(Obj::printRecords(os, 0, 0));
+            ASSERT_PASS(Obj::printRecords(os, data, 0));
+
+            Obj                           mX;
+            bsl::shared_ptr<ball::Record> record;
+            ASSERT_FAIL(mX.publish(record, ball::Context()));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'open' AND 'close'
+        //
+        // Concerns:
+        //: 1 A default-constructed observer has no open file.
+        //:
+        //: 2 'open' creates the file, and rounds the capacity up so that the
+        //:   size of the file is a multiple of the page size.
+        //:
+        //: 3 'open' fails, with no effect, if a file is already open, and
+        //:   fails if the file cannot be created.
+        //:
+        //: 4 'close' (and the destructor) close the file, and 'close' has no
+        //:   effect if no file is open.
+        //:
+        //: 5 Reopening a file with the same capacity preserves the records it
+        //:   holds, while opening it with a different capacity, or opening a
+        //:   file that is not a ring file, reinitializes it.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Exercise 'open' and 'close' and verify the values of 'isOpen',
+        //:   'capacity', the size of the file, and the records in the file.
+        //:   (C-1..5)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for argument values.  (C-6)
+        //
+        // Testing:
+        //   FlightRecorderObserver();
+        //   virtual ~FlightRecorderObserver();
+        //   void close();
+        //   int open(const char *fileName, bsl::size_t capacity);
+        //   virtual void releaseRecords();
+        //   bsl::size_t capacity() const;
+        //   bool isOpen() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'open' AND 'close'"
+                          << "\n==========================" << endl;
+
+        TempDirectoryGuard tempDirGuard;
+        const bsl::string  fileName = makeFileName(tempDirGuard, "ring");
+        const char        *FILE     = fileName.c_str();
+
+        const int PAGE_SIZE = bdls::MemoryUtil::pageSize();
+
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(!X.isOpen());
+            ASSERT(0 == X.capacity());
+
+            mX.close();
+            mX.releaseRecords();
+            ASSERT(!X.isOpen());
+
+            ASSERT(0 == mX.open(FILE, Obj::k_MIN_CAPACITY + 1));
+            ASSERT(X.isOpen());
+            ASSERT(Obj::k_MIN_CAPACITY + 1 <= X.capacity());
+            ASSERT(0 == (X.capacity() + k_HEADER_SIZE) % PAGE_SIZE);
+            ASSERT(static_cast<bdls::FilesystemUtil::Offset>(
+                                               X.capacity() + k_HEADER_SIZE) ==
+                                     bdls::FilesystemUtil::getFileSize(FILE));
+
+            const bsl::size_t capacity = X.capacity();
+
+            ASSERT(0 < mX.open(FILE, 2 * capacity));
+            ASSERT(capacity == X.capacity());
+
+            publishMessage(&mX, "first");
+
+            mX.close();
+            ASSERT(!X.isOpen());
+            ASSERT(0 == X.capacity());
+
+            publishMessage(&mX, "discarded");
+
+            // Reopening with the same capacity appends.
+
+            ASSERT(0 == mX.open(FILE, Obj::k_MIN_CAPACITY + 1));
+            ASSERT(capacity == X.capacity());
+            publishMessage(&mX, "second");
+        }
+
+        {
+            bsl::ostringstream os;
+            ASSERT(2 == Obj::printRecords(os, FILE));
+
+            const bsl::vector<bsl::string> lines = splitLines(os.str());
+            ASSERT(2 == lines.size());
+            if (2 == lines.size()) {
+                ASSERT("first"  == messageOf(lines[0]));
+                ASSERT("second" == messageOf(lines[1]));
+            }
+        }
+
+        {
+            // Reopening with a different capacity reinitializes.
+
+            Obj mX;  const Obj& X = mX;
+            ASSERT(0 == mX.open(FILE, 4 * PAGE_SIZE));
+            ASSERT(0 == (X.capacity() + k_HEADER_SIZE) % PAGE_SIZE);
+            ASSERT(4 * PAGE_SIZE <= (int)X.capacity());
+            publishMessage(&mX, "third");
+        }
+
+        {
+            bsl::ostringstream os;
+            ASSERT(1 == Obj::printRecords(os, FILE));
+            ASSERTV(os.str(), "third\n" == messageOf(os.str()));
+        }
+
+        {
+            // Reinitializing discards the records of the previous ring, even
+            // those whose positions are reserved, but not written, in the new
+            // ring.  Simulate a writer that was killed after reserving the
+            // space following "third", where "second" was held in the
+            // previous ring, by advancing the write position in the file.
+
+            typedef bdls::FilesystemUtil Util;
+
+            Util::FileDescriptor fd = Util::open(FILE,
+                                                 Util::e_OPEN,
+                                                 Util::e_READ_WRITE);
+            ASSERT(Util::k_INVALID_FD != fd);
+
+            bsls::Types::Uint64 position = 0;
+            ASSERT(k_POSITION_OFFSET == Util::seek(
+                                               fd,
+                                               k_POSITION_OFFSET,
+                                               Util::e_SEEK_FROM_BEGINNING));
+            ASSERT(8 == Util::read(fd, &position, 8));
+            ASSERT(0 < position);
+
+            position += 128;
+            ASSERT(k_POSITION_OFFSET == Util::seek(
+                                               fd,
+                                               k_POSITION_OFFSET,
+                                               Util::e_SEEK_FROM_BEGINNING));
+            ASSERT(8 == Util::write(fd, &position, 8));
+            Util::close(fd);
+
+            bsl::ostringstream os;
+            ASSERTV(os.str(), 1 == Obj::printRecords(os, FILE));
+            ASSERTV(os.str(), "third\n" == messageOf(os.str()));
+        }
+
+        {
+            // A file that is not a ring file is reinitialized.
+
+            const bsl::string other = makeFileName(tempDirGuard, "other");
+
+            bdls::FilesystemUtil::FileDescriptor fd =
+                                   bdls::FilesystemUtil::open(
+                                         other,
+                                         bdls::FilesystemUtil::e_CREATE,
+                                         bdls::FilesystemUtil::e_READ_WRITE);
+            ASSERT(bdls::FilesystemUtil::k_INVALID_FD != fd);
+            const bsl::string text(10000, 'x');
+            bdls::FilesystemUtil::write(fd,
+                                        text.data(),
+                                        static_cast<int>(text.size()));
+            bdls::FilesystemUtil::close(fd);
+
+            Obj mX;
+            ASSERT(0 == mX.open(other.c_str(), Obj::k_MIN_CAPACITY));
+            publishMessage(&mX, "fourth");
+            mX.close();
+
+            bsl::ostringstream os;
+            ASSERT(1 == Obj::printRecords(os, other.c_str()));
+            ASSERTV(os.str(), "fourth\n" == messageOf(os.str()));
+        }
+
+        {
+            // A file that cannot be created.
+
+            const bsl::string bad = makeFileName(tempDirGuard, "none/ring");
+
+            Obj mX;
+            ASSERT(0 > mX.open(bad.c_str(), Obj::k_MIN_CAPACITY));
+            ASSERT(!mX.isOpen());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            {
+                Obj mX;
+                ASSERT_FAIL(mX.open(0, Obj::k_MIN_CAPACITY));
+            }
+            {
+                Obj mX;
+                ASSERT_FAIL(mX.open(FILE, Obj::k_MIN_CAPACITY - 1));
+            }
+            {
+                Obj mX;
+                ASSERT_PASS(mX.open(FILE, Obj::k_MIN_CAPACITY));
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Open a ring file, publish a few records, and print them.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nBREATHING TEST"
+                          << "\n==============" << endl;
+
+        TempDirectoryGuard tempDirGuard;
+        const bsl::string  fileName = makeFileName(tempDirGuard, "ring");
+
+        Obj mX;  const Obj& X = mX;
+        ASSERT(!X.isOpen());
+
+        ASSERT(0 == mX.open(fileName.c_str(), 64 * 1024));
+        ASSERT(X.isOpen());
+        ASSERT(64 * 1024 <= X.capacity());
+
+        publishMessage(&mX, "one");
+        publishMessage(&mX, "two");
+        publishMessage(&mX, "three");
+
+        bsl::ostringstream os;
+        ASSERT(3 == Obj::printRecords(os, fileName.c_str()));
+        if (veryVerbose) cout << os.str();
+
+        const bsl::vector<bsl::string> lines = splitLines(os.str());
+        ASSERT(3 == lines.size());
+        if (3 == lines.size()) {
+            ASSERTV(lines[0],
+                    "02JAN2026_03:04:05.006007 1 1 TRACE file.cpp 10 CAT one"
+                    == lines[0]);
+            ASSERT("two"   == messageOf(lines[1]));
+            ASSERT("three" == messageOf(lines[2]));
+        }
+
+        mX.close();
+        ASSERT(!X.isOpen());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -26,12 +26,62 @@ BSLS_IDENT_RCSID(ball_ruleset_cpp,"$Id$ $CSID$")
 namespace BloombergLP {
 namespace ball {
 
+namespace {
+
+                          // =================
+                          // class RuleProctor
+                          // =================
+
+class RuleProctor {
+    // This class facilitates exception neutrality by removing a rule from a
+    // rule set on failure.
+
+    // DATA
+    RuleSet *d_ruleSet_p;  // rule set to remove the rule from on failure
+
+    int      d_ruleId;     // id of the rule to remove
+
+  private:
+    // NOT IMPLEMENTED
+    RuleProctor(const RuleProctor&);
+    RuleProctor& operator=(const RuleProctor&);
+
+  public:
+    // CREATORS
+    RuleProctor(RuleSet *ruleSet, int ruleId)
+        // Create a proctor that, unless 'release' is called, removes from
+        // the specified 'ruleSet' the rule having the specified 'ruleId' on
+        // this proctor's destruction.
+    : d_ruleSet_p(ruleSet)
+    , d_ruleId(ruleId)
+    {
+    }
+
+    ~RuleProctor()
+        // Remove the managed rule, if any, from the managed rule set.
+    {
+        if (d_ruleSet_p) {
+            d_ruleSet_p->removeRuleById(d_ruleId);
+        }
+    }
+
+    // MANIPULATORS
+    void release()
+        // Release from management the rule currently managed by this proctor.
+    {
+        d_ruleSet_p = 0;
+    }
+};
+
+}  // close unnamed namespace
+
                           // -------------
                           // class RuleSet
                           // -------------
 
 // CLASS DATA
 int RuleSet::RuleHash::s_hashtableSize = INT_MAX;
+int RuleSet::PredicateHash::s_hashtableSize = INT_MAX;
 
 // CLASS METHODS
 void RuleSet::printMask(bsl::ostream& stream,
@@ -59,6 +109,7 @@ RuleSet::RuleSet(bslma::Allocator *basicAllocator)
 , d_ruleAddresses(basicAllocator)
 , d_freeRuleIds(basicAllocator)
 , d_numPredicates(0)
+, d_predicateIndex(basicAllocator)
 {
     for (int i = 0; i < maxNumRules(); ++i) {
         d_ruleAddresses.push_back(0);
@@ -73,6 +124,8 @@ RuleSet::RuleSet(const RuleSet& original, bslma::Allocator *basicAllocator)
                   basicAllocator)
 , d_ruleAddresses(basicAllocator)
 , d_freeRuleIds(basicAllocator)
+, d_numPredicates(0)
+, d_predicateIndex(basicAllocator)
 {
     for (int i = 0; i < maxNumRules(); ++i) {
         d_ruleAddresses.push_back(0);
@@ -96,6 +149,19 @@ int RuleSet::addRule(const Rule& value)
     d_freeRuleIds.pop_back();
     d_ruleAddresses[ruleId] = &*iter;
     d_numPredicates += value.numPredicates();
+
+    // Index the predicates of the new rule, removing the rule if indexing
+    // fails.
+
+    RuleProctor proctor(this, ruleId);
+
+    for (PredicateSet::const_iterator predicate = value.begin();
+         predicate != value.end();
+         ++predicate) {
+        d_predicateIndex[*predicate] |= static_cast<MaskType>(1) << ruleId;
+    }
+
+    proctor.release();
     return ruleId;
 }
 
@@ -133,6 +199,21 @@ int RuleSet::removeRuleById(int id)
 
     d_numPredicates -= rule->numPredicates();
 
+    for (PredicateSet::const_iterator predicate = rule->begin();
+         predicate != rule->end();
+         ++predicate) {
+        PredicateIndex::iterator entry = d_predicateIndex.find(*predicate);
+
+        // The entry may be absent if indexing the rule failed.
+
+        if (entry != d_predicateIndex.end()) {
+            entry->second &= ~(static_cast<MaskType>(1) << id);
+            if (0 == entry->second) {
+                d_predicateIndex.erase(entry);
+            }
+        }
+    }
+
     // Note that removing 'iter' from 'd_ruleHashTable' invalidates 'rule'.
     HashtableType::iterator iter = d_ruleHashtable.find(*rule);
     BSLS_ASSERT(iter != d_ruleHashtable.end());
@@ -165,6 +246,7 @@ void RuleSet::removeAllRules()
     d_ruleAddresses.clear();
     d_ruleHashtable.clear();
     d_freeRuleIds.clear();
+    d_predicateIndex.clear();
 
     for (int i = 0; i < maxNumRules(); ++i) {
         d_ruleAddresses.push_back(0);
@@ -183,6 +265,32 @@ RuleSet& RuleSet::operator=(const RuleSet& rhs)
 }
 
 // ACCESSORS
+RuleSet::MaskType
+RuleSet::evaluate(MaskType                      rulesMask,
+                  const AttributeContainerList& containerList) const
+{
+    // Start with the indicated rules that exist, and discard every rule
+    // having a predicate that 'containerList' does not satisfy.
+
+    MaskType result = 0;
+    for (int i = 0; i < maxNumRules(); ++i) {
+        if (((rulesMask >> i) & 1) && d_ruleAddresses[i]) {
+            result |= static_cast<MaskType>(1) << i;
+        }
+    }
+
+    for (PredicateIndex::const_iterator entry = d_predicateIndex.begin();
+         result && entry != d_predicateIndex.end();
+         ++entry) {
+        if ((entry->second & result)
+         && !containerList.hasValue(entry->first.attribute())) {
+            result &= ~entry->second;
+        }
+    }
+
+    return result;
+}
+
 int RuleSet::ruleId(const Rule& value) const
 {
     HashtableType::const_iterator iter = d_ruleHashtable.find(value);
@@ -28,6 +28,16 @@ BSLS_IDENT("$Id: $")
 // For more information on how to use that feature, please see the package
 // level documentation and usage examples for "Rule-Based Logging".
 //
+///Evaluating Rules
+///----------------
+// Rules commonly share predicates (e.g., many rules may each require the same
+// 'customerId' attribute value).  'ball::RuleSet' therefore maintains an
+// index from each distinct predicate in the set to the rules having that
+// predicate, and its 'evaluate' method, which determines which of a subset of
+// its rules are satisfied by a list of attribute containers, tests each
+// distinct predicate against the containers at most once, rather than once
+// per rule having it.
+//
 ///Thread Safety
 ///-------------
 // 'ball::RuleSet' is *not* thread-safe in that multiple threads attempting to
@@ -92,6 +102,8 @@ BSLS_IDENT("$Id: $")
 
 #include <balscm_version.h>
 
+#include <ball_attributecontainerlist.h>
+#include <ball_predicate.h>
 #include <ball_rule.h>
 
 #include <bslma_allocator.h>
@@ -99,6 +111,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmf_nestedtraitdeclaration.h>
 
+#include <bsl_unordered_map.h>
 #include <bsl_unordered_set.h>
 #include <bsl_vector.h>
 
@@ -152,6 +165,25 @@ class RuleSet {
 
     typedef bsl::unordered_set<Rule, RuleHash> HashtableType;
 
+    struct PredicateHash {
+        // hash functor for 'Predicate'
+
+      private:
+        // CLASS DATA
+        static int s_hashtableSize;              // the default hashtable size
+
+      public:
+        // ACCESSORS
+        int operator()(const Predicate& predicate) const
+            // Return the hash value of the specified 'predicate'.
+        {
+            return Predicate::hash(predicate, s_hashtableSize);
+        }
+    };
+
+    typedef bsl::unordered_map<Predicate, MaskType, PredicateHash>
+                                                                PredicateIndex;
+
     // DATA
     HashtableType              d_ruleHashtable;  // the hash table that
                                                  // manages all the rules
@@ -165,6 +197,9 @@ class RuleSet {
 
     int                        d_numPredicates;  // total number of predicates
 
+    PredicateIndex             d_predicateIndex; // mask of the rules having
+                                                 // each distinct predicate
+
     // FRIENDS
     friend bool          operator==(const RuleSet&, const RuleSet&);
     friend bool          operator!=(const RuleSet&, const RuleSet&);
@@ -249,6 +284,16 @@ class RuleSet {
         // Assign to this object the value of the specified 'rhs' object.
 
     // ACCESSORS
+    MaskType evaluate(MaskType                      rulesMask,
+                      const AttributeContainerList& containerList) const;
+        // Return the mask of those rules, among the rules in this set
+        // indicated by the specified 'rulesMask', that are satisfied by the
+        // specified 'containerList' (i.e., for which 'Rule::evaluate' returns
+        // 'true' for 'containerList').  A bit of the returned mask is 0 if
+        // there is no rule in this set having the corresponding id.  Note
+        // that each distinct predicate of the indicated rules is tested
+        // against 'containerList' at most once.
+
     int ruleId(const Rule& value) const;
         // Return the id of the rule having the specified 'value' if such a
         // rule exists, and a negative value otherwise.  Note that if there are
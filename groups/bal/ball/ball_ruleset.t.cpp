@@ -10,6 +10,8 @@
 
 #include <ball_ruleset.h>
 
+#include <ball_attributecontainerlist.h>
+#include <ball_defaultattributecontainer.h>
 #include <ball_predicate.h>
 #include <ball_severity.h>                      // for testing only
 
@@ -53,6 +55,7 @@ using namespace bsl;  // automatically added by script
 // [ 4] int ruleId(const ball::Rule& value) const;
 // [ 4] const ball::Rule *getRuleById(int id) const;
 // [ 4] int numRules() const;
+// [11] MaskType evaluate(MaskType, const AttributeContainerList&) const;
 // [ 5] bsl::ostream& print(bsl::ostream& stream, int lvl, int spl) const;
 // [ 6] bool operator==(const ball::Rule& lhs, const ball::Rule& rhs)
 // [ 6] bool operator!=(const ball::Rule& lhs, const ball::Rule& rhs)
@@ -61,7 +64,7 @@ using namespace bsl;  // automatically added by script
 // [ 1] BREATHING TEST
 // [ 3] PRIMITIVE TEST APPARATUS: 'gg'
 // [ 8] UNUSED
-// [11] USAGE EXAMPLE
+// [12] USAGE EXAMPLE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -347,7 +350,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 11: {
+      case 12: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -424,6 +427,131 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 11: {
+        // --------------------------------------------------------------------
+        // TESTING 'evaluate'
+        //
+        // Concerns:
+        //: 1 'evaluate' returns, for each rule indicated by the mask that
+        //:   exists in the set, the result of evaluating that rule against
+        //:   the attribute container list, including for rules that share
+        //:   predicates and for a rule having no predicates.
+        //:
+        //: 2 The bits of the result that correspond to rules not indicated by
+        //:   the mask, or to ids having no rule, are 0.
+        //:
+        //: 3 The result reflects rules added and removed by 'addRule',
+        //:   'removeRule', and 'removeAllRules', and the rules of a set that
+        //:   is copied or assigned.
+        //
+        // Plan:
+        //: 1 For a number of rule sets, containing various subsets of the
+        //:   rules in 'RULES', and for every attribute container list holding
+        //:   a subset of the attributes of the predicates in 'PREDICATES',
+        //:   compare the result of 'evaluate' with a mask computed by calling
+        //:   'Rule::evaluate' for each rule in the set.  (C-1..2)
+        //:
+        //: 2 Repeat P-1 after removing rules, after removing all rules and
+        //:   adding them back, and on copied and assigned rule sets.  (C-3)
+        //
+        // Testing:
+        //   MaskType evaluate(MaskType, const AttributeContainerList&) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'evaluate'" << endl
+                          << "==================" << endl;
+
+        static const struct {
+            int         d_line;      // source line number
+            const char *d_spec;      // rules to add
+            const char *d_removed;   // rules to then remove
+        } DATA[] = {
+            //LINE  SPEC                  REMOVED
+            //----  --------------------  -------
+            { L_,   "",                   ""       },
+            { L_,   "R0",                 ""       },
+            { L_,   "R1",                 ""       },
+            { L_,   "R1R2R3",             ""       },
+            { L_,   "R0R1R2R3R4R5R6R7R8", ""       },
+            { L_,   "R0R1R2R3R4R5R6R7R8", "R1R8"   },
+            { L_,   "R0R1R2R3R4R5R6R7R8", "R0R2R3" },
+            { L_,   "R2R3R6R8",           "R3R6"   },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        const Obj::MaskType MASKS[] = { 0, 1, 0x5a, 0x1ff, ~0u };
+        const int NUM_MASKS = sizeof MASKS / sizeof *MASKS;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE    = DATA[ti].d_line;
+            const char *SPEC    = DATA[ti].d_spec;
+            const char *REMOVED = DATA[ti].d_removed;
+
+            if (veryVerbose) { P_(LINE) P_(SPEC) P(REMOVED) }
+
+            Obj mX(&testAllocator);  const Obj& X = mX;
+            gg(&mX, SPEC);
+            for (const char *r = REMOVED; *r; r += 2) {
+                mX.removeRule(*RULES[r[1] - '0']);
+            }
+
+            Obj mY(X, &testAllocator);  const Obj& Y = mY;
+
+            Obj mZ(&testAllocator);  const Obj& Z = mZ;
+            gg(&mZ, "R7R8");
+            mZ = X;
+
+            // Removing all the rules and adding them back may assign them
+            // different ids.
+
+            Obj mW(&testAllocator);  const Obj& W = mW;
+            gg(&mW, "R0R1R2R3R4R5R6R7R8");
+            mW.removeAllRules();
+            mW.addRules(X);
+
+            const Obj *SETS[] = { &X, &Y, &Z, &W };
+            const int  NUM_SETS = sizeof SETS / sizeof *SETS;
+
+            for (int attrs = 0; attrs < (1 << NUM_PREDICATES); ++attrs) {
+                // Split the attributes between two containers.
+
+                ball::DefaultAttributeContainer c1(&testAllocator);
+                ball::DefaultAttributeContainer c2(&testAllocator);
+                for (int j = 0; j < NUM_PREDICATES; ++j) {
+                    if (attrs & (1 << j)) {
+                        (j % 2 ? c1 : c2).addAttribute(
+                                                   PREDICATES[j].attribute());
+                    }
+                }
+
+                ball::AttributeContainerList list(&testAllocator);
+                list.pushFront(&c1);
+                list.pushFront(&c2);
+
+                for (int si = 0; si < NUM_SETS; ++si) {
+                    const Obj& S = *SETS[si];
+
+                    for (int mi = 0; mi < NUM_MASKS; ++mi) {
+                        const Obj::MaskType MASK = MASKS[mi];
+
+                        Obj::MaskType expected = 0;
+                        for (int i = 0; i < S.maxNumRules(); ++i) {
+                            const ball::Rule *rule = S.getRuleById(i);
+                            if (rule && (MASK & (1u << i))
+                             && rule->evaluate(list)) {
+                                expected |= 1u << i;
+                            }
+                        }
+
+                        const Obj::MaskType result = S.evaluate(MASK, list);
+                        ASSERTV(LINE, attrs, si, MASK, expected, result,
+                                expected == result);
+                    }
+                }
+            }
+        }
+      } break;
       case 10: {
         // --------------------------------------------------------------------
         // TESTING NON-PRIMARY MANIPULATORS
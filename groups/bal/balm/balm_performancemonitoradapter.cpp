@@ -0,0 +1,297 @@
+// balm_performancemonitoradapter.cpp                                 -*-C++-*-
+#include <balm_performancemonitoradapter.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balm_performancemonitoradapter_cpp,"$Id$ $CSID$")
+
+#include <balm_category.h>
+#include <balm_metricregistry.h>
+
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+
+#include <bslma_default.h>
+
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+
+namespace BloombergLP {
+namespace {
+
+typedef balb::PerformanceMonitor                   PM;
+typedef balb::PerformanceMonitor::ThreadStatistics ThreadStatistics;
+
+struct ProcessMetric {
+    // Describes the metric published for a measure of a process.
+
+    PM::Measure  d_measure;  // measure of the process
+    const char  *d_name;     // metric name, following the description
+};
+
+const ProcessMetric k_PROCESS_METRICS[] = {
+    { PM::e_CPU_TIME,          ".cpuTime"       },
+    { PM::e_CPU_TIME_USER,     ".cpuTimeUser"   },
+    { PM::e_CPU_TIME_SYSTEM,   ".cpuTimeSystem" },
+    { PM::e_CPU_UTIL,          ".cpuUtil"       },
+    { PM::e_CPU_UTIL_USER,     ".cpuUtilUser"   },
+    { PM::e_CPU_UTIL_SYSTEM,   ".cpuUtilSystem" },
+    { PM::e_RESIDENT_SIZE,     ".residentSize"  },
+    { PM::e_NUM_THREADS,       ".numThreads"    },
+    { PM::e_NUM_PAGEFAULTS,    ".numPageFaults" },
+    { PM::e_VIRTUAL_SIZE,      ".virtualSize"   },
+    { PM::e_IO_READ,           ".ioRead"        },
+    { PM::e_IO_WRITE,          ".ioWrite"       }
+};
+
+const int k_NUM_PROCESS_METRICS =
+                       sizeof k_PROCESS_METRICS / sizeof *k_PROCESS_METRICS;
+
+double cpuUtil(const ThreadStatistics& stats)
+    // Return the CPU utilization of the specified 'stats'.
+{
+    return stats.cpuUtilUser() + stats.cpuUtilSystem();
+}
+
+double cpuUtilUser(const ThreadStatistics& stats)
+    // Return the user CPU utilization of the specified 'stats'.
+{
+    return stats.cpuUtilUser();
+}
+
+double cpuUtilSystem(const ThreadStatistics& stats)
+    // Return the system CPU utilization of the specified 'stats'.
+{
+    return stats.cpuUtilSystem();
+}
+
+double runQueueWaitUtil(const ThreadStatistics& stats)
+    // Return the run-queue wait utilization of the specified 'stats'.
+{
+    return stats.runQueueWaitUtil();
+}
+
+double voluntarySwitches(const ThreadStatistics& stats)
+    // Return the number of voluntary context switches of the specified
+    // 'stats'.
+{
+    return static_cast<double>(stats.numVoluntaryContextSwitches());
+}
+
+double involuntarySwitches(const ThreadStatistics& stats)
+    // Return the number of involuntary context switches of the specified
+    // 'stats'.
+{
+    return static_cast<double>(stats.numInvoluntaryContextSwitches());
+}
+
+double minorPageFaults(const ThreadStatistics& stats)
+    // Return the number of minor page faults of the specified 'stats'.
+{
+    return static_cast<double>(stats.numMinorPageFaults());
+}
+
+double majorPageFaults(const ThreadStatistics& stats)
+    // Return the number of major page faults of the specified 'stats'.
+{
+    return static_cast<double>(stats.numMajorPageFaults());
+}
+
+struct ThreadMetric {
+    // Describes the metric published for a measure of a group of threads.
+
+    double      (*d_measure)(const ThreadStatistics&);
+                              // measure of a thread
+
+    const char   *d_name;     // metric name, following the thread name
+};
+
+const ThreadMetric k_THREAD_METRICS[] = {
+    { &cpuUtil,             ".cpuUtil"             },
+    { &cpuUtilUser,         ".cpuUtilUser"         },
+    { &cpuUtilSystem,       ".cpuUtilSystem"       },
+    { &runQueueWaitUtil,    ".runQueueWaitUtil"    },
+    { &voluntarySwitches,   ".voluntarySwitches"   },
+    { &involuntarySwitches, ".involuntarySwitches" },
+    { &minorPageFaults,     ".minorPageFaults"     },
+    { &majorPageFaults,     ".majorPageFaults"     }
+};
+
+const int k_NUM_THREAD_METRICS =
+                         sizeof k_THREAD_METRICS / sizeof *k_THREAD_METRICS;
+
+bool nameLess(const ThreadStatistics *lhs, const ThreadStatistics *rhs)
+    // Return 'true' if the name of the specified 'lhs' thread is ordered
+    // before that of the specified 'rhs' thread, and 'false' otherwise.
+{
+    return lhs->name() < rhs->name();
+}
+
+}  // close unnamed namespace
+
+namespace balm {
+
+                      // -------------------------------
+                      // class PerformanceMonitorAdapter
+                      // -------------------------------
+
+// PRIVATE MANIPULATORS
+void PerformanceMonitorAdapter::collectMetricsCb(
+                                          bsl::vector<MetricRecord> *records,
+                                          bool                       )
+{
+    // The callback is invoked even if the category is disabled, in which case
+    // the records are ignored by the metrics manager.
+
+    if (!d_category_p->enabled()) {
+        return;                                                       // RETURN
+    }
+
+    for (PM::ConstIterator it  = d_monitor_p->begin();
+                           it != d_monitor_p->end();
+                         ++it) {
+        loadProcessRecords(records, *it);
+
+        it->loadThreadStatistics(&d_threads);
+        if (!d_threads.empty()) {
+            loadThreadRecords(records, it->description());
+        }
+    }
+}
+
+void PerformanceMonitorAdapter::loadProcessRecords(
+                                            bsl::vector<MetricRecord> *records,
+                                            const PM::Statistics&      stats)
+{
+    for (int i = 0; i < k_NUM_PROCESS_METRICS; ++i) {
+        const double value = stats.latestValue(k_PROCESS_METRICS[i].d_measure);
+
+        records->push_back(MetricRecord(metricId(stats.description(),
+                                                 k_PROCESS_METRICS[i].d_name),
+                                        1,
+                                        value,
+                                        value,
+                                        value));
+    }
+}
+
+void PerformanceMonitorAdapter::loadThreadRecords(
+                                       bsl::vector<MetricRecord> *records,
+                                       const bsl::string&         description)
+{
+    // Order the threads by name, so that the threads having the same name are
+    // adjacent.
+
+    d_sortedThreads.resize(d_threads.size());
+    for (bsl::size_t i = 0; i < d_threads.size(); ++i) {
+        d_sortedThreads[i] = &d_threads[i];
+    }
+    bsl::sort(d_sortedThreads.begin(), d_sortedThreads.end(), &nameLess);
+
+    bsl::string prefix(description, d_metricName.get_allocator());
+
+    bsl::size_t begin = 0;
+    while (begin < d_sortedThreads.size()) {
+        const bsl::string& name = d_sortedThreads[begin]->name();
+
+        bsl::size_t end = begin + 1;
+        while (end < d_sortedThreads.size()
+            && d_sortedThreads[end]->name() == name) {
+            ++end;
+        }
+
+        prefix.assign(description);
+        prefix.append(".threads.");
+        prefix.append(name);
+
+        for (int i = 0; i < k_NUM_THREAD_METRICS; ++i) {
+            MetricRecord record(metricId(prefix, k_THREAD_METRICS[i].d_name));
+
+            record.count() = static_cast<int>(end - begin);
+            for (bsl::size_t j = begin; j < end; ++j) {
+                const double value =
+                            k_THREAD_METRICS[i].d_measure(*d_sortedThreads[j]);
+
+                record.total() += value;
+                record.min()    = bsl::min(record.min(), value);
+                record.max()    = bsl::max(record.max(), value);
+            }
+            records->push_back(record);
+        }
+
+        begin = end;
+    }
+}
+
+MetricId PerformanceMonitorAdapter::metricId(const bsl::string&  prefix,
+                                             const char         *name)
+{
+    d_metricName.assign(prefix);
+    d_metricName.append(name);
+
+    return d_registry_p->getId(d_category_p->name(), d_metricName.c_str());
+}
+
+// CREATORS
+PerformanceMonitorAdapter::PerformanceMonitorAdapter(
+                                              MetricsManager   *manager,
+                                              const PM         *monitor,
+                                              const char       *category,
+                                              bslma::Allocator *basicAllocator)
+: d_manager_p(manager)
+, d_monitor_p(monitor)
+, d_category_p(0)
+, d_registry_p(0)
+, d_callbackHandle(MetricsManager::e_INVALID_HANDLE)
+, d_threads(basicAllocator)
+, d_sortedThreads(basicAllocator)
+, d_metricName(basicAllocator)
+{
+    BSLS_ASSERT(manager);
+    BSLS_ASSERT(monitor);
+    BSLS_ASSERT(category);
+
+    // The registry is obtained here, as the callback must not call the
+    // metrics manager.
+
+    d_registry_p = &d_manager_p->metricRegistry();
+    d_category_p = d_registry_p->getCategory(category);
+
+    d_callbackHandle = d_manager_p->registerCollectionCallback(
+                       d_category_p,
+                       bdlf::BindUtil::bindS(
+                                  bslma::Default::allocator(basicAllocator),
+                                  &PerformanceMonitorAdapter::collectMetricsCb,
+                                  this,
+                                  bdlf::PlaceHolders::_1,
+                                  bdlf::PlaceHolders::_2));
+}
+
+PerformanceMonitorAdapter::~PerformanceMonitorAdapter()
+{
+    const int rc = d_manager_p->removeCollectionCallback(d_callbackHandle);
+    (void)rc;
+
+    BSLS_ASSERT(0 == rc);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
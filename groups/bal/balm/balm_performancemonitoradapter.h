@@ -0,0 +1,319 @@
+// balm_performancemonitoradapter.h                                   -*-C++-*-
+#ifndef INCLUDED_BALM_PERFORMANCEMONITORADAPTER
+#define INCLUDED_BALM_PERFORMANCEMONITORADAPTER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a mechanism to publish performance statistics as metrics.
+//
+//@CLASSES:
+//  balm::PerformanceMonitorAdapter: publish performance statistics via 'balm'
+//
+//@SEE_ALSO: balb_performancemonitor, balm_metricsmanager
+//
+//@DESCRIPTION: This component provides a mechanism,
+// 'balm::PerformanceMonitorAdapter', that publishes the statistics collected
+// by a 'balb::PerformanceMonitor' through a 'balm::MetricsManager'.  On
+// construction, a 'PerformanceMonitorAdapter' object registers a
+// 'balm::MetricsManager::RecordsCollectionCallback' for a metric category
+// with the metrics manager, and removes it on destruction.  Each time the
+// metrics of that category are published (or sampled), the callback loads
+// the latest statistics collected by the performance monitor (see
+// 'balb::PerformanceMonitor::collect') for each monitored process into metric
+// records.  Note that the callback does not collect statistics itself, so the
+// performance monitor is typically configured to collect statistics at an
+// interval no longer than the publication interval of the category.
+//
+///Metric Names
+///------------
+// The metrics published for a monitored process are named after the
+// description supplied when the process was registered with the performance
+// monitor, so that descriptions should be unique among the monitored
+// processes.  For each process, a metric record having a 'count' of 1 and the
+// latest collected value as its 'total', 'min', and 'max' is published for
+// each measure, named as follows:
+//..
+//  Metric Name                          Measure
+//  -----------                          -------
+//  <description>.cpuTime                e_CPU_TIME
+//  <description>.cpuTimeUser            e_CPU_TIME_USER
+//  <description>.cpuTimeSystem          e_CPU_TIME_SYSTEM
+//  <description>.cpuUtil                e_CPU_UTIL
+//  <description>.cpuUtilUser            e_CPU_UTIL_USER
+//  <description>.cpuUtilSystem          e_CPU_UTIL_SYSTEM
+//  <description>.residentSize           e_RESIDENT_SIZE
+//  <description>.numThreads             e_NUM_THREADS
+//  <description>.numPageFaults          e_NUM_PAGEFAULTS
+//  <description>.virtualSize            e_VIRTUAL_SIZE
+//  <description>.ioRead                 e_IO_READ
+//  <description>.ioWrite                e_IO_WRITE
+//..
+// If per-thread statistics are collected (see
+// 'balb::PerformanceMonitor::setThreadStatisticsEnabled'), metrics are also
+// published for the threads of each process.  As the threads of a process
+// come and go, while the metrics registered with a 'balm::MetricRegistry' are
+// never removed, the threads of a process are grouped by name (e.g., all the
+// threads of a thread pool typically share the same name), and a metric
+// record is published for each group of threads having the same name, with
+// the number of threads in the group as its 'count', the sum of the values of
+// the threads as its 'total', and the minimum and maximum of those values as
+// its 'min' and 'max'.  The metric for a group of threads is named
+// '<description>.threads.<name>.<metric>', where '<name>' is the name of the
+// threads, and '<metric>' is one of the following:
+//..
+//  Metric                 Thread Measure
+//  ------                 --------------
+//  cpuUtil                cpuUtilUser + cpuUtilSystem
+//  cpuUtilUser            cpuUtilUser
+//  cpuUtilSystem          cpuUtilSystem
+//  runQueueWaitUtil       runQueueWaitUtil
+//  voluntarySwitches      numVoluntaryContextSwitches
+//  involuntarySwitches    numInvoluntaryContextSwitches
+//  minorPageFaults        numMinorPageFaults
+//  majorPageFaults        numMajorPageFaults
+//..
+// No records are loaded while the category is disabled.
+//
+///Thread Safety
+///-------------
+// The collection callback of a 'balm::PerformanceMonitorAdapter' object is
+// invoked by the metrics manager, which serializes the invocations of the
+// callbacks it holds.  The callback iterates over the statistics of the
+// performance monitor, so processes must not be unregistered from the
+// performance monitor while the metrics of the category are published (see
+// {'balb_performancemonitor'|Thread Safety}).
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Publishing Per-Thread CPU Utilization
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// In this example, we publish the CPU utilization of the current process, and
+// of each of its threads, through a metrics manager.
+//
+// First, we create a performance monitor collecting statistics, including
+// per-thread statistics, for the current process on demand:
+//..
+//  balb::PerformanceMonitor perfmon;
+//  perfmon.setThreadStatisticsEnabled(true);
+//
+//  int rc = perfmon.registerPid(0, "myProcess");
+//  assert(0 == rc);
+//..
+// Then, we create a metrics manager, and a 'balm::PerformanceMonitorAdapter'
+// object publishing the statistics of 'perfmon' in the "Performance"
+// category:
+//..
+//  balm::MetricsManager            manager;
+//  balm::PerformanceMonitorAdapter adapter(&manager, &perfmon, "Performance");
+//..
+// Next, we collect the statistics of the process twice, one second apart, so
+// that the CPU utilization over that second is available:
+//..
+//  perfmon.collect();
+//  bslmt::ThreadUtil::microSleep(0, 1);
+//  perfmon.collect();
+//..
+// Now, we sample the metrics of the metrics manager (a 'balm::Publisher'
+// would normally be used to publish them):
+//..
+//  balm::MetricSample              sample;
+//  bsl::vector<balm::MetricRecord> records;
+//
+//  manager.collectSample(&sample, &records);
+//..
+// Finally, we verify that the CPU utilization of the process was published,
+// as well as (on Linux) the metrics of its threads:
+//..
+//  const balm::MetricRecord *processCpu = 0;
+//  int                       numThreadMetrics = 0;
+//
+//  for (bsl::size_t i = 0; i < records.size(); ++i) {
+//      const bsl::string name = records[i].metricId().metricName();
+//
+//      if ("myProcess.cpuUtil" == name) {
+//          processCpu = &records[i];
+//      }
+//      if (0 == name.find("myProcess.threads.")) {
+//          ++numThreadMetrics;
+//      }
+//  }
+//
+//  assert(processCpu);
+//  assert(1 == processCpu->count());
+//
+//  #ifdef BSLS_PLATFORM_OS_LINUX
+//  assert(0 < numThreadMetrics);
+//  #endif
+//..
+
+#include <balscm_version.h>
+
+#include <balm_metricid.h>
+#include <balm_metricrecord.h>
+#include <balm_metricsmanager.h>
+
+#include <balb_performancemonitor.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace balm {
+
+class Category;
+class MetricRegistry;
+
+                      // ===============================
+                      // class PerformanceMonitorAdapter
+                      // ===============================
+
+class PerformanceMonitorAdapter {
+    // This mechanism registers, for the lifetime of the object, a callback
+    // with a metrics manager that loads the latest statistics collected by a
+    // performance monitor as metric records.
+
+    // PRIVATE TYPES
+    typedef balb::PerformanceMonitor::ThreadStatistics ThreadStatistics;
+
+    // DATA
+    MetricsManager                       *d_manager_p;     // metrics manager
+                                                           // (held, not
+                                                           // owned)
+
+    const balb::PerformanceMonitor       *d_monitor_p;     // performance
+                                                           // monitor (held,
+                                                           // not owned)
+
+    const Category                       *d_category_p;    // category of the
+                                                           // metrics
+
+    MetricRegistry                       *d_registry_p;    // registry of
+                                                           // 'd_manager_p'
+
+    MetricsManager::CallbackHandle        d_callbackHandle;
+                                                           // identifies the
+                                                           // callback
+
+    bsl::vector<ThreadStatistics>         d_threads;       // statistics of
+                                                           // the threads of a
+                                                           // process
+
+    bsl::vector<const ThreadStatistics *> d_sortedThreads; // 'd_threads'
+                                                           // ordered by name
+
+    bsl::string                           d_metricName;    // name of the
+                                                           // metric being
+                                                           // loaded
+
+    // NOT IMPLEMENTED
+    PerformanceMonitorAdapter(const PerformanceMonitorAdapter&);
+    PerformanceMonitorAdapter& operator=(const PerformanceMonitorAdapter&);
+
+    // PRIVATE MANIPULATORS
+    void collectMetricsCb(bsl::vector<MetricRecord> *records, bool resetFlag);
+        // Append to the specified 'records' the metric records holding the
+        // latest statistics collected by the performance monitor.  The
+        // specified 'resetFlag' is ignored, as the statistics of the
+        // performance monitor are not affected by their publication.  Note
+        // that this method matches the
+        // 'MetricsManager::RecordsCollectionCallback' prototype.
+
+    void loadProcessRecords(
+                   bsl::vector<MetricRecord>                   *records,
+                   const balb::PerformanceMonitor::Statistics&  stats);
+        // Append to the specified 'records' the metric records holding the
+        // latest value of each measure of the specified 'stats'.
+
+    void loadThreadRecords(bsl::vector<MetricRecord> *records,
+                           const bsl::string&         description);
+        // Append to the specified 'records' the metric records aggregating
+        // the statistics in 'd_threads' of the threads having the same name,
+        // for the process having the specified 'description'.
+
+    MetricId metricId(const bsl::string& prefix, const char *name);
+        // Return the identifier of the metric, of the category of this
+        // object, whose name is the concatenation of the specified 'prefix'
+        // and 'name', registering it if needed.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(PerformanceMonitorAdapter,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    PerformanceMonitorAdapter(
+                           MetricsManager                 *manager,
+                           const balb::PerformanceMonitor *monitor,
+                           const char                     *category,
+                           bslma::Allocator               *basicAllocator = 0);
+        // Create an object that publishes the statistics collected by the
+        // specified 'monitor' as metrics of the specified 'category' of the
+        // specified 'manager' (see {Metric Names}), by registering a
+        // collection callback with 'manager'.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior
+        // is undefined unless 'manager' and 'monitor' outlive this object.
+
+    ~PerformanceMonitorAdapter();
+        // Remove the collection callback registered by this object from the
+        // metrics manager, and destroy this object.
+
+    // ACCESSORS
+    const Category *category() const;
+        // Return the address of the category of the metrics published by
+        // this object.
+
+    const balb::PerformanceMonitor *monitor() const;
+        // Return the address of the performance monitor whose statistics are
+        // published by this object.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                      // -------------------------------
+                      // class PerformanceMonitorAdapter
+                      // -------------------------------
+
+// ACCESSORS
+inline
+const Category *PerformanceMonitorAdapter::category() const
+{
+    return d_category_p;
+}
+
+inline
+const balb::PerformanceMonitor *PerformanceMonitorAdapter::monitor() const
+{
+    return d_monitor_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,705 @@
+// balm_performancemonitoradapter.t.cpp                               -*-C++-*-
+#include <balm_performancemonitoradapter.h>
+
+#include <balm_category.h>
+#include <balm_metricrecord.h>
+#include <balm_metricsample.h>
+#include <balm_metricsmanager.h>
+
+#include <balb_performancemonitor.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadattributes.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_platform.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// 'balm::PerformanceMonitorAdapter' is a mechanism that registers a collection
+// callback with a 'balm::MetricsManager' for the lifetime of the object.  We
+// verify that the callback is registered and removed, and that the records it
+// loads hold the latest statistics of a 'balb::PerformanceMonitor', with the
+// statistics of the threads of a process aggregated by thread name.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] PerformanceMonitorAdapter(manager, monitor, category, allocator);
+// [ 2] ~PerformanceMonitorAdapter();
+//
+// ACCESSORS
+// [ 2] const balm::Category *category() const;
+// [ 2] const balb::PerformanceMonitor *monitor() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] CONCERN: PROCESS METRICS
+// [ 3] CONCERN: THREAD METRICS AGGREGATED BY NAME
+// [ 3] CONCERN: NO METRICS FOR A DISABLED CATEGORY
+// [ 4] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balm::PerformanceMonitorAdapter Obj;
+typedef balb::PerformanceMonitor        Monitor;
+
+static bool verbose;
+static bool veryVerbose;
+static bool veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+// ============================================================================
+//                       HELPER FUNCTIONS AND CLASSES
+// ----------------------------------------------------------------------------
+
+namespace {
+
+class BlockedThread {
+    // This functor waits on a barrier twice: once when it starts, and once
+    // to be released.
+
+    // DATA
+    bslmt::Barrier *d_barrier_p;  // barrier to wait on (held)
+
+  public:
+    // CREATORS
+    explicit BlockedThread(bslmt::Barrier *barrier)
+        // Create a functor that waits on the specified 'barrier'.
+    : d_barrier_p(barrier)
+    {
+    }
+
+    // ACCESSORS
+    void operator()() const
+        // Wait twice on the barrier referred to by this object.
+    {
+        d_barrier_p->wait();
+        d_barrier_p->wait();
+    }
+};
+
+const balm::MetricRecord *findRecord(
+                               const bsl::vector<balm::MetricRecord>&  records,
+                               const char                             *name)
+    // Return the address of the element of the specified 'records' whose
+    // metric has the specified 'name', or 0 if there is no such element.
+{
+    for (bsl::size_t i = 0; i < records.size(); ++i) {
+        if (0 == bsl::strcmp(records[i].metricId().metricName(), name)) {
+            return &records[i];                                       // RETURN
+        }
+    }
+    return 0;
+}
+
+int countRecords(const bsl::vector<balm::MetricRecord>&  records,
+                 const char                             *prefix)
+    // Return the number of elements of the specified 'records' whose metric
+    // name starts with the specified 'prefix'.
+{
+    int count = 0;
+    for (bsl::size_t i = 0; i < records.size(); ++i) {
+        if (0 == bsl::strncmp(records[i].metricId().metricName(),
+                              prefix,
+                              bsl::strlen(prefix))) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator         defaultAllocator("default",
+                                                  veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Publishing Per-Thread CPU Utilization
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// In this example, we publish the CPU utilization of the current process, and
+// of each of its threads, through a metrics manager.
+//
+// First, we create a performance monitor collecting statistics, including
+// per-thread statistics, for the current process on demand:
+//..
+    balb::PerformanceMonitor perfmon;
+    perfmon.setThreadStatisticsEnabled(true);
+
+    int rc = perfmon.registerPid(0, "myProcess");
+    ASSERT(0 == rc);
+//..
+// Then, we create a metrics manager, and a 'balm::PerformanceMonitorAdapter'
+// object publishing the statistics of 'perfmon' in the "Performance"
+// category:
+//..
+    balm::MetricsManager            manager;
+    balm::PerformanceMonitorAdapter adapter(&manager, &perfmon, "Performance");
+//..
+// Next, we collect the statistics of the process twice, one second apart, so
+// that the CPU utilization over that second is available:
+//..
+    perfmon.collect();
+    bslmt::ThreadUtil::microSleep(0, 1);
+    perfmon.collect();
+//..
+// Now, we sample the metrics of the metrics manager (a 'balm::Publisher'
+// would normally be used to publish them):
+//..
+    balm::MetricSample              sample;
+    bsl::vector<balm::MetricRecord> records;
+
+    manager.collectSample(&sample, &records);
+//..
+// Finally, we verify that the CPU utilization of the process was published,
+// as well as (on Linux) the metrics of its threads:
+//..
+    const balm::MetricRecord *processCpu = 0;
+    int                       numThreadMetrics = 0;
+
+    for (bsl::size_t i = 0; i < records.size(); ++i) {
+        const bsl::string name = records[i].metricId().metricName();
+
+        if ("myProcess.cpuUtil" == name) {
+            processCpu = &records[i];
+        }
+        if (0 == name.find("myProcess.threads.")) {
+            ++numThreadMetrics;
+        }
+    }
+
+    ASSERT(processCpu);
+    ASSERT(1 == processCpu->count());
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+    ASSERT(0 < numThreadMetrics);
+#endif
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CONCERN: LOADED RECORDS
+        //
+        // Concerns:
+        //: 1 A record having a 'count' of 1 and the latest value of the
+        //:   measure is loaded for each measure of each monitored process.
+        //:
+        //: 2 No thread records are loaded unless per-thread statistics are
+        //:   collected.
+        //:
+        //: 3 A record is loaded for each thread measure of each group of
+        //:   threads having the same name, having the number of threads in
+        //:   the group as its 'count', and the sum, minimum, and maximum of
+        //:   the values of the threads.
+        //:
+        //: 4 No records are loaded while the category is disabled.
+        //
+        // Plan:
+        //: 1 Register the current process with a performance monitor, collect
+        //:   its statistics, sample the metrics, and verify the process
+        //:   records.  (C-1..2)
+        //:
+        //: 2 Start three threads named "worker" and one named "single",
+        //:   enable per-thread statistics, collect, sample the metrics, and
+        //:   verify the thread records against the statistics loaded from
+        //:   the performance monitor.  (C-3)
+        //:
+        //: 3 Disable the category, sample the metrics, and verify that no
+        //:   records are loaded.  (C-4)
+        //
+        // Testing:
+        //   CONCERN: PROCESS METRICS
+        //   CONCERN: THREAD METRICS AGGREGATED BY NAME
+        //   CONCERN: NO METRICS FOR A DISABLED CATEGORY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: LOADED RECORDS" << endl
+                          << "=======================" << endl;
+
+        static const struct {
+            Monitor::Measure  d_measure;
+            const char       *d_name;
+        } PROCESS_METRICS[] = {
+            { Monitor::e_CPU_TIME,        "proc.cpuTime"       },
+            { Monitor::e_CPU_TIME_USER,   "proc.cpuTimeUser"   },
+            { Monitor::e_CPU_TIME_SYSTEM, "proc.cpuTimeSystem" },
+            { Monitor::e_CPU_UTIL,        "proc.cpuUtil"       },
+            { Monitor::e_CPU_UTIL_USER,   "proc.cpuUtilUser"   },
+            { Monitor::e_CPU_UTIL_SYSTEM, "proc.cpuUtilSystem" },
+            { Monitor::e_RESIDENT_SIZE,   "proc.residentSize"  },
+            { Monitor::e_NUM_THREADS,     "proc.numThreads"    },
+            { Monitor::e_NUM_PAGEFAULTS,  "proc.numPageFaults" },
+            { Monitor::e_VIRTUAL_SIZE,    "proc.virtualSize"   },
+            { Monitor::e_IO_READ,         "proc.ioRead"        },
+            { Monitor::e_IO_WRITE,        "proc.ioWrite"       }
+        };
+        const int NUM_PROCESS_METRICS =
+                           sizeof PROCESS_METRICS / sizeof *PROCESS_METRICS;
+
+        ASSERT(Monitor::e_NUM_MEASURES == NUM_PROCESS_METRICS);
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        Monitor              monitor(&ta);
+        balm::MetricsManager manager(&ta);
+        Obj                  mX(&manager, &monitor, "Performance", &ta);
+
+        ASSERT(0 == monitor.registerPid(0, "proc"));
+
+        bsl::vector<balm::MetricRecord> records(&ta);
+        balm::MetricSample              sample(&ta);
+
+        if (verbose) cout << "\tTesting process records" << endl;
+        {
+            monitor.collect();
+            manager.collectSample(&sample, &records);
+
+            ASSERTV(records.size(),
+                    NUM_PROCESS_METRICS == static_cast<int>(records.size()));
+
+            const Monitor::Statistics& stats = *monitor.begin();
+
+            for (int i = 0; i < NUM_PROCESS_METRICS; ++i) {
+                const balm::MetricRecord *record =
+                                findRecord(records, PROCESS_METRICS[i].d_name);
+
+                ASSERTV(i, record);
+                if (!record) {
+                    continue;
+                }
+
+                const double VALUE =
+                               stats.latestValue(PROCESS_METRICS[i].d_measure);
+
+                ASSERTV(i, 0 == bsl::strcmp("Performance",
+                                          record->metricId().categoryName()));
+                ASSERTV(i, 1     == record->count());
+                ASSERTV(i, VALUE == record->total());
+                ASSERTV(i, VALUE == record->min());
+                ASSERTV(i, VALUE == record->max());
+            }
+
+            ASSERT(0 == countRecords(records, "proc.threads."));
+        }
+
+        if (verbose) cout << "\tTesting thread records" << endl;
+
+        enum { k_NUM_WORKERS = 3 };
+
+        bslmt::Barrier            barrier(k_NUM_WORKERS + 2);
+        bslmt::ThreadUtil::Handle handles[k_NUM_WORKERS + 1];
+        bslmt::ThreadAttributes   attributes;
+
+        attributes.setThreadName("worker");
+        for (int i = 0; i < k_NUM_WORKERS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                  attributes,
+                                                  BlockedThread(&barrier)));
+        }
+        attributes.setThreadName("single");
+        ASSERT(0 == bslmt::ThreadUtil::create(&handles[k_NUM_WORKERS],
+                                              attributes,
+                                              BlockedThread(&barrier)));
+
+        // Wait for the threads to start, so that they are named.
+
+        barrier.wait();
+
+        monitor.setThreadStatisticsEnabled(true);
+        monitor.collect();
+        monitor.collect();
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+        {
+            records.clear();
+            manager.collectSample(&sample, &records);
+
+            bsl::vector<Monitor::ThreadStatistics> threads(&ta);
+            monitor.begin()->loadThreadStatistics(&threads);
+
+            static const char *const THREAD_METRICS[] = {
+                ".cpuUtil",
+                ".cpuUtilUser",
+                ".cpuUtilSystem",
+                ".runQueueWaitUtil",
+                ".voluntarySwitches",
+                ".involuntarySwitches",
+                ".minorPageFaults",
+                ".majorPageFaults"
+            };
+            const int NUM_THREAD_METRICS =
+                             sizeof THREAD_METRICS / sizeof *THREAD_METRICS;
+
+            ASSERT(8 * 2 <= countRecords(records, "proc.threads."));
+
+            const balm::MetricRecord *workers =
+                        findRecord(records, "proc.threads.worker.cpuUtil");
+            const balm::MetricRecord *single =
+                        findRecord(records, "proc.threads.single.cpuUtil");
+
+            ASSERT(workers);
+            ASSERT(single);
+
+            if (workers && single) {
+                ASSERTV(workers->count(), k_NUM_WORKERS == workers->count());
+                ASSERTV(single->count(),  1             == single->count());
+            }
+
+            for (int i = 0; i < NUM_THREAD_METRICS; ++i) {
+                bsl::string name("proc.threads.worker");
+                name += THREAD_METRICS[i];
+
+                const balm::MetricRecord *record =
+                                             findRecord(records, name.c_str());
+                ASSERTV(name, record);
+                if (!record) {
+                    continue;
+                }
+
+                ASSERTV(name, k_NUM_WORKERS == record->count());
+                ASSERTV(name, record->min() <= record->max());
+                ASSERTV(name, record->min() * k_NUM_WORKERS <=
+                                                              record->total());
+                ASSERTV(name, record->max() * k_NUM_WORKERS >=
+                                                              record->total());
+            }
+
+            // Verify the totals against the statistics of the threads.
+
+            double             minorPageFaults = 0;
+            bsls::Types::Int64 switches        = 0;
+            for (bsl::size_t i = 0; i < threads.size(); ++i) {
+                if ("worker" == threads[i].name()) {
+                    minorPageFaults += static_cast<double>(
+                                              threads[i].numMinorPageFaults());
+                   switches        += threads[i].numVoluntaryContextSwitches();
+                }
+            }
+
+            const balm::MetricRecord *faults =
+                  findRecord(records, "proc.threads.worker.minorPageFaults");
+            const balm::MetricRecord *voluntary =
+                  findRecord(records, "proc.threads.worker.voluntarySwitches");
+
+            ASSERT(faults    && minorPageFaults == faults->total());
+            ASSERT(voluntary && static_cast<double>(switches) ==
+                                                          voluntary->total());
+        }
+#endif
+
+        if (verbose) cout << "\tTesting a disabled category" << endl;
+        {
+            manager.setCategoryEnabled("Performance", false);
+
+            records.clear();
+            manager.collectSample(&sample, &records);
+
+            ASSERT(records.empty());
+        }
+
+        barrier.wait();
+        for (int i = 0; i < k_NUM_WORKERS + 1; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 The constructor registers a collection callback for the
+        //:   specified category, and the destructor removes it.
+        //:
+        //: 2 The accessors return the category and the performance monitor
+        //:   of the object.
+        //:
+        //: 3 Memory is obtained from the supplied allocator, or the default
+        //:   allocator if none is supplied, and all memory is released on
+        //:   destruction.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create objects with and without an allocator, verify the
+        //:   accessors, and verify that records of the category are loaded
+        //:   while the object exists, and not after it is destroyed.
+        //:   (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for null arguments.  (C-4)
+        //
+        // Testing:
+        //   PerformanceMonitorAdapter(manager, monitor, category, allocator);
+        //   ~PerformanceMonitorAdapter();
+        //   const balm::Category *category() const;
+        //   const balb::PerformanceMonitor *monitor() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND ACCESSORS" << endl
+                          << "======================" << endl;
+
+        bslma::TestAllocator ma("monitor", veryVeryVeryVerbose);
+
+        Monitor              monitor(&ma);
+        balm::MetricsManager manager(&ma);
+
+        ASSERT(0 == monitor.registerPid(0, "proc"));
+        monitor.setThreadStatisticsEnabled(true);
+        monitor.collect();
+
+        bsl::vector<balm::MetricRecord> records(&ma);
+        balm::MetricSample              sample(&ma);
+
+        for (char cfg = 'a'; cfg <= 'b'; ++cfg) {
+            const char CONFIG = cfg;
+
+            if (veryVerbose) { T_ P(CONFIG) }
+
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            bslma::TestAllocator& oa = 'a' == CONFIG ? defaultAllocator : sa;
+
+            {
+                Obj *objPtr = 'a' == CONFIG
+                            ? new (ma) Obj(&manager, &monitor, "Performance")
+                            : new (ma) Obj(&manager,
+                                           &monitor,
+                                           "Performance",
+                                           &sa);
+                Obj& mX = *objPtr; const Obj& X = mX;
+
+                ASSERTV(CONFIG, &monitor == X.monitor());
+                ASSERTV(CONFIG, X.category());
+                ASSERTV(CONFIG, X.category() ==
+                         manager.metricRegistry().findCategory("Performance"));
+                ASSERTV(CONFIG, 0 == bsl::strcmp("Performance",
+                                                 X.category()->name()));
+
+                records.clear();
+                manager.collectSample(&sample, &records);
+
+                ASSERTV(CONFIG, records.size(),
+                        Monitor::e_NUM_MEASURES <=
+                                            static_cast<int>(records.size()));
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+                ASSERTV(CONFIG, 0 < oa.numBlocksInUse());
+#endif
+
+                ma.deleteObject(objPtr);
+
+                ASSERTV(CONFIG, 0 == oa.numBlocksInUse());
+            }
+
+            records.clear();
+            manager.collectSample(&sample, &records);
+
+            ASSERTV(CONFIG, records.empty());
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_FAIL(Obj(0,        &monitor, "Performance"));
+            ASSERT_FAIL(Obj(&manager, 0,        "Performance"));
+            ASSERT_FAIL(Obj(&manager, &monitor, 0            ));
+            ASSERT_PASS(Obj(&manager, &monitor, "Performance"));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Publish the statistics of the current process in a category,
+        //:   and verify that records are loaded for the category.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        Monitor              monitor(&ta);
+        balm::MetricsManager manager(&ta);
+
+        ASSERT(0 == monitor.registerPid(0, "breathing"));
+        monitor.collect();
+
+        {
+            Obj mX(&manager, &monitor, "Breathing", &ta);
+
+            bsl::vector<balm::MetricRecord> records(&ta);
+            balm::MetricSample              sample(&ta);
+
+            manager.collectSample(&sample, &records);
+
+            ASSERT(!records.empty());
+            ASSERT(findRecord(records, "breathing.cpuUtil"));
+            ASSERT(findRecord(records, "breathing.residentSize"));
+
+            if (veryVerbose) {
+                for (bsl::size_t i = 0; i < records.size(); ++i) {
+                    cout << records[i] << endl;
+                }
+            }
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
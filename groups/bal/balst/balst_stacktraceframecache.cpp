@@ -0,0 +1,246 @@
+// balst_stacktraceframecache.cpp                                     -*-C++-*-
+#include <balst_stacktraceframecache.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balst_stacktraceframecache_cpp,"$Id$ $CSID$")
+
+#include <balst_objectfileformat.h>
+#include <balst_stacktraceresolverimpl_dladdr.h>
+#include <balst_stacktraceresolverimpl_elf.h>
+#include <balst_stacktraceresolverimpl_windows.h>
+#include <balst_stacktraceresolverimpl_xcoff.h>
+
+#include <bslma_default.h>
+
+#include <bslmt_once.h>
+
+#include <bsls_assert.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_platform.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_memory.h>
+#include <bsl_vector.h>
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+# include <link.h>
+#endif
+
+namespace BloombergLP {
+namespace {
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+int loadGenerationCallback(struct dl_phdr_info *info,
+                           bsl::size_t          size,
+                           void                *data)
+    // Load into the 'bsls::Types::Uint64' at the specified 'data' the total
+    // number of object files loaded and unloaded by the process, as reported
+    // in the specified 'info' having the specified 'size', if 'info' reports
+    // them, and return 1 to end the iteration.  Note that this function
+    // matches the prototype of the callback of 'dl_iterate_phdr'.
+{
+    if (size >= offsetof(struct dl_phdr_info, dlpi_subs)
+                                                   + sizeof info->dlpi_subs) {
+        *static_cast<bsls::Types::Uint64 *>(data) =
+                    static_cast<bsls::Types::Uint64>(info->dlpi_adds)
+                  + static_cast<bsls::Types::Uint64>(info->dlpi_subs);
+    }
+    return 1;
+}
+#endif
+
+bsls::Types::Uint64 loadGeneration()
+    // Return a value that changes whenever an object file is loaded into, or
+    // unloaded from, the process, or 0 if that is not known on this platform.
+{
+    bsls::Types::Uint64 generation = 0;
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    dl_iterate_phdr(&loadGenerationCallback, &generation);
+#endif
+
+    return generation;
+}
+
+}  // close unnamed namespace
+
+namespace balst {
+
+                        // --------------------------
+                        // class StackTraceFrameCache
+                        // --------------------------
+
+// CLASS METHODS
+StackTraceFrameCache& StackTraceFrameCache::singleton()
+{
+    // The singleton is constructed in static storage and never destroyed, so
+    // that stack traces can still be loaded while other static objects are
+    // being destroyed.
+
+    static bsls::ObjectBuffer<StackTraceFrameCache> s_singleton;
+
+    BSLMT_ONCE_DO {
+        new (s_singleton.buffer()) StackTraceFrameCache(
+                                           bslma::Default::globalAllocator());
+    }
+    return s_singleton.object();
+}
+
+// CREATORS
+StackTraceFrameCache::StackTraceFrameCache(bslma::Allocator *basicAllocator)
+: d_demangledFrames(bdlcc::CacheEvictionPolicy::e_LRU,
+                    k_DEFAULT_CAPACITY,
+                    k_DEFAULT_CAPACITY,
+                    basicAllocator)
+, d_mangledFrames(bdlcc::CacheEvictionPolicy::e_LRU,
+                  k_DEFAULT_CAPACITY,
+                  k_DEFAULT_CAPACITY,
+                  basicAllocator)
+, d_capacity(k_DEFAULT_CAPACITY)
+, d_numHits(0)
+, d_numMisses(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+StackTraceFrameCache::StackTraceFrameCache(bsl::size_t       capacity,
+                                           bslma::Allocator *basicAllocator)
+: d_demangledFrames(bdlcc::CacheEvictionPolicy::e_LRU,
+                    capacity,
+                    capacity,
+                    basicAllocator)
+, d_mangledFrames(bdlcc::CacheEvictionPolicy::e_LRU,
+                  capacity,
+                  capacity,
+                  basicAllocator)
+, d_capacity(capacity)
+, d_numHits(0)
+, d_numMisses(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < capacity);
+
+    // Note that, before inserting an item, a 'bdlcc::Cache' whose size has
+    // reached the high watermark evicts items until its size is below the low
+    // watermark, so that watermarks of 'capacity' bound its size by
+    // 'capacity'.
+}
+
+StackTraceFrameCache::~StackTraceFrameCache()
+{
+}
+
+// MANIPULATORS
+void StackTraceFrameCache::clear()
+{
+    d_demangledFrames.clear();
+    d_mangledFrames.clear();
+}
+
+int StackTraceFrameCache::loadStackTrace(
+                                   StackTrace         *result,
+                                   const void * const  addresses[],
+                                   int                 numAddresses,
+                                   bool                demanglingPreferredFlag)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(0 <= numAddresses);
+    BSLS_ASSERT(0 == numAddresses || addresses);
+
+    typedef StackTraceResolverImpl<ObjectFileFormat::Policy> Resolver;
+
+    FrameCache& cache = demanglingPreferredFlag ? d_demangledFrames
+                                                : d_mangledFrames;
+
+    // The frames cached before an object file was loaded or unloaded are not
+    // looked up, and the frames resolved below are cached under the
+    // generation observed before they were resolved, so that a frame resolved
+    // while an object file is loaded or unloaded is not loaded again (see
+    // {Unloaded Object Files}).
+
+    const bsls::Types::Uint64 generation = loadGeneration();
+
+    result->removeAll();
+    result->resize(numAddresses);
+
+    // Load the frames held in the cache, and gather the addresses of the
+    // others, so that they are resolved together in a single pass over the
+    // loaded object files.  Note that temporary memory is obtained from the
+    // allocator of 'result', which is a heap-bypass allocator by default.
+
+    bslma::Allocator *scratch = result->allocator();
+
+    bsl::vector<int>          missedIndices(scratch);
+    bsl::vector<const void *> missed(scratch);
+    FrameCache::ValuePtrType  frame;
+
+    for (int i = 0; i < numAddresses; ++i) {
+        if (0 == cache.tryGetValue(&frame,
+                                   FrameKey(generation, addresses[i]))) {
+            (*result)[i] = *frame;
+        }
+        else {
+            missedIndices.push_back(i);
+            missed.push_back(addresses[i]);
+        }
+    }
+
+    const int numMissed = static_cast<int>(missedIndices.size());
+
+    d_numHits.addRelaxed(numAddresses - numMissed);
+    if (0 == numMissed) {
+        return 0;                                                     // RETURN
+    }
+    d_numMisses.addRelaxed(numMissed);
+
+    // Recursion commonly repeats the same return address many times in a
+    // stack, so each distinct address is resolved only once.
+
+    bsl::sort(missed.begin(), missed.end());
+    missed.erase(bsl::unique(missed.begin(), missed.end()), missed.end());
+
+    StackTrace resolved(scratch);
+    resolved.resize(static_cast<int>(missed.size()));
+    for (int i = 0; i < resolved.length(); ++i) {
+        resolved[i].setAddress(missed[i]);
+    }
+
+    const int rc = Resolver::resolve(&resolved, demanglingPreferredFlag);
+
+    for (int i = 0; i < numMissed; ++i) {
+        const int index = missedIndices[i];
+
+        const bsl::vector<const void *>::const_iterator it =
+                                            bsl::lower_bound(missed.begin(),
+                                                             missed.end(),
+                                                             addresses[index]);
+        (*result)[index] = resolved[static_cast<int>(it - missed.begin())];
+    }
+
+    if (0 == rc) {
+        for (int i = 0; i < resolved.length(); ++i) {
+            cache.insert(FrameKey(generation, missed[i]), resolved[i]);
+        }
+    }
+    return rc;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,346 @@
+// balst_stacktraceframecache.h                                       -*-C++-*-
+#ifndef INCLUDED_BALST_STACKTRACEFRAMECACHE
+#define INCLUDED_BALST_STACKTRACEFRAMECACHE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a thread-safe cache of resolved stack-trace frames.
+//
+//@CLASSES:
+//  balst::StackTraceFrameCache: thread-safe LRU cache of resolved frames
+//
+//@SEE_ALSO: balst_stacktraceutil, bdlcc_cache
+//
+//@DESCRIPTION: This component provides a mechanism,
+// 'balst::StackTraceFrameCache', that loads 'balst::StackTrace' objects from
+// arrays of return addresses, remembering the resolved
+// 'balst::StackTraceFrame' for each address in a bounded, least-recently-used
+// cache.
+//
+// Resolving a stack trace (i.e., finding the symbol name, source file name,
+// and line number of each address) requires opening and parsing the symbol and
+// debug sections of every object file the addresses fall in, which typically
+// takes many milliseconds.  Programs that report stack traces from code paths
+// that may execute repeatedly (e.g., when logging a warning) tend to report
+// the same few call stacks over and over again.  A 'StackTraceFrameCache'
+// resolves each distinct address at most once while it remains in the cache:
+// addresses found in the cache are loaded without touching any object file,
+// and all addresses that are not found are resolved together, in a single
+// pass over the loaded object files, and then added to the cache.
+//
+// Because 'loadStackTrace' takes an array of addresses, capturing a stack
+// trace (which merely walks the stack, see 'bsls::StackAddressUtil' and
+// 'balst::StackTraceUtil::captureStackAddresses') is decoupled from resolving
+// it: the captured addresses may be resolved later, or by another thread.
+//
+// Frames are cached separately for demangled and non-demangled symbol names,
+// and 'capacity' applies to each of the two.  Frames of a stack trace whose
+// resolution failed are loaded as far as they were resolved, but are not
+// cached.
+//
+///Unloaded Object Files
+///---------------------
+// A frame is resolved from the object file mapped at its address when it is
+// resolved.  If that object file is unloaded (e.g., by 'dlclose') and another
+// one is later loaded at the same addresses, a frame cached for one of those
+// addresses no longer describes the code found there.
+//
+// On Linux, each frame is therefore cached together with the number of times
+// object files had been loaded and unloaded by the process (as reported by
+// 'dl_iterate_phdr') when it was resolved, and a frame is loaded from the
+// cache only if no object file has been loaded or unloaded since.  Frames
+// cached before an object file was loaded or unloaded are never loaded again,
+// and are eventually evicted.
+//
+// On other platforms, the cache is not aware of object files being loaded or
+// unloaded: a program that unloads object files while a
+// 'StackTraceFrameCache' (in particular the process-wide instance, see
+// {Process-Wide Cache}) holds frames must call 'clear' after unloading them,
+// or stack traces loaded from the cache may report the symbol names, source
+// file names, and line numbers of code that is no longer loaded.
+//
+///Process-Wide Cache
+///------------------
+// The class method 'StackTraceFrameCache::singleton' returns a process-wide
+// instance having the default capacity, 'k_DEFAULT_CAPACITY', that obtains
+// memory from the global allocator.  The singleton is created on first use and
+// is never destroyed, so that it may be used during the destruction of other
+// static objects.  Note that, on platforms other than Linux, the frames held
+// by the singleton must be cleared after object files are unloaded (see
+// {Unloaded Object Files}).
+//
+///Thread Safety
+///-------------
+// 'balst::StackTraceFrameCache' is fully thread-safe, meaning that all
+// non-creator methods may be invoked concurrently on the same object.  Note
+// that concurrent calls that miss the cache for the same address may each
+// resolve that address.
+//
+///Memory Usage
+///------------
+// Unlike 'balst::StackTraceUtil::loadStackTraceFromAddressArray', which (by
+// default) obtains all of its memory directly from virtual memory,
+// 'balst::StackTraceFrameCache' allocates the cached frames from the heap, and
+// is therefore not suitable for use from a signal handler or after the heap
+// may have been corrupted.
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Reporting Stack Traces from a Warning Path
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a function that detects and recovers from a suspicious,
+// but not fatal, condition, and that we would like the warning it reports to
+// show where it was called from.  Such a function may be called frequently,
+// from a handful of call sites, so the stack trace has to be cheap to obtain.
+//
+// First, we define the function reporting the warning.  It captures the return
+// addresses on the stack, which does not involve reading any object files,
+// and then resolves them through the process-wide cache:
+//..
+//  void reportWarning(bsl::ostream& stream, const char *message)
+//      // Write the specified 'message' followed by a stack trace of the
+//      // caller to the specified 'stream'.
+//  {
+//      void *addresses[16];
+//      int   numAddresses = bsls::StackAddressUtil::getStackAddresses(
+//                                                                 addresses,
+//                                                                 16);
+//
+//      balst::StackTrace stackTrace;
+//      balst::StackTraceFrameCache::singleton().loadStackTrace(&stackTrace,
+//                                                              addresses,
+//                                                              numAddresses);
+//
+//      stream << "WARNING: " << message << '\n';
+//      for (int i = 0; i < stackTrace.length(); ++i) {
+//          stream << "    " << stackTrace[i].symbolName() << '\n';
+//      }
+//  }
+//..
+// Then, we report the same warning from the same call site several times.
+// Only the first report resolves the addresses; the following ones find all
+// of them in the cache:
+//..
+//  balst::StackTraceFrameCache& cache =
+//                                    balst::StackTraceFrameCache::singleton();
+//
+//  const bsls::Types::Int64 numMisses = cache.numMisses();
+//
+//  bsl::ostringstream stream;
+//  for (int i = 0; i < 3; ++i) {
+//      reportWarning(stream, "recovered from unexpected state");
+//  }
+//
+//  assert(cache.numMisses() - numMisses <= 16);
+//  assert(0 < cache.numHits());
+//..
+
+#include <balscm_version.h>
+
+#include <balst_stacktrace.h>
+#include <balst_stacktraceframe.h>
+
+#include <bdlcc_cache.h>
+
+#include <bslh_hash.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_utility.h>
+
+namespace BloombergLP {
+namespace balst {
+
+                        // ==========================
+                        // class StackTraceFrameCache
+                        // ==========================
+
+class StackTraceFrameCache {
+    // This mechanism class loads stack traces from arrays of return addresses,
+    // caching the resolved frame for each address in a bounded LRU cache.
+    // This class is fully thread-safe (see {Thread Safety}).
+
+    // PRIVATE TYPES
+    typedef bsl::pair<bsls::Types::Uint64, const void *> FrameKey;
+        // load generation (see {Unloaded Object Files}) and address of a
+        // cached frame
+
+    typedef bdlcc::Cache<FrameKey, StackTraceFrame, bslh::Hash<> > FrameCache;
+
+    // DATA
+    FrameCache         d_demangledFrames;  // frames resolved with demangling
+
+    FrameCache         d_mangledFrames;    // frames resolved without
+                                           // demangling
+
+    bsl::size_t        d_capacity;         // maximum number of frames in each
+                                           // of the caches
+
+    bsls::AtomicInt64  d_numHits;          // number of addresses loaded from
+                                           // the cache
+
+    bsls::AtomicInt64  d_numMisses;        // number of addresses resolved
+
+    bslma::Allocator  *d_allocator_p;      // memory allocator (held, not
+                                           // owned)
+
+  private:
+    // NOT IMPLEMENTED
+    StackTraceFrameCache(const StackTraceFrameCache&);
+    StackTraceFrameCache& operator=(const StackTraceFrameCache&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(StackTraceFrameCache,
+                                   bslma::UsesBslmaAllocator);
+
+    // PUBLIC CONSTANTS
+    enum { k_DEFAULT_CAPACITY = 4096 };  // default maximum number of cached
+                                         // frames
+
+    // CLASS METHODS
+    static StackTraceFrameCache& singleton();
+        // Return a reference providing modifiable access to the process-wide
+        // stack-trace frame cache, creating it, with a capacity of
+        // 'k_DEFAULT_CAPACITY' and using the global allocator, if this method
+        // has not previously been called.  This method is thread-safe.  Note
+        // that the returned cache is never destroyed, and that, on platforms
+        // other than Linux, 'clear' must be called on it after object files
+        // are unloaded (see {Unloaded Object Files}).
+
+    // CREATORS
+    explicit StackTraceFrameCache(bslma::Allocator *basicAllocator = 0);
+    explicit StackTraceFrameCache(bsl::size_t       capacity,
+                                  bslma::Allocator *basicAllocator = 0);
+        // Create an empty stack-trace frame cache.  Optionally specify the
+        // 'capacity', the maximum number of frames retained for each of the
+        // demangled and non-demangled symbol names; if 'capacity' is not
+        // specified, 'k_DEFAULT_CAPACITY' is used.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless '0 < capacity'.
+
+    ~StackTraceFrameCache();
+        // Destroy this object.
+
+    // MANIPULATORS
+    void clear();
+        // Remove all frames from this cache.  Note that the values reported by
+        // 'numHits' and 'numMisses' are not affected.  Also note that this
+        // method must be called after object files are unloaded on platforms
+        // other than Linux (see {Unloaded Object Files}).
+
+    int loadStackTrace(StackTrace         *result,
+                       const void * const  addresses[],
+                       int                 numAddresses,
+                       bool                demanglingPreferredFlag = true);
+        // Load into the specified 'result' a description of the stack
+        // described by the specified array of 'addresses' of length
+        // 'numAddresses', loading the frames of the addresses that are held
+        // in this cache from the cache, and resolving the other addresses
+        // (see 'StackTraceUtil::loadStackTraceFromAddressArray') and adding
+        // their frames to this cache.  Optionally specify
+        // 'demanglingPreferredFlag' to indicate whether or not to attempt to
+        // demangle symbol names; if 'demanglingPreferredFlag' is not
+        // specified, demangling is attempted.  Any frames previously contained
+        // in 'result' are discarded.  Return 0 on success, and a non-zero
+        // value otherwise.  The behavior is undefined unless
+        // '0 <= numAddresses' and 'addresses' contains at least
+        // 'numAddresses' addresses.  Note that the frames of 'result' are not
+        // cached if the addresses could not be resolved.  Also note that, on
+        // Linux, frames cached before an object file was last loaded or
+        // unloaded are not loaded from this cache.
+
+    // ACCESSORS
+    bsl::size_t capacity() const;
+        // Return the maximum number of frames this cache retains for each of
+        // the demangled and non-demangled symbol names.
+
+    bsls::Types::Int64 numHits() const;
+        // Return the number of addresses loaded from this cache by
+        // 'loadStackTrace' since this object was created.
+
+    bsls::Types::Int64 numMisses() const;
+        // Return the number of addresses that 'loadStackTrace' did not find in
+        // this cache since this object was created.
+
+    bsl::size_t numFrames() const;
+        // Return the number of frames currently held in this cache.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                        // --------------------------
+                        // class StackTraceFrameCache
+                        // --------------------------
+
+// ACCESSORS
+inline
+bsl::size_t StackTraceFrameCache::capacity() const
+{
+    return d_capacity;
+}
+
+inline
+bsls::Types::Int64 StackTraceFrameCache::numHits() const
+{
+    return d_numHits.loadRelaxed();
+}
+
+inline
+bsls::Types::Int64 StackTraceFrameCache::numMisses() const
+{
+    return d_numMisses.loadRelaxed();
+}
+
+inline
+bsl::size_t StackTraceFrameCache::numFrames() const
+{
+    return d_demangledFrames.size() + d_mangledFrames.size();
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *StackTraceFrameCache::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1015 @@
+// balst_stacktraceframecache.t.cpp                                   -*-C++-*-
+#include <balst_stacktraceframecache.h>
+
+#include <balst_objectfileformat.h>
+#include <balst_stacktrace.h>
+#include <balst_stacktraceframe.h>
+#include <balst_stacktraceresolverimpl_dladdr.h>
+#include <balst_stacktraceresolverimpl_elf.h>
+#include <balst_stacktraceresolverimpl_windows.h>
+#include <balst_stacktraceresolverimpl_xcoff.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_platform.h>
+#include <bsls_stackaddressutil.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+# include <dlfcn.h>
+#endif
+
+#if defined(BSLS_PLATFORM_OS_WINDOWS)
+// 'getStackAddresses' will not be able to trace through our stack frames if
+// we're optimized on Windows
+
+# pragma optimize("", off)
+#endif
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// 'balst::StackTraceFrameCache' is a thread-safe mechanism that loads stack
+// traces from arrays of return addresses, delegating the resolution of the
+// addresses it does not hold to the platform's stack-trace resolver.  We
+// verify that the frames it loads are those the resolver produces, that the
+// number of hits and misses reflects the addresses actually resolved, that
+// the cache is bounded, that the cache can be used concurrently, and that
+// cached frames are not loaded after object files are loaded or unloaded.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 5] StackTraceFrameCache& singleton();
+//
+// CREATORS
+// [ 2] explicit StackTraceFrameCache(bslma::Allocator *ba = 0);
+// [ 2] explicit StackTraceFrameCache(size_t capacity, Allocator *ba = 0);
+// [ 2] ~StackTraceFrameCache();
+//
+// MANIPULATORS
+// [ 3] void clear();
+// [ 3] int loadStackTrace(StackTrace *, const void * const *, int, bool);
+//
+// ACCESSORS
+// [ 2] bsl::size_t capacity() const;
+// [ 3] bsls::Types::Int64 numHits() const;
+// [ 3] bsls::Types::Int64 numMisses() const;
+// [ 3] bsl::size_t numFrames() const;
+// [ 2] bslma::Allocator *allocator() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCURRENCY
+// [ 6] CONCERN: FRAMES ARE NOT LOADED AFTER OBJECT FILES CHANGE
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE: CACHED VS. UNCACHED RESOLUTION
+//-----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+#define ASSERT_PASS_RAW(EXPR)  BSLS_ASSERTTEST_ASSERT_PASS_RAW(EXPR)
+#define ASSERT_FAIL_RAW(EXPR)  BSLS_ASSERTTEST_ASSERT_FAIL_RAW(EXPR)
+
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balst::StackTraceFrameCache                       Obj;
+typedef balst::StackTrace                                 ST;
+typedef balst::StackTraceFrame                            Frame;
+typedef balst::StackTraceResolverImpl<balst::ObjectFileFormat::Policy>
+                                                          Resolver;
+
+static int verbose;
+static int veryVerbose;
+static int veryVeryVerbose;
+
+enum { k_MAX_ADDRESSES = 128 };
+
+// ============================================================================
+//                      HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int recurseAndCapture(void **addresses, int maxAddresses, int *depth)
+    // Recurse the specified 'depth' number of times, then load into the
+    // specified 'addresses' the return addresses on the stack of the current
+    // thread, up to the specified 'maxAddresses'.  Return the number of
+    // addresses loaded.
+{
+    int numAddresses;
+
+    if (--*depth > 0) {
+        numAddresses = recurseAndCapture(addresses, maxAddresses, depth);
+    }
+    else {
+        numAddresses = bsls::StackAddressUtil::getStackAddresses(addresses,
+                                                                 maxAddresses);
+    }
+
+    ++*depth;   // Prevent compiler from optimizing tail recursion as a loop.
+
+    return numAddresses;
+}
+
+int loadDirectly(ST                 *result,
+                 const void * const  addresses[],
+                 int                 numAddresses,
+                 bool                demangle)
+    // Load into the specified 'result' the frames of the specified
+    // 'numAddresses' 'addresses' resolved directly by the platform's resolver,
+    // demangling symbol names if the specified 'demangle' is 'true'.  Return
+    // the status of the resolver.
+{
+    result->removeAll();
+    result->resize(numAddresses);
+    for (int i = 0; i < numAddresses; ++i) {
+        (*result)[i].setAddress(addresses[i]);
+    }
+    return Resolver::resolve(result, demangle);
+}
+
+int numDistinct(const void * const addresses[], int numAddresses)
+    // Return the number of distinct values among the specified 'numAddresses'
+    // 'addresses'.
+{
+    bsl::vector<const void *> v(addresses, addresses + numAddresses);
+    bsl::sort(v.begin(), v.end());
+    return static_cast<int>(bsl::unique(v.begin(), v.end()) - v.begin());
+}
+
+struct LoadThread {
+    // This 'struct' provides a functor loading the same stack trace
+    // repeatedly from a shared cache, and verifying the loaded frames.
+
+    // DATA
+    Obj                *d_cache_p;         // shared cache
+    const void * const *d_addresses;       // addresses to load
+    int                 d_numAddresses;    // number of addresses
+    const ST           *d_expected_p;      // expected stack trace
+    int                 d_numIterations;   // number of loads
+    int                 d_numFailures;     // number of mismatches (output)
+
+    // MANIPULATORS
+    void operator()()
+        // Load the stack trace 'd_numIterations' times, counting the loads
+        // that do not yield the expected stack trace in 'd_numFailures'.
+    {
+        for (int i = 0; i < d_numIterations; ++i) {
+            ST st;
+            if (0 != d_cache_p->loadStackTrace(&st,
+                                               d_addresses,
+                                               d_numAddresses)
+             || st != *d_expected_p) {
+                ++d_numFailures;
+            }
+        }
+    }
+};
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace {
+
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Reporting Stack Traces from a Warning Path
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a function that detects and recovers from a suspicious,
+// but not fatal, condition, and that we would like the warning it reports to
+// show where it was called from.  Such a function may be called frequently,
+// from a handful of call sites, so the stack trace has to be cheap to obtain.
+//
+// First, we define the function reporting the warning.  It captures the return
+// addresses on the stack, which does not involve reading any object files,
+// and then resolves them through the process-wide cache:
+//..
+    void reportWarning(bsl::ostream& stream, const char *message)
+        // Write the specified 'message' followed by a stack trace of the
+        // caller to the specified 'stream'.
+    {
+        void *addresses[16];
+        int   numAddresses = bsls::StackAddressUtil::getStackAddresses(
+                                                                   addresses,
+                                                                   16);
+
+        balst::StackTrace stackTrace;
+        balst::StackTraceFrameCache::singleton().loadStackTrace(&stackTrace,
+                                                                addresses,
+                                                                numAddresses);
+
+        stream << "WARNING: " << message << '\n';
+        for (int i = 0; i < stackTrace.length(); ++i) {
+            stream << "    " << stackTrace[i].symbolName() << '\n';
+        }
+    }
+//..
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test        = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    verbose         = argc > 2;
+    veryVerbose     = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Then, we report the same warning from the same call site several times.
+// Only the first report resolves the addresses; the following ones find all
+// of them in the cache:
+//..
+    balst::StackTraceFrameCache& cache =
+                                      balst::StackTraceFrameCache::singleton();
+
+    const bsls::Types::Int64 numMisses = cache.numMisses();
+
+    bsl::ostringstream stream;
+    for (int i = 0; i < 3; ++i) {
+        reportWarning(stream, "recovered from unexpected state");
+    }
+
+    ASSERT(cache.numMisses() - numMisses <= 16);
+    ASSERT(0 < cache.numHits());
+//..
+
+        if (veryVerbose) cout << stream.str();
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCERN: FRAMES ARE NOT LOADED AFTER OBJECT FILES CHANGE
+        //
+        // Concerns:
+        //: 1 On Linux, frames cached before an object file is loaded are not
+        //:   loaded from the cache afterwards.
+        //:
+        //: 2 On Linux, frames cached before an object file is unloaded are not
+        //:   loaded from the cache afterwards.
+        //:
+        //: 3 Frames are loaded from the cache again once they are resolved
+        //:   after the object file is loaded or unloaded.
+        //
+        // Plan:
+        //: 1 Load a captured stack trace twice, and verify that the second
+        //:   load hits the cache.
+        //:
+        //: 2 On Linux, load a shared library that is not already loaded with
+        //:   'dlopen', and verify that the next load of the stack trace misses
+        //:   the cache for every address, and that the load following it hits
+        //:   the cache.  (C-1, 3)
+        //:
+        //: 3 Unload the library with 'dlclose', and verify the same.  (C-2..3)
+        //
+        // Testing:
+        //   CONCERN: FRAMES ARE NOT LOADED AFTER OBJECT FILES CHANGE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+              << "CONCERN: FRAMES ARE NOT LOADED AFTER OBJECT FILES CHANGE"
+              << endl
+              << "========================================================"
+              << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        void *addresses[k_MAX_ADDRESSES];
+        int   depth        = 3;
+        int   numAddresses = recurseAndCapture(addresses,
+                                               k_MAX_ADDRESSES,
+                                               &depth);
+        ASSERT(0 < numAddresses);
+
+        const int NUM = numAddresses;
+
+        ST expected;
+        ASSERT(0 == loadDirectly(&expected, addresses, NUM, true));
+
+        ST st;
+        ASSERT(0 == mX.loadStackTrace(&st, addresses, NUM));
+        ASSERT(expected == st);
+        ASSERTV(NUM, X.numMisses(), NUM == X.numMisses());
+
+        ASSERT(0 == mX.loadStackTrace(&st, addresses, NUM));
+        ASSERT(expected == st);
+        ASSERTV(NUM, X.numHits(), NUM == X.numHits());
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+        // Find a library that is not already loaded.
+
+        static const char *const LIBRARIES[] = {
+            "libz.so.1",
+            "libutil.so.1",
+            "libresolv.so.2",
+            "libanl.so.1",
+            "libnss_files.so.2"
+        };
+        const int NUM_LIBRARIES = sizeof LIBRARIES / sizeof *LIBRARIES;
+
+        void *handle = 0;
+        for (int i = 0; i < NUM_LIBRARIES && !handle; ++i) {
+            void *loaded = dlopen(LIBRARIES[i], RTLD_NOW | RTLD_NOLOAD);
+            if (loaded) {
+                dlclose(loaded);
+                continue;
+            }
+            handle = dlopen(LIBRARIES[i], RTLD_NOW);
+
+            if (veryVerbose && handle) { T_ P(LIBRARIES[i]) }
+        }
+
+        if (!handle) {
+            if (verbose) cout << "\tNo library to load: skipped." << endl;
+            break;
+        }
+
+        if (verbose) cout << "\tAfter loading a library." << endl;
+
+        ASSERT(0 == mX.loadStackTrace(&st, addresses, NUM));
+        ASSERT(expected == st);
+        ASSERTV(NUM, X.numMisses(), 2 * NUM == X.numMisses());
+
+        ASSERT(0 == mX.loadStackTrace(&st, addresses, NUM));
+        ASSERT(expected == st);
+        ASSERTV(NUM, X.numHits(), 2 * NUM == X.numHits());
+
+        if (verbose) cout << "\tAfter unloading the library." << endl;
+
+        ASSERT(0 == dlclose(handle));
+
+        ASSERT(0 == mX.loadStackTrace(&st, addresses, NUM));
+        ASSERT(expected == st);
+        ASSERTV(NUM, X.numMisses(), 3 * NUM == X.numMisses());
+
+        ASSERT(0 == mX.loadStackTrace(&st, addresses, NUM));
+        ASSERT(expected == st);
+        ASSERTV(NUM, X.numHits(), 3 * NUM == X.numHits());
+#endif
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CLASS METHOD 'singleton'
+        //
+        // Concerns:
+        //: 1 'singleton' returns the same object on every call.
+        //:
+        //: 2 The singleton has the default capacity and uses the global
+        //:   allocator.
+        //:
+        //: 3 The singleton loads stack traces.
+        //
+        // Plan:
+        //: 1 Call 'singleton' twice and compare the addresses.  (C-1)
+        //:
+        //: 2 Verify 'capacity' and 'allocator' of the singleton.  (C-2)
+        //:
+        //: 3 Load a captured stack trace through the singleton and compare it
+        //:   with the one loaded by the resolver.  (C-3)
+        //
+        // Testing:
+        //   StackTraceFrameCache& singleton();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CLASS METHOD 'singleton'" << endl
+                          << "========================" << endl;
+
+        Obj& mX = Obj::singleton();  const Obj& X = mX;
+
+        ASSERT(&mX == &Obj::singleton());
+        ASSERT(Obj::k_DEFAULT_CAPACITY == X.capacity());
+        ASSERT(bslma::Default::globalAllocator() == X.allocator());
+
+        void *addresses[k_MAX_ADDRESSES];
+        int   depth        = 3;
+        int   numAddresses = recurseAndCapture(addresses,
+                                               k_MAX_ADDRESSES,
+                                               &depth);
+        ASSERT(0 < numAddresses);
+
+        ST expected;
+        ASSERT(0 == loadDirectly(&expected, addresses, numAddresses, true));
+
+        ST st;
+        ASSERT(0 == mX.loadStackTrace(&st, addresses, numAddresses));
+        ASSERT(expected == st);
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY
+        //
+        // Concerns:
+        //: 1 Concurrent calls to 'loadStackTrace' on the same object, some of
+        //:   which miss the cache and some of which hit it, all load the
+        //:   expected stack trace.
+        //:
+        //: 2 Concurrent eviction does not corrupt the cache.
+        //
+        // Plan:
+        //: 1 Capture two stack traces and resolve them directly.
+        //:
+        //: 2 Using caches of the default capacity and of a capacity smaller
+        //:   than the number of distinct addresses, start several threads
+        //:   each of which repeatedly loads one of the two stack traces from
+        //:   the shared cache, and verify that every load yields the expected
+        //:   stack trace.  (C-1..2)
+        //
+        // Testing:
+        //   CONCURRENCY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY" << endl
+                          << "===========" << endl;
+
+        enum { k_NUM_THREADS = 8, k_NUM_ITERATIONS = 50 };
+
+        void *addressesA[k_MAX_ADDRESSES];
+        void *addressesB[k_MAX_ADDRESSES];
+        int   depth = 2;
+        int   numA  = recurseAndCapture(addressesA, k_MAX_ADDRESSES, &depth);
+        depth       = 6;
+        int   numB  = recurseAndCapture(addressesB, k_MAX_ADDRESSES, &depth);
+
+        ST expectedA, expectedB;
+        ASSERT(0 == loadDirectly(&expectedA, addressesA, numA, true));
+        ASSERT(0 == loadDirectly(&expectedB, addressesB, numB, true));
+
+        const bsl::size_t CAPACITIES[] = { Obj::k_DEFAULT_CAPACITY, 3 };
+
+        for (int ci = 0; ci < 2; ++ci) {
+            const bsl::size_t CAPACITY = CAPACITIES[ci];
+
+            if (veryVerbose) { T_ P(CAPACITY) }
+
+            bslma::TestAllocator ta("object", veryVeryVerbose);
+            {
+                Obj mX(CAPACITY, &ta);
+
+                LoadThread               functors[k_NUM_THREADS];
+                bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+
+                for (int i = 0; i < k_NUM_THREADS; ++i) {
+                    LoadThread& f = functors[i];
+
+                    f.d_cache_p       = &mX;
+                    f.d_addresses     = i % 2 ? addressesA : addressesB;
+                    f.d_numAddresses  = i % 2 ? numA       : numB;
+                    f.d_expected_p    = i % 2 ? &expectedA : &expectedB;
+                    f.d_numIterations = k_NUM_ITERATIONS;
+                    f.d_numFailures   = 0;
+
+                    ASSERTV(i, 0 == bslmt::ThreadUtil::create(&handles[i],
+                                                              f));
+                }
+                for (int i = 0; i < k_NUM_THREADS; ++i) {
+                    ASSERTV(i, 0 == bslmt::ThreadUtil::join(handles[i]));
+                }
+
+                // The functors were copied into the threads, so verify the
+                // results by loading once more.
+
+                ST st;
+                ASSERT(0 == mX.loadStackTrace(&st, addressesA, numA));
+                ASSERT(expectedA == st);
+                ASSERT(0 == mX.loadStackTrace(&st, addressesB, numB));
+                ASSERT(expectedB == st);
+
+                ASSERTV(CAPACITY, mX.numFrames(), mX.numFrames() <= CAPACITY);
+                ASSERT(k_NUM_THREADS * k_NUM_ITERATIONS / 2 * (numA + numB)
+                                                 + numA + numB
+                                         == mX.numHits() + mX.numMisses());
+            }
+            ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // MANIPULATOR 'loadStackTrace'
+        //
+        // Concerns:
+        //: 1 'loadStackTrace' loads the same frames as the resolver, whether
+        //:   the addresses are held in the cache or not.
+        //:
+        //: 2 Only the addresses not held in the cache are counted as misses,
+        //:   each distinct address is cached once, and the other addresses
+        //:   are counted as hits.
+        //:
+        //: 3 Frames resolved with and without demangling are cached
+        //:   separately.
+        //:
+        //: 4 Frames previously held in 'result' are discarded, and 'result'
+        //:   uses its own allocator.
+        //:
+        //: 5 The cache holds at most 'capacity' frames for each demangling
+        //:   mode, and evicts the least-recently-used frame first.
+        //:
+        //: 6 'clear' removes all frames, but does not reset the counters.
+        //:
+        //: 7 No memory is obtained from the default allocator, and all memory
+        //:   is returned when the object is destroyed.
+        //:
+        //: 8 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Capture a stack trace with repeated addresses from a recursive
+        //:   function, and resolve it directly with and without demangling.
+        //:
+        //: 2 Load the stack trace twice, and verify the loaded frames and the
+        //:   accessors after each load.  (C-1..2)
+        //:
+        //: 3 Load the stack trace without demangling, and verify the frames
+        //:   and that all addresses missed.  (C-3)
+        //:
+        //: 4 Load into a stack trace that already has frames and uses a
+        //:   distinct test allocator.  (C-4)
+        //:
+        //: 5 Using a cache of capacity 2, load stack traces of single
+        //:   addresses in a sequence that exercises the LRU eviction.  (C-5)
+        //:
+        //: 6 Call 'clear', and verify the accessors.  (C-6)
+        //:
+        //: 7 Install a test allocator as the default allocator, and verify it
+        //:   is unused; verify that the object allocator has no blocks in use
+        //:   after the object is destroyed.  (C-7)
+        //:
+        //: 8 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-8)
+        //
+        // Testing:
+        //   int loadStackTrace(StackTrace *, const void * const *, int, bool);
+        //   void clear();
+        //   bsls::Types::Int64 numHits() const;
+        //   bsls::Types::Int64 numMisses() const;
+        //   bsl::size_t numFrames() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MANIPULATOR 'loadStackTrace'" << endl
+                          << "============================" << endl;
+
+        void *addresses[k_MAX_ADDRESSES];
+        int   depth        = 5;
+        int   numAddresses = recurseAndCapture(addresses,
+                                               k_MAX_ADDRESSES,
+                                               &depth);
+        ASSERT(0 < numAddresses);
+
+        const int NUM      = numAddresses;
+        const int DISTINCT = numDistinct(addresses, NUM);
+
+        if (veryVerbose) { T_ P_(NUM) P(DISTINCT) }
+
+        ASSERT(DISTINCT < NUM);    // recursion repeats return addresses
+
+        ST demangled, mangled;
+        ASSERT(0 == loadDirectly(&demangled, addresses, NUM, true));
+        ASSERT(0 == loadDirectly(&mangled,   addresses, NUM, false));
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        bslma::TestAllocator sa("stack trace", veryVeryVerbose);
+
+        bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+        if (verbose) cout << "\tLoad, hit, and demangling.\n";
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ST st(&sa);
+
+            ASSERT(0 == mX.loadStackTrace(&st, addresses, 0));
+            ASSERT(0 == st.length());
+            ASSERT(0 == X.numHits());
+            ASSERT(0 == X.numMisses());
+            ASSERT(0 == X.numFrames());
+
+            ASSERT(0 == mX.loadStackTrace(&st, addresses, NUM));
+            ASSERT(demangled == st);
+            ASSERTV(X.numHits(),   0   == X.numHits());
+            ASSERTV(X.numMisses(), NUM == X.numMisses());
+            ASSERTV(X.numFrames(), DISTINCT == static_cast<int>(
+                                                               X.numFrames()));
+
+            ASSERT(0 == mX.loadStackTrace(&st, addresses, NUM));
+            ASSERT(demangled == st);
+            ASSERTV(X.numHits(),   NUM == X.numHits());
+            ASSERTV(X.numMisses(), NUM == X.numMisses());
+
+            ASSERT(0 == mX.loadStackTrace(&st, addresses, NUM, false));
+            ASSERT(mangled == st);
+            ASSERTV(X.numHits(),   NUM     == X.numHits());
+            ASSERTV(X.numMisses(), 2 * NUM == X.numMisses());
+            ASSERTV(X.numFrames(), 2 * DISTINCT == static_cast<int>(
+                                                               X.numFrames()));
+
+            ASSERT(0 == mX.loadStackTrace(&st, addresses, NUM, false));
+            ASSERT(mangled == st);
+            ASSERTV(X.numHits(),   2 * NUM == X.numHits());
+
+            // Load a suffix, with frames already in 'st'.
+
+            ASSERT(0 == mX.loadStackTrace(&st, addresses + 1, NUM - 1));
+            ASSERT(NUM - 1 == st.length());
+            for (int i = 0; i < st.length(); ++i) {
+                ASSERTV(i, demangled[i + 1] == st[i]);
+            }
+            ASSERTV(X.numHits(), 3 * NUM - 1 == X.numHits());
+
+            if (verbose) cout << "\t'clear'.\n";
+
+            mX.clear();
+            ASSERT(0           == X.numFrames());
+            ASSERT(3 * NUM - 1 == X.numHits());
+            ASSERT(2 * NUM     == X.numMisses());
+
+            ASSERT(0 == mX.loadStackTrace(&st, addresses, NUM));
+            ASSERT(demangled == st);
+            ASSERT(3 * NUM - 1 == X.numHits());
+            ASSERT(3 * NUM     == X.numMisses());
+
+            ASSERT(0 <  sa.numBlocksInUse());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        ASSERT(dam.isTotalSame());
+
+        if (verbose) cout << "\tCapacity and LRU eviction.\n";
+        {
+            // Gather three distinct addresses.
+
+            const void *distinct[3];
+            int         numFound = 0;
+            for (int i = 0; i < NUM && numFound < 3; ++i) {
+                if (numDistinct(addresses, i + 1) > numFound) {
+                    distinct[numFound++] = addresses[i];
+                }
+            }
+            ASSERT(3 == numFound);
+
+            const void *A = distinct[0];
+            const void *B = distinct[1];
+            const void *C = distinct[2];
+
+            Obj mX(2, &ta);  const Obj& X = mX;
+
+            ASSERT(2 == X.capacity());
+
+            ST st(&sa);
+
+            ASSERT(0 == mX.loadStackTrace(&st, &A, 1));    // miss: A
+            ASSERT(0 == mX.loadStackTrace(&st, &B, 1));    // miss: A B
+            ASSERT(0 == mX.loadStackTrace(&st, &A, 1));    // hit:  B A
+            ASSERT(2 == X.numMisses());
+            ASSERT(1 == X.numHits());
+            ASSERT(2 == X.numFrames());
+
+            ASSERT(0 == mX.loadStackTrace(&st, &C, 1));    // miss: A C
+            ASSERT(3 == X.numMisses());
+            ASSERT(2 == X.numFrames());
+
+            ASSERT(0 == mX.loadStackTrace(&st, &A, 1));    // hit:  C A
+            ASSERT(2 == X.numHits());
+
+            ASSERT(0 == mX.loadStackTrace(&st, &B, 1));    // miss: A B
+            ASSERT(4 == X.numMisses());
+            ASSERT(2 == X.numFrames());
+
+            ASSERT(0 == mX.loadStackTrace(&st, addresses, NUM));
+            ASSERT(demangled == st);
+            ASSERT(2 == X.numFrames());
+
+            ASSERT(0 == mX.loadStackTrace(&st, addresses, NUM, false));
+            ASSERT(mangled == st);
+            ASSERT(4 == X.numFrames());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tNegative testing.\n";
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&ta);
+            ST  st(&sa);
+
+            ASSERT_PASS(mX.loadStackTrace(&st, addresses, 1));
+            ASSERT_FAIL(mX.loadStackTrace(0,   addresses, 1));
+            ASSERT_FAIL(mX.loadStackTrace(&st, addresses, -1));
+            ASSERT_FAIL(mX.loadStackTrace(&st, 0,         1));
+            ASSERT_PASS(mX.loadStackTrace(&st, 0,         0));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 An object created without a capacity has the default capacity,
+        //:   and an object created with a capacity has that capacity.
+        //:
+        //: 2 An object created without an allocator uses the default
+        //:   allocator, and an object created with an allocator uses that
+        //:   allocator.
+        //:
+        //: 3 A newly created object holds no frames, and has no hits and no
+        //:   misses.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create objects with each constructor, with and without an
+        //:   allocator, and verify the accessors.  (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a capacity of 0.  (C-4)
+        //
+        // Testing:
+        //   explicit StackTraceFrameCache(bslma::Allocator *ba = 0);
+        //   explicit StackTraceFrameCache(size_t capacity, Allocator *ba = 0);
+        //   ~StackTraceFrameCache();
+        //   bsl::size_t capacity() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND BASIC ACCESSORS" << endl
+                          << "============================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        {
+            const Obj X;
+            ASSERT(Obj::k_DEFAULT_CAPACITY == X.capacity());
+            ASSERT(&defaultAllocator       == X.allocator());
+            ASSERT(0                       == X.numFrames());
+            ASSERT(0                       == X.numHits());
+            ASSERT(0                       == X.numMisses());
+        }
+        {
+            const Obj X(&ta);
+            ASSERT(Obj::k_DEFAULT_CAPACITY == X.capacity());
+            ASSERT(&ta                     == X.allocator());
+        }
+        {
+            const Obj X(17);
+            ASSERT(17                == X.capacity());
+            ASSERT(&defaultAllocator == X.allocator());
+        }
+        {
+            const Obj X(1, &ta);
+            ASSERT(1   == X.capacity());
+            ASSERT(&ta == X.allocator());
+            ASSERT(0   == X.numFrames());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tNegative testing.\n";
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            // Note that 'bdlcc::Cache' detects the violation first.
+
+            ASSERT_PASS_RAW(Obj(1, &ta));
+            ASSERT_FAIL_RAW(Obj(0, &ta));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Capture a stack trace, load it twice through a cache, and verify
+        //:   the frames and the hit and miss counts.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        void *addresses[k_MAX_ADDRESSES];
+        int   depth        = 1;
+        int   numAddresses = recurseAndCapture(addresses,
+                                               k_MAX_ADDRESSES,
+                                               &depth);
+        ASSERT(0 < numAddresses);
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        Obj mX(&ta);  const Obj& X = mX;
+
+        ST st1, st2;
+        ASSERT(0 == mX.loadStackTrace(&st1, addresses, numAddresses));
+        ASSERT(numAddresses == st1.length());
+        ASSERT(0            == X.numHits());
+        ASSERT(numAddresses == X.numMisses());
+
+        ASSERT(0 == mX.loadStackTrace(&st2, addresses, numAddresses));
+        ASSERT(st1          == st2);
+        ASSERT(numAddresses == X.numHits());
+        ASSERT(numAddresses == X.numMisses());
+
+        for (int i = 0; i < st1.length(); ++i) {
+            ASSERTV(i, addresses[i] == st1[i].address());
+            if (veryVerbose) { T_ P(st1[i]) }
+        }
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: CACHED VS. UNCACHED RESOLUTION
+        //
+        // Concerns:
+        //: 1 Loading a stack trace whose addresses are cached is much faster
+        //:   than resolving it.
+        //
+        // Plan:
+        //: 1 Capture a stack trace, and time repeatedly resolving it directly
+        //:   and loading it through a cache.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: CACHED VS. UNCACHED RESOLUTION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: CACHED VS. UNCACHED RESOLUTION"
+                          << endl
+                          << "==========================================="
+                          << endl;
+
+        const int NUM_ITERATIONS = argc > 2 ? bsl::atoi(argv[2]) : 20;
+
+        void *addresses[k_MAX_ADDRESSES];
+        int   depth        = 8;
+        int   numAddresses = recurseAndCapture(addresses,
+                                               k_MAX_ADDRESSES,
+                                               &depth);
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        Obj                  mX(&ta);
+        ST                   st;
+        bsls::Stopwatch      timer;
+
+        timer.start();
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            ASSERT(0 == loadDirectly(&st, addresses, numAddresses, true));
+        }
+        timer.stop();
+        const double uncached = timer.elapsedTime() / NUM_ITERATIONS;
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            ASSERT(0 == mX.loadStackTrace(&st, addresses, numAddresses));
+        }
+        timer.stop();
+        const double cached = timer.elapsedTime() / NUM_ITERATIONS;
+
+        cout << "frames: " << numAddresses
+             << "  uncached: " << uncached * 1e6 << " us/trace"
+             << "  cached (first load included): " << cached * 1e6
+             << " us/trace" << endl;
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
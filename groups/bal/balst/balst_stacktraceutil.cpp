@@ -14,6 +14,7 @@ BSLS_IDENT_RCSID(balst_stacktraceutil_cpp,"$Id$ $CSID$")
 
 #include <balst_objectfileformat.h>
 #include <balst_stacktraceframe.h>
+#include <balst_stacktraceframecache.h>
 #include <balst_stacktraceresolverimpl_dladdr.h>
 #include <balst_stacktraceresolverimpl_elf.h>
 #include <balst_stacktraceresolverimpl_xcoff.h>
@@ -96,6 +97,33 @@ class StackTraceResolverImpl<ObjectFileFormat::Dummy>
     }
 };
 
+int StackTraceUtil::captureStackAddresses(void **addresses, int maxFrames)
+{
+    BSLS_ASSERT(addresses);
+    BSLS_ASSERT(0 < maxFrames);
+
+    enum {
+        IGNORE_FRAMES = bsls::StackAddressUtil::k_IGNORE_FRAMES + 1
+    };
+
+#if !defined(BSLS_PLATFORM_OS_CYGWIN)
+    int numAddresses = bsls::StackAddressUtil::getStackAddresses(addresses,
+                                                                 maxFrames);
+#else
+    int numAddresses = 0;
+#endif
+    if (numAddresses <= IGNORE_FRAMES || numAddresses > maxFrames) {
+        return 0;                                                     // RETURN
+    }
+
+    numAddresses -= IGNORE_FRAMES;
+    bsl::memmove(addresses,
+                 addresses + IGNORE_FRAMES,
+                 numAddresses * sizeof(*addresses));
+
+    return numAddresses;
+}
+
 bsl::ostream& StackTraceUtil::hexStackTrace(bsl::ostream &stream)
 {
     // This routine is just calling 'printHexStackTrace' with two additional
@@ -114,6 +142,62 @@ bsl::ostream& StackTraceUtil::hexStackTrace(bsl::ostream &stream)
 #endif
 }
 
+int StackTraceUtil::loadCachedStackTraceFromAddressArray(
+                                   StackTrace         *result,
+                                   const void * const  addresses[],
+                                   int                 numAddresses,
+                                   bool                demanglingPreferredFlag)
+{
+    BSLS_ASSERT(numAddresses >= 0);
+    BSLS_ASSERT(0 == numAddresses || 0 != addresses);
+
+    return StackTraceFrameCache::singleton().loadStackTrace(
+                                                      result,
+                                                      addresses,
+                                                      numAddresses,
+                                                      demanglingPreferredFlag);
+}
+
+int StackTraceUtil::loadCachedStackTraceFromStack(
+                                           StackTrace *result,
+                                           int         maxFrames,
+                                           bool        demanglingPreferredFlag)
+{
+    enum {
+        DEFAULT_MAX_FRAMES = 1024,
+        IGNORE_FRAMES      = bsls::StackAddressUtil::k_IGNORE_FRAMES + 1
+    };
+
+    if (maxFrames < 0) {
+        maxFrames = DEFAULT_MAX_FRAMES;
+    }
+
+    // See 'loadStackTraceFromStack'.
+
+    maxFrames += IGNORE_FRAMES;
+
+    void **addresses = (void **)
+                     result->allocator()->allocate(maxFrames * sizeof(void *));
+    bslma::DeallocatorGuard<bslma::Allocator> guard(addresses,
+                                                   result->allocator());
+
+#if !defined(BSLS_PLATFORM_OS_CYGWIN)
+    int numAddresses = bsls::StackAddressUtil::getStackAddresses(addresses,
+                                                                 maxFrames);
+#else
+    int numAddresses = 0;
+#endif
+    if (numAddresses < IGNORE_FRAMES || numAddresses > maxFrames) {
+        return -1;                                                    // RETURN
+    }
+
+    return StackTraceFrameCache::singleton().loadStackTrace(
+                                                 result,
+                                                 addresses    + IGNORE_FRAMES,
+                                                 numAddresses - IGNORE_FRAMES,
+                                                 demanglingPreferredFlag);
+}
+
 int StackTraceUtil::loadStackTraceFromAddressArray(
                                    StackTrace         *result,
                                    const void * const  addresses[],
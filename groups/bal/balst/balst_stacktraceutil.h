@@ -30,7 +30,8 @@ BSLS_IDENT("$Id: $")
 // This section illustrates intended usage for this component.  The following
 // examples demonstrate two distinct ways to load and print a stack-trace with
 // 'balst::StackTraceUtil' using (1) 'loadStackTraceFromStack' and
-// (2) 'loadStackTraceFromAddresses'.
+// (2) 'loadStackTraceFromAddresses', how to (3) output a hex stack trace, and
+// how to (4) capture a stack trace cheaply and resolve it later.
 //
 ///Example 1: Loading Stack-Trace Directly from the Stack
 /// - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -271,10 +272,83 @@ BSLS_IDENT("$Id: $")
 //  0x1000002fc .__start + 116
 //  $
 //..
+//
+///Example 4: Deferred Resolution of a Captured Stack Trace
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// In this example, we demonstrate capturing a stack trace on a code path that
+// may be executed frequently, and deferring the expensive resolution of the
+// captured addresses until the stack trace is actually reported, possibly by
+// another thread.  The resolution goes through the process-wide
+// 'balst::StackTraceFrameCache', so that addresses that were resolved before
+// are not resolved again.
+//
+// First, we define a type, 'PendingWarning', that holds a message and the
+// return addresses that were on the stack when the warning was raised:
+//..
+//  struct PendingWarning {
+//      // This 'struct' describes a warning whose stack trace has been
+//      // captured, but not yet resolved.
+//
+//      enum { k_MAX_FRAMES = 32 };
+//
+//      const char *d_message;                  // warning message
+//      void       *d_addresses[k_MAX_FRAMES];  // captured return addresses
+//      int         d_numAddresses;             // number of captured addresses
+//  };
+//..
+// Then, we define the function 'raiseWarning', which captures the return
+// addresses on the stack into a 'PendingWarning'.  Capturing only walks the
+// stack, and does not read any object file:
+//..
+//  void raiseWarning(PendingWarning *warning, const char *message)
+//      // Load into the specified 'warning' the specified 'message' and the
+//      // return addresses of the stack of the current thread.
+//  {
+//      warning->d_message      = message;
+//      warning->d_numAddresses =
+//                 balst::StackTraceUtil::captureStackAddresses(
+//                                              warning->d_addresses,
+//                                              PendingWarning::k_MAX_FRAMES);
+//  }
+//..
+// Next, we define the function 'reportWarning', which resolves the captured
+// addresses, through the cache, and prints the stack trace:
+//..
+//  int reportWarning(bsl::ostream& stream, const PendingWarning& warning)
+//      // Write the message and the stack trace of the specified 'warning' to
+//      // the specified 'stream'.  Return 0 on success, and a non-zero value
+//      // otherwise.
+//  {
+//      balst::StackTrace stackTrace;
+//      typedef balst::StackTraceUtil Util;
+//
+//      int rc = Util::loadCachedStackTraceFromAddressArray(
+//                                                     &stackTrace,
+//                                                     warning.d_addresses,
+//                                                     warning.d_numAddresses);
+//      if (rc) {  // Error handling is omitted.
+//          return rc;                                                // RETURN
+//      }
+//
+//      stream << "WARNING: " << warning.d_message << '\n';
+//      balst::StackTraceUtil::printFormatted(stream, stackTrace);
+//      return 0;
+//  }
+//..
+// Finally, we raise a warning, and report it later:
+//..
+//  PendingWarning warning;
+//  raiseWarning(&warning, "queue is unexpectedly long");
+//  assert(0 < warning.d_numAddresses);
+//
+//  int rc = reportWarning(bsl::cout, warning);
+//  assert(0 == rc);
+//..
 
 #include <balscm_version.h>
 
 #include <balst_stacktrace.h>
+#include <balst_stacktraceframecache.h>
 
 #include <bslma_allocator.h>
 
@@ -288,12 +362,76 @@ struct StackTraceUtil {
     // are useful for initializing and printing a stack-trace object.
 
     // CLASS METHODS
+    static
+    int captureStackAddresses(void **addresses, int maxFrames);
+        // Load into the specified 'addresses' the return addresses from the
+        // stack of the current thread, from top to bottom, starting with the
+        // return address into the caller of this function, and return the
+        // number of addresses loaded, which is at most the specified
+        // 'maxFrames'.  Return 0 if the stack could not be walked.  The
+        // behavior is undefined unless 'addresses' has room for at least
+        // 'maxFrames' addresses and '0 < maxFrames'.  Note that this function
+        // neither allocates memory nor reads any object file, so the addresses
+        // it captures may be resolved later, or by another thread, using
+        // 'loadStackTraceFromAddressArray' or
+        // 'loadCachedStackTraceFromAddressArray'.  Also note that the top
+        // slots of 'addresses' are used to capture the frames of this function
+        // itself before they are discarded, so fewer than 'maxFrames'
+        // addresses may be loaded even if the stack is deeper.
+
     static
     bsl::ostream& hexStackTrace(bsl::ostream &stream);
         // Write to the specified 'stream' the stack addresses from a stack
         // trace of the current thread, in hex from top to bottom, and return
         // 'stream'.
 
+    static
+    int loadCachedStackTraceFromAddressArray(
+                           StackTrace         *result,
+                           const void * const  addresses[],
+                           int                 numAddresses,
+                           bool                demanglingPreferredFlag = true);
+        // Populate the specified 'result' with stack-trace information from
+        // the stack, described by the specified array of 'addresses' of length
+        // 'numAddresses', using the process-wide 'StackTraceFrameCache', so
+        // that only the addresses that are not held in the cache are resolved.
+        // Optionally specify 'demanglingPreferredFlag' to indicate whether or
+        // not to attempt to perform demangling, as for
+        // 'loadStackTraceFromAddressArray'.  Return 0 on success, and a
+        // non-zero value otherwise.  Any frames previously contained in the
+        // stack-trace object are discarded.  The behavior is undefined unless
+        // '0 <= numAddresses' and 'addresses' contains at least 'numAddresses'
+        // addresses.  Note that, unlike 'loadStackTraceFromAddressArray', this
+        // function allocates the cached frames from the heap (see
+        // 'balst_stacktraceframecache').  Also note that, on platforms other
+        // than Linux, 'StackTraceFrameCache::singleton().clear()' must be
+        // called after object files are unloaded (see
+        // {'balst_stacktraceframecache'|Unloaded Object Files}).
+
+    static
+    int loadCachedStackTraceFromStack(
+                                   StackTrace *result,
+                                   int         maxFrames = -1,
+                                   bool        demanglingPreferredFlag = true);
+        // Populate the specified 'result' object with information about the
+        // current thread's program stack, as for 'loadStackTraceFromStack',
+        // using the process-wide 'StackTraceFrameCache', so that only the
+        // return addresses that are not held in the cache are resolved.
+        // Optionally specify 'maxFrames' to indicate the maximum number of
+        // frames to take from the top of the stack.  If 'maxFrames' is not
+        // specified, the default limit is at least 1024.  Optionally specify
+        // 'demanglingPreferredFlag' to indicate whether to attempt to perform
+        // demangling, if possible.  Any frames previously contained in the
+        // 'stackTrace' object are discarded.  Return 0 on success, and a
+        // non-zero value otherwise.  The behavior is undefined unless
+        // 'maxFrames' (if specified) is greater than 0.  Note that, unlike
+        // 'loadStackTraceFromStack', this function allocates the cached frames
+        // from the heap (see 'balst_stacktraceframecache').  Also note that,
+        // on platforms other than Linux,
+        // 'StackTraceFrameCache::singleton().clear()' must be called after
+        // object files are unloaded (see
+        // {'balst_stacktraceframecache'|Unloaded Object Files}).
+
     static
     int loadStackTraceFromAddressArray(
                            StackTrace         *result,
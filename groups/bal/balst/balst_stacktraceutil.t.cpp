@@ -11,6 +11,7 @@
 
 #include <balst_objectfileformat.h>
 #include <balst_stacktrace.h>
+#include <balst_stacktraceframecache.h>
 
 #include <bdlb_string.h>
 #include <bdlb_stringrefutil.h>
@@ -98,11 +99,15 @@ using bsl::flush;
 // [11] hexStackTrace
 // [12] printHexStackTrace
 // [13] heap memory leak test
+// [15] captureStackAddresses
+// [15] loadCachedStackTraceFromAddressArray
+// [15] loadCachedStackTraceFromStack
 //-----------------------------------------------------------------------------
 // [14] STACK TRACE WITH MANY COMPONENTS
-// [15] USAGE 1
-// [16] USAGE 2
-// [17] USAGE 3
+// [16] USAGE 1
+// [17] USAGE 2
+// [18] USAGE 3
+// [19] USAGE 4
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -1669,6 +1674,73 @@ void bottom(bslma::Allocator *alloc)
 //                              USAGE EXAMPLES
 // ----------------------------------------------------------------------------
 
+                                    // -------
+                                    // Usage 4
+                                    // -------
+
+///Example 4: Deferred Resolution of a Captured Stack Trace
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// In this example, we demonstrate capturing a stack trace on a code path that
+// may be executed frequently, and deferring the expensive resolution of the
+// captured addresses until the stack trace is actually reported, possibly by
+// another thread.  The resolution goes through the process-wide
+// 'balst::StackTraceFrameCache', so that addresses that were resolved before
+// are not resolved again.
+//
+// First, we define a type, 'PendingWarning', that holds a message and the
+// return addresses that were on the stack when the warning was raised:
+//..
+    struct PendingWarning {
+        // This 'struct' describes a warning whose stack trace has been
+        // captured, but not yet resolved.
+
+        enum { k_MAX_FRAMES = 32 };
+
+        const char *d_message;                  // warning message
+        void       *d_addresses[k_MAX_FRAMES];  // captured return addresses
+        int         d_numAddresses;             // number of captured addresses
+    };
+//..
+// Then, we define the function 'raiseWarning', which captures the return
+// addresses on the stack into a 'PendingWarning'.  Capturing only walks the
+// stack, and does not read any object file:
+//..
+    void raiseWarning(PendingWarning *warning, const char *message)
+        // Load into the specified 'warning' the specified 'message' and the
+        // return addresses of the stack of the current thread.
+    {
+        warning->d_message      = message;
+        warning->d_numAddresses =
+                   balst::StackTraceUtil::captureStackAddresses(
+                                                warning->d_addresses,
+                                                PendingWarning::k_MAX_FRAMES);
+    }
+//..
+// Next, we define the function 'reportWarning', which resolves the captured
+// addresses, through the cache, and prints the stack trace:
+//..
+    int reportWarning(bsl::ostream& stream, const PendingWarning& warning)
+        // Write the message and the stack trace of the specified 'warning' to
+        // the specified 'stream'.  Return 0 on success, and a non-zero value
+        // otherwise.
+    {
+        balst::StackTrace stackTrace;
+        typedef balst::StackTraceUtil Util;
+
+        int rc = Util::loadCachedStackTraceFromAddressArray(
+                                                       &stackTrace,
+                                                       warning.d_addresses,
+                                                       warning.d_numAddresses);
+        if (rc) {  // Error handling is omitted.
+            return rc;                                                // RETURN
+        }
+
+        stream << "WARNING: " << warning.d_message << '\n';
+        balst::StackTraceUtil::printFormatted(stream, stackTrace);
+        return 0;
+    }
+//..
+
                                     // -------
                                     // Usage 3
                                     // -------
@@ -1965,7 +2037,36 @@ int main(int argc, char *argv[])
     }
 
     switch (test) { case 0:
-      case 17: {
+      case 19: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE FOUR
+        //
+        // Concerns:
+        //: 1 That the usage example that uses 'captureStackAddresses' and
+        //:   'loadCachedStackTraceFromAddressArray' works.
+        //
+        // Plan:
+        //: 1 Call the routines in the usage example to observe that the
+        //:   example compiles and works.
+        //
+        // Testing:
+        //   USAGE 4
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TEST OF USAGE EXAMPLE 4\n"
+                             "=======================\n";
+
+// Finally, we raise a warning, and report it later:
+//..
+    PendingWarning warning;
+    raiseWarning(&warning, "queue is unexpectedly long");
+    ASSERT(0 < warning.d_numAddresses);
+
+    int rc = reportWarning(*out_p, warning);
+    ASSERT(0 == rc);
+//..
+      } break;
+      case 18: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE THREE
         //
@@ -1990,7 +2091,7 @@ int main(int argc, char *argv[])
         recurseExample3(&depth);
         ASSERT(5 == depth);
       } break;
-      case 16: {
+      case 17: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE TWO
         //
@@ -2017,7 +2118,7 @@ int main(int argc, char *argv[])
         ASSERTV(rc, 0 == rc);
         ASSERTV(depth, 5 == depth);
       } break;
-      case 15: {
+      case 16: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE ONE
         //
@@ -2044,6 +2145,104 @@ int main(int argc, char *argv[])
         ASSERTV(rc, 0 == rc);
         ASSERTV(depth, 5 == depth);
       } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // TESTING CAPTURE AND CACHED LOADING
+        //
+        // Concerns:
+        //: 1 'captureStackAddresses' loads the return addresses of the stack
+        //:   starting with the return address into its caller, and loads no
+        //:   more than 'maxFrames' addresses.
+        //:
+        //: 2 'loadCachedStackTraceFromAddressArray' loads the same frames as
+        //:   'loadStackTraceFromAddressArray', and resolves them through the
+        //:   process-wide cache.
+        //:
+        //: 3 'loadCachedStackTraceFromStack' loads the same frames as
+        //:   'loadStackTraceFromStack', apart from the address of the top
+        //:   frame, which is a different return address into the caller.
+        //:
+        //: 4 None of these functions use the default allocator.
+        //
+        // Plan:
+        //: 1 In the same function, capture the stack with
+        //:   'captureStackAddresses' and with
+        //:   'bsls::StackAddressUtil::getStackAddresses', and verify that the
+        //:   addresses below the top frame are the same; capture with a
+        //:   'maxFrames' of 3.  (C-1)
+        //:
+        //: 2 Load the captured addresses with both functions, twice, and
+        //:   compare the frames and the hit count of the process-wide cache.
+        //:   (C-2)
+        //:
+        //: 3 Load the stack with both functions and compare the frames.  (C-3)
+        //:
+        //: 4 The default allocator is checked at the end of 'main'.  (C-4)
+        //
+        // Testing:
+        //   captureStackAddresses
+        //   loadCachedStackTraceFromAddressArray
+        //   loadCachedStackTraceFromStack
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING CAPTURE AND CACHED LOADING\n"
+                             "==================================\n";
+
+        enum { k_MAX = 64,
+               k_IGNORE = bsls::StackAddressUtil::k_IGNORE_FRAMES };
+
+        void *captured[k_MAX];
+        void *expected[k_MAX];
+
+        const int numCaptured = Util::captureStackAddresses(captured, k_MAX);
+        const int numExpected = Address::getStackAddresses(expected, k_MAX);
+
+        ASSERTV(numCaptured, numExpected,
+                                     numCaptured == numExpected - k_IGNORE);
+        for (int i = 1; i < numCaptured; ++i) {
+            ASSERTV(i, expected[k_IGNORE + i] == captured[i]);
+        }
+
+        void *few[3];
+        ASSERT(Util::captureStackAddresses(few, 3) <= 3);
+
+        balst::StackTraceFrameCache& cache =
+                                      balst::StackTraceFrameCache::singleton();
+
+        ST st1(&ta), st2(&ta);
+        ASSERT(0 == Util::loadStackTraceFromAddressArray(&st1,
+                                                         captured,
+                                                         numCaptured));
+
+        for (int ti = 0; ti < 2; ++ti) {
+            const bsls::Types::Int64 numHits = cache.numHits();
+
+            ASSERT(0 == Util::loadCachedStackTraceFromAddressArray(
+                                                                 &st2,
+                                                                 captured,
+                                                                 numCaptured));
+            ASSERTV(ti, st1 == st2);
+            if (ti) {
+                ASSERTV(cache.numHits() - numHits,
+                                     numCaptured == cache.numHits() - numHits);
+            }
+        }
+
+        ASSERT(0 == Util::loadStackTraceFromStack(&st1));
+        ASSERT(0 == Util::loadCachedStackTraceFromStack(&st2));
+        ASSERTV(st1.length(), st2.length(), st1.length() == st2.length());
+        ASSERT(0 < st2.length());
+        if (0 < st1.length() && st1.length() == st2.length()) {
+            ASSERT(st1[0].symbolName() == st2[0].symbolName());
+            for (int i = 1; i < st1.length(); ++i) {
+                ASSERTV(i, st1[i] == st2[i]);
+            }
+        }
+
+        if (veryVerbose) {
+            Util::printFormatted(cout, st2);
+        }
+      } break;
       case 14: {
         // --------------------------------------------------------------------
         // TESTING: Stack Trace With Many Components
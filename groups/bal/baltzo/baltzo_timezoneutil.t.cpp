@@ -46,6 +46,7 @@ using namespace bsl;
 // CLASS METHODS
 // [ 6] convertUtcToLocalTime(LclDatetm *, const char *, const Datetm&);
 // [ 6] convertUtcToLocalTime(DatetmTz *, const char *, const Datetm&);
+// [12] convertUtcToLocalTimes(DatetmTz *, const ch *, const Datetm *, ...
 // [ 8] convertLocalToLocalTime(LclDatetm *, const ch *, const LclDatetm&)
 // [ 8] convertLocalToLocalTime(LclDatetm *, const ch *, const DatetmTz&);
 // [ 8] convertLocalToLocalTime(DatetmTz *, const ch *, const LclDatetm&);
@@ -68,7 +69,7 @@ using namespace bsl;
 // [ 9] validateLocalTime(bool * result, const DatetmTz&, const char *TZ);
 // ----------------------------------------------------------------------------
 // [11] TESTING TIME CONVERSION OUT OF RANGE
-// [12] USAGE EXAMPLE
+// [13] USAGE EXAMPLE
 // ============================================================================
 
 // ============================================================================
@@ -920,7 +921,7 @@ int main(int argc, char *argv[])
     baltzo::DefaultZoneinfoCache::setDefaultCache(&testCache);
 
     switch (test) { case 0:
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   The usage example provided in the component header file must
@@ -1182,6 +1183,69 @@ int main(int argc, char *argv[])
         }
         ASSERT(0 == defaultAllocator.numBytesInUse());
       } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // CLASS METHOD 'convertUtcToLocalTimes'
+        //
+        // Concerns:
+        //: 1 'convertUtcToLocalTimes' loads, into each element of the result,
+        //:   the value 'convertUtcToLocalTime' returns for the corresponding
+        //:   input, using the default time zone cache.
+        //:
+        //: 2 The status of the conversion is returned.
+        //
+        // Plan:
+        //: 1 Convert an array of UTC times spanning several years, and
+        //:   compare each result with that of 'convertUtcToLocalTime'.  (C-1)
+        //:
+        //: 2 Convert using an unsupported time zone id, and an array
+        //:   containing an out-of-range value.  (C-2)
+        //
+        // Testing:
+        //   convertUtcToLocalTimes(DatetmTz *, const ch *, const Datetm *, ...
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "'convertUtcToLocalTimes'" << endl
+                                  << "========================" << endl;
+
+        const char *NY = "America/New_York";
+
+        enum { NUM_TIMES = 500 };
+
+        bdlt::Datetime   times[NUM_TIMES];
+        bdlt::DatetimeTz results[NUM_TIMES];
+
+        for (int i = 0; i < NUM_TIMES; ++i) {
+            times[i] = bdlt::Datetime(2005, 1, 1);
+            times[i].addHours(i * 97);
+        }
+
+        ASSERT(0 == Obj::convertUtcToLocalTimes(results,
+                                                NY,
+                                                times,
+                                                NUM_TIMES));
+
+        for (int i = 0; i < NUM_TIMES; ++i) {
+            bdlt::DatetimeTz expected;
+            ASSERTV(i, 0 == Obj::convertUtcToLocalTime(&expected,
+                                                       NY,
+                                                       times[i]));
+            ASSERTV(i, expected, results[i], expected == results[i]);
+        }
+
+        ASSERT(Err::k_UNSUPPORTED_ID ==
+                       Obj::convertUtcToLocalTimes(results,
+                                                   "bogusId",
+                                                   times,
+                                                   NUM_TIMES));
+
+        times[NUM_TIMES / 2] = bdlt::Datetime(1, 1, 1);
+        ASSERT(Err::k_OUT_OF_RANGE ==
+                       Obj::convertUtcToLocalTimes(results,
+                                                   NY,
+                                                   times,
+                                                   NUM_TIMES));
+      } break;
       case 11: {
         // --------------------------------------------------------------------
         // REPRODUCE BUG FROM DRQS 144183882
@@ -24,6 +24,7 @@ BSLS_IDENT_RCSID(baltzo_timezoneutilimp_cpp,"$Id$ $CSID$")
 #include <bsls_log.h>
 #include <bsls_types.h>
 
+#include <bsl_limits.h>
 #include <bsl_ostream.h>
 
 namespace BloombergLP {
@@ -231,6 +232,64 @@ int TimeZoneUtilImp::convertUtcToLocalTime(
     return 0;
 }
 
+int TimeZoneUtilImp::convertUtcToLocalTimes(
+                                       bdlt::DatetimeTz      *results,
+                                       const char            *resultTimeZoneId,
+                                       const bdlt::Datetime  *utcTimes,
+                                       bsl::size_t            numTimes,
+                                       ZoneinfoCache         *cache)
+{
+    BSLS_ASSERT(results  || 0 == numTimes);
+    BSLS_ASSERT(resultTimeZoneId);
+    BSLS_ASSERT(utcTimes || 0 == numTimes);
+    BSLS_ASSERT(cache);
+
+    const Zoneinfo *timeZone;
+    int rc = lookupTimeZone(&timeZone, resultTimeZoneId, cache);
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
+
+    // Successive times typically fall within the same local-time period, so
+    // the transition found for the previous time is tried first, before
+    // searching the time zone.
+
+    const Zoneinfo::TransitionConstIterator end = timeZone->endTransitions();
+
+    Zoneinfo::TransitionConstIterator it   = end;
+    bdlt::EpochUtil::TimeT64          from = 0;
+    bdlt::EpochUtil::TimeT64          to   = 0;
+
+    rc = 0;
+    for (bsl::size_t i = 0; i < numTimes; ++i) {
+        const bdlt::EpochUtil::TimeT64 utcTimeT64 =
+                               bdlt::EpochUtil::convertToTimeT64(utcTimes[i]);
+
+        if (end == it || utcTimeT64 < from || to <= utcTimeT64) {
+            it   = timeZone->findTransitionForUtcTime(utcTimes[i]);
+            from = it->utcTime();
+
+            Zoneinfo::TransitionConstIterator next = it;
+            ++next;
+            to = end == next
+               ? bsl::numeric_limits<bdlt::EpochUtil::TimeT64>::max()
+               : next->utcTime();
+        }
+
+        const int offsetInMinutes = it->descriptor().utcOffsetInSeconds()
+                                                                          / 60;
+
+        bdlt::Datetime temp(utcTimes[i]);
+        if (0 != temp.addMinutesIfValid(offsetInMinutes)) {
+            rc = ErrorCode::k_OUT_OF_RANGE;
+            continue;
+        }
+        results[i].setDatetimeTz(temp, offsetInMinutes);
+    }
+
+    return rc;
+}
+
 int TimeZoneUtilImp::initLocalTime(bdlt::DatetimeTz        *result,
                                    LocalTimeValidity::Enum *resultValidity,
                                    const bdlt::Datetime&    localTime,
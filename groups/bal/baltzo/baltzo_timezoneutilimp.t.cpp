@@ -28,9 +28,11 @@
 #include <bsls_asserttest.h>
 #include <bsls_log.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 #include <bsl_iostream.h>
+#include <bsl_vector.h>
 
 #undef DS
 
@@ -58,9 +60,10 @@ using namespace bsl;
 // [ 4] 'initLocalTime(DatetimeTz *, Datetime& , char *, Dst, Cache *)
 // [ 5] 'createLocalTimePeriod(Period *, TransitionConstIter, Zoneinfo)'
 // [ 6] 'loadLocalTimePeriodForUtc(DatetimeTz *, Datetime& , char *, Cache *)
+// [ 7] convertUtcToLocalTimes(DatetimeTz *, char *, Datetime *, size_t, ...)
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 7] USAGE EXAMPLE
+// [ 8] USAGE EXAMPLE
 //=============================================================================
 //                    STANDARD BDE ASSERT TEST MACRO
 //-----------------------------------------------------------------------------
@@ -998,7 +1001,7 @@ int main(int argc, char *argv[])
     baltzo::DefaultZoneinfoCache::setDefaultCache(&badCache);
 
     switch (test) { case 0:
-      case 7: {
+      case 8: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -1127,6 +1130,199 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // CLASS METHOD 'convertUtcToLocalTimes':
+        //
+        // Concerns:
+        //: 1 Each element of the result is the value that
+        //:   'convertUtcToLocalTime' loads for the corresponding input,
+        //:   whether successive inputs are in the same local-time period,
+        //:   in increasing or decreasing order, or in no particular order.
+        //:
+        //: 2 Return 'Err::k_UNSUPPORTED_ID', and do not modify the results, if
+        //:   an invalid time zone id is passed.
+        //:
+        //: 3 Return 'Err::k_OUT_OF_RANGE' if any element cannot be converted,
+        //:   leave those elements unmodified, and load all other elements.
+        //:
+        //: 4 An empty array of inputs is supported.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each of a set of time zones, create arrays of UTC times
+        //:   around, and between, the transitions of the time zone, in
+        //:   increasing, decreasing, and pseudo-random order, and compare the
+        //:   results of 'convertUtcToLocalTimes' with those of
+        //:   'convertUtcToLocalTime' for each element.  (C-1)
+        //:
+        //: 2 Invoke 'convertUtcToLocalTimes' with an invalid time zone id, and
+        //:   with inputs at the limits of the representable range.  (C-2..4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   convertUtcToLocalTimes(DatetimeTz *, char *, Datetime *, size_t,.)
+        // --------------------------------------------------------------------
+        if (verbose) cout << endl << "'convertUtcToLocalTimes'" << endl
+                                  << "========================" << endl;
+
+        const char *ZONES[] = { NY, RM, SA, RY, GMT, GP1, GM1, ALLDST,
+                                OLDDST };
+        const int NUM_ZONES = sizeof ZONES / sizeof *ZONES;
+
+        const bdlt::DatetimeTz UNSET(bdlt::Datetime(1234, 5, 6), 7);
+
+        for (int zi = 0; zi < NUM_ZONES; ++zi) {
+            const char *ZONE = ZONES[zi];
+
+            if (veryVerbose) { T_ P(ZONE) }
+
+            const baltzo::Zoneinfo *zoneinfo = testCache.getZoneinfo(ZONE);
+            LOOP_ASSERT(ZONE, zoneinfo);
+
+            bsl::vector<bdlt::Datetime> times(Z);
+            for (Iterator it  = zoneinfo->beginTransitions();
+                          it != zoneinfo->endTransitions();
+                        ++it) {
+                const bdlt::EpochUtil::TimeT64 T = it->utcTime();
+                if (T < toTimeT(bdlt::Datetime(1900, 1, 1))) {
+                    continue;
+                }
+                times.push_back(fromTimeT(T - 1));
+                times.push_back(fromTimeT(T));
+                times.push_back(fromTimeT(T + 1));
+                times.push_back(fromTimeT(T + 86400 * 30));
+            }
+            times.push_back(bdlt::Datetime(1950, 1, 1));
+            times.push_back(bdlt::Datetime(2010, 6, 1, 12, 30, 15, 250));
+            times.push_back(bdlt::Datetime(2100, 1, 1));
+
+            const bsl::size_t NUM_TIMES = times.size();
+
+            for (int order = 0; order < 3; ++order) {
+                if (1 == order) {
+                    bsl::reverse(times.begin(), times.end());
+                }
+                else if (2 == order) {
+                    unsigned int seed = zi + 1;
+                    for (bsl::size_t i = NUM_TIMES; 1 < i; --i) {
+                        seed = seed * 1103515245 + 12345;
+                        bsl::swap(times[i - 1], times[(seed >> 8) % i]);
+                    }
+                }
+
+                bsl::vector<bdlt::DatetimeTz> results(NUM_TIMES, UNSET, Z);
+
+                LOOP2_ASSERT(ZONE, order, 0 == Obj::convertUtcToLocalTimes(
+                                                            results.data(),
+                                                            ZONE,
+                                                            times.data(),
+                                                            NUM_TIMES,
+                                                            &testCache));
+
+                for (bsl::size_t i = 0; i < NUM_TIMES; ++i) {
+                    bdlt::DatetimeTz expected;
+                    LOOP2_ASSERT(ZONE, i, 0 == Obj::convertUtcToLocalTime(
+                                                                 &expected,
+                                                                 ZONE,
+                                                                 times[i],
+                                                                 &testCache));
+                    LOOP3_ASSERT(ZONE, order, times[i],
+                                 expected == results[i]);
+                }
+            }
+        }
+
+        if (veryVerbose) cout << "\tTesting an invalid time zone id." << endl;
+        {
+            const bdlt::Datetime   INPUT[] = { bdlt::Datetime(2010, 1, 1) };
+            bdlt::DatetimeTz       results[] = { UNSET };
+
+            ASSERT(EUID == Obj::convertUtcToLocalTimes(results,
+                                                       "bogusId",
+                                                       INPUT,
+                                                       1,
+                                                       &testCache));
+            ASSERT(UNSET == results[0]);
+        }
+
+        if (veryVerbose) cout << "\tTesting out-of-range values." << endl;
+        {
+            const bdlt::Datetime INPUT[] = {
+                bdlt::Datetime(2010, 1, 1),
+                bdlt::Datetime(1, 1, 1),
+                bdlt::Datetime(9999, 12, 31, 23, 30),
+                bdlt::Datetime(2011, 1, 1),
+            };
+            const bsl::size_t NUM_INPUT = sizeof INPUT / sizeof *INPUT;
+
+            bdlt::DatetimeTz results[NUM_INPUT];
+
+            for (bsl::size_t i = 0; i < NUM_INPUT; ++i) {
+                results[i] = UNSET;
+            }
+            ASSERT(Err::k_OUT_OF_RANGE == Obj::convertUtcToLocalTimes(
+                                                                  results,
+                                                                  GP1,
+                                                                  INPUT,
+                                                                  NUM_INPUT,
+                                                                  &testCache));
+            ASSERT(bdlt::DatetimeTz(bdlt::Datetime(2009, 12, 31, 23), -60)
+                                                                == results[0]);
+            ASSERT(UNSET == results[1]);
+            ASSERT(bdlt::DatetimeTz(bdlt::Datetime(9999, 12, 31, 22, 30), -60)
+                                                                == results[2]);
+            ASSERT(bdlt::DatetimeTz(bdlt::Datetime(2010, 12, 31, 23), -60)
+                                                                == results[3]);
+
+            for (bsl::size_t i = 0; i < NUM_INPUT; ++i) {
+                results[i] = UNSET;
+            }
+            ASSERT(Err::k_OUT_OF_RANGE == Obj::convertUtcToLocalTimes(
+                                                                  results,
+                                                                  GM1,
+                                                                  INPUT,
+                                                                  NUM_INPUT,
+                                                                  &testCache));
+            ASSERT(bdlt::DatetimeTz(bdlt::Datetime(2010, 1, 1, 1), 60)
+                                                                == results[0]);
+            ASSERT(bdlt::DatetimeTz(bdlt::Datetime(1, 1, 1, 1), 60)
+                                                                == results[1]);
+            ASSERT(UNSET == results[2]);
+            ASSERT(bdlt::DatetimeTz(bdlt::Datetime(2011, 1, 1, 1), 60)
+                                                                == results[3]);
+        }
+
+        if (veryVerbose) cout << "\tTesting an empty array." << endl;
+        {
+            ASSERT(0    == Obj::convertUtcToLocalTimes(0, NY, 0, 0,
+                                                       &testCache));
+            ASSERT(EUID == Obj::convertUtcToLocalTimes(0, "bogusId", 0, 0,
+                                                       &testCache));
+        }
+
+        if (veryVerbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const bdlt::Datetime INPUT[] = { bdlt::Datetime(2010, 1, 1) };
+            bdlt::DatetimeTz     results[1];
+
+            ASSERT_PASS(Obj::convertUtcToLocalTimes(results, NY, INPUT, 1,
+                                                    &testCache));
+            ASSERT_FAIL(Obj::convertUtcToLocalTimes(0,       NY, INPUT, 1,
+                                                    &testCache));
+            ASSERT_FAIL(Obj::convertUtcToLocalTimes(results, 0,  INPUT, 1,
+                                                    &testCache));
+            ASSERT_FAIL(Obj::convertUtcToLocalTimes(results, NY, 0,     1,
+                                                    &testCache));
+            ASSERT_FAIL(Obj::convertUtcToLocalTimes(results, NY, INPUT, 1,
+                                                    0));
+        }
+      } break;
       case 6: {
         // --------------------------------------------------------------------
         // CLASS METHOD 'loadLocalTimePeriodForUtc':
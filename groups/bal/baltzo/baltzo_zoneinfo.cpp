@@ -36,6 +36,23 @@ bool containsDescriptor(
     return false;
 }
 
+namespace {
+
+struct TimeBeforeTransition {
+    // This 'struct' provides a predicate, for use with 'bsl::upper_bound',
+    // that orders a UTC time relative to a 'baltzo::ZoneinfoTransition'.
+
+    bool operator()(bdlt::EpochUtil::TimeT64          utcTime,
+                    const baltzo::ZoneinfoTransition& transition) const
+        // Return 'true' if the specified 'utcTime' is before the time of the
+        // specified 'transition', and 'false' otherwise.
+    {
+        return utcTime < transition.utcTime();
+    }
+};
+
+}  // close unnamed namespace
+
 namespace baltzo {
 
                           // ------------------------
@@ -149,14 +166,17 @@ Zoneinfo::Zoneinfo(const Zoneinfo& original, const allocator_type &allocator)
 , d_transitions(allocator)
 , d_posixExtendedRangeDescription(original.d_posixExtendedRangeDescription,
                                   allocator)
+, d_transitionIndex(allocator)
+, d_transitionIndexBase(0)
 {
     d_transitions.reserve(original.d_transitions.size());
 
     TransitionConstIterator it  = original.d_transitions.begin();
     TransitionConstIterator end = original.d_transitions.end();
     for (; it != end; ++it) {
-        addTransition(it->utcTime(), it->descriptor());
+        insertTransition(it->utcTime(), it->descriptor());
     }
+    rebuildTransitionIndex();
 }
 
 Zoneinfo::Zoneinfo(bslmf::MovableRef<Zoneinfo> original) BSLS_KEYWORD_NOEXCEPT
@@ -168,6 +188,10 @@ Zoneinfo::Zoneinfo(bslmf::MovableRef<Zoneinfo> original) BSLS_KEYWORD_NOEXCEPT
       bslmf::MovableRefUtil::access(original).d_transitions))
 , d_posixExtendedRangeDescription(bslmf::MovableRefUtil::move(
       bslmf::MovableRefUtil::access(original).d_posixExtendedRangeDescription))
+, d_transitionIndex(bslmf::MovableRefUtil::move(
+      bslmf::MovableRefUtil::access(original).d_transitionIndex))
+, d_transitionIndexBase(
+      bslmf::MovableRefUtil::access(original).d_transitionIndexBase)
 {
 }
 
@@ -182,6 +206,8 @@ Zoneinfo::Zoneinfo(bslmf::MovableRef<Zoneinfo> original,
       bslmf::MovableRefUtil::move(bslmf::MovableRefUtil::access(original)
                                       .d_posixExtendedRangeDescription),
       allocator)
+, d_transitionIndex(allocator)
+, d_transitionIndexBase(0)
 {
     const Zoneinfo& origRef = bslmf::MovableRefUtil::access(original);
 
@@ -190,8 +216,9 @@ Zoneinfo::Zoneinfo(bslmf::MovableRef<Zoneinfo> original,
     TransitionConstIterator it  = origRef.d_transitions.begin();
     TransitionConstIterator end = origRef.d_transitions.end();
     for (; it != end; ++it) {
-        addTransition(it->utcTime(), it->descriptor());
+        insertTransition(it->utcTime(), it->descriptor());
     }
+    rebuildTransitionIndex();
 }
 
 // MANIPULATORS
@@ -214,11 +241,76 @@ Zoneinfo& Zoneinfo::operator=(bslmf::MovableRef<Zoneinfo> rhs)
     d_posixExtendedRangeDescription =
            bslmf::MovableRefUtil::move(rhsRef.d_posixExtendedRangeDescription);
 
+    d_transitionIndex     = bslmf::MovableRefUtil::move(
+                                                     rhsRef.d_transitionIndex);
+    d_transitionIndexBase = rhsRef.d_transitionIndexBase;
+
     return *this;
 }
 
 void Zoneinfo::addTransition(bdlt::EpochUtil::TimeT64   utcTime,
                              const LocalTimeDescriptor& descriptor)
+{
+    const bool isAppend = d_transitions.empty()
+                       || d_transitions.back().utcTime() < utcTime;
+
+    // Move the index aside first, so that it is never stale should either of
+    // the following operations throw.
+
+    bsl::vector<int> index(d_transitionIndex.get_allocator());
+    index.swap(d_transitionIndex);
+
+    insertTransition(utcTime, descriptor);
+
+    if (isAppend && !index.empty()) {
+        // Appending a transition to an indexed sequence affects only the
+        // entries past the end of the index, so that loading transitions in
+        // order takes time linear (rather than quadratic) in their number.
+
+        extendTransitionIndex(&index);
+    }
+    else {
+        rebuildTransitionIndex();
+    }
+}
+
+void Zoneinfo::extendTransitionIndex(bsl::vector<int> *index)
+{
+    BSLS_ASSERT(index);
+    BSLS_ASSERT(!index->empty());
+    BSLS_ASSERT(d_transitionIndex.empty());
+
+    const bsl::size_t              numTransitions = d_transitions.size();
+    const bdlt::EpochUtil::TimeT64 last = d_transitions.back().utcTime();
+    const bsls::Types::Uint64      numEntries =
+               (static_cast<bsls::Types::Uint64>(last - d_transitionIndexBase)
+                                                >> k_INDEX_INTERVAL_SHIFT) + 1;
+
+    if (numEntries > static_cast<bsls::Types::Uint64>(k_MAX_INDEX_SIZE)) {
+        return;                                                       // RETURN
+    }
+
+    // The entries added for intervals starting before the new last transition
+    // refer to the previous last transition.  Only the final entry can start
+    // exactly at the new last transition.
+
+    const bsl::size_t oldSize = index->size();
+    index->resize(static_cast<bsl::size_t>(numEntries),
+                  static_cast<int>(numTransitions - 2));
+
+    const bdlt::EpochUtil::TimeT64 start =
+        d_transitionIndexBase
+        + (static_cast<bdlt::EpochUtil::TimeT64>(numEntries - 1)
+                                                    << k_INDEX_INTERVAL_SHIFT);
+    if (oldSize < index->size() && start == last) {
+        index->back() = static_cast<int>(numTransitions - 1);
+    }
+
+    d_transitionIndex.swap(*index);
+}
+
+void Zoneinfo::insertTransition(bdlt::EpochUtil::TimeT64   utcTime,
+                                const LocalTimeDescriptor& descriptor)
 {
     typedef bsl::vector<ZoneinfoTransition>::iterator TransitionIterator;
 
@@ -261,6 +353,41 @@ void Zoneinfo::addTransition(bdlt::EpochUtil::TimeT64   utcTime,
     return;
 }
 
+void Zoneinfo::rebuildTransitionIndex()
+{
+    d_transitionIndex.clear();
+
+    const bsl::size_t numTransitions = d_transitions.size();
+    if (numTransitions < 2) {
+        return;                                                       // RETURN
+    }
+
+    const bdlt::EpochUtil::TimeT64 base = d_transitions[1].utcTime();
+    const bsls::Types::Uint64      span = static_cast<bsls::Types::Uint64>(
+                                d_transitions.back().utcTime() - base);
+    const bsls::Types::Uint64      numEntries =
+                                          (span >> k_INDEX_INTERVAL_SHIFT) + 1;
+
+    if (numEntries > static_cast<bsls::Types::Uint64>(k_MAX_INDEX_SIZE)) {
+        return;                                                       // RETURN
+    }
+
+    d_transitionIndex.resize(static_cast<bsl::size_t>(numEntries));
+
+    bsl::size_t i = 1;
+    for (bsl::size_t entry = 0; entry < d_transitionIndex.size(); ++entry) {
+        const bdlt::EpochUtil::TimeT64 start =
+           base + (static_cast<bdlt::EpochUtil::TimeT64>(entry)
+                                                    << k_INDEX_INTERVAL_SHIFT);
+        while (i + 1 < numTransitions
+            && d_transitions[i + 1].utcTime() <= start) {
+            ++i;
+        }
+        d_transitionIndex[entry] = static_cast<int>(i);
+    }
+    d_transitionIndexBase = base;
+}
+
 // ACCESSORS
 Zoneinfo::TransitionConstIterator
 Zoneinfo::findTransitionForUtcTime(const bdlt::Datetime& utcTime) const
@@ -269,16 +396,39 @@ Zoneinfo::findTransitionForUtcTime(const bdlt::Datetime& utcTime) const
     BSLS_ASSERT(d_transitions.front().utcTime() <=
                                    bdlt::EpochUtil::convertToTimeT64(utcTime));
 
-    LocalTimeDescriptor dummyDescriptor;
-
     const bdlt::EpochUtil::TimeT64 utcTimeT64 =
                                     bdlt::EpochUtil::convertToTimeT64(utcTime);
-    TransitionConstIterator it = bsl::upper_bound(
-                                     d_transitions.begin(),
-                                     d_transitions.end(),
-                                     ZoneinfoTransition(
-                                                            utcTimeT64,
-                                                            &dummyDescriptor));
+
+    if (!d_transitionIndex.empty()) {
+        if (utcTimeT64 < d_transitionIndexBase) {
+            return d_transitions.begin();                             // RETURN
+        }
+
+        // Start from the last transition at or before the beginning of the
+        // interval containing 'utcTimeT64' (or from the last transition, if
+        // 'utcTimeT64' is past the indexed range), and step forward over the
+        // few transitions within the interval.
+
+        const bsls::Types::Uint64 entry =
+                 static_cast<bsls::Types::Uint64>(utcTimeT64 -
+                                                       d_transitionIndexBase)
+                                                    >> k_INDEX_INTERVAL_SHIFT;
+        const bsl::size_t numTransitions = d_transitions.size();
+
+        bsl::size_t i = entry < d_transitionIndex.size()
+                      ? d_transitionIndex[static_cast<bsl::size_t>(entry)]
+                      : numTransitions - 1;
+        while (i + 1 < numTransitions
+            && d_transitions[i + 1].utcTime() <= utcTimeT64) {
+            ++i;
+        }
+        return d_transitions.begin() + i;                             // RETURN
+    }
+
+    TransitionConstIterator it = bsl::upper_bound(d_transitions.begin(),
+                                                  d_transitions.end(),
+                                                  utcTimeT64,
+                                                  TimeBeforeTransition());
 
     if (d_transitions.begin() != it) {
         --it;
@@ -64,6 +64,19 @@ BSLS_IDENT("$Id: $")
 // typically populated by the client through the 'baltzo::Loader' protocol, and
 // not directly.
 //
+///Transition Index
+///----------------
+// In addition to its salient attributes, a 'baltzo::Zoneinfo' object
+// maintains an index that maps each interval of 2^25 seconds (a little over a
+// year) between its second and last transitions to the last transition at or
+// before the start of that interval.  'findTransitionForUtcTime' uses this
+// index to locate the relevant transition by examining only the (typically one
+// or two) transitions within the interval, so that its cost does not depend
+// on the number of transitions.  The index is updated by 'addTransition'
+// (incrementally when the transition is added after all others, so that
+// loading transitions in order takes linear time) and is not part of the value
+// of the object.
+//
 ///Zoneinfo Database
 ///-----------------
 // This database, also referred to as either the TZ database or the Olson
@@ -401,6 +414,15 @@ class Zoneinfo {
         // Alias for the set of unique local-time descriptors that are managed
         // by a 'Zoneinfo' object.
 
+    enum {
+        k_INDEX_INTERVAL_SHIFT = 25,        // log2 of the length (in seconds)
+                                            // of the interval covered by each
+                                            // entry of 'd_transitionIndex'
+
+        k_MAX_INDEX_SIZE       = 1 << 16    // maximum number of entries in
+                                            // 'd_transitionIndex'
+    };
+
     // DATA
     bsl::string         d_identifier;
                           // this time zone's id
@@ -418,6 +440,41 @@ class Zoneinfo {
                           // optional POSIX-like TZ environment string
                           // representing far-reaching times
 
+    bsl::vector<int>    d_transitionIndex;
+                          // index of the last transition at or before the
+                          // start of each successive interval of
+                          // '2^k_INDEX_INTERVAL_SHIFT' seconds, starting at
+                          // 'd_transitionIndexBase'; empty if there are fewer
+                          // than two transitions, or if the index would
+                          // exceed 'k_MAX_INDEX_SIZE' entries (see
+                          // {Transition Index})
+
+    bdlt::EpochUtil::TimeT64
+                        d_transitionIndexBase;
+                          // time of the second transition, if
+                          // 'd_transitionIndex' is not empty
+
+    // PRIVATE MANIPULATORS
+    void insertTransition(bdlt::EpochUtil::TimeT64   utcTime,
+                          const LocalTimeDescriptor& descriptor);
+        // Add to this object a transition occurring at the specified 'utcTime'
+        // with the specified 'descriptor', as described by 'addTransition',
+        // without updating the transition index.
+
+    void extendTransitionIndex(bsl::vector<int> *index);
+        // Load into the transition index of this object the specified 'index',
+        // extended to cover the last transition of this object, or leave the
+        // transition index of this object empty if it would exceed
+        // 'k_MAX_INDEX_SIZE' entries.  The behavior is undefined unless
+        // 'index' is non-empty and was computed for the transitions of this
+        // object other than its last, the last transition is later than all
+        // others, and the transition index of this object is empty.
+
+    void rebuildTransitionIndex();
+        // Recompute the transition index of this object from its sequence of
+        // transitions.  If an exception is thrown, the index is left empty
+        // (and 'findTransitionForUtcTime' falls back to a binary search).
+
     // FRIENDS
     friend bool operator==(const Zoneinfo&, const Zoneinfo&);
 
@@ -520,7 +577,8 @@ class Zoneinfo {
         // that holds the local-time descriptor associated with the specified
         // 'utcTime'.  The behavior is undefined unless 'numTransitions() > 0'
         // and 'utcTime' is at or after the transition returned by
-        // 'firstTransition'.
+        // 'firstTransition'.  Note that this operation takes constant time
+        // for typical time zones (see {Transition Index}).
 
     const ZoneinfoTransition& firstTransition() const;
         // Return a reference providing non-modifiable access to the first
@@ -682,6 +740,8 @@ Zoneinfo::Zoneinfo()
 , d_descriptors()
 , d_transitions()
 , d_posixExtendedRangeDescription()
+, d_transitionIndex()
+, d_transitionIndexBase(0)
 {
 }
 
@@ -691,6 +751,8 @@ Zoneinfo::Zoneinfo(const allocator_type& allocator)
 , d_descriptors(allocator)
 , d_transitions(allocator)
 , d_posixExtendedRangeDescription(allocator)
+, d_transitionIndex(allocator)
+, d_transitionIndexBase(0)
 {
 }
 
@@ -744,6 +806,9 @@ void Zoneinfo::swap(Zoneinfo& other)
     bslalg::SwapUtil::swap(&d_transitions, &other.d_transitions);
     bslalg::SwapUtil::swap(&d_posixExtendedRangeDescription,
                            &other.d_posixExtendedRangeDescription);
+    bslalg::SwapUtil::swap(&d_transitionIndex, &other.d_transitionIndex);
+    bslalg::SwapUtil::swap(&d_transitionIndexBase,
+                           &other.d_transitionIndexBase);
 }
 
 // ACCESSORS
@@ -111,6 +111,7 @@ using namespace bsl;
 // ACCESSORS
 // [ 4] bslma::Allocator *allocator() const;
 // [16] TransitionConstIterator findTransitionForUtcTime(utcTime) const;
+// [17] CONCERN: 'findTransitionForUtcTime' uses a valid transition index
 // [ 4] const Transition& firstTransition() const;
 // [ 4] allocator_type get_allocator() const;
 // [ 9] const bsl::string& identifier() const;
@@ -129,7 +130,7 @@ using namespace bsl;
 // [13] void swap(baltzo::Zoneinfo& first, baltzo::Zoneinfo& second);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST: 'baltzo::Zoneinfo', 'baltzo::ZoneinfoTransition'
-// [17] USAGE EXAMPLE
+// [18] USAGE EXAMPLE
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -463,7 +464,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:
-      case 17: {
+      case 18: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -574,6 +575,246 @@ int main(int argc, char *argv[])
     ASSERT(expectedTime == nyDatetime.localDatetime());
 //..
       } break;
+      case 17: {
+        // --------------------------------------------------------------------
+        // TESTING TRANSITION INDEX
+        //   Ensure that the index maintained for 'findTransitionForUtcTime'
+        //   is consistent with the transitions for all the ways an object can
+        //   acquire them.
+        //
+        // Concerns:
+        //: 1 'findTransitionForUtcTime' returns the last transition at or
+        //:   before the supplied time, for times at, immediately before, and
+        //:   immediately after each transition, before the second transition,
+        //:   and after the last transition, including for intervals of the
+        //:   index that contain several transitions, or none.
+        //:
+        //: 2 The index is correct regardless of the order in which
+        //:   transitions are added, and after a transition is replaced.  In
+        //:   particular, the index is correct when it is extended by
+        //:   transitions added in order, including transitions at the start
+        //:   of an interval of the index, and transitions that make the
+        //:   object unindexable.
+        //:
+        //: 3 Copy construction, move construction, copy and move assignment,
+        //:   and 'swap' produce objects with a correct index.
+        //:
+        //: 4 Objects whose transitions span too long a period to be indexed
+        //:   return correct results.
+        //:
+        //: 5 'findTransitionForUtcTime' does not allocate memory.
+        //
+        // Plan:
+        //: 1 Create objects having pseudo-random transitions (clustered so
+        //:   that some index intervals have several, and some none), added in
+        //:   pseudo-random order, and compare 'findTransitionForUtcTime'
+        //:   against a linear search for a set of probe times derived from the
+        //:   transitions.  (C-1..2, 5)
+        //:
+        //: 2 Repeat P-1 for copies, moves, and swapped objects.  (C-3)
+        //:
+        //: 3 Repeat P-1 for an object having a transition far in the future.
+        //:   (C-4)
+        //:
+        //: 4 Add transitions in order, some of them at the start of an
+        //:   interval of the index, and some separated by several empty
+        //:   intervals, and verify 'findTransitionForUtcTime' after each
+        //:   addition, and after a final transition far in the future.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: 'findTransitionForUtcTime' uses a valid transition index
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING TRANSITION INDEX" << endl
+                          << "========================" << endl;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const TimeT64 FIRST = bdlt::EpochUtil::convertToTimeT64(
+                                                    bdlt::Datetime(1, 1, 1));
+        const TimeT64 LAST  = bdlt::EpochUtil::convertToTimeT64(
+                                   bdlt::Datetime(9999, 12, 31, 23, 59, 59));
+
+        const Descriptor DESC[] = {
+            Descriptor(-5 * 3600, false, "EST"),
+            Descriptor(-4 * 3600, true,  "EDT"),
+            Descriptor(         0, false, "UTC"),
+        };
+
+        struct Verifier {
+            static void verify(int line, const Obj& X, TimeT64 last)
+                // Verify that 'findTransitionForUtcTime' on the specified 'X'
+                // matches a linear search for times derived from the
+                // transitions of 'X' that are no later than the specified
+                // 'last', reporting failures against the specified 'line'.
+            {
+                bsl::vector<TimeT64> probes(X.get_allocator());
+                TransitionConstIter  it  = X.beginTransitions();
+                TransitionConstIter  end = X.endTransitions();
+                for (; it != end; ++it) {
+                    probes.push_back(it->utcTime());
+                    probes.push_back(it->utcTime() - 1);
+                    probes.push_back(it->utcTime() + 1);
+                    probes.push_back(it->utcTime() + 20000000);
+                    probes.push_back(it->utcTime() + 40000000);
+                }
+                probes.push_back(last);
+
+                const TimeT64 first = X.firstTransition().utcTime();
+
+                for (bsl::size_t i = 0; i < probes.size(); ++i) {
+                    const TimeT64 TIME = probes[i];
+                    if (TIME < first || last < TIME) {
+                        continue;
+                    }
+
+                    TransitionConstIter exp = X.beginTransitions();
+                    for (TransitionConstIter jt = X.beginTransitions();
+                                           jt != end && jt->utcTime() <= TIME;
+                                           ++jt) {
+                        exp = jt;
+                    }
+
+                    const bdlt::Datetime UTC_TIME =
+                                   bdlt::EpochUtil::convertFromTimeT64(TIME);
+
+                    ASSERTV(line, TIME,
+                            exp == X.findTransitionForUtcTime(UTC_TIME));
+                }
+            }
+        };
+
+        unsigned int seed = 1;
+        for (int ti = 0; ti < 50; ++ti) {
+            // Create clustered transitions, starting from year 1.
+
+            bsl::vector<TimeT64> times;
+            times.push_back(FIRST);
+
+            TimeT64   time = bdlt::EpochUtil::convertToTimeT64(
+                                         bdlt::Datetime(1850 + ti, 1, 1));
+            const int NUM_TRANSITIONS = ti * 7 % 300 + 1;
+            for (int i = 0; i < NUM_TRANSITIONS; ++i) {
+                seed = seed * 1103515245 + 12345;
+                switch ((seed >> 16) % 4) {
+                  case 0:  time += 1;                              break;
+                  case 1:  time += (seed >> 8) % 3600;             break;
+                  case 2:  time += (seed >> 4) % (180 * 86400);    break;
+                  default: time += (seed >> 4) % (4 * 365 * 86400) + 1;
+                }
+                times.push_back(time);
+            }
+
+            // Add in pseudo-random order, including replacements.
+
+            bsl::vector<TimeT64> order(times);
+            for (bsl::size_t i = order.size(); 1 < i; --i) {
+                seed = seed * 1103515245 + 12345;
+                bsl::swap(order[i - 1], order[(seed >> 8) % i]);
+            }
+
+            Obj mX(&oa);  const Obj& X = mX;
+            for (bsl::size_t i = 0; i < order.size(); ++i) {
+                mX.addTransition(order[i], DESC[i % 3]);
+                if (0 == i % 5) {
+                    mX.addTransition(order[i / 2], DESC[(i + 1) % 3]);
+                }
+            }
+
+            const bsls::Types::Int64 NUM_ALLOCS = da.numAllocations();
+            Verifier::verify(L_, X, LAST);
+            ASSERTV(ti, NUM_ALLOCS == da.numAllocations());
+
+            {
+                Obj mY(X, &oa);  const Obj& Y = mY;
+                Verifier::verify(L_, Y, LAST);
+
+                Obj mZ(bslmf::MovableRefUtil::move(mY));
+                Verifier::verify(L_, mZ, LAST);
+
+                bslma::TestAllocator za("other", veryVeryVeryVerbose);
+                Obj mW(bslmf::MovableRefUtil::move(mZ), &za);
+                Verifier::verify(L_, mW, LAST);
+
+                Obj mV(&oa);
+                mV = X;
+                Verifier::verify(L_, mV, LAST);
+
+                Obj mU(&oa);
+                mU.addTransition(FIRST, DESC[0]);
+                mU = bslmf::MovableRefUtil::move(mV);
+                Verifier::verify(L_, mU, LAST);
+
+                Obj mT(&oa);
+                mT.addTransition(FIRST, DESC[1]);
+                mT.addTransition(FIRST + 1000, DESC[2]);
+                mT.swap(mU);
+                Verifier::verify(L_, mT, LAST);
+                Verifier::verify(L_, mU, LAST);
+            }
+        }
+
+        if (verbose) cout << "\nTesting an unindexable time zone." << endl;
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            mX.addTransition(FIRST, DESC[0]);
+            mX.addTransition(0, DESC[1]);
+            mX.addTransition(86400, DESC[2]);
+            mX.addTransition(1LL << 42, DESC[0]);
+
+            Verifier::verify(L_, X, LAST);
+        }
+
+        if (verbose) cout << "\nTesting transitions added in order." << endl;
+        {
+            const TimeT64 BASE     = 1000000000;
+            const TimeT64 INTERVAL = 1LL << 25;
+
+            // The index covers intervals starting at the second transition,
+            // 'BASE'.
+
+            const TimeT64 TIMES[] = {
+                BASE,
+                BASE + 1,
+                BASE + INTERVAL,
+                BASE + INTERVAL + 1,
+                BASE + 2 * INTERVAL - 1,
+                BASE + 5 * INTERVAL,
+                BASE + 5 * INTERVAL + 7,
+                BASE + 9 * INTERVAL + 100,
+                BASE + 10 * INTERVAL,
+                BASE + 200 * INTERVAL,
+                1LL << 42,
+                (1LL << 42) + 1,
+            };
+            const int NUM_TIMES = static_cast<int>(sizeof TIMES
+                                                   / sizeof *TIMES);
+
+            Obj mX(&oa);  const Obj& X = mX;
+            mX.addTransition(FIRST, DESC[0]);
+            for (int i = 0; i < NUM_TIMES; ++i) {
+                mX.addTransition(TIMES[i], DESC[i % 3]);
+
+                Verifier::verify(L_, X, LAST);
+            }
+
+            Obj mY(X, &oa);  const Obj& Y = mY;
+            ASSERT(X == Y);
+            Verifier::verify(L_, Y, LAST);
+        }
+
+        if (verbose) cout << "\nTesting a single transition." << endl;
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            mX.addTransition(FIRST, DESC[0]);
+
+            Verifier::verify(L_, X, LAST);
+        }
+      } break;
       case 16: {
         // --------------------------------------------------------------------
         // 'baltzo::Zoneinfo' 'findTransitionForUtcTime'
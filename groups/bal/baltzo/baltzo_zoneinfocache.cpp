@@ -7,8 +7,9 @@ BSLS_IDENT_RCSID(baltzo_zoneinfocache_cpp, "$Id$ $CSID$")
 #include <baltzo_errorcode.h>         // for testing only
 #include <baltzo_zoneinfoutil.h>
 
-#include <bslmt_readlockguard.h>
-#include <bslmt_writelockguard.h>
+#include <bdlb_cstringhash.h>
+
+#include <bslmt_lockguard.h>
 
 #include <bslma_allocator.h>
 #include <bslma_rawdeleterproctor.h>
@@ -17,12 +18,143 @@ BSLS_IDENT_RCSID(baltzo_zoneinfocache_cpp, "$Id$ $CSID$")
 
 #include <bsls_log.h>
 
+#include <bsl_cstring.h>
 #include <bsl_set.h>
 #include <bsl_string.h>
 
 namespace BloombergLP {
 namespace baltzo {
 
+                         // ==========================
+                         // class ZoneinfoCache::Table
+                         // ==========================
+
+class ZoneinfoCache::Table {
+    // This class implements a fixed-capacity, open-addressing (linear probing)
+    // hash table of 'Zoneinfo' addresses, keyed by time-zone identifier.
+    // Each slot is filled at most once, by 'insert' (which must be externally
+    // serialized), and is published with release semantics, so 'find' may be
+    // invoked concurrently with 'insert' without synchronization.
+
+    // DATA
+    bsls::AtomicPointer<Zoneinfo> *d_slots_p;      // 'd_mask + 1' slots
+
+    bsl::size_t                    d_mask;         // capacity - 1
+
+    Table                         *d_previous_p;   // superseded table (held,
+                                                   // not owned)
+
+    bslma::Allocator              *d_allocator_p;  // memory allocator (held,
+                                                   // not owned)
+
+    // NOT IMPLEMENTED
+    Table(const Table&);
+    Table& operator=(const Table&);
+
+  public:
+    // CREATORS
+    Table(bsl::size_t capacity, bslma::Allocator *allocator);
+        // Create an empty table having the specified 'capacity', using the
+        // specified 'allocator' to supply memory.  The behavior is undefined
+        // unless 'capacity' is a power of 2.
+
+    ~Table();
+        // Destroy this object.
+
+    // MANIPULATORS
+    void insert(Zoneinfo *zoneinfo);
+        // Publish the specified 'zoneinfo' in this table.  The behavior is
+        // undefined unless this table has at least two empty slots, and no
+        // 'Zoneinfo' having the same identifier is in this table.
+
+    void setPrevious(Table *previous);
+        // Set the table superseded by this table to the specified 'previous'.
+
+    // ACCESSORS
+    bsl::size_t capacity() const;
+        // Return the number of slots in this table.
+
+    const Zoneinfo *find(const char *timeZoneId) const;
+        // Return the address of the 'Zoneinfo' in this table whose identifier
+        // is the specified 'timeZoneId', or 0 if there is no such 'Zoneinfo'.
+
+    Table *previous() const;
+        // Return the table superseded by this table, or 0 if there is none.
+};
+
+                         // --------------------------
+                         // class ZoneinfoCache::Table
+                         // --------------------------
+
+// CREATORS
+ZoneinfoCache::Table::Table(bsl::size_t capacity, bslma::Allocator *allocator)
+: d_slots_p(0)
+, d_mask(capacity - 1)
+, d_previous_p(0)
+, d_allocator_p(allocator)
+{
+    BSLS_ASSERT(0 != capacity);
+    BSLS_ASSERT(0 == (capacity & (capacity - 1)));
+
+    d_slots_p = static_cast<bsls::AtomicPointer<Zoneinfo> *>(
+                   d_allocator_p->allocate(capacity * sizeof *d_slots_p));
+    for (bsl::size_t i = 0; i < capacity; ++i) {
+        new (d_slots_p + i) bsls::AtomicPointer<Zoneinfo>(0);
+    }
+}
+
+ZoneinfoCache::Table::~Table()
+{
+    d_allocator_p->deallocate(d_slots_p);
+}
+
+// MANIPULATORS
+void ZoneinfoCache::Table::insert(Zoneinfo *zoneinfo)
+{
+    BSLS_ASSERT(zoneinfo);
+
+    bsl::size_t i = bdlb::CStringHash()(zoneinfo->identifier().c_str())
+                  & d_mask;
+    while (0 != d_slots_p[i].loadRelaxed()) {
+        i = (i + 1) & d_mask;
+    }
+    d_slots_p[i].storeRelease(zoneinfo);
+}
+
+void ZoneinfoCache::Table::setPrevious(Table *previous)
+{
+    d_previous_p = previous;
+}
+
+// ACCESSORS
+bsl::size_t ZoneinfoCache::Table::capacity() const
+{
+    return d_mask + 1;
+}
+
+const Zoneinfo *ZoneinfoCache::Table::find(const char *timeZoneId) const
+{
+    BSLS_ASSERT(timeZoneId);
+
+    // The table always has an empty slot, which terminates the probe.
+
+    for (bsl::size_t i = bdlb::CStringHash()(timeZoneId) & d_mask;;
+                                                       i = (i + 1) & d_mask) {
+        const Zoneinfo *zoneinfo = d_slots_p[i].loadAcquire();
+        if (0 == zoneinfo) {
+            return 0;                                                 // RETURN
+        }
+        if (0 == bsl::strcmp(zoneinfo->identifier().c_str(), timeZoneId)) {
+            return zoneinfo;                                          // RETURN
+        }
+    }
+}
+
+ZoneinfoCache::Table *ZoneinfoCache::Table::previous() const
+{
+    return d_previous_p;
+}
+
                             // -------------------
                             // class ZoneinfoCache
                             // -------------------
@@ -30,6 +162,13 @@ namespace baltzo {
 // CREATORS
 ZoneinfoCache::~ZoneinfoCache()
 {
+    Table *table = d_table_p.loadRelaxed();
+    while (table) {
+        Table *previous = table->previous();
+        d_allocator.mechanism()->deleteObject(table);
+        table = previous;
+    }
+
     for (ZoneinfoMap::iterator it  = d_cache.begin();
                                it != d_cache.end();
                                ++it) {
@@ -59,7 +198,7 @@ const Zoneinfo *ZoneinfoCache::getZoneinfo(int *rc, const char *timeZoneId)
         return result;                                                // RETURN
     }
 
-    bslmt::WriteLockGuard<bslmt::RWMutex> guard(&d_lock);
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
 
     // We use 'lower_bound' to return the position where the 'timeZoneId'
     // should be (even if it is not in the map), so that it can be used as an
@@ -109,6 +248,31 @@ const Zoneinfo *ZoneinfoCache::getZoneinfo(int *rc, const char *timeZoneId)
             return 0;                                                 // RETURN
         }
 
+        // Keep the published table at most half full, so that probes remain
+        // short and always reach an empty slot.  A larger table is allocated
+        // before 'd_cache' is modified, so that a failure leaves both intact.
+
+        enum { k_INITIAL_CAPACITY = 16 };
+
+        Table       *table    = d_table_p.loadRelaxed();
+        bsl::size_t  capacity = table ? table->capacity()
+                                      : static_cast<bsl::size_t>(
+                                                           k_INITIAL_CAPACITY);
+        Table       *newTable = 0;
+
+        if (0 == table || 2 * (d_cache.size() + 1) > capacity) {
+            while (2 * (d_cache.size() + 1) > capacity) {
+                capacity *= 2;
+            }
+            newTable = new (*d_allocator.mechanism()) Table(
+                                                      capacity,
+                                                      d_allocator.mechanism());
+        }
+
+        bslma::RawDeleterProctor<Table, bslma::Allocator> tableProctor(
+                                                      newTable,
+                                                      d_allocator.mechanism());
+
         d_cache.insert(
                   it,
                   ZoneinfoMap::value_type(newTimeZonePtr->identifier().c_str(),
@@ -118,6 +282,20 @@ const Zoneinfo *ZoneinfoCache::getZoneinfo(int *rc, const char *timeZoneId)
         // The pointer has been copied, so the proctor must release ownership.
 
         proctor.release();
+
+        if (newTable) {
+            for (ZoneinfoMap::const_iterator cacheIt  = d_cache.begin();
+                                             cacheIt != d_cache.end();
+                                             ++cacheIt) {
+                newTable->insert(cacheIt->second);
+            }
+            newTable->setPrevious(table);
+            d_table_p.storeRelease(newTable);
+            tableProctor.release();
+        }
+        else {
+            table->insert(newTimeZonePtr);
+        }
     }
 
     return result;
@@ -128,13 +306,8 @@ const Zoneinfo *ZoneinfoCache::lookupZoneinfo(const char *timeZoneId) const
 {
     BSLS_ASSERT(0 != timeZoneId);
 
-    bslmt::ReadLockGuard<bslmt::RWMutex> guard(&d_lock);
-
-    ZoneinfoMap::const_iterator it = d_cache.find(timeZoneId);
-    if (d_cache.end() != it) {
-        return it->second;                                            // RETURN
-    }
-    return 0;
+    const Table *table = d_table_p.loadAcquire();
+    return table ? table->find(timeZoneId) : 0;
 }
 
 }  // close package namespace
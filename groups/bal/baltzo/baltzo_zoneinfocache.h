@@ -28,6 +28,12 @@ BSLS_IDENT("$Id: $")
 // operations on an object can be safely invoked simultaneously from multiple
 // threads.
 //
+// Once loaded, a 'baltzo::Zoneinfo' object is published in an open-addressing
+// hash table that is read without acquiring any lock, so 'lookupZoneinfo', and
+// 'getZoneinfo' for a time zone that is already cached, do not contend with
+// each other or with the loading of other time zones.  Only loading a time
+// zone not yet in the cache is serialized (by a mutex).
+//
 ///Usage
 ///-----
 // In this section, we demonstrate creating a 'baltzo::ZoneinfoCache' object
@@ -156,7 +162,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmf_nestedtraitdeclaration.h>
 
-#include <bslmt_rwmutex.h>
+#include <bslmt_mutex.h>
 
 #include <bsls_assert.h>
 #include <bsls_atomic.h>
@@ -193,16 +199,28 @@ class ZoneinfoCache {
     // PRIVATE TYPES
     typedef bsl::map<const char *, Zoneinfo *, bdlb::CStringLess> ZoneinfoMap;
 
+    class Table;
+        // Lock-free hash table of published time-zone information (defined
+        // in the '.cpp' file).
+
     // DATA
-    ZoneinfoMap             d_cache;      // cached time-zone info, indexed by
-                                          // time-zone id
+    ZoneinfoMap                 d_cache;      // cached time-zone info,
+                                              // indexed by time-zone id
+
+    bsls::AtomicPointer<Table>  d_table_p;    // published time-zone info;
+                                              // superseded tables are chained
+                                              // and kept until destruction,
+                                              // as readers may still use them
 
-    Loader                 *d_loader_p;   // loader used to obtain time-zone
-                                          // information (held, not owned)
+    Loader                     *d_loader_p;   // loader used to obtain
+                                              // time-zone information (held,
+                                              // not owned)
 
-    mutable bslmt::RWMutex  d_lock;       // cache access synchronization
+    bslmt::Mutex                d_lock;       // serializes modification of
+                                              // 'd_cache' and 'd_table_p'
 
-    allocator_type          d_allocator;  // allocator used to supply memory
+    allocator_type              d_allocator;  // allocator used to supply
+                                              // memory
 
     // NOT IMPLEMENTED
     ZoneinfoCache(const ZoneinfoCache&);
@@ -258,6 +276,7 @@ class ZoneinfoCache {
         // Zoneinfo object returned is guaranteed to be well-formed (i.e.,
         // 'ZoneinfoUtil::isWellFormed will return 'true' if called with the
         // returned value), and remain valid for the lifetime of this object.
+        // Note that this operation does not acquire a lock.
 
     allocator_type get_allocator() const;
         // Return the allocator used by this object to supply memory.  Note
@@ -277,6 +296,7 @@ class ZoneinfoCache {
 inline
 ZoneinfoCache::ZoneinfoCache(Loader *loader, const allocator_type&  allocator)
 : d_cache(allocator)
+, d_table_p(0)
 , d_loader_p(loader)
 , d_allocator(allocator)
 {
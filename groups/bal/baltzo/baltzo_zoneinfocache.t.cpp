@@ -27,6 +27,7 @@
 #include <bsls_types.h>
 
 #include <bsl_climits.h>
+#include <bsl_cstdio.h>
 #include <bsl_cstdlib.h>
 #include <bsl_iostream.h>
 #include <bsl_map.h>
@@ -81,8 +82,9 @@ using namespace std;
 // [ 4] allocator_type get_allocator() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 9] USAGE EXAMPLE
+// [10] USAGE EXAMPLE
 // [ 8] CONCERN: All methods are thread-safe
+// [ 9] CONCERN: 'lookupZoneinfo' is safe while the cache grows
 // [ 7] CONCERN: ACCESSOR methods are declared 'const'.
 // [ 6] CONCERN: CREATOR & MANIPULATOR parameters are declared 'const'.
 // [ 7] CONCERN: No memory is ever allocated from the global allocator.
@@ -513,6 +515,66 @@ extern "C" void *workerThread(void *arg)
 
 }  // close namespace BALTZO_ZONEINFOCACHE_CONCURRENCY
 
+namespace BALTZO_ZONEINFOCACHE_GROWTH {
+
+enum { NUM_IDS = 300 };
+
+char            IDS[NUM_IDS][16];
+bsls::AtomicInt numLoaded(0);
+bsls::AtomicInt numLookups(0);
+
+struct ThreadData {
+    Obj            *d_cache_p;    // cache under test
+    bslmt::Barrier *d_barrier_p;  // testing barrier
+};
+
+extern "C" void *loaderThread(void *arg)
+    // Load, in order, each of the time zones identified in 'IDS' into the
+    // cache referred to by the specified 'arg', recording the number loaded
+    // in 'numLoaded'.
+{
+    ThreadData *p  = static_cast<ThreadData *>(arg);
+    Obj&        mX = *p->d_cache_p;
+
+    p->d_barrier_p->wait();
+    for (int i = 0; i < NUM_IDS; ++i) {
+        const Zone *result = mX.getZoneinfo(IDS[i]);
+        ASSERTV(i, result);
+        ASSERTV(i, result && result->identifier() == IDS[i]);
+
+        numLoaded.storeRelease(i + 1);
+    }
+    return 0;
+}
+
+extern "C" void *readerThread(void *arg)
+    // Repeatedly look up the time zones identified in 'IDS' in the cache
+    // referred to by the specified 'arg' until all have been loaded, and
+    // verify that every time zone reported as loaded is found, and that any
+    // time zone found is the one that was requested.
+{
+    ThreadData *p = static_cast<ThreadData *>(arg);
+    const Obj&  X = *p->d_cache_p;
+
+    p->d_barrier_p->wait();
+    int loaded;
+    do {
+        loaded = numLoaded.loadAcquire();
+        for (int i = 0; i < NUM_IDS; ++i) {
+            const Zone *result = X.lookupZoneinfo(IDS[i]);
+            if (i < loaded) {
+                ASSERTV(i, loaded, result);
+            }
+            ASSERTV(i, 0 == result || result->identifier() == IDS[i]);
+        }
+        ASSERT(0 == X.lookupZoneinfo("NOT_AN_ID"));
+        ++numLookups;
+    } while (loaded < NUM_IDS);
+    return 0;
+}
+
+}  // close namespace BALTZO_ZONEINFOCACHE_GROWTH
+
 // ============================================================================
 //                               USAGE EXAMPLE
 // ----------------------------------------------------------------------------
@@ -648,7 +710,7 @@ int main(int argc, char *argv[])
     bslma::TestAllocatorMonitor gam(&globalAllocator);
 
     switch (test) { case 0:
-      case 9: {
+      case 10: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   The usage example provided in the component header file must
@@ -782,6 +844,117 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // TESTING 'lookupZoneinfo' DURING GROWTH
+        //
+        // Concerns:
+        //: 1 That 'lookupZoneinfo' finds every time zone that has been
+        //:   returned by 'getZoneinfo', and no other, including after the
+        //:   cache has grown to hold many time zones.
+        //:
+        //: 2 That 'lookupZoneinfo', called concurrently with 'getZoneinfo'
+        //:   calls that cause the cache to grow, returns either 0 or the
+        //:   unique object loaded for the requested id, and always finds an
+        //:   id whose 'getZoneinfo' call has completed.
+        //:
+        //: 3 That growing the cache does not allocate from the default
+        //:   allocator, and all memory is released on destruction.
+        //
+        // Plan:
+        //: 1 Configure a 'TestDriverTestLoader' with many time zones.
+        //:
+        //: 2 Load the time zones one at a time, verifying after each load
+        //:   that 'lookupZoneinfo' finds exactly the time zones loaded so
+        //:   far.  (C-1, 3)
+        //:
+        //: 3 Load the time zones from one thread while several other threads
+        //:   repeatedly call 'lookupZoneinfo' for all the ids.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: 'lookupZoneinfo' is safe while the cache grows
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'lookupZoneinfo' DURING GROWTH" << endl
+                          << "======================================" << endl;
+
+        using namespace BALTZO_ZONEINFOCACHE_GROWTH;
+
+        // A 'bslma::TestAllocator' is required for thread safe allocations.
+        bslma::TestAllocator testAllocator("object", veryVeryVeryVerbose);
+
+        bslma::TestAllocator oa("cache", veryVeryVeryVerbose);
+
+        TestDriverTestLoader testLoader(&testAllocator);
+        for (int i = 0; i < NUM_IDS; ++i) {
+            sprintf(IDS[i], "Zone/%d", i * 7919);
+            testLoader.addTimeZone(IDS[i], i, 0 == i % 2, "A");
+        }
+
+        if (verbose) cout << "\nTesting sequential loads." << endl;
+        {
+            bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+            Obj mX(&testLoader, &oa);  const Obj& X = mX;
+
+            for (int i = 0; i < NUM_IDS; ++i) {
+                const Zone *result = mX.getZoneinfo(IDS[i]);
+                ASSERTV(i, result);
+
+                for (int j = 0; j < NUM_IDS; ++j) {
+                    const Zone *found = X.lookupZoneinfo(IDS[j]);
+                    if (j <= i) {
+                        ASSERTV(i, j, found);
+                        ASSERTV(i, j, found && found->identifier() == IDS[j]);
+                    }
+                    else {
+                        ASSERTV(i, j, 0 == found);
+                    }
+                }
+                ASSERTV(i, result == X.lookupZoneinfo(IDS[i]));
+                ASSERTV(i, result == mX.getZoneinfo(IDS[i]));
+            }
+            ASSERT(0 == X.lookupZoneinfo("NOT_AN_ID"));
+            ASSERT(0 == X.lookupZoneinfo(""));
+
+            ASSERT(dam.isTotalSame());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting concurrent lookups." << endl;
+        {
+            enum { NUM_READERS = 4 };
+
+            for (int ti = 0; ti < 5; ++ti) {
+                numLoaded  = 0;
+                numLookups = 0;
+
+                Obj            mX(&testLoader, &oa);
+                bslmt::Barrier barrier(NUM_READERS + 1);
+                ThreadData     args = { &mX, &barrier };
+
+                bslmt::ThreadUtil::Handle threads[NUM_READERS + 1];
+                ASSERT(0 == bslmt::ThreadUtil::create(&threads[0],
+                                                      loaderThread,
+                                                      &args));
+                for (int i = 1; i <= NUM_READERS; ++i) {
+                    ASSERT(0 == bslmt::ThreadUtil::create(&threads[i],
+                                                          readerThread,
+                                                          &args));
+                }
+                for (int i = 0; i <= NUM_READERS; ++i) {
+                    bslmt::ThreadUtil::join(threads[i]);
+                }
+
+                if (veryVerbose) {
+                    P_(ti) P(numLookups);
+                }
+                ASSERTV(ti, NUM_READERS <= numLookups);
+            }
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+      } break;
       case 8: {
         // --------------------------------------------------------------------
         // TESTING CONCURRENT ACCESS
@@ -51,6 +51,32 @@ BSLS_IDENT("$Id: $")
 // to use a binary encoding (such as BER) if the encoding format is under your
 // control.  (See 'balber_berdecoder'.)
 //
+///Decoding Many Messages Into an Arena
+///------------------------------------
+// A 'balxml::Decoder', together with its reader, can be reused for any number
+// of documents, and keeps its internal buffers from one document to the next.
+// The memory allocated by the decoded objects themselves can be recycled by
+// decoding into an object held by a 'bdlma::ArenaObject', whose 'reset'
+// method discards the previous object, and everything it allocated, in one
+// step.  Once the arena has grown to fit the largest document, decoding
+// allocates no memory at all:
+//..
+//  balxml::DecoderOptions options;
+//  balxml::MiniReader     reader;
+//  balxml::ErrorInfo      errorInfo;
+//  balxml::Decoder        decoder(&options, &reader, &errorInfo);
+//
+//  bdlma::ArenaObject<s_baltst::Employee> employee;
+//
+//  while (receiveDocument(&buffer, &length)) {
+//      employee.reset();
+//      if (0 != decoder.decode(buffer, length, employee.object())) {
+//          // handle error
+//      }
+//      processEmployee(*employee.object());
+//  }
+//..
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
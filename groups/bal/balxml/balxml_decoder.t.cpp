@@ -42,6 +42,7 @@
 #include <bdlb_variant.h>
 #include <bdlde_utf8util.h>
 #include <bdldfp_decimal.h>
+#include <bdlma_arenaobject.h>
 #include <bdlsb_fixedmeminstreambuf.h>
 #include <bdlat_attributeinfo.h>
 #include <bdlat_choicefunctions.h>
@@ -58,6 +59,7 @@
 #include <bslalg_typetraits.h>
 #include <bslma_allocator.h>
 #include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
 #include <bslma_testallocator.h>
 #include <bslmf_issame.h>
 #include <bsls_assert.h>
@@ -142,6 +144,7 @@ namespace test = s_baltst;
 // [11] int balxml::Decoder::decode(istrm&, TYPE, ostrm&, ostrm&, b_A*);
 // [15] void setNumUnknownElementsSkipped(int value);
 // [15] int numUnknownElementsSkipped() const;
+// [22] DECODING INTO A 'bdlma::ArenaObject'
 // [ 3] balxml::Decoder_SelectContext
 // [ 2] baexml_Decoder_ParserUtil
 // [ 5] baexml_Decoder_Base64Context
@@ -8249,6 +8252,104 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 22: {
+        // --------------------------------------------------------------------
+        // TESTING DECODING INTO A 'bdlma::ArenaObject'
+        //
+        // Concerns:
+        //: 1 An object held by a 'bdlma::ArenaObject' is decoded correctly
+        //:   after each 'reset', using one decoder and reader for all
+        //:   messages.
+        //:
+        //: 2 Once the arena has grown to fit the message, decoding obtains no
+        //:   memory from the default allocator, from the allocator of the
+        //:   decoder and reader, or from the allocator supplied to the arena.
+        //
+        // Plan:
+        //: 1 Repeatedly reset an arena object and decode into it an XML
+        //:   'Employee' whose strings, some of which hold entity references,
+        //:   do not fit in the short string buffer, alternating between the
+        //:   'bsl::streambuf' and the buffer overloads.  Check the decoded
+        //:   value and, after the first few iterations, the allocation
+        //:   counts.  (C-1..2)
+        //
+        // Testing:
+        //   DECODING INTO A 'bdlma::ArenaObject'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING DECODING INTO A 'bdlma::ArenaObject'\n"
+                             "============================================\n";
+
+        bslma::TestAllocator         da("default", veryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator ta("test",     veryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVerbose);
+
+        const char XML[] =
+            "<?xml version=\"1.0\" encoding=\"UTF-8\" ?>\n"
+            "<Employee " XSI ">\n"
+            "  <name>an employee name too long for the short buffer</name>\n"
+            "  <homeAddress>\n"
+            "    <street>a &quot;quoted&quot; street name, too long</street>\n"
+            "    <city>a city name too long for the short buffer</city>\n"
+            "    <state>NY</state>\n"
+            "  </homeAddress>\n"
+            "  <age>42</age>\n"
+            "</Employee>\n";
+
+        test::Employee expected(&ta);
+        expected.name()                 = "an employee name too long for "
+                                          "the short buffer";
+        expected.homeAddress().street() = "a \"quoted\" street name, too long";
+        expected.homeAddress().city()   = "a city name too long for the "
+                                          "short buffer";
+        expected.homeAddress().state()  = "NY";
+        expected.age()                  = 42;
+
+        balxml::DecoderOptions options;
+        balxml::MiniReader     reader(&ta);
+        balxml::ErrorInfo      errInfo(&ta);
+        balxml::Decoder        decoder(&options, &reader, &errInfo, &ta);
+        {
+            bdlma::ArenaObject<test::Employee> employee(&sa);
+
+            bsls::Types::Int64 numDefault  = 0;
+            bsls::Types::Int64 numDecoder  = 0;
+            bsls::Types::Int64 numSupplied = 0;
+
+            for (int i = 0; i < 20; ++i) {
+                if (4 == i) {
+                    numDefault  = da.numAllocations();
+                    numDecoder  = ta.numAllocations();
+                    numSupplied = sa.numAllocations();
+                }
+
+                employee.reset();
+
+                if (i % 2) {
+                    bdlsb::FixedMemInStreamBuf isb(XML, sizeof XML - 1);
+                    ASSERTV(i, errInfo,
+                            0 == decoder.decode(&isb, employee.object()));
+                }
+                else {
+                    ASSERTV(i, errInfo,
+                            0 == decoder.decode(XML,
+                                                sizeof XML - 1,
+                                                employee.object()));
+                }
+                ASSERTV(i, expected == *employee.object());
+            }
+
+            ASSERTV(numDefault, da.numAllocations(),
+                    numDefault == da.numAllocations());
+            ASSERTV(numDecoder, ta.numAllocations(),
+                    numDecoder == ta.numAllocations());
+            ASSERTV(numSupplied, sa.numAllocations(),
+                    numSupplied == sa.numAllocations());
+        }
+        ASSERT(0 == sa.numBytesInUse());
+      } break;
       case 21: {
         // --------------------------------------------------------------------
         // Testing Decimal64
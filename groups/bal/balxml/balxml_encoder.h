@@ -143,6 +143,9 @@ BSLS_IDENT("$Id: $")
 #include <bslma_default.h>
 #include <bslma_usesbslmaallocator.h>
 
+#include <bslmf_integralconstant.h>
+#include <bslmf_isarithmetic.h>
+#include <bslmf_metaint.h>
 #include <bslmf_nestedtraitdeclaration.h>
 
 #include <bsls_assert.h>
@@ -470,6 +473,39 @@ class Encoder_EncodeObject {
                                   const bslstl::StringRef& tag,
                                   int                      formattingMode);
 
+    template <class TYPE>
+    int executeArrayElements(const TYPE&              object,
+                             const bslstl::StringRef& tag,
+                             int                      formattingMode,
+                             bslmf::MetaInt<0>);
+    template <class TYPE>
+    int executeArrayElements(const TYPE&              object,
+                             const bslstl::StringRef& tag,
+                             int                      formattingMode,
+                             bslmf::MetaInt<1>);
+        // Encode each element of the specified 'object' array as an element
+        // having the specified 'tag' using the specified 'formattingMode'.
+        // Return 0 on success, and a non-zero value otherwise.  The overload
+        // taking 'bslmf::MetaInt<1>' is selected for arrays that have
+        // contiguous storage (see 'bdlat_ArrayFunctions').
+
+    template <class TYPE>
+    int executeContiguousArrayElements(const TYPE&              object,
+                                       const bslstl::StringRef& tag,
+                                       int                      formattingMode,
+                                       bsl::false_type);
+    template <class TYPE>
+    int executeContiguousArrayElements(const TYPE&              object,
+                                       const bslstl::StringRef& tag,
+                                       int                      formattingMode,
+                                       bsl::true_type);
+        // Encode each element of the specified 'object' array, having
+        // contiguous storage, as an element having the specified 'tag' using
+        // the specified 'formattingMode'.  Return 0 on success, and a non-zero
+        // value otherwise.  The overload taking 'bsl::true_type' is selected
+        // for arrays of arithmetic types, and encodes each element directly,
+        // without visiting it.
+
   private:
     // NOT IMPLEMENTED
     Encoder_EncodeObject(const Encoder_EncodeObject&);
@@ -1175,6 +1211,22 @@ int Encoder_EncodeObject::executeArrayRepetitionImp(
                                        const TYPE&              object,
                                        const bslstl::StringRef& tag,
                                        int                      formattingMode)
+{
+    typedef typename bdlat_ArrayFunctions::HasContiguousStorage<TYPE>::Type
+                                                          HasContiguousStorage;
+
+    return executeArrayElements(object,
+                                tag,
+                                formattingMode,
+                                HasContiguousStorage());
+}
+
+template <class TYPE>
+int Encoder_EncodeObject::executeArrayElements(
+                                       const TYPE&              object,
+                                       const bslstl::StringRef& tag,
+                                       int                      formattingMode,
+                                       bslmf::MetaInt<0>)
 {
     enum { k_SUCCESS = 0, k_FAILURE = -1 };
 
@@ -1198,6 +1250,71 @@ int Encoder_EncodeObject::executeArrayRepetitionImp(
     return k_SUCCESS;
 }
 
+template <class TYPE>
+inline
+int Encoder_EncodeObject::executeArrayElements(
+                                       const TYPE&              object,
+                                       const bslstl::StringRef& tag,
+                                       int                      formattingMode,
+                                       bslmf::MetaInt<1>)
+{
+    typedef typename bdlat_ArrayFunctions::ElementType<TYPE>::Type
+                                                                   ElementType;
+
+    return executeContiguousArrayElements(object,
+                                          tag,
+                                          formattingMode,
+                                          bsl::is_arithmetic<ElementType>());
+}
+
+template <class TYPE>
+inline
+int Encoder_EncodeObject::executeContiguousArrayElements(
+                                       const TYPE&              object,
+                                       const bslstl::StringRef& tag,
+                                       int                      formattingMode,
+                                       bsl::false_type)
+{
+    return executeArrayElements(object,
+                                tag,
+                                formattingMode,
+                                bslmf::MetaInt<0>());
+}
+
+template <class TYPE>
+int Encoder_EncodeObject::executeContiguousArrayElements(
+                                       const TYPE&              object,
+                                       const bslstl::StringRef& tag,
+                                       int                      formattingMode,
+                                       bsl::true_type)
+{
+    enum { k_SUCCESS = 0, k_FAILURE = -1 };
+
+    typedef typename bdlat_ArrayFunctions::ElementType<TYPE>::Type
+                                                                   ElementType;
+
+    const int          size     = (int)bdlat_ArrayFunctions::size(object);
+    const ElementType *elements = bdlat_ArrayFunctions::data(object);
+
+    for (int i = 0; i < size; ++i) {
+        if (0 != executeImp(elements[i],
+                            tag,
+                            formattingMode,
+                            bdlat_TypeCategory::Simple())) {
+
+            d_context_p->logError(
+                "Error while encoding array element",
+                tag,
+                formattingMode,
+                i);
+
+            return k_FAILURE;                                         // RETURN
+        }
+    }
+
+    return k_SUCCESS;
+}
+
 // CREATORS
 inline
 Encoder_EncodeObject::Encoder_EncodeObject(Encoder_Context *context)
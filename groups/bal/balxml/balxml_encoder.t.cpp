@@ -21,6 +21,7 @@
 #include <s_baltst_mysequencewithnullables.h>
 #include <s_baltst_mysimplecontent.h>
 #include <s_baltst_mysimpleintcontent.h>
+#include <s_baltst_rawdataunformatted.h>
 
 #include <bslim_testutil.h>
 
@@ -6279,7 +6280,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 16: {
+      case 17: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -6297,6 +6298,56 @@ int main(int argc, char *argv[])
 
         if (verbose) cout << "\nEnd of Test." << endl;
       } break;
+      case 16: {
+        // --------------------------------------------------------------------
+        // TESTING ARRAYS OF FUNDAMENTAL TYPES
+        //
+        // Concerns:
+        //: 1 Each element of a contiguous array of a fundamental type is
+        //:   encoded, in order, as an element having the tag of the array.
+        //:
+        //: 2 The representation of each element is the same as that of a
+        //:   single value of the element type with the same formatting mode.
+        //
+        // Plan:
+        //: 1 Encode a sequence having an array of 'unsigned char' with the
+        //:   'e_DEC' formatting mode and compare the result with the expected
+        //:   XML.  (C-1..2)
+        //
+        // Testing:
+        //   ARRAYS OF FUNDAMENTAL TYPES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING ARRAYS OF FUNDAMENTAL TYPES"
+                          << "\n===================================" << endl;
+
+        test::RawDataUnformatted value;
+        value.ucharvec().push_back(0);
+        value.ucharvec().push_back(1);
+        value.ucharvec().push_back(127);
+        value.ucharvec().push_back(255);
+
+        balxml::EncoderOptions options;
+        options.setEncodingStyle(balxml::EncodingStyle::e_PRETTY);
+
+        balxml::Encoder encoder(&options, &bsl::cerr, &bsl::cerr);
+
+        bsl::ostringstream os;
+        const int rc = encoder.encodeToStream(os, value);
+        ASSERTV(rc, 0 == rc);
+
+        const char *EXPECTED =
+             "<?xml version=\"1.0\" encoding=\"UTF-8\" ?>\n"
+             "<RawDataUnformatted xmlns:xsi"
+                            "=\"http://www.w3.org/2001/XMLSchema-instance\">\n"
+             "    <ucharvec>0</ucharvec>\n"
+             "    <ucharvec>1</ucharvec>\n"
+             "    <ucharvec>127</ucharvec>\n"
+             "    <ucharvec>255</ucharvec>\n"
+             "</RawDataUnformatted>\n";
+
+        ASSERTV(os.str(), EXPECTED == os.str());
+      } break;
       case 15: {
         // --------------------------------------------------------------------
         // Testing Decimal64
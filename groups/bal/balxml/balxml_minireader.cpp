@@ -14,13 +14,20 @@ BSLS_IDENT_RCSID(balxml_minireader_cpp,"$Id$ $CSID$")
 
 #include <balxml_errorinfo.h>
 
+#include <bdlb_bitutil.h>
+
 #include <bsls_assert.h>
+#include <bsls_platform.h>
 
 #include <bsl_algorithm.h>  // for 'swap'
 #include <bsl_cctype.h>
 #include <bsl_climits.h>
 #include <bsl_cstring.h>    // for 'strlen', 'strcspn', 'memcmp'
 
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+#include <emmintrin.h>
+#endif
+
 // IMPLEMENTATION NOTES
 // --------------------
 
@@ -117,6 +124,101 @@ const char* nonNullStr(const char *s)
     return s ? s : "";
 }
 
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+inline
+int matchMask(const char *block, const __m128i *set, int setSize)
+    // Return a mask having the bit 'i' set if the character at 'block[i]',
+    // for each 'i' in the range '[0 .. 15]', is equal to any of the
+    // characters broadcast into the specified 'setSize' elements of the
+    // specified 'set', and unset otherwise.
+{
+    const __m128i chars = _mm_loadu_si128(
+                                   reinterpret_cast<const __m128i *>(block));
+
+    __m128i match = _mm_cmpeq_epi8(chars, set[0]);
+    for (int i = 1; i < setSize; ++i) {
+        match = _mm_or_si128(match, _mm_cmpeq_epi8(chars, set[i]));
+    }
+    return _mm_movemask_epi8(match);
+}
+#endif
+
+char *findFirstOf(char *begin, const char *end, const char *set)
+    // Return 'begin + bsl::strcspn(begin, set)', i.e., the address of the
+    // first character at or after the specified 'begin' that is either the
+    // null character or one of the characters in the specified
+    // null-terminated 'set'.  The behavior is undefined unless
+    // 'begin <= end', '0 == *end', and 'set' has at most 7 characters.  Note
+    // that at most the characters in the range '[begin, end]' are examined.
+{
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    // Compare 16 characters at a time, while a whole block precedes 'end',
+    // against the null character and each character of 'set'.
+
+    __m128i chars[8];
+    int     numChars = 0;
+
+    chars[numChars++] = _mm_setzero_si128();
+    for (const char *c = set; *c; ++c) {
+        BSLS_ASSERT_SAFE(numChars < 8);
+
+        chars[numChars++] = _mm_set1_epi8(*c);
+    }
+
+    while (end - begin >= 16) {
+        const int mask = matchMask(begin, chars, numChars);
+        if (mask) {
+            using BloombergLP::bdlb::BitUtil;
+
+            return begin + BitUtil::numTrailingUnsetBits(
+                                                static_cast<uint32_t>(mask));
+                                                                      // RETURN
+        }
+        begin += 16;
+    }
+#else
+    (void)end;
+#endif
+
+    return begin + bsl::strcspn(begin, set);
+}
+
+char *findFirstNotOf(char *begin, const char *end, const char *set)
+    // Return 'begin + bsl::strspn(begin, set)', i.e., the address of the
+    // first character at or after the specified 'begin' that is not one of
+    // the characters in the specified null-terminated 'set' (the null
+    // character is never in 'set').  The behavior is undefined unless
+    // 'begin <= end', '0 == *end', and 'set' has at most 8 characters.  Note
+    // that at most the characters in the range '[begin, end]' are examined.
+{
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    __m128i chars[8];
+    int     numChars = 0;
+
+    for (const char *c = set; *c; ++c) {
+        BSLS_ASSERT_SAFE(numChars < 8);
+
+        chars[numChars++] = _mm_set1_epi8(*c);
+    }
+
+    while (numChars && end - begin >= 16) {
+        const int mask = matchMask(begin, chars, numChars) ^ 0xFFFF;
+        if (mask) {
+            using BloombergLP::bdlb::BitUtil;
+
+            return begin + BitUtil::numTrailingUnsetBits(
+                                                static_cast<uint32_t>(mask));
+                                                                      // RETURN
+        }
+        begin += 16;
+    }
+#else
+    (void)end;
+#endif
+
+    return begin + bsl::strspn(begin, set);
+}
+
 inline
 char toChar(unsigned val)
     // Return the specified 'val' cast to a 'char'.  Bits of 'val' that are
@@ -561,7 +663,7 @@ void MiniReader::close()
     d_state     = ST_CLOSED;
 }
 
-int MiniReader::doOpen(const char *url, const char *encoding)
+void MiniReader::resetState(const char *url, const char *encoding)
 {
     // reset active nodes stack
     d_activeNodesCount = 0;
@@ -591,6 +693,11 @@ int MiniReader::doOpen(const char *url, const char *encoding)
 
     d_baseURL  = nonNullStr(url);
     d_encoding = nonNullStr(encoding);
+}
+
+int MiniReader::doOpen(const char *url, const char *encoding)
+{
+    resetState(url, encoding);
 
     return (readInput() > 0) ? 0 : -1;
 }
@@ -614,6 +721,37 @@ int MiniReader::open(const char *buffer,
     return doOpen(url, encoding);
 }
 
+int MiniReader::openInPlace(char        *buffer,
+                            size_t       size,
+                            const char  *url,
+                            const char  *encoding)
+{
+    if (d_state != ST_CLOSED) {
+        return -1;                                                    // RETURN
+    }
+
+    if (buffer == 0 || size == 0) {
+        return -1;                                                    // RETURN
+    }
+
+    resetState(url, encoding);
+
+    // Parse 'buffer' itself: the whole input is already available, so mark
+    // the end of input as reached and never call 'readInput' to refill.
+
+    buffer[size] = '\0';
+
+    d_flags    = FLG_READ_EOF;
+
+    d_startPtr = buffer;
+    d_endPtr   = buffer + size;
+    d_scanPtr  = d_startPtr;
+    d_markPtr  = d_startPtr;
+    d_linePtr  = d_startPtr;
+
+    return 0;
+}
+
 int MiniReader::open(const char *filename, const char *encoding)
 {
     if (d_state != ST_CLOSED) {
@@ -901,8 +1039,7 @@ MiniReader::searchCommentCDataOrEndElementName(const bsl::string& name)
     while (1) {
         StringType type = e_STRINGTYPE_NONE;
 
-        size_t len = bsl::strcspn(d_scanPtr, strSet);
-        d_scanPtr += len;
+        d_scanPtr = findFirstOf(d_scanPtr, d_endPtr, strSet);
         if (d_scanPtr == d_endPtr) { // No chars from 'strSet' found.
             if (readInput() == 0) {
                 d_scanPtr = d_endPtr;
@@ -996,8 +1133,7 @@ MiniReader::searchElementName(const bsl::string& name)
     while (1) {
         StringType type = e_STRINGTYPE_NONE;
 
-        size_t len = bsl::strcspn(d_scanPtr, strSet);
-        d_scanPtr += len;
+        d_scanPtr = findFirstOf(d_scanPtr, d_endPtr, strSet);
         if (d_scanPtr == d_endPtr) { // No chars from 'strSet' found.
             if (readInput() == 0) {
                 d_scanPtr = d_endPtr;
@@ -1233,8 +1369,7 @@ MiniReader::skipSpaces()
     while (1) {
 
         // skip SPACE, TAB, CR chars
-        size_t len = bsl::strspn(d_scanPtr, "\r\t ");
-        d_scanPtr +=len;
+        d_scanPtr = findFirstNotOf(d_scanPtr, d_endPtr, "\r\t ");
 
         if (checkForNewLine()) {
             ++d_scanPtr;          //skip NL
@@ -1259,8 +1394,7 @@ MiniReader::scanForSymbol(char symbol)
 
     while (1) {
         // find 'symbol' or NL
-        size_t len = bsl::strcspn(d_scanPtr, strSet);
-        d_scanPtr +=len;
+        d_scanPtr = findFirstOf(d_scanPtr, d_endPtr, strSet);
 
         if (symbol == *d_scanPtr) {
             return symbol;                                            // RETURN
@@ -1290,8 +1424,7 @@ MiniReader::scanForSymbolOrSpace(char symbol)
 
     while (1) {
         // find 'symbol' or space
-        size_t len = bsl::strcspn(d_scanPtr, strSet);
-        d_scanPtr +=len;
+        d_scanPtr = findFirstOf(d_scanPtr, d_endPtr, strSet);
 
         if (d_scanPtr < d_endPtr) {
             break;
@@ -1313,8 +1446,7 @@ MiniReader::scanForSymbolOrSpace(char symbol1, char symbol2)
 
     while (1) {
         // find 'symbol1' or 'symbol2' or space
-        size_t len = bsl::strcspn(d_scanPtr, strSet);
-        d_scanPtr +=len;
+        d_scanPtr = findFirstOf(d_scanPtr, d_endPtr, strSet);
 
         if (d_scanPtr < d_endPtr) {
             break;
@@ -41,6 +41,18 @@ BSLS_IDENT("$Id: $")
 // To get stricter data validation, clients should use a concrete
 // implementation of a validating reader (such as 'a_xercesc::Reader') instead.
 //
+// Parsing In Place
+// - - - - - - - -
+// The 'open' methods copy the input, a chunk at a time, into an internal
+// buffer that the reader then modifies while parsing (e.g., to null-terminate
+// names and values, and to replace character references).  The strings
+// returned by accessors such as 'nodeValue' and 'nodeLocalName' are addresses
+// within that buffer.  When the whole document is already in contiguous,
+// modifiable memory (e.g., a buffer received from the network, or a private,
+// writable memory mapping of a file), 'openInPlace' avoids the copy: the
+// reader parses the supplied buffer itself, and the returned strings are
+// addresses within that buffer.
+//
 ///Usage
 ///-----
 // For this example, we will use 'balxml::MiniReader' to read each node in an
@@ -482,6 +494,11 @@ class MiniReader :  public Reader {
     void  rebasePointers(const char *newBase, size_t newLength);
 
     int   readInput();
+    void  resetState(const char *url, const char *encoding);
+        // Reset the parsing state of this reader, including the node stack,
+        // the error information, and the input buffer, and set the base URL
+        // and the encoding to the specified 'url' and 'encoding'.
+
     int   doOpen(const char *url, const char *encoding);
 
     int   peekChar();
@@ -615,6 +632,24 @@ class MiniReader :  public Reader {
         // Note that the reader will not be on a valid node until
         // 'advanceToNextNode' is called.
 
+    int openInPlace(char        *buffer,
+                    bsl::size_t  size,
+                    const char  *url = 0,
+                    const char  *encoding = 0);
+        // Set up the reader for parsing, without copying, the data contained
+        // in the specified (XML) 'buffer' of the specified 'size', set the
+        // base URL to the optionally specified 'url' and set the encoding
+        // value to the optionally specified 'encoding', as for the 'open'
+        // method taking a 'const char *' buffer.  Return 0 on success and
+        // non-zero otherwise.  The reader modifies the contents of 'buffer'
+        // while parsing, writes a null character at 'buffer[size]', and
+        // returns strings (e.g., from 'nodeValue') that are addresses within
+        // 'buffer'.  The behavior is undefined unless 'buffer' has at least
+        // 'size + 1' modifiable bytes, and remains valid and is not otherwise
+        // modified until 'close' is called.  It is an error to 'openInPlace' a
+        // reader that is already open.  Note that the reader will not be on a
+        // valid node until 'advanceToNextNode' is called.
+
     virtual int open(bsl::streambuf *stream,
                      const char     *url = 0,
                      const char     *encoding = 0);
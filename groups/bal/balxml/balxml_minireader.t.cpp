@@ -25,6 +25,7 @@
 #include <bsl_fstream.h>
 #include <bsl_iomanip.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace bsl;
@@ -99,7 +100,8 @@ using namespace bsl;
 // [-1] INTERACTIVE TEST
 // [ 1] BREATHING TEST
 // [15] FUZZ TEST
-// [16] USAGE EXAMPLE
+// [16] openInPlace(char *buffer, size_t size, url, encoding)
+// [17] USAGE EXAMPLE
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -573,6 +575,53 @@ static int parseAndProcess(balxml::Reader *reader)
     return rc;
 }
 
+static int describeNodes(bsl::string *result,
+                         Obj         *reader,
+                         const char  *begin = 0,
+                         const char  *end = 0)
+    // Advance the specified 'reader' through the remaining nodes of its
+    // document and append to the specified 'result' a description of the
+    // type, name, value, and attributes of each node.  If the optionally
+    // specified 'begin' is not null, also verify that the non-empty names and
+    // values returned by 'reader' are addresses in the range '[begin, end)'.
+    // Return the (non-zero) status of the last call to 'advanceToNextNode'.
+{
+    bsl::ostringstream os(result->get_allocator());
+
+    int rc;
+    while ((rc = reader->advanceToNextNode()) == 0) {
+        const char *name  = reader->nodeName();
+        const char *value = reader->nodeValue();
+
+        os << reader->nodeType() << ':' << reader->nodeDepth() << ':'
+           << reader->nodeStartPosition() << ':' << CHK(name) << '='
+           << CHK(value) << '\n';
+
+        if (begin && name && *name) {
+            ASSERTV(name, begin <= name && name < end);
+        }
+        if (begin && value && *value) {
+            ASSERTV(value, begin <= value && value < end);
+        }
+
+        for (int i = 0; i < reader->numAttributes(); ++i) {
+            balxml::ElementAttribute attr;
+            reader->lookupAttribute(&attr, i);
+
+            os << "  " << CHK(attr.qualifiedName()) << '='
+               << CHK(attr.value()) << '\n';
+
+            if (begin && *attr.value()) {
+                ASSERTV(attr.value(),
+                        begin <= attr.value() && attr.value() < end);
+            }
+        }
+    }
+
+    *result = os.str();
+    return rc;
+}
+
 // XML header information used by ggg function.  'strXmlStart' + 'strXmlEnd' =
 // 256 bytes.
 const char strXmlStart[] =
@@ -813,7 +862,7 @@ int main(int argc, char *argv[])
     bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 16: {
+      case 17: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -857,6 +906,128 @@ int main(int argc, char *argv[])
 
       } break;
 
+      case 16: {
+        // --------------------------------------------------------------------
+        // OPEN IN PLACE
+        //
+        // Concerns:
+        //: 1 'openInPlace' parses a document into the same nodes, names,
+        //:   values, attributes, and positions as 'open' does for a copy of
+        //:   the same document.
+        //:
+        //: 2 The names and values returned after 'openInPlace' are addresses
+        //:   within the supplied buffer.
+        //:
+        //: 3 Runs of text, attribute values, and whitespace long enough to be
+        //:   scanned in blocks, and markup falling at any offset within a
+        //:   block, are found correctly.
+        //:
+        //: 4 'openInPlace' fails for a null or empty buffer, or if the reader
+        //:   is already open, and the reader can be reopened after 'close'.
+        //
+        // Plan:
+        //: 1 For a set of documents, some having long text, attribute values,
+        //:   comments, and whitespace, prefixed by runs of spaces of every
+        //:   length from 0 to 32, describe the nodes obtained via 'open' and
+        //:   via 'openInPlace' on a writable copy, and verify that the
+        //:   descriptions are equal and that the returned strings are in the
+        //:   copy.  (C-1..3)
+        //:
+        //: 2 Call 'openInPlace' with invalid arguments and on an open reader
+        //:   and verify the result.  (C-4)
+        //
+        // Testing:
+        //   openInPlace(char *buffer, size_t size, url, encoding)
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nOPEN IN PLACE"
+                               << "\n=============" << bsl::endl;
+
+        const bsl::string LONG(100, 'x');
+
+        const char *DATA[] = {
+            "<a/>",
+            "<a b='1' c=\"two\">text</a>",
+            "<!-- a comment that is longer than a single block -->\n"
+            "<root xmlns='http://example.com/ns'>\n"
+            "    <e attr='a value that is longer than a single block'>"
+                "some element text &amp; a reference, longer than a block"
+            "</e>\n"
+            "                                    <empty/>\n"
+            "<![CDATA[ character data <not markup> ]]>\n"
+            "</root>\n",
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA + 1; ++ti) {
+            for (int pad = 0; pad <= 32; ++pad) {
+                bsl::string doc(&testAllocator);
+                doc.append(pad, ' ');
+                if (ti < NUM_DATA) {
+                    doc.append(DATA[ti]);
+                }
+                else {
+                    doc.append("<a v='" + LONG + "'>" + LONG + "</a>");
+                }
+
+                bsl::string expected(&testAllocator);
+                {
+                    Obj reader(&testAllocator);
+
+                    ASSERTV(ti, pad, 0 == reader.open(doc.data(),
+                                                      doc.size()));
+                    ASSERTV(ti, pad, 0 < describeNodes(&expected, &reader));
+                }
+
+                bsl::vector<char> buffer(doc.begin(),
+                                         doc.end(),
+                                         &testAllocator);
+                buffer.push_back('?');
+
+                const char *BEGIN = buffer.data();
+                const char *END   = BEGIN + doc.size();
+
+                Obj reader(&testAllocator);
+
+                ASSERTV(ti, pad, 0 == reader.openInPlace(buffer.data(),
+                                                         doc.size()));
+                ASSERTV(ti, pad, reader.isOpen());
+                ASSERTV(ti, pad, '\0' == buffer[doc.size()]);
+
+                bsl::string result(&testAllocator);
+                ASSERTV(ti, pad, 0 < describeNodes(&result,
+                                                   &reader,
+                                                   BEGIN,
+                                                   END));
+
+                ASSERTV(ti, pad, expected, result, expected == result);
+
+                reader.close();
+            }
+        }
+
+        if (verbose) bsl::cout << "\tInvalid arguments." << bsl::endl;
+        {
+            char buffer[] = "<a/>";
+
+            Obj reader(&testAllocator);
+
+            ASSERT(0 != reader.openInPlace(0, 4));
+            ASSERT(0 != reader.openInPlace(buffer, 0));
+            ASSERT(!reader.isOpen());
+
+            ASSERT(0 == reader.openInPlace(buffer, 4));
+            ASSERT(0 != reader.openInPlace(buffer, 4));
+            ASSERT(0 != reader.open("<b/>", 4));
+
+            reader.close();
+
+            ASSERT(0 == reader.open("<b/>", 4));
+            ASSERT(0 == reader.advanceToNextNode());
+            ASSERT(0 == bsl::strcmp("b", reader.nodeName()));
+        }
+      } break;
+
       case 15: {
         // --------------------------------------------------------------------
         // FUZZ TEST
@@ -14,9 +14,10 @@ BSLS_IDENT_RCSID(balxml_typesparserutil_cpp,"$Id$ $CSID$")
 
 #include <balxml_typesprintutil.h>  // for testing only
 
-#include <balxml_base64parser.h>
 #include <balxml_hexparser.h>
 
+#include <bdlde_base64decoder.h>
+
 #include <bdlsb_fixedmeminstreambuf.h>
 
 #include <bdldfp_decimalutil.h>
@@ -336,6 +337,34 @@ int parseDecimal64Impl(bdldfp::Decimal64  *result,
     return BAEXML_SUCCESS;
 }
 
+template <class TYPE>
+int decodeBase64(TYPE *result, const char *input, int inputLength)
+    // Load into the specified 'result' the bytes decoded from the Base64
+    // encoding in the specified 'input' of the specified 'inputLength'.
+    // Return 0 on success, and a non-zero value otherwise.  Each
+    // instantiation of this private function is called only once (by the
+    // functions below) and can thus be inlined without causing code bloat.
+{
+    enum { BAEXML_SUCCESS = 0, BAEXML_FAILURE = -1 };
+
+    result->resize(bdlde::Base64Decoder::maxDecodedLength(inputLength));
+
+    if (result->empty()) {
+        return BAEXML_SUCCESS;                                        // RETURN
+    }
+
+    int numOut = 0;
+    int rc     = bdlde::Base64Decoder::decodeBuffer(&(*result)[0],
+                                                    &numOut,
+                                                    input,
+                                                    inputLength,
+                                                    true);
+
+    result->resize(numOut);
+
+    return 0 == rc ? BAEXML_SUCCESS : BAEXML_FAILURE;
+}
+
 }  // close namespace u
 }  // close unnamed namespace
 
@@ -351,19 +380,8 @@ int TypesParserUtil_Imp::parseBase64(bsl::string                *result,
                                      int                         inputLength,
                                      bdlat_TypeCategory::Simple)
 {
-    enum { BAEXML_FAILURE = -1 };
-
-    Base64Parser<bsl::string> base64Parser;
-
-    if (0 != base64Parser.beginParse(result)) {
-        return BAEXML_FAILURE;                                        // RETURN
-    }
-
-    if (0 != base64Parser.pushCharacters(input, input + inputLength)) {
-        return BAEXML_FAILURE;                                        // RETURN
-    }
-
-    return base64Parser.endParse();
+    // Calls a function in the unnamed namespace.  Cannot be inlined.
+    return u::decodeBase64(result, input, inputLength);
 }
 
 int TypesParserUtil_Imp::parseBase64(bsl::vector<char>         *result,
@@ -371,19 +389,8 @@ int TypesParserUtil_Imp::parseBase64(bsl::vector<char>         *result,
                                      int                        inputLength,
                                      bdlat_TypeCategory::Array)
 {
-    enum { BAEXML_FAILURE = -1 };
-
-    Base64Parser<bsl::vector<char> > base64Parser;
-
-    if (0 != base64Parser.beginParse(result)) {
-        return BAEXML_FAILURE;                                        // RETURN
-    }
-
-    if (0 != base64Parser.pushCharacters(input, input + inputLength)) {
-        return BAEXML_FAILURE;                                        // RETURN
-    }
-
-    return base64Parser.endParse();
+    // Calls a function in the unnamed namespace.  Cannot be inlined.
+    return u::decodeBase64(result, input, inputLength);
 }
 
 // DECIMAL FUNCTIONS
@@ -33,30 +33,31 @@ namespace u {
 
 // HELPER FUNCTIONS
 
-template <class INPUT_ITERATOR>
 bsl::ostream& encodeBase64(bsl::ostream&  stream,
-                           INPUT_ITERATOR begin,
-                           INPUT_ITERATOR end)
-    // Write the base64 encoding of the character sequence defined by the
-    // specified 'begin' and 'end' iterators into the specified 'stream' and
-    // return 'stream'.  Each instantiation of this private function is called
-    // only once (by the functions below) and can thus be inlined without
-    // causing code bloat.
+                           const char    *data,
+                           int            dataLength)
+    // Write the base64 encoding, without line breaks, of the specified
+    // 'dataLength' bytes at the specified 'data' address into the specified
+    // 'stream' and return 'stream'.
 {
-    bdlde::Base64Encoder base64Encoder(0);  // 0 means do not insert CRLF
-
-    {
-        bsl::ostreambuf_iterator<char> outputIterator(stream);
+    enum {
+        k_INPUT_CHUNK  = 768,                 // multiple of 3
+        k_OUTPUT_CHUNK = k_INPUT_CHUNK / 3 * 4
+    };
 
-        int status = base64Encoder.convert(outputIterator, begin, end);
-        (void)status; BSLS_ASSERT(0 == status);  // nothing should be retained
-    }
+    char buffer[k_OUTPUT_CHUNK];
 
-    {
-        bsl::ostreambuf_iterator<char> outputIterator(stream);
+    while (0 < dataLength) {
+        const int numIn  = dataLength < k_INPUT_CHUNK ? dataLength
+                                                      : k_INPUT_CHUNK;
+        const int numOut = bdlde::Base64Encoder::encodeBuffer(buffer,
+                                                              data,
+                                                              numIn,
+                                                              0);
+        stream.write(buffer, numOut);
 
-        int status = base64Encoder.endConvert(outputIterator);
-        (void)status; BSLS_ASSERT(0 == status);  // nothing should be retained
+        data       += numIn;
+        dataLength -= numIn;
     }
 
     return stream;
@@ -797,7 +798,9 @@ TypesPrintUtil_Imp::printBase64(bsl::ostream&               stream,
                                 bdlat_TypeCategory::Simple)
 {
     // Calls a function in the unnamed namespace.  Cannot be inlined.
-    return u::encodeBase64(stream, object.begin(), object.end());
+    return u::encodeBase64(stream,
+                           object.data(),
+                           static_cast<int>(object.length()));
 }
 
 bsl::ostream&
@@ -807,7 +810,9 @@ TypesPrintUtil_Imp::printBase64(bsl::ostream&               stream,
                                 bdlat_TypeCategory::Simple)
 {
     // Calls a function in the unnamed namespace.  Cannot be inlined.
-    return u::encodeBase64(stream, object.begin(), object.end());
+    return u::encodeBase64(stream,
+                           object.data(),
+                           static_cast<int>(object.length()));
 }
 
 bsl::ostream&
@@ -817,7 +822,9 @@ TypesPrintUtil_Imp::printBase64(bsl::ostream&              stream,
                                 bdlat_TypeCategory::Array)
 {
     // Calls a function in the unnamed namespace.  Cannot be inlined.
-    return u::encodeBase64(stream, object.begin(), object.end());
+    return u::encodeBase64(stream,
+                           object.data(),
+                           static_cast<int>(object.size()));
 }
 
 // HEX FUNCTIONS
@@ -200,8 +200,11 @@ BSLS_IDENT("$Id: $")
 #include <bdlt_timetz.h>
 
 #include <bslmf_enableif.h>
+#include <bslmf_integralconstant.h>
+#include <bslmf_isarithmetic.h>
 #include <bslmf_isclass.h>
 #include <bslmf_isconvertible.h>
+#include <bslmf_metaint.h>
 
 #include <bsls_assert.h>
 #include <bsls_types.h>
@@ -700,6 +703,40 @@ struct TypesPrintUtil_Imp {
                                    const EncoderOptions      *encoderOptions,
                                    bdlat_TypeCategory::Array);
 
+    template <class TYPE>
+    static void printListElements(bsl::ostream&         stream,
+                                  const TYPE&           object,
+                                  const EncoderOptions *encoderOptions,
+                                  bslmf::MetaInt<0>);
+    template <class TYPE>
+    static void printListElements(bsl::ostream&         stream,
+                                  const TYPE&           object,
+                                  const EncoderOptions *encoderOptions,
+                                  bslmf::MetaInt<1>);
+        // Print the elements of the specified non-empty 'object' array,
+        // separated by spaces, to the specified 'stream' using the specified
+        // 'encoderOptions'.  The overload taking 'bslmf::MetaInt<1>' is
+        // selected for arrays that have contiguous storage (see
+        // 'bdlat_ArrayFunctions::HasContiguousStorage').
+
+    template <class TYPE>
+    static void printContiguousListElements(
+                                         bsl::ostream&         stream,
+                                         const TYPE&           object,
+                                         const EncoderOptions *encoderOptions,
+                                         bsl::false_type);
+    template <class TYPE>
+    static void printContiguousListElements(
+                                         bsl::ostream&         stream,
+                                         const TYPE&           object,
+                                         const EncoderOptions *encoderOptions,
+                                         bsl::true_type);
+        // Print the elements of the specified non-empty 'object' array,
+        // having contiguous storage, separated by spaces, to the specified
+        // 'stream' using the specified 'encoderOptions'.  The overload taking
+        // 'bsl::true_type' is selected for arrays of arithmetic types, and
+        // prints each element directly, without visiting it.
+
     template <class TYPE>
     static bsl::ostream& printList(
                                bsl::ostream&                    stream,
@@ -1782,12 +1819,27 @@ bsl::ostream& TypesPrintUtil_Imp::printList(
                                      const EncoderOptions      *encoderOptions,
                                      bdlat_TypeCategory::Array)
 {
-    int size = (int)bdlat_ArrayFunctions::size(object);
+    typedef typename bdlat_ArrayFunctions::HasContiguousStorage<TYPE>::Type
+                                                          HasContiguousStorage;
 
-    if (0 == size) {
+    if (0 == bdlat_ArrayFunctions::size(object)) {
         return stream;                                                // RETURN
     }
 
+    printListElements(stream, object, encoderOptions, HasContiguousStorage());
+
+    return stream;
+}
+
+template <class TYPE>
+void TypesPrintUtil_Imp::printListElements(
+                                          bsl::ostream&         stream,
+                                          const TYPE&           object,
+                                          const EncoderOptions *encoderOptions,
+                                          bslmf::MetaInt<0>)
+{
+    int size = (int)bdlat_ArrayFunctions::size(object);
+
     TypesPrintUtil_printDefaultProxy proxy = { &stream, encoderOptions };
 
     bdlat_ArrayFunctions::accessElement(object, proxy, 0);
@@ -1796,8 +1848,55 @@ bsl::ostream& TypesPrintUtil_Imp::printList(
         stream << " ";
         bdlat_ArrayFunctions::accessElement(object, proxy, i);
     }
+}
 
-    return stream;
+template <class TYPE>
+inline
+void TypesPrintUtil_Imp::printListElements(
+                                          bsl::ostream&         stream,
+                                          const TYPE&           object,
+                                          const EncoderOptions *encoderOptions,
+                                          bslmf::MetaInt<1>)
+{
+    typedef typename bdlat_ArrayFunctions::ElementType<TYPE>::Type
+                                                                   ElementType;
+
+    printContiguousListElements(stream,
+                                object,
+                                encoderOptions,
+                                bsl::is_arithmetic<ElementType>());
+}
+
+template <class TYPE>
+inline
+void TypesPrintUtil_Imp::printContiguousListElements(
+                                          bsl::ostream&         stream,
+                                          const TYPE&           object,
+                                          const EncoderOptions *encoderOptions,
+                                          bsl::false_type)
+{
+    printListElements(stream, object, encoderOptions, bslmf::MetaInt<0>());
+}
+
+template <class TYPE>
+void TypesPrintUtil_Imp::printContiguousListElements(
+                                          bsl::ostream&         stream,
+                                          const TYPE&           object,
+                                          const EncoderOptions *encoderOptions,
+                                          bsl::true_type)
+{
+    typedef typename bdlat_ArrayFunctions::ElementType<TYPE>::Type
+                                                                   ElementType;
+
+    const int          size     = (int)bdlat_ArrayFunctions::size(object);
+    const ElementType *elements = bdlat_ArrayFunctions::data(object);
+
+    TypesPrintUtil::printDefault(stream, elements[0], encoderOptions);
+
+    for (int i = 1; i < size; ++i) {
+        stream << " ";
+        TypesPrintUtil::printDefault(stream, elements[i], encoderOptions);
+    }
 }
 
 template <class TYPE>
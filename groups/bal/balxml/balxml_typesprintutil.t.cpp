@@ -4170,6 +4170,32 @@ int main(int argc, char *argv[])
             }
         }
 
+        if (verbose) cout << "\nUsing 'bsl::vector<double>'." << endl;
+        {
+            bsl::vector<double> mX;  const bsl::vector<double>& X = mX;
+            mX.push_back(1.5);
+            mX.push_back(-0.25);
+            mX.push_back(0);
+
+            bsl::stringstream ss;
+            Util::printList(ss, X);
+
+            ASSERTV(ss.str(), "1.5 -0.25 0" == ss.str());
+        }
+
+        if (verbose) cout << "\nUsing 'bsl::vector<bsl::string>'." << endl;
+        {
+            bsl::vector<bsl::string> mX;
+            const bsl::vector<bsl::string>& X = mX;
+            mX.push_back("a");
+            mX.push_back("bc");
+
+            bsl::stringstream ss;
+            Util::printList(ss, X);
+
+            ASSERTV(ss.str(), "a bc" == ss.str());
+        }
+
         if (verbose) cout << "\nEnd of Test." << endl;
       } break;
       case 4: {
@@ -33,6 +33,8 @@ BSLS_IDENT("$Id: $")
 //        ('manipulateElement').
 //      o access an element in an array using a parameterized accessor
 //        ('accessElement').
+//      o obtain the address of the first element of an array whose elements
+//        are stored contiguously ('data').
 //..
 // Also, the meta-function 'IsArray' contains a compile-time constant 'VALUE'
 // that is non-zero if the parameterized 'TYPE' exposes "array" behavior
@@ -41,7 +43,15 @@ BSLS_IDENT("$Id: $")
 // The 'ElementType' meta-function contains a typedef 'Type' that specifies the
 // type of element stored in the parameterized "array" type.
 //
-// This component specializes all of these functions for 'bsl::vector<TYPE>'.
+// The 'HasContiguousStorage' meta-function contains a compile-time constant
+// 'VALUE' that is non-zero if the elements of the parameterized "array" type
+// are stored contiguously, in index order, and may be accessed through the
+// pointer returned by 'data'.  Codecs use this to visit the elements of arrays
+// of fundamental types in a single loop, without invoking an accessor for each
+// element.
+//
+// This component specializes all of these functions, as well as
+// 'HasContiguousStorage' and 'data', for 'bsl::vector<TYPE>'.
 //
 // Custom types can be plugged into the 'bdlat' framework.  This is done by
 // overloading the 'bdlat_array*' functions inside the namespace of the plugged
@@ -86,6 +96,18 @@ BSLS_IDENT("$Id: $")
 // Also, the 'IsArray' meta-function must be specialized for the
 // 'mine::MyArray' type in the 'bdlat_ArrayFunctions' namespace.
 //
+// Optionally, if 'mine::MyArray' stores its elements contiguously, the
+// 'HasContiguousStorage' meta-function may also be specialized for it, in
+// which case the following function must be declared and implemented in the
+// 'mine' namespace:
+//..
+//  template <typename TYPE>
+//  const typename ElementType<TYPE>::Type *bdlat_arrayData(
+//                                                     const TYPE& array);
+//      // Return the address of the first element of the specified 'array',
+//      // the elements of which are stored contiguously in index order.
+//..
+//
 // An example of plugging in a user-defined sequence type into the 'bdlat'
 // framework is shown in the 'Usage' section of the 'bdlat_SequenceFunctions'
 // component.
@@ -334,6 +356,20 @@ namespace bdlat_ArrayFunctions {
         typedef bslmf::MetaInt<VALUE> Type;
     };
 
+    template <class TYPE>
+    struct HasContiguousStorage {
+        // This 'struct' may be specialized for "array" types that store their
+        // elements contiguously and in index order, and that provide the
+        // 'bdlat_arrayData' function.  See the component-level documentation
+        // for further information.
+
+        enum {
+            VALUE = 0
+        };
+
+        typedef bslmf::MetaInt<VALUE> Type;
+    };
+
     // MANIPULATORS
     template <class TYPE, class MANIPULATOR>
     int manipulateElement(TYPE         *array,
@@ -367,6 +403,15 @@ namespace bdlat_ArrayFunctions {
     bsl::size_t size(const TYPE& array);
         // Return the number of elements in the specified 'array'.
 
+    template <class TYPE>
+    const typename ElementType<TYPE>::Type *data(const TYPE& array);
+        // Return the address of the first element of the specified 'array',
+        // the remaining elements of which follow it contiguously in index
+        // order.  The returned address may be 0 if 'array' is empty.  The
+        // behavior is undefined unless 'HasContiguousStorage<TYPE>::VALUE' is
+        // non-zero.  Note that the returned address is invalidated by any
+        // manipulation of 'array' that changes its size.
+
 
 
     // OVERLOADABLE FUNCTIONS
@@ -397,6 +442,11 @@ namespace bdlat_ArrayFunctions {
     template <typename TYPE>
     bsl::size_t bdlat_arraySize(const TYPE& array);
         // Return the number of elements in the specified 'array'.
+    template <typename TYPE>
+    const typename ElementType<TYPE>::Type *bdlat_arrayData(
+                                                            const TYPE& array);
+        // Return the address of the first element of the specified 'array'.
+        // Only required if 'HasContiguousStorage' is specialized for 'TYPE'.
 #endif
 
 }  // close namespace bdlat_ArrayFunctions
@@ -417,6 +467,11 @@ namespace bdlat_ArrayFunctions {
         typedef TYPE Type;
     };
 
+    template <class TYPE, class ALLOC>
+    struct HasContiguousStorage<bsl::vector<TYPE, ALLOC> >
+    : bslmf::MetaInt<1> {
+    };
+
     // MANIPULATORS
     template <class TYPE, class ALLOC, class MANIPULATOR>
     int bdlat_arrayManipulateElement(bsl::vector<TYPE, ALLOC> *array,
@@ -435,6 +490,9 @@ namespace bdlat_ArrayFunctions {
     template <class TYPE, class ALLOC>
     bsl::size_t bdlat_arraySize(const bsl::vector<TYPE, ALLOC>& array);
 
+    template <class TYPE, class ALLOC>
+    const TYPE *bdlat_arrayData(const bsl::vector<TYPE, ALLOC>& array);
+
 }  // close namespace bdlat_ArrayFunctions
 
 // ============================================================================
@@ -481,6 +539,14 @@ bsl::size_t bdlat_ArrayFunctions::size(const TYPE& array)
     return bdlat_arraySize(array);
 }
 
+template <class TYPE>
+inline
+const typename bdlat_ArrayFunctions::ElementType<TYPE>::Type *
+bdlat_ArrayFunctions::data(const TYPE& array)
+{
+    return bdlat_arrayData(array);
+}
+
 
                         // ---------------------------
                         // bsl::vector specializations
@@ -527,6 +593,14 @@ bsl::size_t bdlat_ArrayFunctions::bdlat_arraySize(
     return array.size();
 }
 
+template <class TYPE, class ALLOC>
+inline
+const TYPE *bdlat_ArrayFunctions::bdlat_arrayData(
+                                         const bsl::vector<TYPE, ALLOC>& array)
+{
+    return array.data();
+}
+
 }  // close enterprise namespace
 
 #endif
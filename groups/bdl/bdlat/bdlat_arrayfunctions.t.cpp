@@ -37,6 +37,7 @@ using namespace bsl;  // automatically added by script
 //-----------------------------------------------------------------------------
 // [ 2] struct IsArray<TYPE>
 // [ 2] struct ElementType<TYPE>
+// [ 2] struct HasContiguousStorage<TYPE>
 // [ 1] METHOD FORWARDING TEST
 //-----------------------------------------------------------------------------
 // [ 3] USAGE EXAMPLE
@@ -499,6 +500,7 @@ int main(int argc, char *argv[])
         // Testing:
         //   struct IsArray
         //   struct ElementType
+        //   struct HasContiguousStorage
         // --------------------------------------------------------------------
 
         if (verbose) cout << "\nTesting meta-functions"
@@ -516,6 +518,14 @@ int main(int argc, char *argv[])
         ASSERT(1 == bdlat_ArrayFunctions::IsArray<bsl::vector<int> >::VALUE);
         ASSERT(1 == (bslmf::IsSame<VecElementType, int>::VALUE));
 
+        ASSERT(0 == bdlat_ArrayFunctions::HasContiguousStorage<int>::VALUE);
+        ASSERT(0 == (bdlat_ArrayFunctions::HasContiguousStorage<
+                                          Test::FixedArray<3, char> >::VALUE));
+        ASSERT(1 == (bdlat_ArrayFunctions::HasContiguousStorage<
+                                                  bsl::vector<int> >::VALUE));
+        ASSERT(1 == (bdlat_ArrayFunctions::HasContiguousStorage<
+                                               bsl::vector<double> >::VALUE));
+
       } break;
       case 1: {
         // --------------------------------------------------------------------
@@ -609,6 +619,12 @@ int main(int argc, char *argv[])
             Obj::accessElement(V, getter, 1); ASSERT(44 == value);
             Obj::accessElement(V, getter, 2); ASSERT( 0 == value);
 
+            const int *DATA = Obj::data(V);
+            ASSERT(&V[0] == DATA);
+            ASSERT(33 == DATA[0]);
+            ASSERT(44 == DATA[1]);
+            ASSERT( 0 == DATA[2]);
+
             Obj::resize(&mV, 0);
             ASSERT(0 == Obj::size(V));
         }
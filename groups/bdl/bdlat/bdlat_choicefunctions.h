@@ -40,7 +40,10 @@ BSLS_IDENT("$Id: $")
 // through the 'bdlat_ChoiceFunctions' 'namespace'.
 //
 // This component specializes all of these functions for types that have the
-// 'bdlat_TypeTraitBasicChoice' trait.
+// 'bdlat_TypeTraitBasicChoice' trait.  For such types, selections are looked
+// up by name through a perfect-hash index of the type's
+// 'SELECTION_INFO_ARRAY' (see 'bdlat_nameindex') before deferring to the
+// type's own lookup.
 //
 // Types that do not have the 'bdlat_TypeTraitBasicChoice' trait can be plugged
 // into the 'bdlat' framework.  This is done by overloading the 'bdlat_choice*'
@@ -453,6 +456,7 @@ BSLS_IDENT("$Id: $")
 #include <bdlscm_version.h>
 
 #include <bdlat_bdeatoverrides.h>
+#include <bdlat_nameindex.h>
 #include <bdlat_selectioninfo.h>
 #include <bdlat_typetraits.h>
 
@@ -750,6 +754,14 @@ int bdlat_ChoiceFunctions::bdlat_choiceMakeSelection(
 {
     BSLMF_ASSERT((bslalg::HasTrait<TYPE, bdlat_TypeTraitBasicChoice>::VALUE));
 
+    const bdlat_SelectionInfo *info =
+                     bdlat_NameIndexUtil::lookupSelectionInfo<TYPE>(
+                                                          selectionName,
+                                                          selectionNameLength);
+    if (info) {
+        return object->makeSelection(info->d_id);                     // RETURN
+    }
+
     return object->makeSelection(selectionName, selectionNameLength);
 }
 
@@ -791,7 +803,10 @@ bool bdlat_ChoiceFunctions::bdlat_choiceHasSelection(
 {
     BSLMF_ASSERT((bslalg::HasTrait<TYPE, bdlat_TypeTraitBasicChoice>::VALUE));
 
-    return 0 != object.lookupSelectionInfo(selectionName, selectionNameLength);
+    return 0 != bdlat_NameIndexUtil::lookupSelectionInfo<TYPE>(
+                                                          selectionName,
+                                                          selectionNameLength)
+        || 0 != object.lookupSelectionInfo(selectionName, selectionNameLength);
 }
 
 template <class TYPE>
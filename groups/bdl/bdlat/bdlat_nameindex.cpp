@@ -0,0 +1,147 @@
+// bdlat_nameindex.cpp                                                -*-C++-*-
+#include <bdlat_nameindex.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlat_nameindex_cpp,"$Id$ $CSID$")
+
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+
+namespace {
+
+enum {
+    k_MAX_DISPLACEMENT = 0xFFFF  // largest displacement tried for a bucket
+};
+
+}  // close unnamed namespace
+
+                         // --------------------------
+                         // struct bdlat_NameIndex_Imp
+                         // --------------------------
+
+// CLASS METHODS
+bool bdlat_NameIndex_Imp::build(unsigned short            *displacements,
+                                int                        numBuckets,
+                                short                     *slots,
+                                int                        numSlots,
+                                const bsls::Types::Uint64 *hashes,
+                                int                        numHashes,
+                                short                     *scratch)
+{
+    BSLS_ASSERT(displacements);
+    BSLS_ASSERT(0 < numBuckets);
+    BSLS_ASSERT(0 == (numBuckets & (numBuckets - 1)));
+    BSLS_ASSERT(slots);
+    BSLS_ASSERT(0 < numSlots);
+    BSLS_ASSERT(0 == (numSlots & (numSlots - 1)));
+    BSLS_ASSERT(numSlots <= 2 * k_MAX_NUM_INFOS);
+    BSLS_ASSERT(hashes || 0 == numHashes);
+    BSLS_ASSERT(0 <= numHashes);
+    BSLS_ASSERT(numHashes <= numSlots);
+    BSLS_ASSERT(scratch);
+
+    // Chain the hashes of each bucket together: 'next[i]' is the hash
+    // following hash 'i' in its bucket (or -1), 'head[b]' is the first hash in
+    // bucket 'b' (or -1).  'order' receives the buckets, largest first.
+
+    short *next  = scratch;
+    short *head  = next + numHashes;
+    short *order = head + numBuckets;
+
+    int maxBucketSize = 0;
+
+    for (int b = 0; b < numBuckets; ++b) {
+        head[b]          = -1;
+        displacements[b] = 0;
+    }
+    for (int i = numHashes - 1; 0 <= i; --i) {
+        const int b = bucket(hashes[i], numBuckets);
+
+        next[i] = head[b];
+        head[b] = static_cast<short>(i);
+    }
+    for (int s = 0; s < numSlots; ++s) {
+        slots[s] = -1;
+    }
+
+    int numOrdered = 0;
+    {
+        // Counting sort of the non-empty buckets by decreasing size.  Sizes
+        // are small, so a pass per size is cheap.
+
+        for (int b = 0; b < numBuckets; ++b) {
+            int size = 0;
+            for (int i = head[b]; 0 <= i; i = next[i]) {
+                ++size;
+            }
+            maxBucketSize = size > maxBucketSize ? size : maxBucketSize;
+        }
+        for (int size = maxBucketSize; 0 < size; --size) {
+            for (int b = 0; b < numBuckets; ++b) {
+                int bucketSize = 0;
+                for (int i = head[b]; 0 <= i; i = next[i]) {
+                    ++bucketSize;
+                }
+                if (size == bucketSize) {
+                    order[numOrdered++] = static_cast<short>(b);
+                }
+            }
+        }
+    }
+
+    for (int k = 0; k < numOrdered; ++k) {
+        const int b = order[k];
+
+        bool placed = false;
+        for (int d = 0; !placed && d <= k_MAX_DISPLACEMENT; ++d) {
+            // Tentatively place every hash of the bucket, undoing the
+            // placement on the first collision.
+
+            int failed = -1;
+            for (int i = head[b]; 0 <= i; i = next[i]) {
+                const int s = slot(hashes[i], d, numSlots);
+
+                if (0 <= slots[s]) {
+                    failed = i;
+                    break;
+                }
+                slots[s] = static_cast<short>(i);
+            }
+
+            if (-1 == failed) {
+                displacements[b] = static_cast<unsigned short>(d);
+                placed           = true;
+            }
+            else {
+                for (int i = head[b]; i != failed; i = next[i]) {
+                    slots[slot(hashes[i], d, numSlots)] = -1;
+                }
+            }
+        }
+
+        if (!placed) {
+            return false;                                             // RETURN
+        }
+    }
+
+    return true;
+}
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
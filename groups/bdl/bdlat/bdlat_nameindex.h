@@ -0,0 +1,577 @@
+// bdlat_nameindex.h                                                  -*-C++-*-
+#ifndef INCLUDED_BDLAT_NAMEINDEX
+#define INCLUDED_BDLAT_NAMEINDEX
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a perfect-hash index from element names to element info.
+//
+//@CLASSES:
+//  bdlat_NameIndex: perfect-hash index over an attribute or selection array
+//  bdlat_NameIndexUtil: per-type name lookup for generated types
+//
+//@SEE_ALSO: bdlat_sequencefunctions, bdlat_choicefunctions
+//
+//@DESCRIPTION: This component provides a class template, 'bdlat_NameIndex',
+// that maps the names in a fixed-size array of 'bdlat_AttributeInfo' or
+// 'bdlat_SelectionInfo' objects to the corresponding array elements in
+// constant time, and a utility, 'bdlat_NameIndexUtil', that maintains one such
+// index for each generated "sequence" or "choice" type.
+//
+// Generated types look up an element by name with a linear scan of their
+// 'ATTRIBUTE_INFO_ARRAY' or 'SELECTION_INFO_ARRAY', comparing the name of
+// each element in turn.  Decoders for text formats (e.g., JSON and XML) look
+// up every element they read by name, so for types with many elements that
+// scan dominates decoding.  'bdlat_NameIndex' instead hashes the name once and
+// compares it against the single candidate element the hash selects.
+//
+///Perfect Hashing
+///---------------
+// A 'bdlat_NameIndex' is built with the "hash and displace" method: each name
+// is hashed to a 64-bit value, the names are grouped into buckets by one part
+// of that value, and for each bucket (largest first) a displacement is chosen
+// such that the names in the bucket land in distinct, unoccupied slots when
+// the displacement is mixed with the rest of the hash value.  A lookup
+// therefore consists of hashing the name, reading the displacement of its
+// bucket, and comparing the name with the (at most one) element in the
+// resulting slot.  The index has twice as many slots as elements, so a
+// displacement is found quickly for every bucket.  Should construction
+// nevertheless fail (e.g., because the array contains duplicate names), the
+// index falls back to a linear scan, so lookups are always correct.
+//
+// The storage of a 'bdlat_NameIndex' is sized at compile time from the number
+// of elements, so an index never allocates memory.  The index cannot itself be
+// built at compile time because the info arrays of generated types are defined
+// in their '.cpp' files; it is instead built once, the first time each type is
+// looked up, by 'bdlat_NameIndexUtil'.  Types having more than
+// 'bdlat_NameIndexUtil::k_MAX_NUM_INFOS' elements, and hand-written types
+// lacking the 'NUM_ATTRIBUTES'/'ATTRIBUTE_INFO_ARRAY' (or 'NUM_SELECTIONS'/
+// 'SELECTION_INFO_ARRAY') members of generated types, are not indexed.
+//
+///Integration with 'bdlat_SequenceFunctions' and 'bdlat_ChoiceFunctions'
+///----------------------------------------------------------------------
+// The default (i.e., generated type) implementations of
+// 'bdlat_SequenceFunctions::manipulateAttribute' and
+// 'bdlat_SequenceFunctions::hasAttribute' taking an attribute name, and of
+// 'bdlat_ChoiceFunctions::makeSelection' and
+// 'bdlat_ChoiceFunctions::hasSelection' taking a selection name, consult
+// 'bdlat_NameIndexUtil' first.  A name that exactly matches an element of the
+// info array is dispatched by id; any other name is passed to the type's own
+// lookup, which may implement additional matching (e.g., for the selections
+// of an anonymous choice).  Codecs therefore benefit without modification.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Looking Up Attributes by Name
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose we have an array of attribute information, as found in a generated
+// sequence type:
+//..
+//  const bdlat_AttributeInfo ATTRIBUTES[] = {
+//      { 3, "name",   4, "", bdlat_FormattingMode::e_TEXT },
+//      { 5, "age",    3, "", bdlat_FormattingMode::e_DEC  },
+//      { 8, "salary", 6, "", bdlat_FormattingMode::e_DEC  }
+//  };
+//..
+// First, we build an index over the array:
+//..
+//  const bdlat_NameIndex<bdlat_AttributeInfo, 3> index(ATTRIBUTES);
+//..
+// Now, we look up attributes by name:
+//..
+//  const bdlat_AttributeInfo *info = index.find("salary", 6);
+//  assert(&ATTRIBUTES[2] == info);
+//  assert(8              == info->d_id);
+//..
+// Finally, we observe that names not in the array are not found:
+//..
+//  assert(0 == index.find("sal",    3));
+//  assert(0 == index.find("Salary", 6));
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlat_attributeinfo.h>
+#include <bdlat_selectioninfo.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_metaint.h>
+
+#include <bslmt_once.h>
+
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+#include <bsl_cstring.h>
+
+namespace BloombergLP {
+
+                         // ==========================
+                         // struct bdlat_NameIndex_Imp
+                         // ==========================
+
+struct bdlat_NameIndex_Imp {
+    // This 'struct' provides a namespace for the non-template functions used
+    // to build and probe a 'bdlat_NameIndex'.
+
+    // CONSTANTS
+    enum {
+        k_MAX_NUM_INFOS = 4096  // largest array that may be indexed
+    };
+
+    // TYPES
+    template <int VALUE, int POWER = 1, bool DONE = (POWER >= VALUE)>
+    struct CeilPowerOf2 {
+        // This meta-function computes the smallest power of two that is not
+        // less than 'VALUE' (and not less than 1).
+
+        enum { e_VALUE = CeilPowerOf2<VALUE, POWER * 2>::e_VALUE };
+    };
+
+    template <int VALUE, int POWER>
+    struct CeilPowerOf2<VALUE, POWER, true> {
+        enum { e_VALUE = POWER };
+    };
+
+    // CLASS METHODS
+    static bool build(unsigned short            *displacements,
+                      int                        numBuckets,
+                      short                     *slots,
+                      int                        numSlots,
+                      const bsls::Types::Uint64 *hashes,
+                      int                        numHashes,
+                      short                     *scratch);
+        // Load into the specified 'displacements' (having the specified
+        // 'numBuckets' elements) and 'slots' (having the specified 'numSlots'
+        // elements) a perfect hash of the specified 'hashes' (having the
+        // specified 'numHashes' elements), using the specified 'scratch'
+        // (having at least 'numHashes + 2 * numBuckets' elements).  Return
+        // 'true' on success, and 'false' (with the contents of 'displacements'
+        // and 'slots' unspecified) if no perfect hash was found.  The behavior
+        // is undefined unless 'numBuckets' and 'numSlots' are powers of two,
+        // 'numHashes <= numSlots', and 'numSlots <= 2 * k_MAX_NUM_INFOS'.
+
+    static int bucket(bsls::Types::Uint64 hash, int numBuckets);
+        // Return the bucket, in the range '[0 .. numBuckets)', of the
+        // specified 'hash' value.  The behavior is undefined unless the
+        // specified 'numBuckets' is a power of two.
+
+    static bsls::Types::Uint64 hash(const char *name, int nameLength);
+        // Return the hash value of the specified 'name' having the specified
+        // 'nameLength'.
+
+    static int slot(bsls::Types::Uint64 hash,
+                    unsigned int        displacement,
+                    int                 numSlots);
+        // Return the slot, in the range '[0 .. numSlots)', of the specified
+        // 'hash' value when its bucket has the specified 'displacement'.  The
+        // behavior is undefined unless the specified 'numSlots' is a power of
+        // two.
+};
+
+                           // =====================
+                           // class bdlat_NameIndex
+                           // =====================
+
+template <class INFO, int NUM_INFOS>
+class bdlat_NameIndex {
+    // This class provides an index mapping the names of the elements of an
+    // array of 'NUM_INFOS' 'INFO' objects to those elements.  'INFO' must
+    // have 'd_name_p' and 'd_nameLength' data members (e.g.,
+    // 'bdlat_AttributeInfo' or 'bdlat_SelectionInfo').
+
+    BSLMF_ASSERT(0 < NUM_INFOS &&
+                 NUM_INFOS <= bdlat_NameIndex_Imp::k_MAX_NUM_INFOS);
+
+    // PRIVATE TYPES
+    enum {
+        k_NUM_SLOTS   = bdlat_NameIndex_Imp::CeilPowerOf2<2 * NUM_INFOS>
+                                                                   ::e_VALUE,
+        k_NUM_BUCKETS = bdlat_NameIndex_Imp::CeilPowerOf2<NUM_INFOS / 2>
+                                                                   ::e_VALUE
+    };
+
+    // DATA
+    const INFO     *d_infos_p;                      // indexed array (held,
+                                                    // not owned)
+
+    bool            d_isPerfect;                    // 'false' if no perfect
+                                                    // hash was found
+
+    unsigned short  d_displacements[k_NUM_BUCKETS]; // displacement of each
+                                                    // bucket
+
+    short           d_slots[k_NUM_SLOTS];           // index of the element
+                                                    // in each slot, or -1
+
+    // NOT IMPLEMENTED
+    bdlat_NameIndex(const bdlat_NameIndex&);
+    bdlat_NameIndex& operator=(const bdlat_NameIndex&);
+
+  public:
+    // CREATORS
+    explicit bdlat_NameIndex(const INFO *infos);
+        // Create an index over the specified 'infos' array.  The behavior is
+        // undefined unless 'infos' has at least 'NUM_INFOS' elements, and
+        // 'infos' outlives this object.
+
+    // ACCESSORS
+    const INFO *find(const char *name, int nameLength) const;
+        // Return the address of the element of the indexed array whose name
+        // is the specified 'name' having the specified 'nameLength', or 0 if
+        // there is no such element.  If more than one element has that name,
+        // the first such element is returned.
+
+    bool isPerfect() const;
+        // Return 'true' if this index found a perfect hash of the indexed
+        // names (so that 'find' compares at most one name), and 'false' if it
+        // falls back to a linear scan.
+};
+
+                      // ================================
+                      // struct bdlat_NameIndexUtil_Count
+                      // ================================
+
+template <class TYPE>
+struct bdlat_NameIndexUtil_Count {
+    // This component-private meta-function computes the number of attributes
+    // and selections of 'TYPE' as published by the 'NUM_ATTRIBUTES',
+    // 'ATTRIBUTE_INFO_ARRAY', 'NUM_SELECTIONS', and 'SELECTION_INFO_ARRAY'
+    // members of generated types, yielding 0 for a type that does not have
+    // the relevant pair of members (e.g., a hand-written "sequence" type).
+
+  private:
+    // PRIVATE CLASS METHODS
+    template <class U>
+    static char (&probeAttributes(bslmf::MetaInt<static_cast<int>(
+                  sizeof(static_cast<const bdlat_AttributeInfo *>(
+                                          U::ATTRIBUTE_INFO_ARRAY)))> *))
+                                                   [U::NUM_ATTRIBUTES + 1];
+    template <class U>
+    static char (&probeAttributes(...))[1];
+
+    template <class U>
+    static char (&probeSelections(bslmf::MetaInt<static_cast<int>(
+                  sizeof(static_cast<const bdlat_SelectionInfo *>(
+                                          U::SELECTION_INFO_ARRAY)))> *))
+                                                   [U::NUM_SELECTIONS + 1];
+    template <class U>
+    static char (&probeSelections(...))[1];
+        // Declared but not defined; only the sizes of the return types of
+        // these overloads are used.
+
+  public:
+    // CONSTANTS
+    enum {
+        NUM_ATTRIBUTES = sizeof(probeAttributes<TYPE>(0)) - 1,
+        NUM_SELECTIONS = sizeof(probeSelections<TYPE>(0)) - 1
+    };
+};
+
+                         // ==========================
+                         // struct bdlat_NameIndexUtil
+                         // ==========================
+
+struct bdlat_NameIndexUtil {
+    // This 'struct' provides a namespace for functions that look up the
+    // elements of generated "sequence" and "choice" types by name, using a
+    // 'bdlat_NameIndex' built on first use for each type.
+
+  private:
+    // PRIVATE CLASS METHODS
+    template <class TYPE>
+    static const bdlat_AttributeInfo *findAttribute(const char *name,
+                                                    int         nameLength,
+                                                    bslmf::MetaInt<0>);
+    template <class TYPE>
+    static const bdlat_AttributeInfo *findAttribute(const char *name,
+                                                    int         nameLength,
+                                                    bslmf::MetaInt<1>);
+    template <class TYPE>
+    static const bdlat_SelectionInfo *findSelection(const char *name,
+                                                    int         nameLength,
+                                                    bslmf::MetaInt<0>);
+    template <class TYPE>
+    static const bdlat_SelectionInfo *findSelection(const char *name,
+                                                    int         nameLength,
+                                                    bslmf::MetaInt<1>);
+        // Return the result of looking up the specified 'name' having the
+        // specified 'nameLength' in the info array of 'TYPE', or 0 if 'TYPE'
+        // has no elements or too many to index (as indicated by the last
+        // argument).
+
+  public:
+    // CONSTANTS
+    enum {
+        k_MAX_NUM_INFOS = bdlat_NameIndex_Imp::k_MAX_NUM_INFOS
+            // largest number of elements for which a type is indexed
+    };
+
+    // CLASS METHODS
+    template <class TYPE>
+    static const bdlat_AttributeInfo *lookupAttributeInfo(
+                                                       const char *name,
+                                                       int         nameLength);
+        // Return the address of the element of 'TYPE::ATTRIBUTE_INFO_ARRAY'
+        // whose name is the specified 'name' having the specified
+        // 'nameLength', or 0 if there is no such element.  This function is
+        // thread-safe.  Note that 0 is returned if 'TYPE' does not have the
+        // 'NUM_ATTRIBUTES' and 'ATTRIBUTE_INFO_ARRAY' members of a generated
+        // "sequence" type, or if 'k_MAX_NUM_INFOS < TYPE::NUM_ATTRIBUTES'.
+
+    template <class TYPE>
+    static const bdlat_SelectionInfo *lookupSelectionInfo(
+                                                       const char *name,
+                                                       int         nameLength);
+        // Return the address of the element of 'TYPE::SELECTION_INFO_ARRAY'
+        // whose name is the specified 'name' having the specified
+        // 'nameLength', or 0 if there is no such element.  This function is
+        // thread-safe.  Note that 0 is returned if 'TYPE' does not have the
+        // 'NUM_SELECTIONS' and 'SELECTION_INFO_ARRAY' members of a generated
+        // "choice" type, or if 'k_MAX_NUM_INFOS < TYPE::NUM_SELECTIONS'.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                         // --------------------------
+                         // struct bdlat_NameIndex_Imp
+                         // --------------------------
+
+// CLASS METHODS
+inline
+int bdlat_NameIndex_Imp::bucket(bsls::Types::Uint64 hash, int numBuckets)
+{
+    return static_cast<int>(hash >> 40) & (numBuckets - 1);
+}
+
+inline
+bsls::Types::Uint64 bdlat_NameIndex_Imp::hash(const char *name,
+                                              int         nameLength)
+{
+    // 64-bit FNV-1a, seeded with the length.
+
+    bsls::Types::Uint64 result = 14695981039346656037ULL
+                               ^ static_cast<bsls::Types::Uint64>(nameLength);
+
+    for (int i = 0; i < nameLength; ++i) {
+        result ^= static_cast<unsigned char>(name[i]);
+        result *= 1099511628211ULL;
+    }
+    return result;
+}
+
+inline
+int bdlat_NameIndex_Imp::slot(bsls::Types::Uint64 hash,
+                              unsigned int        displacement,
+                              int                 numSlots)
+{
+    bsls::Types::Uint64 x = hash + displacement * 0x9E3779B97F4A7C15ULL;
+
+    x ^= x >> 33;
+    x *= 0xFF51AFD7ED558CCDULL;
+    x ^= x >> 33;
+
+    return static_cast<int>(x) & (numSlots - 1);
+}
+
+                           // ---------------------
+                           // class bdlat_NameIndex
+                           // ---------------------
+
+// CREATORS
+template <class INFO, int NUM_INFOS>
+bdlat_NameIndex<INFO, NUM_INFOS>::bdlat_NameIndex(const INFO *infos)
+: d_infos_p(infos)
+, d_isPerfect(false)
+{
+    BSLS_ASSERT(infos);
+
+    bsls::Types::Uint64 hashes[NUM_INFOS];
+    short               scratch[NUM_INFOS + 2 * k_NUM_BUCKETS];
+
+    for (int i = 0; i < NUM_INFOS; ++i) {
+        hashes[i] = bdlat_NameIndex_Imp::hash(infos[i].d_name_p,
+                                              infos[i].d_nameLength);
+    }
+
+    d_isPerfect = bdlat_NameIndex_Imp::build(d_displacements,
+                                             k_NUM_BUCKETS,
+                                             d_slots,
+                                             k_NUM_SLOTS,
+                                             hashes,
+                                             NUM_INFOS,
+                                             scratch);
+}
+
+// ACCESSORS
+template <class INFO, int NUM_INFOS>
+inline
+const INFO *
+bdlat_NameIndex<INFO, NUM_INFOS>::find(const char *name, int nameLength) const
+{
+    BSLS_ASSERT(name || 0 == nameLength);
+
+    if (!d_isPerfect) {
+        for (int i = 0; i < NUM_INFOS; ++i) {
+            const INFO& info = d_infos_p[i];
+
+            if (nameLength == info.d_nameLength
+             && 0 == bsl::memcmp(info.d_name_p, name, nameLength)) {
+                return &info;                                         // RETURN
+            }
+        }
+        return 0;                                                     // RETURN
+    }
+
+    const bsls::Types::Uint64 hash = bdlat_NameIndex_Imp::hash(name,
+                                                               nameLength);
+    const int index = d_slots[bdlat_NameIndex_Imp::slot(
+             hash,
+             d_displacements[bdlat_NameIndex_Imp::bucket(hash, k_NUM_BUCKETS)],
+             k_NUM_SLOTS)];
+
+    if (index < 0) {
+        return 0;                                                     // RETURN
+    }
+
+    const INFO& info = d_infos_p[index];
+
+    return nameLength == info.d_nameLength
+        && 0 == bsl::memcmp(info.d_name_p, name, nameLength)
+           ? &info
+           : 0;
+}
+
+template <class INFO, int NUM_INFOS>
+inline
+bool bdlat_NameIndex<INFO, NUM_INFOS>::isPerfect() const
+{
+    return d_isPerfect;
+}
+
+                         // --------------------------
+                         // struct bdlat_NameIndexUtil
+                         // --------------------------
+
+// PRIVATE CLASS METHODS
+template <class TYPE>
+inline
+const bdlat_AttributeInfo *bdlat_NameIndexUtil::findAttribute(
+                                                        const char *,
+                                                        int,
+                                                        bslmf::MetaInt<0>)
+{
+    return 0;
+}
+
+template <class TYPE>
+const bdlat_AttributeInfo *bdlat_NameIndexUtil::findAttribute(
+                                                 const char *name,
+                                                 int         nameLength,
+                                                 bslmf::MetaInt<1>)
+{
+    typedef bdlat_NameIndex<bdlat_AttributeInfo, TYPE::NUM_ATTRIBUTES> Index;
+
+    static const Index *index_p = 0;
+
+    BSLMT_ONCE_DO {
+        static const Index index(TYPE::ATTRIBUTE_INFO_ARRAY);
+        index_p = &index;
+    }
+
+    return index_p->find(name, nameLength);
+}
+
+template <class TYPE>
+inline
+const bdlat_SelectionInfo *bdlat_NameIndexUtil::findSelection(
+                                                        const char *,
+                                                        int,
+                                                        bslmf::MetaInt<0>)
+{
+    return 0;
+}
+
+template <class TYPE>
+const bdlat_SelectionInfo *bdlat_NameIndexUtil::findSelection(
+                                                 const char *name,
+                                                 int         nameLength,
+                                                 bslmf::MetaInt<1>)
+{
+    typedef bdlat_NameIndex<bdlat_SelectionInfo, TYPE::NUM_SELECTIONS> Index;
+
+    static const Index *index_p = 0;
+
+    BSLMT_ONCE_DO {
+        static const Index index(TYPE::SELECTION_INFO_ARRAY);
+        index_p = &index;
+    }
+
+    return index_p->find(name, nameLength);
+}
+
+// CLASS METHODS
+template <class TYPE>
+inline
+const bdlat_AttributeInfo *bdlat_NameIndexUtil::lookupAttributeInfo(
+                                                        const char *name,
+                                                        int         nameLength)
+{
+    typedef bdlat_NameIndexUtil_Count<TYPE> Count;
+
+    // Convert the count to 'int' so as not to compare enumerators of distinct
+    // enumerations.
+
+    const int k_NUM_ATTRIBUTES = Count::NUM_ATTRIBUTES;
+
+    return findAttribute<TYPE>(name,
+                               nameLength,
+                               bslmf::MetaInt<(0 < k_NUM_ATTRIBUTES &&
+                                               k_NUM_ATTRIBUTES <=
+                                               k_MAX_NUM_INFOS)>());
+}
+
+template <class TYPE>
+inline
+const bdlat_SelectionInfo *bdlat_NameIndexUtil::lookupSelectionInfo(
+                                                        const char *name,
+                                                        int         nameLength)
+{
+    typedef bdlat_NameIndexUtil_Count<TYPE> Count;
+
+    // Convert the count to 'int' so as not to compare enumerators of distinct
+    // enumerations.
+
+    const int k_NUM_SELECTIONS = Count::NUM_SELECTIONS;
+
+    return findSelection<TYPE>(name,
+                               nameLength,
+                               bslmf::MetaInt<(0 < k_NUM_SELECTIONS &&
+                                               k_NUM_SELECTIONS <=
+                                               k_MAX_NUM_INFOS)>());
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1027 @@
+// bdlat_nameindex.t.cpp                                              -*-C++-*-
+#include <bdlat_nameindex.h>
+
+#include <bdlat_attributeinfo.h>
+#include <bdlat_choicefunctions.h>
+#include <bdlat_formattingmode.h>
+#include <bdlat_selectioninfo.h>
+#include <bdlat_sequencefunctions.h>
+#include <bdlat_typetraits.h>
+
+#include <bslim_testutil.h>
+
+#include <bslalg_typetraits.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// 'bdlat_NameIndex' is a value-semantic-free index whose only observable
+// behavior is 'find' and 'isPerfect'.  We verify that every name of arrays of
+// many sizes and shapes is found, that names not in the array are not found,
+// and that arrays defeating the perfect hash (duplicate names) are still
+// searched correctly.  'bdlat_NameIndexUtil' is tested through small
+// generated-style types, both directly and through the defaults of
+// 'bdlat_SequenceFunctions' and 'bdlat_ChoiceFunctions' that use it.
+// ----------------------------------------------------------------------------
+// bdlat_NameIndex_Imp
+// [ 2] bool build(...);
+// [ 2] int bucket(Uint64 hash, int numBuckets);
+// [ 2] Uint64 hash(const char *name, int nameLength);
+// [ 2] int slot(Uint64 hash, unsigned int displacement, int numSlots);
+//
+// bdlat_NameIndex
+// [ 3] explicit bdlat_NameIndex(const INFO *infos);
+// [ 3] const INFO *find(const char *name, int nameLength) const;
+// [ 3] bool isPerfect() const;
+//
+// bdlat_NameIndexUtil
+// [ 4] lookupAttributeInfo<TYPE>(const char *name, int nameLength);
+// [ 4] lookupSelectionInfo<TYPE>(const char *name, int nameLength);
+// [ 4] bdlat_SequenceFunctions::manipulateAttribute(o, m, name, len);
+// [ 4] bdlat_SequenceFunctions::hasAttribute(o, name, len);
+// [ 4] bdlat_ChoiceFunctions::makeSelection(o, name, len);
+// [ 4] bdlat_ChoiceFunctions::hasSelection(o, name, len);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE: LINEAR SCAN VS. 'bdlat_NameIndex'
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlat_NameIndex_Imp Imp;
+typedef bsls::Types::Uint64 Uint64;
+
+// ============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+void makeNames(bsl::vector<bsl::string> *names, int numNames, int style)
+    // Load into the specified 'names' the specified 'numNames' distinct names
+    // of the specified 'style': 0 for generated-looking names sharing a long
+    // prefix ("attribute0", "attribute1", ...), 1 for short names of one to
+    // three letters, and 2 for names differing only in their last character
+    // or in case.
+{
+    names->clear();
+
+    for (int i = 0; i < numNames; ++i) {
+        char buffer[64];
+
+        switch (style) {
+          case 0: {
+            bsl::sprintf(buffer, "attribute%d", i);
+          } break;
+          case 1: {
+            int n = i;
+            int k = 0;
+            do {
+                buffer[k++] = static_cast<char>('a' + n % 26);
+                n /= 26;
+            } while (n);
+            buffer[k] = 0;
+          } break;
+          default: {
+            bsl::sprintf(buffer,
+                         "%cameWithCase%c",
+                         i % 2 ? 'N' : 'n',
+                         static_cast<char>(' ' + 1 + (i / 2) % 90));
+            if (i >= 180) {
+                bsl::sprintf(buffer + bsl::strlen(buffer), "%d", i);
+            }
+          } break;
+        }
+        names->push_back(buffer);
+    }
+}
+
+void makeInfos(bsl::vector<bdlat_AttributeInfo> *infos,
+               const bsl::vector<bsl::string>&   names)
+    // Load into the specified 'infos' one attribute info per name in the
+    // specified 'names', with ids '100 + index'.
+{
+    infos->resize(names.size());
+    for (bsl::size_t i = 0; i < names.size(); ++i) {
+        bdlat_AttributeInfo& info = (*infos)[i];
+
+        info.d_id             = static_cast<int>(100 + i);
+        info.d_name_p         = names[i].c_str();
+        info.d_nameLength     = static_cast<int>(names[i].length());
+        info.d_annotation_p   = "";
+        info.d_formattingMode = bdlat_FormattingMode::e_DEFAULT;
+    }
+}
+
+template <int NUM_INFOS>
+void testIndex(const bsl::vector<bsl::string>& names, int line)
+    // Build a 'bdlat_NameIndex' over 'NUM_INFOS' attribute infos having the
+    // specified 'names' and verify every name is found and perturbations of
+    // them are not, reporting failures at the specified 'line'.
+{
+    ASSERTV(line, NUM_INFOS == static_cast<int>(names.size()));
+
+    bsl::vector<bdlat_AttributeInfo> infos;
+    makeInfos(&infos, names);
+
+    const bdlat_NameIndex<bdlat_AttributeInfo, NUM_INFOS> X(&infos[0]);
+
+    ASSERTV(line, NUM_INFOS, X.isPerfect());
+
+    for (int i = 0; i < NUM_INFOS; ++i) {
+        const bsl::string& NAME = names[i];
+        const int          LEN  = static_cast<int>(NAME.length());
+
+        ASSERTV(line, i, NAME, &infos[i] == X.find(NAME.c_str(), LEN));
+
+        // A private copy, so that 'find' cannot rely on pointer identity.
+
+        bsl::string copy(NAME);
+        ASSERTV(line, i, &infos[i] == X.find(copy.data(), LEN));
+
+        // A prefix or an extension of the name is found only if it is itself
+        // indexed.
+
+        if (LEN > 0) {
+            const bdlat_AttributeInfo *info = X.find(copy.data(), LEN - 1);
+            if (info) {
+                ASSERTV(line, i, copy.substr(0, LEN - 1) ==
+                                 bsl::string(info->d_name_p,
+                                             info->d_nameLength));
+            }
+        }
+
+        copy.push_back('x');
+
+        const bdlat_AttributeInfo *info = X.find(copy.data(), LEN + 1);
+        if (info) {
+            ASSERTV(line, i, copy == bsl::string(info->d_name_p,
+                                                 info->d_nameLength));
+        }
+    }
+
+    ASSERTV(line, 0 == X.find("", 0));
+    ASSERTV(line, 0 == X.find("no such attribute", 17));
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                          CLASSES FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace test {
+
+class Record {
+    // This class mimics a generated "sequence" with two attributes, 'a' and
+    // 'b', whose own by-name lookup also accepts the alias "bee" for 'b' and
+    // counts its invocations.
+
+  public:
+    // TYPES
+    enum {
+        ATTRIBUTE_ID_A = 10,
+        ATTRIBUTE_ID_B = 20
+    };
+
+    enum {
+        NUM_ATTRIBUTES = 2
+    };
+
+    enum {
+        ATTRIBUTE_INDEX_A = 0,
+        ATTRIBUTE_INDEX_B = 1
+    };
+
+    // CONSTANTS
+    static const char CLASS_NAME[];
+
+    static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
+
+    // CLASS DATA
+    static int s_numByNameLookups;
+
+    // DATA
+    int d_a;
+    int d_b;
+
+    // TRAITS
+    BSLALG_DECLARE_NESTED_TRAITS(Record, bdlat_TypeTraitBasicSequence);
+
+    // CLASS METHODS
+    static const bdlat_AttributeInfo *lookupAttributeInfo(int id)
+    {
+        switch (id) {
+          case ATTRIBUTE_ID_A:
+            return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_A];          // RETURN
+          case ATTRIBUTE_ID_B:
+            return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_B];          // RETURN
+          default:
+            return 0;                                                 // RETURN
+        }
+    }
+
+    static const bdlat_AttributeInfo *lookupAttributeInfo(
+                                                        const char *name,
+                                                        int         nameLength)
+    {
+        ++s_numByNameLookups;
+
+        if (3 == nameLength && 0 == bsl::memcmp("bee", name, 3)) {
+            return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_B];          // RETURN
+        }
+        for (int i = 0; i < NUM_ATTRIBUTES; ++i) {
+            const bdlat_AttributeInfo& info = ATTRIBUTE_INFO_ARRAY[i];
+            if (nameLength == info.d_nameLength
+             && 0 == bsl::memcmp(info.d_name_p, name, nameLength)) {
+                return &info;                                         // RETURN
+            }
+        }
+        return 0;
+    }
+
+    // CREATORS
+    Record() : d_a(0), d_b(0) {}
+
+    // MANIPULATORS
+    template <class MANIPULATOR>
+    int manipulateAttribute(MANIPULATOR& manipulator, int id)
+    {
+        switch (id) {
+          case ATTRIBUTE_ID_A:
+            return manipulator(&d_a,
+                               ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_A]);
+                                                                      // RETURN
+          case ATTRIBUTE_ID_B:
+            return manipulator(&d_b,
+                               ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_B]);
+                                                                      // RETURN
+          default:
+            return -1;                                                // RETURN
+        }
+    }
+
+    template <class MANIPULATOR>
+    int manipulateAttribute(MANIPULATOR&  manipulator,
+                            const char   *name,
+                            int           nameLength)
+    {
+        const bdlat_AttributeInfo *info = lookupAttributeInfo(name,
+                                                              nameLength);
+        return info ? manipulateAttribute(manipulator, info->d_id) : -1;
+    }
+};
+
+const char Record::CLASS_NAME[] = "Record";
+
+const bdlat_AttributeInfo Record::ATTRIBUTE_INFO_ARRAY[] = {
+    { ATTRIBUTE_ID_A, "a", 1, "", bdlat_FormattingMode::e_DEC },
+    { ATTRIBUTE_ID_B, "b", 1, "", bdlat_FormattingMode::e_DEC }
+};
+
+int Record::s_numByNameLookups = 0;
+
+class Empty {
+    // This class mimics a hand-written "sequence" having no attributes, and
+    // neither the 'NUM_ATTRIBUTES' nor the 'ATTRIBUTE_INFO_ARRAY' member of
+    // generated types.
+
+  public:
+    // CONSTANTS
+    static const char CLASS_NAME[];
+
+    // TRAITS
+    BSLALG_DECLARE_NESTED_TRAITS(Empty, bdlat_TypeTraitBasicSequence);
+
+    // CLASS METHODS
+    static const bdlat_AttributeInfo *lookupAttributeInfo(const char *,
+                                                          int)
+    {
+        return 0;
+    }
+
+    // MANIPULATORS
+    template <class MANIPULATOR>
+    int manipulateAttribute(MANIPULATOR&, int)
+    {
+        return -1;
+    }
+
+    template <class MANIPULATOR>
+    int manipulateAttribute(MANIPULATOR&, const char *, int)
+    {
+        return -1;
+    }
+};
+
+const char Empty::CLASS_NAME[] = "Empty";
+
+class Shape {
+    // This class mimics a generated "choice" with selections "circle" and
+    // "square", whose own by-name lookup counts its invocations.
+
+  public:
+    // TYPES
+    enum {
+        SELECTION_ID_UNDEFINED = -1,
+        SELECTION_ID_CIRCLE    = 0,
+        SELECTION_ID_SQUARE    = 1
+    };
+
+    enum {
+        NUM_SELECTIONS = 2
+    };
+
+    // CONSTANTS
+    static const char CLASS_NAME[];
+
+    static const bdlat_SelectionInfo SELECTION_INFO_ARRAY[];
+
+    // CLASS DATA
+    static int s_numByNameLookups;
+
+    // DATA
+    int d_selectionId;
+
+    // TRAITS
+    BSLALG_DECLARE_NESTED_TRAITS(Shape, bdlat_TypeTraitBasicChoice);
+
+    // CLASS METHODS
+    static const bdlat_SelectionInfo *lookupSelectionInfo(int id)
+    {
+        return 0 <= id && id < NUM_SELECTIONS ? &SELECTION_INFO_ARRAY[id] : 0;
+    }
+
+    static const bdlat_SelectionInfo *lookupSelectionInfo(
+                                                        const char *name,
+                                                        int         nameLength)
+    {
+        ++s_numByNameLookups;
+
+        for (int i = 0; i < NUM_SELECTIONS; ++i) {
+            const bdlat_SelectionInfo& info = SELECTION_INFO_ARRAY[i];
+            if (nameLength == info.d_nameLength
+             && 0 == bsl::memcmp(info.d_name_p, name, nameLength)) {
+                return &info;                                         // RETURN
+            }
+        }
+        return 0;
+    }
+
+    // CREATORS
+    Shape() : d_selectionId(SELECTION_ID_UNDEFINED) {}
+
+    // MANIPULATORS
+    int makeSelection(int id)
+    {
+        if (!lookupSelectionInfo(id)) {
+            return -1;                                                // RETURN
+        }
+        d_selectionId = id;
+        return 0;
+    }
+
+    int makeSelection(const char *name, int nameLength)
+    {
+        const bdlat_SelectionInfo *info = lookupSelectionInfo(name,
+                                                              nameLength);
+        return info ? makeSelection(info->d_id) : -1;
+    }
+};
+
+const char Shape::CLASS_NAME[] = "Shape";
+
+const bdlat_SelectionInfo Shape::SELECTION_INFO_ARRAY[] = {
+    { SELECTION_ID_CIRCLE, "circle", 6, "", bdlat_FormattingMode::e_DEFAULT },
+    { SELECTION_ID_SQUARE, "square", 6, "", bdlat_FormattingMode::e_DEFAULT }
+};
+
+int Shape::s_numByNameLookups = 0;
+
+struct SetValue {
+    // This manipulator sets an 'int' attribute to a value and records the id
+    // of the attribute it was applied to.
+
+    int d_value;
+    int d_id;
+
+    int operator()(int *attribute, const bdlat_AttributeInfo& info)
+    {
+        *attribute = d_value;
+        d_id       = info.d_id;
+        return 0;
+    }
+};
+
+}  // close namespace test
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test        = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool verbose     = argc > 2;
+    bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nUSAGE EXAMPLE"
+                          << "\n=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Looking Up Attributes by Name
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose we have an array of attribute information, as found in a generated
+// sequence type:
+//..
+    const bdlat_AttributeInfo ATTRIBUTES[] = {
+        { 3, "name",   4, "", bdlat_FormattingMode::e_TEXT },
+        { 5, "age",    3, "", bdlat_FormattingMode::e_DEC  },
+        { 8, "salary", 6, "", bdlat_FormattingMode::e_DEC  }
+    };
+//..
+// First, we build an index over the array:
+//..
+    const bdlat_NameIndex<bdlat_AttributeInfo, 3> index(ATTRIBUTES);
+//..
+// Now, we look up attributes by name:
+//..
+    const bdlat_AttributeInfo *info = index.find("salary", 6);
+    ASSERT(&ATTRIBUTES[2] == info);
+    ASSERT(8              == info->d_id);
+//..
+// Finally, we observe that names not in the array are not found:
+//..
+    ASSERT(0 == index.find("sal",    3));
+    ASSERT(0 == index.find("Salary", 6));
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'bdlat_NameIndexUtil'
+        //
+        // Concerns:
+        //: 1 'lookupAttributeInfo' and 'lookupSelectionInfo' return the
+        //:   element of the type's info array having the given name, and 0
+        //:   for other names.
+        //:
+        //: 2 Types lacking the 'NUM_ATTRIBUTES' and 'ATTRIBUTE_INFO_ARRAY'
+        //:   members of generated types are supported.
+        //:
+        //: 3 The default 'bdlat_SequenceFunctions' and 'bdlat_ChoiceFunctions'
+        //:   by-name functions dispatch exact names by id without invoking
+        //:   the type's own by-name lookup.
+        //:
+        //: 4 Names only the type's own lookup recognizes (e.g., aliases) are
+        //:   still accepted, and unknown names are still rejected.
+        //
+        // Plan:
+        //: 1 Look up every name of 'Record' and 'Shape', and some unknown
+        //:   names, directly.  (C-1)
+        //:
+        //: 2 Look up names in 'Empty'.  (C-2)
+        //:
+        //: 3 Manipulate 'Record' attributes and make 'Shape' selections by
+        //:   name, and check the counts of calls to their own lookups.
+        //:   (C-3..4)
+        //
+        // Testing:
+        //   lookupAttributeInfo<TYPE>(const char *name, int nameLength);
+        //   lookupSelectionInfo<TYPE>(const char *name, int nameLength);
+        //   bdlat_SequenceFunctions::manipulateAttribute(o, m, name, len);
+        //   bdlat_SequenceFunctions::hasAttribute(o, name, len);
+        //   bdlat_ChoiceFunctions::makeSelection(o, name, len);
+        //   bdlat_ChoiceFunctions::hasSelection(o, name, len);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'bdlat_NameIndexUtil'"
+                          << "\n=============================" << endl;
+
+        typedef bdlat_NameIndexUtil Util;
+
+        if (verbose) cout << "\nDirect lookup." << endl;
+        {
+            ASSERT(&test::Record::ATTRIBUTE_INFO_ARRAY[0] ==
+                           Util::lookupAttributeInfo<test::Record>("a", 1));
+            ASSERT(&test::Record::ATTRIBUTE_INFO_ARRAY[1] ==
+                           Util::lookupAttributeInfo<test::Record>("b", 1));
+            ASSERT(0 == Util::lookupAttributeInfo<test::Record>("bee", 3));
+            ASSERT(0 == Util::lookupAttributeInfo<test::Record>("A", 1));
+            ASSERT(0 == Util::lookupAttributeInfo<test::Record>("", 0));
+
+            ASSERT(&test::Shape::SELECTION_INFO_ARRAY[1] ==
+                         Util::lookupSelectionInfo<test::Shape>("square", 6));
+            ASSERT(0 == Util::lookupSelectionInfo<test::Shape>("squar", 5));
+
+            ASSERT(0 == Util::lookupAttributeInfo<test::Empty>("a", 1));
+        }
+
+        if (verbose) cout << "\nSequence functions." << endl;
+        {
+            test::Record     mX;
+            test::SetValue   setter = { 7, 0 };
+
+            test::Record::s_numByNameLookups = 0;
+
+            ASSERT(0 == bdlat_SequenceFunctions::manipulateAttribute(&mX,
+                                                                    setter,
+                                                                    "b",
+                                                                    1));
+            ASSERT(7  == mX.d_b);
+            ASSERT(20 == setter.d_id);
+            ASSERT(0  == test::Record::s_numByNameLookups);
+
+            ASSERT(bdlat_SequenceFunctions::hasAttribute(mX, "a", 1));
+            ASSERT(0 == test::Record::s_numByNameLookups);
+
+            setter.d_value = 9;
+            ASSERT(0 == bdlat_SequenceFunctions::manipulateAttribute(&mX,
+                                                                    setter,
+                                                                    "bee",
+                                                                    3));
+            ASSERT(9 == mX.d_b);
+            ASSERT(1 == test::Record::s_numByNameLookups);
+
+            ASSERT(bdlat_SequenceFunctions::hasAttribute(mX, "bee", 3));
+            ASSERT(2 == test::Record::s_numByNameLookups);
+
+            ASSERT(0 != bdlat_SequenceFunctions::manipulateAttribute(&mX,
+                                                                    setter,
+                                                                    "c",
+                                                                    1));
+            ASSERT(!bdlat_SequenceFunctions::hasAttribute(mX, "c", 1));
+            ASSERT(0 == mX.d_a);
+
+            test::Empty mE;
+            ASSERT(0 != bdlat_SequenceFunctions::manipulateAttribute(&mE,
+                                                                    setter,
+                                                                    "a",
+                                                                    1));
+        }
+
+        if (verbose) cout << "\nChoice functions." << endl;
+        {
+            test::Shape mX;
+
+            test::Shape::s_numByNameLookups = 0;
+
+            ASSERT(0 == bdlat_ChoiceFunctions::makeSelection(&mX,
+                                                             "square",
+                                                             6));
+            ASSERT(test::Shape::SELECTION_ID_SQUARE == mX.d_selectionId);
+            ASSERT(bdlat_ChoiceFunctions::hasSelection(mX, "circle", 6));
+            ASSERT(0 == test::Shape::s_numByNameLookups);
+
+            ASSERT(0 != bdlat_ChoiceFunctions::makeSelection(&mX,
+                                                             "oval",
+                                                             4));
+            ASSERT(!bdlat_ChoiceFunctions::hasSelection(mX, "oval", 4));
+            ASSERT(2 == test::Shape::s_numByNameLookups);
+            ASSERT(test::Shape::SELECTION_ID_SQUARE == mX.d_selectionId);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'bdlat_NameIndex'
+        //
+        // Concerns:
+        //: 1 Every name of the indexed array is found, and the address of its
+        //:   element returned, for arrays of any size up to the maximum.
+        //:
+        //: 2 Names that are prefixes or extensions of indexed names, names
+        //:   differing only in case, and unrelated names are not found.
+        //:
+        //: 3 The perfect hash is found for names sharing long prefixes, for
+        //:   very short names, and for names differing in one character.
+        //:
+        //: 4 An array containing duplicate names is still searched correctly
+        //:   (the first duplicate is found) and reports that it is not
+        //:   perfect.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For several sizes and each style of name, build an index and
+        //:   look up every name and perturbations of it.  (C-1..3)
+        //:
+        //: 2 Build an index over an array with duplicate names.  (C-4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for null arguments.  (C-5)
+        //
+        // Testing:
+        //   explicit bdlat_NameIndex(const INFO *infos);
+        //   const INFO *find(const char *name, int nameLength) const;
+        //   bool isPerfect() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'bdlat_NameIndex'"
+                          << "\n=========================" << endl;
+
+        for (int style = 0; style < 3; ++style) {
+            if (veryVerbose) { T_ P(style); }
+
+            bsl::vector<bsl::string> names;
+
+#define TEST_SIZE(N)                                                          \
+            makeNames(&names, N, style);                                      \
+            testIndex<N>(names, L_);
+
+            TEST_SIZE(1);
+            TEST_SIZE(2);
+            TEST_SIZE(3);
+            TEST_SIZE(7);
+            TEST_SIZE(8);
+            TEST_SIZE(9);
+            TEST_SIZE(31);
+            TEST_SIZE(64);
+            TEST_SIZE(100);
+            TEST_SIZE(255);
+            TEST_SIZE(1000);
+            TEST_SIZE(4096);
+#undef TEST_SIZE
+        }
+
+        if (verbose) cout << "\nCase-only differences." << endl;
+        {
+            const bdlat_AttributeInfo INFOS[] = {
+                { 1, "name", 4, "", bdlat_FormattingMode::e_DEFAULT },
+                { 2, "Name", 4, "", bdlat_FormattingMode::e_DEFAULT },
+                { 3, "NAME", 4, "", bdlat_FormattingMode::e_DEFAULT }
+            };
+            const bdlat_NameIndex<bdlat_AttributeInfo, 3> X(INFOS);
+
+            ASSERT(X.isPerfect());
+            ASSERT(&INFOS[0] == X.find("name", 4));
+            ASSERT(&INFOS[1] == X.find("Name", 4));
+            ASSERT(&INFOS[2] == X.find("NAME", 4));
+            ASSERT(0         == X.find("nAME", 4));
+        }
+
+        if (verbose) cout << "\nDuplicate names." << endl;
+        {
+            const bdlat_SelectionInfo INFOS[] = {
+                { 1, "x",   1, "", bdlat_FormattingMode::e_DEFAULT },
+                { 2, "dup", 3, "", bdlat_FormattingMode::e_DEFAULT },
+                { 3, "y",   1, "", bdlat_FormattingMode::e_DEFAULT },
+                { 4, "dup", 3, "", bdlat_FormattingMode::e_DEFAULT }
+            };
+            const bdlat_NameIndex<bdlat_SelectionInfo, 4> X(INFOS);
+
+            ASSERT(!X.isPerfect());
+            ASSERT(&INFOS[0] == X.find("x",   1));
+            ASSERT(&INFOS[1] == X.find("dup", 3));
+            ASSERT(&INFOS[2] == X.find("y",   1));
+            ASSERT(0         == X.find("z",   1));
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const bdlat_AttributeInfo INFOS[] = {
+                { 1, "a", 1, "", bdlat_FormattingMode::e_DEFAULT }
+            };
+
+            ASSERT_FAIL((bdlat_NameIndex<bdlat_AttributeInfo, 1>(0)));
+            ASSERT_PASS((bdlat_NameIndex<bdlat_AttributeInfo, 1>(INFOS)));
+
+            const bdlat_NameIndex<bdlat_AttributeInfo, 1> X(INFOS);
+
+            ASSERT_FAIL(X.find(0, 1));
+            ASSERT_PASS(X.find(0, 0));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'bdlat_NameIndex_Imp'
+        //
+        // Concerns:
+        //: 1 'bucket' and 'slot' return values in range.
+        //:
+        //: 2 'hash' depends on every byte and on the length of the name.
+        //:
+        //: 3 'CeilPowerOf2' computes the smallest power of two not less than
+        //:   its argument.
+        //:
+        //: 4 'build' places every hash in a distinct slot, consistent with
+        //:   'slot' and the displacements it loads, and leaves the other
+        //:   slots empty.
+        //:
+        //: 5 'build' fails on equal hashes.
+        //
+        // Plan:
+        //: 1 Check 'bucket', 'slot', and 'hash' for a set of names.  (C-1..2)
+        //:
+        //: 2 Check 'CeilPowerOf2' for a table of values.  (C-3)
+        //:
+        //: 3 'build' tables for the hashes of many names and verify the
+        //:   resulting slots; repeat with a duplicated hash.  (C-4..5)
+        //
+        // Testing:
+        //   bool build(...);
+        //   int bucket(Uint64 hash, int numBuckets);
+        //   Uint64 hash(const char *name, int nameLength);
+        //   int slot(Uint64 hash, unsigned int displacement, int numSlots);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'bdlat_NameIndex_Imp'"
+                          << "\n=============================" << endl;
+
+        ASSERT(1    == Imp::CeilPowerOf2<0>::e_VALUE);
+        ASSERT(1    == Imp::CeilPowerOf2<1>::e_VALUE);
+        ASSERT(2    == Imp::CeilPowerOf2<2>::e_VALUE);
+        ASSERT(4    == Imp::CeilPowerOf2<3>::e_VALUE);
+        ASSERT(64   == Imp::CeilPowerOf2<64>::e_VALUE);
+        ASSERT(128  == Imp::CeilPowerOf2<65>::e_VALUE);
+        ASSERT(8192 == Imp::CeilPowerOf2<8192>::e_VALUE);
+
+        ASSERT(Imp::hash("ab", 2) != Imp::hash("ba", 2));
+        ASSERT(Imp::hash("ab", 2) != Imp::hash("ab\0", 3));
+        ASSERT(Imp::hash("",   0) != Imp::hash("\0", 1));
+        ASSERT(Imp::hash("abc", 3) == Imp::hash("abcd", 3));
+
+        bsl::vector<bsl::string> names;
+        makeNames(&names, 500, 0);
+
+        bsl::vector<Uint64> hashes;
+        for (bsl::size_t i = 0; i < names.size(); ++i) {
+            const Uint64 H = Imp::hash(names[i].data(),
+                                       static_cast<int>(names[i].length()));
+            hashes.push_back(H);
+
+            ASSERTV(i, 0 <= Imp::bucket(H, 256));
+            ASSERTV(i, Imp::bucket(H, 256) < 256);
+            for (unsigned int d = 0; d < 100; d += 7) {
+                ASSERTV(i, d, 0 <= Imp::slot(H, d, 1024));
+                ASSERTV(i, d, Imp::slot(H, d, 1024) < 1024);
+            }
+        }
+
+        const int NUM_HASHES  = static_cast<int>(hashes.size());
+        const int NUM_BUCKETS = 256;
+        const int NUM_SLOTS   = 1024;
+
+        bsl::vector<unsigned short> displacements(NUM_BUCKETS);
+        bsl::vector<short>          slots(NUM_SLOTS);
+        bsl::vector<short>          scratch(NUM_HASHES + 2 * NUM_BUCKETS);
+
+        ASSERT(Imp::build(&displacements[0],
+                          NUM_BUCKETS,
+                          &slots[0],
+                          NUM_SLOTS,
+                          &hashes[0],
+                          NUM_HASHES,
+                          &scratch[0]));
+
+        bsl::vector<int> seen(NUM_HASHES, 0);
+        int              numOccupied = 0;
+        for (int s = 0; s < NUM_SLOTS; ++s) {
+            if (0 <= slots[s]) {
+                ASSERTV(s, slots[s] < NUM_HASHES);
+                ++seen[slots[s]];
+                ++numOccupied;
+            }
+        }
+        ASSERT(NUM_HASHES == numOccupied);
+
+        for (int i = 0; i < NUM_HASHES; ++i) {
+            const Uint64 H = hashes[i];
+            const int    S = Imp::slot(H,
+                                       displacements[Imp::bucket(H,
+                                                                 NUM_BUCKETS)],
+                                       NUM_SLOTS);
+            ASSERTV(i, 1 == seen[i]);
+            ASSERTV(i, i == slots[S]);
+        }
+
+        hashes[7] = hashes[3];
+        ASSERT(!Imp::build(&displacements[0],
+                           NUM_BUCKETS,
+                           &slots[0],
+                           NUM_SLOTS,
+                           &hashes[0],
+                           NUM_HASHES,
+                           &scratch[0]));
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Index a small array of selection infos and look up its names.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nBREATHING TEST"
+                          << "\n==============" << endl;
+
+        const bdlat_SelectionInfo INFOS[] = {
+            { 0, "red",   3, "", bdlat_FormattingMode::e_DEFAULT },
+            { 1, "green", 5, "", bdlat_FormattingMode::e_DEFAULT },
+            { 2, "blue",  4, "", bdlat_FormattingMode::e_DEFAULT }
+        };
+
+        const bdlat_NameIndex<bdlat_SelectionInfo, 3> X(INFOS);
+
+        ASSERT(X.isPerfect());
+        ASSERT(&INFOS[0] == X.find("red",   3));
+        ASSERT(&INFOS[1] == X.find("green", 5));
+        ASSERT(&INFOS[2] == X.find("blue",  4));
+        ASSERT(0         == X.find("cyan",  4));
+        ASSERT(0         == X.find("gree",  4));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: LINEAR SCAN VS. 'bdlat_NameIndex'
+        //
+        // Concerns:
+        //: 1 Looking up names with 'bdlat_NameIndex' is faster than the
+        //:   linear scan performed by generated types, increasingly so as the
+        //:   number of attributes grows.
+        //
+        // Plan:
+        //: 1 For arrays of generated-looking names of several sizes, time
+        //:   looking up every name with a linear scan and with the index.
+        //
+        // Testing:
+        //   PERFORMANCE: LINEAR SCAN VS. 'bdlat_NameIndex'
+        // --------------------------------------------------------------------
+
+        cout << "\nPERFORMANCE: LINEAR SCAN VS. 'bdlat_NameIndex'"
+             << "\n==============================================" << endl;
+
+        const int TOTAL_LOOKUPS = 20 * 1000 * 1000;
+
+        bsl::vector<bsl::string> names;
+
+#define TIME_SIZE(N)                                                          \
+        {                                                                     \
+            makeNames(&names, N, 0);                                          \
+            bsl::vector<bdlat_AttributeInfo> infos;                           \
+            makeInfos(&infos, names);                                         \
+            const bdlat_NameIndex<bdlat_AttributeInfo, N> X(&infos[0]);       \
+            const int ROUNDS = TOTAL_LOOKUPS / N;                             \
+            int       sum    = 0;                                             \
+            bsls::Stopwatch linear;                                           \
+            linear.start(true);                                               \
+            for (int r = 0; r < ROUNDS; ++r) {                                \
+                for (int i = 0; i < N; ++i) {                                 \
+                    const char *name = names[i].data();                       \
+                    const int   len  = static_cast<int>(names[i].length());   \
+                    for (int j = 0; j < N; ++j) {                             \
+                        if (len == infos[j].d_nameLength &&                   \
+                            0 == bsl::memcmp(infos[j].d_name_p, name, len)) { \
+                            sum += infos[j].d_id;                             \
+                            break;                                            \
+                        }                                                     \
+                    }                                                         \
+                }                                                             \
+            }                                                                 \
+            linear.stop();                                                    \
+            bsls::Stopwatch indexed;                                          \
+            indexed.start(true);                                              \
+            for (int r = 0; r < ROUNDS; ++r) {                                \
+                for (int i = 0; i < N; ++i) {                                 \
+                    sum -= X.find(names[i].data(),                            \
+                                  static_cast<int>(names[i].length()))->d_id; \
+                }                                                             \
+            }                                                                 \
+            indexed.stop();                                                   \
+            ASSERT(0 == sum);                                                 \
+            cout << "attributes: " << N                                       \
+                 << "\tlinear: " << linear.accumulatedUserTime()              \
+                 << "s\tindexed: " << indexed.accumulatedUserTime() << "s"    \
+                 << endl;                                                     \
+        }
+
+        TIME_SIZE(4);
+        TIME_SIZE(16);
+        TIME_SIZE(64);
+        TIME_SIZE(128);
+        TIME_SIZE(256);
+#undef TIME_SIZE
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -40,7 +40,10 @@ BSLS_IDENT("$Id: $")
 // behavior through the 'bdlat_SequenceFunctions' 'namespace'.
 //
 // This component specializes all of these functions for types that have the
-// 'bdlat_TypeTraitBasicSequence' trait.
+// 'bdlat_TypeTraitBasicSequence' trait.  For such types, attributes are looked
+// up by name through a perfect-hash index of the type's
+// 'ATTRIBUTE_INFO_ARRAY' (see 'bdlat_nameindex') before deferring to the
+// type's own lookup.
 //
 // Types that do not have the 'bdlat_TypeTraitBasicSequence' trait can be
 // plugged into the 'bdlat' framework.  This is done by overloading the
@@ -583,6 +586,7 @@ BSLS_IDENT("$Id: $")
 #include <bdlscm_version.h>
 
 #include <bdlat_bdeatoverrides.h>
+#include <bdlat_nameindex.h>
 #include <bdlat_typetraits.h>
 
 #include <bslalg_hastrait.h>
@@ -933,6 +937,15 @@ int bdlat_SequenceFunctions::bdlat_sequenceManipulateAttribute(
     BSLMF_ASSERT(
                 (bslalg::HasTrait<TYPE, bdlat_TypeTraitBasicSequence>::VALUE));
 
+    const bdlat_AttributeInfo *info =
+                     bdlat_NameIndexUtil::lookupAttributeInfo<TYPE>(
+                                                          attributeName,
+                                                          attributeNameLength);
+    if (info) {
+        return object->manipulateAttribute(manipulator, info->d_id);
+                                                                      // RETURN
+    }
+
     return object->manipulateAttribute(manipulator,
                                        attributeName,
                                        attributeNameLength);
@@ -1020,7 +1033,10 @@ bool bdlat_SequenceFunctions::bdlat_sequenceHasAttribute(
     BSLMF_ASSERT(
                 (bslalg::HasTrait<TYPE, bdlat_TypeTraitBasicSequence>::VALUE));
 
-    return 0 != object.lookupAttributeInfo(attributeName, attributeNameLength);
+    return 0 != bdlat_NameIndexUtil::lookupAttributeInfo<TYPE>(
+                                                          attributeName,
+                                                          attributeNameLength)
+        || 0 != object.lookupAttributeInfo(attributeName, attributeNameLength);
 }
 
 template <class TYPE>
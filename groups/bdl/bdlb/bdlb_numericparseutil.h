@@ -97,6 +97,16 @@ BSLS_IDENT("$Id: $")
 // the standard library function 'strtod'.  For example, the ASCII string
 // "3.14159" is converted, on some platforms, to 3.1415899999999999.
 //
+///Parsing Delimited Sequences
+///----------------------------
+// The 'parse*Array' functions parse a sequence of numbers separated by a
+// delimiter character, such as a column of a CSV file, appending the values
+// to a 'bsl::vector'.  Each field between delimiters is parsed exactly as by
+// the corresponding single-value function, and must consist entirely of the
+// number.  On failure, the 'remainder' starts at the position at which the
+// failure was detected, and the vector holds the values of the preceding
+// fields.
+//
 ///Special Floating Point Values
 ///- - - - - - - - - - - - - - -
 // The IEEE-754 (double precision) floating point format supports the following
@@ -162,6 +172,7 @@ BSLS_IDENT("$Id: $")
 #include <bsls_types.h>
 
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 namespace BloombergLP {
 
@@ -469,6 +480,81 @@ struct NumericParseUtil {
         //   2. The first digit in 'inputString' is larger than 'maxValue'.
         //   3. The first digit is not a valid number for the 'base'.
         //..
+
+    static int parseDoubleArray(bsl::vector<double>      *result,
+                                const bslstl::StringRef&  inputString,
+                                char                      delimiter);
+    static int parseDoubleArray(bsl::vector<double>      *result,
+                                bslstl::StringRef        *remainder,
+                                const bslstl::StringRef&  inputString,
+                                char                      delimiter);
+        // Parse the specified 'inputString' as a sequence of zero or more
+        // fields separated by the specified 'delimiter', each consisting of a
+        // <DOUBLE> (see {GRAMMAR PRODUCTION RULES}), and append to the
+        // specified 'result' the corresponding values.  Optionally specify
+        // 'remainder', in which to store the (empty) remainder of the
+        // 'inputString' on success, or the remainder starting at the position
+        // at which a parse failure was detected.  Return zero on success, and
+        // a non-zero value otherwise.  On failure, 'result' holds the values
+        // of the fields preceding the one that failed.  The behavior is
+        // undefined unless the current locale is the "C" locale.  See
+        // {Parsing Delimited Sequences}.
+
+    static int parseIntArray(bsl::vector<int>         *result,
+                             const bslstl::StringRef&  inputString,
+                             char                      delimiter,
+                             int                       base = 10);
+    static int parseIntArray(bsl::vector<int>         *result,
+                             bslstl::StringRef        *remainder,
+                             const bslstl::StringRef&  inputString,
+                             char                      delimiter,
+                             int                       base = 10);
+    static int parseInt64Array(
+                         bsl::vector<bsls::Types::Int64>  *result,
+                         const bslstl::StringRef&          inputString,
+                         char                              delimiter,
+                         int                               base = 10);
+    static int parseInt64Array(
+                         bsl::vector<bsls::Types::Int64>  *result,
+                         bslstl::StringRef                *remainder,
+                         const bslstl::StringRef&          inputString,
+                         char                              delimiter,
+                         int                               base = 10);
+    static int parseUintArray(bsl::vector<unsigned int> *result,
+                              const bslstl::StringRef&   inputString,
+                              char                       delimiter,
+                              int                        base = 10);
+    static int parseUintArray(bsl::vector<unsigned int> *result,
+                              bslstl::StringRef         *remainder,
+                              const bslstl::StringRef&   inputString,
+                              char                       delimiter,
+                              int                        base = 10);
+    static int parseUint64Array(
+                         bsl::vector<bsls::Types::Uint64> *result,
+                         const bslstl::StringRef&          inputString,
+                         char                              delimiter,
+                         int                               base = 10);
+    static int parseUint64Array(
+                         bsl::vector<bsls::Types::Uint64> *result,
+                         bslstl::StringRef                *remainder,
+                         const bslstl::StringRef&          inputString,
+                         char                              delimiter,
+                         int                               base = 10);
+        // Parse the specified 'inputString' as a sequence of zero or more
+        // fields separated by the specified 'delimiter', each consisting of
+        // an <INT>, <INT64>, <UNSIGNED>, or <UNSIGNED64> respectively (see
+        // {GRAMMAR PRODUCTION RULES}) in the optionally specified 'base' or
+        // in base 10 if 'base' is not specified, and append to the specified
+        // 'result' the corresponding values.  Optionally specify 'remainder',
+        // in which to store the (empty) remainder of the 'inputString' on
+        // success, or the remainder starting at the position at which a parse
+        // failure was detected.  Return zero on success, and a non-zero value
+        // otherwise.  On failure, 'result' holds the values of the fields
+        // preceding the one that failed.  The behavior is undefined unless
+        // '2 <= base' and 'base <= 36'.  Note that a field holding a number
+        // outside the range of the element type is a parse failure, with
+        // 'remainder' starting at the first digit that would make the number
+        // too large or small.  See {Parsing Delimited Sequences}.
 };
 
 // ============================================================================
@@ -605,6 +691,56 @@ int NumericParseUtil::parseUnsignedInteger(
                                 maxNumDigits);
 }
 
+inline
+int NumericParseUtil::parseDoubleArray(bsl::vector<double>      *result,
+                                       const bslstl::StringRef&  inputString,
+                                       char                      delimiter)
+{
+    bslstl::StringRef rest;
+    return parseDoubleArray(result, &rest, inputString, delimiter);
+}
+
+inline
+int NumericParseUtil::parseIntArray(bsl::vector<int>         *result,
+                                    const bslstl::StringRef&  inputString,
+                                    char                      delimiter,
+                                    int                       base)
+{
+    bslstl::StringRef rest;
+    return parseIntArray(result, &rest, inputString, delimiter, base);
+}
+
+inline
+int NumericParseUtil::parseInt64Array(
+                                 bsl::vector<bsls::Types::Int64> *result,
+                                 const bslstl::StringRef&         inputString,
+                                 char                             delimiter,
+                                 int                              base)
+{
+    bslstl::StringRef rest;
+    return parseInt64Array(result, &rest, inputString, delimiter, base);
+}
+
+inline
+int NumericParseUtil::parseUintArray(bsl::vector<unsigned int> *result,
+                                     const bslstl::StringRef&   inputString,
+                                     char                       delimiter,
+                                     int                        base)
+{
+    bslstl::StringRef rest;
+    return parseUintArray(result, &rest, inputString, delimiter, base);
+}
+
+inline
+int NumericParseUtil::parseUint64Array(
+                                bsl::vector<bsls::Types::Uint64> *result,
+                                const bslstl::StringRef&          inputString,
+                                char                              delimiter,
+                                int                               base)
+{
+    bslstl::StringRef rest;
+    return parseUint64Array(result, &rest, inputString, delimiter, base);
+}
 
 }  // close package namespace
 }  // close enterprise namespace
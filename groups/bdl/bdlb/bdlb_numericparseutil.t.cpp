@@ -6,6 +6,7 @@
 #include <bslma_testallocator.h>           // for testing only
 
 #include <bsls_platform.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bslim_testutil.h>
@@ -72,8 +73,20 @@ using namespace bdlb;
 // [ 9] parseShort(result, input, base = 10)
 // [10] parseUshort(result, rest, input, base = 10)
 // [10] parseUshort(result, input, base = 10)
+// [12] parseDoubleArray(result, rest, input, delimiter)
+// [12] parseDoubleArray(result, input, delimiter)
+// [12] parseIntArray(result, rest, input, delimiter, base = 10)
+// [12] parseIntArray(result, input, delimiter, base = 10)
+// [12] parseInt64Array(result, rest, input, delimiter, base = 10)
+// [12] parseInt64Array(result, input, delimiter, base = 10)
+// [12] parseUintArray(result, rest, input, delimiter, base = 10)
+// [12] parseUintArray(result, input, delimiter, base = 10)
+// [12] parseUint64Array(result, rest, input, delimiter, base = 10)
+// [12] parseUint64Array(result, input, delimiter, base = 10)
 //-----------------------------------------------------------------------------
-// [11] USAGE EXAMPLE
+// [11] CONCERN: FAST PATHS MATCH THE DIGIT-BY-DIGIT AND 'strtod' RESULTS
+// [13] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
 
 // ============================================================================
 //                     STANDARD BSL ASSERT TEST FUNCTION
@@ -145,6 +158,97 @@ int doubleSign(double number)
     return bytes[pos] & 0x80;
 }
 
+class RandomGenerator {
+    // This class provides a deterministic sequence of pseudo-random numbers.
+
+    // DATA
+    Uint64 d_state;
+
+  public:
+    // CREATORS
+    explicit RandomGenerator(Uint64 seed) : d_state(seed) {}
+        // Create a generator whose sequence is determined by the specified
+        // 'seed'.
+
+    // MANIPULATORS
+    unsigned next(unsigned limit)
+        // Return the next number in the sequence, in the range
+        // '[0 .. limit - 1]'.
+    {
+        d_state = d_state * 6364136223846793005ULL + 1442695040888963407ULL;
+        return static_cast<unsigned>((d_state >> 33) % limit);
+    }
+};
+
+static
+int referenceParseUnsigned(Uint64             *result,
+                           bsl::size_t        *numConsumed,
+                           const bsl::string&  input,
+                           Uint64              maxValue,
+                           int                 maxNumDigits)
+    // Parse the specified 'input' as a decimal number digit by digit,
+    // consuming at most the specified 'maxNumDigits' digits while the value
+    // does not exceed the specified 'maxValue'.  Load the value into the
+    // specified 'result' and the number of digits consumed into the specified
+    // 'numConsumed' and return 0, or return a non-zero value if 'input' does
+    // not start with a digit.  Note that, as does 'parseUnsignedInteger', at
+    // most one digit is consumed if 'maxValue' is less than 10.
+{
+    if (input.empty() || input[0] < '0' || '9' < input[0]) {
+        return -1;                                                    // RETURN
+    }
+
+    if (maxValue < 10) {
+        maxNumDigits = bsl::min(maxNumDigits, 1);
+    }
+
+    Uint64      value = 0;
+    bsl::size_t i     = 0;
+    while (i < input.size()
+        && static_cast<int>(i) < maxNumDigits
+        && '0' <= input[i] && input[i] <= '9') {
+        const Uint64 digit = input[i] - '0';
+        if (digit > maxValue || value > (maxValue - digit) / 10) {
+            break;
+        }
+        value = value * 10 + digit;
+        ++i;
+    }
+    *result      = value;
+    *numConsumed = i;
+    return 0;
+}
+
+static
+bool sameDouble(double lhs, double rhs)
+    // Return 'true' if the specified 'lhs' and 'rhs' have the same object
+    // representation, and 'false' otherwise.
+{
+    return 0 == bsl::memcmp(&lhs, &rhs, sizeof lhs);
+}
+
+static
+void checkParseDouble(int line, const bsl::string& input)
+    // Verify that 'parseDouble' produces the same value, and consumes the same
+    // characters of the specified 'input', as 'strtod', reporting failures
+    // using the specified 'line'.
+{
+    char         *end;
+    const double  expected   = strtod(input.c_str(), &end);
+    const int     expectedRc = end == input.c_str() ? 1 : 0;
+
+    double            value = 7.0;
+    bslstl::StringRef rest;
+    const int rc = NumericParseUtil::parseDouble(&value, &rest, input);
+
+    ASSERTV(line, input, expectedRc == (0 != rc));
+    if (0 == rc && 0 == expectedRc) {
+        ASSERTV(line, input, value, expected, sameDouble(value, expected));
+        ASSERTV(line, input, rest, end == input.c_str() + (rest.data()
+                                                        - input.data()));
+    }
+}
+
 //=============================================================================
 //                              MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -163,7 +267,7 @@ int main(int argc, char *argv[])
     using bslstl::StringRef;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 11: {
+      case 13: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -209,6 +313,396 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // TESTING PARSING DELIMITED SEQUENCES
+        //
+        // Concerns:
+        //: 1 Each field is parsed as by the corresponding single-value
+        //:   function, and the values are appended to the vector in order.
+        //:
+        //: 2 An empty input yields no values and succeeds.
+        //:
+        //: 3 An empty field, trailing characters in a field, and an
+        //:   out-of-range value are failures, and 'remainder' starts at the
+        //:   position of the failure in the input.
+        //:
+        //: 4 The values of the fields preceding a failure are appended.
+        //:
+        //: 5 The optional 'base' is honored.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, parse inputs with each
+        //:   function and verify the status, the values, and the offset of
+        //:   'remainder'.  (C-1..5)
+        //
+        // Testing:
+        //   parseDoubleArray(result, rest, input, delimiter)
+        //   parseDoubleArray(result, input, delimiter)
+        //   parseIntArray(result, rest, input, delimiter, base = 10)
+        //   parseIntArray(result, input, delimiter, base = 10)
+        //   parseInt64Array(result, rest, input, delimiter, base = 10)
+        //   parseInt64Array(result, input, delimiter, base = 10)
+        //   parseUintArray(result, rest, input, delimiter, base = 10)
+        //   parseUintArray(result, input, delimiter, base = 10)
+        //   parseUint64Array(result, rest, input, delimiter, base = 10)
+        //   parseUint64Array(result, input, delimiter, base = 10)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING PARSING DELIMITED SEQUENCES" << endl
+                          << "===================================" << endl;
+
+        if (verbose) cout << "\nTesting 'parseIntArray'." << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_input;
+                char        d_delimiter;
+                int         d_base;
+                bool        d_success;
+                int         d_numValues;
+                int         d_values[4];
+                int         d_offset;    // of 'remainder'
+            } DATA[] = {
+              //LN  INPUT              DEL  B  OK  N  VALUES           OFF
+              //--  -----------------  ---  -- --  -  ---------------  ---
+              { L_, "",                ',', 10, 1, 0, { 0 },             0 },
+              { L_, "0",               ',', 10, 1, 1, { 0 },             1 },
+              { L_, "1,-2,+3",         ',', 10, 1, 3, { 1, -2, 3 },      7 },
+              { L_, "1;2;3;4",         ';', 10, 1, 4, { 1, 2, 3, 4 },    7 },
+              { L_, "ff,-10",          ',', 16, 1, 2, { 255, -16 },      6 },
+              { L_, "1,2,",            ',', 10, 0, 2, { 1, 2 },          4 },
+              { L_, ",1",              ',', 10, 0, 0, { 0 },             0 },
+              { L_, "1,,2",            ',', 10, 0, 1, { 1 },             2 },
+              { L_, "1,2x,3",          ',', 10, 0, 1, { 1 },             3 },
+              { L_, "1,-,3",           ',', 10, 0, 1, { 1 },             3 },
+              { L_, "1, 2",            ',', 10, 0, 1, { 1 },             2 },
+              { L_, "2147483647,1",    ',', 10, 1, 2, { INT_MAX, 1 },   12 },
+              { L_, "-2147483648",     ',', 10, 1, 1, { INT_MIN },      11 },
+              { L_, "5,2147483648",    ',', 10, 0, 1, { 5 },            11 },
+              { L_, "12345678901234",  ',', 10, 0, 0, { 0 },            10 },
+              { L_, "1,2",             ';', 10, 0, 0, { 0 },             1 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int   LINE = DATA[ti].d_line;
+                const char *INPUT = DATA[ti].d_input;
+
+                bsl::vector<int>  values(1, 99);
+                bslstl::StringRef rest;
+                const int         rc = NumericParseUtil::parseIntArray(
+                                                          &values,
+                                                          &rest,
+                                                          INPUT,
+                                                          DATA[ti].d_delimiter,
+                                                          DATA[ti].d_base);
+
+                ASSERTV(LINE, rc, DATA[ti].d_success == (0 == rc));
+                ASSERTV(LINE, values.size(),
+                        DATA[ti].d_numValues + 1 == (int)values.size());
+                ASSERTV(LINE, 99 == values[0]);
+                for (int i = 0; i < DATA[ti].d_numValues
+                             && i + 1 < (int)values.size(); ++i) {
+                    ASSERTV(LINE, i, values[i + 1],
+                            DATA[ti].d_values[i] == values[i + 1]);
+                }
+                ASSERTV(LINE, rest, DATA[ti].d_offset == rest.data() - INPUT);
+                ASSERTV(LINE, rest,
+                        (int)bsl::strlen(INPUT) - DATA[ti].d_offset
+                                                       == (int)rest.length());
+
+                bsl::vector<int> values2;
+                ASSERTV(LINE, rc == NumericParseUtil::parseIntArray(
+                                                      &values2,
+                                                      INPUT,
+                                                      DATA[ti].d_delimiter,
+                                                      DATA[ti].d_base));
+                ASSERTV(LINE, bsl::equal(values2.begin(),
+                                         values2.end(),
+                                         values.begin() + 1));
+            }
+        }
+
+        if (verbose) cout << "\nTesting the other integer types." << endl;
+        {
+            bsl::vector<Int64>        int64s;
+            bsl::vector<unsigned int> uints;
+            bsl::vector<Uint64>       uint64s;
+            bslstl::StringRef         rest;
+
+            const char *INPUT = "9223372036854775807|-9223372036854775808|0";
+
+            ASSERT(0 == NumericParseUtil::parseInt64Array(&int64s,
+                                                          &rest,
+                                                          INPUT,
+                                                          '|'));
+            ASSERT(3 == int64s.size());
+            ASSERT(bsl::numeric_limits<Int64>::max() == int64s[0]);
+            ASSERT(bsl::numeric_limits<Int64>::min() == int64s[1]);
+            ASSERT(0 == int64s[2]);
+            ASSERT(rest.empty());
+
+            ASSERT(0 != NumericParseUtil::parseUint64Array(&uint64s,
+                                                           &rest,
+                                                           INPUT,
+                                                           '|'));
+            ASSERT(1 == uint64s.size());
+            ASSERT(9223372036854775807ULL == uint64s[0]);
+            ASSERT(INPUT + 20 == rest.data());
+
+            ASSERT(0 == NumericParseUtil::parseUintArray(&uints,
+                                                         "4294967295 +7 11",
+                                                         ' '));
+            ASSERT(3 == uints.size());
+            ASSERT(UINT_MAX == uints[0]);
+            ASSERT(7 == uints[1]);
+            ASSERT(11 == uints[2]);
+
+            uints.clear();
+            ASSERT(0 == NumericParseUtil::parseUintArray(&uints,
+                                                         "777,10",
+                                                         ',',
+                                                         8));
+            ASSERT(2 == uints.size());
+            ASSERT(511 == uints[0]);
+            ASSERT(8 == uints[1]);
+
+            uint64s.clear();
+            ASSERT(0 == NumericParseUtil::parseUint64Array(
+                                            &uint64s,
+                                            "18446744073709551615,00000001",
+                                            ','));
+            ASSERT(2 == uint64s.size());
+            ASSERT(bsl::numeric_limits<Uint64>::max() == uint64s[0]);
+            ASSERT(1 == uint64s[1]);
+        }
+
+        if (verbose) cout << "\nTesting 'parseDoubleArray'." << endl;
+        {
+            bsl::vector<double> values;
+            bslstl::StringRef   rest;
+
+            const char *INPUT = "1.5,-2e3,.25,inf,0x10,-0";
+
+            ASSERT(0 == NumericParseUtil::parseDoubleArray(&values,
+                                                           &rest,
+                                                           INPUT,
+                                                           ','));
+            ASSERT(6 == values.size());
+            ASSERT(1.5   == values[0]);
+            ASSERT(-2000 == values[1]);
+            ASSERT(0.25  == values[2]);
+            ASSERT(bsl::numeric_limits<double>::infinity() == values[3]);
+            ASSERT(16    == values[4]);
+            ASSERT(sameDouble(-0.0, values[5]));
+            ASSERT(rest.empty());
+
+            values.clear();
+            INPUT = "1\t2.5e\t3";
+            ASSERT(0 != NumericParseUtil::parseDoubleArray(&values,
+                                                           &rest,
+                                                           INPUT,
+                                                           '\t'));
+            ASSERT(1 == values.size());
+            ASSERT(INPUT + 5 == rest.data());
+
+            values.clear();
+            INPUT = "1,x";
+            ASSERT(0 != NumericParseUtil::parseDoubleArray(&values,
+                                                           &rest,
+                                                           INPUT,
+                                                           ','));
+            ASSERT(1 == values.size());
+            ASSERT(INPUT + 2 == rest.data());
+
+            values.clear();
+            ASSERT(0 == NumericParseUtil::parseDoubleArray(&values, "", ','));
+            ASSERT(values.empty());
+        }
+      } break;
+      case 11: {
+        // --------------------------------------------------------------------
+        // TESTING FAST PATHS
+        //
+        // Concerns:
+        //: 1 Parsing decimal integers several digits at a time consumes the
+        //:   same digits, and produces the same value, as parsing digit by
+        //:   digit, for any 'maxValue' and 'maxNumDigits', including when
+        //:   the limit is reached within a group of digits.
+        //:
+        //: 2 'parseDouble' produces the same value as 'strtod' and consumes
+        //:   the same characters, including for halfway cases, values near
+        //:   the limits of 'double', long digit sequences, and text only
+        //:   partially forming a number.
+        //
+        // Plan:
+        //: 1 Compare 'parseUnsignedInteger' with a digit-by-digit reference
+        //:   for strings of digits of varied lengths, with varied suffixes,
+        //:   against varied limits.  (C-1)
+        //:
+        //: 2 Compare 'parseDouble' with 'strtod' for a table of difficult
+        //:   inputs and for pseudo-random decimal strings.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: FAST PATHS MATCH THE DIGIT-BY-DIGIT AND 'strtod' RESULTS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING FAST PATHS" << endl
+                          << "==================" << endl;
+
+        RandomGenerator random(12345);
+
+        if (verbose) cout << "\nTesting integers." << endl;
+        {
+            static const Uint64 MAX_VALUES[] = {
+                0, 9, 10, 0xFFFF, 99999999ULL, 100000000ULL, 0x7FFFFFFFULL,
+                0xFFFFFFFFULL, 1234567890123456789ULL, 0x8000000000000000ULL,
+                0xFFFFFFFFFFFFFFFFULL
+            };
+            const int NUM_MAX_VALUES = sizeof MAX_VALUES / sizeof *MAX_VALUES;
+
+            static const char *const SUFFIXES[] = { "", "x", "/", ":", " 1" };
+            const int NUM_SUFFIXES = sizeof SUFFIXES / sizeof *SUFFIXES;
+
+            for (int iteration = 0; iteration < 20000; ++iteration) {
+                bsl::string input;
+
+                const int numDigits = 1 + random.next(40);
+                const int numZeros  = random.next(4) ? 0 : random.next(12);
+                input.append(numZeros, '0');
+                for (int i = 0; i < numDigits; ++i) {
+                    input.push_back(static_cast<char>(
+                                                   '0' + (random.next(5)
+                                                          ? random.next(10)
+                                                          : 9)));
+                }
+                input.append(SUFFIXES[random.next(NUM_SUFFIXES)]);
+
+                const Uint64 MAX = MAX_VALUES[random.next(NUM_MAX_VALUES)];
+
+                Uint64            value = 0, expected = 0;
+                bsl::size_t       numConsumed = 0;
+                bslstl::StringRef rest;
+
+                ASSERT(0 == referenceParseUnsigned(&expected,
+                                                   &numConsumed,
+                                                   input,
+                                                   MAX,
+                                                   INT_MAX));
+                ASSERTV(input, MAX, 0 == NumericParseUtil::
+                                                   parseUnsignedInteger(&value,
+                                                                        &rest,
+                                                                        input,
+                                                                        10,
+                                                                        MAX));
+                ASSERTV(input, MAX, value, expected, value == expected);
+                ASSERTV(input, MAX, rest,
+                        numConsumed == (bsl::size_t)(rest.data()
+                                                          - input.data()));
+
+                const int MAX_DIGITS = random.next(30);
+
+                ASSERT(0 == referenceParseUnsigned(&expected,
+                                                   &numConsumed,
+                                                   input,
+                                                   MAX,
+                                                   MAX_DIGITS));
+                ASSERTV(input, MAX, 0 == NumericParseUtil::
+                                             parseUnsignedInteger(&value,
+                                                                  &rest,
+                                                                  input,
+                                                                  10,
+                                                                  MAX,
+                                                                  MAX_DIGITS));
+                ASSERTV(input, MAX, MAX_DIGITS, value, expected,
+                        value == expected);
+                ASSERTV(input, MAX, MAX_DIGITS, rest,
+                        numConsumed == (bsl::size_t)(rest.data()
+                                                          - input.data()));
+            }
+        }
+
+        if (verbose) cout << "\nTesting difficult doubles." << endl;
+        {
+            static const char *const DATA[] = {
+                "0", "-0", "+0", "0.0", "-0.000e10", "0e999999999999",
+                "1", "1.", ".5", "-.5", ".", "-.", "+", "-", "e5", ".e5",
+                "1e", "1e+", "1e-", "1e+x", "1e5x", "1.5E-3", "1.5e+003",
+                "0x1p3", "0X10", "-0x1.8p1", "0xg", "00x1",
+                "inf", "-Infinity", "nan", "-nan(123)",
+                "0.1", "0.2", "0.3", "3.14159", "123.456", "1e23", "8e22",
+                "9007199254740992", "9007199254740993", "9007199254740994",
+                "9007199254740995", "18014398509481985",
+                "2.2250738585072014e-308", "2.2250738585072011e-308",
+                "2.2250738585072012e-308", "4.9e-324", "5e-324", "2e-324",
+                "1e-320", "1e-400", "1.7976931348623157e308",
+                "1.7976931348623158e308", "1.7976931348623159e308",
+                "1e308", "1e309", "1e400",
+                "9999999999999999999", "10000000000000000000",
+                "18446744073709551615", "18446744073709551616",
+                "123456789012345678901234567890",
+                "0.000000000000000000000000000001234567890123456789",
+                "00000000000000000000000000001.5",
+                "1.00000000000000011102230246251565404236316680908203125",
+                "1.00000000000000011102230246251565404236316680908203124",
+                "1.00000000000000011102230246251565404236316680908203126",
+                "7.2057594037927933e16", "2.4703282292062327e-324",
+                "1e-342", "1e-343", "5e-343", "9.999999999999999e-343",
+                "1e-22", "1e22", "1e-27", "1e55", "1e56", "4.35e-7",
+                "12345678.90123456789", "1234567890123456789e-10",
+                "0.0000000000000000000000000000000000000001",
+                "17976931348623157e292", "2.225073858507201136057409e-308",
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                checkParseDouble(L_, DATA[ti]);
+                checkParseDouble(L_, bsl::string(DATA[ti]) + ",1");
+                checkParseDouble(L_, bsl::string("-") + DATA[ti]);
+            }
+        }
+
+        if (verbose) cout << "\nTesting random doubles." << endl;
+        {
+            static const char *const SUFFIXES[] = {
+                "", ",", "e", "e+", "x", ".", "5"
+            };
+            const int NUM_SUFFIXES = sizeof SUFFIXES / sizeof *SUFFIXES;
+
+            for (int iteration = 0; iteration < 200000; ++iteration) {
+                bsl::string input;
+                if (random.next(2)) {
+                    input.push_back(random.next(2) ? '-' : '+');
+                }
+
+                const int numDigits = 1 + random.next(22);
+                const int point     = random.next(numDigits + 2);
+                for (int i = 0; i < numDigits; ++i) {
+                    if (i == point) {
+                        input.push_back('.');
+                    }
+                    input.push_back(static_cast<char>('0' + random.next(10)));
+                }
+
+                if (random.next(3)) {
+                    input.push_back(random.next(2) ? 'e' : 'E');
+                    const int exponent = static_cast<int>(random.next(700))
+                                                                       - 350;
+                    bsl::ostringstream stream;
+                    stream << exponent;
+                    input.append(stream.str());
+                }
+                if (0 == random.next(4)) {
+                    input.append(SUFFIXES[random.next(NUM_SUFFIXES)]);
+                }
+
+                checkParseDouble(L_, input);
+            }
+        }
+      } break;
       case 10: {
         // --------------------------------------------------------------------
         // TESTING PARSE USHORT
@@ -2878,6 +3372,159 @@ int main(int argc, char *argv[])
             }
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Parsing decimal integers and doubles is fast, both one at a time
+        //:   and as a delimited sequence.
+        //
+        // Plan:
+        //: 1 Time parsing a comma-separated column of integers and of prices
+        //:   with the single-value functions, the array functions, and the C
+        //:   library functions.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE TEST" << endl
+             << "================" << endl;
+
+        const int   NUM_VALUES = 1000000;
+        const int   ITERATIONS = 10;
+        bsl::string integers, prices;
+
+        RandomGenerator random(1);
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            bsl::ostringstream stream;
+            stream << (static_cast<Int64>(random.next(1000000000)) * 1000
+                       + random.next(1000));
+            integers.append(stream.str());
+            integers.push_back(',');
+
+            stream.str("");
+            stream << random.next(10000) << '.'
+                   << static_cast<char>('0' + random.next(10))
+                   << static_cast<char>('0' + random.next(10));
+            prices.append(stream.str());
+            prices.push_back(',');
+        }
+        integers.resize(integers.size() - 1);
+        prices.resize(prices.size() - 1);
+
+        bsls::Stopwatch timer;
+        Int64           sum = 0;
+
+        timer.start();
+        for (int iteration = 0; iteration < ITERATIONS; ++iteration) {
+            const char *p = integers.c_str();
+            for (;;) {
+                char *end;
+                sum += strtoll(p, &end, 10);
+                if (!*end) {
+                    break;
+                }
+                p = end + 1;
+            }
+        }
+        timer.stop();
+        cout << "strtoll:         "
+             << timer.elapsedTime() / ITERATIONS / NUM_VALUES * 1e9
+             << " ns/value" << endl;
+
+        timer.reset();
+        timer.start();
+        for (int iteration = 0; iteration < ITERATIONS; ++iteration) {
+            bslstl::StringRef rest(integers);
+            for (;;) {
+                Int64 value;
+                NumericParseUtil::parseInt64(&value, &rest, rest);
+                sum += value;
+                if (rest.empty()) {
+                    break;
+                }
+                rest.assign(rest.data() + 1, rest.length() - 1);
+            }
+        }
+        timer.stop();
+        cout << "parseInt64:      "
+             << timer.elapsedTime() / ITERATIONS / NUM_VALUES * 1e9
+             << " ns/value" << endl;
+
+        timer.reset();
+        timer.start();
+        for (int iteration = 0; iteration < ITERATIONS; ++iteration) {
+            bsl::vector<Int64> values;
+            ASSERT(0 == NumericParseUtil::parseInt64Array(&values,
+                                                          integers,
+                                                          ','));
+            sum += values.back();
+        }
+        timer.stop();
+        cout << "parseInt64Array: "
+             << timer.elapsedTime() / ITERATIONS / NUM_VALUES * 1e9
+             << " ns/value" << endl;
+
+        double total = 0;
+
+        timer.reset();
+        timer.start();
+        for (int iteration = 0; iteration < ITERATIONS; ++iteration) {
+            const char *p = prices.c_str();
+            for (;;) {
+                char *end;
+                total += strtod(p, &end);
+                if (!*end) {
+                    break;
+                }
+                p = end + 1;
+            }
+        }
+        timer.stop();
+        cout << "strtod:           "
+             << timer.elapsedTime() / ITERATIONS / NUM_VALUES * 1e9
+             << " ns/value" << endl;
+
+        timer.reset();
+        timer.start();
+        for (int iteration = 0; iteration < ITERATIONS; ++iteration) {
+            bslstl::StringRef rest(prices);
+            for (;;) {
+                double value;
+                NumericParseUtil::parseDouble(&value, &rest, rest);
+                total += value;
+                if (rest.empty()) {
+                    break;
+                }
+                rest.assign(rest.data() + 1, rest.length() - 1);
+            }
+        }
+        timer.stop();
+        cout << "parseDouble:      "
+             << timer.elapsedTime() / ITERATIONS / NUM_VALUES * 1e9
+             << " ns/value" << endl;
+
+        timer.reset();
+        timer.start();
+        for (int iteration = 0; iteration < ITERATIONS; ++iteration) {
+            bsl::vector<double> values;
+            ASSERT(0 == NumericParseUtil::parseDoubleArray(&values,
+                                                           prices,
+                                                           ','));
+            total += values.back();
+        }
+        timer.stop();
+        cout << "parseDoubleArray: "
+             << timer.elapsedTime() / ITERATIONS / NUM_VALUES * 1e9
+             << " ns/value" << endl;
+
+        if (veryVerbose) {
+            P_(sum) P(total)
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -0,0 +1,311 @@
+// bdlbb_bloblzutil.cpp                                               -*-C++-*-
+#include <bdlbb_bloblzutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlbb_bloblzutil_cpp,"$Id$ $CSID$")
+
+#include <bdlbb_blobutil.h>
+
+#include <bdlde_crc32c.h>
+#include <bdlde_lzutil.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace {
+
+typedef bdlde::LzUtil LzUtil;
+
+                        // ======================
+                        // local class BlobReader
+                        // ======================
+
+class BlobReader {
+    // This class provides sequential access to the data of a blob, returning
+    // the address of contiguous ranges of that data in place where possible.
+
+    // DATA
+    const bdlbb::Blob& d_blob;         // blob being read
+    int                d_bufferIndex;  // index of the current data buffer
+    int                d_offset;       // offset in the current data buffer
+    int                d_remaining;    // number of bytes not yet read
+
+    // PRIVATE ACCESSORS
+    int bufferLength(int index) const;
+        // Return the number of bytes of data held in the data buffer having
+        // the specified 'index' in the blob.
+
+  public:
+    // CREATORS
+    explicit BlobReader(const bdlbb::Blob& blob);
+        // Create a reader positioned at the start of the data of the
+        // specified 'blob'.
+
+    // MANIPULATORS
+    const char *read(char *scratch, int length);
+        // Return the address of the next specified 'length' bytes of data,
+        // and advance past them, or return 0, with no effect, if fewer than
+        // 'length' bytes remain.  If the bytes are not contiguous in the
+        // blob, copy them to the specified 'scratch' buffer and return
+        // 'scratch'.  The behavior is undefined unless 'scratch' can hold
+        // 'length' bytes.
+
+    // ACCESSORS
+    int remaining() const;
+        // Return the number of bytes of data not yet read.
+};
+
+                        // ----------------------
+                        // local class BlobReader
+                        // ----------------------
+
+// PRIVATE ACCESSORS
+int BlobReader::bufferLength(int index) const
+{
+    return index == d_blob.numDataBuffers() - 1
+           ? d_blob.lastDataBufferLength()
+           : d_blob.buffer(index).size();
+}
+
+// CREATORS
+BlobReader::BlobReader(const bdlbb::Blob& blob)
+: d_blob(blob)
+, d_bufferIndex(0)
+, d_offset(0)
+, d_remaining(blob.length())
+{
+}
+
+// MANIPULATORS
+const char *BlobReader::read(char *scratch, int length)
+{
+    if (length > d_remaining) {
+        return 0;                                                     // RETURN
+    }
+    d_remaining -= length;
+
+    char *output = scratch;
+    while (0 < length) {
+        int available = bufferLength(d_bufferIndex) - d_offset;
+        if (0 == available) {
+            ++d_bufferIndex;
+            d_offset = 0;
+            continue;
+        }
+
+        const char *data = d_blob.buffer(d_bufferIndex).data() + d_offset;
+        if (output == scratch && length <= available) {
+            d_offset += length;
+            return data;                                              // RETURN
+        }
+
+        const int numBytes = bsl::min(length, available);
+        bsl::memcpy(output, data, numBytes);
+        output   += numBytes;
+        length   -= numBytes;
+        d_offset += numBytes;
+    }
+    return scratch;
+}
+
+// ACCESSORS
+int BlobReader::remaining() const
+{
+    return d_remaining;
+}
+
+                        // =================
+                        // Utility Functions
+                        // =================
+
+int decompressFrame(bdlbb::Blob *result,
+                    BlobReader  *reader,
+                    char        *inputScratch,
+                    char        *outputBuffer)
+    // Append to the specified 'result' the data held in the frame read from
+    // the specified 'reader', using the specified 'inputScratch' buffer
+    // (capable of holding 'LzUtil::k_MAX_BLOCK_LENGTH' bytes) for input that
+    // is not contiguous, and the specified 'outputBuffer' (capable of holding
+    // 'LzUtil::k_MAX_BLOCK_LENGTH' bytes) for decompressed data.  Return 0 if
+    // the reader holds exactly one valid frame, and a non-zero value
+    // otherwise.
+{
+    const char *header = reader->read(inputScratch,
+                                      LzUtil::k_FRAME_HEADER_LENGTH);
+    if (0 == header || 0 != LzUtil::readFrameHeader(header)) {
+        return -1;                                                    // RETURN
+    }
+
+    unsigned int crc = bdlde::Crc32c::k_NULL_CRC32C;
+    while (true) {
+        header = reader->read(inputScratch, LzUtil::k_BLOCK_HEADER_LENGTH);
+        if (0 == header) {
+            return -1;                                                // RETURN
+        }
+
+        int  dataLength;
+        bool isCompressed;
+        if (0 != LzUtil::readBlockHeader(&dataLength, &isCompressed, header)) {
+            return -1;                                                // RETURN
+        }
+        if (0 == dataLength) {
+            break;
+        }
+
+        const char *data = reader->read(inputScratch, dataLength);
+        if (0 == data) {
+            return -1;                                                // RETURN
+        }
+
+        if (isCompressed) {
+            dataLength = LzUtil::decompressBlock(outputBuffer,
+                                                 LzUtil::k_MAX_BLOCK_LENGTH,
+                                                 data,
+                                                 dataLength);
+            if (dataLength <= 0) {
+                return -1;                                            // RETURN
+            }
+            data = outputBuffer;
+        }
+
+        crc = bdlde::Crc32c::calculate(data, dataLength, crc);
+        bdlbb::BlobUtil::append(result, data, dataLength);
+    }
+
+    const char *checksum = reader->read(inputScratch,
+                                        LzUtil::k_CHECKSUM_LENGTH);
+    if (0 == checksum || LzUtil::readChecksum(checksum) != crc) {
+        return -1;                                                    // RETURN
+    }
+
+    return reader->remaining();
+}
+
+}  // close unnamed namespace
+
+namespace bdlbb {
+
+                              // -----------------
+                              // struct BlobLzUtil
+                              // -----------------
+
+// CLASS METHODS
+void BlobLzUtil::compress(Blob *result, const Blob& input)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(result != &input);
+
+    enum {
+        k_MAX_BLOCK_LENGTH    = LzUtil::k_MAX_BLOCK_LENGTH,
+        k_FRAME_HEADER_LENGTH = LzUtil::k_FRAME_HEADER_LENGTH,
+        k_BLOCK_HEADER_LENGTH = LzUtil::k_BLOCK_HEADER_LENGTH,
+        k_TRAILER_LENGTH      = LzUtil::k_TRAILER_LENGTH
+    };
+
+    bsl::vector<char> buffer(k_MAX_BLOCK_LENGTH
+                             + k_BLOCK_HEADER_LENGTH
+                             + LzUtil::maxCompressedLength(
+                                                         k_MAX_BLOCK_LENGTH));
+    char *const       block      = buffer.data();
+    char *const       compressed = block + k_MAX_BLOCK_LENGTH;
+
+    char header[k_FRAME_HEADER_LENGTH];
+    LzUtil::writeFrameHeader(header);
+    BlobUtil::append(result, header, k_FRAME_HEADER_LENGTH);
+
+    unsigned int crc         = bdlde::Crc32c::k_NULL_CRC32C;
+    int          blockLength = 0;  // length of the data gathered in 'block'
+    int          remaining   = input.length();
+
+    for (int i = 0; 0 < remaining; ++i) {
+        const char *data   = input.buffer(i).data();
+        int         length = bsl::min(input.buffer(i).size(), remaining);
+
+        remaining -= length;
+        crc        = bdlde::Crc32c::calculate(data, length, crc);
+
+        while (0 < length) {
+            if (0 == blockLength && length >= k_MAX_BLOCK_LENGTH) {
+                // Compress a whole block directly from the blob buffer.
+
+                const int numBytes = LzUtil::compressFrameBlock(
+                                                           compressed,
+                                                           data,
+                                                           k_MAX_BLOCK_LENGTH);
+                BlobUtil::append(result, compressed, numBytes);
+                data   += k_MAX_BLOCK_LENGTH;
+                length -= k_MAX_BLOCK_LENGTH;
+                continue;
+            }
+
+            const int numBytes = bsl::min(length,
+                                          k_MAX_BLOCK_LENGTH - blockLength);
+            bsl::memcpy(block + blockLength, data, numBytes);
+            blockLength += numBytes;
+            data        += numBytes;
+            length      -= numBytes;
+
+            if (k_MAX_BLOCK_LENGTH == blockLength) {
+                const int compressedLength = LzUtil::compressFrameBlock(
+                                                                  compressed,
+                                                                  block,
+                                                                  blockLength);
+                BlobUtil::append(result, compressed, compressedLength);
+                blockLength = 0;
+            }
+        }
+    }
+
+    if (0 < blockLength) {
+        const int compressedLength = LzUtil::compressFrameBlock(compressed,
+                                                                block,
+                                                                blockLength);
+        BlobUtil::append(result, compressed, compressedLength);
+    }
+
+    char trailer[k_TRAILER_LENGTH];
+    LzUtil::writeTrailer(trailer, crc);
+    BlobUtil::append(result, trailer, k_TRAILER_LENGTH);
+}
+
+int BlobLzUtil::decompress(Blob *result, const Blob& input)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(result != &input);
+
+    bsl::vector<char> buffer(2 * LzUtil::k_MAX_BLOCK_LENGTH);
+    const int         originalLength = result->length();
+    BlobReader        reader(input);
+
+    const int rc = decompressFrame(result,
+                                   &reader,
+                                   buffer.data(),
+                                   buffer.data() + LzUtil::k_MAX_BLOCK_LENGTH);
+    if (0 != rc) {
+        result->setLength(originalLength);
+    }
+    return rc;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
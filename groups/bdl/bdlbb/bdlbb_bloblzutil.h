@@ -0,0 +1,122 @@
+// bdlbb_bloblzutil.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLBB_BLOBLZUTIL
+#define INCLUDED_BDLBB_BLOBLZUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide LZ-family frame compression of blobs.
+//
+//@CLASSES:
+//  bdlbb::BlobLzUtil: namespace for compressing and decompressing blobs
+//
+//@SEE_ALSO: bdlde_lzutil, bdlbb_blob
+//
+//@DESCRIPTION: This component provides a 'struct', 'bdlbb::BlobLzUtil', that
+// serves as a namespace for functions that compress the data held in a
+// 'bdlbb::Blob' into a frame, and decompress a frame held in a 'bdlbb::Blob',
+// using the block compressor and the frame format of 'bdlde::LzUtil' (see
+// {'bdlde_lzutil'|Frame Format}).  The frames are identical to those produced
+// and consumed by 'bdlde::LzUtil::compressFrame' and
+// 'bdlde::LzUtil::decompressFrame', and by the streaming 'bdlde::LzEncoder'
+// and 'bdlde::LzDecoder' mechanisms.
+//
+// The data is compressed directly from, and decompressed directly from, the
+// buffers of the input blob whenever a block is held in a single buffer, so
+// that the data of a blob need not be copied into a contiguous buffer.  A
+// single block of data, and a single compressed block, are buffered
+// otherwise.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Compressing a Blob
+///- - - - - - - - - - - - - - -
+// Suppose that we have a 'bdlbb::Blob' holding a large, repetitive message
+// (such as a BER- or JSON-encoded payload) that we want to store or send in a
+// compact form.
+//
+// First, we create the message:
+//..
+//  bdlbb::PooledBlobBufferFactory factory(1024);
+//  bdlbb::Blob                    message(&factory);
+//
+//  for (int i = 0; i < 1000; ++i) {
+//      bsl::ostringstream os;
+//      os << "{\"id\":" << i << ",\"name\":\"item\",\"price\":1.25}\n";
+//      bdlbb::BlobUtil::append(&message,
+//                              os.str().data(),
+//                              static_cast<int>(os.str().length()));
+//  }
+//..
+// Then, we compress the message into a frame held in another blob, and
+// observe that the frame is much smaller than the message:
+//..
+//  bdlbb::Blob frame(&factory);
+//  bdlbb::BlobLzUtil::compress(&frame, message);
+//
+//  assert(frame.length() < message.length() / 4);
+//..
+// Finally, we decompress the frame, and observe that the result is the
+// original message:
+//..
+//  bdlbb::Blob result(&factory);
+//  int         rc = bdlbb::BlobLzUtil::decompress(&result, frame);
+//
+//  assert(0 == rc);
+//  assert(0 == bdlbb::BlobUtil::compare(message, result));
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlbb_blob.h>
+
+namespace BloombergLP {
+namespace bdlbb {
+
+                              // =================
+                              // struct BlobLzUtil
+                              // =================
+
+struct BlobLzUtil {
+    // This 'struct' provides a namespace for functions that compress and
+    // decompress the data of blobs using the frame format of 'bdlde::LzUtil'.
+
+    // CLASS METHODS
+    static void compress(Blob *result, const Blob& input);
+        // Append to the specified 'result' a frame holding the data in the
+        // specified 'input'.  The behavior is undefined unless 'result' has a
+        // blob buffer factory, and 'result' and 'input' refer to distinct
+        // objects.
+
+    static int decompress(Blob *result, const Blob& input);
+        // Append to the specified 'result' the data held in the frame in the
+        // specified 'input'.  Return 0 on success, and a non-zero value, with
+        // no effect on the length of 'result', if 'input' does not hold
+        // exactly one valid frame, or the checksum of the data does not match
+        // that recorded in the frame.  The behavior is undefined unless
+        // 'result' has a blob buffer factory, and 'result' and 'input' refer
+        // to distinct objects.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,650 @@
+// bdlbb_bloblzutil.t.cpp                                             -*-C++-*-
+#include <bdlbb_bloblzutil.h>
+
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_pooledblobbufferfactory.h>
+#include <bdlbb_simpleblobbufferfactory.h>
+
+#include <bdlde_crc32c.h>
+#include <bdlde_lzutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// The component under test provides a namespace for stateless functions that
+// compress and decompress the data of blobs.  We verify that the frame
+// produced for given data is independent of how the data is divided among the
+// buffers of the input blob, and identical to the frame produced by
+// 'bdlde::LzUtil' from a contiguous buffer, that it is restored exactly
+// regardless of how the frame is divided among buffers, and that truncated and
+// corrupted frames are rejected with no effect on the result.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] void compress(Blob *, const Blob&);
+// [ 2] int decompress(Blob *, const Blob&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] DECOMPRESSING MALFORMED FRAMES
+// [ 4] USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlbb::BlobLzUtil Obj;
+typedef bdlde::LzUtil     LzUtil;
+
+const int k_MAX_BLOCK = LzUtil::k_MAX_BLOCK_LENGTH;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+unsigned int nextRandom(unsigned int *state)
+    // Advance the specified linear congruential generator 'state', and
+    // return the next pseudo-random value in the range '[0 .. 32767]'.
+{
+    *state = *state * 1103515245U + 12345U;
+    return (*state >> 16) & 0x7fff;
+}
+
+void generateData(bsl::string *result, char kind, int length, unsigned seed)
+    // Load into the specified 'result' the specified 'length' bytes of data
+    // of the specified 'kind', generated using the specified 'seed': 'T' for
+    // log-like text, 'J' for JSON-like text, 'R' for random bytes, 'Z' for
+    // zero bytes, and 'P' for a short repeating pattern.
+{
+    unsigned int state = seed;
+
+    result->clear();
+    result->reserve(length);
+
+    static const char *const k_WORDS[] = {
+        "connection", "accepted", "from", "session", "closed", "request",
+        "timeout", "retrying", "order", "filled", "rejected", "price"
+    };
+    const int k_NUM_WORDS = sizeof k_WORDS / sizeof *k_WORDS;
+
+    char buffer[256];
+    while (static_cast<int>(result->length()) < length) {
+        int n = 0;
+        switch (kind) {
+          case 'T': {
+            n = bsl::sprintf(buffer,
+                             "2026-10-19 12:%02u:%02u.%03u INFO [%u] "
+                             "app_server.cpp:%u %s %s %s id=%u\n",
+                             nextRandom(&state) % 60,
+                             nextRandom(&state) % 60,
+                             nextRandom(&state) % 1000,
+                             nextRandom(&state) % 32,
+                             nextRandom(&state) % 2000,
+                             k_WORDS[nextRandom(&state) % k_NUM_WORDS],
+                             k_WORDS[nextRandom(&state) % k_NUM_WORDS],
+                             k_WORDS[nextRandom(&state) % k_NUM_WORDS],
+                             nextRandom(&state));
+          } break;
+          case 'J': {
+            n = bsl::sprintf(buffer,
+                             "{\"id\":%u,\"name\":\"%s-%u\",\"price\":%u.%02u,"
+                             "\"tags\":[\"%s\",\"%s\"],\"active\":%s},",
+                             nextRandom(&state),
+                             k_WORDS[nextRandom(&state) % k_NUM_WORDS],
+                             nextRandom(&state) % 100,
+                             nextRandom(&state) % 1000,
+                             nextRandom(&state) % 100,
+                             k_WORDS[nextRandom(&state) % k_NUM_WORDS],
+                             k_WORDS[nextRandom(&state) % k_NUM_WORDS],
+                             nextRandom(&state) % 2 ? "true" : "false");
+          } break;
+          case 'R': {
+            for (; n < 64; ++n) {
+                buffer[n] = static_cast<char>(nextRandom(&state) >> 3);
+            }
+          } break;
+          case 'Z': {
+            bsl::memset(buffer, 0, 64);
+            n = 64;
+          } break;
+          default: {
+            BSLS_ASSERT(kind == 'P');
+            for (; n < 63; ++n) {
+                buffer[n] = static_cast<char>('a' + n % 7);
+            }
+          } break;
+        }
+        result->append(buffer, bsl::min(n, length - int(result->length())));
+    }
+}
+
+void loadBlob(bdlbb::Blob *blob, const bsl::string& data)
+    // Append the specified 'data' to the specified 'blob'.
+{
+    bdlbb::BlobUtil::append(blob, data.data(), static_cast<int>(data.size()));
+}
+
+bsl::string toString(const bdlbb::Blob& blob)
+    // Return a string holding the data of the specified 'blob'.
+{
+    bsl::string result;
+    for (int i = 0; i < blob.numDataBuffers(); ++i) {
+        const int length = i == blob.numDataBuffers() - 1
+                           ? blob.lastDataBufferLength()
+                           : blob.buffer(i).size();
+        result.append(blob.buffer(i).data(), length);
+    }
+    return result;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test                = argc > 1 ? atoi(argv[1]) : 0;
+    const bool verbose             = argc > 2;
+    const bool veryVerbose         = argc > 3;
+    const bool veryVeryVerbose     = argc > 4;
+    const bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::Default::setDefaultAllocator(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate the usage example from the header file into the test
+        //:   driver, replacing 'assert' with 'ASSERT'.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Compressing a Blob
+///- - - - - - - - - - - - - - -
+// Suppose that we have a 'bdlbb::Blob' holding a large, repetitive message
+// (such as a BER- or JSON-encoded payload) that we want to store or send in a
+// compact form.
+//
+// First, we create the message:
+//..
+        bdlbb::PooledBlobBufferFactory factory(1024);
+        bdlbb::Blob                    message(&factory);
+
+        for (int i = 0; i < 1000; ++i) {
+            bsl::ostringstream os;
+            os << "{\"id\":" << i << ",\"name\":\"item\",\"price\":1.25}\n";
+            bdlbb::BlobUtil::append(&message,
+                                    os.str().data(),
+                                    static_cast<int>(os.str().length()));
+        }
+//..
+// Then, we compress the message into a frame held in another blob, and
+// observe that the frame is much smaller than the message:
+//..
+        bdlbb::Blob frame(&factory);
+        bdlbb::BlobLzUtil::compress(&frame, message);
+
+        ASSERT(frame.length() < message.length() / 4);
+//..
+// Finally, we decompress the frame, and observe that the result is the
+// original message:
+//..
+        bdlbb::Blob result(&factory);
+        int         rc = bdlbb::BlobLzUtil::decompress(&result, frame);
+
+        ASSERT(0 == rc);
+        ASSERT(0 == bdlbb::BlobUtil::compare(message, result));
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // DECOMPRESSING MALFORMED FRAMES
+        //
+        // Concerns:
+        //: 1 A frame that is truncated at any point, or that is followed by
+        //:   additional data, is rejected.
+        //:
+        //: 2 A frame having a corrupt header, block header, block, end mark,
+        //:   or checksum is rejected.
+        //:
+        //: 3 A rejected frame has no effect on the length of the result.
+        //
+        // Plan:
+        //: 1 Compress data spanning several blocks, and decompress each
+        //:   prefix of the frame, and the frame followed by a byte, into a
+        //:   blob already holding data.  Verify that each is rejected, and
+        //:   that the length of the result is unchanged.  (C-1, 3)
+        //:
+        //: 2 Decompress copies of the frame in which one bit of each of a
+        //:   set of bytes (covering each part of the frame) is inverted, and
+        //:   verify that each is rejected with no effect on the length of
+        //:   the result.  (C-2..3)
+        //
+        // Testing:
+        //   DECOMPRESSING MALFORMED FRAMES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "DECOMPRESSING MALFORMED FRAMES" << endl
+                          << "==============================" << endl;
+
+        bslma::TestAllocator         ta("test", veryVeryVeryVerbose);
+        bdlbb::SimpleBlobBufferFactory factory(1000, &ta);
+
+        bsl::string data;
+        generateData(&data, 'T', 2 * k_MAX_BLOCK + 1000, 6);
+        data.append(3000, 'x');
+        {
+            bsl::string random;
+            generateData(&random, 'R', k_MAX_BLOCK, 6);
+            data.append(random);
+        }
+
+        bdlbb::Blob input(&factory, &ta);
+        loadBlob(&input, data);
+
+        bdlbb::Blob frameBlob(&factory, &ta);
+        Obj::compress(&frameBlob, input);
+
+        const bsl::string FRAME = toString(frameBlob);
+        const int         N     = static_cast<int>(FRAME.size());
+
+        if (veryVerbose) { T_ P_(data.size()) P(N) }
+
+        bdlbb::Blob result(&factory, &ta);
+        loadBlob(&result, "prefix");
+
+        ASSERT(0 == Obj::decompress(&result, frameBlob));
+        ASSERT("prefix" + data == toString(result));
+
+        if (verbose) cout << "\tTesting truncated and extended frames.\n";
+        {
+            for (int length = 0; length <= N; ++length) {
+                // Test every prefix near the ends of the frame and of the
+                // first block, and a sample of the others.
+
+                if (64 < length && length < N - 64 && 0 != length % 997
+                 && (length < 1000 || 1100 < length)) {
+                    continue;
+                }
+
+                bsl::string frame(FRAME, 0, length);
+                if (N == length) {
+                    frame.push_back('\0');
+                }
+
+                bdlbb::Blob in(&factory, &ta);
+                loadBlob(&in, frame);
+
+                result.setLength(6);
+                ASSERTV(length, 0 != Obj::decompress(&result, in));
+                ASSERTV(length, 6 == result.length());
+            }
+        }
+
+        if (verbose) cout << "\tTesting corrupted frames.\n";
+        {
+            int  blockLength;
+            bool isCompressed;
+            ASSERT(0 == LzUtil::readBlockHeader(&blockLength,
+                                             &isCompressed,
+                                             FRAME.data() + 5));
+            ASSERT(isCompressed);
+
+            const int POSITIONS[] = {
+                0, 3, 4,                                  // frame header
+                5, 6, 8,                                  // block header
+                9, 10, 50, 9 + blockLength - 1,           // block data
+                N - 8, N - 7, N - 5,                      // end mark
+                N - 4, N - 1                              // checksum
+            };
+            const int NUM_POSITIONS = sizeof POSITIONS / sizeof *POSITIONS;
+
+            for (int ti = 0; ti < NUM_POSITIONS; ++ti) {
+                const int POSITION = POSITIONS[ti];
+
+                for (int bit = 0; bit < 8; ++bit) {
+                    bsl::string frame(FRAME);
+                    frame[POSITION] = static_cast<char>(
+                                                frame[POSITION] ^ (1 << bit));
+
+                    bdlbb::Blob in(&factory, &ta);
+                    loadBlob(&in, frame);
+
+                    result.setLength(6);
+                    ASSERTV(POSITION, bit, 0 != Obj::decompress(&result, in));
+                    ASSERTV(POSITION, bit, 6 == result.length());
+                }
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // COMPRESSING AND DECOMPRESSING BLOBS
+        //
+        // Concerns:
+        //: 1 'decompress' restores the data compressed by 'compress', and
+        //:   appends it to the data already held by the result.
+        //:
+        //: 2 The frame produced by 'compress' depends only on the data, and
+        //:   not on how the data is divided among the buffers of the blob
+        //:   (including buffers larger than a block).
+        //:
+        //: 3 The frame consists of blocks holding 'k_MAX_BLOCK_LENGTH' bytes,
+        //:   other than the last, and has a valid trailer.
+        //:
+        //: 4 'decompress' accepts a frame regardless of how it is divided
+        //:   among the buffers of the blob.
+        //:
+        //: 5 The frame is identical to that produced by
+        //:   'bdlde::LzUtil::compressFrame' from the same data.
+        //
+        // Plan:
+        //: 1 For data of each of a set of lengths at and around multiples of
+        //:   the block length, and of several kinds, compress the data held
+        //:   in blobs having buffers of several sizes, and verify that the
+        //:   frames are identical to each other, and to the frame produced by
+        //:   'bdlde::LzUtil::compressFrame'.  (C-2, 5)
+        //:
+        //: 2 Walk the block headers of the frame, verifying the length of
+        //:   each block and the checksum in the trailer.  (C-3)
+        //:
+        //: 3 Decompress the frame, held in blobs having buffers of several
+        //:   sizes, into blobs already holding data, and verify the result.
+        //:   (C-1, 4)
+        //
+        // Testing:
+        //   void compress(Blob *, const Blob&);
+        //   int decompress(Blob *, const Blob&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COMPRESSING AND DECOMPRESSING BLOBS" << endl
+                          << "===================================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        const int LENGTHS[] = {
+            0, 1, 13, 1000, k_MAX_BLOCK - 1, k_MAX_BLOCK, k_MAX_BLOCK + 1,
+            3 * k_MAX_BLOCK + 17
+        };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        const char KINDS[]   = { 'T', 'R', 'Z' };
+        const int  NUM_KINDS = sizeof KINDS;
+
+        const int BUFFER_SIZES[]   = { 1, 7, 4096, 2 * k_MAX_BLOCK + 5 };
+        const int NUM_BUFFER_SIZES = static_cast<int>(
+                                   sizeof BUFFER_SIZES / sizeof *BUFFER_SIZES);
+
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const int LENGTH = LENGTHS[ti];
+
+            for (int tj = 0; tj < NUM_KINDS; ++tj) {
+                const char KIND = KINDS[tj];
+
+                if (veryVerbose) { T_ P_(LENGTH) P(KIND) }
+
+                bsl::string data;
+                generateData(&data, KIND, LENGTH, ti);
+
+                bsl::string frame;
+                for (int tk = 0; tk < NUM_BUFFER_SIZES; ++tk) {
+                    const int BUFFER_SIZE = BUFFER_SIZES[tk];
+
+                    if (1 == BUFFER_SIZE && 1000 < LENGTH) {
+                        continue;
+                    }
+
+                    bdlbb::SimpleBlobBufferFactory factory(BUFFER_SIZE, &ta);
+
+                    bdlbb::Blob input(&factory, &ta);
+                    loadBlob(&input, data);
+
+                    bdlbb::Blob output(&factory, &ta);
+                    Obj::compress(&output, input);
+
+                    if (frame.empty()) {
+                        frame = toString(output);
+                    }
+                    ASSERTV(LENGTH, KIND, BUFFER_SIZE,
+                            frame == toString(output));
+
+                    bdlbb::Blob result(&factory, &ta);
+                    loadBlob(&result, "abc");
+
+                    ASSERTV(LENGTH, KIND, BUFFER_SIZE,
+                            0 == Obj::decompress(&result, output));
+                    ASSERTV(LENGTH, KIND, BUFFER_SIZE,
+                            "abc" + data == toString(result));
+                }
+
+                // The frame is that produced from a contiguous buffer.
+
+                bsl::vector<char> buffer(LzUtil::maxFrameLength(LENGTH));
+                const int         bufferLength = LzUtil::compressFrame(
+                                                                   &buffer[0],
+                                                                   data.data(),
+                                                                   LENGTH);
+                ASSERTV(LENGTH, KIND,
+                        frame == bsl::string(&buffer[0], bufferLength));
+
+                // Walk the blocks of the frame.
+
+                ASSERTV(LENGTH, KIND,
+                        0 == LzUtil::readFrameHeader(frame.data()));
+
+                int offset    = LzUtil::k_FRAME_HEADER_LENGTH;
+                int remaining = LENGTH;
+                while (true) {
+                    int  blockLength;
+                    bool isCompressed;
+                    ASSERTV(LENGTH, KIND, offset,
+                            0 == LzUtil::readBlockHeader(&blockLength,
+                                                      &isCompressed,
+                                                      frame.data() + offset));
+                    if (0 == blockLength) {
+                        break;
+                    }
+
+                    const int EXPECTED = bsl::min(remaining, k_MAX_BLOCK);
+
+                    bsl::vector<char> block(k_MAX_BLOCK);
+                    const int         n = isCompressed
+                                        ? LzUtil::decompressBlock(
+                                            &block[0],
+                                            k_MAX_BLOCK,
+                                            frame.data() + offset + 4,
+                                            blockLength)
+                                        : blockLength;
+                    ASSERTV(LENGTH, KIND, offset, n, EXPECTED == n);
+                    ASSERTV(LENGTH, KIND, offset,
+                            isCompressed || 'R' == KIND || EXPECTED < 19);
+
+                    remaining -= EXPECTED;
+                    offset    += 4 + blockLength;
+                }
+                ASSERTV(LENGTH, KIND, 0 == remaining);
+                ASSERTV(LENGTH, KIND, offset + 8 == int(frame.size()));
+                ASSERTV(LENGTH, KIND,
+                        bdlde::Crc32c::calculate(data.data(), data.size()) ==
+                             LzUtil::readChecksum(frame.data() + offset + 4));
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Compress and decompress a short string held in a blob of small
+        //:   buffers.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const char DATA[] = "hello, hello, hello, hello, hello, world";
+
+        bslma::TestAllocator           ta("test", veryVeryVeryVerbose);
+        bdlbb::SimpleBlobBufferFactory factory(16, &ta);
+        bdlbb::Blob                    input(&factory, &ta);
+        bdlbb::Blob                    frame(&factory, &ta);
+        bdlbb::Blob                    output(&factory, &ta);
+
+        loadBlob(&input, DATA);
+        Obj::compress(&frame, input);
+        if (veryVerbose) { T_ P_(input.length()) P(frame.length()) }
+
+        ASSERT(0 == Obj::decompress(&output, frame));
+        ASSERT(DATA == toString(output));
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,399 @@
+// bdlbb_threadcachedblobbufferfactory.cpp                            -*-C++-*-
+#include <bdlbb_threadcachedblobbufferfactory.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlbb_threadcachedblobbufferfactory_cpp,"$Id$ $CSID$")
+
+#include <bslma_default.h>
+#include <bslma_sharedptrrep.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_memory.h>
+#include <bsl_typeinfo.h>
+
+// IMPLEMENTATION NOTES
+// --------------------
+// Each pooled buffer is preceded, in the same pool block, by a
+// 'ThreadCachedBlobBufferFactory_Rep' object, which serves as the shared
+// pointer representation of the buffer.  When the last reference to the
+// buffer is released, 'disposeRep' hands the representation back to the
+// factory, which links it into the free list of the releasing thread's cache
+// (reusing the 'd_next_p' member of the representation), or deallocates the
+// whole block to the shared pool of its size class.  A cached representation
+// is reused by resetting its reference counts, so that a cache hit involves
+// no atomic read-modify-write operations other than those performed by the
+// shared pointer itself.
+//
+// The cache of a thread is reached through thread-specific storage, and is
+// only ever accessed by that thread, except when the thread exits (at which
+// point the key destructor retires the cache under 'd_cachesMutex') and when
+// the factory is destroyed.
+
+namespace BloombergLP {
+namespace bdlbb {
+
+                  // =======================================
+                  // class ThreadCachedBlobBufferFactory_Rep
+                  // =======================================
+
+class ThreadCachedBlobBufferFactory_Rep : public bslma::SharedPtrRep {
+    // This component-private class provides the shared pointer representation
+    // of a pooled buffer, allocated contiguously with, and immediately
+    // preceding, the buffer it manages.
+
+  public:
+    // DATA
+    ThreadCachedBlobBufferFactory     *d_factory_p;  // owning factory (held)
+
+    ThreadCachedBlobBufferFactory_Rep *d_next_p;     // next free rep, when
+                                                     // cached
+
+    int                                d_sizeClass;  // index of size class
+
+    // CREATORS
+    ThreadCachedBlobBufferFactory_Rep(ThreadCachedBlobBufferFactory *factory,
+                                      int                            sizeClass)
+        // Create a representation having one shared reference, owned by the
+        // specified 'factory', for a buffer of the specified 'sizeClass'.
+    : d_factory_p(factory)
+    , d_next_p(0)
+    , d_sizeClass(sizeClass)
+    {
+    }
+
+    // MANIPULATORS
+    void disposeObject() BSLS_KEYWORD_OVERRIDE
+        // Do nothing; the managed buffer holds no object.
+    {
+    }
+
+    void disposeRep() BSLS_KEYWORD_OVERRIDE
+        // Return this representation, and the buffer it manages, to the owning
+        // factory.
+    {
+        d_factory_p->release(this);
+    }
+
+    void *getDeleter(const std::type_info&) BSLS_KEYWORD_OVERRIDE
+        // Return 0; this representation has no deleter.
+    {
+        return 0;
+    }
+
+    // ACCESSORS
+    char *buffer() const;
+        // Return the address of the buffer managed by this representation.
+
+    void *originalPtr() const BSLS_KEYWORD_OVERRIDE
+        // Return the address of the buffer managed by this representation.
+    {
+        return buffer();
+    }
+};
+
+                 // =========================================
+                 // struct ThreadCachedBlobBufferFactory_Cache
+                 // =========================================
+
+struct ThreadCachedBlobBufferFactory_Cache {
+    // This component-private 'struct' holds, for one thread, a free list of
+    // buffers for each size class of the owning factory.
+
+    // DATA
+    ThreadCachedBlobBufferFactory     *d_factory_p;   // owning factory (held)
+
+    ThreadCachedBlobBufferFactory_Rep *d_heads[
+                     ThreadCachedBlobBufferFactory::k_MAX_NUM_SIZE_CLASSES];
+                                                      // free lists
+
+    int                                d_counts[
+                     ThreadCachedBlobBufferFactory::k_MAX_NUM_SIZE_CLASSES];
+                                                      // free list lengths
+};
+
+}  // close package namespace
+
+namespace {
+namespace u {
+
+using namespace bdlbb;
+
+const int k_HEADER_SIZE = static_cast<int>(
+                     (sizeof(ThreadCachedBlobBufferFactory_Rep)
+                      + bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT - 1)
+                     & ~(bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT - 1));
+    // Offset of a pooled buffer from the start of its block, which is the
+    // size of a representation rounded up to the maximum alignment.
+
+int numSizeClasses(int bufferSize, int maxBufferSize)
+    // Return the number of power-of-two size classes from the specified
+    // 'bufferSize' to the specified 'maxBufferSize', inclusive, or a value
+    // greater than 'ThreadCachedBlobBufferFactory::k_MAX_NUM_SIZE_CLASSES' if
+    // there are more such classes than that.  Note that the sizes are
+    // computed in 64-bit arithmetic, and the search is bounded, so that no
+    // overflow occurs even if the arguments violate the preconditions of the
+    // constructor.
+{
+    bsls::Types::Int64 size   = bufferSize;
+    int                result = 1;
+    while (0 < size
+        && size < maxBufferSize
+        && result <= ThreadCachedBlobBufferFactory::k_MAX_NUM_SIZE_CLASSES) {
+        size <<= 1;
+        ++result;
+    }
+    return result;
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+namespace bdlbb {
+
+                  // ---------------------------------------
+                  // class ThreadCachedBlobBufferFactory_Rep
+                  // ---------------------------------------
+
+// ACCESSORS
+inline
+char *ThreadCachedBlobBufferFactory_Rep::buffer() const
+{
+    return const_cast<char *>(reinterpret_cast<const char *>(this))
+                                                            + u::k_HEADER_SIZE;
+}
+
+                    // -----------------------------------
+                    // class ThreadCachedBlobBufferFactory
+                    // -----------------------------------
+
+// PRIVATE CLASS METHODS
+void ThreadCachedBlobBufferFactory::retireCacheCallback(void *cache)
+{
+    Cache *c = static_cast<Cache *>(cache);
+
+    c->d_factory_p->retireCache(c);
+}
+
+// PRIVATE MANIPULATORS
+void ThreadCachedBlobBufferFactory::allocateFromClass(BlobBuffer *buffer,
+                                                      int         sizeClass)
+{
+    Cache *cache = localCache();
+    Rep   *rep   = cache->d_heads[sizeClass];
+
+    if (rep) {
+        cache->d_heads[sizeClass] = rep->d_next_p;
+        --cache->d_counts[sizeClass];
+        rep->resetCountsRaw(1, 0);
+    }
+    else {
+        rep = new (d_pools[sizeClass]->allocate()) Rep(this, sizeClass);
+    }
+
+    buffer->reset(bsl::shared_ptr<char>(rep->buffer(), rep),
+                  d_bufferSize << sizeClass);
+}
+
+void ThreadCachedBlobBufferFactory::init()
+{
+    d_pools.reserve(d_numSizeClasses);
+    for (int i = 0; i < d_numSizeClasses; ++i) {
+        d_pools.push_back(new (*d_allocator_p) bdlma::ConcurrentPool(
+                                        u::k_HEADER_SIZE + (d_bufferSize << i),
+                                        d_allocator_p));
+    }
+
+    int rc = bslmt::ThreadUtil::createKey(&d_cacheKey, &retireCacheCallback);
+    BSLS_ASSERT_OPT(0 == rc);  (void)rc;
+}
+
+ThreadCachedBlobBufferFactory_Cache *
+ThreadCachedBlobBufferFactory::localCache()
+{
+    Cache *cache = static_cast<Cache *>(
+                                 bslmt::ThreadUtil::getSpecific(d_cacheKey));
+    if (cache) {
+        return cache;                                                 // RETURN
+    }
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_cachesMutex);
+
+        if (d_freeCaches.empty()) {
+            d_caches.reserve(d_caches.size() + 1);
+            cache = static_cast<Cache *>(d_allocator_p->allocate(
+                                                              sizeof(Cache)));
+            cache->d_factory_p = this;
+            d_caches.push_back(cache);
+        }
+        else {
+            cache = d_freeCaches.back();
+            d_freeCaches.pop_back();
+        }
+    }
+
+    bsl::fill(cache->d_heads, cache->d_heads + k_MAX_NUM_SIZE_CLASSES,
+              static_cast<Rep *>(0));
+    bsl::fill(cache->d_counts, cache->d_counts + k_MAX_NUM_SIZE_CLASSES, 0);
+
+    bslmt::ThreadUtil::setSpecific(d_cacheKey, cache);
+
+    return cache;
+}
+
+void ThreadCachedBlobBufferFactory::release(Rep *rep)
+{
+    BSLS_ASSERT(rep);
+
+    const int  sizeClass = rep->d_sizeClass;
+    Cache     *cache     = static_cast<Cache *>(
+                                 bslmt::ThreadUtil::getSpecific(d_cacheKey));
+
+    if (cache && cache->d_counts[sizeClass] < d_maxCachedBuffers) {
+        rep->d_next_p             = cache->d_heads[sizeClass];
+        cache->d_heads[sizeClass] = rep;
+        ++cache->d_counts[sizeClass];
+    }
+    else {
+        d_pools[sizeClass]->deallocate(rep);
+    }
+}
+
+void ThreadCachedBlobBufferFactory::retireCache(Cache *cache)
+{
+    BSLS_ASSERT(cache);
+
+    for (int i = 0; i < d_numSizeClasses; ++i) {
+        Rep *rep = cache->d_heads[i];
+        while (rep) {
+            Rep *next = rep->d_next_p;
+            d_pools[i]->deallocate(rep);
+            rep = next;
+        }
+        cache->d_heads[i]  = 0;
+        cache->d_counts[i] = 0;
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_cachesMutex);
+
+    d_freeCaches.push_back(cache);
+}
+
+// CREATORS
+ThreadCachedBlobBufferFactory::ThreadCachedBlobBufferFactory(
+                                              int               bufferSize,
+                                              bslma::Allocator *basicAllocator)
+: d_bufferSize(bufferSize)
+, d_numSizeClasses(1)
+, d_maxCachedBuffers(k_DEFAULT_MAX_CACHED_BUFFERS)
+, d_pools(basicAllocator)
+, d_caches(basicAllocator)
+, d_freeCaches(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < bufferSize);
+
+    init();
+}
+
+ThreadCachedBlobBufferFactory::ThreadCachedBlobBufferFactory(
+                                              int               bufferSize,
+                                              int               maxBufferSize,
+                                              bslma::Allocator *basicAllocator)
+: d_bufferSize(bufferSize)
+, d_numSizeClasses(u::numSizeClasses(bufferSize, maxBufferSize))
+, d_maxCachedBuffers(k_DEFAULT_MAX_CACHED_BUFFERS)
+, d_pools(basicAllocator)
+, d_caches(basicAllocator)
+, d_freeCaches(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < bufferSize);
+    BSLS_ASSERT(d_numSizeClasses <= k_MAX_NUM_SIZE_CLASSES);
+    BSLS_ASSERT(maxBufferSize == (static_cast<bsls::Types::Int64>(bufferSize)
+                                  << (d_numSizeClasses - 1)));
+
+    init();
+}
+
+ThreadCachedBlobBufferFactory::ThreadCachedBlobBufferFactory(
+                                            int               bufferSize,
+                                            int               maxBufferSize,
+                                            int               maxCachedBuffers,
+                                            bslma::Allocator *basicAllocator)
+: d_bufferSize(bufferSize)
+, d_numSizeClasses(u::numSizeClasses(bufferSize, maxBufferSize))
+, d_maxCachedBuffers(maxCachedBuffers)
+, d_pools(basicAllocator)
+, d_caches(basicAllocator)
+, d_freeCaches(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < bufferSize);
+    BSLS_ASSERT(d_numSizeClasses <= k_MAX_NUM_SIZE_CLASSES);
+    BSLS_ASSERT(maxBufferSize == (static_cast<bsls::Types::Int64>(bufferSize)
+                                  << (d_numSizeClasses - 1)));
+    BSLS_ASSERT(0 <= maxCachedBuffers);
+
+    init();
+}
+
+ThreadCachedBlobBufferFactory::~ThreadCachedBlobBufferFactory()
+{
+    bslmt::ThreadUtil::deleteKey(d_cacheKey);
+
+    for (bsl::size_t i = 0; i < d_caches.size(); ++i) {
+        d_allocator_p->deallocate(d_caches[i]);
+    }
+
+    for (bsl::size_t i = 0; i < d_pools.size(); ++i) {
+        d_allocator_p->deleteObject(d_pools[i]);
+    }
+}
+
+// MANIPULATORS
+void ThreadCachedBlobBufferFactory::allocate(BlobBuffer *buffer, int size)
+{
+    BSLS_ASSERT(buffer);
+    BSLS_ASSERT(0 < size);
+
+    if (size > maxBufferSize()) {
+        buffer->reset(bslstl::SharedPtrUtil::createInplaceUninitializedBuffer(
+                                                                size,
+                                                                d_allocator_p),
+                      size);
+        return;                                                       // RETURN
+    }
+
+    int sizeClass = 0;
+    while ((d_bufferSize << sizeClass) < size) {
+        ++sizeClass;
+    }
+
+    allocateFromClass(buffer, sizeClass);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
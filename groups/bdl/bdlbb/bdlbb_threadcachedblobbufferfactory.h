@@ -0,0 +1,352 @@
+// bdlbb_threadcachedblobbufferfactory.h                              -*-C++-*-
+#ifndef INCLUDED_BDLBB_THREADCACHEDBLOBBUFFERFACTORY
+#define INCLUDED_BDLBB_THREADCACHEDBLOBBUFFERFACTORY
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a blob buffer factory with size classes and thread caches.
+//
+//@CLASSES:
+//  bdlbb::ThreadCachedBlobBufferFactory: size-classed, thread-caching factory
+//
+//@SEE_ALSO: bdlbb_blob, bdlbb_pooledblobbufferfactory, bdlma_concurrentpool
+//
+//@DESCRIPTION: This component provides a mechanism,
+// 'bdlbb::ThreadCachedBlobBufferFactory', implementing the
+// 'bdlbb::BlobBufferFactory' protocol, that is intended for programs in which
+// many threads concurrently build and destroy blobs.
+//
+// Like 'bdlbb::PooledBlobBufferFactory', this factory allocates the shared
+// pointer representation of each 'bdlbb::BlobBuffer' contiguously with the
+// buffer it manages, so that a single allocation serves both.  In addition:
+//
+//: o Buffers are pooled in several *size* *classes*.  The size of the
+//:   smallest class is the 'bufferSize' supplied at construction; each
+//:   subsequent class is twice the size of the previous one, up to the
+//:   'maxBufferSize' supplied at construction.  'allocate(BlobBuffer *)'
+//:   always returns a buffer of the smallest class, whereas
+//:   'allocate(BlobBuffer *, int)' returns a buffer from the smallest class
+//:   that can hold the requested size.  Note that the latter overload is not
+//:   part of the 'bdlbb::BlobBufferFactory' protocol: a 'bdlbb::Blob' (or any
+//:   other client using the factory through the protocol) always obtains
+//:   buffers of the smallest class, and only clients calling
+//:   'allocate(BlobBuffer *, int)' directly on this factory obtain buffers of
+//:   the larger classes (e.g., to be inserted into a blob with
+//:   'bdlbb::Blob::appendDataBuffer').
+//:
+//: o Each thread that allocates from the factory is given a small cache of
+//:   free buffers for each size class.  When the last reference to a buffer
+//:   is released, the buffer is returned to the cache of the releasing thread
+//:   (if that thread has a cache with room), and is otherwise returned to a
+//:   pool shared by all threads.  Allocating from, and releasing to, a
+//:   thread's own cache requires no synchronization at all, so that the
+//:   common case of a thread repeatedly building and destroying blobs does
+//:   not contend with other threads.
+//
+// The maximum number of free buffers retained in each per-thread cache, per
+// size class, may be specified at construction.  When a thread exits, the
+// buffers in its cache are returned to the shared pools.
+//
+///Thread Safety
+///-------------
+// 'bdlbb::ThreadCachedBlobBufferFactory' is *fully* *thread-safe*, meaning
+// that 'allocate' may be called concurrently from any number of threads, and
+// buffers may be released from any thread.
+//
+///Potential Lifetime Issues
+///-------------------------
+// As with 'bdlbb::PooledBlobBufferFactory', destroying a
+// 'bdlbb::ThreadCachedBlobBufferFactory' releases all memory used for the
+// 'BlobBuffer' objects it allocated, even if shared references to those
+// buffers remain.  It is undefined behavior to use (or release the last
+// reference to) a 'BlobBuffer' allocated by a factory after that factory is
+// destroyed.  In addition, the behavior is undefined if a thread that has
+// allocated from a factory exits concurrently with the destruction of that
+// factory.
+//
+// Each factory object consumes one thread-specific storage key (see
+// 'bslmt::ThreadUtil::createKey') for its lifetime; the number of factories
+// that may exist at the same time is therefore limited by the platform.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Building Messages of Varying Sizes
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we build outgoing messages in blobs, and that most messages
+// are small, while some carry large attachments.  We create a factory whose
+// default buffers are 1 KB, with larger size classes of up to 64 KB:
+//..
+//  bdlbb::ThreadCachedBlobBufferFactory factory(1024, 64 * 1024);
+//  assert(1024      == factory.bufferSize());
+//  assert(64 * 1024 == factory.maxBufferSize());
+//..
+// Then, we build a small message, letting the blob obtain 1 KB buffers from
+// the factory as needed:
+//..
+//  bdlbb::Blob header(&factory);
+//  header.setLength(1500);
+//  assert(2    == header.numBuffers());
+//  assert(1024 == header.buffer(0).size());
+//..
+// Next, when the size of an attachment is known up front, we can allocate a
+// single buffer of a larger size class for it directly:
+//..
+//  bdlbb::BlobBuffer attachment;
+//  factory.allocate(&attachment, 20000);
+//  assert(32 * 1024 == attachment.size());
+//..
+// Finally, note that when 'header' and 'attachment' are destroyed, their
+// buffers are returned to this thread's cache, and will be reused by the next
+// allocations of the corresponding sizes made by this thread.
+
+#include <bdlscm_version.h>
+
+#include <bdlbb_blob.h>
+
+#include <bdlma_concurrentpool.h>
+
+#include <bslma_allocator.h>
+
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_keyword.h>
+
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlbb {
+
+class ThreadCachedBlobBufferFactory_Rep;
+struct ThreadCachedBlobBufferFactory_Cache;
+
+                    // ===================================
+                    // class ThreadCachedBlobBufferFactory
+                    // ===================================
+
+class ThreadCachedBlobBufferFactory : public BlobBufferFactory {
+    // This class implements the 'BlobBufferFactory' protocol and provides a
+    // mechanism for allocating 'BlobBuffer' objects from a set of power-of-two
+    // size classes, backed by per-thread caches of free buffers.
+
+  public:
+    // CONSTANTS
+    enum {
+        k_MAX_NUM_SIZE_CLASSES       = 16,  // maximum number of size classes
+
+        k_DEFAULT_MAX_CACHED_BUFFERS = 32   // default number of free buffers
+                                            // cached per thread, per size
+                                            // class
+    };
+
+  private:
+    // PRIVATE TYPES
+    typedef ThreadCachedBlobBufferFactory_Rep   Rep;
+    typedef ThreadCachedBlobBufferFactory_Cache Cache;
+
+    // DATA
+    int                                  d_bufferSize;      // size of the
+                                                            // smallest class
+
+    int                                  d_numSizeClasses;  // number of size
+                                                            // classes
+
+    int                                  d_maxCachedBuffers;
+                                                            // per-thread,
+                                                            // per-class cache
+                                                            // capacity
+
+    bsl::vector<bdlma::ConcurrentPool *> d_pools;           // shared pool for
+                                                            // each size class
+                                                            // (owned)
+
+    bslmt::ThreadUtil::Key               d_cacheKey;        // key of the
+                                                            // calling thread's
+                                                            // cache
+
+    bsl::vector<Cache *>                 d_caches;          // all caches ever
+                                                            // created (owned)
+
+    bsl::vector<Cache *>                 d_freeCaches;      // caches of exited
+                                                            // threads,
+                                                            // available for
+                                                            // reuse
+
+    bslmt::Mutex                         d_cachesMutex;     // guards
+                                                            // 'd_caches' and
+                                                            // 'd_freeCaches'
+
+    bslma::Allocator                    *d_allocator_p;     // memory allocator
+                                                            // (held)
+
+    // FRIENDS
+    friend class ThreadCachedBlobBufferFactory_Rep;
+
+  private:
+    // NOT IMPLEMENTED
+    ThreadCachedBlobBufferFactory(const ThreadCachedBlobBufferFactory&);
+    ThreadCachedBlobBufferFactory& operator=(
+                                         const ThreadCachedBlobBufferFactory&);
+
+    // PRIVATE CLASS METHODS
+    static void retireCacheCallback(void *cache);
+        // Return the buffers held by the specified 'cache' to the shared pools
+        // of the factory that owns it, and make 'cache' available for reuse by
+        // another thread.  This function is invoked when a thread that has a
+        // cache exits.
+
+    // PRIVATE MANIPULATORS
+    void allocateFromClass(BlobBuffer *buffer, int sizeClass);
+        // Load into the specified 'buffer' a buffer of the specified
+        // 'sizeClass', taken from the calling thread's cache if possible, and
+        // from the shared pool for 'sizeClass' otherwise.
+
+    void init();
+        // Create the shared pools and the thread-specific storage key of this
+        // factory.  Note that this function is called only by the
+        // constructors.
+
+    Cache *localCache();
+        // Return the cache of the calling thread, creating it if necessary.
+
+    void release(Rep *rep);
+        // Return the specified 'rep', whose buffer is no longer referenced, to
+        // the calling thread's cache if it has room, and to the shared pool of
+        // its size class otherwise.
+
+    void retireCache(Cache *cache);
+        // Return the buffers held by the specified 'cache' to the shared
+        // pools, and make 'cache' available for reuse by another thread.
+
+  public:
+    // CREATORS
+    explicit ThreadCachedBlobBufferFactory(
+                                         int               bufferSize,
+                                         bslma::Allocator *basicAllocator = 0);
+    ThreadCachedBlobBufferFactory(int               bufferSize,
+                                  int               maxBufferSize,
+                                  bslma::Allocator *basicAllocator = 0);
+    ThreadCachedBlobBufferFactory(int               bufferSize,
+                                  int               maxBufferSize,
+                                  int               maxCachedBuffers,
+                                  bslma::Allocator *basicAllocator = 0);
+        // Create a factory for allocating 'BlobBuffer' objects whose smallest
+        // size class holds buffers of the specified 'bufferSize' bytes.
+        // Optionally specify a 'maxBufferSize' indicating the size of the
+        // largest size class; if 'maxBufferSize' is not specified, the factory
+        // has a single size class of 'bufferSize'.  Optionally specify
+        // 'maxCachedBuffers', the maximum number of free buffers retained in
+        // each per-thread cache for each size class; if 'maxCachedBuffers' is
+        // not specified, 'k_DEFAULT_MAX_CACHED_BUFFERS' is used.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless '0 < bufferSize',
+        // 'maxBufferSize == bufferSize * 2^N' for some
+        // '0 <= N < k_MAX_NUM_SIZE_CLASSES', and '0 <= maxCachedBuffers'.
+
+    ~ThreadCachedBlobBufferFactory() BSLS_KEYWORD_OVERRIDE;
+        // Destroy this factory.  This operation releases all 'BlobBuffer'
+        // objects allocated via this factory.  The behavior is undefined if a
+        // thread that has allocated from this factory exits concurrently with
+        // the destruction of this factory.
+
+    // MANIPULATORS
+    void allocate(BlobBuffer *buffer) BSLS_KEYWORD_OVERRIDE;
+        // Allocate a new buffer having 'bufferSize()' bytes and load it into
+        // the specified 'buffer'.
+
+    void allocate(BlobBuffer *buffer, int size);
+        // Allocate a new buffer having at least the specified 'size' bytes and
+        // load it into the specified 'buffer'.  If 'size <= maxBufferSize()',
+        // the buffer is taken from the smallest size class whose buffers can
+        // hold 'size' bytes, and has the size of that class; otherwise a
+        // buffer of exactly 'size' bytes is allocated directly from the
+        // allocator supplied at construction, and is not cached when released.
+        // The behavior is undefined unless '0 < size'.  Note that this method
+        // is not part of the 'BlobBufferFactory' protocol, and so is never
+        // called by a 'Blob' using this factory.
+
+    // ACCESSORS
+    int bufferSize() const;
+        // Return the size of the buffers of the smallest size class of this
+        // factory, which is the size of the buffers supplied by
+        // 'allocate(BlobBuffer *)'.
+
+    int maxBufferSize() const;
+        // Return the size of the buffers of the largest size class of this
+        // factory.
+
+    int maxCachedBuffers() const;
+        // Return the maximum number of free buffers retained in each
+        // per-thread cache for each size class.
+
+    int numSizeClasses() const;
+        // Return the number of size classes of this factory.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                    // -----------------------------------
+                    // class ThreadCachedBlobBufferFactory
+                    // -----------------------------------
+
+// MANIPULATORS
+inline
+void ThreadCachedBlobBufferFactory::allocate(BlobBuffer *buffer)
+{
+    BSLS_ASSERT(buffer);
+
+    allocateFromClass(buffer, 0);
+}
+
+// ACCESSORS
+inline
+int ThreadCachedBlobBufferFactory::bufferSize() const
+{
+    return d_bufferSize;
+}
+
+inline
+int ThreadCachedBlobBufferFactory::maxBufferSize() const
+{
+    return d_bufferSize << (d_numSizeClasses - 1);
+}
+
+inline
+int ThreadCachedBlobBufferFactory::maxCachedBuffers() const
+{
+    return d_maxCachedBuffers;
+}
+
+inline
+int ThreadCachedBlobBufferFactory::numSizeClasses() const
+{
+    return d_numSizeClasses;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
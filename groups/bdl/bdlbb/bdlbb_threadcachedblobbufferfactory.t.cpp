@@ -0,0 +1,904 @@
+// bdlbb_threadcachedblobbufferfactory.t.cpp                          -*-C++-*-
+#include <bdlbb_threadcachedblobbufferfactory.h>
+
+#include <bdlbb_blob.h>
+#include <bdlbb_pooledblobbufferfactory.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_semaphore.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_climits.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a thread-safe mechanism implementing the
+// 'bdlbb::BlobBufferFactory' protocol.  We verify that buffers of the correct
+// size classes are supplied, that released buffers are retained by the cache
+// of the releasing thread (subject to the configured capacity), that the
+// caches of exited threads are returned to the shared pools, and that the
+// factory is usable concurrently from several threads.  All memory must be
+// returned to the allocator supplied at construction when the factory is
+// destroyed.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] ThreadCachedBlobBufferFactory(int, Allocator * = 0);
+// [ 2] ThreadCachedBlobBufferFactory(int, int, Allocator * = 0);
+// [ 2] ThreadCachedBlobBufferFactory(int, int, int, Allocator * = 0);
+// [ 2] ~ThreadCachedBlobBufferFactory();
+//
+// MANIPULATORS
+// [ 3] void allocate(BlobBuffer *);
+// [ 3] void allocate(BlobBuffer *, int);
+//
+// ACCESSORS
+// [ 2] int bufferSize() const;
+// [ 2] int maxBufferSize() const;
+// [ 2] int maxCachedBuffers() const;
+// [ 2] int numSizeClasses() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: RELEASED BUFFERS ARE CACHED BY THE RELEASING THREAD
+// [ 5] CONCERN: CONCURRENT USE FROM MULTIPLE THREADS
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE: MULTI-THREADED BLOB CONSTRUCTION AND DESTRUCTION
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlbb::ThreadCachedBlobBufferFactory Obj;
+
+// ============================================================================
+//                       HELPER CLASSES FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+class ReleaseInOtherThread {
+    // This functor, run in its own thread, (optionally) creates a cache for
+    // its thread by allocating from a factory, releases a buffer allocated by
+    // another thread, and then allocates from the factory again, recording the
+    // address obtained.
+
+    // DATA
+    Obj               *d_factory_p;
+    bdlbb::BlobBuffer *d_buffer_p;
+    bool               d_createCache;
+    bslmt::Semaphore  *d_released_p;
+    bslmt::Semaphore  *d_resume_p;
+    char             **d_reallocated_p;
+
+  public:
+    // CREATORS
+    ReleaseInOtherThread(Obj               *factory,
+                         bdlbb::BlobBuffer *buffer,
+                         bool               createCache,
+                         bslmt::Semaphore  *released,
+                         bslmt::Semaphore  *resume,
+                         char             **reallocated)
+    : d_factory_p(factory)
+    , d_buffer_p(buffer)
+    , d_createCache(createCache)
+    , d_released_p(released)
+    , d_resume_p(resume)
+    , d_reallocated_p(reallocated)
+    {
+    }
+
+    // ACCESSORS
+    void operator()() const
+    {
+        if (d_createCache) {
+            bdlbb::BlobBuffer dummy;
+            d_factory_p->allocate(&dummy);
+        }
+
+        d_buffer_p->reset();
+        d_released_p->post();
+        d_resume_p->wait();
+
+        bdlbb::BlobBuffer buffer;
+        d_factory_p->allocate(&buffer);
+        *d_reallocated_p = buffer.data();
+    }
+};
+
+class BuildBlobs {
+    // This functor builds and destroys a series of blobs of varying lengths
+    // using a factory, optionally verifying their contents.
+
+    // DATA
+    bdlbb::BlobBufferFactory *d_factory_p;
+    int                       d_numIterations;
+    int                       d_maxLength;
+    bool                      d_verify;
+    bslmt::Barrier           *d_barrier_p;
+    bsls::AtomicInt          *d_errors_p;
+
+  public:
+    // CREATORS
+    BuildBlobs(bdlbb::BlobBufferFactory *factory,
+               int                       numIterations,
+               int                       maxLength,
+               bool                      verify,
+               bslmt::Barrier           *barrier,
+               bsls::AtomicInt          *errors)
+    : d_factory_p(factory)
+    , d_numIterations(numIterations)
+    , d_maxLength(maxLength)
+    , d_verify(verify)
+    , d_barrier_p(barrier)
+    , d_errors_p(errors)
+    {
+    }
+
+    // ACCESSORS
+    void operator()() const
+    {
+        const char fill = static_cast<char>(
+                        bslmt::ThreadUtil::selfIdAsUint64() & 0x7F);
+
+        d_barrier_p->wait();
+
+        for (int i = 0; i < d_numIterations; ++i) {
+            bdlbb::Blob blob(d_factory_p);
+            blob.setLength(1 + (i * 7919) % d_maxLength);
+
+            if (!d_verify) {
+                continue;
+            }
+            for (int j = 0; j < blob.numDataBuffers(); ++j) {
+                const bdlbb::BlobBuffer& buffer = blob.buffer(j);
+                bsl::memset(buffer.data(), fill, buffer.size());
+            }
+            bslmt::ThreadUtil::yield();
+            for (int j = 0; j < blob.numDataBuffers(); ++j) {
+                const bdlbb::BlobBuffer& buffer = blob.buffer(j);
+                for (int k = 0; k < buffer.size(); ++k) {
+                    if (fill != buffer.data()[k]) {
+                        ++*d_errors_p;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+};
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test            = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    const bool verbose         = argc > 2;
+    const bool veryVerbose     = argc > 3;
+    const bool veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Building Messages of Varying Sizes
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we build outgoing messages in blobs, and that most messages
+// are small, while some carry large attachments.  We create a factory whose
+// default buffers are 1 KB, with larger size classes of up to 64 KB:
+//..
+    bdlbb::ThreadCachedBlobBufferFactory factory(1024, 64 * 1024);
+    ASSERT(1024      == factory.bufferSize());
+    ASSERT(64 * 1024 == factory.maxBufferSize());
+//..
+// Then, we build a small message, letting the blob obtain 1 KB buffers from
+// the factory as needed:
+//..
+    bdlbb::Blob header(&factory);
+    header.setLength(1500);
+    ASSERT(2    == header.numBuffers());
+    ASSERT(1024 == header.buffer(0).size());
+//..
+// Next, when the size of an attachment is known up front, we can allocate a
+// single buffer of a larger size class for it directly:
+//..
+    bdlbb::BlobBuffer attachment;
+    factory.allocate(&attachment, 20000);
+    ASSERT(32 * 1024 == attachment.size());
+//..
+// Finally, note that when 'header' and 'attachment' are destroyed, their
+// buffers are returned to this thread's cache, and will be reused by the next
+// allocations of the corresponding sizes made by this thread.
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCERN: CONCURRENT USE FROM MULTIPLE THREADS
+        //
+        // Concerns:
+        //: 1 Buffers supplied concurrently to several threads are distinct.
+        //:
+        //: 2 Threads exiting while the factory is in use do not disturb other
+        //:   threads, and their caches are reused by subsequent threads.
+        //:
+        //: 3 All memory is released when the factory is destroyed.
+        //
+        // Plan:
+        //: 1 In several rounds, start a group of threads that build blobs of
+        //:   varying lengths, fill each buffer with a thread-specific value,
+        //:   and verify the value after yielding.  (C-1..2)
+        //:
+        //: 2 Verify that the test allocator has no outstanding memory after
+        //:   destroying the factory.  (C-3)
+        //
+        // Testing:
+        //   CONCERN: CONCURRENT USE FROM MULTIPLE THREADS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: CONCURRENT USE FROM MULTIPLE THREADS"
+                          << endl
+                          << "============================================="
+                          << endl;
+
+        enum { k_NUM_THREADS = 6, k_NUM_ROUNDS = 3, k_NUM_ITERATIONS = 500 };
+
+        bslma::TestAllocator ta("factory", veryVeryVerbose);
+        {
+            Obj             mX(32, 512, 4, &ta);
+            bsls::AtomicInt errors(0);
+
+            for (int round = 0; round < k_NUM_ROUNDS; ++round) {
+                if (veryVerbose) { T_ P(round) }
+
+                bslmt::Barrier     barrier(k_NUM_THREADS);
+                bslmt::ThreadGroup group;
+
+                ASSERT(k_NUM_THREADS == group.addThreads(
+                                           BuildBlobs(&mX,
+                                                      k_NUM_ITERATIONS,
+                                                      4000,
+                                                      true,
+                                                      &barrier,
+                                                      &errors),
+                                           k_NUM_THREADS));
+                group.joinAll();
+            }
+            ASSERTV(errors, 0 == errors);
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCERN: RELEASED BUFFERS ARE CACHED BY THE RELEASING THREAD
+        //
+        // Concerns:
+        //: 1 A buffer released by a thread having a cache is retained by that
+        //:   thread, and is not supplied to other threads.
+        //:
+        //: 2 A buffer released by a thread having no cache, or a full cache,
+        //:   is returned to the shared pool.
+        //:
+        //: 3 The buffers cached by a thread are returned to the shared pool
+        //:   when the thread exits.
+        //
+        // Plan:
+        //: 1 Allocate a buffer in the main thread and release it in another
+        //:   thread having a cache.  While that thread is alive, verify that
+        //:   the main thread is supplied a different buffer, and that the
+        //:   other thread is supplied the released buffer.  After the other
+        //:   thread exits, verify that the main thread is supplied one of the
+        //:   buffers that were cached by the other thread.  (C-1, 3)
+        //:
+        //: 2 Repeat P-1 with a thread that releases the buffer without
+        //:   having a cache, and with a factory whose cache capacity is 0,
+        //:   and verify that the released buffer is supplied to the main
+        //:   thread.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: RELEASED BUFFERS ARE CACHED BY THE RELEASING THREAD
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                   << "CONCERN: RELEASED BUFFERS ARE CACHED BY THE RELEASING "
+                   << "THREAD" << endl
+                   << "====================================================="
+                   << "======" << endl;
+
+        bslma::TestAllocator ta("factory", veryVeryVerbose);
+
+        if (verbose) cout << "\tReleasing thread has a cache." << endl;
+        {
+            Obj mX(64, &ta);
+
+            bdlbb::BlobBuffer buffer;
+            mX.allocate(&buffer);
+            char *const ADDRESS = buffer.data();
+
+            bslmt::Semaphore released;
+            bslmt::Semaphore resume;
+            char            *reallocated = 0;
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                                      &handle,
+                                      ReleaseInOtherThread(&mX,
+                                                           &buffer,
+                                                           true,
+                                                           &released,
+                                                           &resume,
+                                                           &reallocated)));
+            released.wait();
+
+            bdlbb::BlobBuffer other;
+            mX.allocate(&other);
+            ASSERT(ADDRESS != other.data());
+
+            resume.post();
+            bslmt::ThreadUtil::join(handle);
+            ASSERT(ADDRESS == reallocated);
+
+            // The other thread's cache, holding two buffers, has been
+            // returned to the shared pool.
+
+            bdlbb::BlobBuffer afterExit;
+            mX.allocate(&afterExit);
+            ASSERT(other.data() != afterExit.data());
+
+            bdlbb::BlobBuffer afterExit2;
+            mX.allocate(&afterExit2);
+            ASSERT(ADDRESS == afterExit.data()
+                || ADDRESS == afterExit2.data());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tReleasing thread has no cache." << endl;
+        {
+            Obj mX(64, &ta);
+
+            bdlbb::BlobBuffer buffer;
+            mX.allocate(&buffer);
+            char *const ADDRESS = buffer.data();
+
+            bslmt::Semaphore released;
+            bslmt::Semaphore resume;
+            char            *reallocated = 0;
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                                      &handle,
+                                      ReleaseInOtherThread(&mX,
+                                                           &buffer,
+                                                           false,
+                                                           &released,
+                                                           &resume,
+                                                           &reallocated)));
+            released.wait();
+
+            bdlbb::BlobBuffer other;
+            mX.allocate(&other);
+            ASSERT(ADDRESS == other.data());
+
+            resume.post();
+            bslmt::ThreadUtil::join(handle);
+            ASSERT(ADDRESS != reallocated);
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tCache capacity is 0." << endl;
+        {
+            Obj mX(64, 64, 0, &ta);
+
+            bdlbb::BlobBuffer buffer;
+            mX.allocate(&buffer);
+            char *const ADDRESS = buffer.data();
+
+            bslmt::Semaphore released;
+            bslmt::Semaphore resume;
+            char            *reallocated = 0;
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                                      &handle,
+                                      ReleaseInOtherThread(&mX,
+                                                           &buffer,
+                                                           true,
+                                                           &released,
+                                                           &resume,
+                                                           &reallocated)));
+            released.wait();
+
+            bdlbb::BlobBuffer other;
+            mX.allocate(&other);
+            ASSERT(ADDRESS == other.data());
+
+            resume.post();
+            bslmt::ThreadUtil::join(handle);
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'allocate'
+        //
+        // Concerns:
+        //: 1 'allocate(BlobBuffer *)' supplies a buffer of 'bufferSize()'
+        //:   bytes.
+        //:
+        //: 2 'allocate(BlobBuffer *, int)' supplies a buffer of the smallest
+        //:   size class that can hold the requested size, or a buffer of
+        //:   exactly the requested size if it exceeds 'maxBufferSize()'.
+        //:
+        //: 3 Every byte of a supplied buffer is writable, and buffers are
+        //:   maximally aligned.
+        //:
+        //: 4 A buffer released by the allocating thread is supplied again by
+        //:   the next allocation of the same size class in that thread.
+        //:
+        //: 5 Buffers remain valid while any copy of the 'BlobBuffer' exists.
+        //:
+        //: 6 All memory is released when the factory is destroyed.
+        //:
+        //: 7 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For a factory having several size classes, allocate buffers for
+        //:   all sizes up to twice 'maxBufferSize()', verify their sizes and
+        //:   alignment, and write to every byte.  (C-1..3)
+        //:
+        //: 2 Allocate, release, and reallocate a buffer of each size class,
+        //:   and verify that the same address is supplied.  (C-4)
+        //:
+        //: 3 Copy a 'BlobBuffer', reset the original, and verify that the
+        //:   copy's buffer is not supplied to a subsequent allocation.  (C-5)
+        //:
+        //: 4 Use a test allocator, and verify that no memory is outstanding
+        //:   after the factory is destroyed.  (C-6)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-7)
+        //
+        // Testing:
+        //   void allocate(BlobBuffer *);
+        //   void allocate(BlobBuffer *, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'allocate'" << endl
+                          << "==================" << endl;
+
+        bslma::TestAllocator ta("factory", veryVeryVerbose);
+        {
+            Obj mX(16, 256, &ta);  const Obj& X = mX;
+
+            bdlbb::BlobBuffer buffer;
+            mX.allocate(&buffer);
+            ASSERT(16 == buffer.size());
+
+            for (int size = 1; size <= 2 * X.maxBufferSize(); ++size) {
+                int expected = X.bufferSize();
+                while (expected < size) {
+                    expected *= 2;
+                }
+                if (expected > X.maxBufferSize()) {
+                    expected = size;
+                }
+
+                bdlbb::BlobBuffer buffer;
+                mX.allocate(&buffer, size);
+                ASSERTV(size, expected, buffer.size(),
+                        expected == buffer.size());
+                ASSERTV(size, 0 == (reinterpret_cast<bsls::Types::UintPtr>(
+                                                               buffer.data())
+                             % bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT));
+                bsl::memset(buffer.data(), 0xA5, buffer.size());
+            }
+
+            for (int size = X.bufferSize(); size <= X.maxBufferSize();
+                                                                   size *= 2) {
+                bdlbb::BlobBuffer buffer;
+                mX.allocate(&buffer, size);
+                char *const ADDRESS = buffer.data();
+
+                buffer.reset();
+
+                mX.allocate(&buffer, size);
+                ASSERTV(size, ADDRESS == buffer.data());
+            }
+
+            bdlbb::BlobBuffer original;
+            mX.allocate(&original);
+            bdlbb::BlobBuffer copy(original);
+            original.reset();
+            mX.allocate(&original);
+            ASSERT(copy.data() != original.data());
+            ASSERT(1 < ta.numBlocksInUse());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(16, 256, &ta);
+
+            bdlbb::BlobBuffer buffer;
+            ASSERT_PASS(mX.allocate(&buffer));
+            ASSERT_FAIL(mX.allocate(0));
+            ASSERT_PASS(mX.allocate(&buffer, 1));
+            ASSERT_FAIL(mX.allocate(&buffer, 0));
+            ASSERT_FAIL(mX.allocate(0, 1));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor configures the factory as specified, and the
+        //:   accessors report that configuration.
+        //:
+        //: 2 The allocator supplied at construction (or the default allocator)
+        //:   is used for all memory, and all memory is released on
+        //:   destruction.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create factories with each constructor and a table of
+        //:   configurations, verify the accessors, allocate from each size
+        //:   class, and verify that memory is obtained from the expected
+        //:   allocator and released on destruction.  (C-1..2)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-3)
+        //
+        // Testing:
+        //   ThreadCachedBlobBufferFactory(int, Allocator * = 0);
+        //   ThreadCachedBlobBufferFactory(int, int, Allocator * = 0);
+        //   ThreadCachedBlobBufferFactory(int, int, int, Allocator * = 0);
+        //   ~ThreadCachedBlobBufferFactory();
+        //   int bufferSize() const;
+        //   int maxBufferSize() const;
+        //   int maxCachedBuffers() const;
+        //   int numSizeClasses() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING CREATORS AND ACCESSORS" << endl
+                          << "==============================" << endl;
+
+        static const struct {
+            int d_line;
+            int d_bufferSize;
+            int d_maxBufferSize;
+            int d_numSizeClasses;
+        } DATA[] = {
+            //LINE  SIZE   MAX       NUM
+            //----  ----   -------   ---
+            { L_,      1,        1,    1 },
+            { L_,      1,        2,    2 },
+            { L_,      1,   0x8000,   16 },
+            { L_,      3,       24,    4 },
+            { L_,     64,       64,    1 },
+            { L_,   1000,     8000,    4 },
+            { L_,   4096,  1 << 20,    9 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE = DATA[ti].d_line;
+            const int SIZE = DATA[ti].d_bufferSize;
+            const int MAX  = DATA[ti].d_maxBufferSize;
+            const int NUM  = DATA[ti].d_numSizeClasses;
+
+            for (char cfg = 'a'; cfg <= 'c'; ++cfg) {
+                if (veryVerbose) { T_ P_(LINE) P(cfg) }
+
+                bslma::TestAllocator da("default", veryVeryVerbose);
+                bslma::TestAllocator sa("supplied", veryVeryVerbose);
+
+                bslma::DefaultAllocatorGuard dag(&da);
+
+                Obj *objPtr = 0;
+                switch (cfg) {
+                  case 'a': {
+                    objPtr = new (sa) Obj(SIZE, &sa);
+                  } break;
+                  case 'b': {
+                    objPtr = new (sa) Obj(SIZE, MAX, &sa);
+                  } break;
+                  case 'c': {
+                    objPtr = new (sa) Obj(SIZE, MAX, 7, &sa);
+                  } break;
+                }
+                Obj& mX = *objPtr;  const Obj& X = mX;
+
+                const int EXP_NUM = 'a' == cfg ? 1 : NUM;
+
+                ASSERTV(LINE, cfg, SIZE == X.bufferSize());
+                ASSERTV(LINE, cfg, EXP_NUM == X.numSizeClasses());
+                ASSERTV(LINE, cfg,
+                        (SIZE << (EXP_NUM - 1)) == X.maxBufferSize());
+                ASSERTV(LINE, cfg,
+                        ('c' == cfg ? 7 : Obj::k_DEFAULT_MAX_CACHED_BUFFERS)
+                                                      == X.maxCachedBuffers());
+
+                for (int i = 0; i < X.numSizeClasses(); ++i) {
+                    bdlbb::BlobBuffer buffer;
+                    mX.allocate(&buffer, SIZE << i);
+                    ASSERTV(LINE, cfg, i, (SIZE << i) == buffer.size());
+                }
+
+                ASSERTV(LINE, cfg, 0 == da.numBlocksTotal());
+                ASSERTV(LINE, cfg, 0 <  sa.numBlocksInUse());
+
+                sa.deleteObject(objPtr);
+
+                ASSERTV(LINE, cfg, 0 == sa.numBlocksInUse());
+            }
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Obj(1));
+            ASSERT_FAIL(Obj(0));
+            ASSERT_PASS(Obj(4, 16));
+            ASSERT_FAIL(Obj(4, 24));
+            ASSERT_FAIL(Obj(4, 2));
+            ASSERT_FAIL(Obj(1, 1 << Obj::k_MAX_NUM_SIZE_CLASSES));
+            ASSERT_FAIL(Obj(1 << 20, INT_MAX));
+            ASSERT_FAIL(Obj(INT_MAX, INT_MAX - 1));
+            ASSERT_PASS(Obj(1 << 29, 1 << 30));
+            ASSERT_PASS(Obj(4, 16, 0));
+            ASSERT_FAIL(Obj(4, 16, -1));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Build, grow, shrink, and destroy blobs using a factory, and
+        //:   verify the buffers supplied.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("factory", veryVeryVerbose);
+        {
+            Obj mX(100, 400, &ta);
+
+            bdlbb::Blob blob(&mX, &ta);
+            blob.setLength(1000);
+            ASSERT(10   == blob.numBuffers());
+            ASSERT(100  == blob.buffer(9).size());
+            ASSERT(1000 == blob.totalSize());
+
+            bdlbb::BlobBuffer large;
+            mX.allocate(&large, 300);
+            ASSERT(400 == large.size());
+
+            blob.appendDataBuffer(large);
+            ASSERT(1400 == blob.length());
+
+            blob.removeAll();
+
+            blob.setLength(50);
+            ASSERT(1 == blob.numBuffers());
+        }
+        ASSERT(0 < ta.numBlocksTotal());
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: MULTI-THREADED BLOB CONSTRUCTION AND DESTRUCTION
+        //
+        // Concerns:
+        //: 1 Building and destroying blobs from several threads is faster
+        //:   with 'ThreadCachedBlobBufferFactory' than with
+        //:   'PooledBlobBufferFactory'.
+        //
+        // Plan:
+        //: 1 For each factory, and for 1, 2, 4, and 8 threads, have each
+        //:   thread build and destroy a fixed number of blobs of varying
+        //:   lengths, and report the elapsed wall time.  An optional second
+        //:   argument specifies the number of iterations per thread.
+        //
+        // Testing:
+        //   PERFORMANCE: MULTI-THREADED BLOB CONSTRUCTION AND DESTRUCTION
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: MULTI-THREADED BLOB CONSTRUCTION AND DESTRUCTION"
+             << endl
+             << "============================================================="
+             << endl;
+
+        const int NUM_ITERATIONS = argc > 2 ? bsl::atoi(argv[2]) : 200000;
+        const int BUFFER_SIZE    = 1024;
+        const int MAX_LENGTH     = 16 * BUFFER_SIZE;
+
+        for (int numThreads = 1; numThreads <= 8; numThreads *= 2) {
+            double elapsed[2];
+
+            for (int fi = 0; fi < 2; ++fi) {
+                bdlbb::PooledBlobBufferFactory pooled(BUFFER_SIZE);
+                Obj                            cached(BUFFER_SIZE);
+
+                bdlbb::BlobBufferFactory *factory = &cached;
+                if (0 == fi) {
+                    factory = &pooled;
+                }
+
+                bslmt::Barrier     barrier(numThreads + 1);
+                bsls::AtomicInt    errors(0);
+                bslmt::ThreadGroup group;
+
+                group.addThreads(BuildBlobs(factory,
+                                            NUM_ITERATIONS,
+                                            MAX_LENGTH,
+                                            false,
+                                            &barrier,
+                                            &errors),
+                                 numThreads);
+
+                bsls::Stopwatch timer;
+                timer.start();
+                barrier.wait();
+                group.joinAll();
+                timer.stop();
+
+                elapsed[fi] = timer.elapsedTime();
+            }
+
+            cout << "threads: "   << numThreads
+                 << "\tpooled: "  << elapsed[0]
+                 << "s\tcached: " << elapsed[1]
+                 << "s\tratio: "  << elapsed[0] / elapsed[1] << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
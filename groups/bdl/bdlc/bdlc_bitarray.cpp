@@ -5,9 +5,12 @@
 BSLS_IDENT_RCSID(bdlc_bitarray_cpp,"$Id$ $CSID$")
 
 #include <bdlb_bitstringutil.h>
+#include <bdlb_bitutil.h>
 
 #include <bslmf_assert.h>
+#include <bslmt_once.h>
 #include <bsls_assert.h>
+#include <bsls_platform.h>
 
 #include <bsl_algorithm.h>
 #include <bsl_ostream.h>
@@ -15,14 +18,318 @@ BSLS_IDENT_RCSID(bdlc_bitarray_cpp,"$Id$ $CSID$")
 
 #include <bsl_c_limits.h>    // 'CHAR_BIT'
 
+// Compiler-specific and platform-specific
+#if defined(BSLS_PLATFORM_CPU_X86_64)
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+#define LIKE_X86_64_GCC
+#endif
+#endif
+
+#if defined(LIKE_X86_64_GCC)
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
 using bsl::size_t;
 using bsl::uint64_t;
 
 // Note that we ensure that the capacity of 'd_array' is at least 1 at all
 // times.  This way we know that '&d_array.front()' is always valid.
 
+// IMPLEMENTATION NOTES
+// --------------------
+// The rank index of an array having 'N' bits consists of 'N / 2048 + 1' block
+// entries, one for each (possibly partial, or empty) block of 2048 bits, and
+// one span entry for each 32 blocks.  The span entry 's' holds the number of
+// 1 bits preceding bit '65536 * s'.  Bits 32 to 63 of the block entry 'b'
+// hold the number of 1 bits between the start of the span containing block
+// 'b' and the start of block 'b' (less than 2^16), and bits '10 * q' to
+// '10 * q + 9', for 'q' in '[0 .. 2]', hold the number of 1 bits in the
+// quarter 'q' of block 'b' (at most 512).  The number of 1 bits preceding any
+// index is thus obtained from one span entry, one block entry, and the
+// population count of at most seven words and one partial word.  Note that
+// the final block entry describes the bits (if any) following the last
+// complete block, so that 'rank1(length())' needs no special case.
+
 namespace BloombergLP {
 namespace bdlc {
+namespace {
+
+enum {
+    k_WORDS_PER_SUBBLOCK   = 8,   // words in each quarter of a block
+    k_SUBBLOCK_COUNT_BITS  = 10,  // bits holding the count of a quarter
+    k_SUBBLOCK_COUNT_MASK  = (1 << k_SUBBLOCK_COUNT_BITS) - 1,
+    k_SUBBLOCKS_PER_BLOCK  = 4,   // quarters in each block
+    k_RELATIVE_RANK_SHIFT  = 32   // position of the rank within the span
+};
+
+                        // -----------------------
+                        // Portable Implementation
+                        // -----------------------
+
+size_t countPortable(const uint64_t *words, size_t numBits)
+    // Return the number of 1 bits in the first specified 'numBits' of the
+    // specified 'words'.
+{
+    size_t       count    = 0;
+    const size_t numWords = numBits / BitArray::k_BITS_PER_UINT64;
+
+    for (size_t i = 0; i < numWords; ++i) {
+        count += bdlb::BitUtil::numBitsSet(words[i]);
+    }
+
+    const int rem = static_cast<int>(numBits % BitArray::k_BITS_PER_UINT64);
+    if (rem) {
+        count += bdlb::BitUtil::numBitsSet(
+                    words[numWords] & ((static_cast<uint64_t>(1) << rem) - 1));
+    }
+    return count;
+}
+
+size_t selectPortable(const uint64_t *words, uint64_t flip, size_t rank)
+    // Return the position, relative to the first bit of the specified
+    // 'words', of the bit having a value of 1 in the sequence of words
+    // 'words[i] ^ flip' (for the specified 'flip') that is preceded in that
+    // sequence by exactly the specified 'rank' such bits.  The behavior is
+    // undefined unless there is such a bit.
+{
+    size_t   position = 0;
+    uint64_t word     = *words ^ flip;
+    size_t   count    = bdlb::BitUtil::numBitsSet(word);
+
+    while (count <= rank) {
+        rank     -= count;
+        position += BitArray::k_BITS_PER_UINT64;
+        word      = *++words ^ flip;
+        count     = bdlb::BitUtil::numBitsSet(word);
+    }
+
+    // Skip whole bytes, then clear the lowest 'rank' remaining 1 bits.
+
+    for (count = bdlb::BitUtil::numBitsSet(word & 0xff);
+         count <= rank;
+         count = bdlb::BitUtil::numBitsSet(word & 0xff)) {
+        rank     -= count;
+        position += 8;
+        word    >>= 8;
+    }
+    for (; rank; --rank) {
+        word &= word - 1;
+    }
+    return position + bdlb::BitUtil::numTrailingUnsetBits(word);
+}
+
+#if defined(LIKE_X86_64_GCC)
+
+                        // -------------------------------
+                        // 'POPCNT' and BMI2 Implementation
+                        // -------------------------------
+
+__attribute__((target("popcnt")))
+size_t countPopcnt(const uint64_t *words, size_t numBits)
+    // Return the number of 1 bits in the first specified 'numBits' of the
+    // specified 'words'.  The behavior is undefined unless the processor
+    // supports the 'POPCNT' instruction.
+{
+    size_t       count    = 0;
+    const size_t numWords = numBits / BitArray::k_BITS_PER_UINT64;
+
+    for (size_t i = 0; i < numWords; ++i) {
+        count += __builtin_popcountll(words[i]);
+    }
+
+    const int rem = static_cast<int>(numBits % BitArray::k_BITS_PER_UINT64);
+    if (rem) {
+        count += __builtin_popcountll(
+                    words[numWords] & ((static_cast<uint64_t>(1) << rem) - 1));
+    }
+    return count;
+}
+
+__attribute__((target("popcnt,bmi,bmi2")))
+size_t selectBmi2(const uint64_t *words, uint64_t flip, size_t rank)
+    // Return the position, relative to the first bit of the specified
+    // 'words', of the bit having a value of 1 in the sequence of words
+    // 'words[i] ^ flip' (for the specified 'flip') that is preceded in that
+    // sequence by exactly the specified 'rank' such bits.  The behavior is
+    // undefined unless there is such a bit, and the processor supports the
+    // 'POPCNT', BMI, and BMI2 instructions.
+{
+    size_t             position = 0;
+    unsigned long long word     = *words ^ flip;
+    size_t             count    = __builtin_popcountll(word);
+
+    while (count <= rank) {
+        rank     -= count;
+        position += BitArray::k_BITS_PER_UINT64;
+        word      = *++words ^ flip;
+        count     = __builtin_popcountll(word);
+    }
+
+    // Deposit a single bit at the position of the 'rank'th 1 bit of 'word'.
+
+    return position + _tzcnt_u64(_pdep_u64(1ULL << rank, word));
+}
+
+int detectFeatures()
+    // Return the bitwise-OR of the 'BitArray_Impl::Feature' values supported
+    // by the processor.
+{
+    unsigned int eax, ebx, ecx, edx;
+
+    if (__get_cpuid_max(0, 0) < 7) {
+        return 0;                                                     // RETURN
+    }
+
+    __cpuid(1, eax, ebx, ecx, edx);
+    const bool hasPopcnt = ecx & (1u << 23);
+
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    const bool hasBmi    = ebx & (1u << 3);
+    const bool hasBmi2   = ebx & (1u << 8);
+
+    int features = 0;
+
+    if (hasPopcnt) {
+        features |= BitArray_Impl::e_POPCNT;
+    }
+    if (hasBmi && hasBmi2) {
+        features |= BitArray_Impl::e_BMI2;
+    }
+
+    return features;
+}
+
+#else
+
+int detectFeatures()
+    // Return the bitwise-OR of the 'BitArray_Impl::Feature' values supported
+    // by the processor.
+{
+    return 0;
+}
+
+#endif  // LIKE_X86_64_GCC
+
+class RankKernel {
+    // This class provides a namespace for the kernels used by rank and select
+    // operations, selected according to the features of the processor
+    // detected on first use.
+
+  public:
+    // TYPES
+    typedef size_t (*CountFn)(const uint64_t *words, size_t numBits);
+        // 'CountFn' is an alias for a function counting the 1 bits at the
+        // start of a sequence of words.
+
+    typedef size_t (*SelectFn)(const uint64_t *words,
+                               uint64_t        flip,
+                               size_t          rank);
+        // 'SelectFn' is an alias for a function locating the bit of a given
+        // rank in a sequence of words.
+
+  private:
+    // CLASS DATA
+    static int      s_supported;  // supported features
+    static int      s_enabled;    // features in use
+    static CountFn  s_countFn;    // selected counting kernel
+    static SelectFn s_selectFn;   // selected selection kernel
+
+    // PRIVATE CLASS METHODS
+    static void initialize();
+        // Detect the features of the processor and select the kernels to use
+        // if this has not already been done.
+
+    static void selectImpl(int features);
+        // Select the fastest kernels using only those of the specified
+        // 'features' that are supported.  The behavior is undefined unless
+        // the supported features have been detected.
+
+  public:
+    // CLASS METHODS
+    static void select(int features);
+        // Select the fastest kernels using only those of the specified
+        // 'features' that are supported.
+
+    static int enabled();
+        // Return the features used by the selected kernels.
+
+    static int supported();
+        // Return the features supported by the processor.
+
+    static CountFn countFn();
+        // Return the selected counting kernel.
+
+    static SelectFn selectFn();
+        // Return the selected selection kernel.
+};
+
+// CLASS DATA
+int                  RankKernel::s_supported = 0;
+int                  RankKernel::s_enabled   = 0;
+RankKernel::CountFn  RankKernel::s_countFn   = &countPortable;
+RankKernel::SelectFn RankKernel::s_selectFn  = &selectPortable;
+
+// PRIVATE CLASS METHODS
+void RankKernel::initialize()
+{
+    BSLMT_ONCE_DO {
+        s_supported = detectFeatures();
+        selectImpl(s_supported);
+    }
+}
+
+void RankKernel::selectImpl(int features)
+{
+    s_enabled  = features & s_supported;
+    s_countFn  = &countPortable;
+    s_selectFn = &selectPortable;
+
+#if defined(LIKE_X86_64_GCC)
+    if (s_enabled & BitArray_Impl::e_POPCNT) {
+        s_countFn = &countPopcnt;
+
+        if (s_enabled & BitArray_Impl::e_BMI2) {
+            s_selectFn = &selectBmi2;
+        }
+    }
+#endif
+}
+
+// CLASS METHODS
+void RankKernel::select(int features)
+{
+    initialize();
+    selectImpl(features);
+}
+
+int RankKernel::enabled()
+{
+    initialize();
+    return s_enabled;
+}
+
+int RankKernel::supported()
+{
+    initialize();
+    return s_supported;
+}
+
+inline
+RankKernel::CountFn RankKernel::countFn()
+{
+    initialize();
+    return s_countFn;
+}
+
+inline
+RankKernel::SelectFn RankKernel::selectFn()
+{
+    initialize();
+    return s_selectFn;
+}
+
+}  // close unnamed namespace
 
 static inline
 uint64_t rawLt64(int numBits)
@@ -43,10 +350,259 @@ BSLMF_ASSERT(sizeof(uint64_t) * CHAR_BIT == BitArray::k_BITS_PER_UINT64);
                                 // class BitArray
                                 // --------------
 
+// PRIVATE MANIPULATORS
+void BitArray::reserveRankIndexCapacity(size_t numBits)
+{
+    BSLS_ASSERT(!d_rankBlocks.empty());
+
+    // Grow geometrically, so that appending bits one at a time takes
+    // amortized constant time.
+
+    const size_t numBlocks = numBits / k_RANK_BLOCK_BITS + 1;
+    if (numBlocks > d_rankBlocks.capacity()) {
+        d_rankBlocks.reserve(bsl::max(numBlocks,
+                                      2 * d_rankBlocks.capacity()));
+    }
+
+    const size_t numSpans = (numBlocks + k_RANK_BLOCKS_PER_SPAN - 1) /
+                                                        k_RANK_BLOCKS_PER_SPAN;
+    if (numSpans > d_rankSpans.capacity()) {
+        d_rankSpans.reserve(bsl::max(numSpans, 2 * d_rankSpans.capacity()));
+    }
+}
+
+void BitArray::updateRankIndexRaw(size_t begin, size_t end)
+{
+    BSLS_ASSERT(!d_rankBlocks.empty());
+
+    const size_t numBlocks = d_length / k_RANK_BLOCK_BITS + 1;
+    const size_t numSpans  = (numBlocks + k_RANK_BLOCKS_PER_SPAN - 1) /
+                                                        k_RANK_BLOCKS_PER_SPAN;
+
+    bool toEnd = k_INVALID_INDEX == end || d_length <= end;
+
+    if (numBlocks != d_rankBlocks.size()) {
+        // The capacity has been reserved by the caller, so these do not
+        // throw.  Note that the entries of the blocks preceding the block
+        // containing 'begin' remain valid.
+
+        BSLS_ASSERT(numBlocks <= d_rankBlocks.capacity());
+        BSLS_ASSERT(numSpans  <= d_rankSpans.capacity());
+
+        d_rankBlocks.resize(numBlocks);
+        d_rankSpans.resize(numSpans);
+        toEnd = true;
+    }
+
+    begin = bsl::min(begin, d_length);
+    if (!toEnd && end <= begin) {
+        return;                                                       // RETURN
+    }
+
+    const size_t firstBlock = begin / k_RANK_BLOCK_BITS;
+    const size_t lastBlock  = toEnd ? numBlocks - 1
+                                    : (end - 1) / k_RANK_BLOCK_BITS;
+    const size_t nextBlock  = lastBlock + 1;
+
+    // Record the old number of 1 bits preceding 'nextBlock', and preceding
+    // its span, to adjust the entries following the recounted blocks.
+
+    uint64_t oldNextSpanRank = 0;
+    uint64_t oldNextRank     = 0;
+    if (nextBlock < numBlocks) {
+        oldNextSpanRank = d_rankSpans[nextBlock / k_RANK_BLOCKS_PER_SPAN];
+        oldNextRank     = oldNextSpanRank +
+                          (d_rankBlocks[nextBlock] >> k_RELATIVE_RANK_SHIFT);
+    }
+
+    const RankKernel::CountFn countFn = RankKernel::countFn();
+    const uint64_t           *words   = data();
+
+    uint64_t spanRank = d_rankSpans[firstBlock / k_RANK_BLOCKS_PER_SPAN];
+    uint64_t rank     = spanRank +
+                        (d_rankBlocks[firstBlock] >> k_RELATIVE_RANK_SHIFT);
+
+    for (size_t block = firstBlock; block <= lastBlock; ++block) {
+        if (0 == block % k_RANK_BLOCKS_PER_SPAN) {
+            spanRank = rank;
+            d_rankSpans[block / k_RANK_BLOCKS_PER_SPAN] = rank;
+        }
+
+        uint64_t entry = (rank - spanRank) << k_RELATIVE_RANK_SHIFT;
+
+        for (int sub = 0; sub < k_SUBBLOCKS_PER_BLOCK; ++sub) {
+            const size_t subBegin = block * k_RANK_BLOCK_BITS +
+                                                   sub * k_RANK_SUBBLOCK_BITS;
+            if (d_length <= subBegin) {
+                break;
+            }
+
+            const size_t numBits = bsl::min<size_t>(k_RANK_SUBBLOCK_BITS,
+                                                    d_length - subBegin);
+            const uint64_t count = countFn(
+                                         words + subBegin / k_BITS_PER_UINT64,
+                                         numBits);
+            if (sub < k_SUBBLOCKS_PER_BLOCK - 1) {
+                entry |= count << (k_SUBBLOCK_COUNT_BITS * sub);
+            }
+            rank += count;
+        }
+        d_rankBlocks[block] = entry;
+    }
+
+    if (nextBlock < numBlocks && rank != oldNextRank) {
+        // Adjust the entries of the blocks following 'lastBlock' in its span
+        // (which are relative to the, possibly recounted, span entry), then
+        // the entries of the following spans.  Note that the arithmetic is
+        // modulo 2^64.
+
+        const uint64_t delta = rank - oldNextRank;
+        size_t         block = nextBlock;
+
+        if (0 != block % k_RANK_BLOCKS_PER_SPAN) {
+            const size_t   span   = block / k_RANK_BLOCKS_PER_SPAN;
+            const uint64_t adjust = oldNextSpanRank + delta -
+                                                             d_rankSpans[span];
+            const size_t   spanEnd = bsl::min(numBlocks,
+                                              (span + 1) *
+                                                       k_RANK_BLOCKS_PER_SPAN);
+
+            for (; block < spanEnd; ++block) {
+                d_rankBlocks[block] += adjust << k_RELATIVE_RANK_SHIFT;
+            }
+        }
+
+        for (size_t span = (block + k_RANK_BLOCKS_PER_SPAN - 1) /
+                                                        k_RANK_BLOCKS_PER_SPAN;
+             span < numSpans;
+             ++span) {
+            d_rankSpans[span] += delta;
+        }
+    }
+}
+
+// PRIVATE ACCESSORS
+size_t BitArray::rank1Raw(size_t index) const
+{
+    BSLS_ASSERT(!d_rankBlocks.empty());
+    BSLS_ASSERT(index <= d_length);
+
+    const size_t   block = index / k_RANK_BLOCK_BITS;
+    const uint64_t entry = d_rankBlocks[block];
+
+    size_t rank = static_cast<size_t>(
+                            d_rankSpans[block / k_RANK_BLOCKS_PER_SPAN] +
+                            (entry >> k_RELATIVE_RANK_SHIFT));
+
+    const int sub = static_cast<int>(index / k_RANK_SUBBLOCK_BITS %
+                                                       k_SUBBLOCKS_PER_BLOCK);
+    for (int i = 0; i < sub; ++i) {
+        rank += static_cast<size_t>((entry >> (k_SUBBLOCK_COUNT_BITS * i)) &
+                                                        k_SUBBLOCK_COUNT_MASK);
+    }
+
+    const size_t subBegin = block * k_RANK_BLOCK_BITS +
+                                                    sub * k_RANK_SUBBLOCK_BITS;
+    if (index != subBegin) {
+        rank += RankKernel::countFn()(data() + subBegin / k_BITS_PER_UINT64,
+                                      index - subBegin);
+    }
+    return rank;
+}
+
+size_t BitArray::selectRaw(size_t rank, bool value) const
+{
+    const uint64_t flip = value ? 0 : s_minusOne;
+
+    if (d_rankBlocks.empty()) {
+        const size_t total = value ? num1() : num0();
+
+        return rank < total ? RankKernel::selectFn()(data(), flip, rank)
+                            : k_INVALID_INDEX;                        // RETURN
+    }
+
+    const size_t total1 = rank1Raw(d_length);
+    if (rank >= (value ? total1 : d_length - total1)) {
+        return k_INVALID_INDEX;                                       // RETURN
+    }
+
+    // Find the last span preceded by at most 'rank' bits having 'value'.
+
+    const size_t spanBits = k_RANK_BLOCKS_PER_SPAN * k_RANK_BLOCK_BITS;
+
+    size_t lo = 0;
+    size_t hi = d_rankSpans.size();
+    while (hi - lo > 1) {
+        const size_t mid   = lo + (hi - lo) / 2;
+        const size_t count = static_cast<size_t>(d_rankSpans[mid]);
+
+        if ((value ? count : mid * spanBits - count) <= rank) {
+            lo = mid;
+        }
+        else {
+            hi = mid;
+        }
+    }
+    {
+        const size_t count = static_cast<size_t>(d_rankSpans[lo]);
+        rank -= value ? count : lo * spanBits - count;
+    }
+
+    // Find the last block of the span preceded (within the span) by at most
+    // 'rank' bits having 'value'.
+
+    const size_t spanBegin = lo * k_RANK_BLOCKS_PER_SPAN;
+    const size_t spanEnd   = bsl::min(d_rankBlocks.size(),
+                                      spanBegin + k_RANK_BLOCKS_PER_SPAN);
+
+    size_t block = spanBegin;
+    size_t count = 0;
+    while (block + 1 < spanEnd) {
+        const size_t count1 = static_cast<size_t>(
+                           d_rankBlocks[block + 1] >> k_RELATIVE_RANK_SHIFT);
+        const size_t next   = value
+                            ? count1
+                            : (block + 1 - spanBegin) * k_RANK_BLOCK_BITS -
+                                                                        count1;
+        if (next > rank) {
+            break;
+        }
+        count = next;
+        ++block;
+    }
+    rank -= count;
+
+    // Find the quarter of the block containing the bit.
+
+    const uint64_t entry = d_rankBlocks[block];
+
+    int sub = 0;
+    for (; sub < k_SUBBLOCKS_PER_BLOCK - 1; ++sub) {
+        const size_t count1 = static_cast<size_t>(
+                                  (entry >> (k_SUBBLOCK_COUNT_BITS * sub)) &
+                                                        k_SUBBLOCK_COUNT_MASK);
+        const size_t quarter = value ? count1 : k_RANK_SUBBLOCK_BITS - count1;
+
+        if (rank < quarter) {
+            break;
+        }
+        rank -= quarter;
+    }
+
+    const size_t word = (block * k_RANK_BLOCK_BITS +
+                         sub * k_RANK_SUBBLOCK_BITS) / k_BITS_PER_UINT64;
+
+    const RankKernel::SelectFn selectFn = RankKernel::selectFn();
+
+    return word * k_BITS_PER_UINT64 + selectFn(data() + word, flip, rank);
+}
+
 // CREATORS
 BitArray::BitArray(bslma::Allocator *basicAllocator)
 : d_array(basicAllocator)
 , d_length(0)
+, d_rankBlocks(basicAllocator)
+, d_rankSpans(basicAllocator)
 {
     d_array.resize(1);
 }
@@ -55,6 +611,8 @@ BitArray::BitArray(size_t            initialLength,
                    bslma::Allocator *basicAllocator)
 : d_array(arraySize(initialLength), 0, basicAllocator)
 , d_length(initialLength)
+, d_rankBlocks(basicAllocator)
+, d_rankSpans(basicAllocator)
 {
 }
 
@@ -63,6 +621,8 @@ BitArray::BitArray(size_t            initialLength,
                    bslma::Allocator *basicAllocator)
 : d_array(arraySize(initialLength), value ? s_minusOne : 0, basicAllocator)
 , d_length(initialLength)
+, d_rankBlocks(basicAllocator)
+, d_rankSpans(basicAllocator)
 {
     const int pos = initialLength % k_BITS_PER_UINT64;
     if (value && (pos || !initialLength)) {
@@ -74,6 +634,8 @@ BitArray::BitArray(const BitArray&   original,
                    bslma::Allocator *basicAllocator)
 : d_array(original.d_array, basicAllocator)
 , d_length(original.d_length)
+, d_rankBlocks(original.d_rankBlocks, basicAllocator)
+, d_rankSpans(original.d_rankSpans, basicAllocator)
 {
     BSLS_ASSERT(!d_array.empty());
 }
@@ -88,9 +650,36 @@ BitArray::~BitArray()
 
     BSLS_ASSERT(estimated == actual);
     BSLS_ASSERT(0 <          actual);
+    BSLS_ASSERT(d_rankBlocks.empty() ||
+                d_rankBlocks.size() == d_length / k_RANK_BLOCK_BITS + 1);
 }
 
 // MANIPULATORS
+void BitArray::disableRankIndex()
+{
+    bsl::vector<uint64_t>(allocator()).swap(d_rankBlocks);
+    bsl::vector<uint64_t>(allocator()).swap(d_rankSpans);
+}
+
+void BitArray::enableRankIndex()
+{
+    if (!d_rankBlocks.empty()) {
+        return;                                                       // RETURN
+    }
+
+    const size_t numBlocks = d_length / k_RANK_BLOCK_BITS + 1;
+    const size_t numSpans  = (numBlocks + k_RANK_BLOCKS_PER_SPAN - 1) /
+                                                        k_RANK_BLOCKS_PER_SPAN;
+
+    bsl::vector<uint64_t> blocks(numBlocks, 0, allocator());
+    bsl::vector<uint64_t> spans(numSpans, 0, allocator());
+
+    d_rankBlocks.swap(blocks);
+    d_rankSpans.swap(spans);
+
+    updateRankIndexRaw(0, k_INVALID_INDEX);
+}
+
 void BitArray::insert(size_t          dstIndex,
                       const BitArray& srcArray,
                       size_t          srcIndex,
@@ -135,6 +724,7 @@ void BitArray::insert(size_t          dstIndex,
                                      srcIndex + leftLen + numBits,
                                      rightLen);
     }
+    updateRankIndex(dstIndex, k_INVALID_INDEX);
 }
 
 void BitArray::rotateLeft(size_t numBits)
@@ -158,6 +748,7 @@ void BitArray::rotateLeft(size_t numBits)
     bdlb::BitStringUtil::copyRaw(data(), 0,       data(), oldLen, numBits);
 
     setLength(oldLen);
+    updateRankIndex(0, k_INVALID_INDEX);
 }
 
 void BitArray::rotateRight(size_t numBits)
@@ -181,10 +772,15 @@ void BitArray::rotateRight(size_t numBits)
     bdlb::BitStringUtil::copyRaw(data(), 0,      data(), numBits, oldLen);
 
     setLength(oldLen);
+    updateRankIndex(0, k_INVALID_INDEX);
 }
 
 void BitArray::setLength(size_t newLength, bool value)
 {
+    if (!d_rankBlocks.empty()) {
+        reserveRankIndexCapacity(newLength);
+    }
+
     const size_t oldLength = d_length;
     const int    oldPos    = static_cast<unsigned>(oldLength) %
                                                              k_BITS_PER_UINT64;
@@ -221,6 +817,8 @@ void BitArray::setLength(size_t newLength, bool value)
 
         d_array.back() &= rawLt64(newPos);
     }
+
+    updateRankIndex(bsl::min(oldLength, newLength), k_INVALID_INDEX);
 }
 
 // ACCESSORS
@@ -239,6 +837,26 @@ bsl::ostream& BitArray::print(bsl::ostream& stream,
                   : stream;
 }
 
+                            // -------------------
+                            // struct BitArray_Impl
+                            // -------------------
+
+// CLASS METHODS
+int BitArray_Impl::enabledFeatures()
+{
+    return RankKernel::enabled();
+}
+
+void BitArray_Impl::setEnabledFeatures(int features)
+{
+    RankKernel::select(features);
+}
+
+int BitArray_Impl::supportedFeatures()
+{
+    return RankKernel::supported();
+}
+
 }  // close package namespace
 
 // FREE FUNCTIONS
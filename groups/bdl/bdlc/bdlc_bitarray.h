@@ -9,6 +9,7 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //  bdlc::BitArray: vector-like, sequential container of boolean values
+//  bdlc::BitArray_Impl: namespace for processor-feature control of queries
 //
 //@DESCRIPTION: This component implements 'bdlc::BitArray', an efficient
 // value-semantic, sequential container of boolean values (i.e., 0 or 1) of
@@ -52,6 +53,41 @@ BSLS_IDENT("$Id: $")
 //  assert(1 == a[5]);
 //..
 //
+///Rank and Select
+///---------------
+// 'BitArray' provides the succinct-data-structure queries 'rank1' (the number
+// of 1 bits preceding a given index), 'select1' (the index of the 1 bit
+// preceded by a given number of 1 bits), and their complements 'rank0' and
+// 'select0'.  These queries are always available and, by default, take time
+// linear in the length of the array.  Calling 'enableRankIndex' builds a rank
+// index, a directory of cumulative population counts that occupies about 3.2%
+// of the space of the bits themselves, with which 'rank0' and 'rank1' take
+// constant time, and 'select0' and 'select1' take time logarithmic in the
+// length of the array.  Once enabled, the rank index is maintained by every
+// manipulator until 'disableRankIndex' is called.
+//
+// The rank index divides the array into blocks of 2048 bits, each described
+// by one 64-bit word holding the number of 1 bits between the start of the
+// enclosing 64K-bit span and the start of the block, and the number of 1 bits
+// in each of the first three 512-bit quarters of the block; a second, much
+// smaller array holds the number of 1 bits preceding each span.  A
+// manipulator modifying the bits in '[begin .. end)' without changing the
+// length of the array recounts the blocks overlapping that range, and adjusts
+// the counts of the following blocks of the same span and of the following
+// spans; a manipulator that changes the length of the array, or moves bits
+// (e.g., 'insert', 'remove', and the shift and rotate operations), recounts
+// the blocks from the first bit affected to the end of the array.  Note that
+// the rank index is not part of the value of a 'BitArray': a copy-constructed
+// object has a rank index if and only if the original does, assignment does
+// not change whether the target has a rank index, and objects are compared
+// without regard to their rank indexes.
+//
+// On x86 platforms supporting them, the queries use the 'POPCNT' instruction
+// to count bits and the BMI2 'PDEP' and 'TZCNT' instructions to locate the
+// n-th 1 bit of a word; the instructions used are selected at run time, and
+// may be restricted through 'BitArray_Impl::setEnabledFeatures', e.g., for
+// testing, or on processors with slow 'PDEP' implementations.
+//
 ///Performance and Exception-Safety Guarantees
 ///-------------------------------------------
 // The asymptotic worst-case performance of representative operations is
@@ -89,13 +125,24 @@ BSLS_IDENT("$Id: $")
 //  X.isAny1                 O[N]                   No-Throw
 //  X.isAny0                 O[N]                   No-Throw
 //
+//  X.enableRankIndex()      O[N]                   Strong
+//  X.rank1(index)           O[N]         <+>       No-Throw
+//  X.select1(rank)          O[N]         <+>       No-Throw
+//
 //  other 'const' methods    O[1] .. O[N]           No-Throw
 //
 //  OP==(X, Y)               O[min(N, M)]           No-Throw
 //  OP!=(X, Y)               O[min(N, M)]           No-Throw
 //
 //                <*> No-Throw guarantee when capacity is sufficient.
+//                <+> O[1] ('rank0', 'rank1') and O[log N] ('select0',
+//                    'select1') when a rank index is enabled.
 //..
+// Note that, when a rank index is enabled, a manipulator that increases the
+// length of an array may also need to increase the capacity of the rank
+// index, and a manipulator modifying a bit at index 'i' without changing the
+// length of the array takes additional time 'O[(N - i) / 65536]'.
+//
 // Note that *all* of the non-creator methods of 'BitArray' provide the
 // *No-Throw* guarantee whenever sufficient capacity is already available.
 //
@@ -426,6 +473,55 @@ BSLS_IDENT("$Id: $")
 //  assert(false   == ARRAY.isAnyElementNonNull());
 //  assert(false   == ARRAY.isAnyElementNull());
 //..
+//
+///Example 2: Counting Business Days
+///- - - - - - - - - - - - - - - - -
+// Suppose we hold a flag for each day in a range of dates indicating whether
+// that day is a business day, and need to count the business days between
+// two days, and to find the day that is a given number of business days after
+// a given day.
+//
+// First, we create a bit array holding a flag for each day in a range of 40
+// years, in which every fifth and sixth day of a week, and every 100th day,
+// is a holiday:
+//..
+//  const bsl::size_t NUM_DAYS = 40 * 365;
+//
+//  bdlc::BitArray businessDays(NUM_DAYS);
+//  for (bsl::size_t day = 0; day < NUM_DAYS; ++day) {
+//      if (day % 7 < 5 && 0 != day % 100) {
+//          businessDays.assign1(day);
+//      }
+//  }
+//..
+// Then, we build a rank index, so that the following queries do not need to
+// scan the array:
+//..
+//  businessDays.enableRankIndex();
+//  assert(true == businessDays.hasRankIndex());
+//..
+// Next, we count the business days in the range '[1000 .. 2000)':
+//..
+//  const bsl::size_t count = businessDays.rank1(2000) -
+//                                                    businessDays.rank1(1000);
+//  assert(businessDays.num1(1000, 2000) == count);
+//..
+// Then, we find the first day, at or after day 1000, that is preceded by 10
+// business days at or after day 1000:
+//..
+//  const bsl::size_t day = businessDays.select1(businessDays.rank1(1000) +
+//                                                                         10);
+//  assert(true == businessDays[day]);
+//  assert(10   == businessDays.num1(1000, day));
+//..
+// Finally, we declare that day a holiday, and observe that the rank index is
+// updated accordingly:
+//..
+//  businessDays.assign0(day);
+//
+//  assert(count - 1 == businessDays.rank1(2000) - businessDays.rank1(1000));
+//  assert(day        < businessDays.select1(businessDays.rank1(1000) + 10));
+//..
 
 #include <bdlscm_version.h>
 
@@ -483,10 +579,27 @@ class BitArray {
                                           bdlb::BitStringUtil::k_INVALID_INDEX;
 
   private:
+    // PRIVATE TYPES
+    enum {
+        k_RANK_BLOCK_BITS      = 2048,  // bits described by one rank-index
+                                        // block entry
+
+        k_RANK_SUBBLOCK_BITS   = 512,   // bits in each quarter of a block
+
+        k_RANK_BLOCKS_PER_SPAN = 32     // blocks in each span (of 64K bits)
+    };
+
     // DATA
-    bsl::vector<bsl::uint64_t> d_array;   // array of 64-bit words
-    bsl::size_t                d_length;  // number of significant bits in this
-                                          // array
+    bsl::vector<bsl::uint64_t> d_array;       // array of 64-bit words
+    bsl::size_t                d_length;      // number of significant bits in
+                                              // this array
+
+    bsl::vector<bsl::uint64_t> d_rankBlocks;  // rank-index entry for each
+                                              // block, or empty if this array
+                                              // has no rank index
+
+    bsl::vector<bsl::uint64_t> d_rankSpans;   // number of 1 bits preceding
+                                              // each span of the rank index
 
     // CLASS DATA
     static const bsl::uint64_t s_one      =                              1;
@@ -506,11 +619,42 @@ class BitArray {
         // Return an address providing modifiable access to the array of
         // 'uint64_t' values managed by this array.
 
+    void reserveRankIndexCapacity(bsl::size_t numBits);
+        // Reserve sufficient capacity in the rank index of this array to
+        // describe an array of the specified 'numBits'.  The behavior is
+        // undefined unless this array has a rank index.
+
+    void updateRankIndex(bsl::size_t begin, bsl::size_t end);
+        // Update the rank index of this array, if any, to reflect a
+        // modification of the bits in the range '[begin .. end)', where
+        // 'k_INVALID_INDEX == end' indicates that all bits at or beyond
+        // 'begin' may have been modified, or moved, or that the length of
+        // this array may have changed.  The behavior is undefined unless the
+        // capacity of the rank index is sufficient for the length of this
+        // array, and no bit outside the indicated range has been modified
+        // since the rank index was last updated.
+
+    void updateRankIndexRaw(bsl::size_t begin, bsl::size_t end);
+        // Update the rank index of this array as described for
+        // 'updateRankIndex'.  The behavior is undefined unless this array has
+        // a rank index.
+
     // PRIVATE ACCESSORS
     const bsl::uint64_t *data() const;
         // Return an address providing non-modifiable access to the array of
         // 'uint64_t' values managed by this array.
 
+    bsl::size_t rank1Raw(bsl::size_t index) const;
+        // Return the number of 1 bits in the range '[0 .. index)' of this
+        // array using its rank index.  The behavior is undefined unless this
+        // array has a rank index and 'index <= length()'.
+
+    bsl::size_t selectRaw(bsl::size_t rank, bool value) const;
+        // Return the index of the bit having the specified 'value' that is
+        // preceded by exactly the specified 'rank' bits having 'value' in
+        // this array, using its rank index if it has one, and
+        // 'k_INVALID_INDEX' if there is no such bit.
+
   public:
     // CLASS METHODS
 
@@ -724,6 +868,18 @@ class BitArray {
         // behavior is undefined unless 'numBits <= k_BITS_PER_UINT64' and
         // 'index + numBits <= length()'.
 
+    void disableRankIndex();
+        // Discard the rank index of this array, if any, and release the
+        // memory it occupies.  See {Rank and Select}.
+
+    void enableRankIndex();
+        // Build a rank index for this array, if it does not already have one,
+        // and maintain it across all subsequent modifications of this array
+        // until 'disableRankIndex' is called.  If an exception is thrown
+        // while building the rank index (i.e., by the memory allocator
+        // indicated at construction), this array is unchanged.  See {Rank and
+        // Select}.
+
     void insert(bsl::size_t dstIndex, bool value);
         // Insert into this array at the specified 'dstIndex' the specified
         // 'value'.  All values with indices at or above 'dstIndex' in this
@@ -809,7 +965,8 @@ class BitArray {
         // least the specified 'numBits' without reallocation.  If an exception
         // is thrown during this reallocation attempt (i.e., by the memory
         // allocator indicated at construction) the value of this array is
-        // guaranteed to be unchanged.
+        // guaranteed to be unchanged.  Note that the capacity of the rank
+        // index of this array, if any, is also increased as needed.
 
     void rotateLeft(bsl::size_t numBits);
         // Shift the values in this array to the left by the specified
@@ -935,6 +1092,10 @@ class BitArray {
         // is not specified and 'effectiveEnd == end' otherwise.  The behavior
         // is undefined unless 'begin <= effectiveEnd <= length()'.
 
+    bool hasRankIndex() const;
+        // Return 'true' if this array has a rank index, and 'false'
+        // otherwise.  See {Rank and Select}.
+
     bool isAny0() const;
         // Return 'true' if the value of any bit in this array is 0, and
         // 'false' otherwise.
@@ -966,6 +1127,36 @@ class BitArray {
         // is not specified and 'effectiveEnd == end' otherwise.  The behavior
         // is undefined unless 'begin <= effectiveEnd <= length()'.
 
+    bsl::size_t rank0(bsl::size_t index) const;
+        // Return the number of bits having a value of 0 in the range
+        // '[0 .. index)' of this array.  The behavior is undefined unless
+        // 'index <= length()'.  Note that this operation takes constant time
+        // if this array has a rank index, and time linear in 'index'
+        // otherwise.
+
+    bsl::size_t rank1(bsl::size_t index) const;
+        // Return the number of bits having a value of 1 in the range
+        // '[0 .. index)' of this array.  The behavior is undefined unless
+        // 'index <= length()'.  Note that this operation takes constant time
+        // if this array has a rank index, and time linear in 'index'
+        // otherwise.
+
+    bsl::size_t select0(bsl::size_t rank) const;
+        // Return the index of the bit having a value of 0 that is preceded in
+        // this array by exactly the specified 'rank' bits having a value of
+        // 0, and 'k_INVALID_INDEX' if 'num0() <= rank'.  Note that
+        // 'rank0(select0(rank)) == rank' if 'rank < num0()'.  Also note that
+        // this operation takes time logarithmic in the length of this array if
+        // it has a rank index, and linear otherwise.
+
+    bsl::size_t select1(bsl::size_t rank) const;
+        // Return the index of the bit having a value of 1 that is preceded in
+        // this array by exactly the specified 'rank' bits having a value of
+        // 1, and 'k_INVALID_INDEX' if 'num1() <= rank'.  Note that
+        // 'rank1(select1(rank)) == rank' if 'rank < num1()'.  Also note that
+        // this operation takes time logarithmic in the length of this array if
+        // it has a rank index, and linear otherwise.
+
                                 // Aspects
 
     bslma::Allocator *allocator() const;
@@ -1009,6 +1200,39 @@ class BitArray {
 #endif  // BDE_OPENSOURCE_PUBLICATION -- pending deprecation
 };
 
+                            // ===================
+                            // struct BitArray_Impl
+                            // ===================
+
+struct BitArray_Impl {
+    // This 'struct' provides a namespace for functions controlling which
+    // processor features are used by the rank and select operations of
+    // 'BitArray'.  By default, every supported feature is used.  These
+    // functions are intended for testing and benchmarking.
+
+    // TYPES
+    enum Feature {
+        e_POPCNT = 1 << 0,  // x86 'POPCNT' instruction
+        e_BMI2   = 1 << 1   // x86 BMI2 'PDEP' and BMI 'TZCNT' instructions
+                            // (used only in combination with 'e_POPCNT')
+    };
+
+    // CLASS METHODS
+    static int enabledFeatures();
+        // Return the bitwise OR of the 'Feature' values currently used by
+        // 'BitArray'.
+
+    static void setEnabledFeatures(int features);
+        // Use only those of the specified 'features' (a bitwise OR of
+        // 'Feature' values) that are supported by the executing processor.
+        // Note that this function is not thread-safe with respect to
+        // concurrent rank and select operations.
+
+    static int supportedFeatures();
+        // Return the bitwise OR of the 'Feature' values supported by the
+        // executing processor.
+};
+
 // FREE OPERATORS
 bool operator==(const BitArray& lhs, const BitArray& rhs);
     // Return 'true' if the specified 'lhs' and 'rhs' arrays have the same
@@ -1108,6 +1332,14 @@ bsl::uint64_t *BitArray::data()
     return d_array.data();
 }
 
+inline
+void BitArray::updateRankIndex(bsl::size_t begin, bsl::size_t end)
+{
+    if (!d_rankBlocks.empty()) {
+        updateRankIndexRaw(begin, end);
+    }
+}
+
 // PRIVATE ACCESSORS
 inline
 const bsl::uint64_t *BitArray::data() const
@@ -1131,11 +1363,18 @@ int BitArray::maxSupportedBdexVersion(int)
 inline
 BitArray& BitArray::operator=(const BitArray& rhs)
 {
-    d_array.resize(rhs.d_array.size());
-    bsl::memcpy(d_array.data(),
-                rhs.d_array.data(),
-                d_array.size() * sizeof(bsl::uint64_t));
-    d_length = rhs.d_length;
+    if (this != &rhs) {
+        if (!d_rankBlocks.empty()) {
+            reserveRankIndexCapacity(rhs.d_length);
+        }
+        d_array.resize(rhs.d_array.size());
+        bsl::memcpy(d_array.data(),
+                    rhs.d_array.data(),
+                    d_array.size() * sizeof(bsl::uint64_t));
+        d_length = rhs.d_length;
+
+        updateRankIndex(0, k_INVALID_INDEX);
+    }
 
     return *this;
 }
@@ -1156,6 +1395,7 @@ BitArray& BitArray::operator&=(const BitArray& rhs)
         assign0(rLen, d_length - rLen);
     }
     bdlb::BitStringUtil::andEqual(data(), 0, rhs.data(), 0, rLen);
+    updateRankIndex(0, rLen);
 
     return *this;
 }
@@ -1173,6 +1413,7 @@ BitArray& BitArray::operator-=(const BitArray& rhs)
         setLength(rhs.d_length, false);
     }
     bdlb::BitStringUtil::minusEqual(data(), 0, rhs.data(), 0, rhs.d_length);
+    updateRankIndex(0, rhs.d_length);
 
     return *this;
 }
@@ -1188,6 +1429,7 @@ BitArray& BitArray::operator|=(const BitArray& rhs)
         setLength(rhs.d_length, false);
     }
     bdlb::BitStringUtil::orEqual(data(), 0, rhs.data(), 0, rhs.d_length);
+    updateRankIndex(0, rhs.d_length);
 
     return *this;
 }
@@ -1205,6 +1447,7 @@ BitArray& BitArray::operator^=(const BitArray& rhs)
         setLength(rhs.d_length, false);
     }
     bdlb::BitStringUtil::xorEqual(data(), 0, rhs.data(), 0, rhs.d_length);
+    updateRankIndex(0, rhs.d_length);
 
     return *this;
 }
@@ -1219,7 +1462,8 @@ BitArray& BitArray::operator>>=(bsl::size_t numBits)
             const bsl::size_t remBits = d_length - numBits;
 
             bdlb::BitStringUtil::copyRaw(data(), 0, data(), numBits, remBits);
-            assign0(remBits, numBits);
+            bdlb::BitStringUtil::assign0(data(), remBits, numBits);
+            updateRankIndex(0, d_length);
         }
         else {
             assignAll0();
@@ -1239,7 +1483,8 @@ BitArray& BitArray::operator<<=(bsl::size_t numBits)
             const bsl::size_t remBits = d_length - numBits;
 
             bdlb::BitStringUtil::copy(data(), numBits, data(), 0, remBits);
-            assign0(0, numBits);
+            bdlb::BitStringUtil::assign0(data(), 0, numBits);
+            updateRankIndex(0, d_length);
         }
         else {
             assignAll0();
@@ -1273,11 +1518,15 @@ void BitArray::andEqual(bsl::size_t     dstIndex,
                                   srcArray.data(),
                                   srcIndex,
                                   numBits);
+    updateRankIndex(dstIndex, dstIndex + numBits);
 }
 
 inline
 void BitArray::append(bool value)
 {
+    if (!d_rankBlocks.empty()) {
+        reserveRankIndexCapacity(d_length + 1);
+    }
     if (d_length && 0 == d_length % k_BITS_PER_UINT64) {
         d_array.push_back(value);
     }
@@ -1285,6 +1534,8 @@ void BitArray::append(bool value)
         bdlb::BitStringUtil::assign1(data(), d_length);
     }
     ++d_length;
+
+    updateRankIndex(d_length - 1, k_INVALID_INDEX);
 }
 
 inline
@@ -1315,6 +1566,7 @@ void BitArray::assign(bsl::size_t index, bool value)
     BSLS_ASSERT_SAFE(index < d_length);
 
     bdlb::BitStringUtil::assign(data(), index, value);
+    updateRankIndex(index, index + 1);
 }
 
 inline
@@ -1323,6 +1575,7 @@ void BitArray::assign(bsl::size_t index, bool value, bsl::size_t numBits)
     BSLS_ASSERT(index + numBits <= d_length);
 
     bdlb::BitStringUtil::assign(data(), index, value, numBits);
+    updateRankIndex(index, index + numBits);
 }
 
 inline
@@ -1352,6 +1605,7 @@ void BitArray::assign(bsl::size_t     dstIndex,
                                      srcIndex,
                                      numBits);
     }
+    updateRankIndex(dstIndex, dstIndex + numBits);
 }
 
 inline
@@ -1360,6 +1614,7 @@ void BitArray::assign0(bsl::size_t index)
     BSLS_ASSERT_SAFE(index < d_length);
 
     bdlb::BitStringUtil::assign0(data(), index);
+    updateRankIndex(index, index + 1);
 }
 
 inline
@@ -1368,6 +1623,7 @@ void BitArray::assign0(bsl::size_t index, bsl::size_t numBits)
     BSLS_ASSERT(index + numBits <= d_length);
 
     bdlb::BitStringUtil::assign0(data(), index, numBits);
+    updateRankIndex(index, index + numBits);
 }
 
 inline
@@ -1376,6 +1632,7 @@ void BitArray::assign1(bsl::size_t index)
     BSLS_ASSERT_SAFE(index < d_length);
 
     bdlb::BitStringUtil::assign1(data(), index);
+    updateRankIndex(index, index + 1);
 }
 
 inline
@@ -1384,6 +1641,7 @@ void BitArray::assign1(bsl::size_t index, bsl::size_t numBits)
     BSLS_ASSERT(index + numBits <= d_length);
 
     bdlb::BitStringUtil::assign1(data(), index, numBits);
+    updateRankIndex(index, index + numBits);
 }
 
 inline
@@ -1400,13 +1658,13 @@ void BitArray::assignAll(bool value)
 inline
 void BitArray::assignAll0()
 {
-    bdlb::BitStringUtil::assign0(data(), 0, d_length);
+    assign0(0, d_length);
 }
 
 inline
 void BitArray::assignAll1()
 {
-    bdlb::BitStringUtil::assign1(data(), 0, d_length);
+    assign1(0, d_length);
 }
 
 inline
@@ -1418,6 +1676,7 @@ void BitArray::assignBits(bsl::size_t   index,
     BSLS_ASSERT(index + numBits <= d_length);
 
     bdlb::BitStringUtil::assignBits(data(), index, srcBits, numBits);
+    updateRankIndex(index, index + numBits);
 }
 
 inline
@@ -1435,6 +1694,7 @@ void BitArray::insert(bsl::size_t dstIndex, bool value)
 
     setLength(d_length + 1);
     bdlb::BitStringUtil::insert(data(), d_length - 1, dstIndex, value, 1);
+    updateRankIndex(dstIndex, k_INVALID_INDEX);
 }
 
 inline
@@ -1448,6 +1708,7 @@ void BitArray::insert(bsl::size_t dstIndex, bool value, bsl::size_t numBits)
                                 dstIndex,
                                 value,
                                 numBits);
+    updateRankIndex(dstIndex, k_INVALID_INDEX);
 }
 
 inline
@@ -1474,6 +1735,7 @@ void BitArray::minusEqual(bsl::size_t     dstIndex,
                                     srcArray.data(),
                                     srcIndex,
                                     numBits);
+    updateRankIndex(dstIndex, dstIndex + numBits);
 }
 
 inline
@@ -1500,6 +1762,7 @@ void BitArray::orEqual(bsl::size_t     dstIndex,
                                  srcArray.data(),
                                  srcIndex,
                                  numBits);
+    updateRankIndex(dstIndex, dstIndex + numBits);
 }
 
 inline
@@ -1517,6 +1780,7 @@ void BitArray::remove(bsl::size_t index, bsl::size_t numBits)
 
     bdlb::BitStringUtil::remove(data(), d_length, index, numBits);
     setLength(d_length - numBits);
+    updateRankIndex(index, k_INVALID_INDEX);
 }
 
 inline
@@ -1525,11 +1789,20 @@ void BitArray::removeAll()
     d_array.clear();
     d_array.resize(1);
     d_length = 0;
+
+    if (!d_rankBlocks.empty()) {
+        d_rankBlocks.resize(1);
+        d_rankBlocks.front() = 0;
+        d_rankSpans.resize(1);
+    }
 }
 
 inline
 void BitArray::reserveCapacity(bsl::size_t numBits)
 {
+    if (!d_rankBlocks.empty()) {
+        reserveRankIndexCapacity(numBits);
+    }
     d_array.reserve(arraySize(numBits));
 }
 
@@ -1555,6 +1828,7 @@ void BitArray::toggle(bsl::size_t index)
     const int         pos = static_cast<unsigned>(index) % k_BITS_PER_UINT64;
 
     d_array[idx] ^= (s_one << pos);
+    updateRankIndex(index, index + 1);
 }
 
 inline
@@ -1565,6 +1839,7 @@ void BitArray::toggle(bsl::size_t index, bsl::size_t numBits)
     // 'index' and 'numBits' non-negative checked by 'BitStringUtil'.
 
     bdlb::BitStringUtil::toggle(data(), index, numBits);
+    updateRankIndex(index, index + numBits);
 }
 
 inline
@@ -1597,6 +1872,7 @@ void BitArray::xorEqual(bsl::size_t     dstIndex,
                                   srcArray.data(),
                                   srcIndex,
                                   numBits);
+    updateRankIndex(dstIndex, dstIndex + numBits);
 }
 
                                 // Aspects
@@ -1621,14 +1897,19 @@ STREAM& BitArray::bdexStreamIn(STREAM& stream, int version)
 
             const bsl::size_t len = arraySize(newLength);
             removeAll();
+            if (!d_rankBlocks.empty()) {
+                reserveRankIndexCapacity(newLength);
+            }
             d_array.resize(len);
 
             // 'getArrayUint64' will throw if there is bad input, so to prevent
             // invariants tests in the bit array destructor from failing, we
             // must make 'd_length' consistent with 'd_array.size()' before
-            // that happens.
+            // that happens.  The rank index, if any, is likewise made
+            // consistent with the (all 0) bits.
 
             d_length = newLength;
+            updateRankIndex(0, k_INVALID_INDEX);
 
             stream.getArrayUint64(
                        reinterpret_cast<bsls::Types::Uint64 *>(d_array.data()),
@@ -1649,10 +1930,12 @@ STREAM& BitArray::bdexStreamIn(STREAM& stream, int version)
                     // is fastest way to valid, arbitrary state.
 
                     d_array.back() &= mask;
+                    updateRankIndex(0, k_INVALID_INDEX);
                     stream.invalidate();
                     return stream;                                    // RETURN
                 }
             }
+            updateRankIndex(0, k_INVALID_INDEX);
           } break;
           default: {
             stream.invalidate();
@@ -1669,8 +1952,10 @@ void BitArray::swap(BitArray& other)
 
     BSLS_ASSERT(allocator() == other.allocator());
 
-    bslalg::SwapUtil::swap(&d_array,  &other.d_array);
-    bslalg::SwapUtil::swap(&d_length, &other.d_length);
+    bslalg::SwapUtil::swap(&d_array,      &other.d_array);
+    bslalg::SwapUtil::swap(&d_length,     &other.d_length);
+    bslalg::SwapUtil::swap(&d_rankBlocks, &other.d_rankBlocks);
+    bslalg::SwapUtil::swap(&d_rankSpans,  &other.d_rankSpans);
 }
 
 // ACCESSORS
@@ -1738,6 +2023,12 @@ bsl::size_t BitArray::find1AtMinIndex(bsl::size_t begin, bsl::size_t end) const
     return bdlb::BitStringUtil::find1AtMinIndex(data(), begin, end);
 }
 
+inline
+bool BitArray::hasRankIndex() const
+{
+    return !d_rankBlocks.empty();
+}
+
 inline
 bool BitArray::isAny0() const
 {
@@ -1786,6 +2077,36 @@ bsl::size_t BitArray::num1(bsl::size_t begin, bsl::size_t end) const
     return bdlb::BitStringUtil::num1(data(), begin, end - begin);
 }
 
+inline
+bsl::size_t BitArray::rank0(bsl::size_t index) const
+{
+    BSLS_ASSERT(index <= d_length);
+
+    return index - rank1(index);
+}
+
+inline
+bsl::size_t BitArray::rank1(bsl::size_t index) const
+{
+    BSLS_ASSERT(index <= d_length);
+
+    return d_rankBlocks.empty()
+           ? bdlb::BitStringUtil::num1(data(), 0, index)
+           : rank1Raw(index);
+}
+
+inline
+bsl::size_t BitArray::select0(bsl::size_t rank) const
+{
+    return selectRaw(rank, false);
+}
+
+inline
+bsl::size_t BitArray::select1(bsl::size_t rank) const
+{
+    return selectRaw(rank, true);
+}
+
                                 // Aspects
 
 inline
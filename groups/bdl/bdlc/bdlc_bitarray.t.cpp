@@ -35,6 +35,7 @@
 #include <bsl_iostream.h>
 #include <bsl_string.h>
 #include <bsl_sstream.h>
+#include <bsl_vector.h>
 #include <bsl_new.h>         // placement new syntax
 
 #include <bsl_cctype.h>      // isspace, tolower
@@ -105,6 +106,8 @@ using bsl::uint64_t;
 // [17] void assignAll0();
 // [17] void assignAll1();
 // [29] void assignBits(size_t index, uint64_t srcBits, size_t numBits);
+// [31] void disableRankIndex();
+// [31] void enableRankIndex();
 // [13] void insert(size_t di, bool value);
 // [13] void insert(size_t di, bool value, size_t numBits);
 // [13] void insert(size_t di, const BitArray& sa);
@@ -134,6 +137,7 @@ using bsl::uint64_t;
 // [28] size_t find0AtMinIndex(size_t begin, size_t end) const;
 // [27] size_t find1AtMaxIndex(size_t begin, size_t end) const;
 // [28] size_t find1AtMinIndex(size_t begin, size_t end) const;
+// [31] bool hasRankIndex() const;
 // [ 4] bool isAny0() const;
 // [ 4] bool isAny1() const;
 // [ 4] bool isEmpty() const;
@@ -142,6 +146,10 @@ using bsl::uint64_t;
 // [30] size_t num0(size_t begin, size_t end);
 // [ 4] size_t num1() const;
 // [30] size_t num1(size_t begin, size_t end);
+// [31] size_t rank0(size_t index) const;
+// [31] size_t rank1(size_t index) const;
+// [31] size_t select0(size_t rank) const;
+// [31] size_t select1(size_t rank) const;
 // [ 4] bslma::Allocator *allocator() const();
 // [10] STREAM& bdexStreamOut(STREAM& stream, version) const;
 // [ 5] ostream& print(ostream& stream, int level, int spacesPerLevel);
@@ -156,8 +164,12 @@ using bsl::uint64_t;
 // [20] BitArray operator>>(const BitArray& bitArray, size_t numBits);
 // [ 5] ostream& operator<<(ostream&, const BitArray&);
 // [ 8] void swap(BitArray& lhs, BitArray& rhs);
+// [31] int BitArray_Impl::enabledFeatures();
+// [31] void BitArray_Impl::setEnabledFeatures(int features);
+// [31] int BitArray_Impl::supportedFeatures();
 //-----------------------------------------------------------------------------
-// [31] USAGE EXAMPLE
+// [32] USAGE EXAMPLE
+// [31] CONCERN: the rank index is maintained by every manipulator
 // [ 3] BitArray gDispatch(const char *spec);
 // [ 3] BitArray& gg(BitArray* object, const char *spec);
 // [ 3] BitArray& ggDispatch(BitArray* object, const char *spec);
@@ -861,7 +873,7 @@ bsl::string randSpec(size_t length)
 
 static
 void testUsage()
-    // Test the usage example (see call in main 'switch', test case 31).  This
+    // Test the usage example (see call in main 'switch', test case 32).  This
     // code had to be moved out of the main 'switch', which had grown too
     // large, causing the AIX optimizing compiler to crash.
 {
@@ -975,6 +987,55 @@ void testUsage()
     ASSERT(false   == ARRAY.isAnyElementNonNull());
     ASSERT(false   == ARRAY.isAnyElementNull());
 //..
+//
+///Example 2: Counting Business Days
+///- - - - - - - - - - - - - - - - -
+// Suppose we hold a flag for each day in a range of dates indicating whether
+// that day is a business day, and need to count the business days between
+// two days, and to find the day that is a given number of business days after
+// a given day.
+//
+// First, we create a bit array holding a flag for each day in a range of 40
+// years, in which every fifth and sixth day of a week, and every 100th day,
+// is a holiday:
+//..
+    const bsl::size_t NUM_DAYS = 40 * 365;
+
+    bdlc::BitArray businessDays(NUM_DAYS);
+    for (bsl::size_t day = 0; day < NUM_DAYS; ++day) {
+        if (day % 7 < 5 && 0 != day % 100) {
+            businessDays.assign1(day);
+        }
+    }
+//..
+// Then, we build a rank index, so that the following queries do not need to
+// scan the array:
+//..
+    businessDays.enableRankIndex();
+    ASSERT(true == businessDays.hasRankIndex());
+//..
+// Next, we count the business days in the range '[1000 .. 2000)':
+//..
+    const bsl::size_t count = businessDays.rank1(2000) -
+                                                      businessDays.rank1(1000);
+    ASSERT(businessDays.num1(1000, 2000) == count);
+//..
+// Then, we find the first day, at or after day 1000, that is preceded by 10
+// business days at or after day 1000:
+//..
+    const bsl::size_t day = businessDays.select1(businessDays.rank1(1000) +
+                                                                           10);
+    ASSERT(true == businessDays[day]);
+    ASSERT(10   == businessDays.num1(1000, day));
+//..
+// Finally, we declare that day a holiday, and observe that the rank index is
+// updated accordingly:
+//..
+    businessDays.assign0(day);
+
+    ASSERT(count - 1 == businessDays.rank1(2000) - businessDays.rank1(1000));
+    ASSERT(day        < businessDays.select1(businessDays.rank1(1000) + 10));
+//..
 }
 
 static
@@ -1361,6 +1422,384 @@ void testFind1AtMinIndex()
         }
 }
 
+static
+bool verifyRankSelect(int line, const Obj& X)
+    // Verify that the 'rank0', 'rank1', 'select0', and 'select1' methods of
+    // the specified 'X' return the values computed bit by bit, at every
+    // position if 'X' has a rank index, and at a sample of positions
+    // otherwise.  Report the first difference, attributed to the specified
+    // 'line', and return 'false' if there is a difference, and 'true'
+    // otherwise.
+{
+    const size_t LENGTH = X.length();
+    const size_t STEP   = X.hasRankIndex() ? 1 : LENGTH / 37 + 1;
+
+    bsl::vector<size_t> ones;
+    bsl::vector<size_t> zeros;
+
+    size_t count = 0;
+    for (size_t ii = 0; ii <= LENGTH; ++ii) {
+        if (0 == ii % STEP || LENGTH == ii) {
+            if (count != X.rank1(ii) || ii - count != X.rank0(ii)) {
+                ASSERTV(line, ii, count, X.rank1(ii), X.rank0(ii), false);
+                return false;                                         // RETURN
+            }
+        }
+        if (ii < LENGTH) {
+            if (X[ii]) {
+                ones.push_back(ii);
+                ++count;
+            }
+            else {
+                zeros.push_back(ii);
+            }
+        }
+    }
+
+    for (size_t rank = 0; rank < ones.size(); rank += STEP) {
+        if (ones[rank] != X.select1(rank)) {
+            ASSERTV(line, rank, ones[rank], X.select1(rank), false);
+            return false;                                             // RETURN
+        }
+    }
+    for (size_t rank = 0; rank < zeros.size(); rank += STEP) {
+        if (zeros[rank] != X.select0(rank)) {
+            ASSERTV(line, rank, zeros[rank], X.select0(rank), false);
+            return false;                                             // RETURN
+        }
+    }
+
+    ASSERTV(line, k_INVALID_INDEX == X.select1(ones.size()));
+    ASSERTV(line, k_INVALID_INDEX == X.select0(zeros.size()));
+    ASSERTV(line, k_INVALID_INDEX == X.select1(k_INVALID_INDEX));
+    ASSERTV(line, k_INVALID_INDEX == X.select0(k_INVALID_INDEX));
+
+    return true;
+}
+
+static
+void mutate(Obj *object, int operation, size_t r1, size_t r2, size_t r3)
+    // Apply to the specified 'object' the manipulator identified by the
+    // specified 'operation', in the range '[0 .. 42)', with arguments derived
+    // from the specified pseudo-random 'r1', 'r2', and 'r3'.  Applying the
+    // same 'operation', 'r1', 'r2', and 'r3' to objects having the same value
+    // produces objects having the same value.
+{
+    const size_t LENGTH = object->length();
+
+    // An index, a number of bits starting at that index, and an index at
+    // which that number of bits may be inserted.
+
+    const size_t index    = LENGTH ? r1 % LENGTH : 0;
+    const size_t numBits  = (LENGTH - index) ? r2 % (LENGTH - index) : 0;
+    const size_t dst      = r3 % (LENGTH + 1);
+    const size_t src      = r3 % 3001;
+    const bool   value    = r3 & 1;
+
+    Obj source(LENGTH + 3000);
+    for (size_t ii = 0; ii < source.length(); ii += 1 + ii % 13) {
+        source.assign1(ii);
+    }
+
+    switch (LENGTH ? operation : 0) {
+      case  0: object->append(value);                                  break;
+      case  1: object->append(value, r2 % 5000);                       break;
+      case  2: object->append(source, r1 % 1500, r2 % 1500);           break;
+      case  3: object->assign(index, value);                           break;
+      case  4: object->assign(index, value, numBits);                  break;
+      case  5: object->assign(index, source, src, numBits);            break;
+      case  6: object->assign(index, *object, dst % (LENGTH - numBits + 1),
+                              numBits);                                break;
+      case  7: object->assign0(index);                                 break;
+      case  8: object->assign0(index, numBits);                        break;
+      case  9: object->assign1(index);                                 break;
+      case 10: object->assign1(index, numBits);                        break;
+      case 11: object->assignAll(value);                               break;
+      case 12: object->assignBits(index, r3, bsl::min<size_t>(numBits, 64));
+                                                                       break;
+      case 13: object->insert(dst, value);                             break;
+      case 14: object->insert(dst, value, r2 % 3000);                  break;
+      case 15: object->insert(dst, source, r1 % 1500, r2 % 1500);      break;
+      case 16: object->remove(index);                                  break;
+      case 17: object->remove(index, numBits);                         break;
+      case 18: object->rotateLeft(index);                              break;
+      case 19: object->rotateRight(index);                             break;
+      case 20: object->setLength(r2 % (LENGTH + 5000), value);         break;
+      case 21: object->swapBits(index, r2 % LENGTH);                   break;
+      case 22: object->toggle(index);                                  break;
+      case 23: object->toggle(index, numBits);                         break;
+      case 24: object->toggleAll();                                    break;
+      case 25: object->andEqual(index, value);                         break;
+      case 26: object->andEqual(index, source, src, numBits);          break;
+      case 27: object->minusEqual(index, value);                       break;
+      case 28: object->minusEqual(index, source, src, numBits);        break;
+      case 29: object->orEqual(index, value);                          break;
+      case 30: object->orEqual(index, source, src, numBits);           break;
+      case 31: object->xorEqual(index, value);                         break;
+      case 32: object->xorEqual(index, source, src, numBits);          break;
+      case 33: *object &= source;                                      break;
+      case 34: *object -= source;                                      break;
+      case 35: *object |= source;                                      break;
+      case 36: *object ^= source;                                      break;
+      case 37: *object <<= index;                                      break;
+      case 38: *object >>= index;                                      break;
+      case 39: *object = source;                                       break;
+      case 40: object->removeAll();                                    break;
+      case 41: object->reserveCapacity(LENGTH + r2 % 100000);          break;
+      default: ASSERTV(operation, false);
+    }
+}
+
+static
+void testRankSelect()
+    // Test the rank and select operations, and the rank index (see call in
+    // main 'switch', test case 31).
+{
+    bslma::TestAllocator testAllocator(veryVeryVerbose);
+
+    const size_t LENGTHS[] = { 0, 1, 2, 63, 64, 65, 511, 512, 513, 2047,
+                               2048, 2049, 4095, 4096, 6000, 65535, 65536,
+                               65537, 131072 + 2048 * 3 + 100 };
+    const int NUM_LENGTHS = static_cast<int>(sizeof LENGTHS / sizeof *LENGTHS);
+
+    const int ALL_FEATURES = bdlc::BitArray_Impl::e_POPCNT |
+                             bdlc::BitArray_Impl::e_BMI2;
+    const int SUPPORTED    = bdlc::BitArray_Impl::supportedFeatures();
+
+    if (verbose) { P(SUPPORTED); }
+
+    ASSERTV(SUPPORTED, 0 == (SUPPORTED & ~ALL_FEATURES));
+    ASSERTV(SUPPORTED, SUPPORTED == bdlc::BitArray_Impl::enabledFeatures());
+
+    if (verbose) cout << "\tRank and select of fixed patterns.\n";
+
+    for (int features = 0; features <= ALL_FEATURES; ++features) {
+        bdlc::BitArray_Impl::setEnabledFeatures(features);
+        ASSERTV(features, (features & SUPPORTED) ==
+                                     bdlc::BitArray_Impl::enabledFeatures());
+
+        for (int li = 0; li < NUM_LENGTHS; ++li) {
+            const size_t LENGTH = LENGTHS[li];
+
+            for (int pattern = 0; pattern < 5; ++pattern) {
+                Obj mX(LENGTH, 1 == pattern, &testAllocator);
+                const Obj& X = mX;
+
+                bsl::srand(static_cast<unsigned>(li * 5 + pattern));
+                for (size_t ii = 0; ii < LENGTH; ++ii) {
+                    switch (pattern) {
+                      case 2: {  // random
+                        mX.assign(ii, bsl::rand() & 1);
+                      } break;
+                      case 3: {  // sparse 1 bits
+                        mX.assign(ii, 0 == ii % 997 || 0 == ii % 4001);
+                      } break;
+                      case 4: {  // sparse 0 bits
+                        mX.assign(ii, 0 != ii % 1009);
+                      } break;
+                    }
+                }
+
+                ASSERTV(features, LENGTH, pattern, !X.hasRankIndex());
+                ASSERTV(features, LENGTH, pattern, verifyRankSelect(L_, X));
+
+                const Obj Y(X, &testAllocator);
+
+                mX.enableRankIndex();
+                ASSERTV(features, LENGTH, pattern, X.hasRankIndex());
+                ASSERTV(features, LENGTH, pattern, verifyRankSelect(L_, X));
+                ASSERTV(features, LENGTH, pattern, Y == X);
+
+                mX.enableRankIndex();
+                ASSERTV(features, LENGTH, pattern, X.hasRankIndex());
+                ASSERTV(features, LENGTH, pattern, verifyRankSelect(L_, X));
+
+                mX.disableRankIndex();
+                ASSERTV(features, LENGTH, pattern, !X.hasRankIndex());
+                ASSERTV(features, LENGTH, pattern, Y == X);
+            }
+        }
+    }
+    bdlc::BitArray_Impl::setEnabledFeatures(ALL_FEATURES);
+    ASSERTV(SUPPORTED == bdlc::BitArray_Impl::enabledFeatures());
+    ASSERT(0 == testAllocator.numBlocksInUse());
+
+    if (verbose) cout << "\tMaintenance of the rank index.\n";
+
+    for (int li = 0; li < NUM_LENGTHS; ++li) {
+        const size_t LENGTH = LENGTHS[li];
+        const int    NUM_OPERATIONS = LENGTH < 10000 ? 42 * 8 : 42 * 2;
+
+        Obj mX(&testAllocator);  const Obj& X = mX;  // has rank index
+        Obj mY(&testAllocator);  const Obj& Y = mY;  // has no rank index
+
+        mX.enableRankIndex();
+        for (size_t ii = 0; ii < LENGTH; ++ii) {
+            const bool BIT = 0 == (ii * 7 + ii / 3) % 5;
+            mX.append(BIT);
+            mY.append(BIT);
+        }
+        ASSERTV(LENGTH, verifyRankSelect(L_, X));
+
+        unsigned int seed = static_cast<unsigned>(li) + 1;
+        for (int ti = 0; ti < NUM_OPERATIONS; ++ti) {
+            const int    OP = ti % 42;
+            const size_t R1 = (seed = seed * 1103515245 + 12345) >> 4;
+            const size_t R2 = (seed = seed * 1103515245 + 12345) >> 4;
+            const size_t R3 = (seed = seed * 1103515245 + 12345) >> 4;
+
+            mutate(&mX, OP, R1, R2, R3);
+            mutate(&mY, OP, R1, R2, R3);
+
+            ASSERTV(LENGTH, ti, OP, X == Y);
+            ASSERTV(LENGTH, ti, OP, X.hasRankIndex());
+            ASSERTV(LENGTH, ti, OP, !Y.hasRankIndex());
+            ASSERTV(LENGTH, ti, OP, verifyRankSelect(L_, X));
+
+            if (X.length() > 300000 || 40 == OP) {
+                // Keep the length within bounds, and restore a non-empty
+                // array after 'removeAll'.
+
+                mX.setLength(LENGTH / 2);
+                mY.setLength(LENGTH / 2);
+                mX.append(true, LENGTH / 2 + 1);
+                mY.append(true, LENGTH / 2 + 1);
+                ASSERTV(LENGTH, ti, verifyRankSelect(L_, X));
+            }
+        }
+    }
+    ASSERT(0 == testAllocator.numBlocksInUse());
+
+    if (verbose) cout << "\tCopy, assignment, swap, and streaming.\n";
+    {
+        Obj mX(70000, true, &testAllocator);  const Obj& X = mX;
+        mX.assign0(1000, 5000);
+        mX.enableRankIndex();
+
+        Obj mY(X, &testAllocator);  const Obj& Y = mY;
+        ASSERT(Y.hasRankIndex());
+        ASSERT(verifyRankSelect(L_, Y));
+
+        Obj mZ(&testAllocator);  const Obj& Z = mZ;
+        mZ = X;
+        ASSERT(!Z.hasRankIndex());
+        ASSERT(X == Z);
+
+        mY.removeAll();
+        ASSERT(Y.hasRankIndex());
+        ASSERT(0 == Y.rank1(0));
+        ASSERT(verifyRankSelect(L_, Y));
+
+        mY = Z;
+        ASSERT(Y.hasRankIndex());
+        ASSERT(verifyRankSelect(L_, Y));
+
+        mY = Y;
+        ASSERT(Y.hasRankIndex());
+        ASSERT(verifyRankSelect(L_, Y));
+
+        mY.removeAll();
+        mY.swap(mZ);
+        ASSERT(!Y.hasRankIndex());
+        ASSERT(Z.hasRankIndex());
+        ASSERT(X == Y);
+        ASSERT(verifyRankSelect(L_, Z));
+
+        bslma::TestAllocator otherAllocator(veryVeryVerbose);
+        Obj mW(&otherAllocator);  const Obj& W = mW;
+        swap(mW, mX);
+        ASSERT(W.hasRankIndex());
+        ASSERT(!X.hasRankIndex());
+        ASSERT(verifyRankSelect(L_, W));
+
+        mZ.append(true, 100);
+
+        const int VERSION = Obj::maxSupportedBdexVersion(0);
+
+        bslx::TestOutStream out(20140601);
+        bslx::OutStreamFunctions::bdexStreamOut(out, W, VERSION);
+
+        bslx::TestInStream in(out.data(), out.length());
+        bslx::InStreamFunctions::bdexStreamIn(in, mZ, VERSION);
+        ASSERT(in);
+        ASSERT(W == Z);
+        ASSERT(Z.hasRankIndex());
+        ASSERT(verifyRankSelect(L_, Z));
+    }
+    ASSERT(0 == testAllocator.numBlocksInUse());
+
+    if (verbose) cout << "\tAllocation and exception safety.\n";
+    {
+        Obj mX(100000, true, &testAllocator);  const Obj& X = mX;
+        mX.assign0(5, 20000);
+
+        const Obj XX(X);
+
+        const Int64 B = testAllocator.numBlocksInUse();
+
+        BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(testAllocator) {
+            if (X.hasRankIndex()) {
+                mX.disableRankIndex();
+            }
+            ASSERT(XX == X);
+
+            mX.enableRankIndex();
+        } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+        ASSERT(X.hasRankIndex());
+        ASSERT(XX == X);
+        ASSERT(B + 2 == testAllocator.numBlocksInUse());
+
+        mX.disableRankIndex();
+        ASSERT(B == testAllocator.numBlocksInUse());
+
+        Obj mY(&testAllocator);  const Obj& Y = mY;
+        mY.enableRankIndex();
+
+        for (size_t ii = 0; ii < 70000; ++ii) {
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(testAllocator) {
+                if (ii != Y.length()) {
+                    ASSERTV(ii, Y.length(), ii + 1 == Y.length());
+                    mY.remove(ii);
+                }
+                mY.append(0 == ii % 3);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            if (0 == ii % 4999) {
+                ASSERTV(ii, verifyRankSelect(L_, Y));
+            }
+        }
+        ASSERT(verifyRankSelect(L_, Y));
+
+        mY.reserveCapacity(300000);
+        const Int64 NUM_ALLOCS = testAllocator.numAllocations();
+        mY.append(true, 200000);
+        mY.setLength(299999);
+        ASSERT(NUM_ALLOCS == testAllocator.numAllocations());
+        ASSERT(verifyRankSelect(L_, Y));
+    }
+    ASSERT(0 == testAllocator.numBlocksInUse());
+
+    if (verbose) cout << "\tNegative testing.\n";
+    {
+        bsls::AssertTestHandlerGuard guard;
+
+        Obj mX(100);  const Obj& X = mX;
+
+        ASSERT_PASS(X.rank0(100));
+        ASSERT_PASS(X.rank1(100));
+        ASSERT_FAIL(X.rank0(101));
+        ASSERT_FAIL(X.rank1(101));
+
+        mX.enableRankIndex();
+
+        ASSERT_PASS(X.rank0(100));
+        ASSERT_PASS(X.rank1(100));
+        ASSERT_FAIL(X.rank0(101));
+        ASSERT_FAIL(X.rank1(101));
+    }
+}
+
 //=============================================================================
 //                              MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -1417,7 +1856,7 @@ int main(int argc, char *argv[])
     strcat(LONG_SPEC_9, LONG_SPEC_1);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 31: {
+      case 32: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -1438,6 +1877,84 @@ int main(int argc, char *argv[])
 
         testUsage();
       } break;
+      case 31: {
+        // --------------------------------------------------------------------
+        // TESTING RANK AND SELECT
+        //
+        // Concerns:
+        //: 1 'rank0', 'rank1', 'select0', and 'select1' return the number of
+        //:   0 or 1 bits preceding an index, and the index of the bit preceded
+        //:   by a number of 0 or 1 bits, whether or not the array has a rank
+        //:   index, and for any set of enabled processor features.
+        //:
+        //: 2 'select0' and 'select1' return 'k_INVALID_INDEX' if there is no
+        //:   bit of the requested rank.
+        //:
+        //: 3 'enableRankIndex' builds a rank index, 'disableRankIndex'
+        //:   discards it, and 'hasRankIndex' reports whether there is one.
+        //:
+        //: 4 Once enabled, the rank index is maintained by every manipulator,
+        //:   including manipulators changing the length of the array, moving
+        //:   bits, and modifying bits in a different span of the rank index
+        //:   than the bits that follow.
+        //:
+        //: 5 The rank index does not affect the value of the array; it is
+        //:   copied by the copy constructor, exchanged by 'swap', and retained
+        //:   by the target of an assignment.
+        //:
+        //: 6 'enableRankIndex' provides the strong exception-safety guarantee,
+        //:   manipulators that grow the array remain exception-safe, and
+        //:   'reserveCapacity' also reserves the capacity of the rank index.
+        //:
+        //: 7 'BitArray_Impl::supportedFeatures' reports a subset of the
+        //:   defined features, which are all initially enabled, and
+        //:   'setEnabledFeatures' enables exactly the requested features that
+        //:   are supported.
+        //:
+        //: 8 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each set of enabled features, and each of a series of
+        //:   lengths chosen around word, block quarter, block, and span
+        //:   boundaries, create arrays having a variety of bit patterns, and
+        //:   compare the results of the rank and select operations with
+        //:   values computed bit by bit, with and without a rank index.
+        //:   (C-1..3, 7)
+        //:
+        //: 2 For each of the same lengths, apply each manipulator with
+        //:   pseudo-random arguments to an array having a rank index and an
+        //:   array having none, verify that the arrays remain equal, and
+        //:   verify the rank and select operations exhaustively.  (C-4)
+        //:
+        //: 3 Verify the state of the rank index after copy construction,
+        //:   assignment, 'swap', 'removeAll', and 'bdexStreamIn'.  (C-5)
+        //:
+        //: 4 Use the 'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*' macros to inject
+        //:   allocation failures in 'enableRankIndex' and 'append', and verify
+        //:   that no allocation occurs after 'reserveCapacity'.  (C-6)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-8)
+        //
+        // Testing:
+        //   void disableRankIndex();
+        //   void enableRankIndex();
+        //   bool hasRankIndex() const;
+        //   size_t rank0(size_t index) const;
+        //   size_t rank1(size_t index) const;
+        //   size_t select0(size_t rank) const;
+        //   size_t select1(size_t rank) const;
+        //   int BitArray_Impl::enabledFeatures();
+        //   void BitArray_Impl::setEnabledFeatures(int features);
+        //   int BitArray_Impl::supportedFeatures();
+        //   CONCERN: the rank index is maintained by every manipulator
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING RANK AND SELECT\n"
+                               "=======================\n";
+
+        testRankSelect();
+      } break;
       case 30: {
         // --------------------------------------------------------------------
         // TESTING RANGE-BASED NUM0, NUM1
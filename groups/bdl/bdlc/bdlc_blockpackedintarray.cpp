@@ -0,0 +1,711 @@
+// bdlc_blockpackedintarray.cpp                                       -*-C++-*-
+#include <bdlc_blockpackedintarray.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlc_blockpackedintarray_cpp,"$Id$ $CSID$")
+
+#include <bdlb_bitutil.h>
+
+#include <bslim_printer.h>
+
+#include <bslmt_once.h>
+
+#include <bsls_platform.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+#include <bsl_ostream.h>
+
+// Compiler-specific and platform-specific
+#if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+#define LIKE_X86_GCC
+#endif
+#endif
+
+#if defined(LIKE_X86_GCC)
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
+// IMPLEMENTATION NOTES
+// --------------------
+// The packed values of a block having a bit width of 'w' occupy '4 * w'
+// consecutive 64-bit words, interleaved as four independent bit streams
+// ("lanes"): word '4 * k + l' is the 'k'th word of lane 'l', and the value at
+// position 'i' in the block is the '(i / 4)'th 'w'-bit field (least
+// significant bits first) of lane 'i % 4'.  Each lane holds 64 values, so a
+// lane occupies exactly 'w' words, and a block needs no padding.  This layout
+// lets a 256-bit vector unpack the same field of all four lanes at once,
+// producing four consecutive values of the block.
+
+namespace BloombergLP {
+namespace bdlc {
+namespace {
+
+typedef bsl::uint64_t Uint64;
+
+enum {
+    k_NUM_LANES       = 4,  // bit streams per block
+    k_VALUES_PER_LANE = BlockPackedIntArray::k_BLOCK_LENGTH / k_NUM_LANES
+};
+
+inline
+Uint64 lowBitsMask(int width)
+    // Return a value having only the specified low-order 'width' bits set.
+    // The behavior is undefined unless '0 <= width <= 64'.
+{
+    return 64 == width ? ~static_cast<Uint64>(0)
+                       : (static_cast<Uint64>(1) << width) - 1;
+}
+
+inline
+int bitWidth(Uint64 value)
+    // Return the number of bits needed to represent the specified 'value'.
+{
+    return 64 - bdlb::BitUtil::numLeadingUnsetBits(value);
+}
+
+void pack(Uint64 *words, const Uint64 *values, int width)
+    // Store the 'BlockPackedIntArray::k_BLOCK_LENGTH' elements of the
+    // specified 'values' array, each in the specified 'width' bits, in the
+    // '4 * width' elements of the specified 'words' array.  The behavior is
+    // undefined unless '0 < width <= 64', each element of 'values' is
+    // representable in 'width' bits, and each element of 'words' is 0.
+{
+    for (int lane = 0; lane < k_NUM_LANES; ++lane) {
+        Uint64 *word  = words + lane;
+        int     shift = 0;
+
+        for (int j = 0; j < k_VALUES_PER_LANE; ++j) {
+            const Uint64 value = values[k_NUM_LANES * j + lane];
+
+            *word |= value << shift;
+            shift += width;
+            if (64 <= shift) {
+                shift -= 64;
+                word  += k_NUM_LANES;
+                if (0 < shift) {
+                    *word = value >> (width - shift);
+                }
+            }
+        }
+    }
+}
+
+inline
+Uint64 unpackValue(const Uint64 *words, int width, int position)
+    // Return the packed value at the specified 'position' in the block whose
+    // values, each of the specified 'width' bits, are stored in the specified
+    // 'words'.  The behavior is undefined unless '0 < width <= 64' and
+    // '0 <= position < BlockPackedIntArray::k_BLOCK_LENGTH'.
+{
+    const int    lane  = position % k_NUM_LANES;
+    const Uint64 bit   = static_cast<Uint64>(position / k_NUM_LANES) * width;
+    const int    shift = static_cast<int>(bit % 64);
+
+    const Uint64 *word = words + (bit / 64) * k_NUM_LANES + lane;
+
+    Uint64 value = *word >> shift;
+    if (64 < shift + width) {
+        value |= word[k_NUM_LANES] << (64 - shift);
+    }
+    return value & lowBitsMask(width);
+}
+
+void unpackPortable(Uint64 *result, const Uint64 *words, int width)
+    // Load, into the 'BlockPackedIntArray::k_BLOCK_LENGTH' elements of the
+    // specified 'result' array, the values, each of the specified 'width'
+    // bits, packed in the specified 'words'.  The behavior is undefined
+    // unless '0 < width <= 64'.
+{
+    const Uint64 mask = lowBitsMask(width);
+
+    for (int lane = 0; lane < k_NUM_LANES; ++lane) {
+        const Uint64 *word    = words + lane;
+        Uint64        current = *word;
+        int           shift   = 0;
+
+        for (int j = 0; j < k_VALUES_PER_LANE; ++j) {
+            Uint64 value = current >> shift;
+
+            shift += width;
+            if (64 <= shift) {
+                shift -= 64;
+                if (j + 1 < k_VALUES_PER_LANE) {
+                    word    += k_NUM_LANES;
+                    current  = *word;
+                    if (0 < shift) {
+                        value |= current << (width - shift);
+                    }
+                }
+            }
+            result[k_NUM_LANES * j + lane] = value & mask;
+        }
+    }
+}
+
+#if defined(LIKE_X86_GCC)
+
+__attribute__((target("avx2")))
+void unpackAvx2(Uint64 *result, const Uint64 *words, int width)
+    // Load, into the 'BlockPackedIntArray::k_BLOCK_LENGTH' elements of the
+    // specified 'result' array, the values, each of the specified 'width'
+    // bits, packed in the specified 'words', unpacking the four lanes in
+    // parallel.  The behavior is undefined unless '0 < width <= 64' and the
+    // processor supports AVX2.
+{
+    const __m256i  mask    = _mm256_set1_epi64x(
+                                  static_cast<long long>(lowBitsMask(width)));
+    const __m256i *word    = reinterpret_cast<const __m256i *>(words);
+    __m256i        current = _mm256_loadu_si256(word);
+    int            shift   = 0;
+
+    for (int j = 0; j < k_VALUES_PER_LANE; ++j) {
+        __m256i value = _mm256_srl_epi64(current, _mm_cvtsi32_si128(shift));
+
+        shift += width;
+        if (64 <= shift) {
+            shift -= 64;
+            if (j + 1 < k_VALUES_PER_LANE) {
+                ++word;
+                current = _mm256_loadu_si256(word);
+                if (0 < shift) {
+                    const __m128i count = _mm_cvtsi32_si128(width - shift);
+                    value = _mm256_or_si256(value,
+                                            _mm256_sll_epi64(current, count));
+                }
+            }
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(result) + j,
+                            _mm256_and_si256(value, mask));
+    }
+}
+
+int detectFeatures()
+    // Return the bitwise-OR of the 'BlockPackedIntArray_Impl::Feature' values
+    // supported by the processor.
+{
+    unsigned int eax, ebx, ecx, edx;
+
+    if (__get_cpuid_max(0, 0) < 7) {
+        return 0;                                                     // RETURN
+    }
+
+    __cpuid(1, eax, ebx, ecx, edx);
+    const bool hasOsxsave = ecx & (1u << 27);
+    const bool hasAvx     = ecx & (1u << 28);
+
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    const bool hasAvx2    = ebx & (1u <<  5);
+
+    int features = 0;
+
+    if (hasAvx2 && hasAvx && hasOsxsave) {
+        // Check that the operating system saves the YMM registers.
+
+        unsigned int xcr0Low, xcr0High;
+        __asm__("xgetbv" : "=a"(xcr0Low), "=d"(xcr0High) : "c"(0));
+        if (6 == (xcr0Low & 6)) {
+            features |= BlockPackedIntArray_Impl::e_AVX2;
+        }
+    }
+
+    return features;
+}
+
+#else
+
+int detectFeatures()
+    // Return the bitwise-OR of the 'BlockPackedIntArray_Impl::Feature' values
+    // supported by the processor.
+{
+    return 0;
+}
+
+#endif  // LIKE_X86_GCC
+
+class UnpackKernel {
+    // This class provides a namespace for the kernel used to unpack the
+    // values of a block, selected according to the features of the processor
+    // detected on first use.
+
+  public:
+    // TYPES
+    typedef void (*UnpackFn)(Uint64 *result, const Uint64 *words, int width);
+        // 'UnpackFn' is an alias for a function unpacking the values of a
+        // block.
+
+  private:
+    // CLASS DATA
+    static int      s_supported;  // supported features
+    static int      s_enabled;    // features in use
+    static UnpackFn s_unpackFn;   // selected kernel
+
+    // PRIVATE CLASS METHODS
+    static void initialize();
+        // Detect the features of the processor and select the kernel to use
+        // if this has not already been done.
+
+    static void selectImpl(int features);
+        // Select the fastest kernel using only those of the specified
+        // 'features' that are supported.  The behavior is undefined unless
+        // the supported features have been detected.
+
+  public:
+    // CLASS METHODS
+    static void select(int features);
+        // Select the fastest kernel using only those of the specified
+        // 'features' that are supported.
+
+    static int enabled();
+        // Return the features used by the selected kernel.
+
+    static int supported();
+        // Return the features supported by the processor.
+
+    static UnpackFn unpackFn();
+        // Return the selected kernel.
+};
+
+// CLASS DATA
+int                    UnpackKernel::s_supported = 0;
+int                    UnpackKernel::s_enabled   = 0;
+UnpackKernel::UnpackFn UnpackKernel::s_unpackFn  = &unpackPortable;
+
+// PRIVATE CLASS METHODS
+void UnpackKernel::initialize()
+{
+    BSLMT_ONCE_DO {
+        s_supported = detectFeatures();
+        selectImpl(s_supported);
+    }
+}
+
+void UnpackKernel::selectImpl(int features)
+{
+    s_enabled  = features & s_supported;
+    s_unpackFn = &unpackPortable;
+
+#if defined(LIKE_X86_GCC)
+    if (s_enabled & BlockPackedIntArray_Impl::e_AVX2) {
+        s_unpackFn = &unpackAvx2;
+    }
+#endif
+}
+
+// CLASS METHODS
+void UnpackKernel::select(int features)
+{
+    initialize();
+    selectImpl(features);
+}
+
+int UnpackKernel::enabled()
+{
+    initialize();
+    return s_enabled;
+}
+
+int UnpackKernel::supported()
+{
+    initialize();
+    return s_supported;
+}
+
+inline
+UnpackKernel::UnpackFn UnpackKernel::unpackFn()
+{
+    initialize();
+    return s_unpackFn;
+}
+
+}  // close unnamed namespace
+
+                         // -------------------------
+                         // class BlockPackedIntArray
+                         // -------------------------
+
+// PRIVATE MANIPULATORS
+void BlockPackedIntArray::encodeBlock(const bsl::int64_t *values)
+{
+    BSLS_ASSERT(values);
+
+    Uint64 packed[k_BLOCK_LENGTH];
+    Uint64 base = 0;
+    Uint64 step = 0;
+
+    switch (d_encoding) {
+      case e_BIT_PACKED: {
+        for (int i = 0; i < k_BLOCK_LENGTH; ++i) {
+            const Uint64 value = static_cast<Uint64>(values[i]);
+            packed[i] = (value << 1) ^ (0 - (value >> 63));
+        }
+      } break;
+      case e_FRAME_OF_REFERENCE: {
+        base = static_cast<Uint64>(*bsl::min_element(values,
+                                                     values + k_BLOCK_LENGTH));
+        for (int i = 0; i < k_BLOCK_LENGTH; ++i) {
+            packed[i] = static_cast<Uint64>(values[i]) - base;
+        }
+      } break;
+      case e_DELTA: {
+        // The differences are computed modulo 2^64, so that the values are
+        // reconstructed exactly even if a difference is not representable as
+        // a 'bsl::int64_t'.
+
+        base = static_cast<Uint64>(values[0]);
+
+        packed[0] = 0;
+        bsl::int64_t minDelta = 0;
+        for (int i = 1; i < k_BLOCK_LENGTH; ++i) {
+            packed[i] = static_cast<Uint64>(values[i])
+                      - static_cast<Uint64>(values[i - 1]);
+
+            const bsl::int64_t delta = static_cast<bsl::int64_t>(packed[i]);
+            if (1 == i || delta < minDelta) {
+                minDelta = delta;
+            }
+        }
+        step = static_cast<Uint64>(minDelta);
+        for (int i = 1; i < k_BLOCK_LENGTH; ++i) {
+            packed[i] -= step;
+        }
+      } break;
+      default: {
+        BSLS_ASSERT_INVOKE_NORETURN("Unreachable by design");
+      } break;
+    }
+
+    Uint64 bits = 0;
+    for (int i = 0; i < k_BLOCK_LENGTH; ++i) {
+        bits |= packed[i];
+    }
+
+    Block block;
+    block.d_base   = base;
+    block.d_step   = step;
+    block.d_offset = d_words.size();
+    block.d_width  = bitWidth(bits);
+
+    // Reserve room for the block first, so that the strong guarantee holds
+    // if either allocation fails.
+
+    d_blocks.reserve(d_blocks.size() + 1);
+    d_words.resize(d_words.size() + k_NUM_LANES * block.d_width, 0);
+
+    if (0 < block.d_width) {
+        pack(d_words.data() + block.d_offset, packed, block.d_width);
+    }
+    d_blocks.push_back(block);
+}
+
+// PRIVATE ACCESSORS
+void BlockPackedIntArray::decodeBlock(bsl::int64_t *result,
+                                      bsl::size_t   blockIndex) const
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(blockIndex < d_blocks.size());
+
+    const Block&  block  = d_blocks[blockIndex];
+    Uint64       *values = reinterpret_cast<Uint64 *>(result);
+
+    if (0 == block.d_width) {
+        bsl::fill(values, values + k_BLOCK_LENGTH, 0);
+    }
+    else {
+        UnpackKernel::unpackFn()(values,
+                                 d_words.data() + block.d_offset,
+                                 block.d_width);
+    }
+
+    switch (d_encoding) {
+      case e_BIT_PACKED: {
+        for (int i = 0; i < k_BLOCK_LENGTH; ++i) {
+            values[i] = (values[i] >> 1) ^ (0 - (values[i] & 1));
+        }
+      } break;
+      case e_FRAME_OF_REFERENCE: {
+        const Uint64 base = block.d_base;
+        for (int i = 0; i < k_BLOCK_LENGTH; ++i) {
+            values[i] += base;
+        }
+      } break;
+      case e_DELTA: {
+        const Uint64 step  = block.d_step;
+        Uint64       value = block.d_base - step;
+        for (int i = 0; i < k_BLOCK_LENGTH; ++i) {
+            value     += step + values[i];
+            values[i]  = value;
+        }
+      } break;
+      default: {
+        BSLS_ASSERT_INVOKE_NORETURN("Unreachable by design");
+      } break;
+    }
+}
+
+bsl::int64_t BlockPackedIntArray::decodeValue(bsl::size_t blockIndex,
+                                              int         position) const
+{
+    BSLS_ASSERT(blockIndex < d_blocks.size());
+    BSLS_ASSERT(0 <= position);
+    BSLS_ASSERT(     position < k_BLOCK_LENGTH);
+
+    const Block&  block = d_blocks[blockIndex];
+    const Uint64 *words = d_words.data() + block.d_offset;
+    const int     width = block.d_width;
+
+    Uint64 value;
+
+    switch (d_encoding) {
+      case e_BIT_PACKED: {
+        const Uint64 packed = width ? unpackValue(words, width, position) : 0;
+        value = (packed >> 1) ^ (0 - (packed & 1));
+      } break;
+      case e_FRAME_OF_REFERENCE: {
+        value = block.d_base
+              + (width ? unpackValue(words, width, position) : 0);
+      } break;
+      case e_DELTA: {
+        value = block.d_base + block.d_step * position;
+        if (width) {
+            for (int i = 1; i <= position; ++i) {
+                value += unpackValue(words, width, i);
+            }
+        }
+      } break;
+      default: {
+        BSLS_ASSERT_INVOKE_NORETURN("Unreachable by design");
+      } break;
+    }
+
+    return static_cast<bsl::int64_t>(value);
+}
+
+// MANIPULATORS
+BlockPackedIntArray& BlockPackedIntArray::operator=(
+                                                const BlockPackedIntArray& rhs)
+{
+    if (this != &rhs) {
+        BlockPackedIntArray(rhs, allocator()).swap(*this);
+    }
+    return *this;
+}
+
+void BlockPackedIntArray::append(bsl::int64_t value)
+{
+    if (d_tail.size() + 1 < k_BLOCK_LENGTH) {
+        d_tail.push_back(value);
+        return;                                                       // RETURN
+    }
+
+    // Complete the block in a local buffer, so that this array is unchanged
+    // if encoding the block fails.
+
+    bsl::int64_t values[k_BLOCK_LENGTH];
+    bsl::copy(d_tail.begin(), d_tail.end(), values);
+    values[k_BLOCK_LENGTH - 1] = value;
+
+    encodeBlock(values);
+    d_tail.clear();
+}
+
+void BlockPackedIntArray::append(const bsl::int64_t *values,
+                                 bsl::size_t         numValues)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+
+    while (0 < numValues) {
+        if (d_tail.empty() && k_BLOCK_LENGTH <= numValues) {
+            encodeBlock(values);
+            values    += k_BLOCK_LENGTH;
+            numValues -= k_BLOCK_LENGTH;
+            continue;
+        }
+
+        const bsl::size_t count = bsl::min<bsl::size_t>(
+                                            numValues,
+                                            k_BLOCK_LENGTH - d_tail.size());
+
+        if (d_tail.size() + count < k_BLOCK_LENGTH) {
+            d_tail.insert(d_tail.end(), values, values + count);
+        }
+        else {
+            bsl::int64_t block[k_BLOCK_LENGTH];
+            bsl::copy(d_tail.begin(), d_tail.end(), block);
+            bsl::copy(values, values + count, block + d_tail.size());
+
+            encodeBlock(block);
+            d_tail.clear();
+        }
+        values    += count;
+        numValues -= count;
+    }
+}
+
+// ACCESSORS
+void BlockPackedIntArray::decode(bsl::int64_t *result,
+                                 bsl::size_t   index,
+                                 bsl::size_t   numValues) const
+{
+    BSLS_ASSERT(result || 0 == numValues);
+    BSLS_ASSERT(index <= length());
+    BSLS_ASSERT(numValues <= length() - index);
+
+    bsl::size_t blockIndex = index / k_BLOCK_LENGTH;
+    bsl::size_t position   = index % k_BLOCK_LENGTH;
+
+    for (; 0 < numValues && blockIndex < d_blocks.size(); ++blockIndex) {
+        if (0 == position && k_BLOCK_LENGTH <= numValues) {
+            decodeBlock(result, blockIndex);
+            result    += k_BLOCK_LENGTH;
+            numValues -= k_BLOCK_LENGTH;
+        }
+        else {
+            bsl::int64_t      values[k_BLOCK_LENGTH];
+            const bsl::size_t count = bsl::min<bsl::size_t>(
+                                                  numValues,
+                                                  k_BLOCK_LENGTH - position);
+
+            decodeBlock(values, blockIndex);
+            bsl::memcpy(result, values + position, count * sizeof *result);
+            result    += count;
+            numValues -= count;
+            position   = 0;
+        }
+    }
+
+    if (0 < numValues) {
+        bsl::memcpy(result,
+                    d_tail.data() + position,
+                    numValues * sizeof *result);
+    }
+}
+
+                                  // Aspects
+
+bsl::ostream& BlockPackedIntArray::print(bsl::ostream& stream,
+                                         int           level,
+                                         int           spacesPerLevel) const
+{
+    if (stream.bad()) {
+        return stream;                                                // RETURN
+    }
+
+    bslim::Printer printer(&stream, level, spacesPerLevel);
+    printer.start();
+
+    bsl::int64_t values[k_BLOCK_LENGTH];
+    for (bsl::size_t i = 0; i < d_blocks.size(); ++i) {
+        decodeBlock(values, i);
+        for (int j = 0; j < k_BLOCK_LENGTH; ++j) {
+            printer.printValue(values[j]);
+        }
+    }
+    for (bsl::size_t i = 0; i < d_tail.size(); ++i) {
+        printer.printValue(d_tail[i]);
+    }
+
+    printer.end();
+
+    return stream;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+bool bdlc::operator==(const BlockPackedIntArray& lhs,
+                      const BlockPackedIntArray& rhs)
+{
+    if (lhs.d_blocks.size() != rhs.d_blocks.size()
+     || lhs.d_tail          != rhs.d_tail) {
+        return false;                                                 // RETURN
+    }
+
+    if (lhs.d_encoding == rhs.d_encoding) {
+        // Encoding is deterministic, so arrays having the same encoding have
+        // the same value if, and only if, they have the same representation.
+
+        for (bsl::size_t i = 0; i < lhs.d_blocks.size(); ++i) {
+            const BlockPackedIntArray::Block& a = lhs.d_blocks[i];
+            const BlockPackedIntArray::Block& b = rhs.d_blocks[i];
+
+            if (a.d_base  != b.d_base
+             || a.d_step  != b.d_step
+             || a.d_width != b.d_width) {
+                return false;                                         // RETURN
+            }
+        }
+        return lhs.d_words == rhs.d_words;                            // RETURN
+    }
+
+    bsl::int64_t lhsValues[BlockPackedIntArray::k_BLOCK_LENGTH];
+    bsl::int64_t rhsValues[BlockPackedIntArray::k_BLOCK_LENGTH];
+
+    for (bsl::size_t i = 0; i < lhs.d_blocks.size(); ++i) {
+        lhs.decodeBlock(lhsValues, i);
+        rhs.decodeBlock(rhsValues, i);
+        if (0 != bsl::memcmp(lhsValues, rhsValues, sizeof lhsValues)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+// FREE FUNCTIONS
+void bdlc::swap(BlockPackedIntArray& a, BlockPackedIntArray& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+
+        return;                                                       // RETURN
+    }
+
+    BlockPackedIntArray futureA(b, a.allocator());
+    BlockPackedIntArray futureB(a, b.allocator());
+
+    futureA.swap(a);
+    futureB.swap(b);
+}
+
+namespace bdlc {
+
+                       // -------------------------------
+                       // struct BlockPackedIntArray_Impl
+                       // -------------------------------
+
+// CLASS METHODS
+int BlockPackedIntArray_Impl::enabledFeatures()
+{
+    return UnpackKernel::enabled();
+}
+
+void BlockPackedIntArray_Impl::setEnabledFeatures(int features)
+{
+    UnpackKernel::select(features);
+}
+
+int BlockPackedIntArray_Impl::supportedFeatures()
+{
+    return UnpackKernel::supported();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
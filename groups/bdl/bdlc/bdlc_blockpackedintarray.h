@@ -0,0 +1,526 @@
+// bdlc_blockpackedintarray.h                                         -*-C++-*-
+#ifndef INCLUDED_BDLC_BLOCKPACKEDINTARRAY
+#define INCLUDED_BDLC_BLOCKPACKEDINTARRAY
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an append-only array of 64-bit integers packed in blocks.
+//
+//@CLASSES:
+//  bdlc::BlockPackedIntArray: block-encoded array of 'bsl::int64_t' values
+//  bdlc::BlockPackedIntArray_Impl: namespace controlling decoding kernels
+//
+//@SEE_ALSO: bdlc_packedintarray
+//
+//@DESCRIPTION: This component provides a value-semantic array class,
+// 'bdlc::BlockPackedIntArray', that stores a sequence of 'bsl::int64_t' values
+// in considerably less memory than a 'bsl::vector<bsl::int64_t>' or a
+// 'bdlc::PackedIntArray' when the values are clustered or increase steadily
+// (e.g., timestamps, or identifiers drawn from a small range).  Whereas
+// 'bdlc::PackedIntArray' stores every element in 1, 2, 4, or 8 bytes, a
+// 'bdlc::BlockPackedIntArray' divides its elements into blocks of
+// 'k_BLOCK_LENGTH' (256) consecutive values, and stores each block using the
+// smallest number of bits (from 0 to 64) per value sufficient for that block.
+// Values are appended to the end of the array, either one at a time or in
+// bulk; the array does not support modifying or removing individual
+// elements.
+//
+///Encodings
+///---------
+// The encoding of the array, selected at construction, determines what is
+// stored in each block:
+//
+//: 'e_BIT_PACKED':
+//:   Each value is stored in zig-zag form (0, -1, 1, -2, 2, ... are mapped
+//:   to 0, 1, 2, 3, 4, ...), using the bit width of the largest mapped value
+//:   in the block.  This encoding suits values of small magnitude.
+//:
+//: 'e_FRAME_OF_REFERENCE':
+//:   Each value is stored as its offset from the smallest value in the block,
+//:   using the bit width of the largest offset in the block.  This encoding
+//:   suits values drawn from a narrow range, wherever that range lies.
+//:
+//: 'e_DELTA':
+//:   Each value is stored as the difference from its predecessor, less the
+//:   smallest such difference in the block, using the bit width of the
+//:   largest result.  This encoding suits steadily increasing (or decreasing)
+//:   values, such as timestamps, whether or not they are evenly spaced.
+//
+// The encoding affects only the memory used by the array and the cost of
+// random access (see below); it does not contribute to the value of the
+// array, and two arrays having different encodings compare equal if they
+// hold the same sequence of values.
+//
+///Memory Usage
+///------------
+// In addition to the packed values, each encoded block has a fixed-size
+// header recording the bit width, reference values, and location of the
+// block.  Values that have been appended but that do not yet fill a block
+// are held unencoded (8 bytes each) until the block is complete.  The
+// 'storageSize' method reports the number of bytes used by an array
+// (excluding unused capacity).
+//
+///Access
+///------
+// Because every block in an array holds the same number of values, the block
+// containing any element, and the header of that block, are found in
+// constant time.  An element of an 'e_BIT_PACKED' or 'e_FRAME_OF_REFERENCE'
+// array is then extracted directly, whereas an element of an 'e_DELTA' array
+// is reconstructed by summing the preceding differences in its block (at most
+// 'k_BLOCK_LENGTH - 1' of them).
+//
+// The 'decode' method loads a range of consecutive elements into a
+// contiguous array of 'bsl::int64_t', and is far faster, per element, than
+// 'operator[]' for all encodings.  On x86 processors supporting AVX2, blocks
+// are unpacked four values at a time using 256-bit vector instructions; the
+// 'bdlc::BlockPackedIntArray_Impl' 'struct' allows a test driver or
+// benchmark to restrict the processor features used.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Storing a Series of Timestamps
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose we record the time (in microseconds since the epoch) at which each
+// of a large number of events occurs, and wish to keep these timestamps in
+// memory for later analysis.
+//
+// First, we create an array using the 'e_DELTA' encoding, since successive
+// timestamps are close to one another:
+//..
+//  bdlc::BlockPackedIntArray timestamps(bdlc::BlockPackedIntArray::e_DELTA);
+//..
+// Then, we append the timestamps of 100000 events, arriving roughly every
+// millisecond:
+//..
+//  bsl::int64_t time = 1700000000000000LL;
+//  for (int i = 0; i < 100000; ++i) {
+//      time += 1000 + (i * 7919) % 64;
+//      timestamps.append(time);
+//  }
+//  assert(100000 == timestamps.length());
+//..
+// Next, we observe that the timestamps occupy less than an eighth of the
+// memory of a 'bsl::vector<bsl::int64_t>' holding the same values:
+//..
+//  assert(timestamps.storageSize() < 100000 * sizeof(bsl::int64_t) / 8);
+//..
+// Then, we access an individual timestamp:
+//..
+//  assert(1700000000000000LL + 1000 + 0 == timestamps[0]);
+//..
+// Finally, we decode a range of timestamps into a buffer to compute the
+// average interval between events:
+//..
+//  bsl::vector<bsl::int64_t> buffer(1000);
+//  timestamps.decode(buffer.data(), 50000, buffer.size());
+//
+//  const bsl::int64_t average = (buffer.back() - buffer.front()) / 999;
+//  assert(1000 <= average && average < 1064);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_review.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_iosfwd.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlc {
+
+                         // =========================
+                         // class BlockPackedIntArray
+                         // =========================
+
+class BlockPackedIntArray {
+    // This class implements a value-semantic, append-only array of
+    // 'bsl::int64_t' values, stored in blocks of 'k_BLOCK_LENGTH' values each
+    // packed to the bit width required by the block under the encoding
+    // supplied at construction.  Note that the encoding is not a salient
+    // attribute of this object, and, as such, does not contribute to overall
+    // value.
+
+  public:
+    // PUBLIC TYPES
+    enum Encoding {
+        // Enumeration of the ways in which the values of a block are stored.
+
+        e_BIT_PACKED,          // zig-zag mapped values
+        e_FRAME_OF_REFERENCE,  // offsets from the minimum value of the block
+        e_DELTA                // differences between consecutive values
+    };
+
+    enum { k_BLOCK_LENGTH = 256 };  // number of values in each encoded block
+
+  private:
+    // PRIVATE TYPES
+    struct Block {
+        // This 'struct' describes the encoding of one block of values.
+
+        bsl::uint64_t d_base;    // smallest value ('e_FRAME_OF_REFERENCE'),
+                                 // or first value ('e_DELTA'), of the block
+
+        bsl::uint64_t d_step;    // smallest difference between consecutive
+                                 // values of the block ('e_DELTA' only)
+
+        bsl::size_t   d_offset;  // index, in 'd_words', of the first word of
+                                 // the packed values of the block
+
+        int           d_width;   // number of bits per packed value, in the
+                                 // range '[0 .. 64]'
+    };
+
+    // DATA
+    Encoding                   d_encoding;  // encoding of every block
+
+    bsl::vector<Block>         d_blocks;    // description of each encoded
+                                            // block
+
+    bsl::vector<bsl::uint64_t> d_words;     // packed values of all encoded
+                                            // blocks
+
+    bsl::vector<bsl::int64_t>  d_tail;      // values not yet encoded (fewer
+                                            // than 'k_BLOCK_LENGTH')
+
+    // FRIENDS
+    friend bool operator==(const BlockPackedIntArray&,
+                           const BlockPackedIntArray&);
+
+    // PRIVATE MANIPULATORS
+    void encodeBlock(const bsl::int64_t *values);
+        // Append to the encoded blocks of this array a block holding the
+        // 'k_BLOCK_LENGTH' values in the specified 'values' array.  This
+        // method provides the strong exception-safety guarantee.
+
+    // PRIVATE ACCESSORS
+    void decodeBlock(bsl::int64_t *result, bsl::size_t blockIndex) const;
+        // Load, into the 'k_BLOCK_LENGTH' elements of the specified 'result'
+        // array, the values of the encoded block having the specified
+        // 'blockIndex'.  The behavior is undefined unless
+        // 'blockIndex < d_blocks.size()'.
+
+    bsl::int64_t decodeValue(bsl::size_t blockIndex, int position) const;
+        // Return the value at the specified 'position' in the encoded block
+        // having the specified 'blockIndex'.  The behavior is undefined unless
+        // 'blockIndex < d_blocks.size()' and
+        // '0 <= position < k_BLOCK_LENGTH'.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(BlockPackedIntArray,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit BlockPackedIntArray(bslma::Allocator *basicAllocator = 0);
+    explicit BlockPackedIntArray(Encoding          encoding,
+                                 bslma::Allocator *basicAllocator = 0);
+        // Create an empty array.  Optionally specify the 'encoding' used to
+        // store the values of the array.  If 'encoding' is not specified,
+        // 'e_FRAME_OF_REFERENCE' is used.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    BlockPackedIntArray(const BlockPackedIntArray&  original,
+                        bslma::Allocator           *basicAllocator = 0);
+        // Create an array having the same value and encoding as the specified
+        // 'original' array.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    //! ~BlockPackedIntArray() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    BlockPackedIntArray& operator=(const BlockPackedIntArray& rhs);
+        // Assign to this array the value and encoding of the specified 'rhs'
+        // array, and return a reference providing modifiable access to this
+        // array.
+
+    void append(bsl::int64_t value);
+        // Append an element having the specified 'value' to the end of this
+        // array.  This method provides the strong exception-safety guarantee.
+
+    void append(const bsl::int64_t *values, bsl::size_t numValues);
+        // Append the specified 'numValues' elements of the specified 'values'
+        // array to the end of this array.  If an exception is thrown, this
+        // array holds its original elements followed by some (possibly none)
+        // of the leading elements of 'values'.  The behavior is undefined
+        // unless 'values' refers to an array of at least 'numValues' elements.
+
+    void removeAll();
+        // Remove all the elements from this array.  Note that the encoding of
+        // this array is unchanged.
+
+    void swap(BlockPackedIntArray& other);
+        // Efficiently exchange the value and encoding of this array with those
+        // of the specified 'other' array.  This method provides the no-throw
+        // exception-safety guarantee.  The behavior is undefined unless this
+        // array was created with the same allocator as 'other'.
+
+    // ACCESSORS
+    bsl::int64_t operator[](bsl::size_t index) const;
+        // Return the value of the element at the specified 'index' in this
+        // array.  The behavior is undefined unless 'index < length()'.  Note
+        // that, for an 'e_DELTA' array, this operation may take time
+        // proportional to 'k_BLOCK_LENGTH'.
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this array to supply memory.
+
+    void decode(bsl::int64_t *result,
+                bsl::size_t   index,
+                bsl::size_t   numValues) const;
+        // Load, into the specified 'result' array, the values of the specified
+        // 'numValues' consecutive elements of this array starting at the
+        // specified 'index'.  The behavior is undefined unless
+        // 'index + numValues <= length()' and 'result' refers to an array of
+        // at least 'numValues' elements.
+
+    Encoding encoding() const;
+        // Return the encoding used to store the values of this array.
+
+    bool isEmpty() const;
+        // Return 'true' if this array has no elements, and 'false' otherwise.
+
+    bsl::size_t length() const;
+        // Return the number of elements in this array.
+
+    bsl::size_t storageSize() const;
+        // Return the number of bytes used to hold the elements of this array,
+        // excluding any unused capacity and the footprint of this object.
+
+                                  // Aspects
+
+    bsl::ostream& print(bsl::ostream& stream,
+                        int           level = 0,
+                        int           spacesPerLevel = 4) const;
+        // Write the value of this array to the specified output 'stream' in a
+        // human-readable format, and return a reference to 'stream'.
+        // Optionally specify an initial indentation 'level', whose absolute
+        // value is incremented recursively for nested objects.  If 'level' is
+        // specified, optionally specify 'spacesPerLevel', whose absolute value
+        // indicates the number of spaces per indentation level for this and
+        // all of its nested objects.  If 'level' is negative, suppress
+        // indentation of the first line.  If 'spacesPerLevel' is negative,
+        // format the entire output on one line, suppressing all but the
+        // initial indentation (as governed by 'level').  If 'stream' is not
+        // valid on entry, this operation has no effect.  Note that the format
+        // is not fully specified, and can change without notice.
+};
+
+// FREE OPERATORS
+bool operator==(const BlockPackedIntArray& lhs,
+                const BlockPackedIntArray& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' arrays have the same
+    // value, and 'false' otherwise.  Two arrays have the same value if they
+    // have the same length, and corresponding elements at each index have
+    // the same value.
+
+bool operator!=(const BlockPackedIntArray& lhs,
+                const BlockPackedIntArray& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' arrays do not have the
+    // same value, and 'false' otherwise.  Two arrays do not have the same
+    // value if they do not have the same length, or there is at least one
+    // valid index at which corresponding elements do not have the same value.
+
+bsl::ostream& operator<<(bsl::ostream&              stream,
+                         const BlockPackedIntArray& array);
+    // Write the value of the specified 'array' to the specified output
+    // 'stream' in a single-line format, and return a reference to 'stream'.
+
+// FREE FUNCTIONS
+void swap(BlockPackedIntArray& a, BlockPackedIntArray& b);
+    // Exchange the values and encodings of the specified 'a' and 'b' arrays.
+    // This function provides the no-throw exception-safety guarantee if the
+    // two arrays were created with the same allocator and the basic guarantee
+    // otherwise.
+
+                       // ===============================
+                       // struct BlockPackedIntArray_Impl
+                       // ===============================
+
+struct BlockPackedIntArray_Impl {
+    // This 'struct' provides a namespace for functions that report and
+    // restrict the processor features used to decode the blocks of
+    // 'BlockPackedIntArray' objects.  These functions are intended for use by
+    // test drivers and benchmarks.
+
+    // TYPES
+    enum Feature {
+        e_AVX2 = 1  // 256-bit integer vectors
+    };
+
+    // CLASS METHODS
+    static int enabledFeatures();
+        // Return the bitwise-OR of the 'Feature' values currently used to
+        // decode blocks.
+
+    static void setEnabledFeatures(int features);
+        // Use only those of the specified 'features' (a bitwise-OR of
+        // 'Feature' values) that are also supported by the processor.  The
+        // behavior is undefined if any 'BlockPackedIntArray' object is in use
+        // by another thread during this call.  Note that decoded values are
+        // identical whatever the features in use.
+
+    static int supportedFeatures();
+        // Return the bitwise-OR of the 'Feature' values supported by both the
+        // processor and this build of the component.
+};
+
+// ============================================================================
+//                              INLINE DEFINITIONS
+// ============================================================================
+
+                         // -------------------------
+                         // class BlockPackedIntArray
+                         // -------------------------
+
+// CREATORS
+inline
+BlockPackedIntArray::BlockPackedIntArray(bslma::Allocator *basicAllocator)
+: d_encoding(e_FRAME_OF_REFERENCE)
+, d_blocks(basicAllocator)
+, d_words(basicAllocator)
+, d_tail(basicAllocator)
+{
+}
+
+inline
+BlockPackedIntArray::BlockPackedIntArray(Encoding          encoding,
+                                         bslma::Allocator *basicAllocator)
+: d_encoding(encoding)
+, d_blocks(basicAllocator)
+, d_words(basicAllocator)
+, d_tail(basicAllocator)
+{
+    BSLS_ASSERT(e_BIT_PACKED <= encoding && encoding <= e_DELTA);
+}
+
+inline
+BlockPackedIntArray::BlockPackedIntArray(
+                                   const BlockPackedIntArray&  original,
+                                   bslma::Allocator           *basicAllocator)
+: d_encoding(original.d_encoding)
+, d_blocks(original.d_blocks, basicAllocator)
+, d_words(original.d_words, basicAllocator)
+, d_tail(original.d_tail, basicAllocator)
+{
+}
+
+// MANIPULATORS
+inline
+void BlockPackedIntArray::removeAll()
+{
+    d_blocks.clear();
+    d_words.clear();
+    d_tail.clear();
+}
+
+inline
+void BlockPackedIntArray::swap(BlockPackedIntArray& other)
+{
+    // 'swap' is undefined for objects with non-equal allocators.
+
+    BSLS_ASSERT(allocator() == other.allocator());
+
+    Encoding encoding = d_encoding;
+    d_encoding        = other.d_encoding;
+    other.d_encoding  = encoding;
+
+    d_blocks.swap(other.d_blocks);
+    d_words.swap(other.d_words);
+    d_tail.swap(other.d_tail);
+}
+
+// ACCESSORS
+inline
+bsl::int64_t BlockPackedIntArray::operator[](bsl::size_t index) const
+{
+    BSLS_ASSERT(index < length());
+
+    const bsl::size_t blockIndex = index / k_BLOCK_LENGTH;
+    const int         position   = static_cast<int>(index % k_BLOCK_LENGTH);
+
+    return blockIndex < d_blocks.size() ? decodeValue(blockIndex, position)
+                                        : d_tail[position];
+}
+
+inline
+bslma::Allocator *BlockPackedIntArray::allocator() const
+{
+    return d_words.get_allocator().mechanism();
+}
+
+inline
+BlockPackedIntArray::Encoding BlockPackedIntArray::encoding() const
+{
+    return d_encoding;
+}
+
+inline
+bool BlockPackedIntArray::isEmpty() const
+{
+    return d_blocks.empty() && d_tail.empty();
+}
+
+inline
+bsl::size_t BlockPackedIntArray::length() const
+{
+    return d_blocks.size() * k_BLOCK_LENGTH + d_tail.size();
+}
+
+inline
+bsl::size_t BlockPackedIntArray::storageSize() const
+{
+    return d_blocks.size() * sizeof(Block)
+         + d_words.size()  * sizeof(bsl::uint64_t)
+         + d_tail.size()   * sizeof(bsl::int64_t);
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+inline
+bool bdlc::operator!=(const BlockPackedIntArray& lhs,
+                      const BlockPackedIntArray& rhs)
+{
+    return !(lhs == rhs);
+}
+
+inline
+bsl::ostream& bdlc::operator<<(bsl::ostream&              stream,
+                               const BlockPackedIntArray& array)
+{
+    return array.print(stream, 0, -1);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1467 @@
+// bdlc_blockpackedintarray.t.cpp                                     -*-C++-*-
+#include <bdlc_blockpackedintarray.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+#include <bslma_testallocatorexception.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a value-semantic, append-only container whose
+// elements are stored in encoded blocks.  The primary manipulators are the
+// constructor taking an encoding and 'append(bsl::int64_t)'; the basic
+// accessors are 'length' and 'operator[]'.  Every test compares the contents
+// of objects against a 'bsl::vector<bsl::int64_t>' oracle, for each of the
+// three encodings, with sequences of values chosen to produce blocks of every
+// bit width, including sequences that are only partially encoded.  The
+// decoding kernels are tested against one another by restricting the
+// processor features used.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] BlockPackedIntArray(bslma::Allocator *ba = 0);
+// [ 2] BlockPackedIntArray(Encoding encoding, bslma::Allocator *ba = 0);
+// [ 5] BlockPackedIntArray(const BPIA& original, bslma::Allocator *ba);
+// [ 2] ~BlockPackedIntArray();
+//
+// MANIPULATORS
+// [ 7] BlockPackedIntArray& operator=(const BlockPackedIntArray& rhs);
+// [ 2] void append(bsl::int64_t value);
+// [ 8] void append(const bsl::int64_t *values, bsl::size_t numValues);
+// [ 2] void removeAll();
+// [ 6] void swap(BlockPackedIntArray& other);
+//
+// ACCESSORS
+// [ 2] bsl::int64_t operator[](bsl::size_t index) const;
+// [ 2] bslma::Allocator *allocator() const;
+// [ 8] void decode(bsl::int64_t *result, size_t index, size_t num) const;
+// [ 2] Encoding encoding() const;
+// [ 2] bool isEmpty() const;
+// [ 2] bsl::size_t length() const;
+// [ 9] bsl::size_t storageSize() const;
+// [ 3] ostream& print(ostream& stream, int level, int spl) const;
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const BPIA& lhs, const BPIA& rhs);
+// [ 4] bool operator!=(const BPIA& lhs, const BPIA& rhs);
+// [ 3] ostream& operator<<(ostream& stream, const BPIA& array);
+//
+// FREE FUNCTIONS
+// [ 6] void swap(BlockPackedIntArray& a, BlockPackedIntArray& b);
+//
+// BlockPackedIntArray_Impl
+// [10] int enabledFeatures();
+// [10] void setEnabledFeatures(int features);
+// [10] int supportedFeatures();
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [11] USAGE EXAMPLE
+// [ 9] CONCERN: blocks of every bit width are encoded and decoded exactly
+// [-1] PERFORMANCE: 'decode' and 'append'
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::BlockPackedIntArray      Obj;
+typedef bdlc::BlockPackedIntArray_Impl Impl;
+typedef bsl::int64_t                   Int64;
+typedef bsl::uint64_t                  Uint64;
+
+const int BLOCK = Obj::k_BLOCK_LENGTH;
+
+const Obj::Encoding ENCODINGS[] = {
+    Obj::e_BIT_PACKED,
+    Obj::e_FRAME_OF_REFERENCE,
+    Obj::e_DELTA
+};
+const int NUM_ENCODINGS = sizeof ENCODINGS / sizeof *ENCODINGS;
+
+const Int64 MIN_INT64 = bsl::numeric_limits<Int64>::min();
+const Int64 MAX_INT64 = bsl::numeric_limits<Int64>::max();
+
+// ============================================================================
+//                     GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+Uint64 nextRandom(Uint64 *state)
+    // Return the next value of the pseudo-random sequence whose state is held
+    // in the specified 'state'.
+{
+    Uint64 x = *state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    *state = x;
+    return x;
+}
+
+Int64 randomValue(Uint64 *state, int width)
+    // Return a pseudo-random value, derived from the specified 'state', whose
+    // magnitude is representable in the specified 'width' bits.
+{
+    const Uint64 value = nextRandom(state);
+    return 64 <= width ? static_cast<Int64>(value)
+                       : static_cast<Int64>(value >> (64 - width));
+}
+
+void generate(bsl::vector<Int64> *result,
+              int                 kind,
+              bsl::size_t         length,
+              Uint64              seed)
+    // Load into the specified 'result' a sequence of the specified 'length'
+    // values of the pattern identified by the specified 'kind' (in the range
+    // '[0 .. 6]'), using the specified 'seed' for pseudo-random values.
+{
+    result->clear();
+
+    Uint64 state = seed * 0x9E3779B97F4A7C15ULL + 1;
+    Int64  value = static_cast<Int64>(nextRandom(&state)) >> 20;
+
+    for (bsl::size_t i = 0; i < length; ++i) {
+        const int width = static_cast<int>((i / BLOCK) % 65);
+
+        switch (kind) {
+          case 0: {  // small signed values, block width increasing
+            value = width ? randomValue(&state, width) >> 1 : 0;
+          } break;
+          case 1: {  // narrow range around a large offset
+            value = 4000000000LL + (randomValue(&state, 20) & 0xfffff);
+          } break;
+          case 2: {  // increasing timestamps
+            value += 1000 + (nextRandom(&state) & 0x3f);
+          } break;
+          case 3: {  // decreasing values
+            value -= static_cast<Int64>(nextRandom(&state) & 0xffff);
+          } break;
+          case 4: {  // full-range values
+            value = static_cast<Int64>(nextRandom(&state));
+          } break;
+          case 5: {  // extreme values
+            const Uint64 r = nextRandom(&state) % 4;
+            value = 0 == r ? MIN_INT64
+                  : 1 == r ? MAX_INT64
+                  : 2 == r ? 0
+                  : -1;
+          } break;
+          default: {  // constant
+            value = -12345;
+          } break;
+        }
+        result->push_back(value);
+    }
+}
+
+const int NUM_KINDS = 7;
+
+bool verify(int line, const Obj& X, const bsl::vector<Int64>& expected)
+    // Return 'true' if the specified 'X' holds the specified 'expected'
+    // values, as observed through both 'operator[]' and 'decode', and report
+    // any difference, attributed to the specified 'line', and return 'false'
+    // otherwise.
+{
+    if (expected.size() != X.length()) {
+        ASSERTV(line, expected.size(), X.length(),
+                expected.size() == X.length());
+        return false;                                                 // RETURN
+    }
+
+    bool ok = true;
+    for (bsl::size_t i = 0; i < expected.size(); ++i) {
+        if (expected[i] != X[i]) {
+            ASSERTV(line, i, expected[i], X[i], expected[i] == X[i]);
+            ok = false;
+            break;
+        }
+    }
+
+    bsl::vector<Int64> decoded(expected.size() + 1, 7);
+    X.decode(decoded.data(), 0, expected.size());
+    if (!bsl::equal(expected.begin(), expected.end(), decoded.begin())) {
+        ASSERTV(line, "decode", false);
+        ok = false;
+    }
+    ASSERTV(line, 7 == decoded.back());
+
+    return ok;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 11: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Storing a Series of Timestamps
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose we record the time (in microseconds since the epoch) at which each
+// of a large number of events occurs, and wish to keep these timestamps in
+// memory for later analysis.
+//
+// First, we create an array using the 'e_DELTA' encoding, since successive
+// timestamps are close to one another:
+//..
+    bdlc::BlockPackedIntArray timestamps(bdlc::BlockPackedIntArray::e_DELTA);
+//..
+// Then, we append the timestamps of 100000 events, arriving roughly every
+// millisecond:
+//..
+    bsl::int64_t time = 1700000000000000LL;
+    for (int i = 0; i < 100000; ++i) {
+        time += 1000 + (i * 7919) % 64;
+        timestamps.append(time);
+    }
+    ASSERT(100000 == timestamps.length());
+//..
+// Next, we observe that the timestamps occupy less than an eighth of the
+// memory of a 'bsl::vector<bsl::int64_t>' holding the same values:
+//..
+    ASSERT(timestamps.storageSize() < 100000 * sizeof(bsl::int64_t) / 8);
+//..
+// Then, we access an individual timestamp:
+//..
+    ASSERT(1700000000000000LL + 1000 + 0 == timestamps[0]);
+//..
+// Finally, we decode a range of timestamps into a buffer to compute the
+// average interval between events:
+//..
+    bsl::vector<bsl::int64_t> buffer(1000);
+    timestamps.decode(buffer.data(), 50000, buffer.size());
+
+    const bsl::int64_t average = (buffer.back() - buffer.front()) / 999;
+    ASSERT(1000 <= average && average < 1064);
+//..
+      } break;
+      case 10: {
+        // --------------------------------------------------------------------
+        // TESTING 'BlockPackedIntArray_Impl'
+        //
+        // Concerns:
+        //: 1 'supportedFeatures' reports a subset of the defined features, and
+        //:   initially all supported features are enabled.
+        //:
+        //: 2 'setEnabledFeatures' enables exactly those requested features
+        //:   that are supported.
+        //:
+        //: 3 Decoded values do not depend on the features enabled.
+        //
+        // Plan:
+        //: 1 Verify the initial state reported by the accessors.  (C-1)
+        //:
+        //: 2 For each subset of the defined features, enable the subset, and
+        //:   verify 'enabledFeatures'.  (C-2)
+        //:
+        //: 3 For each subset of the supported features, decode arrays having
+        //:   blocks of every bit width, and compare with an oracle.  (C-3)
+        //
+        // Testing:
+        //   int enabledFeatures();
+        //   void setEnabledFeatures(int features);
+        //   int supportedFeatures();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'BlockPackedIntArray_Impl'" << endl
+                          << "==================================" << endl;
+
+        const int ALL       = Impl::e_AVX2;
+        const int SUPPORTED = Impl::supportedFeatures();
+
+        if (verbose) { P(SUPPORTED) }
+
+        ASSERTV(SUPPORTED, 0 == (SUPPORTED & ~ALL));
+        ASSERTV(SUPPORTED, SUPPORTED == Impl::enabledFeatures());
+
+        for (int features = 0; features <= ALL; ++features) {
+            Impl::setEnabledFeatures(features);
+            ASSERTV(features, (features & SUPPORTED) ==
+                                                     Impl::enabledFeatures());
+
+            for (int ei = 0; ei < NUM_ENCODINGS; ++ei) {
+                for (int kind = 0; kind < NUM_KINDS; ++kind) {
+                    bsl::vector<Int64> values;
+                    generate(&values, kind, 65 * BLOCK + 17, kind + 1);
+
+                    Obj mX(ENCODINGS[ei]);  const Obj& X = mX;
+                    mX.append(values.data(), values.size());
+
+                    ASSERTV(features, ei, kind, verify(L_, X, values));
+                }
+            }
+        }
+
+        Impl::setEnabledFeatures(ALL);
+        ASSERTV(SUPPORTED == Impl::enabledFeatures());
+      } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // TESTING ENCODINGS AND 'storageSize'
+        //
+        // Concerns:
+        //: 1 Blocks of every bit width, from 0 to 64, are encoded and decoded
+        //:   exactly for every encoding, including blocks containing the
+        //:   extreme values of 'bsl::int64_t', and blocks whose consecutive
+        //:   differences are not representable as 'bsl::int64_t'.
+        //:
+        //: 2 Each block uses the smallest bit width sufficient for its values
+        //:   under the encoding of the array, as reflected by 'storageSize'.
+        //:
+        //: 3 'storageSize' accounts for values not yet encoded.
+        //
+        // Plan:
+        //: 1 For each encoding, and each of a set of value patterns, append
+        //:   values one at a time, and verify the contents against an
+        //:   oracle.  (C-1)
+        //:
+        //: 2 For each encoding, append blocks whose values are chosen to
+        //:   require each bit width in turn, and verify the increase in
+        //:   'storageSize' for each block.  (C-2..3)
+        //
+        // Testing:
+        //   bsl::size_t storageSize() const;
+        //   CONCERN: blocks of every bit width are encoded and decoded exactly
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING ENCODINGS AND 'storageSize'" << endl
+                          << "===================================" << endl;
+
+        if (verbose) cout << "\nTesting value patterns." << endl;
+
+        for (int ei = 0; ei < NUM_ENCODINGS; ++ei) {
+            for (int kind = 0; kind < NUM_KINDS; ++kind) {
+                bsl::vector<Int64> values;
+                generate(&values, kind, 66 * BLOCK + 5, 17 * kind + ei);
+
+                Obj mX(ENCODINGS[ei]);  const Obj& X = mX;
+                for (bsl::size_t i = 0; i < values.size(); ++i) {
+                    mX.append(values[i]);
+                }
+                ASSERTV(ei, kind, verify(L_, X, values));
+
+                if (veryVerbose) {
+                    T_ P_(ei) P_(kind) P(X.storageSize())
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting bit widths." << endl;
+
+        bsl::size_t headerSize;
+        {
+            // Determine the size of a block header from an all-zero block.
+
+            Obj mX;
+            for (int i = 0; i < BLOCK; ++i) {
+                mX.append(0);
+            }
+            headerSize = mX.storageSize();
+        }
+        const bsl::size_t HEADER_SIZE = headerSize;
+
+        ASSERTV(HEADER_SIZE, 0 < HEADER_SIZE);
+        ASSERTV(HEADER_SIZE, HEADER_SIZE <= 64);
+
+        for (int ei = 0; ei < NUM_ENCODINGS; ++ei) {
+            const Obj::Encoding ENCODING = ENCODINGS[ei];
+
+            Obj mX(ENCODING);  const Obj& X = mX;
+
+            bsl::vector<Int64> expected;
+
+            for (int width = 0; width <= 64; ++width) {
+                // Create a block whose encoded values need exactly 'width'
+                // bits: the largest encoded value is '2^width - 1'.
+
+                const Uint64 MAX = 64 == width
+                                 ? ~static_cast<Uint64>(0)
+                                 : (static_cast<Uint64>(1) << width) - 1;
+
+                Int64 block[BLOCK];
+                Uint64 state = width + 1;
+
+                for (int i = 0; i < BLOCK; ++i) {
+                    const Uint64 r = width ? nextRandom(&state) & MAX : 0;
+
+                    switch (ENCODING) {
+                      case Obj::e_BIT_PACKED: {
+                        // Invert the zig-zag mapping.
+
+                        const Uint64 packed = 7 == i ? MAX : r;
+                        block[i] = static_cast<Int64>((packed >> 1) ^
+                                                         (0 - (packed & 1)));
+                      } break;
+                      case Obj::e_FRAME_OF_REFERENCE: {
+                        const Uint64 offset = 7 == i ? MAX : 3 == i ? 0 : r;
+                        block[i] = static_cast<Int64>(
+                                        static_cast<Uint64>(MIN_INT64 / 3) +
+                                        offset);
+                      } break;
+                      case Obj::e_DELTA: {
+                        const Uint64 delta = 7 == i ? MAX : 3 == i ? 0 : r;
+                        block[i] = 0 == i
+                                 ? 987654321
+                                 : static_cast<Int64>(
+                                       static_cast<Uint64>(block[i - 1]) +
+                                       delta - 5);
+                      } break;
+                    }
+                }
+
+                const bsl::size_t SIZE = X.storageSize();
+
+                mX.append(block, BLOCK);
+                expected.insert(expected.end(), block, block + BLOCK);
+
+                const bsl::size_t EXP = HEADER_SIZE
+                                      + BLOCK * width / 8;
+
+                ASSERTV(ei, width, EXP, X.storageSize() - SIZE,
+                        EXP == X.storageSize() - SIZE);
+            }
+            ASSERTV(ei, verify(L_, X, expected));
+
+            const bsl::size_t SIZE = X.storageSize();
+
+            mX.append(1);
+            mX.append(2);
+            ASSERTV(ei, SIZE + 2 * sizeof(Int64) == X.storageSize());
+
+            mX.removeAll();
+            ASSERTV(ei, 0 == X.storageSize());
+        }
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // TESTING BULK 'append' AND 'decode'
+        //
+        // Concerns:
+        //: 1 Bulk 'append' appends the supplied values whether the array
+        //:   initially holds a whole number of blocks or not, and whether the
+        //:   supplied values fill, exceed, or fall short of the current
+        //:   block.
+        //:
+        //: 2 Bulk 'append' of no values has no effect.
+        //:
+        //: 3 The values appended in bulk are encoded identically to the same
+        //:   values appended one at a time.
+        //:
+        //: 4 'decode' loads any range of consecutive elements, including
+        //:   ranges starting or ending within a block or within the values
+        //:   not yet encoded, and empty ranges, and writes nothing beyond the
+        //:   requested range.
+        //:
+        //: 5 If an allocation fails during bulk 'append', the array holds its
+        //:   original values followed by a prefix of the appended values.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each encoding, append a sequence of values in chunks of
+        //:   various sizes, and verify the result against an oracle and
+        //:   against an array built one value at a time.  (C-1..3)
+        //:
+        //: 2 For each encoding, decode all ranges having starting points and
+        //:   lengths from a set chosen around block boundaries, into a buffer
+        //:   filled with a sentinel value.  (C-4)
+        //:
+        //: 3 Use the 'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*' macros to inject
+        //:   allocation failures.  (C-5)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-6)
+        //
+        // Testing:
+        //   void append(const bsl::int64_t *values, bsl::size_t numValues);
+        //   void decode(bsl::int64_t *result, size_t index, size_t num) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING BULK 'append' AND 'decode'" << endl
+                          << "==================================" << endl;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        const bsl::size_t CHUNKS[] = { 0, 1, 5, 255, 256, 257, 300, 511, 512,
+                                       1000 };
+        const int NUM_CHUNKS = sizeof CHUNKS / sizeof *CHUNKS;
+
+        if (verbose) cout << "\nTesting 'append'." << endl;
+
+        for (int ei = 0; ei < NUM_ENCODINGS; ++ei) {
+            for (int ci = 0; ci < NUM_CHUNKS; ++ci) {
+                bsl::vector<Int64> values;
+                generate(&values, ci % NUM_KINDS, 9 * BLOCK + 77, ci);
+
+                Obj mX(ENCODINGS[ei], &oa);  const Obj& X = mX;
+                Obj mY(ENCODINGS[ei], &oa);  const Obj& Y = mY;
+
+                for (bsl::size_t i = 0; i < values.size(); ++i) {
+                    mY.append(values[i]);
+                }
+
+                bsl::size_t done = 0;
+                for (int step = 0; done < values.size(); ++step) {
+                    bsl::size_t count = CHUNKS[(ci + step) % NUM_CHUNKS];
+                    count = bsl::min(count, values.size() - done);
+
+                    const bsl::size_t LENGTH = X.length();
+
+                    bslma::TestAllocatorMonitor dam(&da);
+
+                    mX.append(values.data() + done, count);
+                    done += count;
+
+                    ASSERTV(ei, ci, step, LENGTH + count == X.length());
+                    ASSERTV(ei, ci, step, dam.isTotalSame());
+                }
+                ASSERTV(ei, ci, verify(L_, X, values));
+                ASSERTV(ei, ci, X == Y);
+                ASSERTV(ei, ci, X.storageSize() == Y.storageSize());
+            }
+        }
+
+        if (verbose) cout << "\nTesting 'decode'." << endl;
+
+        for (int ei = 0; ei < NUM_ENCODINGS; ++ei) {
+            bsl::vector<Int64> values;
+            generate(&values, ei + 2, 4 * BLOCK + 100, ei);
+
+            Obj mX(ENCODINGS[ei], &oa);  const Obj& X = mX;
+            mX.append(values.data(), values.size());
+
+            const bsl::size_t POINTS[] = { 0, 1, 2, 100, 255, 256, 257, 511,
+                                           512, 600, 1023, 1024, 1025, 1100,
+                                           1123, 1124 };
+            const int NUM_POINTS = sizeof POINTS / sizeof *POINTS;
+
+            bsl::vector<Int64> buffer(X.length() + 2);
+
+            for (int bi = 0; bi < NUM_POINTS; ++bi) {
+                for (int ei2 = bi; ei2 < NUM_POINTS; ++ei2) {
+                    const bsl::size_t BEGIN = POINTS[bi];
+                    const bsl::size_t END   = POINTS[ei2];
+
+                    bsl::fill(buffer.begin(), buffer.end(), -99);
+                    mX.decode(buffer.data() + 1, BEGIN, END - BEGIN);
+
+                    ASSERTV(ei, BEGIN, END, -99 == buffer[0]);
+                    ASSERTV(ei, BEGIN, END, -99 == buffer[END - BEGIN + 1]);
+                    ASSERTV(ei, BEGIN, END,
+                            bsl::equal(values.begin() + BEGIN,
+                                       values.begin() + END,
+                                       buffer.begin() + 1));
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting exception safety." << endl;
+
+        for (int ei = 0; ei < NUM_ENCODINGS; ++ei) {
+            bsl::vector<Int64> values;
+            generate(&values, 2, 3 * BLOCK + 10, ei);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                Obj mX(ENCODINGS[ei], &oa);  const Obj& X = mX;
+                mX.append(values.data(), 100);
+
+                {
+                    // Verify the contents of 'X' if an exception is thrown by
+                    // the following 'append'.
+
+                    struct Checker {
+                        const Obj&                 d_object;
+                        const bsl::vector<Int64>&  d_values;
+
+                        ~Checker()
+                        {
+                            const bsl::size_t N = d_object.length();
+                            ASSERTV(N, 100 <= N && N <= d_values.size());
+
+                            bsl::vector<Int64> prefix(d_values.begin(),
+                                                      d_values.begin() + N);
+                            ASSERT(verify(L_, d_object, prefix));
+                        }
+                    } checker = { X, values };
+
+                    mX.append(values.data() + 100, values.size() - 100);
+                }
+                ASSERTV(ei, values.size() == X.length());
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&oa);
+            for (int i = 0; i < 300; ++i) {
+                mX.append(i);
+            }
+            Int64 buffer[300];
+
+            ASSERT_PASS(mX.append(0, 0));
+            ASSERT_FAIL(mX.append(0, 1));
+
+            ASSERT_PASS(mX.decode(buffer, 0,   300));
+            ASSERT_PASS(mX.decode(buffer, 300, 0));
+            ASSERT_PASS(mX.decode(0,      300, 0));
+            ASSERT_FAIL(mX.decode(0,      0,   1));
+            ASSERT_FAIL(mX.decode(buffer, 0,   301));
+            ASSERT_FAIL(mX.decode(buffer, 301, 0));
+            ASSERT_FAIL(mX.decode(buffer, 299, 2));
+        }
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING COPY-ASSIGNMENT OPERATOR
+        //
+        // Concerns:
+        //: 1 The assignment operator assigns the value and encoding of the
+        //:   source to the target, and returns a reference to the target.
+        //:
+        //: 2 The allocator of the target is unchanged, and no memory is
+        //:   supplied by any other allocator.
+        //:
+        //: 3 The source is not modified, and self-assignment has no effect.
+        //:
+        //: 4 The assignment provides the strong exception-safety guarantee.
+        //
+        // Plan:
+        //: 1 For each pair of objects created from a table of lengths and
+        //:   encodings, assign one to the other and verify the result and the
+        //:   allocators used, under injected allocation failures.  (C-1..4)
+        //
+        // Testing:
+        //   BlockPackedIntArray& operator=(const BlockPackedIntArray& rhs);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING COPY-ASSIGNMENT OPERATOR" << endl
+                          << "================================" << endl;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("source",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        const bsl::size_t LENGTHS[] = { 0, 1, 255, 256, 600 };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        for (int i = 0; i < NUM_LENGTHS * NUM_ENCODINGS; ++i) {
+            bsl::vector<Int64> srcValues;
+            generate(&srcValues, i % NUM_KINDS, LENGTHS[i % NUM_LENGTHS], i);
+
+            Obj mZ(ENCODINGS[i / NUM_LENGTHS], &sa);  const Obj& Z = mZ;
+            mZ.append(srcValues.data(), srcValues.size());
+
+            for (int j = 0; j < NUM_LENGTHS * NUM_ENCODINGS; ++j) {
+                bsl::vector<Int64> dstValues;
+                generate(&dstValues, j % NUM_KINDS, LENGTHS[j % NUM_LENGTHS],
+                         j + 100);
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    Obj mX(ENCODINGS[j / NUM_LENGTHS], &oa);
+                    const Obj& X = mX;
+                    mX.append(dstValues.data(), dstValues.size());
+
+                    bslma::TestAllocatorMonitor dam(&da);
+                    bslma::TestAllocatorMonitor sam(&sa);
+
+                    Obj *mR = &(mX = Z);
+
+                    ASSERTV(i, j, dam.isTotalSame());
+                    ASSERTV(i, j, sam.isTotalSame());
+
+                    ASSERTV(i, j, mR == &mX);
+                    ASSERTV(i, j, verify(L_, X, srcValues));
+                    ASSERTV(i, j, Z.encoding() == X.encoding());
+                    ASSERTV(i, j, &oa == X.allocator());
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(i, j, verify(L_, Z, srcValues));
+            }
+
+            Obj *mR = &(mZ = Z);
+            ASSERTV(i, mR == &mZ);
+            ASSERTV(i, verify(L_, Z, srcValues));
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING SWAP
+        //
+        // Concerns:
+        //: 1 Both the member and free 'swap' exchange the values and encodings
+        //:   of two objects.
+        //:
+        //: 2 The member 'swap' and the free 'swap' for objects having the same
+        //:   allocator allocate no memory.
+        //:
+        //: 3 The free 'swap' exchanges the values of objects having different
+        //:   allocators.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each pair of objects created from a table of lengths and
+        //:   encodings, swap the objects and verify the results.  (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a member 'swap' of objects having different
+        //:   allocators.  (C-4)
+        //
+        // Testing:
+        //   void swap(BlockPackedIntArray& other);
+        //   void swap(BlockPackedIntArray& a, BlockPackedIntArray& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING SWAP" << endl
+                          << "============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        const bsl::size_t LENGTHS[] = { 0, 3, 256, 700 };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        for (int i = 0; i < NUM_LENGTHS * NUM_ENCODINGS; ++i) {
+            const Obj::Encoding ENC_A = ENCODINGS[i / NUM_LENGTHS];
+
+            bsl::vector<Int64> a;
+            generate(&a, i % NUM_KINDS, LENGTHS[i % NUM_LENGTHS], i);
+
+            for (int j = 0; j < NUM_LENGTHS * NUM_ENCODINGS; ++j) {
+                const Obj::Encoding ENC_B = ENCODINGS[j / NUM_LENGTHS];
+
+                bsl::vector<Int64> b;
+                generate(&b, j % NUM_KINDS, LENGTHS[j % NUM_LENGTHS], j + 50);
+
+                Obj mX(ENC_A, &oa);  const Obj& X = mX;
+                Obj mY(ENC_B, &oa);  const Obj& Y = mY;
+                Obj mZ(ENC_B, &za);  const Obj& Z = mZ;
+
+                mX.append(a.data(), a.size());
+                mY.append(b.data(), b.size());
+                mZ.append(b.data(), b.size());
+
+                bslma::TestAllocatorMonitor oam(&oa);
+
+                mX.swap(mY);
+                ASSERTV(i, j, verify(L_, X, b) && ENC_B == X.encoding());
+                ASSERTV(i, j, verify(L_, Y, a) && ENC_A == Y.encoding());
+
+                swap(mX, mY);
+                ASSERTV(i, j, verify(L_, X, a) && ENC_A == X.encoding());
+                ASSERTV(i, j, verify(L_, Y, b) && ENC_B == Y.encoding());
+
+                ASSERTV(i, j, oam.isTotalSame());
+
+                swap(mX, mZ);
+                ASSERTV(i, j, verify(L_, X, b) && ENC_B == X.encoding());
+                ASSERTV(i, j, verify(L_, Z, a) && ENC_A == Z.encoding());
+                ASSERTV(i, j, &oa == X.allocator());
+                ASSERTV(i, j, &za == Z.allocator());
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&oa);
+            Obj mY(&oa);
+            Obj mZ(&za);
+
+            ASSERT_PASS(mX.swap(mY));
+            ASSERT_FAIL(mX.swap(mZ));
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING COPY CONSTRUCTOR
+        //
+        // Concerns:
+        //: 1 The new object has the value and encoding of the original.
+        //:
+        //: 2 The allocator is propagated to the new object, and the default
+        //:   allocator is used if none is supplied.
+        //:
+        //: 3 The original object is not modified.
+        //:
+        //: 4 The constructor is exception-neutral.
+        //
+        // Plan:
+        //: 1 For each of a set of objects created from a table of lengths and
+        //:   encodings, copy-construct an object with and without an
+        //:   allocator, under injected allocation failures, and verify the
+        //:   result.  (C-1..4)
+        //
+        // Testing:
+        //   BlockPackedIntArray(const BPIA& original, bslma::Allocator *ba);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING COPY CONSTRUCTOR" << endl
+                          << "========================" << endl;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("source",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        const bsl::size_t LENGTHS[] = { 0, 1, 255, 256, 257, 1000 };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        for (int i = 0; i < NUM_LENGTHS * NUM_ENCODINGS; ++i) {
+            const Obj::Encoding ENCODING = ENCODINGS[i / NUM_LENGTHS];
+
+            bsl::vector<Int64> values;
+            generate(&values, i % NUM_KINDS, LENGTHS[i % NUM_LENGTHS], i);
+
+            Obj mZ(ENCODING, &sa);  const Obj& Z = mZ;
+            mZ.append(values.data(), values.size());
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                const Obj X(Z, &oa);
+
+                ASSERTV(i, verify(L_, X, values));
+                ASSERTV(i, ENCODING == X.encoding());
+                ASSERTV(i, &oa == X.allocator());
+                ASSERTV(i, Z.storageSize() == X.storageSize());
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            {
+                const Obj X(Z);
+
+                ASSERTV(i, verify(L_, X, values));
+                ASSERTV(i, &da == X.allocator());
+            }
+            ASSERTV(i, verify(L_, Z, values));
+            ASSERTV(i, 0 == oa.numBlocksInUse());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING EQUALITY OPERATORS
+        //
+        // Concerns:
+        //: 1 Two objects compare equal if, and only if, they have the same
+        //:   length and the same value at each index.
+        //:
+        //: 2 The encoding does not affect equality.
+        //:
+        //: 3 'operator!=' is the inverse of 'operator=='.
+        //:
+        //: 4 Comparison is symmetric, and the operators allocate no memory.
+        //
+        // Plan:
+        //: 1 Create objects of each encoding from a table of value sequences,
+        //:   including sequences differing in a single element in an encoded
+        //:   block or among the values not yet encoded, and compare every pair
+        //:   of objects.  (C-1..4)
+        //
+        // Testing:
+        //   bool operator==(const BPIA& lhs, const BPIA& rhs);
+        //   bool operator!=(const BPIA& lhs, const BPIA& rhs);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING EQUALITY OPERATORS" << endl
+                          << "==========================" << endl;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bsl::vector<bsl::vector<Int64> > sequences;
+        {
+            bsl::vector<Int64> base;
+            generate(&base, 2, 3 * BLOCK + 20, 1);
+
+            sequences.push_back(bsl::vector<Int64>());
+            sequences.push_back(bsl::vector<Int64>(1, 0));
+            sequences.push_back(bsl::vector<Int64>(1, 1));
+            sequences.push_back(base);
+            sequences.push_back(bsl::vector<Int64>(base.begin(),
+                                                   base.end() - 1));
+            sequences.push_back(bsl::vector<Int64>(base.begin(),
+                                                   base.end() - 20));
+            sequences.push_back(base);
+            sequences.back()[BLOCK + 3] += 1;
+            sequences.push_back(base);
+            sequences.back()[3 * BLOCK + 5] -= 1;
+            sequences.push_back(base);
+            sequences.back()[0] = MIN_INT64;
+        }
+        const int NUM_SEQUENCES = static_cast<int>(sequences.size());
+
+        for (int i = 0; i < NUM_SEQUENCES; ++i) {
+            for (int ei = 0; ei < NUM_ENCODINGS; ++ei) {
+                Obj mX(ENCODINGS[ei], &oa);  const Obj& X = mX;
+                mX.append(sequences[i].data(), sequences[i].size());
+
+                for (int j = 0; j < NUM_SEQUENCES; ++j) {
+                    for (int ej = 0; ej < NUM_ENCODINGS; ++ej) {
+                        Obj mY(ENCODINGS[ej], &oa);  const Obj& Y = mY;
+                        mY.append(sequences[j].data(), sequences[j].size());
+
+                        const bool EXP = sequences[i] == sequences[j];
+
+                        bslma::TestAllocatorMonitor dam(&da);
+                        bslma::TestAllocatorMonitor oam(&oa);
+
+                        ASSERTV(i, ei, j, ej, EXP == (X == Y));
+                        ASSERTV(i, ei, j, ej, EXP == (Y == X));
+                        ASSERTV(i, ei, j, ej, EXP != (X != Y));
+                        ASSERTV(i, ei, j, ej, EXP != (Y != X));
+
+                        ASSERTV(i, ei, j, ej, dam.isTotalSame());
+                        ASSERTV(i, ei, j, ej, oam.isTotalSame());
+                    }
+                }
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'print' AND 'operator<<'
+        //
+        // Concerns:
+        //: 1 'print' and 'operator<<' write the elements of the array in
+        //:   order, formatted as specified by 'level' and 'spacesPerLevel'.
+        //:
+        //: 2 Both return a reference to the supplied stream, and have no
+        //:   effect on an invalid stream.
+        //
+        // Plan:
+        //: 1 Compare the output of 'print' and 'operator<<', for a table of
+        //:   arrays and formatting parameters, with expected strings.  (C-1)
+        //:
+        //: 2 Verify the returned references, and the output to an invalid
+        //:   stream.  (C-2)
+        //
+        // Testing:
+        //   ostream& print(ostream& stream, int level, int spl) const;
+        //   ostream& operator<<(ostream& stream, const BPIA& array);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'print' AND 'operator<<'" << endl
+                          << "================================" << endl;
+
+        static const struct {
+            int         d_line;
+            int         d_level;
+            int         d_spacesPerLevel;
+            int         d_length;   // values are '-1, 2, -3, ...'
+            const char *d_expected;
+        } DATA[] = {
+            { L_,  0,  4, 0, "[\n]\n"                                       },
+            { L_,  0, -1, 0, "[ ]"                                          },
+            { L_,  0,  4, 3, "[\n    -1\n    2\n    -3\n]\n"                },
+            { L_,  1,  2, 2, "  [\n    -1\n    2\n  ]\n"                    },
+            { L_, -1,  2, 2, "[\n    -1\n    2\n  ]\n"                      },
+            { L_,  0, -1, 3, "[ -1 2 -3 ]"                                  },
+            { L_,  2, -1, 1, "  [ -1 ]"                                     },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE = DATA[ti].d_line;
+
+            for (int ei = 0; ei < NUM_ENCODINGS; ++ei) {
+                Obj mX(ENCODINGS[ei]);  const Obj& X = mX;
+                for (int i = 1; i <= DATA[ti].d_length; ++i) {
+                    mX.append(i % 2 ? -i : i);
+                }
+
+                bsl::ostringstream os;
+                ASSERTV(LINE, &os == &X.print(os,
+                                              DATA[ti].d_level,
+                                              DATA[ti].d_spacesPerLevel));
+                ASSERTV(LINE, ei, os.str(), DATA[ti].d_expected == os.str());
+
+                if (0 == DATA[ti].d_level && -1 == DATA[ti].d_spacesPerLevel) {
+                    bsl::ostringstream os2;
+                    ASSERTV(LINE, &os2 == &(os2 << X));
+                    ASSERTV(LINE, ei, os.str() == os2.str());
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting an encoded block." << endl;
+        {
+            Obj mX(Obj::e_DELTA);  const Obj& X = mX;
+
+            bsl::ostringstream expected;
+            expected << "[";
+            for (int i = 0; i < BLOCK + 2; ++i) {
+                mX.append(i * 3);
+                expected << " " << i * 3;
+            }
+            expected << " ]";
+
+            bsl::ostringstream os;
+            os << X;
+            ASSERTV(os.str(), expected.str() == os.str());
+        }
+
+        if (verbose) cout << "\nTesting an invalid stream." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+            mX.append(5);
+
+            bsl::ostringstream os;
+            os.setstate(bsl::ios::badbit);
+            X.print(os);
+            ASSERT(os.str().empty());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed object is empty and uses the
+        //:   'e_FRAME_OF_REFERENCE' encoding, and the value constructor uses
+        //:   the supplied encoding.
+        //:
+        //: 2 The allocator is propagated to the object, and the default
+        //:   allocator is used if none is supplied.
+        //:
+        //: 3 'append' appends a single element, completing a block on every
+        //:   'k_BLOCK_LENGTH'th call, and provides the strong
+        //:   exception-safety guarantee.
+        //:
+        //: 4 'length', 'isEmpty', and 'operator[]' reflect the elements
+        //:   appended.
+        //:
+        //: 5 'removeAll' removes all elements and keeps the encoding.
+        //:
+        //: 6 All memory is released on destruction.
+        //:
+        //: 7 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create objects using each constructor and verify their initial
+        //:   state and allocators.  (C-1..2)
+        //:
+        //: 2 For each encoding, append values one at a time under injected
+        //:   allocation failures, verifying the object against an oracle
+        //:   after each append.  (C-3..4)
+        //:
+        //: 3 Call 'removeAll' and verify the state of the object.  (C-5)
+        //:
+        //: 4 Verify that the object allocator has no blocks in use after the
+        //:   object is destroyed.  (C-6)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-7)
+        //
+        // Testing:
+        //   BlockPackedIntArray(bslma::Allocator *ba = 0);
+        //   BlockPackedIntArray(Encoding encoding, bslma::Allocator *ba = 0);
+        //   ~BlockPackedIntArray();
+        //   void append(bsl::int64_t value);
+        //   void removeAll();
+        //   bsl::int64_t operator[](bsl::size_t index) const;
+        //   bslma::Allocator *allocator() const;
+        //   Encoding encoding() const;
+        //   bool isEmpty() const;
+        //   bsl::size_t length() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                 << "TESTING PRIMARY MANIPULATORS AND BASIC ACCESSORS" << endl
+                 << "================================================" << endl;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) cout << "\nTesting constructors." << endl;
+        {
+            const Obj W;
+            ASSERT(&da == W.allocator());
+            ASSERT(Obj::e_FRAME_OF_REFERENCE == W.encoding());
+            ASSERT(W.isEmpty());
+            ASSERT(0 == W.length());
+            ASSERT(0 == W.storageSize());
+
+            const Obj X(&oa);
+            ASSERT(&oa == X.allocator());
+            ASSERT(Obj::e_FRAME_OF_REFERENCE == X.encoding());
+
+            for (int ei = 0; ei < NUM_ENCODINGS; ++ei) {
+                const Obj Y(ENCODINGS[ei]);
+                ASSERTV(ei, &da == Y.allocator());
+                ASSERTV(ei, ENCODINGS[ei] == Y.encoding());
+                ASSERTV(ei, Y.isEmpty());
+
+                const Obj Z(ENCODINGS[ei], &oa);
+                ASSERTV(ei, &oa == Z.allocator());
+                ASSERTV(ei, ENCODINGS[ei] == Z.encoding());
+                ASSERTV(ei, 0 == Z.length());
+            }
+            ASSERT(0 == da.numBlocksTotal());
+            ASSERT(0 == oa.numBlocksTotal());
+        }
+
+        if (verbose) cout << "\nTesting 'append'." << endl;
+
+        for (int ei = 0; ei < NUM_ENCODINGS; ++ei) {
+            for (int kind = 0; kind < NUM_KINDS; ++kind) {
+                bsl::vector<Int64> values;
+                generate(&values, kind, 2 * BLOCK + 3, kind);
+
+                {
+                    Obj mX(ENCODINGS[ei], &oa);  const Obj& X = mX;
+
+                    for (bsl::size_t i = 0; i < values.size(); ++i) {
+                        BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                            if (i != X.length()) {
+                                // Verify the strong guarantee, then retry.
+
+                                ASSERTV(ei, kind, i, i == X.length());
+                            }
+                            mX.append(values[i]);
+                        } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                        ASSERTV(ei, kind, i, i + 1 == X.length());
+                        ASSERTV(ei, kind, i, !X.isEmpty());
+                        ASSERTV(ei, kind, i, values[i] == X[i]);
+                        ASSERTV(ei, kind, i, values[0] == X[0]);
+                        ASSERTV(ei, kind, i, values[i / 2] == X[i / 2]);
+                    }
+                    ASSERTV(ei, kind, verify(L_, X, values));
+
+                    mX.removeAll();
+                    ASSERTV(ei, kind, X.isEmpty());
+                    ASSERTV(ei, kind, 0 == X.length());
+                    ASSERTV(ei, kind, ENCODINGS[ei] == X.encoding());
+
+                    mX.append(values.data(), 3);
+                    ASSERTV(ei, kind, 3 == X.length());
+                    ASSERTV(ei, kind, values[2] == X[2]);
+                }
+                ASSERTV(ei, kind, 0 == oa.numBlocksInUse());
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT_FAIL(X[0]);
+            mX.append(1);
+            ASSERT_PASS(X[0]);
+            ASSERT_FAIL(X[1]);
+
+            ASSERT_PASS(Obj(Obj::e_DELTA, &oa));
+            ASSERT_FAIL(Obj(static_cast<Obj::Encoding>(3), &oa));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an object of each encoding, append values, and access
+        //:   them.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        for (int ei = 0; ei < NUM_ENCODINGS; ++ei) {
+            Obj mX(ENCODINGS[ei]);  const Obj& X = mX;
+            ASSERT(X.isEmpty());
+
+            for (int i = 0; i < 1000; ++i) {
+                mX.append(i * i - 500);
+            }
+            ASSERT(1000 == X.length());
+            ASSERT(-500 == X[0]);
+            ASSERT(999 * 999 - 500 == X[999]);
+            ASSERT(300 * 300 - 500 == X[300]);
+
+            Int64 buffer[10];
+            X.decode(buffer, 250, 10);
+            ASSERT(255 * 255 - 500 == buffer[5]);
+
+            Obj mY(X);  const Obj& Y = mY;
+            ASSERT(X == Y);
+
+            mY.append(1);
+            ASSERT(X != Y);
+
+            mY = X;
+            ASSERT(X == Y);
+
+            ASSERT(X.storageSize() < 1000 * sizeof(Int64));
+        }
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'decode' AND 'append'
+        //
+        // Concerns:
+        //: 1 Decoding is fast, and faster with the vector kernel when it is
+        //:   supported.
+        //
+        // Plan:
+        //: 1 For each encoding and each of a set of value patterns, time bulk
+        //:   'append', 'decode', and 'operator[]', with each supported set of
+        //:   features, and report throughput and memory usage.
+        //
+        // Testing:
+        //   PERFORMANCE: 'decode' and 'append'
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: 'decode' AND 'append'" << endl
+             << "==================================" << endl;
+
+        const bsl::size_t LENGTH = argc > 2 ? atoi(argv[2]) : 1 << 22;
+
+        const char *KIND_NAMES[] = { "small", "narrow", "timestamps",
+                                     "decreasing", "random", "extreme",
+                                     "constant" };
+        const char *ENCODING_NAMES[] = { "BIT_PACKED", "FRAME_OF_REFERENCE",
+                                         "DELTA" };
+
+        bsl::vector<Int64> values;
+        bsl::vector<Int64> buffer(LENGTH);
+
+        for (int kind = 1; kind < 4; ++kind) {
+            generate(&values, kind, LENGTH, 1);
+
+            for (int ei = 0; ei < NUM_ENCODINGS; ++ei) {
+                bsls::Stopwatch sw;
+
+                Obj mX(ENCODINGS[ei]);  const Obj& X = mX;
+
+                sw.start();
+                mX.append(values.data(), values.size());
+                sw.stop();
+                const double appendTime = sw.elapsedTime();
+
+                cout << KIND_NAMES[kind] << " " << ENCODING_NAMES[ei]
+                     << ": bits/value = "
+                     << 8.0 * X.storageSize() / LENGTH
+                     << ", append = "
+                     << LENGTH / appendTime / 1e6 << " M/s" << endl;
+
+                for (int features = Impl::supportedFeatures(); 0 <= features;
+                                                                 --features) {
+                    Impl::setEnabledFeatures(features);
+                    if (features != Impl::enabledFeatures()) {
+                        continue;
+                    }
+
+                    sw.reset();
+                    sw.start();
+                    for (int r = 0; r < 10; ++r) {
+                        X.decode(buffer.data(), 0, LENGTH);
+                    }
+                    sw.stop();
+
+                    cout << "\tfeatures = " << features << ", decode = "
+                         << 10.0 * LENGTH / sw.elapsedTime() / 1e6
+                         << " M/s" << endl;
+                }
+                Impl::setEnabledFeatures(Impl::supportedFeatures());
+                ASSERT(bsl::equal(values.begin(), values.end(),
+                                  buffer.begin()));
+
+                Int64 sum = 0;
+                sw.reset();
+                sw.start();
+                for (bsl::size_t i = 0; i < LENGTH; i += 7) {
+                    sum += X[i];
+                }
+                sw.stop();
+
+                cout << "\toperator[] = "
+                     << LENGTH / 7 / sw.elapsedTime() / 1e6 << " M/s"
+                     << " (" << sum % 10 << ")" << endl;
+            }
+        }
+        (void)veryVerbose;
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------------------------------------------------------
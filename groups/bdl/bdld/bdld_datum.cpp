@@ -120,8 +120,21 @@ BSLS_IDENT_RCSID(bdld_datum_cpp,"$Id$ $CSID$")
 //   static data.  A similar mechanism is not implemented for 32-bit platforms
 //   because of negative performance implications.
 //
-// * DatumMapRef::find() does a binary search if the map is sorted.  Otherwise
-//   it does a linear search.
+// * DatumMapRef::find() probes the hash index if the map has one.
+//   Otherwise it does a binary search if the map is sorted, and a linear
+//   search if it is not.
+//
+// * The hash index of a map is stored at the end of the allocation holding
+//   the map (after the keys of a datum-key-owning map), at the offset recorded
+//   in the 'Datum_MapHeader'.  It is an array of a power of two 32-bit slots,
+//   with linear probing.  An empty slot is 0.  The low-order 'd_indexShift'
+//   bits of an occupied slot hold one plus the position of the entry, and the
+//   remaining high-order bits hold the corresponding bits of the upper half of
+//   the 64-bit hash of the key, so that most probes of non-matching slots are
+//   rejected without touching the entries.  The low-order bits of the hash
+//   select the first slot probed.  The number of slots is at least
+//   'capacity + capacity / 3 + 1', so that the index is at most three quarters
+//   full.
 //
 ///R-value and forwarding references
 ///- - - - - - - - - - - - - - - - -
@@ -133,6 +146,7 @@ BSLS_IDENT_RCSID(bdld_datum_cpp,"$Id$ $CSID$")
 // support perfect forwarding using the 'BSLS_COMPILERFEATURES_FORWARD', and
 // 'BSLS_COMPILERFEATURES_FORWARDING_REF' macros.
 
+#include <bdlb_bitutil.h>
 #include <bdlb_print.h>
 #include <bdlb_printmethods.h>
 
@@ -141,6 +155,8 @@ BSLS_IDENT_RCSID(bdld_datum_cpp,"$Id$ $CSID$")
 
 #include <bdlt_currenttime.h>
 
+#include <bslh_defaulthashalgorithm.h>
+
 #include <bslim_printer.h>
 #include <bslma_allocator.h>
 #include <bslma_usesbslmaallocator.h>
@@ -151,7 +167,9 @@ BSLS_IDENT_RCSID(bdld_datum_cpp,"$Id$ $CSID$")
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>
+#include <bsl_climits.h>
 #include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
 #include <bsl_memory.h>
 #include <bsl_ostream.h>
 #include <bsl_sstream.h>
@@ -193,11 +211,33 @@ static const Datum *findElementBinary(const bslstl::StringRef& key,
     // the specified 'map' or 0 otherwise.  Find the key using binary search
     // and return the first match in case of multiple matches.
 
+static const Datum *findElementHashed(const bslstl::StringRef& key,
+                                      const DatumMapRef&       map,
+                                      const Datum_MapHeader&   header);
+    // Return a pointer to a 'Datum' object if the specified 'key' exists in
+    // the specified 'map' having the specified 'header' or 0 otherwise.  Find
+    // the key using the hash index of 'map'.  The behavior is undefined unless
+    // 'map' has a hash index.
+
 static const Datum *findElementLinear(const bslstl::StringRef& key,
                                       const DatumMapRef&       map);
     // Return a pointer to a 'Datum' object if the specified 'key' exists in
     // the specified 'map' or 0 otherwise.  Find the key using linear search.
 
+static bsls::Types::Uint64 hashMapKey(const bslstl::StringRef& key,
+                                      bool                     interned);
+    // Return the hash of the specified 'key' used by the hash index of a map,
+    // computed from the address of 'key' if the specified 'interned' is
+    // 'true', and from its value otherwise.
+
+static unsigned int mapIndexNumSlots(Datum::SizeType capacity);
+    // Return the number of slots of the hash index of a map having the
+    // specified 'capacity'.
+
+static unsigned char mapIndexShift(Datum::SizeType capacity);
+    // Return the number of low-order bits of a slot of the hash index of a map
+    // having the specified 'capacity' that hold the position of an entry.
+
                          // ========================
                          // class Datum_ArrayProctor
                          // ========================
@@ -744,6 +784,9 @@ Datum copyMapOwningKeys(const DatumMapRef&  map,
         Datum::createUninitializedMap(&ref,
                                       map.size(),
                                       totalSizeOfKeys,
+                                      map.hasHashIndex()
+                                      ? Datum::e_MAP_INDEX_HASH
+                                      : Datum::e_MAP_INDEX_NONE,
                                       basicAllocator);
 
         // Track the allocated memory and destroy it if any of the allocations
@@ -818,6 +861,40 @@ const Datum *findElementBinary(const bslstl::StringRef& key,
     return 0;
 }
 
+static
+const Datum *findElementHashed(const bslstl::StringRef& key,
+                               const DatumMapRef&       map,
+                               const Datum_MapHeader&   header)
+{
+    const char         *base  = reinterpret_cast<const char *>(&header);
+    const unsigned int *slots = reinterpret_cast<const unsigned int *>(
+                                                  base + header.d_indexOffset);
+
+    const bool                interned = header.d_internedKeys;
+    const bsls::Types::Uint64 hash     = hashMapKey(key, interned);
+    const unsigned int        tagMask  = ~0u << header.d_indexShift;
+    const unsigned int        tag      = static_cast<unsigned int>(hash >> 32)
+                                       & tagMask;
+
+    for (unsigned int i = static_cast<unsigned int>(hash) & header.d_indexMask;
+         ;
+         i = (i + 1) & header.d_indexMask) {
+        const unsigned int slot = slots[i];
+        if (0 == slot) {
+            return 0;                                                 // RETURN
+        }
+        if ((slot & tagMask) == tag) {
+            const DatumMapEntry&     entry    = map[(slot & ~tagMask) - 1];
+            const bslstl::StringRef& entryKey = entry.key();
+            if (interned ? entryKey.data()   == key.data() &&
+                           entryKey.length() == key.length()
+                         : entryKey == key) {
+                return &entry.value();                                // RETURN
+            }
+        }
+    }
+}
+
 static
 const Datum *findElementLinear(const bslstl::StringRef& key,
                                const DatumMapRef&       map)
@@ -830,6 +907,49 @@ const Datum *findElementLinear(const bslstl::StringRef& key,
     return 0;
 }
 
+static
+bsls::Types::Uint64 hashMapKey(const bslstl::StringRef& key, bool interned)
+{
+    if (interned) {
+        // Mix the address with the finalizer of MurmurHash3, so that the
+        // low-order bits used to select a slot depend on all of its bits.
+
+        bsls::Types::Uint64 hash = reinterpret_cast<bsls::Types::UintPtr>(
+                                                                   key.data());
+        hash ^= hash >> 33;
+        hash *= 0xff51afd7ed558ccdULL;
+        hash ^= hash >> 33;
+        hash *= 0xc4ceb9fe1a85ec53ULL;
+        hash ^= hash >> 33;
+        return hash;                                                  // RETURN
+    }
+
+    bslh::DefaultHashAlgorithm algorithm;
+    algorithm(key.data(), key.length());
+    return algorithm.computeHash();
+}
+
+static
+unsigned int mapIndexNumSlots(Datum::SizeType capacity)
+{
+    const Datum::SizeType minSlots = capacity + capacity / 3 + 1;
+
+    unsigned int numSlots = 2;
+    while (numSlots < minSlots) {
+        numSlots *= 2;
+    }
+    return numSlots;
+}
+
+static
+unsigned char mapIndexShift(Datum::SizeType capacity)
+{
+    const bsl::uint64_t value = capacity;
+    const int           used  = 64 - bdlb::BitUtil::numLeadingUnsetBits(value);
+
+    return static_cast<unsigned char>(used);
+}
+
 }  // close unnamed namespace
 
 BSLMF_ASSERT(bsl::is_trivially_copyable<Datum>::value);
@@ -855,6 +975,40 @@ BSLMF_ASSERT(sizeof(bdlt::Date) <= sizeof(int));
 BSLMF_ASSERT(sizeof(bdlt::Time) <= sizeof(long long));
 BSLMF_ASSERT(sizeof(Datum_MapHeader) <= sizeof(DatumMapEntry));
 
+// PRIVATE CLASS METHODS
+void Datum::buildMapIndex(void *header)
+{
+    BSLS_ASSERT(header);
+
+    Datum_MapHeader     *mapHeader = static_cast<Datum_MapHeader *>(header);
+    const DatumMapEntry *entries   = static_cast<DatumMapEntry *>(header) + 1;
+    char                *base      = static_cast<char *>(header);
+    unsigned int        *slots     = reinterpret_cast<unsigned int *>(
+                                             base + mapHeader->d_indexOffset);
+
+    BSLS_ASSERT(mapHeader->d_indexOffset);
+    BSLS_ASSERT(mapHeader->d_size < (static_cast<SizeType>(1)
+                                                 << mapHeader->d_indexShift));
+
+    const bool         interned = mapHeader->d_internedKeys;
+    const unsigned int mask     = mapHeader->d_indexMask;
+    const unsigned int tagMask  = ~0u << mapHeader->d_indexShift;
+
+    bsl::fill_n(slots, static_cast<SizeType>(mask) + 1, 0u);
+
+    for (SizeType i = 0; i < mapHeader->d_size; ++i) {
+        const bsls::Types::Uint64 hash = hashMapKey(entries[i].key(),
+                                                    interned);
+
+        unsigned int slot = static_cast<unsigned int>(hash) & mask;
+        while (slots[slot]) {
+            slot = (slot + 1) & mask;
+        }
+        slots[slot] = (static_cast<unsigned int>(hash >> 32) & tagMask)
+                    | static_cast<unsigned int>(i + 1);
+    }
+}
+
 // CLASS METHODS
 Datum Datum::createDecimal64(bdldfp::Decimal64  value,
                              bslma::Allocator  *basicAllocator)
@@ -1064,25 +1218,47 @@ void Datum::createUninitializedArray(DatumMutableArrayRef *result,
 void Datum::createUninitializedMap(DatumMutableMapRef *result,
                                    SizeType            capacity,
                                    bslma::Allocator   *basicAllocator)
+{
+    createUninitializedMap(result, capacity, e_MAP_INDEX_NONE, basicAllocator);
+}
+
+void Datum::createUninitializedMap(DatumMutableMapRef *result,
+                                   SizeType            capacity,
+                                   MapIndex            index,
+                                   bslma::Allocator   *basicAllocator)
 {
     BSLS_ASSERT(result);
     BSLS_ASSERT(basicAllocator);
     BSLS_ASSERT(capacity < bsl::numeric_limits<SizeType>::max()/
                                                       sizeof(DatumMapEntry)-1);
+    BSLS_ASSERT(e_MAP_INDEX_NONE == index ||
+                capacity < static_cast<SizeType>(INT_MAX));
     BSLMF_ASSERT(sizeof(DatumMapEntry) >= sizeof(Datum_MapHeader));
 
     // Allocate extra elements to store size of the map and a flag to determine
-    // if the map is sorted or not.
+    // if the map is sorted or not, followed by the hash index, if any.
+
+    const SizeType     entriesSize = sizeof(DatumMapEntry) * (capacity + 1);
+    const unsigned int numSlots    = e_MAP_INDEX_NONE == index
+                                     ? 0
+                                     : mapIndexNumSlots(capacity);
+    const SizeType     indexSize   = sizeof(unsigned int) * numSlots;
 
-    void *mem = basicAllocator->allocate(
-                                       sizeof(DatumMapEntry) * (capacity + 1));
+    BSLS_ASSERT(0 == numSlots || entriesSize + indexSize <= UINT_MAX);
+
+    void *mem = basicAllocator->allocate(entriesSize + indexSize);
 
     // Store map header in the front (1 DatumMapEntry).
     Datum_MapHeader *header = static_cast<Datum_MapHeader *>(mem);
 
-    header->d_size     = 0;
-    header->d_sorted   = false;
-    header->d_ownsKeys = false;
+    header->d_size         = 0;
+    header->d_sorted       = false;
+    header->d_ownsKeys     = false;
+    header->d_internedKeys = e_MAP_INDEX_HASH_INTERNED == index;
+    header->d_indexShift   = mapIndexShift(capacity);
+    header->d_indexMask    = numSlots - 1;
+    header->d_indexOffset  = numSlots ? static_cast<unsigned int>(entriesSize)
+                                      : 0;
 
     *result = DatumMutableMapRef(static_cast<DatumMapEntry *>(mem) + 1,
                                  &header->d_size,
@@ -1120,26 +1296,61 @@ void Datum::createUninitializedMap(
                                   SizeType                      capacity,
                                   SizeType                      keysCapacity,
                                   bslma::Allocator             *basicAllocator)
+{
+    createUninitializedMap(result,
+                           capacity,
+                           keysCapacity,
+                           e_MAP_INDEX_NONE,
+                           basicAllocator);
+}
+
+void Datum::createUninitializedMap(
+                                  DatumMutableMapOwningKeysRef *result,
+                                  SizeType                      capacity,
+                                  SizeType                      keysCapacity,
+                                  MapIndex                      index,
+                                  bslma::Allocator             *basicAllocator)
 {
     BSLS_ASSERT(result);
     BSLS_ASSERT(basicAllocator);
     BSLS_ASSERT(capacity < (bsl::numeric_limits<SizeType>::max()-keysCapacity)/
                                                       sizeof(DatumMapEntry)-1);
+    BSLS_ASSERT(e_MAP_INDEX_HASH_INTERNED != index);
+    BSLS_ASSERT(e_MAP_INDEX_NONE == index ||
+                capacity < static_cast<SizeType>(INT_MAX));
     BSLMF_ASSERT(sizeof(DatumMapEntry) >= sizeof(Datum_MapHeader));
 
     // Allocate one extra element to store size of the map and a flag to
-    // determine if the map is sorted or not.
+    // determine if the map is sorted or not, followed by the keys and the
+    // hash index, if any.
+
+    const SizeType     keysEnd     = sizeof(DatumMapEntry) * (capacity + 1)
+                                   + keysCapacity;
+    const unsigned int numSlots    = e_MAP_INDEX_NONE == index
+                                     ? 0
+                                     : mapIndexNumSlots(capacity);
+    const SizeType     indexOffset = numSlots
+                      ? bsls::AlignmentUtil::roundUpToMaximalAlignment(keysEnd)
+                      : 0;
+    const SizeType     indexSize   = sizeof(unsigned int) * numSlots;
+
+    BSLS_ASSERT(0 == numSlots || indexOffset + indexSize <= UINT_MAX);
+
     SizeType     bufferSize =
         bsls::AlignmentUtil::roundUpToMaximalAlignment(
-                        sizeof(DatumMapEntry) * (capacity + 1) + keysCapacity);
+                                numSlots ? indexOffset + indexSize : keysEnd);
     void * const mem = basicAllocator->allocate(bufferSize);
 
     // Store map header in the front ( 1 DatumMapEntry ).
     Datum_MapHeader *header = static_cast<Datum_MapHeader *>(mem);
 
-    header->d_size     = 0;
-    header->d_sorted   = false;
-    header->d_ownsKeys = true;
+    header->d_size         = 0;
+    header->d_sorted       = false;
+    header->d_ownsKeys     = true;
+    header->d_internedKeys = false;
+    header->d_indexShift   = mapIndexShift(capacity);
+    header->d_indexMask    = numSlots - 1;
+    header->d_indexOffset  = static_cast<unsigned int>(indexOffset);
 
     char *keysMem = static_cast<char *>(mem)
                                     + (sizeof(DatumMapEntry) * (capacity + 1));
@@ -1472,6 +1683,9 @@ const Datum *DatumIntMapRef::find(int key) const
 
 const Datum *DatumMapRef::find(const bslstl::StringRef& key) const
 {
+    if (d_header_p) {
+        return findElementHashed(key, *this, *d_header_p);            // RETURN
+    }
     return d_sorted ? findElementBinary(key, *this) :
                       findElementLinear(key, *this);
 }
@@ -243,6 +243,27 @@ BSLS_IDENT("$Id$ $CSID$")
 // in the map).  If entries with duplicate keys are present, which matching
 // entry will be found is unspecified.
 //
+///Hashed Key Index
+/// - - - - - - - -
+// A map may also carry a hash index of its keys, making 'find' O(1) on
+// average regardless of whether the map is sorted.  Space for the index is
+// reserved by passing 'e_MAP_INDEX_HASH' or 'e_MAP_INDEX_HASH_INTERNED' to
+// 'createUninitializedMap', and the index is built by 'adoptMap' in the same
+// allocation as the map entries (see also the 'setKeyIndex' methods of
+// 'bdld::DatumMapBuilder' and 'bdld::DatumMapOwningKeysBuilder').  The index
+// is an open-addressed table of 32-bit slots, each holding the position of an
+// entry and a few bits of the hash of its key, with at most three slots in
+// four occupied, so that it adds between 5 and 11 bytes per entry.
+//
+// With 'e_MAP_INDEX_HASH', keys are hashed by value using
+// 'bslh::DefaultHashAlgorithm'.  With 'e_MAP_INDEX_HASH_INTERNED', the keys of
+// the map are expected to be *interned* (i.e., equal keys share the same
+// address, as when they are taken from a symbol table), and the index is keyed
+// on the key addresses, so that 'find' neither hashes nor compares key
+// characters; 'find' then matches an entry only if the 'key' supplied to it
+// has the same address and length as the key of the entry.  'clone' copies
+// the keys, so the clone of such a map has an index keyed on the key values.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -1201,6 +1222,12 @@ class Datum {
     friend bsl::ostream& operator<<(bsl::ostream& stream, const Datum& rhs);
 
     // PRIVATE CLASS METHODS
+    static void buildMapIndex(void *header);
+        // Build the key index of the datum map having the specified 'header'
+        // from the entries of the map.  The behavior is undefined unless
+        // 'header' is the 'Datum_MapHeader' of a map created with space for a
+        // key index.
+
     static void destroyMemory(const Datum&      value,
                               bslma::Allocator *basicAllocator);
         // Deallocate any memory that was previously allocated for the
@@ -1248,6 +1275,15 @@ class Datum {
         // capacity of the *keys-capacity* of a datum-key-owning map or the
         // length of a string.
 
+    enum MapIndex {
+        // Enumeration of the kinds of key index that can be stored along with
+        // a datum map (see {Hashed Key Index}).
+
+        e_MAP_INDEX_NONE          = 0,  // no index
+        e_MAP_INDEX_HASH          = 1,  // hash index of the key values
+        e_MAP_INDEX_HASH_INTERNED = 2   // hash index of the key addresses
+    };
+
     // CLASS METHODS
     static Datum createArrayReference(const Datum      *array,
                                       SizeType          length,
@@ -1410,9 +1446,10 @@ class Datum {
         // behavior is undefined unless 'map' was created using
         // 'createUninitializedMap' method.  The behavior is also undefined
         // unless each element in the held map has been assigned a value and
-        // the size of the map has been set accordingly.  Note that the adopted
-        // map is owned and will be freed if 'Datum::destroy' is called on the
-        // returned object.
+        // the size of the map has been set accordingly.  If 'map' was created
+        // with space for a key index, the index is built from the keys of the
+        // map.  Note that the adopted map is owned and will be freed if
+        // 'Datum::destroy' is called on the returned object.
 
     static Datum adoptMap(const DatumMutableMapOwningKeysRef& map);
         // Return, by value, a datum that refers to the specified 'map'.  The
@@ -1421,8 +1458,10 @@ class Datum {
         // undefined unless each element in the held map has been assigned a
         // value and the size of the map has been set accordingly.  The
         // behavior is also undefined unless keys have been copied into the
-        // map.  Note that the adopted map is owned and will be freed if
-        // 'Datum::destroy' is called on the returned object.
+        // map.  If 'map' was created with space for a key index, the index is
+        // built from the keys of the map.  Note that the adopted map is owned
+        // and will be freed if 'Datum::destroy' is called on the returned
+        // object.
 
     static void createUninitializedArray(DatumMutableArrayRef *result,
                                          SizeType              capacity,
@@ -1465,6 +1504,18 @@ class Datum {
         // 'capacity'.  Also note that any elements in the datum map that need
         // dynamic memory, should also be allocated with 'basicAllocator'.
 
+    static void createUninitializedMap(DatumMutableMapRef *result,
+                                       SizeType            capacity,
+                                       MapIndex            index,
+                                       bslma::Allocator   *basicAllocator);
+        // Load the specified 'result' with a reference to a newly created
+        // datum map having the specified 'capacity' and reserving space for a
+        // key index of the specified 'index' kind, using the specified
+        // 'basicAllocator' to supply memory.  The key index is built by
+        // 'adoptMap'.  The behavior is undefined unless 'capacity < INT_MAX'
+        // if 'e_MAP_INDEX_NONE != index'.  Note that the requirements on the
+        // caller are the same as for the overload without 'index'.
+
     static void createUninitializedMap(
                                  DatumMutableMapOwningKeysRef *result,
                                  SizeType                      capacity,
@@ -1483,6 +1534,21 @@ class Datum {
         // in the datum-key-owning map that need dynamic memory, should also be
         // allocated with 'basicAllocator'.
 
+    static void createUninitializedMap(
+                                 DatumMutableMapOwningKeysRef *result,
+                                 SizeType                      capacity,
+                                 SizeType                      keysCapacity,
+                                 MapIndex                      index,
+                                 bslma::Allocator             *basicAllocator);
+        // Load the specified 'result' with a reference to a newly created
+        // datum-key-owning map having the specified 'capacity' and
+        // 'keysCapacity', and reserving space for a key index of the specified
+        // 'index' kind, using the specified 'basicAllocator' to supply memory.
+        // The key index is built by 'adoptMap'.  The behavior is undefined
+        // unless 'e_MAP_INDEX_HASH_INTERNED != index', and 'capacity <
+        // INT_MAX' if 'e_MAP_INDEX_NONE != index'.  Note that the requirements
+        // on the caller are the same as for the overload without 'index'.
+
     static char *createUninitializedString(Datum            *result,
                                            SizeType          length,
                                            bslma::Allocator *basicAllocator);
@@ -1968,9 +2034,16 @@ struct Datum_MapHeader {
     // stored in front of the Datum maps.
 
     // DATA
-    Datum::SizeType d_size;      // size of the map
-    bool            d_sorted;    // sorted flag
-    bool            d_ownsKeys;  // owns keys flag
+    Datum::SizeType d_size;          // size of the map
+    bool            d_sorted;        // sorted flag
+    bool            d_ownsKeys;      // owns keys flag
+    bool            d_internedKeys;  // hash index is keyed on key addresses
+    unsigned char   d_indexShift;    // number of low-order bits of a hash
+                                     // index slot holding an entry position
+    unsigned int    d_indexMask;     // number of hash index slots minus one
+    unsigned int    d_indexOffset;   // offset in bytes of the hash index from
+                                     // the start of this header, or 0 if the
+                                     // map has no hash index
 };
 
                           // ========================
@@ -2576,6 +2649,13 @@ class DatumMapRef {
     bool                 d_ownsKeys; // flag indicating whether the map owns
                                      // the keys or not
 
+    const Datum_MapHeader
+                        *d_header_p; // header of the map if it has a key
+                                     // index, and 0 otherwise
+
+    // FRIENDS
+    friend class Datum;
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(DatumMapRef, bsl::is_trivially_copyable);
@@ -2587,9 +2667,10 @@ class DatumMapRef {
                 bool                 sorted,
                 bool                 ownsKeys);
         // Create a 'DatumMapRef' object having the specified 'data' of the
-        // specified 'size' and the specified 'sorted' and 'ownsKeys' flags.
-        // The behavior is undefined unless '0 != data' or '0 == size'.  Note
-        // that the pointer to the array is just copied.
+        // specified 'size' and the specified 'sorted' and 'ownsKeys' flags,
+        // and having no key index.  The behavior is undefined unless
+        // '0 != data' or '0 == size'.  Note that the pointer to the array is
+        // just copied.
 
     //!~DatumMapRef() = default;
 
@@ -2601,6 +2682,15 @@ class DatumMapRef {
     const DatumMapEntry *data() const;
         // Return pointer to the first element in the map.
 
+    bool hasHashIndex() const;
+        // Return 'true' if the underlying map has a hash index of its keys,
+        // and 'false' otherwise.
+
+    bool hasInternedKeys() const;
+        // Return 'true' if the hash index of the underlying map is keyed on
+        // the addresses of the keys (see {Hashed Key Index}), and 'false'
+        // otherwise.
+
     bool isSorted() const;
         // Return 'true' if underlying map is sorted and 'false' otherwise.
 
@@ -2613,11 +2703,13 @@ class DatumMapRef {
 
     const Datum *find(const bslstl::StringRef& key) const;
         // Return a const pointer to the datum having the specified 'key', if
-        // it exists and 0 otherwise.  Note that the 'find' has order of 'O(n)'
-        // if the data is not sorted based on the keys.  If the data is sorted,
-        // it has order of 'O(log(n))'.  Also note that if multiple entries
-        // with matching keys are present, which matching record is found is
-        // unspecified.
+        // it exists and 0 otherwise.  If 'hasInternedKeys()', an entry matches
+        // only if its key has the address and length of 'key'.  Note that the
+        // 'find' has expected order of 'O(1)' if the map has a hash index.
+        // Otherwise, it has order of 'O(n)' if the data is not sorted based on
+        // the keys, and 'O(log(n))' if the data is sorted.  Also note that if
+        // multiple entries with matching keys are present, which matching
+        // record is found is unspecified.
 
     bsl::ostream& print(bsl::ostream& stream,
                         int           level          = 0,
@@ -3440,6 +3532,11 @@ Datum Datum::adoptMap(const DatumMutableMapRef& map)
     // for the map, which precedes the 'map' data in a contiguously allocated
     // block (see 'DatumMutableMapRef').
 
+    if (map.size() &&
+        reinterpret_cast<Datum_MapHeader *>(map.size())->d_indexOffset) {
+        buildMapIndex(map.size());
+    }
+
 #ifdef BSLS_PLATFORM_CPU_32_BIT
     return createExtendedDataObject(e_EXTENDED_INTERNAL_MAP, map.size());
 #else   // BSLS_PLATFORM_CPU_32_BIT
@@ -3468,6 +3565,11 @@ Datum Datum::adoptMap(const DatumMutableMapOwningKeysRef& map)
     // for the map, which precedes the 'map' data in a contiguously allocated
     // block (see 'DatumMutableMapOwningKeysRefRef').
 
+    if (map.size() &&
+        reinterpret_cast<Datum_MapHeader *>(map.size())->d_indexOffset) {
+        buildMapIndex(map.size());
+    }
+
 #ifdef BSLS_PLATFORM_CPU_32_BIT
     return createExtendedDataObject(e_EXTENDED_INTERNAL_OWNED_MAP,
                                     map.size());
@@ -3881,10 +3983,14 @@ DatumMapRef Datum::theMap() const
         const Datum_MapHeader *header =
                                 reinterpret_cast<const Datum_MapHeader *>(map);
 
-        return DatumMapRef(map + 1,
+        DatumMapRef result(map + 1,
                            header->d_size,
                            header->d_sorted,
-                           header->d_ownsKeys);                       // RETURN
+                           header->d_ownsKeys);
+        if (header->d_indexOffset) {
+            result.d_header_p = header;
+        }
+        return result;                                                // RETURN
     }
     return DatumMapRef(0, 0, false, false);
 }
@@ -4431,6 +4537,7 @@ DatumMapRef::DatumMapRef(const DatumMapEntry *data,
 , d_size(size)
 , d_sorted(sorted)
 , d_ownsKeys(ownsKeys)
+, d_header_p(0)
 {
     BSLS_ASSERT((size && data) || !size);
     if (0 == size) {
@@ -4452,6 +4559,18 @@ const DatumMapEntry *DatumMapRef::data() const
     return d_data_p;
 }
 
+inline
+bool DatumMapRef::hasHashIndex() const
+{
+    return 0 != d_header_p;
+}
+
+inline
+bool DatumMapRef::hasInternedKeys() const
+{
+    return d_header_p && d_header_p->d_internedKeys;
+}
+
 inline
 bool DatumMapRef::isSorted() const
 {
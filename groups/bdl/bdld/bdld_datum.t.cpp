@@ -367,13 +367,22 @@ using bdldfp::Decimal64;
 // [14] bool operator==(const DatumMapRef& lhs, const DatumMapRef& rhs);
 // [14] bool operator!=(const DatumMapRef& lhs, const DatumMapRef& rhs);
 // [14] bsl::ostream& operator<<(bsl::ostream&, const DatumMapRef&);
+//
+//                          // ----------------
+//                          // Hashed Key Index
+//                          // ----------------
+// [34] void createUninitializedMap(MutMapRef*, Sz, MapIndex, Alloc*);
+// [34] void createUninitializedMap(MutOwnMapRef*, Sz, Sz, MapIndex, A*);
+// [34] bool DatumMapRef::hasHashIndex() const;
+// [34] bool DatumMapRef::hasInternedKeys() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [33] USAGE EXAMPLE
+// [35] USAGE EXAMPLE
 // [24] Datum_ArrayProctor
 // [32] MISALIGNED MEMORY ACCESS TEST (only on SUN machines)
 // [31] COMPRESSIBILITY OF DECIMAL64
 // [30] TYPE TRAITS
+// [-1] PERFORMANCE OF 'find'
 // [-2] EFFICIENCY TEST
 // ----------------------------------------------------------------------------
 
@@ -467,6 +476,13 @@ const char* UNKNOWN_FORMAT = "(* UNKNOWN *)";
 //=============================================================================
 //                   GLOBAL HELPER FUNCTIONS FOR TESTING
 //-----------------------------------------------------------------------------
+bool lessKey(const DatumMapEntry& lhs, const DatumMapEntry& rhs)
+    // Return 'true' if the key of the specified 'lhs' is less than the key of
+    // the specified 'rhs', and 'false' otherwise.
+{
+    return lhs.key() < rhs.key();
+}
+
 void populateWithNonAggregateValues(vector<Datum>    *elements,
                                     bslma::Allocator *allocator,
                                     bool              withNaNs = true)
@@ -1613,7 +1629,7 @@ int main(int argc, char *argv[])
     srand(static_cast<unsigned int>(time(static_cast<time_t *>(0))));
 
     switch (test) { case 0:
-      case 34: {
+      case 35: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -1904,6 +1920,265 @@ int main(int argc, char *argv[])
 //..
 // Note, that the bytes have been copied.
       } break;
+      case 34: {
+        // --------------------------------------------------------------------
+        // TESTING HASHED KEY INDEX
+        //
+        // Concerns:
+        //: 1 A map created with space for a key index has a hash index once
+        //:   adopted, and 'find' locates every key of the map and no other
+        //:   key, whether or not the map is sorted.
+        //:
+        //: 2 A map having an index keyed on interned keys finds a key only if
+        //:   it is supplied with the address of the key stored in the map.
+        //:
+        //: 3 A map created without space for a key index has no hash index,
+        //:   and its allocation is unchanged.
+        //:
+        //: 4 'clone' copies the hash index of a map, keyed on the key values.
+        //:
+        //: 5 If several entries have the same key, 'find' returns one of them.
+        //:
+        //: 6 'destroy' releases the memory held by the index.
+        //:
+        //: 7 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For maps of a series of sizes, with and without owned keys, and
+        //:   for each kind of key index, create a map, look up each key
+        //:   through a pointer to the key stored in the map, and through a
+        //:   copy of the key, and look up absent keys.  Clone and destroy the
+        //:   map and verify that no memory is outstanding.  (C-1..4, 6)
+        //:
+        //: 2 Create a map having duplicate keys and verify that 'find' returns
+        //:   one of the matching entries.  (C-5)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-7)
+        //
+        // Testing:
+        //   void createUninitializedMap(MutMapRef*, Sz, MapIndex, Alloc*);
+        //   void createUninitializedMap(MutOwnMapRef*, Sz, Sz, MapIndex, A*);
+        //   bool DatumMapRef::hasHashIndex() const;
+        //   bool DatumMapRef::hasInternedKeys() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING HASHED KEY INDEX" << endl
+                          << "========================" << endl;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard guard(&da);
+
+        const SizeType SIZES[] = { 0, 1, 2, 3, 4, 7, 8, 100, 1000, 4097 };
+        const int      NUM_SIZES = static_cast<int>(sizeof SIZES /
+                                                    sizeof *SIZES);
+
+        const Datum::MapIndex INDEXES[] = { Datum::e_MAP_INDEX_NONE,
+                                            Datum::e_MAP_INDEX_HASH,
+                                            Datum::e_MAP_INDEX_HASH_INTERNED };
+
+        if (verbose) cout << "\nTesting lookup in indexed maps." << endl;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const SizeType SIZE = SIZES[ti];
+
+            vector<string> keys;
+            vector<string> copies;
+            vector<string> absent;
+            for (SizeType i = 0; i < SIZE; ++i) {
+                ostringstream key;
+                key << "key" << i * 7919 % 10007;
+                keys.push_back(key.str());
+                copies.push_back(key.str());
+                absent.push_back(key.str() + "x");
+            }
+            absent.push_back("");
+            absent.push_back("k");
+
+            bslma::TestAllocatorMonitor dam(&da);
+
+            for (int ii = 0; ii < 3; ++ii) {
+            for (int owning = 0; owning < 2; ++owning) {
+            for (int sorted = 0; sorted < 2; ++sorted) {
+                const Datum::MapIndex INDEX = INDEXES[ii];
+
+                if (owning && Datum::e_MAP_INDEX_HASH_INTERNED == INDEX) {
+                    continue;                                       // CONTINUE
+                }
+
+                if (veryVerbose) { T_ P_(SIZE) P_(INDEX) P_(owning) P(sorted) }
+
+                Datum mD;
+
+                if (owning) {
+                    SizeType keysSize = 0;
+                    for (SizeType i = 0; i < SIZE; ++i) {
+                        keysSize += keys[i].length();
+                    }
+
+                    DatumMutableMapOwningKeysRef map;
+                    Datum::createUninitializedMap(&map,
+                                                  SIZE,
+                                                  keysSize,
+                                                  INDEX,
+                                                  &oa);
+                    char *next = map.keys();
+                    for (SizeType i = 0; i < SIZE; ++i) {
+                        bsl::memcpy(next, keys[i].data(), keys[i].length());
+                        map.data()[i] = DatumMapEntry(
+                                          StringRef(next, keys[i].length()),
+                                          Datum::createInteger(int(i)));
+                        next += keys[i].length();
+                    }
+                    *map.size() = SIZE;
+                    if (sorted) {
+                        bsl::sort(map.data(), map.data() + SIZE, lessKey);
+                        *map.sorted() = true;
+                    }
+                    mD = Datum::adoptMap(map);
+                }
+                else {
+                    DatumMutableMapRef map;
+                    Datum::createUninitializedMap(&map, SIZE, INDEX, &oa);
+
+                    if (Datum::e_MAP_INDEX_NONE == INDEX) {
+                        ASSERTV(SIZE, oa.lastAllocatedNumBytes(),
+                                sizeof(DatumMapEntry) * (SIZE + 1) ==
+                                   static_cast<SizeType>(
+                                                 oa.lastAllocatedNumBytes()));
+                    }
+
+                    for (SizeType i = 0; i < SIZE; ++i) {
+                        map.data()[i] = DatumMapEntry(
+                                                 keys[i],
+                                                 Datum::createInteger(int(i)));
+                    }
+                    *map.size() = SIZE;
+                    if (sorted) {
+                        bsl::sort(map.data(), map.data() + SIZE, lessKey);
+                        *map.sorted() = true;
+                    }
+                    mD = Datum::adoptMap(map);
+                }
+                const Datum& D = mD;
+
+                DatumMapRef map = D.theMap();
+
+                ASSERTV(SIZE, INDEX, SIZE == map.size());
+                ASSERTV(SIZE, INDEX, !SIZE || bool(sorted) == map.isSorted());
+                ASSERTV(SIZE, INDEX, !SIZE ||
+                        (Datum::e_MAP_INDEX_NONE != INDEX) ==
+                                                         map.hasHashIndex());
+                ASSERTV(SIZE, INDEX, !SIZE ||
+                        (Datum::e_MAP_INDEX_HASH_INTERNED == INDEX) ==
+                                                      map.hasInternedKeys());
+
+                for (SizeType i = 0; i < SIZE; ++i) {
+                    const Datum *result = map.find(map[i].key());
+                    ASSERTV(SIZE, INDEX, i, result == &map[i].value());
+
+                    result = map.find(copies[i]);
+                    if (Datum::e_MAP_INDEX_HASH_INTERNED == INDEX) {
+                        ASSERTV(SIZE, INDEX, i, 0 == result);
+                    }
+                    else {
+                        ASSERTV(SIZE, INDEX, i, result);
+                        ASSERTV(SIZE, INDEX, i, result &&
+                                      copies[i] ==
+                                          keys[result->theInteger()]);
+                    }
+                }
+                for (SizeType i = 0; i < absent.size(); ++i) {
+                    ASSERTV(SIZE, INDEX, i, 0 == map.find(absent[i]));
+                }
+
+                Datum mC = D.clone(&oa);  const Datum& C = mC;
+
+                DatumMapRef copy = C.theMap();
+                ASSERTV(SIZE, INDEX, map == copy);
+                ASSERTV(SIZE, INDEX, !copy.hasInternedKeys());
+                ASSERTV(SIZE, INDEX, !SIZE ||
+                        (Datum::e_MAP_INDEX_NONE != INDEX) ==
+                                                        copy.hasHashIndex());
+                for (SizeType i = 0; i < SIZE; ++i) {
+                    const Datum *result = copy.find(copies[i]);
+                    ASSERTV(SIZE, INDEX, i, result);
+                    ASSERTV(SIZE, INDEX, i, result &&
+                                      copies[i] ==
+                                          keys[result->theInteger()]);
+                }
+                for (SizeType i = 0; i < absent.size(); ++i) {
+                    ASSERTV(SIZE, INDEX, i, 0 == copy.find(absent[i]));
+                }
+
+                Datum::destroy(mC, &oa);
+                Datum::destroy(mD, &oa);
+                ASSERTV(SIZE, INDEX, 0 == oa.numBlocksInUse());
+            }
+            }
+            }
+
+            ASSERTV(SIZE, dam.isTotalSame());
+        }
+
+        if (verbose) cout << "\nTesting duplicate keys." << endl;
+        {
+            const char *KEYS[] = { "a", "b", "a", "c", "b", "a" };
+            const int   NUM_KEYS = static_cast<int>(sizeof KEYS /
+                                                    sizeof *KEYS);
+
+            DatumMutableMapRef map;
+            Datum::createUninitializedMap(&map,
+                                          NUM_KEYS,
+                                          Datum::e_MAP_INDEX_HASH,
+                                          &oa);
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                map.data()[i] = DatumMapEntry(KEYS[i],
+                                              Datum::createInteger(i));
+            }
+            *map.size() = NUM_KEYS;
+
+            Datum mD = Datum::adoptMap(map);  const Datum& D = mD;
+
+            const char *EXP[] = { "a", "b", "c" };
+            for (int i = 0; i < 3; ++i) {
+                const Datum *result = D.theMap().find(EXP[i]);
+                ASSERTV(i, result);
+                ASSERTV(i, result &&
+                           StringRef(EXP[i]) ==
+                                        KEYS[result->theInteger()]);
+            }
+            ASSERT(0 == D.theMap().find("d"));
+
+            Datum::destroy(mD, &oa);
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            DatumMutableMapOwningKeysRef map;
+
+            ASSERT_PASS(Datum::createUninitializedMap(
+                                                     &map,
+                                                     1,
+                                                     1,
+                                                     Datum::e_MAP_INDEX_HASH,
+                                                     &oa));
+            Datum::disposeUninitializedMap(map, &oa);
+
+            ASSERT_FAIL(Datum::createUninitializedMap(
+                                            &map,
+                                            1,
+                                            1,
+                                            Datum::e_MAP_INDEX_HASH_INTERNED,
+                                            &oa));
+        }
+      } break;
       case 33: {
         // --------------------------------------------------------------------
         // DATETIME ALLOCATION TESTS
@@ -11337,6 +11612,92 @@ int main(int argc, char *argv[])
             ASSERT(0 == ta.status());
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE OF 'find'
+        //
+        // Concerns:
+        //: 1 A hash index speeds up 'DatumMapRef::find' on large maps, and
+        //:   an index keyed on interned keys speeds it up further.
+        //
+        // Plan:
+        //: 1 For maps of several sizes, time looking up every key of the map
+        //:   in an unsorted map, a sorted map, a map having a hash index, and
+        //:   a map having an index keyed on interned keys.
+        //
+        // Testing:
+        //   PERFORMANCE OF 'find'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE OF 'find'" << endl
+                          << "=====================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const SizeType SIZES[] = { 8, 64, 1024, 16384 };
+
+        const char *LABELS[] = { "linear", "binary", "hashed", "interned" };
+
+        for (int ti = 0; ti < 4; ++ti) {
+            const SizeType SIZE = SIZES[ti];
+            const int      REPS = static_cast<int>(4 * 1024 * 1024 / SIZE);
+
+            vector<string> keys;
+            for (SizeType i = 0; i < SIZE; ++i) {
+                ostringstream key;
+                key << "configuration.section" << i * 7919 % 10007 << ".key";
+                keys.push_back(key.str());
+            }
+
+            cout << "SIZE = " << SIZE << ":";
+
+            for (int mode = 0; mode < 4; ++mode) {
+                const Datum::MapIndex INDEXES[] = {
+                                             Datum::e_MAP_INDEX_NONE,
+                                             Datum::e_MAP_INDEX_NONE,
+                                             Datum::e_MAP_INDEX_HASH,
+                                             Datum::e_MAP_INDEX_HASH_INTERNED
+                                          };
+                const Datum::MapIndex INDEX = INDEXES[mode];
+
+                DatumMutableMapRef map;
+                Datum::createUninitializedMap(&map, SIZE, INDEX, &oa);
+                for (SizeType i = 0; i < SIZE; ++i) {
+                    map.data()[i] = DatumMapEntry(keys[i],
+                                                  Datum::createInteger(1));
+                }
+                *map.size() = SIZE;
+                if (1 == mode) {
+                    bsl::sort(map.data(), map.data() + SIZE, lessKey);
+                    *map.sorted() = true;
+                }
+                Datum mD = Datum::adoptMap(map);
+
+                const DatumMapRef X   = mD.theMap();
+                int               sum = 0;
+                const int         reps = 0 == mode ? REPS / 64 + 1 : REPS;
+
+                bsls::Stopwatch timer;
+                timer.start();
+                for (int r = 0; r < reps; ++r) {
+                    for (SizeType i = 0; i < SIZE; ++i) {
+                        sum += X.find(keys[i])->theInteger();
+                    }
+                }
+                timer.stop();
+
+                ASSERT(sum == static_cast<int>(SIZE) * reps);
+
+                cout << " " << LABELS[mode] << " "
+                     << timer.elapsedTime() * 1e9 / (double(SIZE) * reps)
+                     << "ns";
+
+                Datum::destroy(mD, &oa);
+            }
+            cout << endl;
+        }
+      } break;
       default: {
         // --------------------------------------------------------------------
         // TESTING EFFICIENCY
@@ -48,16 +48,45 @@ static DatumMapBuilder::SizeType getNewCapacity(
 
 static void createMapStorage(DatumMutableMapRef        *mapping,
                              DatumMapBuilder::SizeType  capacity,
+                             Datum::MapIndex            keyIndex,
                              const allocator_type&      allocator)
     // Load the specified 'mapping' with a reference to newly created datum map
-    // having the specified 'capacity', using the specified 'allocator'.
+    // having the specified 'capacity' and space for a key index of the
+    // specified 'keyIndex' kind, using the specified 'allocator'.
 {
-    Datum::createUninitializedMap(mapping, capacity, allocator.mechanism());
+    Datum::createUninitializedMap(mapping,
+                                  capacity,
+                                  keyIndex,
+                                  allocator.mechanism());
     // Initialize the memory.
 
     bsl::uninitialized_fill_n(mapping->data(), capacity, DatumMapEntry());
 }
 
+static void moveMapStorage(DatumMutableMapRef        *mapping,
+                           DatumMapBuilder::SizeType  capacity,
+                           Datum::MapIndex            keyIndex,
+                           const allocator_type&      allocator)
+    // Replace the datum map referred to by the specified 'mapping' with a
+    // newly created datum map having the specified 'capacity' and space for a
+    // key index of the specified 'keyIndex' kind, holding the same entries
+    // and having the same sorted flag, using the specified 'allocator', and
+    // dispose of the original map.
+{
+    DatumMutableMapRef newMapping;
+    createMapStorage(&newMapping, capacity, keyIndex, allocator);
+
+    // Copy the existing data and dispose the old map.
+
+    *newMapping.size()   = *mapping->size();
+    *newMapping.sorted() = *mapping->sorted();
+    bsl::memcpy((void *)newMapping.data(),
+                mapping->data(),
+                sizeof(DatumMapEntry) * (*mapping->size()));
+    Datum::disposeUninitializedMap(*mapping, allocator.mechanism());
+    *mapping = newMapping;
+}
+
 #ifdef BSLS_ASSERT_SAFE_IS_USED
 static bool compareGreater(const DatumMapEntry& lhs, const DatumMapEntry& rhs)
     // Return 'true' if key in the specified 'lhs' is greater than key in the
@@ -86,6 +115,7 @@ BSLMF_ASSERT(bslma::UsesBslmaAllocator<DatumMapBuilder>::value);
 DatumMapBuilder::DatumMapBuilder()
 : d_capacity(0)
 , d_sorted(false)
+, d_keyIndex(Datum::e_MAP_INDEX_NONE)
 , d_allocator()
 {
 }
@@ -93,6 +123,7 @@ DatumMapBuilder::DatumMapBuilder()
 DatumMapBuilder::DatumMapBuilder(const allocator_type& allocator)
 : d_capacity(0)
 , d_sorted(false)
+, d_keyIndex(Datum::e_MAP_INDEX_NONE)
 , d_allocator(allocator)
 {
 }
@@ -101,13 +132,14 @@ DatumMapBuilder::DatumMapBuilder(SizeType              initialCapacity,
                                  const allocator_type& allocator)
 : d_capacity(initialCapacity)
 , d_sorted(false)
+, d_keyIndex(Datum::e_MAP_INDEX_NONE)
 , d_allocator(allocator)
 {
     // Do not create a datum map, if 'initialCapacity' is 0.  Defer this to the
     // first call to 'pushBack' or 'append'.
 
     if (initialCapacity) {
-        createMapStorage(&d_mapping, d_capacity, d_allocator);
+        createMapStorage(&d_mapping, d_capacity, d_keyIndex, d_allocator);
     }
 }
 
@@ -138,27 +170,14 @@ void DatumMapBuilder::append(const DatumMapEntry *entries, SizeType size)
 
     if (!d_capacity) {
         d_capacity = newCapacity;
-        createMapStorage(&d_mapping, d_capacity, d_allocator);
+        createMapStorage(&d_mapping, d_capacity, d_keyIndex, d_allocator);
         *d_mapping.sorted() = d_sorted;
     }
     if (newCapacity != d_capacity) {
         // Capacity has to be increased.
 
         d_capacity = newCapacity;
-
-        // Create a new map with the higher capacity.
-
-        DatumMutableMapRef mapping;
-        createMapStorage(&mapping, d_capacity, d_allocator);
-
-        // Copy the existing data and dispose the old map.
-
-        *mapping.size() = *d_mapping.size();
-        bsl::memcpy((void *)mapping.data(),
-                    d_mapping.data(),
-                    sizeof(DatumMapEntry) * (*d_mapping.size()));
-        Datum::disposeUninitializedMap(d_mapping, d_allocator.mechanism());
-        d_mapping = mapping;
+        moveMapStorage(&d_mapping, d_capacity, d_keyIndex, d_allocator);
     }
 
     // Copy the new elements.
@@ -202,6 +221,20 @@ void DatumMapBuilder::setSorted(bool value)
     }
 }
 
+void DatumMapBuilder::setKeyIndex(Datum::MapIndex value)
+{
+    if (value == d_keyIndex) {
+        return;                                                       // RETURN
+    }
+
+    // Reserve space for the new kind of index in the map built so far.
+
+    if (d_mapping.data()) {
+        moveMapStorage(&d_mapping, d_capacity, value, d_allocator);
+    }
+    d_keyIndex = value;
+}
+
 Datum DatumMapBuilder::sortAndCommit()
 {
     if (d_mapping.data()) {
@@ -26,6 +26,15 @@ BSLS_IDENT("$Id$ $CSID$")
 // order and tag the map as sorted.  The behaviour is undefined if unsorted map
 // is tagged sorted.
 //
+// A map having many keys that is searched repeatedly can be given a hash index
+// of its keys by calling 'setKeyIndex' with 'Datum::e_MAP_INDEX_HASH' before
+// 'commit' or 'sortAndCommit'.  The index is stored in the same allocation as
+// the map, and makes 'DatumMapRef::find' O(1) on average.  If the keys come
+// from a table of interned strings (in which equal keys share the same
+// address), 'Datum::e_MAP_INDEX_HASH_INTERNED' keys the index on the key
+// addresses, so that 'find' neither hashes nor compares key characters (see
+// {'bdld_datum'|Hashed Key Index}).
+//
 // The only difference between this component and
 // 'bdld_datummapowningkeysbuilder' is that this component does not make a copy
 // of the map entries keys and the resulting 'Datum' object does not own memory
@@ -137,6 +146,7 @@ class DatumMapBuilder {
     DatumMutableMapRef d_mapping;    // mutable access to the datum map
     SizeType           d_capacity;   // capacity of the datum map
     bool               d_sorted;     // underlying map is sorted or not
+    Datum::MapIndex    d_keyIndex;   // kind of key index of the datum map
     allocator_type     d_allocator;  // allocator for memory
 
   private:
@@ -206,6 +216,15 @@ class DatumMapBuilder {
         // Note also that the map being constructed is marked unsorted by
         // default.
 
+    void setKeyIndex(Datum::MapIndex value);
+        // Build a key index of the specified 'value' kind for the 'Datum' map
+        // being built by this object when it is committed.  The behavior is
+        // undefined if 'commit' or 'sortAndCommit' has already been called on
+        // this object.  The behavior is also undefined if 'value' is
+        // 'Datum::e_MAP_INDEX_HASH_INTERNED' and the keys of the map are not
+        // interned.  Note that the map being constructed has no key index by
+        // default.
+
     Datum sortAndCommit();
         // Return a 'Datum' map value holding the elements supplied to
         // 'pushBack' or 'append' sorted by their keys.  The caller is
@@ -229,6 +248,10 @@ class DatumMapBuilder {
         // that if no allocator was supplied at construction the default
         // allocator in effect at construction is used.
 
+    Datum::MapIndex keyIndex() const;
+        // Return the kind of key index that will be built for the 'Datum' map
+        // being built by this object.
+
     SizeType size() const;
         // Return the size of the held 'Datum' map.  The behavior is undefined
         // if 'commit' or 'sortAndCommit' has already been called on this
@@ -256,6 +279,12 @@ DatumMapBuilder::allocator_type DatumMapBuilder::get_allocator() const
     return d_allocator;
 }
 
+inline
+Datum::MapIndex DatumMapBuilder::keyIndex() const
+{
+    return d_keyIndex;
+}
+
 inline
 DatumMapBuilder::SizeType DatumMapBuilder::size() const
 {
@@ -42,17 +42,19 @@ using namespace bslstl;
 // [ 2] Datum commit();
 // [ 5] void setSorted(bool);
 // [ 6] Datum sortAndCommit();
+// [ 8] void setKeyIndex(Datum::MapIndex);
 //
 // ACCESSORS
 // [ 3] SizeType capacity() const;
 // [ 3] allocator_type get_allocator() const;
 // [ 3] SizeType size() const;
+// [ 8] Datum::MapIndex keyIndex() const;
 //
 // TRAITS
 // [ 7] bslma::UsesBslmaAllocator
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 8] USAGE EXAMPLE
+// [ 9] USAGE EXAMPLE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -162,7 +164,7 @@ int main(int argc, char *argv[])
     bslma::TestAllocatorMonitor gam(&globalAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 8: {
+      case 9: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -253,6 +255,105 @@ int main(int argc, char *argv[])
     ASSERT(0 == ta.numBytesInUse());
 //..
       } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // TESTING 'setKeyIndex'
+        //
+        // Concerns:
+        //: 1 By default the builder creates maps without a key index.
+        //:
+        //: 2 'setKeyIndex' may be called before or after elements are added,
+        //:   and the elements (and the sorted flag) are preserved.
+        //:
+        //: 3 The committed map has the requested index, and 'find' locates
+        //:   every key, including after the storage has grown.
+        //:
+        //: 4 No memory is leaked.
+        //
+        // Plan:
+        //: 1 For each kind of index, and for each of a set of points at which
+        //:   'setKeyIndex' is called, push 'values' into a builder with a
+        //:   small initial capacity, commit (optionally sorting), and verify
+        //:   the index accessors of the map and the result of 'find' for
+        //:   each key.  (C-1..3)
+        //:
+        //: 2 Verify that all memory is released.  (C-4)
+        //
+        // Testing:
+        //   void setKeyIndex(Datum::MapIndex);
+        //   Datum::MapIndex keyIndex() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'setKeyIndex'" << endl
+                          << "=====================" << endl;
+
+        const Datum::MapIndex INDEXES[] = { Datum::e_MAP_INDEX_NONE,
+                                            Datum::e_MAP_INDEX_HASH,
+                                            Datum::e_MAP_INDEX_HASH_INTERNED };
+        const int NUM_INDEXES = sizeof INDEXES / sizeof *INDEXES;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        {
+            Obj mB(&ta);  const Obj& B = mB;
+            ASSERT(Datum::e_MAP_INDEX_NONE == B.keyIndex());
+
+            mB.pushBack(values[0].key(), values[0].value());
+            Datum map = mB.commit();
+            ASSERT(false == map.theMap().hasHashIndex());
+            ASSERT(false == map.theMap().hasInternedKeys());
+            Datum::destroy(map, &ta);
+        }
+
+        for (int ti = 0; ti < NUM_INDEXES; ++ti) {
+            const Datum::MapIndex INDEX = INDEXES[ti];
+
+            for (int at = 0; at <= static_cast<int>(NUM_ELEMENTS); ++at) {
+                for (int sort = 0; sort < 2; ++sort) {
+                    if (veryVerbose) { T_ P_(INDEX) P_(at) P(sort) }
+
+                    Obj mB(1, &ta);  const Obj& B = mB;
+
+                    for (int i = 0; i <= static_cast<int>(NUM_ELEMENTS); ++i) {
+                        if (i == at) {
+                            mB.setKeyIndex(INDEX);
+                            ASSERTV(INDEX, at, INDEX == B.keyIndex());
+                        }
+                        if (i < static_cast<int>(NUM_ELEMENTS)) {
+                            mB.pushBack(values[i].key(), values[i].value());
+                        }
+                    }
+                    ASSERTV(INDEX, at, NUM_ELEMENTS == B.size());
+
+                    Datum       map = sort ? mB.sortAndCommit() : mB.commit();
+                    DatumMapRef ref = map.theMap();
+
+                    ASSERTV(INDEX, at, sort, NUM_ELEMENTS == ref.size());
+                    ASSERTV(INDEX, at, sort, (1 == sort) == ref.isSorted());
+                    ASSERTV(INDEX, at, sort,
+                            (Datum::e_MAP_INDEX_NONE != INDEX) ==
+                                                         ref.hasHashIndex());
+                    ASSERTV(INDEX, at, sort,
+                            (Datum::e_MAP_INDEX_HASH_INTERNED == INDEX) ==
+                                                      ref.hasInternedKeys());
+
+                    for (size_t i = 0; i < NUM_ELEMENTS; ++i) {
+                        const Datum *result = ref.find(values[i].key());
+                        ASSERTV(INDEX, at, sort, i, result);
+                        if (result) {
+                            ASSERTV(INDEX, at, sort, i,
+                                    values[i].value() == *result);
+                        }
+                    }
+                    ASSERTV(INDEX, at, sort, 0 == ref.find("sixth"));
+
+                    Datum::destroy(map, &ta);
+                }
+            }
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
       case 7: {
         // --------------------------------------------------------------------
         // TESTING TRAITS
@@ -46,14 +46,17 @@ static void createMapStorage(
                            DatumMutableMapOwningKeysRef        *mapping,
                            DatumMapOwningKeysBuilder::SizeType  capacity,
                            DatumMapOwningKeysBuilder::SizeType  keysCapacity,
+                           Datum::MapIndex                      keyIndex,
                            bslma::Allocator                    *basicAllocator)
     // Load the specified 'mapping' with a reference to newly created
     // datum-key-owning map having the specified 'capacity' and 'keysCapacity'
-    // using the specified 'basicAllocator'.
+    // and space for a key index of the specified 'keyIndex' kind using the
+    // specified 'basicAllocator'.
 {
     Datum::createUninitializedMap(mapping,
                                   capacity,
                                   keysCapacity,
+                                  keyIndex,
                                   basicAllocator);
     // Initialize the memory.
 
@@ -61,6 +64,69 @@ static void createMapStorage(
     bsl::uninitialized_fill_n(mapping->keys(), keysCapacity, char());
 }
 
+static void moveMapStorage(
+                      DatumMutableMapOwningKeysRef        *mapping,
+                      DatumMapOwningKeysBuilder::SizeType  capacity,
+                      DatumMapOwningKeysBuilder::SizeType  keysCapacity,
+                      DatumMapOwningKeysBuilder::SizeType  totalSizeOfKeys,
+                      Datum::MapIndex                      keyIndex,
+                      bslma::Allocator                    *basicAllocator)
+    // Replace the datum-key-owning map referred to by the specified 'mapping',
+    // whose keys have the specified 'totalSizeOfKeys', with a newly created
+    // datum-key-owning map having the specified 'capacity' and 'keysCapacity'
+    // and space for a key index of the specified 'keyIndex' kind, holding the
+    // same entries and having the same sorted flag, using the specified
+    // 'basicAllocator', and dispose of the original map.
+{
+    DatumMutableMapOwningKeysRef newMapping;
+
+    createMapStorage(&newMapping,
+                     capacity,
+                     keysCapacity,
+                     keyIndex,
+                     basicAllocator);
+
+    // Copy the existing data and dispose the old map.  Copy all the keys in a
+    // single operation.
+
+    bsl::memcpy(newMapping.keys(), mapping->keys(), totalSizeOfKeys);
+
+    *newMapping.size()   = *mapping->size();
+    *newMapping.sorted() = *mapping->sorted();
+
+    char *keyBegin = newMapping.keys();
+    for (DatumMapOwningKeysBuilder::SizeType i = 0;
+         i < *newMapping.size();
+         ++i) {
+        const int KEY_LENGTH =
+                           static_cast<int>(mapping->data()[i].key().length());
+        bslstl::StringRef key(keyBegin, KEY_LENGTH);
+        const Datum       value = mapping->data()[i].value();
+
+        newMapping.data()[i] = DatumMapEntry(key, value);
+
+        // Determine the position where the next key was inserted by computing
+        // the size of the current key.
+
+        keyBegin += key.length();
+    }
+
+    Datum::disposeUninitializedMap(*mapping, basicAllocator);
+    *mapping = newMapping;
+}
+
+static DatumMapOwningKeysBuilder::SizeType totalSizeOfKeys(
+                                  const DatumMutableMapOwningKeysRef& mapping)
+    // Return the total size of the keys copied into the datum-key-owning map
+    // referred to by the specified 'mapping'.
+{
+    if (0 != mapping.keys() && 0 != *mapping.size()) {
+        const DatumMapEntry& lastElement = mapping.data()[*mapping.size() - 1];
+        return lastElement.key().end() - mapping.keys();              // RETURN
+    }
+    return 0;
+}
+
 #ifdef BSLS_ASSERT_SAFE_IS_USED
 static bool compareGreater(const DatumMapEntry& lhs, const DatumMapEntry& rhs)
     // Return 'true' if key in the specified 'lhs' is greater than key in the
@@ -91,6 +157,7 @@ DatumMapOwningKeysBuilder::DatumMapOwningKeysBuilder(
 : d_capacity(0)
 , d_keysCapacity(0)
 , d_sorted(false)
+, d_keyIndex(Datum::e_MAP_INDEX_NONE)
 , d_allocator(allocator)
 {
     // Do not create a datum map.  Defer this to the first call to 'pushBack'
@@ -104,6 +171,7 @@ DatumMapOwningKeysBuilder::DatumMapOwningKeysBuilder(
 : d_capacity(initialCapacity)
 , d_keysCapacity(initialKeysCapacity)
 , d_sorted(false)
+, d_keyIndex(Datum::e_MAP_INDEX_NONE)
 , d_allocator(allocator)
 {
     // Do not create a datum map, if 'initialCapacity' and
@@ -114,6 +182,7 @@ DatumMapOwningKeysBuilder::DatumMapOwningKeysBuilder(
         createMapStorage(&d_mapping,
                          d_capacity,
                          d_keysCapacity,
+                         d_keyIndex,
                          d_allocator.mechanism());
     }
 }
@@ -147,12 +216,7 @@ void DatumMapOwningKeysBuilder::append(const DatumMapEntry *entries,
     }
 
 
-    SizeType totalSizeOfCurrentKeys = 0;
-    if (0 != d_mapping.keys() && 0 != *d_mapping.size()) {
-        const DatumMapEntry& lastElement =
-                                       d_mapping.data()[*d_mapping.size() - 1];
-        totalSizeOfCurrentKeys = lastElement.key().end() - d_mapping.keys();
-    }
+    const SizeType totalSizeOfCurrentKeys = totalSizeOfKeys(d_mapping);
 
     // Get the new keys-capacity for the map.
 
@@ -170,6 +234,7 @@ void DatumMapOwningKeysBuilder::append(const DatumMapEntry *entries,
         createMapStorage(&d_mapping,
                          d_capacity,
                          d_keysCapacity,
+                         d_keyIndex,
                          d_allocator.mechanism());
         *d_mapping.sorted() = d_sorted;
     }
@@ -184,37 +249,12 @@ void DatumMapOwningKeysBuilder::append(const DatumMapEntry *entries,
 
         // Create a new map with the higher capacity(s).
 
-        DatumMutableMapOwningKeysRef mapping;
-
-        createMapStorage(&mapping,
-                         d_capacity,
-                         d_keysCapacity,
-                         d_allocator.mechanism());
-
-        // Copy the existing data and dispose the old map.  Copy all the keys
-        // in a single operation.
-
-        bsl::memcpy(mapping.keys(), d_mapping.keys(), totalSizeOfCurrentKeys);
-
-        *mapping.size() = *d_mapping.size();
-
-        char *keyBegin = mapping.keys();
-        for (SizeType i = 0; i < *mapping.size(); ++i) {
-            const int KEY_LENGTH =
-                          static_cast<int>(d_mapping.data()[i].key().length());
-            bslstl::StringRef key(keyBegin, KEY_LENGTH);
-            const Datum       value = d_mapping.data()[i].value();
-
-            mapping.data()[i] = DatumMapEntry(key, value);
-
-            // Determine the position where the next key was inserted by
-            // computing the size of the current key.
-
-            keyBegin += key.length();
-        }
-
-        Datum::disposeUninitializedMap(d_mapping, d_allocator.mechanism());
-        d_mapping = mapping;
+        moveMapStorage(&d_mapping,
+                       d_capacity,
+                       d_keysCapacity,
+                       totalSizeOfCurrentKeys,
+                       d_keyIndex,
+                       d_allocator.mechanism());
     }
 
     // Copy the new elements.
@@ -269,6 +309,27 @@ void DatumMapOwningKeysBuilder::setSorted(bool value)
     }
 }
 
+void DatumMapOwningKeysBuilder::setKeyIndex(Datum::MapIndex value)
+{
+    BSLS_ASSERT(Datum::e_MAP_INDEX_HASH_INTERNED != value);
+
+    if (value == d_keyIndex) {
+        return;                                                       // RETURN
+    }
+
+    // Reserve space for the new kind of index in the map built so far.
+
+    if (d_mapping.data()) {
+        moveMapStorage(&d_mapping,
+                       d_capacity,
+                       d_keysCapacity,
+                       totalSizeOfKeys(d_mapping),
+                       value,
+                       d_allocator.mechanism());
+    }
+    d_keyIndex = value;
+}
+
 Datum DatumMapOwningKeysBuilder::sortAndCommit()
 {
     if (d_mapping.data()) {
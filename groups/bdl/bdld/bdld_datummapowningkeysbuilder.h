@@ -26,6 +26,12 @@ BSLS_IDENT("$Id$ $CSID$")
 // user can insert elements in a (ascending) sorted order and tag the map as
 // sorted.  The behaviour is undefined if unsorted map is tagged sorted.
 //
+// A map having many keys that is searched repeatedly can be given a hash index
+// of its keys by calling 'setKeyIndex' with 'Datum::e_MAP_INDEX_HASH' before
+// 'commit' or 'sortAndCommit'.  The index is stored in the same allocation as
+// the map and its keys, and makes 'DatumMapRef::find' O(1) on average (see
+// {'bdld_datum'|Hashed Key Index}).
+//
 // The only difference between this component and 'bdld_datummapbuilder' is
 // that this component makes a copy of the map entries keys and the resulting
 // 'Datum' object owns memory for the map entries keys.
@@ -155,6 +161,9 @@ class DatumMapOwningKeysBuilder {
     bool                          d_sorted;       // underlying map is sorted
                                                   // or not
 
+    Datum::MapIndex               d_keyIndex;     // kind of key index of the
+                                                  // datum-key-owning map
+
     allocator_type                d_allocator;    // allocator
 
   private:
@@ -229,6 +238,15 @@ class DatumMapOwningKeysBuilder {
         // sorted order.  Note also that the map being constructed is marked
         // unsorted by default.
 
+    void setKeyIndex(Datum::MapIndex value);
+        // Build a key index of the specified 'value' kind for the 'Datum' map
+        // (owning keys) being built by this object when it is committed.  The
+        // behavior is undefined unless
+        // 'Datum::e_MAP_INDEX_HASH_INTERNED != value'.  The behavior is also
+        // undefined if 'commit' or 'sortAndCommit' has already been called on
+        // this object.  Note that the map being constructed has no key index
+        // by default.
+
     Datum sortAndCommit();
         // Return a 'Datum' map (owning keys) value holding the elements
         // supplied to 'pushBack' or 'append' sorted by their keys.  The caller
@@ -249,6 +267,10 @@ class DatumMapOwningKeysBuilder {
         // additional memory will be required to grow the 'Datum' map being
         // built.
 
+    Datum::MapIndex keyIndex() const;
+        // Return the kind of key index that will be built for the 'Datum' map
+        // (owning keys) being built by this object.
+
     SizeType keysCapacity() const;
         // Return the keys-capacity of the held 'Datum' map (owning keys).  The
         // behavior is undefined if 'commit' or 'sortAndCommit' has already
@@ -291,6 +313,12 @@ DatumMapOwningKeysBuilder::SizeType DatumMapOwningKeysBuilder::capacity() const
     return d_capacity;
 }
 
+inline
+Datum::MapIndex DatumMapOwningKeysBuilder::keyIndex() const
+{
+    return d_keyIndex;
+}
+
 inline
 DatumMapOwningKeysBuilder::SizeType DatumMapOwningKeysBuilder::keysCapacity()
                                                                           const
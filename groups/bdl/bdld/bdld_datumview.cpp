@@ -0,0 +1,1400 @@
+// bdld_datumview.cpp                                                 -*-C++-*-
+#include <bdld_datumview.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdld_datumview_cpp,"$Id$ $CSID$")
+
+#include <bdld_datumarraybuilder.h>
+#include <bdld_datumintmapbuilder.h>
+#include <bdld_datummapowningkeysbuilder.h>
+
+#include <bdldfp_decimalconvertutil.h>
+
+#include <bdlb_print.h>
+
+#include <bslim_printer.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_climits.h>
+#include <bsl_cstdio.h>
+#include <bsl_ostream.h>
+
+///Implementation Notes
+///--------------------
+// Encoding is done by a single recursive function, 'Encoder::encodeValue',
+// that is run twice: once without a buffer to compute the length of the
+// encoding, and once to write it.  Sharing the traversal guarantees that both
+// passes agree on the position of every block.  Out-of-line data is laid out
+// depth-first, each container block being immediately followed by the data of
+// its first element, so every offset is positive.
+//
+// Validation ('Validator') checks every payload reachable from the header.
+// As a malicious encoding can point many payloads at the same block, and so
+// describe a tree exponentially larger than the buffer, the validator also
+// bounds the number of payloads visited by the number that fit in the buffer,
+// which no valid encoding exceeds since payloads never overlap.
+
+namespace BloombergLP {
+namespace bdld {
+namespace {
+
+// CONSTANTS
+const char k_MAGIC[4] = { 'B', 'D', 'D', 'V' };
+    // first bytes of every encoding
+
+const char k_VERSION = 1;
+    // version of the encoding format
+
+const bsls::Types::Int64 k_MICROSECONDS_PER_DAY = 86400000000LL;
+    // number of microseconds in a day, also used to encode 24:00:00.000000
+
+const int k_DATETIME_TIME_BITS = 37;
+    // number of low-order bits of the payload of a datetime holding the time
+
+const bsls::Types::Uint64 k_MAX_LENGTH = 0xFFFFFFFFu;
+    // maximum length of an encoding
+
+                            // ===================
+                            // struct EncodingUtil
+                            // ===================
+
+struct EncodingUtil {
+    // This 'struct' provides a namespace for functions used to lay out an
+    // encoding.
+
+    // CLASS METHODS
+    static bsls::Types::Uint64 roundUp8(bsls::Types::Uint64 value);
+        // Return the specified 'value' rounded up to a multiple of 8.
+
+    static bsls::Types::Uint64 arrayBlockLength(bsls::Types::Uint64 count);
+        // Return the length of the block of an array having the specified
+        // 'count' elements.
+
+    static bsls::Types::Uint64 intMapBlockLength(bsls::Types::Uint64 count);
+        // Return the length of the block of an integer-keyed map having the
+        // specified 'count' entries.
+
+    static bsls::Types::Uint64 mapBlockLength(bsls::Types::Uint64 count);
+        // Return the length of the block of a string-keyed map having the
+        // specified 'count' entries, excluding the characters of its keys.
+
+    static bsls::Types::Int64 microsecondsFromMidnight(const bdlt::Time& time);
+        // Return the number of microseconds from midnight to the specified
+        // 'time', or 'k_MICROSECONDS_PER_DAY' if 'time' is 24:00:00.000000.
+
+    static bdlt::Time timeFromMicroseconds(bsls::Types::Int64 microseconds);
+        // Return the time the specified 'microseconds' after midnight, or
+        // 24:00:00.000000 if 'microseconds' is 'k_MICROSECONDS_PER_DAY'.
+};
+
+// CLASS METHODS
+inline
+bsls::Types::Uint64 EncodingUtil::roundUp8(bsls::Types::Uint64 value)
+{
+    return (value + 7) & ~static_cast<bsls::Types::Uint64>(7);
+}
+
+inline
+bsls::Types::Uint64 EncodingUtil::arrayBlockLength(bsls::Types::Uint64 count)
+{
+    return roundUp8(count) + 8 * count;
+}
+
+inline
+bsls::Types::Uint64 EncodingUtil::intMapBlockLength(bsls::Types::Uint64 count)
+{
+    return 8 + roundUp8(4 * count) + roundUp8(count) + 8 * count;
+}
+
+inline
+bsls::Types::Uint64 EncodingUtil::mapBlockLength(bsls::Types::Uint64 count)
+{
+    return 8 + 8 * count + roundUp8(count) + 8 * count;
+}
+
+bsls::Types::Int64 EncodingUtil::microsecondsFromMidnight(
+                                                        const bdlt::Time& time)
+{
+    if (24 == time.hour()) {
+        return k_MICROSECONDS_PER_DAY;                                // RETURN
+    }
+
+    bsls::Types::Int64 result = time.hour();
+    result = result * 60 + time.minute();
+    result = result * 60 + time.second();
+    result = result * 1000 + time.millisecond();
+    return result * 1000 + time.microsecond();
+}
+
+bdlt::Time EncodingUtil::timeFromMicroseconds(bsls::Types::Int64 microseconds)
+{
+    if (k_MICROSECONDS_PER_DAY == microseconds) {
+        return bdlt::Time();                                          // RETURN
+    }
+
+    const int microsecond = static_cast<int>(microseconds % 1000);
+    microseconds /= 1000;
+    const int millisecond = static_cast<int>(microseconds % 1000);
+    microseconds /= 1000;
+    const int second      = static_cast<int>(microseconds % 60);
+    microseconds /= 60;
+    const int minute      = static_cast<int>(microseconds % 60);
+    const int hour        = static_cast<int>(microseconds / 60);
+
+    return bdlt::Time(hour, minute, second, millisecond, microsecond);
+}
+
+                               // =============
+                               // class Encoder
+                               // =============
+
+class Encoder {
+    // This class provides a mechanism that encodes a 'Datum' tree into a
+    // buffer or, if not supplied a buffer, computes the length of the
+    // encoding.
+
+    // DATA
+    char                *d_buffer_p;  // buffer, or 0 to compute the length
+    bsls::Types::Uint64  d_length;    // length of the encoding so far
+    int                  d_depth;     // number of enclosing containers
+
+    // PRIVATE MANIPULATORS
+    bsls::Types::Uint64 allocate(bsls::Types::Uint64 length);
+        // Reserve the specified 'length' bytes at the end of the encoding and
+        // return their offset.
+
+    bsls::Types::Uint64 allocateAligned(bsls::Types::Uint64 length);
+        // Reserve the specified 'length' bytes at the end of the encoding,
+        // starting at an offset that is a multiple of 8, and return their
+        // offset.  Padding bytes are set to zero.
+
+    void storeBytes(bsls::Types::Uint64  offset,
+                    const void          *data,
+                    bsls::Types::Uint64  length);
+        // Copy the specified 'length' bytes at the specified 'data' address
+        // to the specified 'offset' in the encoding.
+
+    void storeReference(bsls::Types::Uint64 payload,
+                        bsls::Types::Uint64 count,
+                        bsls::Types::Uint64 target);
+        // Store at the specified 'payload' offset a reference having the
+        // specified 'count' and referring to the specified 'target' offset.
+
+    void storeUint32(bsls::Types::Uint64 offset, unsigned int value);
+        // Store the specified 'value' in little-endian byte order at the
+        // specified 'offset' in the encoding.
+
+    void storeUint64(bsls::Types::Uint64 offset, bsls::Types::Uint64 value);
+        // Store the specified 'value' in little-endian byte order at the
+        // specified 'offset' in the encoding.
+
+    void storeZeros(bsls::Types::Uint64 offset, bsls::Types::Uint64 length);
+        // Set the specified 'length' bytes at the specified 'offset' in the
+        // encoding to zero.
+
+    int encodeArray(bsls::Types::Uint64 payload, const DatumArrayRef& array);
+    int encodeIntMap(bsls::Types::Uint64 payload, const DatumIntMapRef& map);
+    int encodeMap(bsls::Types::Uint64 payload, const DatumMapRef& map);
+        // Encode the specified 'array' or 'map' with its payload at the
+        // specified 'payload' offset.  Return 0 on success, and a non-zero
+        // value otherwise.
+
+  public:
+    // CREATORS
+    explicit Encoder(char *buffer);
+        // Create an encoder writing into the specified 'buffer', or only
+        // computing the length of the encoding if 'buffer' is 0.
+
+    // MANIPULATORS
+    int encode(const Datum& datum);
+        // Encode the specified 'datum' as a top-level value.  Return 0 on
+        // success, and a non-zero value otherwise.
+
+    int encodeValue(bsls::Types::Uint64 payload,
+                    bsls::Types::Uint64 tag,
+                    const Datum&        datum);
+        // Encode the specified 'datum' with its payload at the specified
+        // 'payload' offset and its tag at the specified 'tag' offset.  Return
+        // 0 on success, and a non-zero value otherwise.
+
+    // ACCESSORS
+    bsls::Types::Uint64 length() const;
+        // Return the length of the encoding so far.
+};
+
+// PRIVATE MANIPULATORS
+inline
+bsls::Types::Uint64 Encoder::allocate(bsls::Types::Uint64 length)
+{
+    const bsls::Types::Uint64 result = d_length;
+    d_length += length;
+    return result;
+}
+
+inline
+bsls::Types::Uint64 Encoder::allocateAligned(bsls::Types::Uint64 length)
+{
+    const bsls::Types::Uint64 result = EncodingUtil::roundUp8(d_length);
+    storeZeros(d_length, result - d_length);
+    d_length = result + length;
+    return result;
+}
+
+inline
+void Encoder::storeBytes(bsls::Types::Uint64  offset,
+                         const void          *data,
+                         bsls::Types::Uint64  length)
+{
+    if (d_buffer_p && length) {
+        bsl::memcpy(d_buffer_p + offset, data, length);
+    }
+}
+
+inline
+void Encoder::storeReference(bsls::Types::Uint64 payload,
+                             bsls::Types::Uint64 count,
+                             bsls::Types::Uint64 target)
+{
+    storeUint64(payload, count | (target - payload) << 32);
+}
+
+inline
+void Encoder::storeUint32(bsls::Types::Uint64 offset, unsigned int value)
+{
+    if (d_buffer_p) {
+#if defined(BSLS_PLATFORM_IS_BIG_ENDIAN)
+        value = bsls::ByteOrderUtil::swapBytes(value);
+#endif
+        bsl::memcpy(d_buffer_p + offset, &value, sizeof value);
+    }
+}
+
+inline
+void Encoder::storeUint64(bsls::Types::Uint64 offset,
+                          bsls::Types::Uint64 value)
+{
+    if (d_buffer_p) {
+#if defined(BSLS_PLATFORM_IS_BIG_ENDIAN)
+        value = bsls::ByteOrderUtil::swapBytes(value);
+#endif
+        bsl::memcpy(d_buffer_p + offset, &value, sizeof value);
+    }
+}
+
+inline
+void Encoder::storeZeros(bsls::Types::Uint64 offset,
+                         bsls::Types::Uint64 length)
+{
+    if (d_buffer_p && length) {
+        bsl::memset(d_buffer_p + offset, 0, length);
+    }
+}
+
+int Encoder::encodeArray(bsls::Types::Uint64  payload,
+                         const DatumArrayRef& array)
+{
+    const bsls::Types::Uint64 count = array.length();
+
+    if (0 == count) {
+        storeUint64(payload, 0);
+        return 0;                                                     // RETURN
+    }
+    if (count > k_MAX_LENGTH) {
+        return -1;                                                    // RETURN
+    }
+
+    const bsls::Types::Uint64 tagsLength = EncodingUtil::roundUp8(count);
+    const bsls::Types::Uint64 block      =
+                        allocateAligned(EncodingUtil::arrayBlockLength(count));
+
+    storeReference(payload, count, block);
+    storeZeros(block + count, tagsLength - count);
+
+    for (bsls::Types::Uint64 i = 0; i < count; ++i) {
+        const int rc = encodeValue(block + tagsLength + 8 * i,
+                                   block + i,
+                                   array[static_cast<bsl::size_t>(i)]);
+        if (rc) {
+            return rc;                                                // RETURN
+        }
+    }
+    return 0;
+}
+
+int Encoder::encodeIntMap(bsls::Types::Uint64   payload,
+                          const DatumIntMapRef& map)
+{
+    const bsls::Types::Uint64 count = map.size();
+
+    if (0 == count) {
+        storeUint64(payload, 0);
+        return 0;                                                     // RETURN
+    }
+    if (count > k_MAX_LENGTH) {
+        return -1;                                                    // RETURN
+    }
+
+    const bsls::Types::Uint64 keysLength = EncodingUtil::roundUp8(4 * count);
+    const bsls::Types::Uint64 tagsLength = EncodingUtil::roundUp8(count);
+    const bsls::Types::Uint64 block      =
+                       allocateAligned(EncodingUtil::intMapBlockLength(count));
+    const bsls::Types::Uint64 keys       = block + 8;
+    const bsls::Types::Uint64 tags       = keys + keysLength;
+    const bsls::Types::Uint64 payloads   = tags + tagsLength;
+
+    storeReference(payload, count, block);
+    storeUint64(block, map.isSorted() ? 1 : 0);
+    storeZeros(keys + 4 * count, keysLength - 4 * count);
+    storeZeros(tags + count, tagsLength - count);
+
+    for (bsls::Types::Uint64 i = 0; i < count; ++i) {
+        const DatumIntMapEntry& entry = map[static_cast<bsl::size_t>(i)];
+
+        storeUint32(keys + 4 * i, static_cast<unsigned int>(entry.key()));
+
+        const int rc = encodeValue(payloads + 8 * i, tags + i, entry.value());
+        if (rc) {
+            return rc;                                                // RETURN
+        }
+    }
+    return 0;
+}
+
+int Encoder::encodeMap(bsls::Types::Uint64 payload, const DatumMapRef& map)
+{
+    const bsls::Types::Uint64 count = map.size();
+
+    if (0 == count) {
+        storeUint64(payload, 0);
+        return 0;                                                     // RETURN
+    }
+    if (count > k_MAX_LENGTH) {
+        return -1;                                                    // RETURN
+    }
+
+    bsls::Types::Uint64 keysLength = 0;
+    for (bsls::Types::Uint64 i = 0; i < count; ++i) {
+        keysLength += map[static_cast<bsl::size_t>(i)].key().length();
+    }
+
+    const bsls::Types::Uint64 tagsLength = EncodingUtil::roundUp8(count);
+    const bsls::Types::Uint64 block      =
+                          allocateAligned(EncodingUtil::mapBlockLength(count));
+    const bsls::Types::Uint64 keyRefs    = block + 8;
+    const bsls::Types::Uint64 tags       = keyRefs + 8 * count;
+    const bsls::Types::Uint64 payloads   = tags + tagsLength;
+    bsls::Types::Uint64       keys       = allocate(keysLength);
+
+    storeReference(payload, count, block);
+    storeUint64(block, map.isSorted() ? 1 : 0);
+    storeZeros(tags + count, tagsLength - count);
+
+    for (bsls::Types::Uint64 i = 0; i < count; ++i) {
+        const DatumMapEntry&      entry  = map[static_cast<bsl::size_t>(i)];
+        const bsls::Types::Uint64 length = entry.key().length();
+
+        if (length) {
+            storeReference(keyRefs + 8 * i, length, keys);
+            storeBytes(keys, entry.key().data(), length);
+            keys += length;
+        }
+        else {
+            storeUint64(keyRefs + 8 * i, 0);
+        }
+
+        const int rc = encodeValue(payloads + 8 * i, tags + i, entry.value());
+        if (rc) {
+            return rc;                                                // RETURN
+        }
+    }
+    return 0;
+}
+
+// CREATORS
+Encoder::Encoder(char *buffer)
+: d_buffer_p(buffer)
+, d_length(0)
+, d_depth(0)
+{
+}
+
+// MANIPULATORS
+int Encoder::encode(const Datum& datum)
+{
+    const bsls::Types::Uint64 header =
+                                    allocate(DatumViewUtil::k_HEADER_LENGTH);
+
+    storeBytes(header, k_MAGIC, sizeof k_MAGIC);
+    storeBytes(header + 4, &k_VERSION, 1);
+    storeZeros(header + 6, 2);
+
+    const int rc = encodeValue(header + 8, header + 5, datum);
+    if (rc) {
+        return rc;                                                    // RETURN
+    }
+    return d_length > k_MAX_LENGTH ? -1 : 0;
+}
+
+int Encoder::encodeValue(bsls::Types::Uint64 payload,
+                         bsls::Types::Uint64 tag,
+                         const Datum&        datum)
+{
+    typedef bsls::Types::Uint64 Uint64;
+
+    const Datum::DataType type = datum.type();
+
+    if (d_buffer_p) {
+        d_buffer_p[tag] = static_cast<char>(type);
+    }
+
+    switch (type) {
+      case Datum::e_NIL: {
+        storeUint64(payload, 0);
+      } break;
+      case Datum::e_INTEGER: {
+        storeUint64(payload, static_cast<Uint64>(
+                         static_cast<bsls::Types::Int64>(datum.theInteger())));
+      } break;
+      case Datum::e_DOUBLE: {
+        const double value = datum.theDouble();
+        Uint64       bits;
+        bsl::memcpy(&bits, &value, sizeof bits);
+        storeUint64(payload, bits);
+      } break;
+      case Datum::e_STRING:
+      case Datum::e_BINARY: {
+        const char  *data;
+        Uint64       length;
+        if (Datum::e_STRING == type) {
+            const bslstl::StringRef value = datum.theString();
+            data   = value.data();
+            length = value.length();
+        }
+        else {
+            const DatumBinaryRef value = datum.theBinary();
+            data   = static_cast<const char *>(value.data());
+            length = value.size();
+        }
+        if (length > k_MAX_LENGTH) {
+            return -1;                                                // RETURN
+        }
+        if (length) {
+            const Uint64 bytes = allocate(length);
+            storeBytes(bytes, data, length);
+            storeReference(payload, length, bytes);
+        }
+        else {
+            storeUint64(payload, 0);
+        }
+      } break;
+      case Datum::e_BOOLEAN: {
+        storeUint64(payload, datum.theBoolean() ? 1 : 0);
+      } break;
+      case Datum::e_ERROR: {
+        const DatumError        error   = datum.theError();
+        const bslstl::StringRef message = error.message();
+        const Uint64            code    =
+                                     static_cast<unsigned int>(error.code());
+
+        if (message.length() > k_MAX_LENGTH) {
+            return -1;                                                // RETURN
+        }
+        if (message.length()) {
+            const Uint64 block = allocate(4 + message.length());
+            storeUint32(block, static_cast<unsigned int>(message.length()));
+            storeBytes(block + 4, message.data(), message.length());
+            storeReference(payload, code, block);
+        }
+        else {
+            storeUint64(payload, code);
+        }
+      } break;
+      case Datum::e_DATE: {
+        storeUint64(payload, datum.theDate() - bdlt::Date());
+      } break;
+      case Datum::e_TIME: {
+        storeUint64(payload,
+                    EncodingUtil::microsecondsFromMidnight(datum.theTime()));
+      } break;
+      case Datum::e_DATETIME: {
+        const bdlt::Datetime value = datum.theDatetime();
+        const Uint64         days  = value.date() - bdlt::Date();
+        storeUint64(payload,
+                    days << k_DATETIME_TIME_BITS |
+                       EncodingUtil::microsecondsFromMidnight(value.time()));
+      } break;
+      case Datum::e_DATETIME_INTERVAL: {
+        const bdlt::DatetimeInterval value = datum.theDatetimeInterval();
+        const Uint64                 block = allocateAligned(16);
+        storeUint64(block, static_cast<Uint64>(
+                               static_cast<bsls::Types::Int64>(value.days())));
+        storeUint64(block + 8,
+                    static_cast<Uint64>(value.fractionalDayInMicroseconds()));
+        storeReference(payload, 0, block);
+      } break;
+      case Datum::e_INTEGER64: {
+        storeUint64(payload, static_cast<Uint64>(datum.theInteger64()));
+      } break;
+      case Datum::e_DECIMAL64: {
+        unsigned char bid[8];
+        bdldfp::DecimalConvertUtil::decimal64ToBID(bid,
+                                                   datum.theDecimal64());
+        Uint64 bits;
+        bsl::memcpy(&bits, bid, sizeof bits);
+        storeUint64(payload, bits);
+      } break;
+      case Datum::e_ARRAY:
+      case Datum::e_MAP:
+      case Datum::e_INT_MAP: {
+        if (d_depth >= DatumViewUtil::k_MAX_NESTING_DEPTH) {
+            return -1;                                                // RETURN
+        }
+        ++d_depth;
+        const int rc = Datum::e_ARRAY == type
+                     ? encodeArray(payload, datum.theArray())
+                     : Datum::e_MAP == type
+                     ? encodeMap(payload, datum.theMap())
+                     : encodeIntMap(payload, datum.theIntMap());
+        --d_depth;
+        if (rc) {
+            return rc;                                                // RETURN
+        }
+      } break;
+      default: {
+        // User-defined values cannot be encoded.
+
+        return -1;                                                    // RETURN
+      }
+    }
+    return 0;
+}
+
+// ACCESSORS
+inline
+bsls::Types::Uint64 Encoder::length() const
+{
+    return d_length;
+}
+
+                              // ===============
+                              // class Validator
+                              // ===============
+
+class Validator {
+    // This class provides a mechanism that verifies that an encoding is
+    // well-formed.
+
+    // DATA
+    const char          *d_buffer_p;  // encoding being verified
+    bsls::Types::Uint64  d_length;    // length of the encoding
+    bsls::Types::Uint64  d_budget;    // number of payloads that may still be
+                                      // visited
+    bsls::Types::Uint64  d_keyBudget; // number of bytes of keys that may
+                                      // still be compared
+    bsls::Types::Uint64  d_maxDays;   // number of days from 0001/01/01 to
+                                      // 9999/12/31 in the configured calendar
+
+    // PRIVATE ACCESSORS
+    bool isValidReference(bsls::Types::Uint64 *target,
+                          bsls::Types::Uint64  from,
+                          bsls::Types::Uint64  offset,
+                          bsls::Types::Uint64  length) const;
+        // Return 'true' if the specified 'offset' from the specified 'from'
+        // offset refers to the specified 'length' bytes past the end of the
+        // 8-byte value at 'from' and within the encoding, and load the
+        // target offset into the specified 'target'; return 'false'
+        // otherwise.
+
+  public:
+    // CREATORS
+    Validator(const char *buffer, bsls::Types::Uint64 length);
+        // Create a validator for the encoding in the specified 'buffer' of
+        // the specified 'length'.
+
+    // MANIPULATORS
+    bool isValidValue(bsls::Types::Uint64 payload,
+                      unsigned char       tag,
+                      int                 depth);
+        // Return 'true' if the value of the specified 'tag' whose payload is
+        // at the specified 'payload' offset, and having the specified 'depth'
+        // enclosing containers, is well-formed, and 'false' otherwise.
+};
+
+// PRIVATE ACCESSORS
+inline
+bool Validator::isValidReference(bsls::Types::Uint64 *target,
+                                 bsls::Types::Uint64  from,
+                                 bsls::Types::Uint64  offset,
+                                 bsls::Types::Uint64  length) const
+{
+    *target = from + offset;
+    return offset >= 8
+        && *target <= d_length
+        && length  <= d_length - *target;
+}
+
+// CREATORS
+Validator::Validator(const char *buffer, bsls::Types::Uint64 length)
+: d_buffer_p(buffer)
+, d_length(length)
+, d_budget(length / 8)
+, d_keyBudget(length)
+, d_maxDays(bdlt::Date(9999, 12, 31) - bdlt::Date())
+{
+}
+
+// MANIPULATORS
+bool Validator::isValidValue(bsls::Types::Uint64 payload,
+                             unsigned char       tag,
+                             int                 depth)
+{
+    typedef bsls::Types::Uint64 Uint64;
+    typedef bsls::Types::Int64  Int64;
+
+    if (0 == d_budget) {
+        return false;                                                 // RETURN
+    }
+    --d_budget;
+
+    const Uint64 value  = DatumView_ImpUtil::loadUint64(d_buffer_p + payload);
+    const Uint64 count  = value & 0xFFFFFFFFu;
+    const Uint64 offset = value >> 32;
+    Uint64       target;
+
+    switch (tag) {
+      case Datum::e_NIL:
+      case Datum::e_INTEGER:
+      case Datum::e_DOUBLE:
+      case Datum::e_BOOLEAN:
+      case Datum::e_INTEGER64:
+      case Datum::e_DECIMAL64: {
+        return true;                                                  // RETURN
+      }
+      case Datum::e_STRING:
+      case Datum::e_BINARY: {
+        return 0 == value
+            || isValidReference(&target, payload, offset, count);     // RETURN
+      }
+      case Datum::e_ERROR: {
+        if (0 == offset) {
+            return true;                                              // RETURN
+        }
+        if (!isValidReference(&target, payload, offset, 4)) {
+            return false;                                             // RETURN
+        }
+        const Uint64 length =
+                        DatumView_ImpUtil::loadUint32(d_buffer_p + target);
+        return length <= d_length - target - 4;                       // RETURN
+      }
+      case Datum::e_DATE: {
+        return value <= d_maxDays;                                    // RETURN
+      }
+      case Datum::e_TIME: {
+        return value <= static_cast<Uint64>(k_MICROSECONDS_PER_DAY);
+                                                                      // RETURN
+      }
+      case Datum::e_DATETIME: {
+        const Uint64 days = value >> k_DATETIME_TIME_BITS;
+        const Uint64 time = value & ((static_cast<Uint64>(1)
+                                               << k_DATETIME_TIME_BITS) - 1);
+        return days <= d_maxDays
+            && (time < static_cast<Uint64>(k_MICROSECONDS_PER_DAY)
+                || (time == static_cast<Uint64>(k_MICROSECONDS_PER_DAY)
+                    && 0 == days));                                   // RETURN
+      }
+      case Datum::e_DATETIME_INTERVAL: {
+        if (0 != count || !isValidReference(&target, payload, offset, 16)) {
+            return false;                                             // RETURN
+        }
+        const Int64 days = static_cast<Int64>(
+                          DatumView_ImpUtil::loadUint64(d_buffer_p + target));
+        const Int64 time = static_cast<Int64>(
+                      DatumView_ImpUtil::loadUint64(d_buffer_p + target + 8));
+        return days >= INT_MIN
+            && days <= INT_MAX
+            && time >  -k_MICROSECONDS_PER_DAY
+            && time <   k_MICROSECONDS_PER_DAY
+            && !(days > 0 && time < 0)
+            && !(days < 0 && time > 0);                               // RETURN
+      }
+      case Datum::e_ARRAY:
+      case Datum::e_MAP:
+      case Datum::e_INT_MAP: {
+        // Note that the offset of an empty container is never used.
+
+        if (depth >= DatumViewUtil::k_MAX_NESTING_DEPTH) {
+            return false;                                             // RETURN
+        }
+        if (0 == count) {
+            return true;                                              // RETURN
+        }
+
+        const Uint64 blockLength =
+                        Datum::e_ARRAY == tag
+                        ? EncodingUtil::arrayBlockLength(count)
+                        : Datum::e_MAP == tag
+                        ? EncodingUtil::mapBlockLength(count)
+                        : EncodingUtil::intMapBlockLength(count);
+        if (!isValidReference(&target, payload, offset, blockLength)) {
+            return false;                                             // RETURN
+        }
+
+        // A map flagged as sorted must be sorted, as lookups in it are
+        // binary searches and 'toDatum' relies on it.
+
+        const bool sorted = Datum::e_ARRAY != tag
+                         && (DatumView_ImpUtil::loadUint32(d_buffer_p + target)
+                             & 1);
+
+        Uint64 tags;
+        if (Datum::e_ARRAY == tag) {
+            tags = target;
+        }
+        else if (Datum::e_MAP == tag) {
+            tags = target + 8 + 8 * count;
+
+            bslstl::StringRef previous;
+            for (Uint64 i = 0; i < count; ++i) {
+                const Uint64 ref     = target + 8 + 8 * i;
+                const Uint64 key     =
+                               DatumView_ImpUtil::loadUint64(d_buffer_p + ref);
+                Uint64       keyTarget = 0;
+
+                if (0 != key && !isValidReference(&keyTarget,
+                                                  ref,
+                                                  key >> 32,
+                                                  key & 0xFFFFFFFFu)) {
+                    return false;                                     // RETURN
+                }
+
+                const bslstl::StringRef current(
+                                d_buffer_p + keyTarget,
+                                static_cast<bsl::size_t>(key & 0xFFFFFFFFu));
+                if (sorted) {
+                    // Keys may alias the same bytes, so charge the bytes
+                    // compared against the length of the encoding, which
+                    // bounds their total for keys that do not overlap.
+
+                    const Uint64 numCompared =
+                                        current.length() < previous.length()
+                                        ? current.length()
+                                        : previous.length();
+                    if (numCompared > d_keyBudget || current < previous) {
+                        return false;                                 // RETURN
+                    }
+                    d_keyBudget -= numCompared;
+                }
+                previous = current;
+            }
+        }
+        else {
+            tags = target + 8 + EncodingUtil::roundUp8(4 * count);
+
+            for (Uint64 i = 1; sorted && i < count; ++i) {
+                const int current  = static_cast<int>(
+                      DatumView_ImpUtil::loadUint32(d_buffer_p + target + 8
+                                                               + 4 * i));
+                const int previous = static_cast<int>(
+                      DatumView_ImpUtil::loadUint32(d_buffer_p + target + 4
+                                                               + 4 * i));
+                if (current < previous) {
+                    return false;                                     // RETURN
+                }
+            }
+        }
+
+        const Uint64 payloads = tags + EncodingUtil::roundUp8(count);
+        for (Uint64 i = 0; i < count; ++i) {
+            if (!isValidValue(
+                       payloads + 8 * i,
+                       static_cast<unsigned char>(d_buffer_p[tags + i]),
+                       depth + 1)) {
+                return false;                                         // RETURN
+            }
+        }
+        return true;                                                  // RETURN
+      }
+    }
+
+    // Unknown tag, or a user-defined value.
+
+    return false;
+}
+
+                           // =====================
+                           // class MapEntryPrinter
+                           // =====================
+
+class MapEntryPrinter {
+    // This class provides a printable representation of an entry of a view
+    // of a map, formatted as 'DatumMapEntry' and 'DatumIntMapEntry' are.
+
+    // DATA
+    bslstl::StringRef d_key;    // key of the entry
+    DatumView         d_value;  // value of the entry
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(MapEntryPrinter, bdlb::HasPrintMethod);
+
+    // CREATORS
+    MapEntryPrinter(const bslstl::StringRef& key, const DatumView& value);
+        // Create a printer for the entry having the specified 'key' and
+        // 'value'.
+
+    // ACCESSORS
+    bsl::ostream& print(bsl::ostream& stream,
+                        int           level,
+                        int           spacesPerLevel) const;
+        // Write the entry to the specified 'stream' at the specified 'level'
+        // with the specified 'spacesPerLevel', and return 'stream'.
+};
+
+// CREATORS
+MapEntryPrinter::MapEntryPrinter(const bslstl::StringRef& key,
+                                 const DatumView&         value)
+: d_key(key)
+, d_value(value)
+{
+}
+
+// ACCESSORS
+bsl::ostream& MapEntryPrinter::print(bsl::ostream& stream,
+                                     int           level,
+                                     int           spacesPerLevel) const
+{
+    if (stream.bad()) {
+        return stream;                                                // RETURN
+    }
+
+    bslim::Printer printer(&stream, level, spacesPerLevel);
+    printer.start();
+    printer.printAttribute(d_key, d_value);
+    printer.end();
+
+    return stream << bsl::flush;
+}
+
+template <class TYPE>
+void printScalar(bsl::ostream& stream,
+                 const TYPE&   value,
+                 int           level,
+                 int           spacesPerLevel)
+    // Write the specified 'value' to the specified 'stream' at the specified
+    // 'level' with the specified 'spacesPerLevel', as 'Datum::print' does.
+{
+    bdlb::PrintMethods::print(stream, value, level, spacesPerLevel);
+}
+
+void printLiteral(bsl::ostream&            stream,
+                  const bslstl::StringRef& text,
+                  bool                     quoted,
+                  int                      level,
+                  int                      spacesPerLevel)
+    // Write the specified 'text', enclosed in double quotes if the specified
+    // 'quoted' is 'true', to the specified 'stream' at the specified 'level'
+    // with the specified 'spacesPerLevel', as 'Datum::print' does for null,
+    // boolean, and string values.
+{
+    bdlb::Print::indent(stream, level, spacesPerLevel);
+    if (quoted) {
+        stream << '"' << text << '"';
+    }
+    else {
+        stream << text;
+    }
+    if (0 <= spacesPerLevel) {
+        stream << '\n';
+    }
+}
+
+}  // close unnamed namespace
+
+                              // ---------------
+                              // class DatumView
+                              // ---------------
+
+// ACCESSORS
+bdlt::Date DatumView::theDate() const
+{
+    BSLS_ASSERT(isDate());
+
+    return bdlt::Date() + static_cast<int>(
+                                   DatumView_ImpUtil::loadUint64(d_payload_p));
+}
+
+bdlt::Datetime DatumView::theDatetime() const
+{
+    BSLS_ASSERT(isDatetime());
+
+    const bsls::Types::Uint64 value =
+                                    DatumView_ImpUtil::loadUint64(d_payload_p);
+    const bsls::Types::Int64  time  = static_cast<bsls::Types::Int64>(
+               value & ((static_cast<bsls::Types::Uint64>(1)
+                                                << k_DATETIME_TIME_BITS) - 1));
+
+    const int                 days  =
+                          static_cast<int>(value >> k_DATETIME_TIME_BITS);
+
+    return bdlt::Datetime(bdlt::Date() + days,
+                          EncodingUtil::timeFromMicroseconds(time));
+}
+
+bdlt::DatetimeInterval DatumView::theDatetimeInterval() const
+{
+    BSLS_ASSERT(isDatetimeInterval());
+
+    const char               *block = outOfLineData();
+    const int                 days  =
+                      static_cast<int>(DatumView_ImpUtil::loadUint64(block));
+    const bsls::Types::Int64  time  = static_cast<bsls::Types::Int64>(
+                                    DatumView_ImpUtil::loadUint64(block + 8));
+
+    return bdlt::DatetimeInterval(days, 0, 0, 0, 0, time);
+}
+
+bdldfp::Decimal64 DatumView::theDecimal64() const
+{
+    BSLS_ASSERT(isDecimal64());
+
+    const bsls::Types::Uint64 bits =
+                                    DatumView_ImpUtil::loadUint64(d_payload_p);
+    unsigned char             bid[8];
+    bsl::memcpy(bid, &bits, sizeof bid);
+    return bdldfp::DecimalConvertUtil::decimal64FromBID(bid);
+}
+
+DatumError DatumView::theError() const
+{
+    BSLS_ASSERT(isError());
+
+    const int code = static_cast<int>(
+                                   DatumView_ImpUtil::loadUint32(d_payload_p));
+    if (0 == DatumView_ImpUtil::loadUint32(d_payload_p + 4)) {
+        return DatumError(code);                                      // RETURN
+    }
+
+    const char *block = outOfLineData();
+    return DatumError(code,
+                      bslstl::StringRef(block + 4,
+                                        DatumView_ImpUtil::loadUint32(block)));
+}
+
+bdlt::Time DatumView::theTime() const
+{
+    BSLS_ASSERT(isTime());
+
+    const bsls::Types::Int64 time = static_cast<bsls::Types::Int64>(
+                                   DatumView_ImpUtil::loadUint64(d_payload_p));
+
+    return EncodingUtil::timeFromMicroseconds(time);
+}
+
+bsl::ostream& DatumView::print(bsl::ostream& stream,
+                               int           level,
+                               int           spacesPerLevel) const
+{
+    if (stream.bad()) {
+        return stream;                                                // RETURN
+    }
+
+    switch (d_type) {
+      case Datum::e_NIL: {
+        printLiteral(stream, "nil", false, level, spacesPerLevel);
+      } break;
+      case Datum::e_INTEGER: {
+        printScalar(stream, theInteger(), level, spacesPerLevel);
+      } break;
+      case Datum::e_DOUBLE: {
+        printScalar(stream, theDouble(), level, spacesPerLevel);
+      } break;
+      case Datum::e_STRING: {
+        printLiteral(stream, theString(), true, level, spacesPerLevel);
+      } break;
+      case Datum::e_BOOLEAN: {
+        printLiteral(stream,
+                     theBoolean() ? "true" : "false",
+                     false,
+                     level,
+                     spacesPerLevel);
+      } break;
+      case Datum::e_ERROR: {
+        printScalar(stream, theError(), level, spacesPerLevel);
+      } break;
+      case Datum::e_DATE: {
+        printScalar(stream, theDate(), level, spacesPerLevel);
+      } break;
+      case Datum::e_TIME: {
+        printScalar(stream, theTime(), level, spacesPerLevel);
+      } break;
+      case Datum::e_DATETIME: {
+        printScalar(stream, theDatetime(), level, spacesPerLevel);
+      } break;
+      case Datum::e_DATETIME_INTERVAL: {
+        printScalar(stream, theDatetimeInterval(), level, spacesPerLevel);
+      } break;
+      case Datum::e_INTEGER64: {
+        printScalar(stream, theInteger64(), level, spacesPerLevel);
+      } break;
+      case Datum::e_ARRAY: {
+        theArray().print(stream, level, spacesPerLevel);
+      } break;
+      case Datum::e_MAP: {
+        theMap().print(stream, level, spacesPerLevel);
+      } break;
+      case Datum::e_BINARY: {
+        printScalar(stream, theBinary(), level, spacesPerLevel);
+      } break;
+      case Datum::e_DECIMAL64: {
+        printScalar(stream, theDecimal64(), level, spacesPerLevel);
+      } break;
+      case Datum::e_INT_MAP: {
+        theIntMap().print(stream, level, spacesPerLevel);
+      } break;
+    }
+
+    return stream << bsl::flush;
+}
+
+                            // --------------------
+                            // class DatumArrayView
+                            // --------------------
+
+// ACCESSORS
+bsl::ostream& DatumArrayView::print(bsl::ostream& stream,
+                                    int           level,
+                                    int           spacesPerLevel) const
+{
+    if (stream.bad()) {
+        return stream;                                                // RETURN
+    }
+
+    bslim::Printer printer(&stream, level, spacesPerLevel);
+    printer.start();
+
+    for (SizeType i = 0; i < d_length; ++i) {
+        printer.printValue((*this)[i]);
+    }
+
+    printer.end();
+
+    return stream << bsl::flush;
+}
+
+                             // ------------------
+                             // class DatumMapView
+                             // ------------------
+
+// ACCESSORS
+bool DatumMapView::find(DatumView *result, const bslstl::StringRef& key) const
+{
+    BSLS_ASSERT(result);
+
+    if (d_sorted) {
+        SizeType first = 0;
+        SizeType last  = d_size;
+        while (first < last) {
+            const SizeType middle = first + (last - first) / 2;
+            const int      cmp    = key.compare(this->key(middle));
+            if (0 == cmp) {
+                *result = value(middle);
+                return true;                                          // RETURN
+            }
+            if (cmp < 0) {
+                last = middle;
+            }
+            else {
+                first = middle + 1;
+            }
+        }
+        return false;                                                 // RETURN
+    }
+
+    for (SizeType i = 0; i < d_size; ++i) {
+        if (key == this->key(i)) {
+            *result = value(i);
+            return true;                                              // RETURN
+        }
+    }
+    return false;
+}
+
+bsl::ostream& DatumMapView::print(bsl::ostream& stream,
+                                  int           level,
+                                  int           spacesPerLevel) const
+{
+    if (stream.bad()) {
+        return stream;                                                // RETURN
+    }
+
+    bslim::Printer printer(&stream, level, spacesPerLevel);
+    printer.start();
+
+    for (SizeType i = 0; i < d_size; ++i) {
+        printer.printValue(MapEntryPrinter(key(i), value(i)));
+    }
+
+    printer.end();
+
+    return stream << bsl::flush;
+}
+
+                           // ---------------------
+                           // class DatumIntMapView
+                           // ---------------------
+
+// ACCESSORS
+bool DatumIntMapView::find(DatumView *result, int key) const
+{
+    BSLS_ASSERT(result);
+
+    if (d_sorted) {
+        SizeType first = 0;
+        SizeType last  = d_size;
+        while (first < last) {
+            const SizeType middle    = first + (last - first) / 2;
+            const int      middleKey = this->key(middle);
+            if (key == middleKey) {
+                *result = value(middle);
+                return true;                                          // RETURN
+            }
+            if (key < middleKey) {
+                last = middle;
+            }
+            else {
+                first = middle + 1;
+            }
+        }
+        return false;                                                 // RETURN
+    }
+
+    for (SizeType i = 0; i < d_size; ++i) {
+        if (key == this->key(i)) {
+            *result = value(i);
+            return true;                                              // RETURN
+        }
+    }
+    return false;
+}
+
+bsl::ostream& DatumIntMapView::print(bsl::ostream& stream,
+                                     int           level,
+                                     int           spacesPerLevel) const
+{
+    if (stream.bad()) {
+        return stream;                                                // RETURN
+    }
+
+    bslim::Printer printer(&stream, level, spacesPerLevel);
+    printer.start();
+
+    for (SizeType i = 0; i < d_size; ++i) {
+        char keyBuffer[16];
+        const int keyLength = bsl::snprintf(keyBuffer,
+                                            sizeof keyBuffer,
+                                            "%d",
+                                            key(i));
+        printer.printValue(MapEntryPrinter(
+                                  bslstl::StringRef(keyBuffer, keyLength),
+                                  value(i)));
+    }
+
+    printer.end();
+
+    return stream << bsl::flush;
+}
+
+                            // --------------------
+                            // struct DatumViewUtil
+                            // --------------------
+
+// CLASS METHODS
+int DatumViewUtil::encode(char *buffer, bsl::size_t length, const Datum& datum)
+{
+    BSLS_ASSERT(buffer);
+    BSLS_ASSERT(k_HEADER_LENGTH <= length);
+
+    Encoder encoder(buffer);
+    const int rc = encoder.encode(datum);
+
+    BSLS_ASSERT(0 != rc || encoder.length() == length);
+    (void)length;
+
+    return rc;
+}
+
+int DatumViewUtil::encode(bsl::vector<char> *result, const Datum& datum)
+{
+    BSLS_ASSERT(result);
+
+    bsl::size_t length;
+    if (0 != encodedLength(&length, datum)) {
+        return -1;                                                    // RETURN
+    }
+
+    result->resize(length);
+    return encode(result->data(), length, datum);
+}
+
+int DatumViewUtil::encodedLength(bsl::size_t *result, const Datum& datum)
+{
+    BSLS_ASSERT(result);
+
+    Encoder   encoder(0);
+    const int rc = encoder.encode(datum);
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
+
+    *result = static_cast<bsl::size_t>(encoder.length());
+    return 0;
+}
+
+Datum DatumViewUtil::toDatum(const DatumView&  view,
+                             bslma::Allocator *basicAllocator)
+{
+    BSLS_ASSERT(basicAllocator);
+
+    switch (view.type()) {
+      case Datum::e_NIL: {
+        return Datum::createNull();                                   // RETURN
+      }
+      case Datum::e_INTEGER: {
+        return Datum::createInteger(view.theInteger());               // RETURN
+      }
+      case Datum::e_DOUBLE: {
+        return Datum::createDouble(view.theDouble());                 // RETURN
+      }
+      case Datum::e_STRING: {
+        return Datum::copyString(view.theString(), basicAllocator);   // RETURN
+      }
+      case Datum::e_BOOLEAN: {
+        return Datum::createBoolean(view.theBoolean());               // RETURN
+      }
+      case Datum::e_ERROR: {
+        const DatumError error = view.theError();
+        return error.message().isEmpty()
+               ? Datum::createError(error.code())
+               : Datum::createError(error.code(),
+                                    error.message(),
+                                    basicAllocator);                  // RETURN
+      }
+      case Datum::e_DATE: {
+        return Datum::createDate(view.theDate());                     // RETURN
+      }
+      case Datum::e_TIME: {
+        return Datum::createTime(view.theTime());                     // RETURN
+      }
+      case Datum::e_DATETIME: {
+        return Datum::createDatetime(view.theDatetime(),
+                                     basicAllocator);                 // RETURN
+      }
+      case Datum::e_DATETIME_INTERVAL: {
+        return Datum::createDatetimeInterval(view.theDatetimeInterval(),
+                                             basicAllocator);         // RETURN
+      }
+      case Datum::e_INTEGER64: {
+        return Datum::createInteger64(view.theInteger64(),
+                                      basicAllocator);                // RETURN
+      }
+      case Datum::e_ARRAY: {
+        const DatumArrayView array = view.theArray();
+
+        DatumArrayBuilder builder(array.length(), basicAllocator);
+        for (DatumArrayView::SizeType i = 0; i < array.length(); ++i) {
+            builder.pushBack(toDatum(array[i], basicAllocator));
+        }
+        return builder.commit();                                      // RETURN
+      }
+      case Datum::e_MAP: {
+        const DatumMapView map = view.theMap();
+
+        DatumMapView::SizeType keysLength = 0;
+        for (DatumMapView::SizeType i = 0; i < map.size(); ++i) {
+            keysLength += map.key(i).length();
+        }
+
+        DatumMapOwningKeysBuilder builder(map.size(),
+                                          keysLength,
+                                          basicAllocator);
+        for (DatumMapView::SizeType i = 0; i < map.size(); ++i) {
+            builder.pushBack(map.key(i),
+                             toDatum(map.value(i), basicAllocator));
+        }
+        if (map.isSorted()) {
+            builder.setSorted(true);
+        }
+        return builder.commit();                                      // RETURN
+      }
+      case Datum::e_BINARY: {
+        const DatumBinaryRef binary = view.theBinary();
+        return Datum::copyBinary(binary.data(),
+                                 binary.size(),
+                                 basicAllocator);                     // RETURN
+      }
+      case Datum::e_DECIMAL64: {
+        return Datum::createDecimal64(view.theDecimal64(),
+                                      basicAllocator);                // RETURN
+      }
+      case Datum::e_INT_MAP: {
+        const DatumIntMapView map = view.theIntMap();
+
+        DatumIntMapBuilder builder(map.size(), basicAllocator);
+        for (DatumIntMapView::SizeType i = 0; i < map.size(); ++i) {
+            builder.pushBack(map.key(i),
+                             toDatum(map.value(i), basicAllocator));
+        }
+        if (map.isSorted()) {
+            builder.setSorted(true);
+        }
+        return builder.commit();                                      // RETURN
+      }
+      default: {
+        BSLS_ASSERT(!"User-defined values are never encoded");
+      }
+    }
+    return Datum::createNull();
+}
+
+int DatumViewUtil::view(DatumView   *result,
+                        const char  *buffer,
+                        bsl::size_t  length)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(buffer || 0 == length);
+
+    if (length < k_HEADER_LENGTH
+     || 0 != bsl::memcmp(buffer, k_MAGIC, sizeof k_MAGIC)
+     || k_VERSION != buffer[4]
+     || 0 != buffer[6]
+     || 0 != buffer[7]) {
+        return -1;                                                    // RETURN
+    }
+
+    Validator validator(buffer, length);
+    if (!validator.isValidValue(8, static_cast<unsigned char>(buffer[5]), 0)) {
+        return -2;                                                    // RETURN
+    }
+
+    *result = viewUnchecked(buffer);
+    return 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1152 @@
+// bdld_datumview.h                                                   -*-C++-*-
+#ifndef INCLUDED_BDLD_DATUMVIEW
+#define INCLUDED_BDLD_DATUMVIEW
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+//@PURPOSE: Provide a binary format for 'Datum' trees readable in place.
+//
+//@CLASSES:
+//  bdld::DatumView: non-modifiable view of an encoded 'Datum' value
+//  bdld::DatumArrayView: view of an encoded array of 'Datum' values
+//  bdld::DatumMapView: view of an encoded string-keyed map
+//  bdld::DatumIntMapView: view of an encoded integer-keyed map
+//  bdld::DatumViewUtil: utility to encode, validate, and decode 'Datum' trees
+//
+//@SEE_ALSO: bdld_datum, bdld_manageddatum
+//
+//@DESCRIPTION: This component provides a compact binary encoding of a tree of
+// 'bdld::Datum' values, a 'struct', 'bdld::DatumViewUtil', to produce and
+// check such encodings, and a set of lightweight, non-owning classes,
+// 'bdld::DatumView', 'bdld::DatumArrayView', 'bdld::DatumMapView', and
+// 'bdld::DatumIntMapView', that read the encoded values in place.
+//
+// All references inside an encoding are offsets relative to the location
+// holding them, so an encoding does not depend on the address at which it is
+// loaded: it can be written to a file, memory-mapped by another process, or
+// stored in a cache, and then read without being deserialized and without
+// allocating memory.  Accessing an element of an array, or a key of a map, is
+// a constant-time operation; looking up a key of a map marked as sorted is a
+// binary search, and a linear search otherwise.  'DatumViewUtil::toDatum'
+// converts a view (or any part of it) back to a 'Datum' when a copy is
+// required.
+//
+// Encoding is performed in two passes over the 'Datum' tree: the first
+// computes the exact length of the encoding, and the second writes it into a
+// buffer of that length.  No other memory is allocated.
+//
+// 'Datum' objects holding user-defined types ('Datum::e_USERDEFINED') cannot
+// be encoded, as their representation is opaque.  The hashed key index that
+// may be associated with a 'Datum' map is not part of the encoding.
+//
+///Validation
+///----------
+// 'DatumViewUtil::view' verifies that every offset and length in an encoding
+// refers to memory within the supplied buffer, that all type tags are known,
+// that all date and time values are in range, and that the keys of maps
+// flagged as sorted are sorted, before providing a view of the encoding.  The
+// verification visits every value once, and its running time is linear in the
+// length of the buffer.  To that end, encodings in which the keys of a sorted
+// map overlap so much that verifying their order would compare more bytes than
+// the buffer holds are rejected (this never happens for encodings produced by
+// 'encode').  Once verified, the encoding can be read through the view without
+// further checks.  Data from trusted sources (e.g., produced by 'encode' in
+// the same process) may be viewed without verification using
+// 'DatumViewUtil::viewUnchecked'.  Encodings are also rejected if values are
+// nested more deeply than 'DatumViewUtil::k_MAX_NESTING_DEPTH'.
+//
+///Encoding Format
+///---------------
+// All integers are stored in little-endian byte order.  A "payload" is an
+// 8-byte value whose content depends on the type of the value it encodes; the
+// type of each payload is held in a separate 1-byte tag having the value of
+// the corresponding 'Datum::DataType' enumerator.  Where a payload refers to
+// out-of-line data, the low 32 bits of the payload hold a length or count and
+// the high 32 bits hold the offset of the data from the address of the
+// payload itself.  An encoding is laid out as follows:
+//..
+//  offset  size  content
+//  ------  ----  -------------------------------------------------------
+//       0     4  magic bytes "BDDV"
+//       4     1  format version (currently 1)
+//       5     1  tag of the top-level value
+//       6     2  zero
+//       8     8  payload of the top-level value
+//      16        out-of-line data
+//..
+// Out-of-line data holding payloads starts at an offset that is a multiple of
+// 8 from the start of the encoding.  Payloads are encoded as follows:
+//..
+//  type               payload
+//  -----------------  ------------------------------------------------------
+//  NIL                zero
+//  INTEGER            the value, sign-extended to 64 bits
+//  DOUBLE             the IEEE-754 representation of the value
+//  STRING             length | offset of the characters
+//  BOOLEAN            1 for 'true', 0 for 'false'
+//  ERROR              code | offset of a 32-bit message length followed by the
+//                     characters of the message, or zero if there is no
+//                     message
+//  DATE               number of days since 0001/01/01
+//  TIME               number of microseconds since midnight, 86400000000 for
+//                     the default value (24:00:00.000000)
+//  DATETIME           (date as for DATE << 37) | (time as for TIME)
+//  DATETIME_INTERVAL  zero | offset of a 64-bit number of days followed by a
+//                     64-bit number of microseconds in the fractional day
+//  INTEGER64          the value
+//  ARRAY              count | offset of 'count' tags, padded with zeros to a
+//                     multiple of 8, followed by 'count' payloads
+//  MAP                count | offset of a 64-bit flag word (bit 0 set if the
+//                     map is sorted), 'count' key references (length |
+//                     offset of the characters from the reference), 'count'
+//                     tags padded to a multiple of 8, 'count' payloads, and
+//                     the characters of the keys
+//  BINARY             length | offset of the bytes
+//  DECIMAL64          the Binary Integer Decimal (BID) representation
+//  INT_MAP            count | offset of a 64-bit flag word (as for MAP),
+//                     'count' 32-bit keys padded with zeros to a multiple of
+//                     8, 'count' tags padded to a multiple of 8, and 'count'
+//                     payloads
+//..
+// Note that empty strings, binary values, arrays, and maps have a zero offset.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sharing a 'Datum' Tree Through a Buffer
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose a service publishes records, represented as 'Datum' maps, to a
+// shared memory segment, and its clients look up individual fields of those
+// records.
+//
+// First, we create a record:
+//..
+//  bslma::TestAllocator ta;
+//
+//  bdld::DatumMapEntry entries[] = {
+//      bdld::DatumMapEntry("name",  bdld::Datum::createStringRef("IBM", &ta)),
+//      bdld::DatumMapEntry("price", bdld::Datum::createDouble(137.25)),
+//      bdld::DatumMapEntry("size",  bdld::Datum::createInteger(400)),
+//  };
+//  const int NUM_ENTRIES = sizeof entries / sizeof *entries;
+//
+//  bdld::DatumMutableMapRef mapRef;
+//  bdld::Datum::createUninitializedMap(&mapRef, NUM_ENTRIES, &ta);
+//  for (int i = 0; i < NUM_ENTRIES; ++i) {
+//      mapRef.data()[i] = entries[i];
+//  }
+//  *mapRef.size()   = NUM_ENTRIES;
+//  *mapRef.sorted() = true;
+//
+//  bdld::ManagedDatum record(bdld::Datum::adoptMap(mapRef), &ta);
+//..
+// Then, the service encodes the record into a buffer (which, in practice,
+// would reside in the shared memory segment):
+//..
+//  bsl::vector<char> buffer(&ta);
+//  int rc = bdld::DatumViewUtil::encode(&buffer, record);
+//  assert(0 == rc);
+//..
+// Next, a client, having received the buffer, verifies it and obtains a view
+// of the record.  Note that no memory is allocated to do so:
+//..
+//  bslma::TestAllocatorMonitor tam(&ta);
+//
+//  bdld::DatumView view;
+//  rc = bdld::DatumViewUtil::view(&view, buffer.data(), buffer.size());
+//  assert(0 == rc);
+//  assert(view.isMap());
+//  assert(3 == view.theMap().size());
+//..
+// Then, the client looks up the fields it is interested in:
+//..
+//  bdld::DatumView price;
+//  assert(true   == view.theMap().find(&price, "price"));
+//  assert(137.25 == price.theDouble());
+//
+//  bdld::DatumView name;
+//  assert(true   == view.theMap().find(&name, "name"));
+//  assert("IBM"  == name.theString());
+//
+//  assert(tam.isTotalSame());
+//..
+// Finally, the client makes a 'Datum' copy of the record that outlives the
+// buffer:
+//..
+//  bdld::ManagedDatum copy(bdld::DatumViewUtil::toDatum(view, &ta), &ta);
+//  assert(copy == record);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdld_datum.h>
+#include <bdld_datumbinaryref.h>
+#include <bdld_datumerror.h>
+#include <bdld_manageddatum.h>
+
+#include <bdldfp_decimal.h>
+
+#include <bdlb_printmethods.h>
+
+#include <bdlt_date.h>
+#include <bdlt_datetime.h>
+#include <bdlt_datetimeinterval.h>
+#include <bdlt_time.h>
+
+#include <bslma_allocator.h>
+
+#include <bslmf_istriviallycopyable.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_byteorderutil.h>
+#include <bsls_platform.h>
+#include <bsls_review.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstring.h>
+#include <bsl_iosfwd.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdld {
+
+class DatumArrayView;
+class DatumIntMapView;
+class DatumMapView;
+
+                          // ========================
+                          // struct DatumView_ImpUtil
+                          // ========================
+
+struct DatumView_ImpUtil {
+    // [!PRIVATE!] This 'struct' provides a namespace for functions reading
+    // the little-endian integers of an encoding.
+
+    // CLASS METHODS
+    static unsigned int loadUint32(const char *address);
+        // Return the 32-bit unsigned integer stored in little-endian byte
+        // order at the specified 'address'.
+
+    static bsls::Types::Uint64 loadUint64(const char *address);
+        // Return the 64-bit unsigned integer stored in little-endian byte
+        // order at the specified 'address'.
+};
+
+                              // ===============
+                              // class DatumView
+                              // ===============
+
+class DatumView {
+    // This class provides a non-modifiable, non-owning view of a value in a
+    // buffer encoded by 'DatumViewUtil'.  A 'DatumView' is valid as long as
+    // the buffer it refers to is neither modified nor destroyed.  The
+    // accessors of this class mirror those of 'Datum'.
+
+  public:
+    // TYPES
+    typedef bsls::Types::size_type SizeType;
+        // 'SizeType' is an alias for an unsigned integral value, representing
+        // the capacity of a view of an array or a map.
+
+  private:
+    // DATA
+    const char    *d_payload_p;  // address of the payload (not owned)
+    unsigned char  d_type;       // 'Datum::DataType' of the value
+
+    // FRIENDS
+    friend class DatumArrayView;
+    friend class DatumIntMapView;
+    friend class DatumMapView;
+    friend struct DatumViewUtil;
+
+    // PRIVATE CREATORS
+    DatumView(const char *payload, unsigned char type);
+        // Create a view of the value of the specified 'type' whose payload is
+        // at the specified 'payload' address.
+
+    // PRIVATE ACCESSORS
+    const char *outOfLineData() const;
+        // Return the address of the out-of-line data referred to by the
+        // payload of this view.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(DatumView, bsl::is_trivially_copyable);
+    BSLMF_NESTED_TRAIT_DECLARATION(DatumView, bdlb::HasPrintMethod);
+
+    // CREATORS
+    DatumView();
+        // Create a view of a null value.
+
+    //! DatumView(const DatumView& original) = default;
+    //! ~DatumView() = default;
+
+    // MANIPULATORS
+    //! DatumView& operator=(const DatumView& rhs) = default;
+
+    // ACCESSORS
+    bool isArray() const;
+        // Return 'true' if this view refers to an array, and 'false'
+        // otherwise.
+
+    bool isBinary() const;
+        // Return 'true' if this view refers to a binary value, and 'false'
+        // otherwise.
+
+    bool isBoolean() const;
+        // Return 'true' if this view refers to a boolean value, and 'false'
+        // otherwise.
+
+    bool isDate() const;
+        // Return 'true' if this view refers to a 'bdlt::Date' value, and
+        // 'false' otherwise.
+
+    bool isDatetime() const;
+        // Return 'true' if this view refers to a 'bdlt::Datetime' value, and
+        // 'false' otherwise.
+
+    bool isDatetimeInterval() const;
+        // Return 'true' if this view refers to a 'bdlt::DatetimeInterval'
+        // value, and 'false' otherwise.
+
+    bool isDecimal64() const;
+        // Return 'true' if this view refers to a 'bdldfp::Decimal64' value,
+        // and 'false' otherwise.
+
+    bool isDouble() const;
+        // Return 'true' if this view refers to a 'double' value, and 'false'
+        // otherwise.
+
+    bool isError() const;
+        // Return 'true' if this view refers to a 'DatumError' value, and
+        // 'false' otherwise.
+
+    bool isInteger() const;
+        // Return 'true' if this view refers to an integer value, and 'false'
+        // otherwise.
+
+    bool isInteger64() const;
+        // Return 'true' if this view refers to a 64-bit integer value, and
+        // 'false' otherwise.
+
+    bool isIntMap() const;
+        // Return 'true' if this view refers to an integer-keyed map, and
+        // 'false' otherwise.
+
+    bool isMap() const;
+        // Return 'true' if this view refers to a string-keyed map, and
+        // 'false' otherwise.
+
+    bool isNull() const;
+        // Return 'true' if this view refers to a null value, and 'false'
+        // otherwise.
+
+    bool isString() const;
+        // Return 'true' if this view refers to a string value, and 'false'
+        // otherwise.
+
+    bool isTime() const;
+        // Return 'true' if this view refers to a 'bdlt::Time' value, and
+        // 'false' otherwise.
+
+    DatumArrayView theArray() const;
+        // Return a view of the array referred to by this view.  The behavior
+        // is undefined unless this view refers to an array.
+
+    DatumBinaryRef theBinary() const;
+        // Return a reference to the binary value referred to by this view.
+        // The behavior is undefined unless this view refers to a binary
+        // value.
+
+    bool theBoolean() const;
+        // Return the boolean value referred to by this view.  The behavior is
+        // undefined unless this view refers to a boolean value.
+
+    bdlt::Date theDate() const;
+        // Return the date value referred to by this view.  The behavior is
+        // undefined unless this view refers to a date value.
+
+    bdlt::Datetime theDatetime() const;
+        // Return the datetime value referred to by this view.  The behavior
+        // is undefined unless this view refers to a datetime value.
+
+    bdlt::DatetimeInterval theDatetimeInterval() const;
+        // Return the datetime interval value referred to by this view.  The
+        // behavior is undefined unless this view refers to a datetime
+        // interval value.
+
+    bdldfp::Decimal64 theDecimal64() const;
+        // Return the decimal value referred to by this view.  The behavior is
+        // undefined unless this view refers to a 'Decimal64' value.
+
+    double theDouble() const;
+        // Return the 'double' value referred to by this view.  The behavior
+        // is undefined unless this view refers to a 'double' value.
+
+    DatumError theError() const;
+        // Return the error value referred to by this view.  The behavior is
+        // undefined unless this view refers to an error value.  Note that the
+        // message of the returned object refers to the encoded buffer.
+
+    int theInteger() const;
+        // Return the integer value referred to by this view.  The behavior is
+        // undefined unless this view refers to an integer value.
+
+    bsls::Types::Int64 theInteger64() const;
+        // Return the 64-bit integer value referred to by this view.  The
+        // behavior is undefined unless this view refers to a 64-bit integer
+        // value.
+
+    DatumIntMapView theIntMap() const;
+        // Return a view of the integer-keyed map referred to by this view.
+        // The behavior is undefined unless this view refers to an
+        // integer-keyed map.
+
+    DatumMapView theMap() const;
+        // Return a view of the string-keyed map referred to by this view.
+        // The behavior is undefined unless this view refers to a string-keyed
+        // map.
+
+    bslstl::StringRef theString() const;
+        // Return a reference to the string value referred to by this view.
+        // The behavior is undefined unless this view refers to a string
+        // value.
+
+    bdlt::Time theTime() const;
+        // Return the time value referred to by this view.  The behavior is
+        // undefined unless this view refers to a time value.
+
+    Datum::DataType type() const;
+        // Return the type of the value referred to by this view.
+
+    bsl::ostream& print(bsl::ostream& stream,
+                        int           level          = 0,
+                        int           spacesPerLevel = 4) const;
+        // Write the value referred to by this view to the specified output
+        // 'stream' in the same human-readable format as 'Datum::print', and
+        // return a reference to the modifiable 'stream'.  Optionally specify
+        // an initial indentation 'level', whose absolute value is incremented
+        // recursively for nested objects.  If 'level' is specified,
+        // optionally specify 'spacesPerLevel', whose absolute value indicates
+        // the number of spaces per indentation level for this and all of its
+        // nested objects.  If 'level' is negative, suppress indentation of
+        // the first line.  If 'spacesPerLevel' is negative, format the entire
+        // output on one line, suppressing all but the initial indentation (as
+        // governed by 'level').  If 'stream' is not valid on entry, this
+        // operation has no effect.
+};
+
+// FREE OPERATORS
+bsl::ostream& operator<<(bsl::ostream& stream, const DatumView& rhs);
+    // Write the value referred to by the specified 'rhs' to the specified
+    // output 'stream' in a single-line format, and return a reference to the
+    // modifiable 'stream'.
+
+                            // ====================
+                            // class DatumArrayView
+                            // ====================
+
+class DatumArrayView {
+    // This class provides a non-modifiable, non-owning view of an encoded
+    // array of values.
+
+  public:
+    // TYPES
+    typedef DatumView::SizeType SizeType;
+
+  private:
+    // DATA
+    const char *d_tags_p;      // address of the tags of the elements
+    const char *d_payloads_p;  // address of the payloads of the elements
+    SizeType    d_length;      // number of elements
+
+    // FRIENDS
+    friend class DatumView;
+
+    // PRIVATE CREATORS
+    DatumArrayView(const char *block, SizeType length);
+        // Create a view of the array having the specified 'length' whose
+        // out-of-line data starts at the specified 'block' address.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(DatumArrayView,
+                                   bsl::is_trivially_copyable);
+    BSLMF_NESTED_TRAIT_DECLARATION(DatumArrayView, bdlb::HasPrintMethod);
+
+    // CREATORS
+    DatumArrayView();
+        // Create a view of an empty array.
+
+    // ACCESSORS
+    DatumView operator[](SizeType index) const;
+        // Return a view of the element at the specified 'index' in the array.
+        // The behavior is undefined unless 'index < length()'.
+
+    SizeType length() const;
+        // Return the number of elements in the array.
+
+    bsl::ostream& print(bsl::ostream& stream,
+                        int           level          = 0,
+                        int           spacesPerLevel = 4) const;
+        // Write the elements of the array to the specified output 'stream' in
+        // the same human-readable format as 'DatumArrayRef::print', and
+        // return a reference to the modifiable 'stream'.  See
+        // 'DatumView::print' for the meaning of the optionally specified
+        // 'level' and 'spacesPerLevel'.
+};
+
+                             // ==================
+                             // class DatumMapView
+                             // ==================
+
+class DatumMapView {
+    // This class provides a non-modifiable, non-owning view of an encoded
+    // string-keyed map.
+
+  public:
+    // TYPES
+    typedef DatumView::SizeType SizeType;
+
+  private:
+    // DATA
+    const char *d_keys_p;      // address of the key references
+    const char *d_tags_p;      // address of the tags of the values
+    const char *d_payloads_p;  // address of the payloads of the values
+    SizeType    d_size;        // number of entries
+    bool        d_sorted;      // 'true' if the keys are sorted
+
+    // FRIENDS
+    friend class DatumView;
+
+    // PRIVATE CREATORS
+    DatumMapView(const char *block, SizeType size);
+        // Create a view of the map having the specified 'size' whose
+        // out-of-line data starts at the specified 'block' address.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(DatumMapView, bsl::is_trivially_copyable);
+    BSLMF_NESTED_TRAIT_DECLARATION(DatumMapView, bdlb::HasPrintMethod);
+
+    // CREATORS
+    DatumMapView();
+        // Create a view of an empty map.
+
+    // ACCESSORS
+    bool find(DatumView *result, const bslstl::StringRef& key) const;
+        // Load into the specified 'result' a view of the value of the entry
+        // having the specified 'key' and return 'true' if such an entry
+        // exists, and return 'false' with no effect on 'result' otherwise.
+        // If the map has more than one entry having 'key', it is unspecified
+        // which of them is found.  Note that the search is a binary search if
+        // the map is sorted, and a linear search otherwise.
+
+    bool isSorted() const;
+        // Return 'true' if the entries of the map are sorted by key, and
+        // 'false' otherwise.
+
+    bslstl::StringRef key(SizeType index) const;
+        // Return a reference to the key of the entry at the specified 'index'
+        // in the map.  The behavior is undefined unless 'index < size()'.
+
+    SizeType size() const;
+        // Return the number of entries in the map.
+
+    DatumView value(SizeType index) const;
+        // Return a view of the value of the entry at the specified 'index' in
+        // the map.  The behavior is undefined unless 'index < size()'.
+
+    bsl::ostream& print(bsl::ostream& stream,
+                        int           level          = 0,
+                        int           spacesPerLevel = 4) const;
+        // Write the entries of the map to the specified output 'stream' in a
+        // human-readable format, and return a reference to the modifiable
+        // 'stream'.  See 'DatumView::print' for the meaning of the optionally
+        // specified 'level' and 'spacesPerLevel'.
+};
+
+                           // =====================
+                           // class DatumIntMapView
+                           // =====================
+
+class DatumIntMapView {
+    // This class provides a non-modifiable, non-owning view of an encoded
+    // integer-keyed map.
+
+  public:
+    // TYPES
+    typedef DatumView::SizeType SizeType;
+
+  private:
+    // DATA
+    const char *d_keys_p;      // address of the keys
+    const char *d_tags_p;      // address of the tags of the values
+    const char *d_payloads_p;  // address of the payloads of the values
+    SizeType    d_size;        // number of entries
+    bool        d_sorted;      // 'true' if the keys are sorted
+
+    // FRIENDS
+    friend class DatumView;
+
+    // PRIVATE CREATORS
+    DatumIntMapView(const char *block, SizeType size);
+        // Create a view of the map having the specified 'size' whose
+        // out-of-line data starts at the specified 'block' address.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(DatumIntMapView,
+                                   bsl::is_trivially_copyable);
+    BSLMF_NESTED_TRAIT_DECLARATION(DatumIntMapView, bdlb::HasPrintMethod);
+
+    // CREATORS
+    DatumIntMapView();
+        // Create a view of an empty map.
+
+    // ACCESSORS
+    bool find(DatumView *result, int key) const;
+        // Load into the specified 'result' a view of the value of the entry
+        // having the specified 'key' and return 'true' if such an entry
+        // exists, and return 'false' with no effect on 'result' otherwise.
+        // If the map has more than one entry having 'key', it is unspecified
+        // which of them is found.  Note that the search is a binary search if
+        // the map is sorted, and a linear search otherwise.
+
+    bool isSorted() const;
+        // Return 'true' if the entries of the map are sorted by key, and
+        // 'false' otherwise.
+
+    int key(SizeType index) const;
+        // Return the key of the entry at the specified 'index' in the map.
+        // The behavior is undefined unless 'index < size()'.
+
+    SizeType size() const;
+        // Return the number of entries in the map.
+
+    DatumView value(SizeType index) const;
+        // Return a view of the value of the entry at the specified 'index' in
+        // the map.  The behavior is undefined unless 'index < size()'.
+
+    bsl::ostream& print(bsl::ostream& stream,
+                        int           level          = 0,
+                        int           spacesPerLevel = 4) const;
+        // Write the entries of the map to the specified output 'stream' in a
+        // human-readable format, and return a reference to the modifiable
+        // 'stream'.  See 'DatumView::print' for the meaning of the optionally
+        // specified 'level' and 'spacesPerLevel'.
+};
+
+                            // ====================
+                            // struct DatumViewUtil
+                            // ====================
+
+struct DatumViewUtil {
+    // This 'struct' provides a namespace for functions that encode 'Datum'
+    // trees in the format described in the component documentation, verify
+    // such encodings, and convert them back to 'Datum' objects.
+
+    // PUBLIC CLASS DATA
+    enum {
+        k_HEADER_LENGTH     =  16,  // length of the fixed-size header
+
+        k_MAX_NESTING_DEPTH = 512   // maximum depth of nested arrays and maps
+                                    // in an encoding
+    };
+
+    // CLASS METHODS
+    static int encode(char *buffer, bsl::size_t length, const Datum& datum);
+        // Encode the specified 'datum' into the specified 'buffer' of the
+        // specified 'length'.  Return 0 on success, and a non-zero value
+        // (with the contents of 'buffer' unspecified) if 'datum' cannot be
+        // encoded.  The behavior is undefined unless 'length' is the value
+        // loaded by a successful call to 'encodedLength' for 'datum'.
+
+    static int encode(bsl::vector<char> *result, const Datum& datum);
+    static int encode(bsl::vector<char> *result, const ManagedDatum& datum);
+        // Load into the specified 'result' the encoding of the specified
+        // 'datum'.  Return 0 on success, and a non-zero value with no effect
+        // on 'result' if 'datum' cannot be encoded, i.e., if it contains a
+        // user-defined value, has values nested more deeply than
+        // 'k_MAX_NESTING_DEPTH', or its encoding would be 4GB or longer.
+
+    static int encodedLength(bsl::size_t *result, const Datum& datum);
+        // Load into the specified 'result' the length of the encoding of the
+        // specified 'datum'.  Return 0 on success, and a non-zero value with
+        // no effect on 'result' if 'datum' cannot be encoded.
+
+    static Datum toDatum(const DatumView&  view,
+                         bslma::Allocator *basicAllocator);
+        // Return a 'Datum' having the value referred to by the specified
+        // 'view', using the specified 'basicAllocator' to supply memory.  The
+        // returned 'Datum' does not refer to the encoded buffer; it must be
+        // released by calling 'Datum::destroy' with 'basicAllocator'.  Maps
+        // are created as maps owning their keys.
+
+    static int view(DatumView   *result,
+                    const char  *buffer,
+                    bsl::size_t  length);
+        // Load into the specified 'result' a view of the top-level value
+        // encoded in the specified 'buffer' of the specified 'length'.
+        // Return 0 on success, and a non-zero value with no effect on
+        // 'result' if 'buffer' does not hold a valid encoding.  Note that the
+        // verification performed is described in the "Validation" section of
+        // the component documentation.
+
+    static DatumView viewUnchecked(const char *buffer);
+        // Return a view of the top-level value encoded in the specified
+        // 'buffer' without verifying the encoding.  The behavior is undefined
+        // unless 'buffer' holds a valid encoding.
+};
+
+// ============================================================================
+//                           INLINE DEFINITIONS
+// ============================================================================
+
+                          // ------------------------
+                          // struct DatumView_ImpUtil
+                          // ------------------------
+
+// CLASS METHODS
+inline
+unsigned int DatumView_ImpUtil::loadUint32(const char *address)
+{
+    unsigned int result;
+    bsl::memcpy(&result, address, sizeof result);
+#if defined(BSLS_PLATFORM_IS_BIG_ENDIAN)
+    result = bsls::ByteOrderUtil::swapBytes(result);
+#endif
+    return result;
+}
+
+inline
+bsls::Types::Uint64 DatumView_ImpUtil::loadUint64(const char *address)
+{
+    bsls::Types::Uint64 result;
+    bsl::memcpy(&result, address, sizeof result);
+#if defined(BSLS_PLATFORM_IS_BIG_ENDIAN)
+    result = bsls::ByteOrderUtil::swapBytes(result);
+#endif
+    return result;
+}
+
+                              // ---------------
+                              // class DatumView
+                              // ---------------
+
+// PRIVATE CREATORS
+inline
+DatumView::DatumView(const char *payload, unsigned char type)
+: d_payload_p(payload)
+, d_type(type)
+{
+}
+
+// PRIVATE ACCESSORS
+inline
+const char *DatumView::outOfLineData() const
+{
+    return d_payload_p + DatumView_ImpUtil::loadUint32(d_payload_p + 4);
+}
+
+// CREATORS
+inline
+DatumView::DatumView()
+: d_payload_p(0)
+, d_type(Datum::e_NIL)
+{
+}
+
+// ACCESSORS
+inline
+bool DatumView::isArray() const
+{
+    return Datum::e_ARRAY == d_type;
+}
+
+inline
+bool DatumView::isBinary() const
+{
+    return Datum::e_BINARY == d_type;
+}
+
+inline
+bool DatumView::isBoolean() const
+{
+    return Datum::e_BOOLEAN == d_type;
+}
+
+inline
+bool DatumView::isDate() const
+{
+    return Datum::e_DATE == d_type;
+}
+
+inline
+bool DatumView::isDatetime() const
+{
+    return Datum::e_DATETIME == d_type;
+}
+
+inline
+bool DatumView::isDatetimeInterval() const
+{
+    return Datum::e_DATETIME_INTERVAL == d_type;
+}
+
+inline
+bool DatumView::isDecimal64() const
+{
+    return Datum::e_DECIMAL64 == d_type;
+}
+
+inline
+bool DatumView::isDouble() const
+{
+    return Datum::e_DOUBLE == d_type;
+}
+
+inline
+bool DatumView::isError() const
+{
+    return Datum::e_ERROR == d_type;
+}
+
+inline
+bool DatumView::isInteger() const
+{
+    return Datum::e_INTEGER == d_type;
+}
+
+inline
+bool DatumView::isInteger64() const
+{
+    return Datum::e_INTEGER64 == d_type;
+}
+
+inline
+bool DatumView::isIntMap() const
+{
+    return Datum::e_INT_MAP == d_type;
+}
+
+inline
+bool DatumView::isMap() const
+{
+    return Datum::e_MAP == d_type;
+}
+
+inline
+bool DatumView::isNull() const
+{
+    return Datum::e_NIL == d_type;
+}
+
+inline
+bool DatumView::isString() const
+{
+    return Datum::e_STRING == d_type;
+}
+
+inline
+bool DatumView::isTime() const
+{
+    return Datum::e_TIME == d_type;
+}
+
+inline
+DatumArrayView DatumView::theArray() const
+{
+    BSLS_ASSERT(isArray());
+
+    const SizeType length = DatumView_ImpUtil::loadUint32(d_payload_p);
+    return length ? DatumArrayView(outOfLineData(), length)
+                  : DatumArrayView();
+}
+
+inline
+DatumBinaryRef DatumView::theBinary() const
+{
+    BSLS_ASSERT(isBinary());
+
+    return DatumBinaryRef(outOfLineData(),
+                          DatumView_ImpUtil::loadUint32(d_payload_p));
+}
+
+inline
+bool DatumView::theBoolean() const
+{
+    BSLS_ASSERT(isBoolean());
+
+    return 0 != DatumView_ImpUtil::loadUint64(d_payload_p);
+}
+
+inline
+double DatumView::theDouble() const
+{
+    BSLS_ASSERT(isDouble());
+
+    const bsls::Types::Uint64 bits =
+                                    DatumView_ImpUtil::loadUint64(d_payload_p);
+    double result;
+    bsl::memcpy(&result, &bits, sizeof result);
+    return result;
+}
+
+inline
+int DatumView::theInteger() const
+{
+    BSLS_ASSERT(isInteger());
+
+    return static_cast<int>(DatumView_ImpUtil::loadUint64(d_payload_p));
+}
+
+inline
+bsls::Types::Int64 DatumView::theInteger64() const
+{
+    BSLS_ASSERT(isInteger64());
+
+    return static_cast<bsls::Types::Int64>(
+                                   DatumView_ImpUtil::loadUint64(d_payload_p));
+}
+
+inline
+DatumIntMapView DatumView::theIntMap() const
+{
+    BSLS_ASSERT(isIntMap());
+
+    const SizeType size = DatumView_ImpUtil::loadUint32(d_payload_p);
+    return size ? DatumIntMapView(outOfLineData(), size) : DatumIntMapView();
+}
+
+inline
+DatumMapView DatumView::theMap() const
+{
+    BSLS_ASSERT(isMap());
+
+    const SizeType size = DatumView_ImpUtil::loadUint32(d_payload_p);
+    return size ? DatumMapView(outOfLineData(), size) : DatumMapView();
+}
+
+inline
+bslstl::StringRef DatumView::theString() const
+{
+    BSLS_ASSERT(isString());
+
+    return bslstl::StringRef(outOfLineData(),
+                             DatumView_ImpUtil::loadUint32(d_payload_p));
+}
+
+inline
+Datum::DataType DatumView::type() const
+{
+    return static_cast<Datum::DataType>(d_type);
+}
+
+                            // --------------------
+                            // class DatumArrayView
+                            // --------------------
+
+// PRIVATE CREATORS
+inline
+DatumArrayView::DatumArrayView(const char *block, SizeType length)
+: d_tags_p(block)
+, d_payloads_p(block + ((length + 7) & ~static_cast<SizeType>(7)))
+, d_length(length)
+{
+}
+
+// CREATORS
+inline
+DatumArrayView::DatumArrayView()
+: d_tags_p(0)
+, d_payloads_p(0)
+, d_length(0)
+{
+}
+
+// ACCESSORS
+inline
+DatumView DatumArrayView::operator[](SizeType index) const
+{
+    BSLS_ASSERT(index < d_length);
+
+    return DatumView(d_payloads_p + 8 * index,
+                     static_cast<unsigned char>(d_tags_p[index]));
+}
+
+inline
+DatumArrayView::SizeType DatumArrayView::length() const
+{
+    return d_length;
+}
+
+                             // ------------------
+                             // class DatumMapView
+                             // ------------------
+
+// PRIVATE CREATORS
+inline
+DatumMapView::DatumMapView(const char *block, SizeType size)
+: d_keys_p(block + 8)
+, d_tags_p(block + 8 + 8 * size)
+, d_payloads_p(block + 8 + 8 * size
+                                  + ((size + 7) & ~static_cast<SizeType>(7)))
+, d_size(size)
+, d_sorted(0 != (DatumView_ImpUtil::loadUint64(block) & 1))
+{
+}
+
+// CREATORS
+inline
+DatumMapView::DatumMapView()
+: d_keys_p(0)
+, d_tags_p(0)
+, d_payloads_p(0)
+, d_size(0)
+, d_sorted(false)
+{
+}
+
+// ACCESSORS
+inline
+bool DatumMapView::isSorted() const
+{
+    return d_sorted;
+}
+
+inline
+bslstl::StringRef DatumMapView::key(SizeType index) const
+{
+    BSLS_ASSERT(index < d_size);
+
+    const char *ref = d_keys_p + 8 * index;
+    return bslstl::StringRef(ref + DatumView_ImpUtil::loadUint32(ref + 4),
+                             DatumView_ImpUtil::loadUint32(ref));
+}
+
+inline
+DatumMapView::SizeType DatumMapView::size() const
+{
+    return d_size;
+}
+
+inline
+DatumView DatumMapView::value(SizeType index) const
+{
+    BSLS_ASSERT(index < d_size);
+
+    return DatumView(d_payloads_p + 8 * index,
+                     static_cast<unsigned char>(d_tags_p[index]));
+}
+
+                           // ---------------------
+                           // class DatumIntMapView
+                           // ---------------------
+
+// PRIVATE CREATORS
+inline
+DatumIntMapView::DatumIntMapView(const char *block, SizeType size)
+: d_keys_p(block + 8)
+, d_tags_p(block + 8 + ((4 * size + 7) & ~static_cast<SizeType>(7)))
+, d_payloads_p(d_tags_p + ((size + 7) & ~static_cast<SizeType>(7)))
+, d_size(size)
+, d_sorted(0 != (DatumView_ImpUtil::loadUint64(block) & 1))
+{
+}
+
+// CREATORS
+inline
+DatumIntMapView::DatumIntMapView()
+: d_keys_p(0)
+, d_tags_p(0)
+, d_payloads_p(0)
+, d_size(0)
+, d_sorted(false)
+{
+}
+
+// ACCESSORS
+inline
+bool DatumIntMapView::isSorted() const
+{
+    return d_sorted;
+}
+
+inline
+int DatumIntMapView::key(SizeType index) const
+{
+    BSLS_ASSERT(index < d_size);
+
+    return static_cast<int>(
+                         DatumView_ImpUtil::loadUint32(d_keys_p + 4 * index));
+}
+
+inline
+DatumIntMapView::SizeType DatumIntMapView::size() const
+{
+    return d_size;
+}
+
+inline
+DatumView DatumIntMapView::value(SizeType index) const
+{
+    BSLS_ASSERT(index < d_size);
+
+    return DatumView(d_payloads_p + 8 * index,
+                     static_cast<unsigned char>(d_tags_p[index]));
+}
+
+                            // --------------------
+                            // struct DatumViewUtil
+                            // --------------------
+
+// CLASS METHODS
+inline
+int DatumViewUtil::encode(bsl::vector<char>   *result,
+                          const ManagedDatum&  datum)
+{
+    return encode(result, datum.datum());
+}
+
+inline
+DatumView DatumViewUtil::viewUnchecked(const char *buffer)
+{
+    BSLS_ASSERT(buffer);
+
+    return DatumView(buffer + 8, static_cast<unsigned char>(buffer[5]));
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+inline
+bsl::ostream& bdld::operator<<(bsl::ostream& stream, const DatumView& rhs)
+{
+    return rhs.print(stream, 0, -1);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1905 @@
+// bdld_datumview.t.cpp                                               -*-C++-*-
+#include <bdld_datumview.h>
+
+#include <bdld_datum.h>
+#include <bdld_datumarraybuilder.h>
+#include <bdld_datumintmapbuilder.h>
+#include <bdld_datummapbuilder.h>
+#include <bdld_datummapowningkeysbuilder.h>
+#include <bdld_manageddatum.h>
+
+#include <bdldfp_decimal.h>
+
+#include <bdlt_date.h>
+#include <bdlt_datetime.h>
+#include <bdlt_datetimeinterval.h>
+#include <bdlt_time.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_climits.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace BloombergLP::bdld;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test provides a binary encoding of 'Datum' trees, a
+// utility to produce, verify, and decode it, and view classes reading it in
+// place.  The encoding is tested by round trips: every kind of value is
+// encoded, viewed, compared with the original through the accessors of the
+// views, and converted back to a 'Datum' equal to the original.  Verification
+// is tested by corrupting valid encodings (truncation, byte flips, and crafted
+// buffers) and checking that 'view' rejects them or yields a view that can be
+// traversed safely.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 4] int encode(char *, bsl::size_t, const Datum&);
+// [ 2] int encode(bsl::vector<char> *, const Datum&);
+// [ 4] int encode(bsl::vector<char> *, const ManagedDatum&);
+// [ 4] int encodedLength(bsl::size_t *, const Datum&);
+// [ 2] Datum toDatum(const DatumView&, bslma::Allocator *);
+// [ 5] int view(DatumView *, const char *, bsl::size_t);
+// [ 2] DatumView viewUnchecked(const char *);
+//
+// DatumView
+// [ 2] DatumView();
+// [ 2] bool is*() const;
+// [ 2] the*() const;
+// [ 2] Datum::DataType type() const;
+// [ 6] bsl::ostream& print(bsl::ostream&, int, int) const;
+// [ 6] bsl::ostream& operator<<(bsl::ostream&, const DatumView&);
+//
+// DatumArrayView
+// [ 3] DatumView operator[](SizeType) const;
+// [ 3] SizeType length() const;
+//
+// DatumMapView
+// [ 3] bool find(DatumView *, const bslstl::StringRef&) const;
+// [ 3] bool isSorted() const;
+// [ 3] bslstl::StringRef key(SizeType) const;
+// [ 3] SizeType size() const;
+// [ 3] DatumView value(SizeType) const;
+//
+// DatumIntMapView
+// [ 3] bool find(DatumView *, int) const;
+// [ 3] bool isSorted() const;
+// [ 3] int key(SizeType) const;
+// [ 3] SizeType size() const;
+// [ 3] DatumView value(SizeType) const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE OF ENCODING AND LOOKUP
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef DatumViewUtil      Util;
+typedef bsls::Types::Int64 Int64;
+
+// ============================================================================
+//               GLOBAL HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+const int NUM_SCALARS = 33;
+
+bsl::size_t readUint32(const bsl::vector<char>& buffer, bsl::size_t offset)
+    // Return the little-endian 32-bit unsigned integer at the specified
+    // 'offset' in the specified 'buffer'.
+{
+    bsl::size_t result = 0;
+    for (int i = 3; 0 <= i; --i) {
+        result = (result << 8)
+               | static_cast<unsigned char>(buffer[offset + i]);
+    }
+    return result;
+}
+
+void writeUint32(bsl::vector<char> *buffer,
+                 bsl::size_t        offset,
+                 bsl::size_t        value)
+    // Store the specified 'value' as a little-endian 32-bit unsigned integer
+    // at the specified 'offset' in the specified 'buffer'.
+{
+    for (int i = 0; i < 4; ++i) {
+        (*buffer)[offset + i] = static_cast<char>(value >> (8 * i));
+    }
+}
+
+bsl::vector<char> makeAliasedKeyMap(int                numKeys,
+                                    int                keyLength,
+                                    bslma::Allocator  *allocator)
+    // Return an encoding, using the specified 'allocator' to supply memory,
+    // of a map flagged as sorted having the specified 'numKeys' null values,
+    // whose keys all refer to the same string of the specified 'keyLength'
+    // bytes.
+{
+    const bsl::size_t count     = numKeys;
+    const bsl::size_t block     = 16;
+    const bsl::size_t tags      = block + 8 + 8 * count;
+    const bsl::size_t payloads  = tags + (count + 7) / 8 * 8;
+    const bsl::size_t string    = payloads + 8 * count;
+
+    bsl::vector<char> result(string + keyLength, 'k', allocator);
+    bsl::memset(result.data(), 0, string);
+    bsl::memcpy(result.data(), "BDDV", 4);
+    result[4] = 1;
+    result[5] = Datum::e_MAP;
+    writeUint32(&result, 8, count);
+    writeUint32(&result, 12, block - 8);
+    writeUint32(&result, block, 1);  // sorted
+
+    for (bsl::size_t i = 0; i < count; ++i) {
+        const bsl::size_t ref = block + 8 + 8 * i;
+        writeUint32(&result, ref, keyLength);
+        writeUint32(&result, ref + 4, string - ref);
+    }
+    return result;
+}
+
+Datum makeScalar(int index, bslma::Allocator *allocator)
+    // Return the scalar 'Datum' having the specified 'index' in a set of
+    // 'NUM_SCALARS' values covering every encodable scalar type and the
+    // boundaries of their encodings, using the specified 'allocator' to
+    // supply memory.  The behavior is undefined unless
+    // '0 <= index < NUM_SCALARS'.
+{
+    static const char        LONG_STRING[] =
+                  "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                  "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQR";
+    static const unsigned char BYTES[] = { 0, 0xFF, 0x7F };
+
+    switch (index) {
+      case  0: return Datum::createNull();
+      case  1: return Datum::createInteger(0);
+      case  2: return Datum::createInteger(-1);
+      case  3: return Datum::createInteger(INT_MAX);
+      case  4: return Datum::createInteger(INT_MIN);
+      case  5: return Datum::createDouble(0.0);
+      case  6: return Datum::createDouble(-1.5);
+      case  7: return Datum::createDouble(
+                                      bsl::numeric_limits<double>::infinity());
+      case  8: return Datum::copyString("", allocator);
+      case  9: return Datum::copyString("hello", allocator);
+      case 10: return Datum::copyString(LONG_STRING, allocator);
+      case 11: return Datum::createBoolean(true);
+      case 12: return Datum::createBoolean(false);
+      case 13: return Datum::createError(0);
+      case 14: return Datum::createError(-7, "message", allocator);
+      case 15: return Datum::createDate(bdlt::Date(1, 1, 1));
+      case 16: return Datum::createDate(bdlt::Date(9999, 12, 31));
+      case 17: return Datum::createDate(bdlt::Date(2026, 10, 19));
+      case 18: return Datum::createTime(bdlt::Time());
+      case 19: return Datum::createTime(bdlt::Time(0, 0));
+      case 20: return Datum::createTime(bdlt::Time(23, 59, 59, 999, 999));
+      case 21: return Datum::createDatetime(bdlt::Datetime(), allocator);
+      case 22: return Datum::createDatetime(
+                      bdlt::Datetime(9999, 12, 31, 23, 59, 59, 999, 999),
+                      allocator);
+      case 23: return Datum::createDatetime(
+                      bdlt::Datetime(2026, 10, 19, 12, 34, 56, 789, 12),
+                      allocator);
+      case 24: return Datum::createDatetimeInterval(bdlt::DatetimeInterval(),
+                                                    allocator);
+      case 25: return Datum::createDatetimeInterval(
+                        bdlt::DatetimeInterval(INT_MAX, 23, 59, 59, 999, 999),
+                        allocator);
+      case 26: return Datum::createDatetimeInterval(
+                        bdlt::DatetimeInterval(INT_MIN + 1, -5, 0, 0, 0, -1),
+                        allocator);
+      case 27: return Datum::createInteger64(
+                               bsl::numeric_limits<Int64>::min(), allocator);
+      case 28: return Datum::createInteger64(
+                               bsl::numeric_limits<Int64>::max(), allocator);
+      case 29: return Datum::copyBinary(BYTES, 0, allocator);
+      case 30: return Datum::copyBinary(BYTES, sizeof BYTES, allocator);
+      case 31: return Datum::createDecimal64(BDLDFP_DECIMAL_DD(1.25),
+                                             allocator);
+      case 32: return Datum::createDecimal64(BDLDFP_DECIMAL_DD(-0.0001),
+                                             allocator);
+    }
+    BSLS_ASSERT_OPT(!"Bad scalar index");
+    return Datum::createNull();
+}
+
+bool isSame(const DatumView& view, const Datum& datum)
+    // Return 'true' if the specified 'view' refers to a value equal to the
+    // specified 'datum', comparing through the accessors of 'view' without
+    // allocating memory, and 'false' otherwise.
+{
+    if (view.type() != datum.type()) {
+        return false;                                                 // RETURN
+    }
+
+    switch (datum.type()) {
+      case Datum::e_NIL: {
+        return view.isNull();                                         // RETURN
+      }
+      case Datum::e_INTEGER: {
+        return view.isInteger()
+            && view.theInteger() == datum.theInteger();               // RETURN
+      }
+      case Datum::e_DOUBLE: {
+        return view.isDouble()
+            && view.theDouble() == datum.theDouble();                 // RETURN
+      }
+      case Datum::e_STRING: {
+        return view.isString()
+            && view.theString() == datum.theString();                 // RETURN
+      }
+      case Datum::e_BOOLEAN: {
+        return view.isBoolean()
+            && view.theBoolean() == datum.theBoolean();               // RETURN
+      }
+      case Datum::e_ERROR: {
+        return view.isError()
+            && view.theError() == datum.theError();                   // RETURN
+      }
+      case Datum::e_DATE: {
+        return view.isDate()
+            && view.theDate() == datum.theDate();                     // RETURN
+      }
+      case Datum::e_TIME: {
+        return view.isTime()
+            && view.theTime() == datum.theTime();                     // RETURN
+      }
+      case Datum::e_DATETIME: {
+        return view.isDatetime()
+            && view.theDatetime() == datum.theDatetime();             // RETURN
+      }
+      case Datum::e_DATETIME_INTERVAL: {
+        return view.isDatetimeInterval()
+            && view.theDatetimeInterval() == datum.theDatetimeInterval();
+                                                                      // RETURN
+      }
+      case Datum::e_INTEGER64: {
+        return view.isInteger64()
+            && view.theInteger64() == datum.theInteger64();           // RETURN
+      }
+      case Datum::e_BINARY: {
+        return view.isBinary()
+            && view.theBinary() == datum.theBinary();                 // RETURN
+      }
+      case Datum::e_DECIMAL64: {
+        return view.isDecimal64()
+            && view.theDecimal64() == datum.theDecimal64();           // RETURN
+      }
+      case Datum::e_ARRAY: {
+        const DatumArrayView array = view.theArray();
+        const DatumArrayRef  ref   = datum.theArray();
+        if (!view.isArray() || array.length() != ref.length()) {
+            return false;                                             // RETURN
+        }
+        for (bsl::size_t i = 0; i < ref.length(); ++i) {
+            if (!isSame(array[i], ref[i])) {
+                return false;                                         // RETURN
+            }
+        }
+        return true;                                                  // RETURN
+      }
+      case Datum::e_MAP: {
+        const DatumMapView map = view.theMap();
+        const DatumMapRef  ref = datum.theMap();
+        if (!view.isMap()
+         || map.size() != ref.size()
+         || map.isSorted() != ref.isSorted()) {
+            return false;                                             // RETURN
+        }
+        for (bsl::size_t i = 0; i < ref.size(); ++i) {
+            if (map.key(i) != ref[i].key()
+             || !isSame(map.value(i), ref[i].value())) {
+                return false;                                         // RETURN
+            }
+        }
+        return true;                                                  // RETURN
+      }
+      case Datum::e_INT_MAP: {
+        const DatumIntMapView map = view.theIntMap();
+        const DatumIntMapRef  ref = datum.theIntMap();
+        if (!view.isIntMap()
+         || map.size() != ref.size()
+         || map.isSorted() != ref.isSorted()) {
+            return false;                                             // RETURN
+        }
+        for (bsl::size_t i = 0; i < ref.size(); ++i) {
+            if (map.key(i) != ref[i].key()
+             || !isSame(map.value(i), ref[i].value())) {
+                return false;                                         // RETURN
+            }
+        }
+        return true;                                                  // RETURN
+      }
+      default: {
+        return false;                                                 // RETURN
+      }
+    }
+}
+
+Int64 traverse(const DatumView& view)
+    // Read every value referred to by the specified 'view', and return a
+    // checksum of what was read.
+{
+    Int64 result = view.type();
+
+    switch (view.type()) {
+      case Datum::e_INTEGER: {
+        result += view.theInteger();
+      } break;
+      case Datum::e_DOUBLE: {
+        result += view.theDouble() == 0.0;
+      } break;
+      case Datum::e_STRING: {
+        const bslstl::StringRef value = view.theString();
+        for (bsl::size_t i = 0; i < value.length(); ++i) {
+            result += value[i];
+        }
+      } break;
+      case Datum::e_BOOLEAN: {
+        result += view.theBoolean();
+      } break;
+      case Datum::e_ERROR: {
+        result += view.theError().code()
+                + static_cast<Int64>(view.theError().message().length());
+      } break;
+      case Datum::e_DATE: {
+        result += view.theDate().day();
+      } break;
+      case Datum::e_TIME: {
+        result += view.theTime().hour();
+      } break;
+      case Datum::e_DATETIME: {
+        result += view.theDatetime().hour();
+      } break;
+      case Datum::e_DATETIME_INTERVAL: {
+        result += view.theDatetimeInterval().days();
+      } break;
+      case Datum::e_INTEGER64: {
+        result += view.theInteger64();
+      } break;
+      case Datum::e_BINARY: {
+        const DatumBinaryRef value = view.theBinary();
+        for (bsl::size_t i = 0; i < value.size(); ++i) {
+            result += static_cast<const char *>(value.data())[i];
+        }
+      } break;
+      case Datum::e_DECIMAL64: {
+        result += view.theDecimal64() == BDLDFP_DECIMAL_DD(0.0);
+      } break;
+      case Datum::e_ARRAY: {
+        const DatumArrayView array = view.theArray();
+        for (bsl::size_t i = 0; i < array.length(); ++i) {
+            result += traverse(array[i]);
+        }
+      } break;
+      case Datum::e_MAP: {
+        const DatumMapView map = view.theMap();
+        for (bsl::size_t i = 0; i < map.size(); ++i) {
+            result += static_cast<Int64>(map.key(i).length())
+                    + traverse(map.value(i));
+        }
+      } break;
+      case Datum::e_INT_MAP: {
+        const DatumIntMapView map = view.theIntMap();
+        for (bsl::size_t i = 0; i < map.size(); ++i) {
+            result += map.key(i) + traverse(map.value(i));
+        }
+      } break;
+      default: {
+      } break;
+    }
+    return result;
+}
+
+Datum makeArrayOfScalars(int size, bslma::Allocator *allocator)
+    // Return an array of the specified 'size' elements cycling through the
+    // scalars of 'makeScalar', using the specified 'allocator' to supply
+    // memory.
+{
+    DatumArrayBuilder builder(size, allocator);
+    for (int i = 0; i < size; ++i) {
+        builder.pushBack(makeScalar(i % NUM_SCALARS, allocator));
+    }
+    return builder.commit();
+}
+
+Datum makeMap(int size, bool sorted, bslma::Allocator *allocator)
+    // Return a string-keyed map of the specified 'size' entries, having keys
+    // "k0", "k1", ... and values cycling through the scalars of
+    // 'makeScalar', sorted by key if the specified 'sorted' is 'true', using
+    // the specified 'allocator' to supply memory.  The keys of the returned
+    // map are owned by the map.
+{
+    DatumMapOwningKeysBuilder builder(allocator);
+    for (int i = 0; i < size; ++i) {
+        char key[16];
+        bsl::sprintf(key, "k%d", i);
+        builder.pushBack(key, makeScalar(i % NUM_SCALARS, allocator));
+    }
+    return sorted ? builder.sortAndCommit() : builder.commit();
+}
+
+Datum makeIntMap(int size, bool sorted, bslma::Allocator *allocator)
+    // Return an integer-keyed map of the specified 'size' entries, having
+    // keys '-size', '-size + 2', ... and values cycling through the scalars
+    // of 'makeScalar', sorted by key if the specified 'sorted' is 'true',
+    // using the specified 'allocator' to supply memory.
+{
+    DatumIntMapBuilder builder(allocator);
+    for (int i = 0; i < size; ++i) {
+        builder.pushBack(sorted ? 2 * i - size : size - 2 * i,
+                         makeScalar(i % NUM_SCALARS, allocator));
+    }
+    return sorted ? builder.sortAndCommit() : builder.commit();
+}
+
+Datum makeTree(int depth, int fanout, bslma::Allocator *allocator)
+    // Return a tree of alternating maps, integer-keyed maps, and arrays of
+    // the specified 'depth', each container having the specified 'fanout'
+    // elements, with scalars as leaves, using the specified 'allocator' to
+    // supply memory.
+{
+    if (0 == depth) {
+        return makeScalar(fanout % NUM_SCALARS, allocator);           // RETURN
+    }
+
+    switch (depth % 3) {
+      case 0: {
+        DatumArrayBuilder builder(fanout, allocator);
+        for (int i = 0; i < fanout; ++i) {
+            builder.pushBack(makeTree(depth - 1, fanout, allocator));
+        }
+        return builder.commit();                                      // RETURN
+      }
+      case 1: {
+        DatumMapOwningKeysBuilder builder(allocator);
+        for (int i = 0; i < fanout; ++i) {
+            char key[16];
+            bsl::sprintf(key, "key%d", i);
+            builder.pushBack(key, makeTree(depth - 1, fanout, allocator));
+        }
+        return builder.sortAndCommit();                               // RETURN
+      }
+      default: {
+        DatumIntMapBuilder builder(allocator);
+        for (int i = 0; i < fanout; ++i) {
+            builder.pushBack(i * 10, makeTree(depth - 1, fanout, allocator));
+        }
+        return builder.commit();                                      // RETURN
+      }
+    }
+}
+
+Datum makeNested(int depth, bslma::Allocator *allocator)
+    // Return the specified 'depth' arrays nested in one another, the
+    // innermost holding a null value, using the specified 'allocator' to
+    // supply memory.  The behavior is undefined unless '1 <= depth'.
+{
+    Datum result = Datum::createNull();
+    for (int i = 0; i < depth; ++i) {
+        DatumArrayBuilder builder(1, allocator);
+        builder.pushBack(result);
+        result = builder.commit();
+    }
+    return result;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    const bool             verbose = argc > 2;
+    const bool         veryVerbose = argc > 3;
+    const bool     veryVeryVerbose = argc > 4;
+    const bool veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator da("default", veryVeryVeryVerbose);
+    bslma::Default::setDefaultAllocator(&da);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sharing a 'Datum' Tree Through a Buffer
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose a service publishes records, represented as 'Datum' maps, to a
+// shared memory segment, and its clients look up individual fields of those
+// records.
+//
+// First, we create a record:
+//..
+    bslma::TestAllocator ta;
+
+    bdld::DatumMapEntry entries[] = {
+        bdld::DatumMapEntry("name",  bdld::Datum::createStringRef("IBM", &ta)),
+        bdld::DatumMapEntry("price", bdld::Datum::createDouble(137.25)),
+        bdld::DatumMapEntry("size",  bdld::Datum::createInteger(400)),
+    };
+    const int NUM_ENTRIES = sizeof entries / sizeof *entries;
+
+    bdld::DatumMutableMapRef mapRef;
+    bdld::Datum::createUninitializedMap(&mapRef, NUM_ENTRIES, &ta);
+    for (int i = 0; i < NUM_ENTRIES; ++i) {
+        mapRef.data()[i] = entries[i];
+    }
+    *mapRef.size()   = NUM_ENTRIES;
+    *mapRef.sorted() = true;
+
+    bdld::ManagedDatum record(bdld::Datum::adoptMap(mapRef), &ta);
+//..
+// Then, the service encodes the record into a buffer (which, in practice,
+// would reside in the shared memory segment):
+//..
+    bsl::vector<char> buffer(&ta);
+    int rc = bdld::DatumViewUtil::encode(&buffer, record);
+    ASSERT(0 == rc);
+//..
+// Next, a client, having received the buffer, verifies it and obtains a view
+// of the record.  Note that no memory is allocated to do so:
+//..
+    bslma::TestAllocatorMonitor tam(&ta);
+
+    bdld::DatumView view;
+    rc = bdld::DatumViewUtil::view(&view, buffer.data(), buffer.size());
+    ASSERT(0 == rc);
+    ASSERT(view.isMap());
+    ASSERT(3 == view.theMap().size());
+//..
+// Then, the client looks up the fields it is interested in:
+//..
+    bdld::DatumView price;
+    ASSERT(true   == view.theMap().find(&price, "price"));
+    ASSERT(137.25 == price.theDouble());
+
+    bdld::DatumView name;
+    ASSERT(true   == view.theMap().find(&name, "name"));
+    ASSERT("IBM"  == name.theString());
+
+    ASSERT(tam.isTotalSame());
+//..
+// Finally, the client makes a 'Datum' copy of the record that outlives the
+// buffer:
+//..
+    bdld::ManagedDatum copy(bdld::DatumViewUtil::toDatum(view, &ta), &ta);
+    ASSERT(copy == record);
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING 'print' AND 'operator<<'
+        //
+        // Concerns:
+        //: 1 'print' on a view produces the same output as 'print' on the
+        //:   'Datum' that was encoded, for every type and for nested
+        //:   containers, in both single-line and multi-line formats.
+        //:
+        //: 2 'operator<<' produces the single-line format.
+        //
+        // Plan:
+        //: 1 For each scalar and for a tree of containers, compare the output
+        //:   of 'DatumView::print' with that of 'Datum::print' for several
+        //:   'level' and 'spacesPerLevel' values.  (C-1)
+        //:
+        //: 2 Compare the output of 'operator<<' with that of 'print(s, 0,
+        //:   -1)'.  (C-2)
+        //
+        // Testing:
+        //   bsl::ostream& print(bsl::ostream&, int, int) const;
+        //   bsl::ostream& operator<<(bsl::ostream&, const DatumView&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'print' AND 'operator<<'" << endl
+                          << "================================" << endl;
+
+        bslma::TestAllocator         ta("test", veryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&ta);
+
+        const struct {
+            int d_level;
+            int d_spacesPerLevel;
+        } FORMATS[] = { { 0, 4 }, { 0, -1 }, { 2, 2 }, { -2, 3 }, { 1, 0 } };
+        const int NUM_FORMATS = sizeof FORMATS / sizeof *FORMATS;
+
+        for (int ti = 0; ti <= NUM_SCALARS; ++ti) {
+            ManagedDatum datum(ti < NUM_SCALARS ? makeScalar(ti, &ta)
+                                                : makeTree(4, 2, &ta),
+                               &ta);
+
+            if (datum->isBinary()) {
+                // Binary values are printed with their address.
+
+                continue;
+            }
+
+            bsl::vector<char> buffer(&ta);
+            ASSERTV(ti, 0 == Util::encode(&buffer, datum));
+
+            const DatumView view = Util::viewUnchecked(buffer.data());
+
+            for (int tj = 0; tj < NUM_FORMATS; ++tj) {
+                const int L   = FORMATS[tj].d_level;
+                const int SPL = FORMATS[tj].d_spacesPerLevel;
+
+                bsl::ostringstream expected(&ta);
+                bsl::ostringstream actual(&ta);
+                datum->print(expected, L, SPL);
+                view.print(actual, L, SPL);
+
+                if (veryVerbose) { P_(ti) P_(L) P(SPL) P(actual.str()) }
+
+                ASSERTV(ti, L, SPL, expected.str(), actual.str(),
+                        expected.str() == actual.str());
+            }
+
+            bsl::ostringstream expected(&ta);
+            bsl::ostringstream actual(&ta);
+            view.print(expected, 0, -1);
+            actual << view;
+            ASSERTV(ti, expected.str() == actual.str());
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'view'
+        //
+        // Concerns:
+        //: 1 'view' accepts every encoding produced by 'encode'.
+        //:
+        //: 2 'view' rejects buffers that are too short, have a wrong magic
+        //:   number, version, or reserved bytes, or are truncated anywhere.
+        //:
+        //: 3 'view' rejects out-of-range offsets, lengths, tags, and date and
+        //:   time values, and maps flagged as sorted whose keys are not.
+        //:
+        //: 4 When 'view' accepts a corrupted buffer, the resulting view can
+        //:   be traversed and converted without reading outside the buffer.
+        //:
+        //: 5 'view' rejects encodings nested more deeply than
+        //:   'k_MAX_NESTING_DEPTH', encodings whose payloads refer to shared
+        //:   blocks so as to describe more values than fit in the buffer, and
+        //:   sorted maps whose keys alias the same string so as to require
+        //:   comparing more bytes than fit in the buffer, in time linear in
+        //:   the buffer length.
+        //:
+        //: 6 'view' does not modify 'result' on failure.
+        //:
+        //: 7 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Encode a tree covering every type.  Verify that 'view' accepts
+        //:   the encoding and rejects every proper prefix of it.  (C-1..2)
+        //:
+        //: 2 Corrupt each header byte and verify rejection.  (C-2)
+        //:
+        //: 3 Flip every bit of the encoding in turn, copying it into a buffer
+        //:   exactly as long as the encoding, and verify that 'view' either
+        //:   rejects the result or that 'traverse' and 'toDatum' succeed.
+        //:   Run under a memory checker, this also verifies that no byte
+        //:   outside the buffer is read.  (C-3..4)
+        //:
+        //: 4 Craft specific invalid encodings (bad tag, date, time, and
+        //:   interval values, unsorted maps flagged as sorted, a
+        //:   self-referencing container, a chain of arrays whose every
+        //:   element refers to the same block, and a sorted map whose many
+        //:   keys refer to the same long string) and verify that they are
+        //:   rejected and that 'result' is unchanged.  (C-3, 5..6)
+        //:
+        //: 5 Verify that nesting up to 'k_MAX_NESTING_DEPTH' is accepted and
+        //:   deeper nesting is rejected by both 'encode' and 'view'.  (C-5)
+        //:
+        //: 6 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-7)
+        //
+        // Testing:
+        //   int view(DatumView *, const char *, bsl::size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'view'" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        ManagedDatum tree(makeTree(3, 3, &ta), &ta);
+        {
+            // Add a map and an array of scalars to cover every type.
+
+            DatumArrayBuilder builder(3, &ta);
+            builder.pushBack(tree.release());
+            builder.pushBack(makeArrayOfScalars(NUM_SCALARS, &ta));
+            builder.pushBack(makeMap(NUM_SCALARS, false, &ta));
+            tree.adopt(builder.commit());
+        }
+
+        bsl::vector<char> encoding(&ta);
+        ASSERT(0 == Util::encode(&encoding, tree));
+        const bsl::size_t LENGTH = encoding.size();
+
+        if (veryVerbose) { P(LENGTH) }
+
+        const DatumView NIL;
+        DatumView       view;
+
+        if (verbose) cout << "\tValid encoding and its prefixes." << endl;
+        {
+            ASSERT(0 == Util::view(&view, encoding.data(), LENGTH));
+            ASSERT(isSame(view, *tree));
+
+            for (bsl::size_t length = 0; length < LENGTH; ++length) {
+                // Copy into a buffer of exactly 'length' bytes.
+
+                bsl::vector<char> prefix(encoding.begin(),
+                                         encoding.begin() + length,
+                                         &ta);
+                view = NIL;
+                ASSERTV(length,
+                        0 != Util::view(&view, prefix.data(), length));
+                ASSERTV(length, view.isNull());
+            }
+        }
+
+        if (verbose) cout << "\tCorrupted header." << endl;
+        {
+            for (int i = 0; i < 8; ++i) {
+                if (5 == i) {
+                    continue;  // the top-level tag is tested below
+                }
+                bsl::vector<char> corrupt(encoding, &ta);
+                corrupt[i] ^= 0x10;
+                view = NIL;
+                ASSERTV(i, 0 != Util::view(&view, corrupt.data(), LENGTH));
+                ASSERTV(i, view.isNull());
+            }
+        }
+
+        if (verbose) cout << "\tFlipped bits." << endl;
+        {
+            int numAccepted = 0;
+
+            for (bsl::size_t i = 0; i < LENGTH; ++i) {
+                for (int bit = 0; bit < 8; ++bit) {
+                    bsl::vector<char> corrupt(encoding, &ta);
+                    corrupt[i] = static_cast<char>(corrupt[i] ^ (1 << bit));
+
+                    if (0 != Util::view(&view,
+                                        corrupt.data(),
+                                        corrupt.size())) {
+                        continue;
+                    }
+                    ++numAccepted;
+                    traverse(view);
+
+                    bslma::TestAllocator ca("copy", veryVeryVerbose);
+                    Datum::destroy(Util::toDatum(view, &ca), &ca);
+                    ASSERTV(i, bit, 0 == ca.numBytesInUse());
+                }
+            }
+            if (veryVerbose) { P(numAccepted) }
+
+            // Flipping bits of values (as opposed to structure) is accepted.
+
+            ASSERT(0 < numAccepted);
+        }
+
+        if (verbose) cout << "\tCrafted encodings." << endl;
+        {
+            bsl::vector<char> base(&ta);
+            ASSERT(0 == Util::encode(&base, Datum::createNull()));
+            ASSERT(16 == base.size());
+
+            // The number of days between the minimum and maximum dates
+            // depends on the calendar 'bdlt::Date' is configured to use.
+
+            const bsls::Types::Uint64 MAX_DAYS =
+                                      bdlt::Date(9999, 12, 31) - bdlt::Date();
+
+            const struct {
+                int                 d_line;
+                unsigned char       d_tag;
+                bsls::Types::Uint64 d_payload;
+                bool                d_valid;
+            } DATA[] = {
+                { L_, Datum::e_NIL,         0,                      true  },
+                { L_, Datum::e_USERDEFINED, 0,                      false },
+                { L_, 17,                   0,                      false },
+                { L_, 255,                  0,                      false },
+                { L_, Datum::e_DATE,        MAX_DAYS,               true  },
+                { L_, Datum::e_DATE,        MAX_DAYS + 1,           false },
+                { L_, Datum::e_TIME,        86400000000ULL,         true  },
+                { L_, Datum::e_TIME,        86400000001ULL,         false },
+                { L_, Datum::e_DATETIME,    86400000000ULL,         true  },
+                { L_, Datum::e_DATETIME,    (1ULL << 37)
+                                                     + 86400000000ULL, false },
+                { L_, Datum::e_DATETIME,    (MAX_DAYS << 37)
+                                                     + 86399999999ULL, true  },
+                { L_, Datum::e_DATETIME,    (MAX_DAYS + 1) << 37,   false },
+                { L_, Datum::e_STRING,      0,                      true  },
+                { L_, Datum::e_STRING,      1,                      false },
+                { L_, Datum::e_STRING,      1ULL << 32,             false },
+                { L_, Datum::e_STRING,      (8ULL << 32) | 1,       false },
+                { L_, Datum::e_ERROR,       5,                      true  },
+                { L_, Datum::e_ERROR,       8ULL << 32,             false },
+                { L_, Datum::e_ARRAY,       0,                      true  },
+                { L_, Datum::e_ARRAY,       1,                      false },
+                { L_, Datum::e_MAP,         (8ULL << 32) | 1,       false },
+                { L_, Datum::e_INT_MAP,     0xFFFFFFFFULL,          false },
+                { L_, Datum::e_DATETIME_INTERVAL, 0,                false },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int                 LINE    = DATA[ti].d_line;
+                const unsigned char       TAG     = DATA[ti].d_tag;
+                const bsls::Types::Uint64 PAYLOAD = DATA[ti].d_payload;
+                const bool                VALID   = DATA[ti].d_valid;
+
+                bsl::vector<char> crafted(base, &ta);
+                crafted[5] = static_cast<char>(TAG);
+                for (int i = 0; i < 8; ++i) {
+                    crafted[8 + i] = static_cast<char>(PAYLOAD >> (8 * i));
+                }
+
+                view = NIL;
+                const int rc = Util::view(&view,
+                                          crafted.data(),
+                                          crafted.size());
+                ASSERTV(LINE, rc, VALID == (0 == rc));
+                if (!VALID) {
+                    ASSERTV(LINE, view.isNull());
+                }
+            }
+
+            // Datetime intervals with out-of-range or inconsistent fields.
+
+            const struct {
+                int   d_line;
+                Int64 d_days;
+                Int64 d_microseconds;
+                bool  d_valid;
+            } INTERVALS[] = {
+                { L_,  0,                   0,                    true  },
+                { L_,  INT_MAX,             86399999999LL,        true  },
+                { L_,  INT_MIN,            -86399999999LL,        true  },
+                { L_,  Int64(INT_MAX) + 1,  0,                    false },
+                { L_,  Int64(INT_MIN) - 1,  0,                    false },
+                { L_,  0,                   86400000000LL,        false },
+                { L_,  0,                  -86400000000LL,        false },
+                { L_,  1,                  -1,                    false },
+                { L_, -1,                   1,                    false },
+            };
+            const int NUM_INTERVALS = sizeof INTERVALS / sizeof *INTERVALS;
+
+            for (int ti = 0; ti < NUM_INTERVALS; ++ti) {
+                const int   LINE  = INTERVALS[ti].d_line;
+                const Int64 DAYS  = INTERVALS[ti].d_days;
+                const Int64 USECS = INTERVALS[ti].d_microseconds;
+                const bool  VALID = INTERVALS[ti].d_valid;
+
+                bsl::vector<char> crafted(base, &ta);
+                crafted.resize(32);
+                crafted[5]  = Datum::e_DATETIME_INTERVAL;
+                crafted[12] = 8;  // offset 8 from the payload at 8
+                for (int i = 0; i < 8; ++i) {
+                    crafted[16 + i] = static_cast<char>(DAYS  >> (8 * i));
+                    crafted[24 + i] = static_cast<char>(USECS >> (8 * i));
+                }
+
+                const int rc = Util::view(&view,
+                                          crafted.data(),
+                                          crafted.size());
+                ASSERTV(LINE, rc, VALID == (0 == rc));
+                if (0 == rc) {
+                    ASSERTV(LINE, DAYS == view.theDatetimeInterval().days());
+                }
+            }
+
+            // A chain of 'N' two-element arrays, each of whose elements
+            // refers to the next array, describes '2^N' values in '16 + 16 *
+            // N' bytes.
+
+            const int         N = 40;
+            bsl::vector<char> chain(base, &ta);
+            chain.resize(16 + 16 * N);
+            chain[5] = Datum::e_ARRAY;
+            for (int i = 0; i < N; ++i) {
+                const bsl::size_t block = 16 + 16 * i;
+                chain[block]     = Datum::e_ARRAY;
+                chain[block + 1] = Datum::e_ARRAY;
+            }
+            // Top-level payload: 2 elements at offset 8 (block at 16).
+
+            chain[8]  = 2;
+            chain[12] = 8;
+
+            // Each block holds 2 tags padded to 8 bytes then 1 payload
+            // (overlapping the next block's tags), which is enough to make
+            // the elements refer to the next block.
+
+            for (int i = 0; i + 1 < N; ++i) {
+                const bsl::size_t payload = 16 + 16 * i + 8;
+                chain[payload]     = 2;
+                chain[payload + 4] = 8;
+            }
+            view = NIL;
+            ASSERT(0 != Util::view(&view, chain.data(), chain.size()));
+            ASSERT(view.isNull());
+
+            // Maps flagged as sorted whose keys are not sorted are rejected.
+
+            for (int isIntMap = 0; isIntMap < 2; ++isIntMap) {
+                ManagedDatum      map(isIntMap ? makeIntMap(3, false, &ta)
+                                               : makeMap(12, false, &ta),
+                                      &ta);
+                bsl::vector<char> unsorted(&ta);
+                ASSERT(0 == Util::encode(&unsorted, map));
+                ASSERT(0 == Util::view(&view,
+                                       unsorted.data(),
+                                       unsorted.size()));
+                ASSERT(false == (isIntMap ? view.theIntMap().isSorted()
+                                          : view.theMap().isSorted()));
+
+                unsorted[8 + readUint32(unsorted, 12)] |= 1;
+                ASSERTV(isIntMap, 0 != Util::view(&view,
+                                                  unsorted.data(),
+                                                  unsorted.size()));
+            }
+
+            // Keys of a sorted map may alias the same string, but the bytes
+            // compared to verify the order of the keys may not exceed the
+            // length of the buffer, so that 'N' keys aliasing a string of
+            // 'L' bytes cannot make the verification take 'O(N * L)' time.
+
+            {
+                bsl::vector<char> aliased(makeAliasedKeyMap(2, 64, &ta));
+                ASSERT(0 == Util::view(&view,
+                                       aliased.data(),
+                                       aliased.size()));
+                ASSERT(view.isMap());
+                ASSERT(2 == view.theMap().size());
+                ASSERT(view.theMap().isSorted());
+
+                aliased = makeAliasedKeyMap(4096, 1 << 20, &ta);
+                view = NIL;
+                ASSERT(0 != Util::view(&view,
+                                       aliased.data(),
+                                       aliased.size()));
+                ASSERT(view.isNull());
+            }
+
+            // A container referring to itself is rejected as its offset is
+            // not past its payload.
+
+            bsl::vector<char> loop(base, &ta);
+            loop.resize(24);
+            loop[5]  = Datum::e_ARRAY;
+            loop[8]  = 1;
+            loop[12] = 8;
+            loop[16] = Datum::e_ARRAY;
+            loop[17] = 0;
+            view = NIL;
+            ASSERT(0 != Util::view(&view, loop.data(), loop.size()));
+        }
+
+        if (verbose) cout << "\tNesting depth." << endl;
+        {
+            const int MAX = Util::k_MAX_NESTING_DEPTH;
+
+            ManagedDatum ok(makeNested(MAX, &ta), &ta);
+            ManagedDatum deep(makeNested(MAX + 1, &ta), &ta);
+
+            bsl::vector<char> okEncoding(&ta);
+            ASSERT(0 == Util::encode(&okEncoding, ok));
+            ASSERT(0 == Util::view(&view, okEncoding.data(),
+                                   okEncoding.size()));
+            ASSERT(isSame(view, *ok));
+
+            bsl::vector<char> deepEncoding(&ta);
+            ASSERT(0 != Util::encode(&deepEncoding, deep));
+            ASSERT(deepEncoding.empty());
+
+            // Craft the deeper encoding by wrapping 'okEncoding' in one more
+            // array.
+
+            deepEncoding.assign(okEncoding.begin(), okEncoding.end());
+            deepEncoding.resize(okEncoding.size() + 16);
+            bsl::memmove(deepEncoding.data() + 32,
+                         deepEncoding.data() + 16,
+                         okEncoding.size() - 16);
+            bsl::memset(deepEncoding.data() + 16, 0, 16);
+            deepEncoding[16] = deepEncoding[5];
+            bsl::memcpy(deepEncoding.data() + 24, deepEncoding.data() + 8, 8);
+            deepEncoding[5]  = Datum::e_ARRAY;
+            bsl::memset(deepEncoding.data() + 8, 0, 8);
+            deepEncoding[8]  = 1;
+            deepEncoding[12] = 8;
+            ASSERT(0 != Util::view(&view, deepEncoding.data(),
+                                   deepEncoding.size()));
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Util::view(&view, encoding.data(), LENGTH));
+            ASSERT_FAIL(Util::view(0,     encoding.data(), LENGTH));
+            ASSERT_PASS(Util::view(&view, 0,               0));
+            ASSERT_FAIL(Util::view(&view, 0,               LENGTH));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'encode' AND 'encodedLength'
+        //
+        // Concerns:
+        //: 1 'encodedLength' returns the length of the encoding written by
+        //:   'encode', which is the same whether written into a vector or a
+        //:   raw buffer, regardless of the buffer's initial content.
+        //:
+        //: 2 The 'ManagedDatum' overload produces the same encoding.
+        //:
+        //: 3 Out-of-line blocks holding payloads are 8-byte aligned.
+        //:
+        //: 4 'Datum' trees containing a user-defined value, anywhere, cannot
+        //:   be encoded, and the failing functions have no effect on their
+        //:   output arguments.
+        //:
+        //: 5 'encode' allocates only the resulting vector.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For a set of trees, compare the encoding into a vector with that
+        //:   into raw buffers pre-filled with different bytes, and with that
+        //:   of the 'ManagedDatum' overload.  (C-1..2)
+        //:
+        //: 2 Verify that the payloads of an array nested in a map start at
+        //:   an offset that is a multiple of 8.  (C-3)
+        //:
+        //: 3 Place a user-defined value in containers at various depths and
+        //:   verify that encoding fails without effect.  (C-4)
+        //:
+        //: 4 Use a test allocator monitor to verify allocations.  (C-5)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-6)
+        //
+        // Testing:
+        //   int encode(char *, bsl::size_t, const Datum&);
+        //   int encode(bsl::vector<char> *, const ManagedDatum&);
+        //   int encodedLength(bsl::size_t *, const Datum&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'encode' AND 'encodedLength'" << endl
+                          << "====================================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        for (int depth = 0; depth < 5; ++depth) {
+            for (int fanout = 0; fanout < 4; ++fanout) {
+                ManagedDatum tree(makeTree(depth, fanout, &ta), &ta);
+
+                bsl::size_t length = 0;
+                ASSERTV(depth, fanout,
+                        0 == Util::encodedLength(&length, *tree));
+                ASSERTV(depth, fanout, Util::k_HEADER_LENGTH <= length);
+
+                bsl::vector<char> encoding(&ta);
+                {
+                    bslma::TestAllocatorMonitor dam(&da);
+                    ASSERTV(depth, fanout,
+                            0 == Util::encode(&encoding, *tree));
+                    ASSERTV(depth, fanout, dam.isTotalSame());
+                }
+                ASSERTV(depth, fanout, length == encoding.size());
+
+                for (int fill = 0; fill < 256; fill += 85) {
+                    bsl::vector<char> raw(length, static_cast<char>(fill),
+                                          &ta);
+                    ASSERTV(depth, fanout, fill,
+                            0 == Util::encode(raw.data(), length, *tree));
+                    ASSERTV(depth, fanout, fill, raw == encoding);
+                }
+
+                bsl::vector<char> managed(&ta);
+                ASSERTV(depth, fanout, 0 == Util::encode(&managed, tree));
+                ASSERTV(depth, fanout, managed == encoding);
+            }
+        }
+
+        if (verbose) cout << "\tAlignment." << endl;
+        {
+            DatumMapOwningKeysBuilder builder(&ta);
+            builder.pushBack("odd", Datum::copyString("xyz", &ta));
+            builder.pushBack("array", makeArrayOfScalars(3, &ta));
+            ManagedDatum map(builder.commit(), &ta);
+
+            bsl::vector<char> encoding(&ta);
+            ASSERT(0 == Util::encode(&encoding, map));
+
+            // The top-level payload refers to the map block, whose second
+            // payload refers to the array block.  A reference holds a count
+            // in its low 32 bits and an offset from the payload in its high
+            // 32 bits.
+
+            const bsl::size_t mapBlock  = 8 + readUint32(encoding, 12);
+            const bsl::size_t payload   = mapBlock + 8 + 2 * 8 + 8 + 8;
+            const bsl::size_t arrayBlock =
+                                        payload + readUint32(encoding,
+                                                             payload + 4);
+
+            ASSERTV(mapBlock,   0 == mapBlock   % 8);
+            ASSERTV(arrayBlock, 0 == arrayBlock % 8);
+            ASSERTV(3 == readUint32(encoding, payload));
+
+            const DatumView view = Util::viewUnchecked(encoding.data());
+            DatumView       value;
+            ASSERT(view.theMap().find(&value, "array"));
+            ASSERT(isSame(value, map->theMap()[1].value()));
+        }
+
+        if (verbose) cout << "\tUser-defined values." << endl;
+        {
+            int dummy = 0;
+
+            for (int depth = 0; depth < 4; ++depth) {
+                Datum udt = Datum::createUdt(&dummy, 7);
+                for (int i = 0; i < depth; ++i) {
+                    DatumArrayBuilder builder(2, &ta);
+                    builder.pushBack(Datum::createInteger(i));
+                    builder.pushBack(udt);
+                    udt = builder.commit();
+                }
+                ManagedDatum tree(udt, &ta);
+
+                bsl::size_t length = 99;
+                ASSERTV(depth, 0 != Util::encodedLength(&length, *tree));
+                ASSERTV(depth, 99 == length);
+
+                bsl::vector<char> encoding(3, 'x', &ta);
+                ASSERTV(depth, 0 != Util::encode(&encoding, tree));
+                ASSERTV(depth, 3 == encoding.size());
+            }
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bsl::size_t       length;
+            bsl::vector<char> encoding(&ta);
+            const Datum       NIL = Datum::createNull();
+            char              buffer[16];
+
+            ASSERT_PASS(Util::encodedLength(&length, NIL));
+            ASSERT_FAIL(Util::encodedLength(0,       NIL));
+
+            ASSERT_PASS(Util::encode(&encoding, NIL));
+            ASSERT_FAIL(Util::encode(static_cast<bsl::vector<char> *>(0),
+                                     NIL));
+
+            ASSERT_PASS(Util::encode(buffer, 16, NIL));
+            ASSERT_FAIL(Util::encode(buffer, 15, NIL));
+            ASSERT_FAIL(Util::encode(0,      16, NIL));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING CONTAINER VIEWS
+        //
+        // Concerns:
+        //: 1 Array, map, and integer-keyed map views report the size,
+        //:   elements, keys, and sortedness of the encoded containers, for
+        //:   sizes around multiples of 8 (where tags are padded).
+        //:
+        //: 2 'find' locates every key and fails for absent keys, for sorted
+        //:   and unsorted maps, and leaves 'result' unchanged on failure.
+        //:
+        //: 3 Empty containers and empty keys are supported.
+        //:
+        //: 4 Nested containers are viewed correctly, and 'toDatum' recreates
+        //:   them, including the sortedness of maps.
+        //:
+        //: 5 No memory is allocated to view containers.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For a set of sizes, encode arrays, sorted and unsorted maps, and
+        //:   sorted and unsorted integer-keyed maps, and compare their views
+        //:   with the originals.  Look up every key and several absent ones.
+        //:   (C-1..3, 5)
+        //:
+        //: 2 Repeat for trees of nested containers.  (C-4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-6)
+        //
+        // Testing:
+        //   DatumView operator[](SizeType) const;
+        //   SizeType length() const;
+        //   bool find(DatumView *, const bslstl::StringRef&) const;
+        //   bool find(DatumView *, int) const;
+        //   bool isSorted() const;
+        //   bslstl::StringRef key(SizeType) const;
+        //   int key(SizeType) const;
+        //   SizeType size() const;
+        //   DatumView value(SizeType) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING CONTAINER VIEWS" << endl
+                          << "=======================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        const int SIZES[] = { 0, 1, 2, 7, 8, 9, 16, 33, 100 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+
+            if (veryVerbose) { T_ P(SIZE) }
+
+            {
+                ManagedDatum      array(makeArrayOfScalars(SIZE, &ta), &ta);
+                bsl::vector<char> encoding(&ta);
+                ASSERTV(SIZE, 0 == Util::encode(&encoding, array));
+
+                bslma::TestAllocatorMonitor tam(&ta);
+                bslma::TestAllocatorMonitor dam(&da);
+
+                DatumView view;
+                ASSERTV(SIZE, 0 == Util::view(&view,
+                                              encoding.data(),
+                                              encoding.size()));
+                ASSERTV(SIZE, view.isArray());
+
+                const DatumArrayView arrayView = view.theArray();
+                ASSERTV(SIZE, SIZE == static_cast<int>(arrayView.length()));
+                for (int i = 0; i < SIZE; ++i) {
+                    ASSERTV(SIZE, i,
+                            isSame(arrayView[i], array->theArray()[i]));
+                }
+                ASSERTV(SIZE, tam.isTotalSame());
+                ASSERTV(SIZE, dam.isTotalSame());
+            }
+
+            for (int sorted = 0; sorted < 2; ++sorted) {
+                ManagedDatum      map(makeMap(SIZE, sorted, &ta), &ta);
+                bsl::vector<char> encoding(&ta);
+                ASSERTV(SIZE, 0 == Util::encode(&encoding, map));
+
+                bslma::TestAllocatorMonitor tam(&ta);
+                bslma::TestAllocatorMonitor dam(&da);
+
+                DatumView view;
+                ASSERTV(SIZE, 0 == Util::view(&view,
+                                              encoding.data(),
+                                              encoding.size()));
+                ASSERTV(SIZE, view.isMap());
+                ASSERTV(SIZE, sorted, isSame(view, *map));
+
+                const DatumMapView mapView = view.theMap();
+                ASSERTV(SIZE, sorted, SIZE == int(mapView.size()));
+                ASSERTV(SIZE, sorted,
+                        map->theMap().isSorted() == mapView.isSorted());
+
+                for (int i = 0; i < SIZE; ++i) {
+                    char key[16];
+                    bsl::sprintf(key, "k%d", i);
+
+                    DatumView result;
+                    ASSERTV(SIZE, sorted, i, mapView.find(&result, key));
+                    ASSERTV(SIZE, sorted, i,
+                            isSame(result, *map->theMap().find(key)));
+                }
+
+                const char *ABSENT[] = { "", "k", "k-1", "k999", "~", "a" };
+                const int   NUM_ABSENT = sizeof ABSENT / sizeof *ABSENT;
+                for (int i = 0; i < NUM_ABSENT; ++i) {
+                    DatumView result;
+                    ASSERTV(SIZE, sorted, i,
+                            false == mapView.find(&result, ABSENT[i]));
+                    ASSERTV(SIZE, sorted, i, result.isNull());
+                }
+                ASSERTV(SIZE, tam.isInUseSame());
+                ASSERTV(SIZE, dam.isTotalSame());
+
+                ManagedDatum copy(Util::toDatum(view, &ta), &ta);
+                ASSERTV(SIZE, sorted, copy == map);
+                ASSERTV(SIZE, sorted,
+                        map->theMap().isSorted() ==
+                                                copy->theMap().isSorted());
+            }
+
+            for (int sorted = 0; sorted < 2; ++sorted) {
+                ManagedDatum      map(makeIntMap(SIZE, sorted, &ta), &ta);
+                bsl::vector<char> encoding(&ta);
+                ASSERTV(SIZE, 0 == Util::encode(&encoding, map));
+
+                bslma::TestAllocatorMonitor dam(&da);
+
+                DatumView view;
+                ASSERTV(SIZE, 0 == Util::view(&view,
+                                              encoding.data(),
+                                              encoding.size()));
+                ASSERTV(SIZE, view.isIntMap());
+                ASSERTV(SIZE, sorted, isSame(view, *map));
+
+                const DatumIntMapView mapView = view.theIntMap();
+                for (int i = 0; i < SIZE; ++i) {
+                    const int KEY = map->theIntMap()[i].key();
+
+                    DatumView result;
+                    ASSERTV(SIZE, sorted, i, mapView.find(&result, KEY));
+                    ASSERTV(SIZE, sorted, i,
+                            isSame(result, map->theIntMap()[i].value()));
+
+                    // Keys are even offsets from 'SIZE', so odd keys are
+                    // absent.
+
+                    DatumView absent;
+                    ASSERTV(SIZE, sorted, i,
+                            false == mapView.find(&absent, KEY + 1));
+                    ASSERTV(SIZE, sorted, i, absent.isNull());
+                }
+                ASSERTV(SIZE, dam.isTotalSame());
+
+                ManagedDatum copy(Util::toDatum(view, &ta), &ta);
+                ASSERTV(SIZE, sorted, copy == map);
+                ASSERTV(SIZE, sorted,
+                        map->theIntMap().isSorted() ==
+                                             copy->theIntMap().isSorted());
+            }
+        }
+
+        if (verbose) cout << "\tEmpty keys and nested containers." << endl;
+        {
+            DatumMapOwningKeysBuilder builder(&ta);
+            builder.pushBack("", Datum::createInteger(1));
+            builder.pushBack("a", makeTree(4, 2, &ta));
+            builder.pushBack("b", makeMap(0, false, &ta));
+            builder.pushBack("c", makeIntMap(0, false, &ta));
+            builder.pushBack("d", makeArrayOfScalars(0, &ta));
+            ManagedDatum map(builder.commit(), &ta);
+
+            bsl::vector<char> encoding(&ta);
+            ASSERT(0 == Util::encode(&encoding, map));
+
+            DatumView view;
+            ASSERT(0 == Util::view(&view, encoding.data(), encoding.size()));
+            ASSERT(isSame(view, *map));
+
+            DatumView result;
+            ASSERT(view.theMap().find(&result, ""));
+            ASSERT(1 == result.theInteger());
+            ASSERT(view.theMap().find(&result, "b"));
+            ASSERT(0 == result.theMap().size());
+            ASSERT(view.theMap().find(&result, "d"));
+            ASSERT(0 == result.theArray().length());
+
+            ManagedDatum copy(Util::toDatum(view, &ta), &ta);
+            ASSERT(copy == map);
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ManagedDatum      array(makeArrayOfScalars(3, &ta), &ta);
+            bsl::vector<char> encoding(&ta);
+            ASSERT(0 == Util::encode(&encoding, array));
+
+            const DatumView      view      = Util::viewUnchecked(
+                                                              encoding.data());
+            const DatumArrayView arrayView = view.theArray();
+
+            ASSERT_SAFE_PASS(arrayView[2]);
+            ASSERT_SAFE_FAIL(arrayView[3]);
+
+            ASSERT_FAIL(view.theMap());
+            ASSERT_FAIL(view.theIntMap());
+            ASSERT_FAIL(view.theString());
+
+            ManagedDatum      map(makeMap(2, true, &ta), &ta);
+            ASSERT(0 == Util::encode(&encoding, map));
+
+            const DatumMapView mapView =
+                                 Util::viewUnchecked(encoding.data()).theMap();
+            DatumView          result;
+
+            ASSERT_SAFE_PASS(mapView.key(1));
+            ASSERT_SAFE_FAIL(mapView.key(2));
+            ASSERT_SAFE_PASS(mapView.value(1));
+            ASSERT_SAFE_FAIL(mapView.value(2));
+            ASSERT_PASS(mapView.find(&result, "k0"));
+            ASSERT_FAIL(mapView.find(0,       "k0"));
+
+            ManagedDatum intMap(makeIntMap(2, true, &ta), &ta);
+            ASSERT(0 == Util::encode(&encoding, intMap));
+
+            const DatumIntMapView intMapView =
+                              Util::viewUnchecked(encoding.data()).theIntMap();
+
+            ASSERT_SAFE_PASS(intMapView.key(1));
+            ASSERT_SAFE_FAIL(intMapView.key(2));
+            ASSERT_SAFE_PASS(intMapView.value(1));
+            ASSERT_SAFE_FAIL(intMapView.value(2));
+            ASSERT_PASS(intMapView.find(&result, 0));
+            ASSERT_FAIL(intMapView.find(0,       0));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING SCALAR VIEWS
+        //
+        // Concerns:
+        //: 1 Every scalar type, including the boundaries of its encoding, is
+        //:   encoded and viewed with the same value, both as the top-level
+        //:   value and as an element of an array.
+        //:
+        //: 2 Exactly one 'is*' accessor returns 'true' for each view.
+        //:
+        //: 3 A default-constructed view refers to a null value.
+        //:
+        //: 4 'toDatum' creates an equal 'Datum' using only the supplied
+        //:   allocator, and all its memory can be released with
+        //:   'Datum::destroy'.
+        //:
+        //: 5 Viewing allocates no memory.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each scalar of 'makeScalar', encode it, view it with 'view'
+        //:   and 'viewUnchecked', and compare the view with the original
+        //:   through all accessors.  Repeat for an array holding the scalar.
+        //:   (C-1..2, 5)
+        //:
+        //: 2 Verify the type of a default-constructed view.  (C-3)
+        //:
+        //: 3 Convert each view with 'toDatum' and compare.  (C-4)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-6)
+        //
+        // Testing:
+        //   int encode(bsl::vector<char> *, const Datum&);
+        //   Datum toDatum(const DatumView&, bslma::Allocator *);
+        //   DatumView viewUnchecked(const char *);
+        //   DatumView();
+        //   bool is*() const;
+        //   the*() const;
+        //   Datum::DataType type() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING SCALAR VIEWS" << endl
+                          << "====================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        {
+            const DatumView X;
+            ASSERT(Datum::e_NIL == X.type());
+            ASSERT(X.isNull());
+        }
+
+        for (int ti = 0; ti < NUM_SCALARS; ++ti) {
+            ManagedDatum scalar(makeScalar(ti, &ta), &ta);
+
+            if (veryVerbose) { T_ P_(ti) P(*scalar) }
+
+            for (int nested = 0; nested < 2; ++nested) {
+                ManagedDatum datum(&ta);
+                if (nested) {
+                    DatumArrayBuilder builder(1, &ta);
+                    builder.pushBack(makeScalar(ti, &ta));
+                    datum.adopt(builder.commit());
+                }
+                else {
+                    datum.adopt(makeScalar(ti, &ta));
+                }
+
+                bsl::vector<char> encoding(&ta);
+                ASSERTV(ti, 0 == Util::encode(&encoding, datum));
+                ASSERTV(ti, 0 == encoding.size() % 8 ||
+                            Datum::e_STRING == scalar->type() ||
+                            Datum::e_BINARY == scalar->type() ||
+                            Datum::e_ERROR  == scalar->type());
+
+                bslma::TestAllocatorMonitor tam(&ta);
+                bslma::TestAllocatorMonitor dam(&da);
+
+                DatumView view;
+                ASSERTV(ti, 0 == Util::view(&view,
+                                            encoding.data(),
+                                            encoding.size()));
+                if (nested) {
+                    ASSERTV(ti, view.isArray());
+                    ASSERTV(ti, 1 == view.theArray().length());
+                    view = view.theArray()[0];
+                }
+                else {
+                    const DatumView unchecked =
+                                         Util::viewUnchecked(encoding.data());
+                    ASSERTV(ti, isSame(unchecked, *scalar));
+                }
+
+                ASSERTV(ti, scalar->type() == view.type());
+                ASSERTV(ti, isSame(view, *scalar));
+
+                const int numTrue = view.isNull()
+                                  + view.isInteger()
+                                  + view.isDouble()
+                                  + view.isString()
+                                  + view.isBoolean()
+                                  + view.isError()
+                                  + view.isDate()
+                                  + view.isTime()
+                                  + view.isDatetime()
+                                  + view.isDatetimeInterval()
+                                  + view.isInteger64()
+                                  + view.isArray()
+                                  + view.isMap()
+                                  + view.isBinary()
+                                  + view.isDecimal64()
+                                  + view.isIntMap();
+                ASSERTV(ti, 1 == numTrue);
+
+                ASSERTV(ti, tam.isTotalSame());
+                ASSERTV(ti, dam.isTotalSame());
+
+                bslma::TestAllocator ca("copy", veryVeryVerbose);
+                {
+                    Datum copy = Util::toDatum(view, &ca);
+                    ASSERTV(ti, *scalar == copy);
+                    Datum::destroy(copy, &ca);
+                }
+                ASSERTV(ti, 0 == ca.numBytesInUse());
+                ASSERTV(ti, dam.isTotalSame());
+            }
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bsl::vector<char> encoding(&ta);
+            ASSERT(0 == Util::encode(&encoding, Datum::createInteger(5)));
+
+            const DatumView view = Util::viewUnchecked(encoding.data());
+
+            ASSERT_PASS(view.theInteger());
+            ASSERT_FAIL(view.theInteger64());
+            ASSERT_FAIL(view.theDouble());
+            ASSERT_FAIL(view.theBoolean());
+            ASSERT_FAIL(view.theDate());
+            ASSERT_FAIL(view.theArray());
+
+            ASSERT_FAIL(Util::viewUnchecked(0));
+
+            ASSERT_PASS(Util::toDatum(view, &ta));
+            ASSERT_FAIL(Util::toDatum(view, 0));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Encode a nested 'Datum', view it, look up values, and convert it
+        //:   back.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        ManagedDatum tree(makeTree(3, 3, &ta), &ta);
+
+        bsl::vector<char> encoding(&ta);
+        ASSERT(0 == Util::encode(&encoding, tree));
+
+        if (veryVerbose) { P(encoding.size()) }
+
+        DatumView view;
+        ASSERT(0 == Util::view(&view, encoding.data(), encoding.size()));
+        ASSERT(view.isArray());
+        ASSERT(3 == view.theArray().length());
+        ASSERT(isSame(view, *tree));
+
+        DatumView inner = view.theArray()[2].theIntMap().value(1);
+        ASSERT(inner.isMap());
+
+        DatumView leaf;
+        ASSERT(inner.theMap().find(&leaf, "key2"));
+        ManagedDatum expected(makeScalar(3, &ta), &ta);
+        ASSERT(isSame(leaf, *expected));
+
+        ManagedDatum copy(Util::toDatum(view, &ta), &ta);
+        ASSERT(copy == tree);
+
+        if (veryVerbose) { P(view) }
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE OF ENCODING AND LOOKUP
+        //
+        // Concerns:
+        //: 1 Encoding is faster than deep-copying a 'Datum' tree.
+        //:
+        //: 2 Viewing a verified encoding and looking up a value in it is
+        //:   cheaper than decoding it.
+        //
+        // Plan:
+        //: 1 Build a tree of records similar to a typical JSON document, and
+        //:   time, per iteration: 'encode', 'clone', 'view' (including
+        //:   verification), 'viewUnchecked' followed by a lookup, 'toDatum',
+        //:   and a full traversal of the view.  An optional argument gives
+        //:   the number of records.  (C-1..2)
+        //
+        // Testing:
+        //   PERFORMANCE OF ENCODING AND LOOKUP
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE OF ENCODING AND LOOKUP" << endl
+                          << "==================================" << endl;
+
+        const int NUM_RECORDS = verbose ? atoi(argv[2]) : 1000;
+
+        bslma::Allocator *allocator = bslma::Default::allocator(0);
+
+        DatumArrayBuilder records(NUM_RECORDS, allocator);
+        for (int i = 0; i < NUM_RECORDS; ++i) {
+            DatumMapOwningKeysBuilder record(allocator);
+            char                      name[32];
+            bsl::sprintf(name, "instrument-%06d", i);
+            record.pushBack("id",       Datum::createInteger(i));
+            record.pushBack("name",     Datum::copyString(name, allocator));
+            record.pushBack("price",    Datum::createDouble(100.0 + i / 8.0));
+            record.pushBack("size",     Datum::createInteger(i * 100));
+            record.pushBack("active",   Datum::createBoolean(i % 2));
+            record.pushBack("tags",     makeArrayOfScalars(4, allocator));
+            records.pushBack(record.sortAndCommit());
+        }
+        ManagedDatum tree(records.commit(), allocator);
+
+        bsl::vector<char> encoding;
+        ASSERT(0 == Util::encode(&encoding, tree));
+
+        const int ITERATIONS = bsl::max(1, 2000000 / NUM_RECORDS / 10);
+
+        cout << "records: " << NUM_RECORDS
+             << ", encoded bytes: " << encoding.size()
+             << ", iterations: " << ITERATIONS << endl;
+
+        bsls::Stopwatch timer;
+
+        timer.start(true);
+        for (int i = 0; i < ITERATIONS; ++i) {
+            Util::encode(&encoding, tree);
+        }
+        timer.stop();
+        cout << "encode:                 "
+             << timer.accumulatedWallTime() * 1e6 / ITERATIONS << " us\n";
+
+        timer.reset();
+        timer.start(true);
+        for (int i = 0; i < ITERATIONS; ++i) {
+            Datum::destroy(tree->clone(allocator), allocator);
+        }
+        timer.stop();
+        cout << "Datum clone+destroy:    "
+             << timer.accumulatedWallTime() * 1e6 / ITERATIONS << " us\n";
+
+        DatumView view;
+        timer.reset();
+        timer.start(true);
+        for (int i = 0; i < ITERATIONS; ++i) {
+            Util::view(&view, encoding.data(), encoding.size());
+        }
+        timer.stop();
+        cout << "view (verified):        "
+             << timer.accumulatedWallTime() * 1e6 / ITERATIONS << " us\n";
+
+        Int64 sum = 0;
+        timer.reset();
+        timer.start(true);
+        for (int i = 0; i < ITERATIONS * 1000; ++i) {
+            const DatumView record = Util::viewUnchecked(encoding.data())
+                                              .theArray()[i % NUM_RECORDS];
+            DatumView       price;
+            if (record.theMap().find(&price, "price")) {
+                sum += static_cast<Int64>(price.theDouble());
+            }
+        }
+        timer.stop();
+        cout << "viewUnchecked + find:   "
+             << timer.accumulatedWallTime() * 1e9 / ITERATIONS / 1000
+             << " ns\n";
+
+        timer.reset();
+        timer.start(true);
+        for (int i = 0; i < ITERATIONS; ++i) {
+            Datum::destroy(Util::toDatum(view, allocator), allocator);
+        }
+        timer.stop();
+        cout << "toDatum+destroy:        "
+             << timer.accumulatedWallTime() * 1e6 / ITERATIONS << " us\n";
+
+        timer.reset();
+        timer.start(true);
+        for (int i = 0; i < ITERATIONS; ++i) {
+            sum += traverse(view);
+        }
+        timer.stop();
+        cout << "traverse view:          "
+             << timer.accumulatedWallTime() * 1e6 / ITERATIONS << " us\n";
+
+        if (veryVerbose) { P(sum) }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
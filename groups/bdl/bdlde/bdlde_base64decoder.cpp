@@ -16,6 +16,12 @@ BSLS_IDENT_RCSID(bdlde_base64decoder_cpp,"$Id$ $CSID$")
 
 #include <bsls_assert.h>
 
+#include <bsl_cstring.h>
+
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+
 namespace BloombergLP {
 
                 // ======================
@@ -93,6 +99,81 @@ static const char decoding[256] = {
        ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // F0
 };
 
+                        // ===========================
+                        // FILE-SCOPE STATIC FUNCTIONS
+                        // ===========================
+
+#if defined(__SSSE3__)
+static inline __m128i inRange(__m128i characters, char first, char last)
+    // Return a mask having all bits set in each byte of the specified
+    // 'characters' that is in the range '[first .. last]', and no bits set in
+    // the other bytes.  Note that the comparison is signed, so no byte having
+    // its high bit set is in a range of ASCII characters.
+{
+    return _mm_and_si128(
+                     _mm_cmpgt_epi8(characters, _mm_set1_epi8(first - 1)),
+                     _mm_cmplt_epi8(characters, _mm_set1_epi8(last + 1)));
+}
+
+static bool decodeBlock(char *output, const char *input)
+    // Decode the 16 characters starting at the specified 'input' address into
+    // 12 bytes written to the specified 'output' buffer if all 16 characters
+    // are numeric Base64 characters.  Return 'true' if the characters were
+    // decoded, and 'false' (without writing to 'output') otherwise.
+{
+    const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i *>(
+                                                                      input));
+
+    const __m128i upper = inRange(in, 'A', 'Z');
+    const __m128i lower = inRange(in, 'a', 'z');
+    const __m128i digit = inRange(in, '0', '9');
+    const __m128i plus  = _mm_cmpeq_epi8(in, _mm_set1_epi8('+'));
+    const __m128i slash = _mm_cmpeq_epi8(in, _mm_set1_epi8('/'));
+
+    const __m128i valid = _mm_or_si128(_mm_or_si128(upper, lower),
+                                       _mm_or_si128(_mm_or_si128(digit, plus),
+                                                    slash));
+    if (0xffff != _mm_movemask_epi8(valid)) {
+        return false;                                                 // RETURN
+    }
+
+    // Translate each character to its 6-bit value by adding the offset of its
+    // range.
+
+    __m128i offset = _mm_and_si128(upper, _mm_set1_epi8(-'A'));
+    offset = _mm_or_si128(offset,
+                          _mm_and_si128(lower, _mm_set1_epi8(26 - 'a')));
+    offset = _mm_or_si128(offset,
+                          _mm_and_si128(digit, _mm_set1_epi8(52 - '0')));
+    offset = _mm_or_si128(offset,
+                          _mm_and_si128(plus,  _mm_set1_epi8(62 - '+')));
+    offset = _mm_or_si128(offset,
+                          _mm_and_si128(slash, _mm_set1_epi8(63 - '/')));
+
+    const __m128i values = _mm_add_epi8(in, offset);
+
+    // Merge each group of four 6-bit values into a 24-bit value in a 32-bit
+    // lane, then gather the three bytes of each lane in big-endian order.
+
+    const __m128i pairs  = _mm_maddubs_epi16(values,
+                                             _mm_set1_epi32(0x01400140));
+    const __m128i groups = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+    const __m128i bytes  = _mm_shuffle_epi8(groups,
+                                            _mm_setr_epi8( 2,  1,  0,
+                                                           6,  5,  4,
+                                                          10,  9,  8,
+                                                          14, 13, 12,
+                                                          -1, -1, -1, -1));
+
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(output), bytes);
+
+    const int last = _mm_cvtsi128_si32(_mm_srli_si128(bytes, 8));
+    bsl::memcpy(output + 8, &last, 4);
+
+    return true;
+}
+#endif
+
 namespace bdlde {
 
                          // -------------------
@@ -106,6 +187,86 @@ const bool *const Base64Decoder::s_ignorableRelaxed_p =
                                             charsThatCanBeIgnoredInRelaxedMode;
 const char *const Base64Decoder::s_decoding_p = decoding;
 
+// CLASS METHODS
+int Base64Decoder::decodeBuffer(char       *output,
+                                int        *numOut,
+                                const char *input,
+                                int         inputLength,
+                                bool        unrecognizedIsErrorFlag)
+{
+    BSLS_ASSERT(output || 0 == inputLength);
+    BSLS_ASSERT(numOut);
+    BSLS_ASSERT(input  || 0 == inputLength);
+    BSLS_ASSERT(0 <= inputLength);
+
+    const bool *ignorable = unrecognizedIsErrorFlag
+                          ? charsThatCanBeIgnoredInStrictMode
+                          : charsThatCanBeIgnoredInRelaxedMode;
+
+    const char *in  = input;
+    const char *end = input + inputLength;
+    char       *out = output;
+
+    // Decode complete quanta of four numeric characters (possibly separated
+    // by ignorable characters) until the padding, an invalid character, or an
+    // incomplete final quantum is reached.
+
+    for (;;) {
+#if defined(__SSSE3__)
+        while (16 <= end - in && decodeBlock(out, in)) {
+            in  += 16;
+            out += 12;
+        }
+#endif
+
+        const char   *quantum  = in;
+        unsigned int  stack    = 0;
+        int           numChars = 0;
+
+        while (in != end && 4 != numChars) {
+            const unsigned char byte      = static_cast<unsigned char>(*in);
+            const unsigned char converted = static_cast<unsigned char>(
+                                                               decoding[byte]);
+
+            if (converted < 64) {
+                stack = (stack << 6) | converted;
+                ++numChars;
+            }
+            else if (!ignorable[byte]) {
+                break;
+            }
+            ++in;
+        }
+
+        if (4 != numChars) {
+            in = quantum;
+            break;
+        }
+
+        out[0] = static_cast<char>(stack >> 16);
+        out[1] = static_cast<char>(stack >>  8);
+        out[2] = static_cast<char>(stack);
+        out   += 3;
+    }
+
+    // Since only complete quanta have been consumed, a new decoder resumes in
+    // the state the streaming decoder would be in at this point.
+
+    Base64Decoder decoder(unrecognizedIsErrorFlag);
+    int           numConverted;
+    int           numIn;
+    int           numEnd = 0;
+
+    int rc = decoder.convert(out, &numConverted, &numIn, in, end);
+    if (0 <= rc) {
+        rc = decoder.endConvert(out + numConverted, &numEnd);
+    }
+
+    *numOut = static_cast<int>(out - output) + numConverted + numEnd;
+
+    return rc < 0 ? -1 : 0;
+}
+
 
 // CREATORS
 
@@ -153,6 +153,17 @@ BSLS_IDENT("$Id: $")
 // bytes) of the initial input data sequence before encoding was evenly
 // divisible by 3.
 //
+///Decoding Contiguous Buffers
+///---------------------------
+// When the entire input is available in a single contiguous buffer, the
+// 'decodeBuffer' class method can be used instead of a decoder object.  It
+// produces exactly the same output, and detects exactly the same errors, as a
+// newly-constructed decoder to which the input is supplied by a single call
+// to 'convert' followed by a call to 'endConvert'.  On platforms supporting
+// SSSE3, runs of 16 numeric Base64 characters are validated and decoded
+// together using vector comparisons and shuffles; whitespace, padding, and
+// other characters are handled one character at a time.
+//
 ///Usage
 ///-----
 // The following example shows how to use a 'bdlde::Base64Decoder' object to
@@ -461,6 +472,26 @@ class Base64Decoder {
         // 'convert' method of this decoder.  The behavior is undefined unless
         // '0 <= inputLength'.
 
+    static int decodeBuffer(char       *output,
+                            int        *numOut,
+                            const char *input,
+                            int         inputLength,
+                            bool        unrecognizedIsErrorFlag);
+        // Decode the specified 'inputLength' characters starting at the
+        // specified 'input' address as a complete Base64 encoding, writing the
+        // resulting bytes to the specified 'output' buffer and loading into
+        // the specified 'numOut' the number of bytes written.  Unrecognized
+        // characters (i.e., non-base64 characters other than whitespace) are
+        // treated as errors if the specified 'unrecognizedIsErrorFlag' is
+        // 'true', and ignored otherwise.  Return 0 on success, and a negative
+        // value if the input is not a valid encoding, in which case the
+        // contents of 'output' are unspecified.  The behavior is undefined
+        // unless 'output' can hold at least 'maxDecodedLength(inputLength)'
+        // bytes and '0 <= inputLength'.  Note that the result is identical to
+        // that of a decoder constructed with 'unrecognizedIsErrorFlag' that is
+        // supplied 'input' by a single call to 'convert' followed by a call to
+        // 'endConvert'.
+
     // CREATORS
     explicit
     Base64Decoder(bool unrecognizedIsErrorFlag);
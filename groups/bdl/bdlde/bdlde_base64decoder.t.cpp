@@ -16,6 +16,7 @@
 
 #include <bslma_testallocator.h>
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>
@@ -28,6 +29,7 @@
 #include <bsl_fstream.h>
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
+#include <bsl_string.h>
 #include <bsl_vector.h>
 
 #include <stdio.h>
@@ -198,6 +200,7 @@ using bsl::flush;
 // [ 3] bool isInitialState() const;
 // [ 2] bool isUnrecognizedAnError() const;
 // [ 3] int outputLength() const;
+// [12] static int decodeBuffer(char *, int *, const char *, int, bool);
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST -- (developer's sandbox)
 //*[11] USAGE EXAMPLE
@@ -1269,6 +1272,68 @@ bool base64OrEquals(char c)
     return ret;
 }
 
+}  // close namespace u
+}  // close unnamed namespace
+
+                    // ---------------------------------------
+                    // Functions Used by 'decodeBuffer' Test
+                    // ---------------------------------------
+
+namespace {
+namespace u {
+
+void checkDecodeBuffer(int         line,
+                       const char *input,
+                       int         length,
+                       bool        unrecognizedIsErrorFlag)
+    // Decode the specified 'length' characters at the specified 'input'
+    // address using both a 'Base64Decoder' object configured with the
+    // specified 'unrecognizedIsErrorFlag' and 'Base64Decoder::decodeBuffer',
+    // and assert, reporting the specified 'line' on failure, that the results
+    // agree and that 'decodeBuffer' writes no more than 'maxDecodedLength'
+    // bytes.
+{
+    const char GUARD   = '\x7f';
+    const int  MAX_OUT = Obj::maxDecodedLength(length);
+
+    bsl::vector<char> expected(MAX_OUT + 1, GUARD);
+    bsl::vector<char> result(MAX_OUT + 1, GUARD);
+
+    Obj mX(unrecognizedIsErrorFlag);
+    int numOut;
+    int numIn;
+    int numEnd = 0;
+
+    int expRc = mX.convert(expected.data(),
+                           &numOut,
+                           &numIn,
+                           input,
+                           input + length);
+    if (0 <= expRc) {
+        expRc = mX.endConvert(expected.data() + numOut, &numEnd);
+    }
+
+    int       resultLength = -1;
+    const int rc           = Obj::decodeBuffer(result.data(),
+                                               &resultLength,
+                                               input,
+                                               length,
+                                               unrecognizedIsErrorFlag);
+
+    ASSERTV(line, unrecognizedIsErrorFlag, expRc, rc,
+            (0 == expRc) == (0 == rc));
+    ASSERTV(line, rc, 0 == rc || 0 > rc);
+    ASSERTV(line, GUARD == result[MAX_OUT]);
+
+    if (0 == expRc && 0 == rc) {
+        ASSERTV(line, numOut + numEnd, resultLength,
+                numOut + numEnd == resultLength);
+        ASSERTV(line, 0 == bsl::memcmp(expected.data(),
+                                       result.data(),
+                                       resultLength));
+    }
+}
+
 }  // close namespace u
 }  // close unnamed namespace
 
@@ -1937,6 +2002,123 @@ void testCase##NUMBER(bool verbose,                                           \
                       bool veryVeryVerbose,                                   \
                       bool veryVeryVeryVerbose)
 
+DEFINE_TEST_CASE(12)
+{
+        (void)veryVeryVerbose;
+        (void)veryVeryVeryVerbose;
+
+        // --------------------------------------------------------------------
+        // TESTING 'decodeBuffer'
+        //
+        // Concerns:
+        //: 1 'decodeBuffer' reports success for exactly those inputs for which
+        //:   a decoder object supplied the same input by one call to 'convert'
+        //:   followed by 'endConvert' reports success, in both strict and
+        //:   relaxed modes.
+        //:
+        //: 2 On success, the output of 'decodeBuffer' is identical to that of
+        //:   the decoder object.
+        //:
+        //: 3 No byte past 'maxDecodedLength(inputLength)' is written.
+        //:
+        //: 4 Characters that are not numeric Base64 characters are handled
+        //:   identically wherever they occur, in particular within a block of
+        //:   characters that would otherwise be decoded by the vectorized
+        //:   path.
+        //
+        // Plan:
+        //: 1 Encode pseudo-random input of each length in [0 .. 150] with a
+        //:   set of maximum line lengths (including 0 and lengths that are not
+        //:   a multiple of 4), and check each encoding using
+        //:   'u::checkDecodeBuffer'.  (C-1..3)
+        //:
+        //: 2 For each encoding from P-1 of input no longer than 48 bytes,
+        //:   replace the character at each position by each of a set of
+        //:   characters (padding, whitespace, unrecognized characters,
+        //:   and characters with the high bit set), and check the result
+        //:   using 'u::checkDecodeBuffer'.  (C-1..4)
+        //:
+        //: 3 Check each encoding from P-1 truncated by 1 to 3 characters and
+        //:   extended with additional padding.  (C-1..3)
+        //
+        // Testing:
+        //   static int decodeBuffer(char *, int *, const char *, int, bool);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'decodeBuffer'" << endl
+                          << "======================" << endl;
+
+        const int LINE_LENGTHS[] = { 0, 4, 7, 16, 76 };
+        const int NUM_LINE_LENGTHS = sizeof LINE_LENGTHS
+                                                      / sizeof *LINE_LENGTHS;
+
+        const char REPLACEMENTS[] = { '=', ' ', '\n', '@', '\0', '\x80',
+                                      '\xff', 'A', '/', '{', '`', '[', ':' };
+        const int  NUM_REPLACEMENTS = sizeof REPLACEMENTS;
+
+        const int MAX_LENGTH = 150;
+
+        char input[MAX_LENGTH];
+        unsigned int seed = 12345;
+        for (int i = 0; i < MAX_LENGTH; ++i) {
+            seed = seed * 1103515245 + 12345;
+            input[i] = static_cast<char>(seed >> 16);
+        }
+
+        for (int ti = 0; ti < NUM_LINE_LENGTHS; ++ti) {
+            const int LINE = LINE_LENGTHS[ti];
+
+            if (veryVerbose) { T_ P(LINE) }
+
+            for (int len = 0; len <= MAX_LENGTH; ++len) {
+                bsl::string encoded(
+                             bdlde::Base64Encoder::encodedLength(len, LINE),
+                             '\0');
+
+                bdlde::Base64Encoder::encodeBuffer(&encoded[0],
+                                                   input,
+                                                   len,
+                                                   LINE);
+
+                const int ENC_LEN = static_cast<int>(encoded.length());
+
+                for (int strict = 0; strict < 2; ++strict) {
+                    u::checkDecodeBuffer(L_, encoded.data(), ENC_LEN, strict);
+
+                    for (int k = 1; k <= 3 && k <= ENC_LEN; ++k) {
+                        u::checkDecodeBuffer(L_,
+                                             encoded.data(),
+                                             ENC_LEN - k,
+                                             strict);
+                    }
+
+                    const bsl::string PADDED = encoded + "=";
+                    u::checkDecodeBuffer(L_,
+                                         PADDED.data(),
+                                         static_cast<int>(PADDED.length()),
+                                         strict);
+
+                    if (48 < len) {
+                        continue;
+                    }
+
+                    for (int pos = 0; pos < ENC_LEN; ++pos) {
+                        for (int ri = 0; ri < NUM_REPLACEMENTS; ++ri) {
+                            bsl::string mutated(encoded);
+                            mutated[pos] = REPLACEMENTS[ri];
+
+                            u::checkDecodeBuffer(L_,
+                                                 mutated.data(),
+                                                 ENC_LEN,
+                                                 strict);
+                        }
+                    }
+                }
+            }
+        }
+}
+
 DEFINE_TEST_CASE(11)
 {
         (void)veryVeryVerbose;
@@ -6321,6 +6503,101 @@ DEFINE_TEST_CASE(1)
 
       }
 
+void testCaseMinus1(bool verbose,
+                    bool veryVerbose,
+                    bool veryVeryVerbose,
+                    bool veryVeryVeryVerbose)
+{
+        (void)veryVerbose;
+        (void)veryVeryVerbose;
+        (void)veryVeryVeryVerbose;
+
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: 'decodeBuffer'
+        //
+        // Concerns:
+        //: 1 'decodeBuffer' is faster than a decoder object supplied the same
+        //:   contiguous input.
+        //
+        // Plan:
+        //: 1 Repeatedly decode the encoding of a 1MB buffer of pseudo-random
+        //:   bytes, with and without line breaks, using both a decoder object
+        //:   and 'decodeBuffer', and report the throughput of each.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: 'decodeBuffer'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST: 'decodeBuffer'" << endl
+                          << "================================" << endl;
+
+        const int INPUT_LENGTH   = 1 << 20;
+        const int NUM_ITERATIONS = 200;
+
+        bsl::vector<char> input(INPUT_LENGTH);
+        unsigned int      seed = 12345;
+        for (int i = 0; i < INPUT_LENGTH; ++i) {
+            seed = seed * 1103515245 + 12345;
+            input[i] = static_cast<char>(seed >> 16);
+        }
+
+        const int LINE_LENGTHS[] = { 0, 76 };
+
+        for (int ti = 0; ti < 2; ++ti) {
+            const int LINE = LINE_LENGTHS[ti];
+
+            bsl::vector<char> encoded(
+                    bdlde::Base64Encoder::encodedLength(INPUT_LENGTH, LINE));
+            bdlde::Base64Encoder::encodeBuffer(encoded.data(),
+                                               input.data(),
+                                               INPUT_LENGTH,
+                                               LINE);
+
+            const int ENC_LEN = static_cast<int>(encoded.size());
+
+            bsl::vector<char> output(Obj::maxDecodedLength(ENC_LEN));
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                Obj mX(true);
+                int numOut;
+                int numIn;
+                int numEnd;
+
+                mX.convert(output.data(),
+                           &numOut,
+                           &numIn,
+                           encoded.data(),
+                           encoded.data() + ENC_LEN);
+                mX.endConvert(output.data() + numOut, &numEnd);
+            }
+            timer.stop();
+            const double streamTime = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                int numOut;
+
+                Obj::decodeBuffer(output.data(),
+                                  &numOut,
+                                  encoded.data(),
+                                  ENC_LEN,
+                                  true);
+            }
+            timer.stop();
+            const double bufferTime = timer.elapsedTime();
+
+            const double MB = static_cast<double>(NUM_ITERATIONS);
+
+            cout << "maxLineLength = " << LINE
+                 << ": convert/endConvert " << MB / streamTime << " MB/s"
+                 << ", decodeBuffer " << MB / bufferTime << " MB/s" << endl;
+        }
+}
+
 #undef DEFINE_TEST_CASE
 // ============================================================================
 //                               MAIN PROGRAM
@@ -6345,6 +6622,7 @@ int main(int argc, char *argv[])
   case NUMBER: testCase##NUMBER(verbose, veryVerbose, veryVeryVerbose,        \
                                                     veryVeryVeryVerbose); break
 
+        CASE(12);
         CASE(11);
         CASE(10);
         CASE(9);
@@ -6357,6 +6635,8 @@ int main(int argc, char *argv[])
         CASE(2);
         CASE(1);
 #undef CASE
+      case -1: testCaseMinus1(verbose, veryVerbose, veryVeryVerbose,
+                              veryVeryVeryVerbose); break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
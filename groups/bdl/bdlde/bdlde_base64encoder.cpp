@@ -14,6 +14,10 @@ BSLS_IDENT_RCSID(bdlde_base64encoder_cpp,"$Id$ $CSID$")
 
 #include <bsls_assert.h>
 
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+
 namespace BloombergLP {
 
                 // ======================
@@ -35,6 +39,91 @@ static const char enc[] = {
     '4', '5', '6', '7', '8', '9', '+', '/',  // 070
 };
 
+                        // ===========================
+                        // FILE-SCOPE STATIC FUNCTIONS
+                        // ===========================
+
+#if defined(__SSSE3__)
+static void encodeBlock(char *output, const unsigned char *input)
+    // Encode the 12 bytes starting at the specified 'input' address into 16
+    // Base64 characters written to the specified 'output' buffer.  The
+    // behavior is undefined unless 16 bytes are readable at 'input'.
+{
+    __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input));
+
+    // Spread each 3-byte group over a 32-bit lane, and move each of its four
+    // 6-bit fields into a separate byte of that lane.
+
+    in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7,
+                                           4,  5,  3, 4,  1, 2, 0, 1));
+
+    const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+    const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+    const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+    const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+    const __m128i indices = _mm_or_si128(t1, t3);
+
+    // Map each 6-bit index to the offset of its range of characters: 13 for
+    // 'A'..'Z', 0 for 'a'..'z', 1-10 for '0'..'9', 11 for '+', and 12 for
+    // '/'.
+
+    __m128i range = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    range = _mm_or_si128(range,
+                         _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26),
+                                                      indices),
+                                       _mm_set1_epi8(13)));
+
+    const __m128i offsets = _mm_setr_epi8('a' - 26,
+                                          '0' - 52, '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52, '0' - 52,
+                                          '0' - 52,
+                                          '+' - 62,
+                                          '/' - 63,
+                                          'A',
+                                          0, 0);
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(output),
+                     _mm_add_epi8(indices, _mm_shuffle_epi8(offsets, range)));
+}
+#endif
+
+static char *encodeGroups(char                *output,
+                          const unsigned char *input,
+                          int                  numGroups,
+                          const unsigned char *inputEnd)
+    // Encode the specified 'numGroups' 3-byte groups starting at the specified
+    // 'input' address into '4 * numGroups' Base64 characters written to the
+    // specified 'output' buffer, and return the address one past the last
+    // character written.  The specified 'inputEnd' is the end of the readable
+    // input, which may extend past the groups being encoded.
+{
+#if defined(__SSSE3__)
+    while (4 <= numGroups && 16 <= inputEnd - input) {
+        encodeBlock(output, input);
+        input     += 12;
+        output    += 16;
+        numGroups -= 4;
+    }
+#else
+    (void)inputEnd;
+#endif
+
+    for (; 0 < numGroups; --numGroups) {
+        const unsigned int group = input[0] << 16 | input[1] << 8 | input[2];
+
+        output[0] = enc[ group >> 18        ];
+        output[1] = enc[(group >> 12) & 0x3f];
+        output[2] = enc[(group >>  6) & 0x3f];
+        output[3] = enc[ group        & 0x3f];
+
+        input  += 3;
+        output += 4;
+    }
+
+    return output;
+}
+
 namespace bdlde {
 
                          // -------------------
@@ -45,6 +134,69 @@ namespace bdlde {
 const char *const Base64Encoder::s_encodedChars_p       = enc;
 const int         Base64Encoder::s_defaultMaxLineLength = 76;
 
+// CLASS METHODS
+int Base64Encoder::encodeBuffer(char       *output,
+                                const char *input,
+                                int         inputLength,
+                                int         maxLineLength)
+{
+    BSLS_ASSERT(output || 0 == inputLength);
+    BSLS_ASSERT(input  || 0 == inputLength);
+    BSLS_ASSERT(0 <= inputLength);
+    BSLS_ASSERT(0 <= maxLineLength);
+
+    if (0 != maxLineLength % 4) {
+        // Line breaks fall within 4-character quanta; defer to the state
+        // machine.
+
+        Base64Encoder encoder(maxLineLength);
+        int           numOut;
+        int           numIn;
+        int           numEnd;
+
+        encoder.convert(output, &numOut, &numIn, input, input + inputLength);
+        encoder.endConvert(output + numOut, &numEnd);
+
+        return numOut + numEnd;                                       // RETURN
+    }
+
+    const unsigned char *in  = reinterpret_cast<const unsigned char *>(input);
+    const unsigned char *end = in + inputLength;
+    char                *out = output;
+
+    int       numGroups     = inputLength / 3;
+    const int groupsPerLine = maxLineLength ? maxLineLength / 4 : numGroups;
+
+    while (0 < numGroups) {
+        const int n = numGroups < groupsPerLine ? numGroups : groupsPerLine;
+
+        out        = encodeGroups(out, in, n, end);
+        in        += 3 * n;
+        numGroups -= n;
+
+        // A soft line break precedes the next character of a full line.
+
+        if (0 != maxLineLength && n == groupsPerLine && in != end) {
+            *out++ = '\r';
+            *out++ = '\n';
+        }
+    }
+
+    if (in != end) {
+        // Encode the final 1 or 2 bytes, which always fit on the current line.
+
+        const unsigned int group = end - in == 2 ? in[0] << 16 | in[1] << 8
+                                                 : in[0] << 16;
+
+        *out++ = enc[ group >> 18        ];
+        *out++ = enc[(group >> 12) & 0x3f];
+        *out++ = end - in == 2 ? enc[(group >> 6) & 0x3f] : '=';
+        *out++ = '=';
+    }
+
+    return static_cast<int>(out - output);
+}
+
 // CREATORS
 Base64Encoder::~Base64Encoder()
 {
@@ -153,6 +153,17 @@ BSLS_IDENT("$Id: $")
 // bytes) of the initial input data sequence before encoding was evenly
 // divisible by 3.
 //
+///Encoding Contiguous Buffers
+///---------------------------
+// When the entire input is available in a single contiguous buffer, the
+// 'encodeBuffer' class methods can be used instead of an encoder object.  They
+// produce exactly the same output as a newly-constructed encoder having the
+// same maximum line length to which the input is supplied by a single call to
+// 'convert' followed by a call to 'endConvert', but avoid the per-character
+// state machine.  On platforms supporting SSSE3, lines whose length is a
+// multiple of 4 (including unlimited lines) are encoded 12 input bytes at a
+// time using vector shuffles.
+//
 ///Usage
 ///-----
 // The following example shows how to use a 'bdlde::Base64Encoder' object to
@@ -498,6 +509,26 @@ class Base64Encoder {
         // from an encoder having the specified 'maxLineLength' would be an
         // acceptable input to a 'Base64Decoder', and 'false' otherwise.
 
+    static int encodeBuffer(char       *output,
+                            const char *input,
+                            int         inputLength);
+    static int encodeBuffer(char       *output,
+                            const char *input,
+                            int         inputLength,
+                            int         maxLineLength);
+        // Encode the specified 'inputLength' bytes starting at the specified
+        // 'input' address, writing the resulting characters (including the
+        // terminating padding) to the specified 'output' buffer.  Optionally
+        // specify the 'maxLineLength' of the output; if 'maxLineLength' is
+        // not specified, a maximum line length of 76 characters is used.
+        // Return the number of characters written, which is always
+        // 'encodedLength(inputLength, maxLineLength)'.  The behavior is
+        // undefined unless 'output' can hold at least that many characters,
+        // '0 <= inputLength', and '0 <= maxLineLength'.  Note that the output
+        // is identical to that of an encoder constructed with 'maxLineLength'
+        // that is supplied 'input' by a single call to 'convert' followed by
+        // a call to 'endConvert'.
+
     // CREATORS
     Base64Encoder();
         // Create a Base64 encoder in the initial state, defaulting the maximum
@@ -737,6 +768,14 @@ bool Base64Encoder::isResidualOutput(int numBytes, int maxLineLength)
     return 0 != (numBytes - adj) % 4;
 }
 
+inline
+int Base64Encoder::encodeBuffer(char       *output,
+                                const char *input,
+                                int         inputLength)
+{
+    return encodeBuffer(output, input, inputLength, s_defaultMaxLineLength);
+}
+
 // CREATORS
 inline
 Base64Encoder::Base64Encoder()
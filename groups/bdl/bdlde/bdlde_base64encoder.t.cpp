@@ -15,6 +15,7 @@
 #include <bsls_assert.h>
 #include <bsls_objectbuffer.h>
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
 
 #include <bsl_algorithm.h>
 #include <bsl_cctype.h>    // isgraph(), isalpha()
@@ -118,6 +119,8 @@ using bsl::flush;
 // [ 3] bool isInitialState() const;
 // [ 2] int maxLineLength() const;
 // [ 3] int outputLength() const;
+// [14] static int encodeBuffer(char *, const char *, int);
+// [14] static int encodeBuffer(char *, const char *, int, int);
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST -- (developer's sandbox)
 //*[11] USAGE EXAMPLE
@@ -1665,6 +1668,111 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 14: {
+        // --------------------------------------------------------------------
+        // TESTING 'encodeBuffer'
+        //
+        // Concerns:
+        //: 1 The output of 'encodeBuffer' is identical to that of an encoder
+        //:   having the same maximum line length that is supplied the same
+        //:   input by one call to 'convert' followed by 'endConvert'.
+        //:
+        //: 2 The value returned is 'encodedLength(inputLength, maxLineLength)'
+        //:   and no character past that length is written.
+        //:
+        //: 3 Every byte value is encoded correctly in every position of a
+        //:   3-byte group, including by the vectorized path.
+        //:
+        //: 4 The 3-argument overload uses a maximum line length of 76.
+        //
+        // Plan:
+        //: 1 For each input length in [0 .. 200], pseudo-random input, and
+        //:   a set of line lengths (including 0, lengths that are not a
+        //:   multiple of 4, and lengths shorter than one vector block), encode
+        //:   with 'encodeBuffer' into a buffer filled with a guard character
+        //:   and compare with the output of an encoder object.  (C-1..2)
+        //:
+        //: 2 Repeat P-1 with input consisting of every byte value, rotated so
+        //:   that each value appears at each position of a group.  (C-3)
+        //:
+        //: 3 Compare the output of the 3-argument overload with that of the
+        //:   4-argument overload given 76.  (C-4)
+        //
+        // Testing:
+        //   static int encodeBuffer(char *, const char *, int);
+        //   static int encodeBuffer(char *, const char *, int, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'encodeBuffer'" << endl
+                          << "======================" << endl;
+
+        const int LINE_LENGTHS[] = { 0, 1, 2, 3, 4, 5, 7, 8, 12, 16, 17, 20,
+                                     64, 76, 77, 128 };
+        const int NUM_LINE_LENGTHS = sizeof LINE_LENGTHS
+                                                      / sizeof *LINE_LENGTHS;
+
+        const char GUARD = '\x7f';
+        const int  MAX_LENGTH = 256 + 3;
+
+        char input[MAX_LENGTH];
+        char expected[5 * MAX_LENGTH];
+        char result[5 * MAX_LENGTH];
+
+        for (int pass = 0; pass < 4; ++pass) {
+            unsigned int seed = 12345;
+            for (int i = 0; i < MAX_LENGTH; ++i) {
+                if (0 == pass) {
+                    seed = seed * 1103515245 + 12345;
+                    input[i] = static_cast<char>(seed >> 16);
+                }
+                else {
+                    input[i] = static_cast<char>(i + pass - 1);
+                }
+            }
+
+            if (veryVerbose) { T_ P(pass) }
+
+            for (int ti = 0; ti < NUM_LINE_LENGTHS; ++ti) {
+                const int LINE = LINE_LENGTHS[ti];
+
+                for (int len = 0; len <= MAX_LENGTH; ++len) {
+                    Obj mX(LINE);
+                    int numOut;
+                    int numIn;
+                    int numEnd;
+
+                    mX.convert(expected, &numOut, &numIn, input, input + len);
+                    mX.endConvert(expected + numOut, &numEnd);
+
+                    const int EXP_LEN = numOut + numEnd;
+
+                    bsl::memset(result, GUARD, sizeof result);
+
+                    const int rc = Obj::encodeBuffer(result, input, len, LINE);
+
+                    ASSERTV(LINE, len, Obj::encodedLength(len, LINE) == rc);
+                    ASSERTV(LINE, len, EXP_LEN, rc, EXP_LEN == rc);
+                    ASSERTV(LINE, len, 0 == bsl::memcmp(expected,
+                                                        result,
+                                                        EXP_LEN));
+                    ASSERTV(LINE, len, GUARD == result[rc]);
+
+                    if (76 == LINE) {
+                        bsl::memset(result, GUARD, sizeof result);
+
+                        ASSERTV(len, rc == Obj::encodeBuffer(result,
+                                                             input,
+                                                             len));
+                        ASSERTV(len, 0 == bsl::memcmp(expected,
+                                                      result,
+                                                      EXP_LEN));
+                        ASSERTV(len, GUARD == result[rc]);
+                    }
+                }
+            }
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // TESTING OPTIONAL NUMIN, NUMOUT
@@ -4009,6 +4117,80 @@ LOOP4_ASSERT(LINE, index, totalOut, localTotalOut, totalOut == localTotalOut);
         }
 
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: 'encodeBuffer'
+        //
+        // Concerns:
+        //: 1 'encodeBuffer' is faster than an encoder object supplied the
+        //:   same contiguous input.
+        //
+        // Plan:
+        //: 1 Repeatedly encode a 1MB buffer of pseudo-random bytes, with and
+        //:   without line breaks, using both an encoder object and
+        //:   'encodeBuffer', and report the throughput of each.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: 'encodeBuffer'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST: 'encodeBuffer'" << endl
+                          << "================================" << endl;
+
+        const int INPUT_LENGTH   = 1 << 20;
+        const int NUM_ITERATIONS = 200;
+
+        bsl::vector<char> input(INPUT_LENGTH);
+        unsigned int      seed = 12345;
+        for (int i = 0; i < INPUT_LENGTH; ++i) {
+            seed = seed * 1103515245 + 12345;
+            input[i] = static_cast<char>(seed >> 16);
+        }
+
+        const int LINE_LENGTHS[] = { 0, 76 };
+
+        for (int ti = 0; ti < 2; ++ti) {
+            const int LINE = LINE_LENGTHS[ti];
+
+            bsl::vector<char> output(Obj::encodedLength(INPUT_LENGTH, LINE));
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                Obj mX(LINE);
+                int numOut;
+                int numIn;
+                int numEnd;
+
+                mX.convert(output.data(),
+                           &numOut,
+                           &numIn,
+                           input.data(),
+                           input.data() + INPUT_LENGTH);
+                mX.endConvert(output.data() + numOut, &numEnd);
+            }
+            timer.stop();
+            const double streamTime = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                Obj::encodeBuffer(output.data(),
+                                  input.data(),
+                                  INPUT_LENGTH,
+                                  LINE);
+            }
+            timer.stop();
+            const double bufferTime = timer.elapsedTime();
+
+            const double MB = static_cast<double>(NUM_ITERATIONS);
+
+            cout << "maxLineLength = " << LINE
+                 << ": convert/endConvert " << MB / streamTime << " MB/s"
+                 << ", encodeBuffer " << MB / bufferTime << " MB/s" << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
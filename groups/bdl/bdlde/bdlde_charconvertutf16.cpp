@@ -13,17 +13,23 @@
 BSLS_IDENT("$Id$ $CSID$")
 
 #include <bdlde_charconvertstatus.h>
+#include <bdlde_utf8util.h>
 
 #include <bsla_maybeunused.h>
 #include <bslmf_assert.h>
 #include <bslmf_issame.h>
 #include <bsls_assert.h>
 #include <bsls_byteorderutil.h>
+#include <bsls_platform.h>
 
 #include <bsl_algorithm.h>  // 'min'
 #include <bsl_climits.h>    // 'CHAR_BIT'
 #include <bsl_cstdint.h>    // 'WCHAR_WIDTH'
 
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+#include <emmintrin.h>
+#endif
+
 ///IMPLEMENTATION NOTES
 ///--------------------
 // This UTF-8 documentation was copied verbatim from RFC 3629.  The original
@@ -325,13 +331,22 @@ struct Capacity {
     void operator--() { --d_capacity; }
         // Decrement 'd_capacity'.
 
-    void operator-=(int delta) { d_capacity -= delta; }
+    void operator-=(bsl::size_t delta) { d_capacity -= delta; }
         // Decrement 'd_capacity' by the specified 'delta'.
 
     // ACCESSORS
     bool operator<(bsl::size_t rhs) const { return d_capacity < rhs; }
         // Return 'true' if 'd_capacity' is less than the specified 'rhs', and
         // 'false' otherwise.
+
+    bsl::size_t limit(bsl::size_t numWords) const
+        // Return the lesser of the specified 'numWords' and the number of
+        // single-unit code points that can be written while leaving room for
+        // the terminating null.  The behavior is undefined unless
+        // '0 < d_capacity'.
+    {
+        return bsl::min(numWords, d_capacity - 1);
+    }
 };
 
 struct NoOpCapacity {
@@ -345,12 +360,15 @@ struct NoOpCapacity {
     void operator--() {}
         // No-op.
 
-    void operator-=(int) {}
+    void operator-=(bsl::size_t) {}
         // No-op.
 
     // ACCESSORS
     bool operator<(bsl::size_t) const { return false; }
         // Return 'false'.
+
+    bsl::size_t limit(bsl::size_t numWords) const { return numWords; }
+        // Return the specified 'numWords'.
 };
 
 // LOCAL HELPER STRUCT
@@ -404,6 +422,16 @@ struct Utf8 {
         {}
 
         // ACCESSORS
+        bsl::size_t numAvailable(const OctetType *position) const
+            // Return the number of octets from the specified 'position' to
+            // the end of input.  The behavior is undefined unless
+            // 'position <= d_end'.
+        {
+            BSLS_ASSERT(d_end >= position);
+
+            return d_end - position;
+        }
+
         bool isFinished(const OctetType *position) const
             // Return 'true' if the specified 'position' is at the end of
             // input, and 'false' otherwise.  The behavior is undefined unless
@@ -472,6 +500,15 @@ struct Utf8 {
         }
 
         // ACCESSORS
+        bsl::size_t numAvailable(const OctetType *) const
+            // Return 1.  The caller must already have established that the
+            // octet at the position passed is not the terminating null; the
+            // input beyond it cannot be examined without searching for the
+            // null, and reading ahead of the null is not safe.
+        {
+            return 1;
+        }
+
         bool isFinished(const OctetType *position) const
             // Return 'true' if the specified 'position' is at the end of
             // input, and 'false' otherwise.
@@ -739,6 +776,16 @@ struct Utf16 {
             // 'end'.
 
         // ACCESSORS
+        bsl::size_t numAvailable(const UTF16_WORD *utf16Buf) const
+            // Return the number of words from the specified 'utf16Buf' to the
+            // end of input.  The behavior is undefined unless
+            // 'utf16Buf <= d_end'.
+        {
+            BSLS_ASSERT(d_end >= utf16Buf);
+
+            return d_end - utf16Buf;
+        }
+
         bool isFinished(const UTF16_WORD *utf16Buf) const
             // Return 'true' if the specified 'utf16Buf' is at the end of
             // input, and 'false' otherwise.
@@ -766,6 +813,13 @@ struct Utf16 {
         }
 
         // ACCESSORS
+        bsl::size_t numAvailable(const UTF16_WORD *) const
+            // Return 1.  The caller must already have established that the
+            // word at the position passed is not the terminating null.
+        {
+            return 1;
+        }
+
         bool isFinished(const UTF16_WORD *u16Buf) const
             // Return 'true' if the specified 'utf16Buf' is at the end of
             // input, and 'false' otherwise.
@@ -1012,6 +1066,234 @@ struct NoOpSwapper {
 BSLMF_ASSERT(sizeof(wchar_t)                  >= sizeof(unsigned short));
 BSLMF_ASSERT(sizeof(bsl::wstring::value_type) >= sizeof(unsigned short));
 
+// 'widenAscii', 'numAsciiWords', and 'narrowAscii' functions
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Runs of 7-bit ASCII, which dominate typical input, translate one unit for
+// one unit in either direction.  These functions translate such runs in bulk.
+// The generic templates are simple loops that the optimizer can unroll; for
+// 'unsigned short' words on platforms having SSE2, overloads process 16 units
+// per iteration.  Note that the overloads for 'Swapper' and 'NoOpSwapper'
+// differ only in which byte of each word holds the ASCII value.
+
+template <class UTF16_WORD, class SWAPPER>
+inline
+void widenAscii(UTF16_WORD            *dstBuffer,
+                const Utf8::OctetType *srcBuffer,
+                bsl::size_t            numOctets,
+                SWAPPER                 )
+    // Write to the specified 'dstBuffer' the UTF-16 words, swapped as
+    // prescribed by 'SWAPPER', encoding the specified 'numOctets' ASCII
+    // octets at the specified 'srcBuffer'.  The behavior is undefined unless
+    // every octet in the input is 7-bit ASCII.
+{
+    for (bsl::size_t ii = 0; ii < numOctets; ++ii) {
+        dstBuffer[ii] = SWAPPER::encodeSingleWord(srcBuffer[ii]);
+    }
+}
+
+template <class UTF16_WORD, class SWAPPER>
+inline
+bsl::size_t numAsciiWords(const UTF16_WORD *srcBuffer,
+                          bsl::size_t       numWords,
+                          SWAPPER            )
+    // Return the number of words, among the specified 'numWords' words,
+    // swapped as prescribed by 'SWAPPER', at the start of the specified
+    // 'srcBuffer' that precede the first word whose value is not 7-bit ASCII.
+{
+    bsl::size_t ii = 0;
+    while (ii < numWords
+        && Utf16::isSingleUtf8(SWAPPER::decodeSingleWord(srcBuffer + ii))) {
+        ++ii;
+    }
+    return ii;
+}
+
+template <class UTF16_WORD, class SWAPPER>
+inline
+void narrowAscii(char             *dstBuffer,
+                 const UTF16_WORD *srcBuffer,
+                 bsl::size_t       numWords,
+                 SWAPPER            )
+    // Write to the specified 'dstBuffer' the UTF-8 octets encoding the
+    // specified 'numWords' ASCII words, swapped as prescribed by 'SWAPPER', at
+    // the specified 'srcBuffer'.  The behavior is undefined unless every word
+    // in the input is 7-bit ASCII.
+{
+    for (bsl::size_t ii = 0; ii < numWords; ++ii) {
+        dstBuffer[ii] = static_cast<char>(
+                                  SWAPPER::decodeSingleWord(srcBuffer + ii));
+    }
+}
+
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+
+template <bool SWAPPED>
+bsl::size_t widenAsciiSse2(unsigned short        *dstBuffer,
+                           const Utf8::OctetType *srcBuffer,
+                           bsl::size_t            numOctets)
+    // Write to the specified 'dstBuffer' the UTF-16 words, in swapped byte
+    // order if 'SWAPPED' is 'true' and in host byte order otherwise, encoding
+    // the greatest multiple of 16 not exceeding the specified 'numOctets' of
+    // the ASCII octets at the specified 'srcBuffer', and return that number.
+{
+    const __m128i zero = _mm_setzero_si128();
+
+    bsl::size_t ii = 0;
+    for (; ii + 16 <= numOctets; ii += 16) {
+        const __m128i octets = _mm_loadu_si128(
+                          reinterpret_cast<const __m128i *>(srcBuffer + ii));
+
+        // Interleaving with zero bytes widens each octet to a word; the
+        // operand order determines which byte of the word holds the octet.
+
+        const __m128i lo = SWAPPED ? _mm_unpacklo_epi8(zero, octets)
+                                   : _mm_unpacklo_epi8(octets, zero);
+        const __m128i hi = SWAPPED ? _mm_unpackhi_epi8(zero, octets)
+                                   : _mm_unpackhi_epi8(octets, zero);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dstBuffer + ii), lo);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dstBuffer + ii + 8), hi);
+    }
+    return ii;
+}
+
+template <bool SWAPPED>
+bsl::size_t numAsciiWordsSse2(const unsigned short *srcBuffer,
+                              bsl::size_t           numWords)
+    // Return the greatest multiple of 8 not exceeding the specified
+    // 'numWords' such that all that many words at the start of the specified
+    // 'srcBuffer', in swapped byte order if 'SWAPPED' is 'true' and in host
+    // byte order otherwise, are 7-bit ASCII.
+{
+    const __m128i mask = _mm_set1_epi16(static_cast<short>(
+                                                   SWAPPED ? 0x80ff : 0xff80));
+    const __m128i zero = _mm_setzero_si128();
+
+    bsl::size_t ii = 0;
+    for (; ii + 8 <= numWords; ii += 8) {
+        const __m128i words = _mm_loadu_si128(
+                          reinterpret_cast<const __m128i *>(srcBuffer + ii));
+        const __m128i ascii = _mm_cmpeq_epi16(_mm_and_si128(words, mask),
+                                              zero);
+        if (0xffff != _mm_movemask_epi8(ascii)) {
+            break;
+        }
+    }
+    return ii;
+}
+
+template <bool SWAPPED>
+bsl::size_t narrowAsciiSse2(char                 *dstBuffer,
+                            const unsigned short *srcBuffer,
+                            bsl::size_t           numWords)
+    // Write to the specified 'dstBuffer' the UTF-8 octets encoding the
+    // greatest multiple of 16 not exceeding the specified 'numWords' of the
+    // ASCII words, in swapped byte order if 'SWAPPED' is 'true' and in host
+    // byte order otherwise, at the specified 'srcBuffer', and return that
+    // number.
+{
+    bsl::size_t ii = 0;
+    for (; ii + 16 <= numWords; ii += 16) {
+        __m128i lo = _mm_loadu_si128(
+                          reinterpret_cast<const __m128i *>(srcBuffer + ii));
+        __m128i hi = _mm_loadu_si128(
+                          reinterpret_cast<const __m128i *>(srcBuffer + ii + 8));
+        if (SWAPPED) {
+            lo = _mm_srli_epi16(lo, 8);
+            hi = _mm_srli_epi16(hi, 8);
+        }
+
+        // Every word is less than 0x80, so the saturating pack is exact.
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dstBuffer + ii),
+                         _mm_packus_epi16(lo, hi));
+    }
+    return ii;
+}
+
+inline
+void widenAscii(unsigned short              *dstBuffer,
+                const Utf8::OctetType       *srcBuffer,
+                bsl::size_t                  numOctets,
+                NoOpSwapper<unsigned short>  swapper)
+{
+    const bsl::size_t done = widenAsciiSse2<false>(dstBuffer,
+                                                   srcBuffer,
+                                                   numOctets);
+    widenAscii<unsigned short>(dstBuffer + done,
+                               srcBuffer + done,
+                               numOctets - done,
+                               swapper);
+}
+
+inline
+void widenAscii(unsigned short          *dstBuffer,
+                const Utf8::OctetType   *srcBuffer,
+                bsl::size_t              numOctets,
+                Swapper<unsigned short>  swapper)
+{
+    const bsl::size_t done = widenAsciiSse2<true>(dstBuffer,
+                                                  srcBuffer,
+                                                  numOctets);
+    widenAscii<unsigned short>(dstBuffer + done,
+                               srcBuffer + done,
+                               numOctets - done,
+                               swapper);
+}
+
+inline
+bsl::size_t numAsciiWords(const unsigned short        *srcBuffer,
+                          bsl::size_t                  numWords,
+                          NoOpSwapper<unsigned short>  swapper)
+{
+    const bsl::size_t done = numAsciiWordsSse2<false>(srcBuffer, numWords);
+    return done + numAsciiWords<unsigned short>(srcBuffer + done,
+                                                numWords - done,
+                                                swapper);
+}
+
+inline
+bsl::size_t numAsciiWords(const unsigned short    *srcBuffer,
+                          bsl::size_t              numWords,
+                          Swapper<unsigned short>  swapper)
+{
+    const bsl::size_t done = numAsciiWordsSse2<true>(srcBuffer, numWords);
+    return done + numAsciiWords<unsigned short>(srcBuffer + done,
+                                                numWords - done,
+                                                swapper);
+}
+
+inline
+void narrowAscii(char                        *dstBuffer,
+                 const unsigned short        *srcBuffer,
+                 bsl::size_t                  numWords,
+                 NoOpSwapper<unsigned short>  swapper)
+{
+    const bsl::size_t done = narrowAsciiSse2<false>(dstBuffer,
+                                                    srcBuffer,
+                                                    numWords);
+    narrowAscii<unsigned short>(dstBuffer + done,
+                                srcBuffer + done,
+                                numWords - done,
+                                swapper);
+}
+
+inline
+void narrowAscii(char                    *dstBuffer,
+                 const unsigned short    *srcBuffer,
+                 bsl::size_t              numWords,
+                 Swapper<unsigned short>  swapper)
+{
+    const bsl::size_t done = narrowAsciiSse2<true>(dstBuffer,
+                                                   srcBuffer,
+                                                   numWords);
+    narrowAscii<unsigned short>(dstBuffer + done,
+                                srcBuffer + done,
+                                numWords - done,
+                                swapper);
+}
+
+#endif  // BSLS_PLATFORM_CPU_SSE2
+
 // These template functions should be in the unnamed namespace, because if they
 // are declared static, you have to fully specialize them every time you call
 // them.
@@ -1041,8 +1323,11 @@ bsl::size_t utf16BufferLength(const char  *srcBuffer,
                                           static_cast<const void*>(srcBuffer));
     while (!endFunctor.isFinished(octets)) {
         if      (Utf8::isSingleOctet(     *octets)) {
-            ++octets;
-            ++wordsNeeded;
+            const bsl::size_t numAscii = BloombergLP::bdlde::Utf8Util::
+                numAsciiBytes(reinterpret_cast<const char *>(octets),
+                              endFunctor.numAvailable(octets));
+            octets      += numAscii;
+            wordsNeeded += numAscii;
         }
         else if (Utf8::isTwoOctetHeader(  *octets)) {
             octets += endFunctor.verifyContinuations(octets + 1, 1) ? 2 : 1;
@@ -1176,11 +1461,20 @@ int localUtf8ToUtf16(UTF16_WORD       *dstBuffer,
                 break;
             }
 
-            *dstBuffer = SWAPPER::encodeSingleWord(*octets);
-            ++octets;
-            ++dstBuffer;
-            --dstCapacity;
-            ++nCodePoints;
+            // Translate the whole run of ASCII that fits, which includes at
+            // least '*octets'.
+
+            const bsl::size_t numAscii = BloombergLP::bdlde::Utf8Util::
+                numAsciiBytes(reinterpret_cast<const char *>(octets),
+                              dstCapacity.limit(
+                                             endFunctor.numAvailable(octets)));
+            BSLS_ASSERT(0 < numAscii);
+
+            widenAscii(dstBuffer, octets, numAscii, swapper);
+            octets      += numAscii;
+            dstBuffer   += numAscii;
+            dstCapacity -= numAscii;
+            nCodePoints += numAscii;
             continue;
         }
 
@@ -1384,8 +1678,12 @@ bsl::size_t utf8BufferLength(const UTF16_WORD *srcBuffer,
         word0 = SWAPPER::decodeSingleWord(srcBuffer);
 
         if      (Utf16::isSingleUtf8(word0)) {
-            ++srcBuffer;
-            ++bytesNeeded;
+            const bsl::size_t numAscii = numAsciiWords(
+                                            srcBuffer,
+                                            endFunctor.numAvailable(srcBuffer),
+                                            swapper);
+            srcBuffer   += numAscii;
+            bytesNeeded += numAscii;
         }
         else if (Utf16::isSingleWord(word0)) {
             ++srcBuffer;
@@ -1474,11 +1772,21 @@ int localUtf16ToUtf8(char             *dstBuffer,
                 returnStatus |= OUT_OF_SPACE_BIT;
                 break;
             }
-            *dstBuffer = Utf16::getUtf8Value(word0);
-            ++srcBuffer;
-            ++dstBuffer;
-            --dstCapacity;
-            ++nCodePoints;
+            // Translate the whole run of ASCII that fits, which includes at
+            // least 'word0'.
+
+            const bsl::size_t numAscii = numAsciiWords(
+                             srcBuffer,
+                             dstCapacity.limit(
+                                           endFunctor.numAvailable(srcBuffer)),
+                             swapper);
+            BSLS_ASSERT(0 < numAscii);
+
+            narrowAscii(dstBuffer, srcBuffer, numAscii, swapper);
+            srcBuffer   += numAscii;
+            dstBuffer   += numAscii;
+            dstCapacity -= numAscii;
+            nCodePoints += numAscii;
             continue;
         }
 
@@ -128,8 +128,9 @@ using namespace bsl;
 // Exercise boundary cases for both of the conversion mappings as well as
 // handling of buffer capacity issues.
 //-----------------------------------------------------------------------------
-// [15] USAGE EXAMPLE 2
-// [14] USAGE EXAMPLE 1
+// [16] USAGE EXAMPLE 2
+// [15] USAGE EXAMPLE 1
+// [14] ASCII RUN TEST
 // [13] BACKWARDS BYTE ORDER TEST
 // [12] EMBEDDED ZEROES TEST
 // [11] UTF-16 -> UTF-8: THOROUGH BROKEN GLASS TEST
@@ -4448,7 +4449,7 @@ int main(int argc, char**argv)
     bslma::DefaultAllocatorGuard daGuard(&da);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 15: {
+      case 16: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 2
         // --------------------------------------------------------------------
@@ -4574,7 +4575,7 @@ int main(int argc, char**argv)
     ASSERT(utf16CodePointsWritten       == uf8CodePointsWritten);
 //..
       } break;
-      case 14: {
+      case 15: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 1
         // --------------------------------------------------------------------
@@ -4667,6 +4668,152 @@ int main(int argc, char**argv)
     ASSERT(0    == secondUtf16String[5]);
 //..
       } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // ASCII RUN TEST
+        //
+        // Concerns:
+        //: 1 Runs of ASCII in input whose length is known are translated
+        //:   several units at a time in both directions; the results,
+        //:   including status, counts, and the handling of insufficient
+        //:   capacity, are identical to those obtained from null-terminated
+        //:   input, which is translated one unit at a time.
+        //:
+        //: 2 Both byte orders are handled.
+        //
+        // Plan:
+        //: 1 For ASCII strings of lengths up to 80, optionally with a 2-byte
+        //:   or 3-byte code point, or an invalid octet, at each position,
+        //:   translate from UTF-8 to UTF-16 with every output capacity up to
+        //:   the required size, passing the input both as a 'StringRef' and
+        //:   as a null-terminated string, and in both byte orders, and verify
+        //:   that the results are identical.  (C-1..2)
+        //:
+        //: 2 Translate each complete UTF-16 result back to UTF-8 similarly,
+        //:   passing the input both with a length and null-terminated, and
+        //:   verify that the results are identical.  (C-1..2)
+        //
+        // Testing:
+        //   ASCII RUN TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "ASCII RUN TEST\n"
+                             "==============\n";
+
+        enum { k_MAX_LEN = 80, k_BUF_SIZE = k_MAX_LEN + 8 };
+
+        static const char *const INSERTS[] = {
+            "", "\xc3\xa9", "\xe2\x82\xac", "\xff", "\x80"
+        };
+        enum { k_NUM_INSERTS = sizeof INSERTS / sizeof *INSERTS };
+
+        const bdlde::ByteOrder::Enum ORDERS[] = {
+            bdlde::ByteOrder::e_HOST, bdlde::ByteOrder::e_NETWORK
+        };
+
+        for (int len = 0; len <= k_MAX_LEN; ++len) {
+            for (int ii = 0; ii < k_NUM_INSERTS; ++ii) {
+                const int NUM_POS = ii ? len + 1 : 1;
+                for (int pos = 0; pos < NUM_POS; ++pos) {
+                    char src[k_BUF_SIZE];
+                    for (int jj = 0; jj < pos; ++jj) {
+                        src[jj] = static_cast<char>('a' + jj % 26);
+                    }
+                    bsl::strcpy(src + pos, INSERTS[ii]);
+                    const int INSLEN = static_cast<int>(
+                                                  bsl::strlen(INSERTS[ii]));
+                    for (int jj = pos; jj < len; ++jj) {
+                        src[jj + INSLEN] = static_cast<char>('A' + jj % 26);
+                    }
+                    const int SRCLEN = len + INSLEN;
+                    src[SRCLEN] = 0;
+
+                    const bslstl::StringRef SRCREF(src, SRCLEN);
+
+                    for (int oi = 0; oi < 2; ++oi) {
+                        const bdlde::ByteOrder::Enum ORDER = ORDERS[oi];
+
+                        for (int cap = 0; cap <= SRCLEN + 1; ++cap) {
+                            unsigned short expBuf[k_BUF_SIZE];
+                            unsigned short buf[k_BUF_SIZE];
+                            bsl::fill(expBuf, expBuf + k_BUF_SIZE, 0xbeef);
+                            bsl::fill(buf,    buf    + k_BUF_SIZE, 0xbeef);
+
+                            bsl::size_t expCp = 0, expWords = 0;
+                            bsl::size_t cp    = 0, words    = 0;
+
+                            const int EXP = Util::utf8ToUtf16(expBuf,
+                                                              cap,
+                                                              src,
+                                                              &expCp,
+                                                              &expWords,
+                                                              '?',
+                                                              ORDER);
+                            const int RC  = Util::utf8ToUtf16(buf,
+                                                              cap,
+                                                              SRCREF,
+                                                              &cp,
+                                                              &words,
+                                                              '?',
+                                                              ORDER);
+
+                            ASSERTV(len, ii, pos, oi, cap, EXP == RC);
+                            ASSERTV(len, ii, pos, oi, cap, expCp == cp);
+                            ASSERTV(len, ii, pos, oi, cap,
+                                    expWords == words);
+                            ASSERTV(len, ii, pos, oi, cap,
+                                    bsl::equal(expBuf,
+                                               expBuf + k_BUF_SIZE,
+                                               buf));
+
+                            if (0 != (EXP & Status::k_OUT_OF_SPACE_BIT)) {
+                                continue;
+                            }
+
+                            // Translate back from the complete result.
+
+                            char expOut[k_BUF_SIZE * 3];
+                            char out[k_BUF_SIZE * 3];
+                            bsl::fill(expOut, expOut + sizeof expOut, 'z');
+                            bsl::fill(out,    out    + sizeof out,    'z');
+
+                            for (int ocap = 0; ocap <= SRCLEN + 2; ++ocap) {
+                                bsl::size_t expOutCp = 0, expBytes = 0;
+                                bsl::size_t outCp    = 0, bytes    = 0;
+
+                                const int EXP2 = Util::utf16ToUtf8(expOut,
+                                                                   ocap,
+                                                                   buf,
+                                                                   &expOutCp,
+                                                                   &expBytes,
+                                                                   '?',
+                                                                   ORDER);
+                                const int RC2  = Util::utf16ToUtf8(out,
+                                                                   ocap,
+                                                                   buf,
+                                                                   words - 1,
+                                                                   &outCp,
+                                                                   &bytes,
+                                                                   '?',
+                                                                   ORDER);
+
+                                ASSERTV(len, ii, pos, oi, ocap,
+                                        EXP2 == RC2);
+                                ASSERTV(len, ii, pos, oi, ocap,
+                                        expOutCp == outCp);
+                                ASSERTV(len, ii, pos, oi, ocap,
+                                        expBytes == bytes);
+                                ASSERTV(len, ii, pos, oi, ocap,
+                                        0 == bsl::memcmp(expOut,
+                                                         out,
+                                                         sizeof out));
+                            }
+                        }
+                    }
+                }
+            }
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // BACKWARDS BYTE ORDER TEST
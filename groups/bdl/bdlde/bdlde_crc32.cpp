@@ -14,7 +14,22 @@ BSLS_IDENT_RCSID(bdlde_crc32_cpp,"$Id$ $CSID$")
 
 #include <bslmf_assert.h>
 
+#include <bslmt_once.h>
+
 #include <bsls_annotation.h>
+#include <bsls_log.h>
+#include <bsls_platform.h>
+
+#if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+#define LIKE_X86_GCC
+#endif
+#endif
+
+#if defined(LIKE_X86_GCC)
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
 
 ///IMPLEMENTATION NOTES
 ///--------------------
@@ -93,6 +108,14 @@ BSLS_IDENT_RCSID(bdlde_crc32_cpp,"$Id$ $CSID$")
 //..
 //  http://ravenphpscripts.com/modules.php?name=Forums&file=viewtopic&t=614
 //..
+// The byte-at-a-time loop is now used only for short inputs.  Longer inputs
+// are processed eight bytes at a time with "slicing-by-8" tables derived from
+// 'CRC_TABLE' (see Kounavis, M.E. and Berry, F.L., "A Systematic Approach to
+// Building High Performance Software-Based CRC Generators", ISCC 2005), or,
+// when the processor supports 'PCLMULQDQ', by folding the input 64 bytes at a
+// time with carry-less multiplication (see Gopal, V. et al., "Fast CRC
+// Computation for Generic Polynomials Using PCLMULQDQ Instruction", Intel,
+// 2009).  'Crc32::combine' uses the technique of zlib's 'crc32_combine'.
 
 #include <bsls_assert.h>
 #include <bsl_ostream.h>
@@ -158,21 +181,41 @@ static const unsigned int CRC_TABLE[256] = {
     0x2d02ef8d
 };
 
-namespace bdlde {
-                                // -----------
-                                // class Crc32
-                                // -----------
+namespace {
 
-// MANIPULATORS
-void Crc32::update(const void *data, bsl::size_t length)
-{
-    BSLS_ASSERT(data || !length);
+typedef unsigned int (*UpdateFn)(unsigned int         crc,
+                                 const unsigned char *data,
+                                 bsl::size_t          length);
+    // 'UpdateFn' is an alias for a function that returns the result of
+    // advancing the specified 'crc' register (i.e., the checksum ^ 0xffffffff)
+    // over the specified 'data' having the specified 'length'.
+
+unsigned int SLICE_TABLE[8][256];
+    // 'SLICE_TABLE[k][i]' is the register contribution of the byte 'i'
+    // followed by 'k' zero bytes; 'SLICE_TABLE[0]' is a copy of 'CRC_TABLE'.
+    // Populated by 'Crc32Calculator'.
 
-    // The following is a Duff's Device-based implementation of a common
-    // algorithm (see end of RFC 1952).
+inline
+unsigned int loadLittleEndian(const unsigned char *data)
+    // Return the 32-bit value whose little-endian representation is the four
+    // bytes at the specified 'data'.
+{
+    return static_cast<unsigned int>(data[0])
+         | static_cast<unsigned int>(data[1]) << 8
+         | static_cast<unsigned int>(data[2]) << 16
+         | static_cast<unsigned int>(data[3]) << 24;
+}
 
-    const unsigned char *d   = (const unsigned char *)data;
-    unsigned int         tmp = d_crc;
+unsigned int updateBytewise(unsigned int         crc,
+                            const unsigned char *data,
+                            bsl::size_t          length)
+    // Return the result of advancing the specified 'crc' register over the
+    // specified 'data' having the specified 'length' one byte at a time.  This
+    // is the algorithm found at the end of RFC 1952, in the form of a Duff's
+    // Device.
+{
+    const unsigned char *d   = data;
+    unsigned int         tmp = crc;
 
     switch (length % 4) {
       case 3: tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
@@ -193,7 +236,288 @@ void Crc32::update(const void *data, bsl::size_t length)
         --n;
     }
 
-    d_crc = tmp;
+    return tmp;
+}
+
+unsigned int updateSlicingBy8(unsigned int         crc,
+                              const unsigned char *data,
+                              bsl::size_t          length)
+    // Return the result of advancing the specified 'crc' register over the
+    // specified 'data' having the specified 'length' eight bytes at a time,
+    // combining eight independent lookups into 'SLICE_TABLE' per step.  The
+    // behavior is undefined unless 'SLICE_TABLE' has been populated.
+{
+    while (length >= 8) {
+        const unsigned int lo = crc ^ loadLittleEndian(data);
+        const unsigned int hi = loadLittleEndian(data + 4);
+
+        crc = SLICE_TABLE[7][ lo        & 0xff]
+            ^ SLICE_TABLE[6][(lo >>  8) & 0xff]
+            ^ SLICE_TABLE[5][(lo >> 16) & 0xff]
+            ^ SLICE_TABLE[4][ lo >> 24        ]
+            ^ SLICE_TABLE[3][ hi        & 0xff]
+            ^ SLICE_TABLE[2][(hi >>  8) & 0xff]
+            ^ SLICE_TABLE[1][(hi >> 16) & 0xff]
+            ^ SLICE_TABLE[0][ hi >> 24        ];
+
+        data   += 8;
+        length -= 8;
+    }
+
+    while (length) {
+        crc = SLICE_TABLE[0][(crc ^ *data++) & 0xff] ^ (crc >> 8);
+        --length;
+    }
+
+    return crc;
+}
+
+#if defined(LIKE_X86_GCC)
+
+__attribute__((target("pclmul,sse2")))
+inline
+__m128i fold(__m128i value, __m128i constants, __m128i next)
+    // Return the specified 'next' 128 bits of input combined with the
+    // specified 'value' (the preceding 128 bits of input) multiplied by the
+    // appropriate power of 'x' modulo the CRC-32 polynomial, as given by the
+    // specified 'constants'.
+{
+    const __m128i lo = _mm_clmulepi64_si128(value, constants, 0x00);
+    const __m128i hi = _mm_clmulepi64_si128(value, constants, 0x11);
+    return _mm_xor_si128(_mm_xor_si128(lo, hi), next);
+}
+
+__attribute__((target("pclmul,sse2")))
+unsigned int updateFolding(unsigned int         crc,
+                           const unsigned char *data,
+                           bsl::size_t          length)
+    // Return the result of advancing the specified 'crc' register over the
+    // specified 'data' having the specified 'length' by folding four 128-bit
+    // lanes with carry-less multiplication, reducing the final 128 bits (and
+    // any remaining bytes) with 'updateSlicingBy8'.  The behavior is undefined
+    // unless 'SLICE_TABLE' has been populated and the 'PCLMULQDQ' instruction
+    // is supported.
+{
+    if (length < 64) {
+        return updateSlicingBy8(crc, data, length);                   // RETURN
+    }
+
+    // The reflected message is treated as a polynomial whose first bit has
+    // the highest degree.  Folding the 128 bits 'C = Chi * x^64 + Clo' forward
+    // over 'F' bits replaces it with 'Chi * (x^(F + 64) mod P) + Clo * (x^F
+    // mod P)', which has the same remainder and fits in 128 bits.  Each
+    // constant below is 'x^(n - 1) mod P' bit-reflected into 64 bits (the
+    // '- 1' compensates for the one-bit offset of a reflected carry-less
+    // product).
+
+    const __m128i k512 = _mm_set_epi64x(
+                                static_cast<long long>(0xcad38e8f00000000ULL),
+                                static_cast<long long>(0x653d982200000000ULL));
+    const __m128i k128 = _mm_set_epi64x(
+                                static_cast<long long>(0x9ba54c6f00000000ULL),
+                                static_cast<long long>(0x65673b4600000000ULL));
+
+    const __m128i *p = reinterpret_cast<const __m128i *>(data);
+
+    __m128i x0 = _mm_xor_si128(_mm_loadu_si128(p),
+                               _mm_cvtsi32_si128(static_cast<int>(crc)));
+    __m128i x1 = _mm_loadu_si128(p + 1);
+    __m128i x2 = _mm_loadu_si128(p + 2);
+    __m128i x3 = _mm_loadu_si128(p + 3);
+    p      += 4;
+    length -= 64;
+
+    while (length >= 64) {
+        x0 = fold(x0, k512, _mm_loadu_si128(p));
+        x1 = fold(x1, k512, _mm_loadu_si128(p + 1));
+        x2 = fold(x2, k512, _mm_loadu_si128(p + 2));
+        x3 = fold(x3, k512, _mm_loadu_si128(p + 3));
+        p      += 4;
+        length -= 64;
+    }
+
+    x0 = fold(x0, k128, x1);
+    x0 = fold(x0, k128, x2);
+    x0 = fold(x0, k128, x3);
+
+    while (length >= 16) {
+        x0 = fold(x0, k128, _mm_loadu_si128(p));
+        ++p;
+        length -= 16;
+    }
+
+    unsigned char remainder[16];
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(remainder), x0);
+
+    crc = updateSlicingBy8(0, remainder, sizeof remainder);
+    return updateSlicingBy8(crc,
+                            reinterpret_cast<const unsigned char *>(p),
+                            length);
+}
+
+#endif  // LIKE_X86_GCC
+
+                           // =====================
+                           // class Crc32Calculator
+                           // =====================
+
+class Crc32Calculator {
+    // This class represents a singleton that populates 'SLICE_TABLE' and
+    // selects the fastest 'UpdateFn' supported by the current processor.
+
+    // CLASS DATA
+    static UpdateFn s_updateFn;     // selected implementation
+    static bool     s_isFolding;    // 'true' if 's_updateFn' uses 'PCLMULQDQ'
+
+    // CREATORS
+    Crc32Calculator();
+        // Create an instance of this class.
+
+    // NOT IMPLEMENTED
+    Crc32Calculator(const Crc32Calculator&);             // = delete;
+    Crc32Calculator& operator=(const Crc32Calculator&);  // = delete;
+
+  public:
+    // CLASS METHODS
+    static const Crc32Calculator& instance();
+        // Return a reference to the singleton object.
+
+    // ACCESSORS
+    unsigned int operator()(unsigned int         crc,
+                            const unsigned char *data,
+                            bsl::size_t          length) const;
+        // Return the result of advancing the specified 'crc' register over the
+        // specified 'data' having the specified 'length' using the selected
+        // implementation.
+
+    bool isFolding() const;
+        // Return 'true' if the selected implementation uses carry-less
+        // multiplication, and 'false' otherwise.
+};
+
+                           // ---------------------
+                           // class Crc32Calculator
+                           // ---------------------
+
+// CLASS DATA
+UpdateFn Crc32Calculator::s_updateFn  = 0;
+bool     Crc32Calculator::s_isFolding = false;
+
+// CREATORS
+Crc32Calculator::Crc32Calculator()
+{
+    for (int i = 0; i < 256; ++i) {
+        unsigned int crc = CRC_TABLE[i];
+        SLICE_TABLE[0][i] = crc;
+        for (int k = 1; k < 8; ++k) {
+            crc = CRC_TABLE[crc & 0xff] ^ (crc >> 8);
+            SLICE_TABLE[k][i] = crc;
+        }
+    }
+
+#if defined(LIKE_X86_GCC)
+    unsigned int eax, ebx, ecx, edx;
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_PCLMUL)) {
+        BSLS_LOG_INFO("Using carry-less multiplication for CRC-32 "
+                      "computation (PCLMULQDQ instruction available)");
+        s_updateFn  = updateFolding;
+        s_isFolding = true;
+        return;                                                       // RETURN
+    }
+    BSLS_LOG_INFO("Using slicing-by-8 for CRC-32 computation (PCLMULQDQ "
+                  "instruction not available)");
+#endif
+    s_updateFn = updateSlicingBy8;
+}
+
+// CLASS METHODS
+const Crc32Calculator& Crc32Calculator::instance()
+{
+    static Crc32Calculator *theInstance_p = 0;
+    BSLMT_ONCE_DO {
+        static Crc32Calculator theInstance;
+        theInstance_p = &theInstance;
+    }
+    return *theInstance_p;
+}
+
+// ACCESSORS
+inline
+unsigned int Crc32Calculator::operator()(unsigned int         crc,
+                                         const unsigned char *data,
+                                         bsl::size_t          length) const
+{
+    return s_updateFn(crc, data, length);
+}
+
+inline
+bool Crc32Calculator::isFolding() const
+{
+    return s_isFolding;
+}
+
+unsigned int multiplyModP(unsigned int a, unsigned int b)
+    // Return the product of the specified 'a' and 'b' modulo the CRC-32
+    // polynomial, where each is a bit-reflected polynomial of degree less than
+    // 32 (i.e., bit 31 holds the coefficient of 'x^0').
+{
+    unsigned int mask    = 0x80000000;
+    unsigned int product = 0;
+    for (;;) {
+        if (a & mask) {
+            product ^= b;
+            if (0 == (a & (mask - 1))) {
+                break;
+            }
+        }
+        mask >>= 1;
+        b = b & 1 ? (b >> 1) ^ 0xedb88320 : b >> 1;
+    }
+    return product;
+}
+
+}  // close unnamed namespace
+
+namespace bdlde {
+                                // -----------
+                                // class Crc32
+                                // -----------
+
+// CLASS METHODS
+unsigned int Crc32::combine(unsigned int crcA,
+                            unsigned int crcB,
+                            bsl::size_t  lengthB)
+{
+    // Appending 'lengthB' bytes to 'A' multiplies its contribution by
+    // 'x^(8 * lengthB)'; the pre- and post-conditioning cancel out.  The power
+    // is accumulated by repeated squaring, starting from 'x^8' (reflected).
+
+    unsigned int power  = 0x00800000;
+    unsigned int result = 0x80000000;
+    while (lengthB) {
+        if (lengthB & 1) {
+            result = multiplyModP(power, result);
+        }
+        power = multiplyModP(power, power);
+        lengthB >>= 1;
+    }
+
+    return multiplyModP(result, crcA) ^ crcB;
+}
+
+// MANIPULATORS
+void Crc32::update(const void *data, bsl::size_t length)
+{
+    BSLS_ASSERT(data || !length);
+
+    const unsigned char *d = static_cast<const unsigned char *>(data);
+
+    if (length < 16) {
+        d_crc = updateBytewise(d_crc, d, length);
+        return;                                                       // RETURN
+    }
+
+    d_crc = Crc32Calculator::instance()(d_crc, d, length);
 }
 
 // ACCESSORS
@@ -223,6 +547,62 @@ bsl::ostream& Crc32::print(bsl::ostream& stream) const
     return stream << array;
 }
 
+                             // -----------------
+                             // struct Crc32_Impl
+                             // -----------------
+
+// CLASS METHODS
+unsigned int Crc32_Impl::calculateBytewise(const void   *data,
+                                           bsl::size_t   length,
+                                           unsigned int  crc)
+{
+    BSLS_ASSERT(data || !length);
+
+    return updateBytewise(crc ^ 0xffffffff,
+                          static_cast<const unsigned char *>(data),
+                          length) ^ 0xffffffff;
+}
+
+unsigned int Crc32_Impl::calculateSlicingBy8(const void   *data,
+                                             bsl::size_t   length,
+                                             unsigned int  crc)
+{
+    BSLS_ASSERT(data || !length);
+
+    Crc32Calculator::instance();  // populate 'SLICE_TABLE'
+
+    return updateSlicingBy8(crc ^ 0xffffffff,
+                            static_cast<const unsigned char *>(data),
+                            length) ^ 0xffffffff;
+}
+
+unsigned int Crc32_Impl::calculateFolding(const void   *data,
+                                          bsl::size_t   length,
+                                          unsigned int  crc)
+{
+    BSLS_ASSERT(data || !length);
+
+    const Crc32Calculator& calculator = Crc32Calculator::instance();
+
+    const unsigned char *d = static_cast<const unsigned char *>(data);
+
+#if defined(LIKE_X86_GCC)
+    if (calculator.isFolding()) {
+        return updateFolding(crc ^ 0xffffffff, d, length) ^ 0xffffffff;
+                                                                      // RETURN
+    }
+#else
+    (void)calculator;
+#endif
+
+    return updateSlicingBy8(crc ^ 0xffffffff, d, length) ^ 0xffffffff;
+}
+
+bool Crc32_Impl::isFoldingSupported()
+{
+    return Crc32Calculator::instance().isFolding();
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
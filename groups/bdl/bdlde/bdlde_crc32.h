@@ -17,8 +17,9 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //  bdlde::Crc32: stores and updates a CRC-32 checksum
+//  bdlde::Crc32_Impl: calculates CRC-32 checksum with alternative impl.
 //
-//@SEE_ALSO:
+//@SEE_ALSO: bdlde_crc32c, bdlde_crc64
 //
 //@DESCRIPTION: This component implements a mechanism for computing, updating,
 // and streaming a CRC-32 checksum (a cyclic redundancy check comprised of 32
@@ -29,6 +30,22 @@ BSLS_IDENT("$Id: $")
 // SHA-256, it is relatively easy to find alternate texts with identical
 // checksum.
 //
+// The 'combine' class method computes the checksum of the concatenation of two
+// messages from the checksums of the individual messages and the length of the
+// second one, so that a large buffer can be checksummed in independent chunks
+// (e.g., by several threads) whose results are then merged.  The struct
+// 'bdlde::Crc32_Impl' exposes the alternative implementations from which
+// 'update' selects, and should not be used other than to test and benchmark.
+//
+///Support for Hardware Acceleration
+///---------------------------------
+// 'update' processes data eight bytes at a time using the "slicing-by-8" table
+// technique.  On x86 platforms built with a compatible compiler, a runtime
+// check is performed, and if the processor supports the carry-less multiply
+// ('PCLMULQDQ') instruction, buffers of 64 bytes or more are instead folded
+// 64 bytes at a time with that instruction.  All implementations produce
+// identical checksums.
+//
 ///Usage
 ///-----
 // The following snippets of code illustrate a typical use of the
@@ -122,6 +139,15 @@ class Crc32 {
 
   public:
     // CLASS METHODS
+    static unsigned int combine(unsigned int crcA,
+                                unsigned int crcB,
+                                bsl::size_t  lengthB);
+        // Return the CRC-32 checksum of the concatenation of a message 'A',
+        // having the specified checksum 'crcA', and a message 'B', having the
+        // specified checksum 'crcB' and the specified 'lengthB' (in bytes).
+        // Note that the length of 'A' is not required, and that the
+        // complexity of this operation is logarithmic in 'lengthB'.
+
     static int maxSupportedBdexVersion(int versionSelector);
         // Return the maximum valid BDEX format version, as indicated by the
         // specified 'versionSelector', to be passed to the 'bdexStreamOut'
@@ -243,6 +269,43 @@ bsl::ostream& operator<<(bsl::ostream& stream, const Crc32& checksum);
     // Write to the specified output 'stream' the specified 'checksum' value
     // and return a reference to the modifiable 'stream'.
 
+                             // =================
+                             // struct Crc32_Impl
+                             // =================
+
+struct Crc32_Impl {
+    // This struct provides alternative implementations of utilities to
+    // calculate a CRC-32 checksum.  Each function returns the checksum of the
+    // concatenation of a message having the specified 'crc' checksum (0 for
+    // the empty message) and the specified 'data' having the specified
+    // 'length' (in bytes).  Note that if 'data' is 0, then 'length' must also
+    // be 0.
+
+    // CLASS METHODS
+    static unsigned int calculateBytewise(const void   *data,
+                                          bsl::size_t   length,
+                                          unsigned int  crc = 0);
+        // Return the checksum described above, computed one byte at a time
+        // using the RFC 1952 table-driven algorithm.
+
+    static unsigned int calculateSlicingBy8(const void   *data,
+                                            bsl::size_t   length,
+                                            unsigned int  crc = 0);
+        // Return the checksum described above, computed eight bytes at a time
+        // using the "slicing-by-8" table-driven algorithm.
+
+    static unsigned int calculateFolding(const void   *data,
+                                         bsl::size_t   length,
+                                         unsigned int  crc = 0);
+        // Return the checksum described above, computed by folding the data
+        // with carry-less multiplication ('PCLMULQDQ') when supported by the
+        // current platform, and as 'calculateSlicingBy8' otherwise.
+
+    static bool isFoldingSupported();
+        // Return 'true' if 'calculateFolding' uses carry-less multiplication
+        // on the current platform, and 'false' otherwise.
+};
+
 // ============================================================================
 //                        INLINE FUNCTION DEFINITIONS
 // ============================================================================
@@ -72,6 +72,7 @@ using namespace bsl;  // automatically added by script
 //
 //-----------------------------------------------------------------------------
 // CLASS METHODS
+// [16] static unsigned int combine(unsigned int, unsigned int, size_t);
 // [10] static int maxSupportedBdexVersion(int);
 //
 // CREATORS
@@ -96,12 +97,19 @@ using namespace bsl;  // automatically added by script
 // [ 6] bool operator==(const bdlde::Crc32& lhs, const bdlde::Crc32& rhs);
 // [ 6] bool operator!=(const bdlde::Crc32& lhs, const bdlde::Crc32& rhs);
 // [ 5] bsl::ostream& operator<<(bsl::ostream& stream, const bdlde::Crc32&);
+//
+// bdlde::Crc32_Impl
+// [15] unsigned int calculateBytewise(const void *, size_t, unsigned int);
+// [15] unsigned int calculateSlicingBy8(const void *, size_t, unsigned int);
+// [15] unsigned int calculateFolding(const void *, size_t, unsigned int);
+// [15] bool isFoldingSupported();
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [15] USAGE EXAMPLE
+// [17] USAGE EXAMPLE
 // [ 2] BOOTSTRAP: void update(const void *data, int length);
 // [14] CRC_TABLE TEST
 // [-1] PERFORMANCE TEST
+// [-2] PERFORMANCE TEST: ALTERNATIVE IMPLEMENTATIONS
 //
 // [ 3] int ggg(bdlde::Crc32 *object, const char *spec, int vF = 1);
 // [ 3] bdlde::Crc32& gg(bdlde::Crc32 *object, const char *spec);
@@ -516,7 +524,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 15: {
+      case 17: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   This will test the usage example provided in the component header
@@ -547,6 +555,181 @@ int main(int argc, char *argv[])
         receiverExample(in);
 
       } break;
+      case 16: {
+        // --------------------------------------------------------------------
+        // TESTING 'combine'
+        //
+        // Concerns:
+        //: 1 'combine(crcA, crcB, lengthB)' returns the checksum of the
+        //:   concatenation of the messages having checksums 'crcA' and 'crcB',
+        //:   where the second message has length 'lengthB'.
+        //:
+        //: 2 Combining with an empty message returns the other checksum.
+        //:
+        //: 3 Checksums of many chunks can be combined in sequence, as when a
+        //:   large buffer is checksummed in parallel.
+        //
+        // Plan:
+        //: 1 For every split point of buffers of pseudo-random bytes, compare
+        //:   'combine' of the checksums of both parts against the checksum of
+        //:   the whole.  (C-1..2)
+        //:
+        //: 2 Split a large buffer into chunks of various sizes, combine the
+        //:   checksums of the chunks, and compare against the checksum of the
+        //:   whole buffer.  (C-3)
+        //
+        // Testing:
+        //   static unsigned int combine(unsigned int, unsigned int, size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'combine'"
+                          << "\n=================" << endl;
+
+        bsl::vector<unsigned char> buffer(1 << 20);
+        unsigned int               seed = 12345;
+        for (bsl::size_t i = 0; i < buffer.size(); ++i) {
+            seed      = seed * 1103515245 + 12345;
+            buffer[i] = static_cast<unsigned char>(seed >> 16);
+        }
+        const unsigned char *DATA = buffer.data();
+
+        if (verbose) cout << "\tSplitting small buffers." << endl;
+
+        for (bsl::size_t length = 0; length <= 300; ++length) {
+            const unsigned int EXP = Obj(DATA, length).checksum();
+
+            for (bsl::size_t split = 0; split <= length; ++split) {
+                const unsigned int A = Obj(DATA, split).checksum();
+                const unsigned int B = Obj(DATA + split,
+                                           length - split).checksum();
+
+                LOOP2_ASSERT(length, split,
+                             EXP == Obj::combine(A, B, length - split));
+            }
+        }
+
+        ASSERT(0x12345678 == Obj::combine(0x12345678, 0, 0));
+        ASSERT(0x12345678 == Obj::combine(0, 0x12345678, 5));
+
+        if (verbose) cout << "\tCombining chunks of a large buffer." << endl;
+
+        const unsigned int EXP = Obj(DATA, buffer.size()).checksum();
+
+        const bsl::size_t CHUNKS[] = { 1, 7, 64, 1000, 4096, 65537, 300000 };
+        const int         NUM_CHUNKS = sizeof CHUNKS / sizeof *CHUNKS;
+
+        for (int ti = 0; ti < NUM_CHUNKS; ++ti) {
+            const bsl::size_t CHUNK = CHUNKS[ti];
+
+            unsigned int crc = 0;
+            for (bsl::size_t offset = 0; offset < buffer.size();
+                                                             offset += CHUNK) {
+                const bsl::size_t length = bsl::min(CHUNK,
+                                                    buffer.size() - offset);
+                crc = Obj::combine(crc,
+                                   Obj(DATA + offset, length).checksum(),
+                                   length);
+            }
+            LOOP_ASSERT(CHUNK, EXP == crc);
+        }
+      } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // TESTING 'Crc32_Impl'
+        //
+        // Concerns:
+        //: 1 The bytewise, slicing-by-8, and folding implementations, and
+        //:   'update', produce identical checksums for all lengths, including
+        //:   the thresholds at which 'update' switches implementation.
+        //:
+        //: 2 The result does not depend on the alignment of the data.
+        //:
+        //: 3 Each implementation correctly continues from a non-zero 'crc'.
+        //:
+        //: 4 The checksum of "123456789" is the standard check value.
+        //
+        // Plan:
+        //: 1 For all lengths up to 1100 bytes and all offsets modulo 16 of
+        //:   a buffer of pseudo-random bytes, compare each implementation
+        //:   against 'calculateBytewise', both from a zero 'crc' and
+        //:   continuing from the checksum of a prefix.  (C-1..3)
+        //:
+        //: 2 Verify the check value with each implementation.  (C-4)
+        //
+        // Testing:
+        //   unsigned int calculateBytewise(const void *, size_t, unsigned);
+        //   unsigned int calculateSlicingBy8(const void *, size_t, unsigned);
+        //   unsigned int calculateFolding(const void *, size_t, unsigned);
+        //   bool isFoldingSupported();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'Crc32_Impl'"
+                          << "\n====================" << endl;
+
+        typedef bdlde::Crc32_Impl Impl;
+
+        if (verbose) {
+            P(Impl::isFoldingSupported());
+        }
+
+        {
+            const char         *CHECK     = "123456789";
+            const unsigned int  CHECK_CRC = 0xcbf43926;
+
+            ASSERT(CHECK_CRC == Impl::calculateBytewise(CHECK, 9));
+            ASSERT(CHECK_CRC == Impl::calculateSlicingBy8(CHECK, 9));
+            ASSERT(CHECK_CRC == Impl::calculateFolding(CHECK, 9));
+            ASSERT(CHECK_CRC == Obj(CHECK, 9).checksum());
+
+            ASSERT(0 == Impl::calculateBytewise(0, 0));
+            ASSERT(0 == Impl::calculateSlicingBy8(0, 0));
+            ASSERT(0 == Impl::calculateFolding(0, 0));
+        }
+
+        enum { k_MAX_LENGTH = 1100, k_PREFIX = 5 };
+
+        unsigned char buffer[k_MAX_LENGTH + 16 + k_PREFIX];
+        unsigned int  seed = 42;
+        for (bsl::size_t i = 0; i < sizeof buffer; ++i) {
+            seed      = seed * 1103515245 + 12345;
+            buffer[i] = static_cast<unsigned char>(seed >> 16);
+        }
+
+        for (int offset = 0; offset < 16; ++offset) {
+            const unsigned char *PREFIX = buffer + offset;
+            const unsigned char *DATA   = PREFIX + k_PREFIX;
+
+            const unsigned int PRE = Impl::calculateBytewise(PREFIX, k_PREFIX);
+
+            for (bsl::size_t length = 0; length <= k_MAX_LENGTH; ++length) {
+                const unsigned int EXP = Impl::calculateBytewise(DATA,
+                                                                 length);
+                const unsigned int EXP_CONT = Impl::calculateBytewise(DATA,
+                                                                      length,
+                                                                      PRE);
+
+                LOOP2_ASSERT(offset, length,
+                             EXP == Impl::calculateSlicingBy8(DATA, length));
+                LOOP2_ASSERT(offset, length,
+                             EXP == Impl::calculateFolding(DATA, length));
+                LOOP2_ASSERT(offset, length,
+                             EXP == Obj(DATA, length).checksum());
+
+                LOOP2_ASSERT(offset, length,
+                             EXP_CONT == Impl::calculateSlicingBy8(DATA,
+                                                                   length,
+                                                                   PRE));
+                LOOP2_ASSERT(offset, length,
+                             EXP_CONT == Impl::calculateFolding(DATA,
+                                                                length,
+                                                                PRE));
+
+                Obj mX(PREFIX, k_PREFIX);
+                mX.update(DATA, length);
+                LOOP2_ASSERT(offset, length, EXP_CONT == mX.checksum());
+            }
+        }
+      } break;
       case 14: {
         // --------------------------------------------------------------------
         // TESTING CRC_TABLE
@@ -2680,6 +2863,68 @@ int main(int argc, char *argv[])
         }
 
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: ALTERNATIVE IMPLEMENTATIONS
+        //
+        // Concerns:
+        //   We want to compare the throughput of the implementations exposed
+        //   by 'Crc32_Impl' over a range of buffer sizes.
+        //
+        // Plan:
+        //   Time each implementation over the same total number of bytes for
+        //   each buffer size, and report the throughput.
+        //
+        // Testing:
+        //   PERFORMANCE TEST: ALTERNATIVE IMPLEMENTATIONS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nPERFORMANCE TEST: ALTERNATIVE IMPLEMENTATIONS"
+                          << "\n============================================="
+                          << endl;
+
+        typedef bdlde::Crc32_Impl Impl;
+        typedef unsigned int (*CalculateFn)(const void *,
+                                            bsl::size_t,
+                                            unsigned int);
+
+        const struct {
+            const char  *d_name;
+            CalculateFn  d_fn;
+        } IMPLS[] = {
+            { "bytewise",     &Impl::calculateBytewise   },
+            { "slicing-by-8", &Impl::calculateSlicingBy8 },
+            { "folding",      &Impl::calculateFolding    },
+        };
+        const int NUM_IMPLS = sizeof IMPLS / sizeof *IMPLS;
+
+        const bsl::size_t SIZES[] = { 16, 64, 256, 4096, 65536, 1 << 20 };
+        const int         NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        const bsl::size_t TOTAL = 1 << 28;
+
+        bsl::vector<unsigned char> buffer(SIZES[NUM_SIZES - 1], 0x5a);
+
+        cout << "isFoldingSupported: " << Impl::isFoldingSupported() << endl;
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            const bsl::size_t SIZE = SIZES[si];
+
+            for (int ii = 0; ii < NUM_IMPLS; ++ii) {
+                unsigned int    crc = 0;
+                bsls::Stopwatch timer;
+                timer.start();
+                for (bsl::size_t done = 0; done < TOTAL; done += SIZE) {
+                    crc = IMPLS[ii].d_fn(buffer.data(), SIZE, crc);
+                }
+                timer.stop();
+
+                cout << "size " << SIZE << "\t" << IMPLS[ii].d_name << "\t"
+                     << static_cast<double>(TOTAL) / timer.elapsedTime() / 1e9
+                     << " GB/s\t(" << crc << ")" << endl;
+            }
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -6,11 +6,33 @@
 // This implements the CRC-64 defined in ECMA 182 (with reversed polynomial
 // 0xC96C5795D7870F42), in the usual manner:
 //   http://en.wikipedia.org/wiki/Cyclic_redundancy_check
+//
+// Short inputs are processed one byte at a time.  Longer inputs are processed
+// eight bytes at a time with "slicing-by-8" tables derived from 'CRC_TABLE',
+// or, when the processor supports 'PCLMULQDQ', by folding the input 64 bytes
+// at a time with carry-less multiplication, exactly as in 'bdlde_crc32.cpp'
+// (only the folding constants differ).  'Crc64::combine' uses the technique
+// of zlib's 'crc32_combine'.
+
+#include <bslmt_once.h>
 
 #include <bsl_ostream.h>
 #include <bsls_annotation.h>
+#include <bsls_log.h>
+#include <bsls_platform.h>
 #include <bsls_types.h>
 
+#if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+#define LIKE_X86_GCC
+#endif
+#endif
+
+#if defined(LIKE_X86_GCC)
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
 namespace BloombergLP {
 
 // STATIC DATA
@@ -274,18 +296,45 @@ static const bsls::Types::Uint64 CRC_TABLE[256] = {
     0xe0ada17364673f59ULL
 };
 
-namespace bdlde {
-                                // -----------
-                                // class Crc64
-                                // -----------
+namespace {
 
-// MANIPULATORS
-void Crc64::update(const void *data, bsl::size_t length)
+typedef bsls::Types::Uint64 Uint64;
+
+typedef Uint64 (*UpdateFn)(Uint64               crc,
+                           const unsigned char *data,
+                           bsl::size_t          length);
+    // 'UpdateFn' is an alias for a function that returns the result of
+    // advancing the specified 'crc' register (i.e., the bitwise inverse of the
+    // checksum) over the specified 'data' having the specified 'length'.
+
+Uint64 SLICE_TABLE[8][256];
+    // 'SLICE_TABLE[k][i]' is the register contribution of the byte 'i'
+    // followed by 'k' zero bytes; 'SLICE_TABLE[0]' is a copy of 'CRC_TABLE'.
+    // Populated by 'Crc64Calculator'.
+
+inline
+Uint64 loadLittleEndian(const unsigned char *data)
+    // Return the 64-bit value whose little-endian representation is the eight
+    // bytes at the specified 'data'.
 {
-    BSLS_ASSERT(data || !length);
+    return static_cast<Uint64>(data[0])
+         | static_cast<Uint64>(data[1]) << 8
+         | static_cast<Uint64>(data[2]) << 16
+         | static_cast<Uint64>(data[3]) << 24
+         | static_cast<Uint64>(data[4]) << 32
+         | static_cast<Uint64>(data[5]) << 40
+         | static_cast<Uint64>(data[6]) << 48
+         | static_cast<Uint64>(data[7]) << 56;
+}
 
-    const unsigned char *d = (const unsigned char *)data;
-    bsls::Types::Uint64 tmp = d_crc;
+Uint64 updateBytewise(Uint64               crc,
+                      const unsigned char *data,
+                      bsl::size_t          length)
+    // Return the result of advancing the specified 'crc' register over the
+    // specified 'data' having the specified 'length' one byte at a time.
+{
+    const unsigned char *d   = data;
+    Uint64               tmp = crc;
 
     switch (length % 8) {
       case 7:
@@ -325,7 +374,283 @@ void Crc64::update(const void *data, bsl::size_t length)
         --n;
     }
 
-    d_crc = tmp;
+    return tmp;
+}
+
+Uint64 updateSlicingBy8(Uint64               crc,
+                        const unsigned char *data,
+                        bsl::size_t          length)
+    // Return the result of advancing the specified 'crc' register over the
+    // specified 'data' having the specified 'length' eight bytes at a time,
+    // combining eight independent lookups into 'SLICE_TABLE' per step.  The
+    // behavior is undefined unless 'SLICE_TABLE' has been populated.
+{
+    while (length >= 8) {
+        const Uint64 v = crc ^ loadLittleEndian(data);
+
+        crc = SLICE_TABLE[7][ v        & 0xff]
+            ^ SLICE_TABLE[6][(v >>  8) & 0xff]
+            ^ SLICE_TABLE[5][(v >> 16) & 0xff]
+            ^ SLICE_TABLE[4][(v >> 24) & 0xff]
+            ^ SLICE_TABLE[3][(v >> 32) & 0xff]
+            ^ SLICE_TABLE[2][(v >> 40) & 0xff]
+            ^ SLICE_TABLE[1][(v >> 48) & 0xff]
+            ^ SLICE_TABLE[0][ v >> 56        ];
+
+        data   += 8;
+        length -= 8;
+    }
+
+    while (length) {
+        crc = SLICE_TABLE[0][(crc ^ *data++) & 0xff] ^ (crc >> 8);
+        --length;
+    }
+
+    return crc;
+}
+
+#if defined(LIKE_X86_GCC)
+
+__attribute__((target("pclmul,sse2")))
+inline
+__m128i fold(__m128i value, __m128i constants, __m128i next)
+    // Return the specified 'next' 128 bits of input combined with the
+    // specified 'value' (the preceding 128 bits of input) multiplied by the
+    // appropriate power of 'x' modulo the CRC-64 polynomial, as given by the
+    // specified 'constants'.
+{
+    const __m128i lo = _mm_clmulepi64_si128(value, constants, 0x00);
+    const __m128i hi = _mm_clmulepi64_si128(value, constants, 0x11);
+    return _mm_xor_si128(_mm_xor_si128(lo, hi), next);
+}
+
+__attribute__((target("pclmul,sse2")))
+Uint64 updateFolding(Uint64               crc,
+                     const unsigned char *data,
+                     bsl::size_t          length)
+    // Return the result of advancing the specified 'crc' register over the
+    // specified 'data' having the specified 'length' by folding four 128-bit
+    // lanes with carry-less multiplication, reducing the final 128 bits (and
+    // any remaining bytes) with 'updateSlicingBy8'.  The behavior is undefined
+    // unless 'SLICE_TABLE' has been populated and the 'PCLMULQDQ' instruction
+    // is supported.
+{
+    if (length < 64) {
+        return updateSlicingBy8(crc, data, length);                   // RETURN
+    }
+
+    // Each constant is 'x^(n - 1) mod P' bit-reflected into 64 bits, for 'n'
+    // of 'F + 64' (low half) and 'F' (high half), where 'F' is the folding
+    // distance in bits; see 'updateFolding' in 'bdlde_crc32.cpp'.
+
+    const __m128i k512 = _mm_set_epi64x(
+                                static_cast<long long>(0x081f6054a7842df4ULL),
+                                static_cast<long long>(0x6ae3efbb9dd441f3ULL));
+    const __m128i k128 = _mm_set_epi64x(
+                                static_cast<long long>(0xdabe95afc7875f40ULL),
+                                static_cast<long long>(0xe05dd497ca393ae4ULL));
+
+    const __m128i *p = reinterpret_cast<const __m128i *>(data);
+
+    __m128i x0 = _mm_xor_si128(_mm_loadu_si128(p),
+                               _mm_set_epi64x(0, static_cast<long long>(crc)));
+    __m128i x1 = _mm_loadu_si128(p + 1);
+    __m128i x2 = _mm_loadu_si128(p + 2);
+    __m128i x3 = _mm_loadu_si128(p + 3);
+    p      += 4;
+    length -= 64;
+
+    while (length >= 64) {
+        x0 = fold(x0, k512, _mm_loadu_si128(p));
+        x1 = fold(x1, k512, _mm_loadu_si128(p + 1));
+        x2 = fold(x2, k512, _mm_loadu_si128(p + 2));
+        x3 = fold(x3, k512, _mm_loadu_si128(p + 3));
+        p      += 4;
+        length -= 64;
+    }
+
+    x0 = fold(x0, k128, x1);
+    x0 = fold(x0, k128, x2);
+    x0 = fold(x0, k128, x3);
+
+    while (length >= 16) {
+        x0 = fold(x0, k128, _mm_loadu_si128(p));
+        ++p;
+        length -= 16;
+    }
+
+    unsigned char remainder[16];
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(remainder), x0);
+
+    crc = updateSlicingBy8(0, remainder, sizeof remainder);
+    return updateSlicingBy8(crc,
+                            reinterpret_cast<const unsigned char *>(p),
+                            length);
+}
+
+#endif  // LIKE_X86_GCC
+
+                           // =====================
+                           // class Crc64Calculator
+                           // =====================
+
+class Crc64Calculator {
+    // This class represents a singleton that populates 'SLICE_TABLE' and
+    // selects the fastest 'UpdateFn' supported by the current processor.
+
+    // CLASS DATA
+    static UpdateFn s_updateFn;     // selected implementation
+    static bool     s_isFolding;    // 'true' if 's_updateFn' uses 'PCLMULQDQ'
+
+    // CREATORS
+    Crc64Calculator();
+        // Create an instance of this class.
+
+    // NOT IMPLEMENTED
+    Crc64Calculator(const Crc64Calculator&);             // = delete;
+    Crc64Calculator& operator=(const Crc64Calculator&);  // = delete;
+
+  public:
+    // CLASS METHODS
+    static const Crc64Calculator& instance();
+        // Return a reference to the singleton object.
+
+    // ACCESSORS
+    Uint64 operator()(Uint64               crc,
+                      const unsigned char *data,
+                      bsl::size_t          length) const;
+        // Return the result of advancing the specified 'crc' register over the
+        // specified 'data' having the specified 'length' using the selected
+        // implementation.
+
+    bool isFolding() const;
+        // Return 'true' if the selected implementation uses carry-less
+        // multiplication, and 'false' otherwise.
+};
+
+                           // ---------------------
+                           // class Crc64Calculator
+                           // ---------------------
+
+// CLASS DATA
+UpdateFn Crc64Calculator::s_updateFn  = 0;
+bool     Crc64Calculator::s_isFolding = false;
+
+// CREATORS
+Crc64Calculator::Crc64Calculator()
+{
+    for (int i = 0; i < 256; ++i) {
+        Uint64 crc = CRC_TABLE[i];
+        SLICE_TABLE[0][i] = crc;
+        for (int k = 1; k < 8; ++k) {
+            crc = CRC_TABLE[crc & 0xff] ^ (crc >> 8);
+            SLICE_TABLE[k][i] = crc;
+        }
+    }
+
+#if defined(LIKE_X86_GCC)
+    unsigned int eax, ebx, ecx, edx;
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_PCLMUL)) {
+        BSLS_LOG_INFO("Using carry-less multiplication for CRC-64 "
+                      "computation (PCLMULQDQ instruction available)");
+        s_updateFn  = updateFolding;
+        s_isFolding = true;
+        return;                                                       // RETURN
+    }
+    BSLS_LOG_INFO("Using slicing-by-8 for CRC-64 computation (PCLMULQDQ "
+                  "instruction not available)");
+#endif
+    s_updateFn = updateSlicingBy8;
+}
+
+// CLASS METHODS
+const Crc64Calculator& Crc64Calculator::instance()
+{
+    static Crc64Calculator *theInstance_p = 0;
+    BSLMT_ONCE_DO {
+        static Crc64Calculator theInstance;
+        theInstance_p = &theInstance;
+    }
+    return *theInstance_p;
+}
+
+// ACCESSORS
+inline
+Uint64 Crc64Calculator::operator()(Uint64               crc,
+                                   const unsigned char *data,
+                                   bsl::size_t          length) const
+{
+    return s_updateFn(crc, data, length);
+}
+
+inline
+bool Crc64Calculator::isFolding() const
+{
+    return s_isFolding;
+}
+
+Uint64 multiplyModP(Uint64 a, Uint64 b)
+    // Return the product of the specified 'a' and 'b' modulo the CRC-64
+    // polynomial, where each is a bit-reflected polynomial of degree less than
+    // 64 (i.e., bit 63 holds the coefficient of 'x^0').
+{
+    Uint64 mask    = 0x8000000000000000ULL;
+    Uint64 product = 0;
+    for (;;) {
+        if (a & mask) {
+            product ^= b;
+            if (0 == (a & (mask - 1))) {
+                break;
+            }
+        }
+        mask >>= 1;
+        b = b & 1 ? (b >> 1) ^ 0xc96c5795d7870f42ULL : b >> 1;
+    }
+    return product;
+}
+
+}  // close unnamed namespace
+
+namespace bdlde {
+                                // -----------
+                                // class Crc64
+                                // -----------
+
+// CLASS METHODS
+bsls::Types::Uint64 Crc64::combine(bsls::Types::Uint64 crcA,
+                                   bsls::Types::Uint64 crcB,
+                                   bsl::size_t         lengthB)
+{
+    // Appending 'lengthB' bytes to 'A' multiplies its contribution by
+    // 'x^(8 * lengthB)'; the pre- and post-conditioning cancel out.  The power
+    // is accumulated by repeated squaring, starting from 'x^8' (reflected).
+
+    Uint64 power  = 0x0080000000000000ULL;
+    Uint64 result = 0x8000000000000000ULL;
+    while (lengthB) {
+        if (lengthB & 1) {
+            result = multiplyModP(power, result);
+        }
+        power = multiplyModP(power, power);
+        lengthB >>= 1;
+    }
+
+    return multiplyModP(result, crcA) ^ crcB;
+}
+
+// MANIPULATORS
+void Crc64::update(const void *data, bsl::size_t length)
+{
+    BSLS_ASSERT(data || !length);
+
+    const unsigned char *d = static_cast<const unsigned char *>(data);
+
+    if (length < 16) {
+        d_crc = updateBytewise(d_crc, d, length);
+        return;                                                       // RETURN
+    }
+
+    d_crc = Crc64Calculator::instance()(d_crc, d, length);
 }
 
 // ACCESSORS
@@ -343,6 +668,64 @@ bsl::ostream& Crc64::print(bsl::ostream& stream) const
     return stream << out;
 }
 
+                             // -----------------
+                             // struct Crc64_Impl
+                             // -----------------
+
+// CLASS METHODS
+bsls::Types::Uint64 Crc64_Impl::calculateBytewise(
+                                              const void          *data,
+                                              bsl::size_t          length,
+                                              bsls::Types::Uint64  crc)
+{
+    BSLS_ASSERT(data || !length);
+
+    return ~updateBytewise(~crc,
+                           static_cast<const unsigned char *>(data),
+                           length);
+}
+
+bsls::Types::Uint64 Crc64_Impl::calculateSlicingBy8(
+                                              const void          *data,
+                                              bsl::size_t          length,
+                                              bsls::Types::Uint64  crc)
+{
+    BSLS_ASSERT(data || !length);
+
+    Crc64Calculator::instance();  // populate 'SLICE_TABLE'
+
+    return ~updateSlicingBy8(~crc,
+                             static_cast<const unsigned char *>(data),
+                             length);
+}
+
+bsls::Types::Uint64 Crc64_Impl::calculateFolding(
+                                              const void          *data,
+                                              bsl::size_t          length,
+                                              bsls::Types::Uint64  crc)
+{
+    BSLS_ASSERT(data || !length);
+
+    const Crc64Calculator& calculator = Crc64Calculator::instance();
+
+    const unsigned char *d = static_cast<const unsigned char *>(data);
+
+#if defined(LIKE_X86_GCC)
+    if (calculator.isFolding()) {
+        return ~updateFolding(~crc, d, length);                       // RETURN
+    }
+#else
+    (void)calculator;
+#endif
+
+    return ~updateSlicingBy8(~crc, d, length);
+}
+
+bool Crc64_Impl::isFoldingSupported()
+{
+    return Crc64Calculator::instance().isFolding();
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -9,8 +9,9 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //  bdlde::Crc64: stores and updates a CRC-64 checksum
+//  bdlde::Crc64_Impl: calculates CRC-64 checksum with alternative impl.
 //
-//@SEE_ALSO:
+//@SEE_ALSO: bdlde_crc32
 //
 //@DESCRIPTION: 'bdlde::Crc64' implements a mechanism for computing, updating,
 // and streaming a CRC-64 checksum (a cyclic redundancy check comprising 64
@@ -21,6 +22,20 @@ BSLS_IDENT("$Id: $")
 // SHA-256, it is relatively easy to find alternate texts with identical
 // checksum.
 //
+// The 'combine' class method computes the checksum of the concatenation of two
+// messages from the checksums of the individual messages and the length of the
+// second one, so that a large buffer can be checksummed in independent chunks
+// whose results are then merged.  The struct 'bdlde::Crc64_Impl' exposes the
+// alternative implementations from which 'update' selects, and should not be
+// used other than to test and benchmark.
+//
+///Support for Hardware Acceleration
+///---------------------------------
+// As for 'bdlde::Crc32', 'update' uses "slicing-by-8" tables, or, on x86
+// processors supporting the 'PCLMULQDQ' instruction (detected at runtime),
+// folds buffers of 64 bytes or more with carry-less multiplication.  All
+// implementations produce identical checksums.
+//
 ///Usage
 ///-----
 // The following snippets of code illustrate a typical use of the
@@ -115,6 +130,15 @@ class Crc64 {
 
   public:
     // CLASS METHODS
+    static bsls::Types::Uint64 combine(bsls::Types::Uint64 crcA,
+                                       bsls::Types::Uint64 crcB,
+                                       bsl::size_t         lengthB);
+        // Return the CRC-64 checksum of the concatenation of a message 'A',
+        // having the specified checksum 'crcA', and a message 'B', having the
+        // specified checksum 'crcB' and the specified 'lengthB' (in bytes).
+        // Note that the length of 'A' is not required, and that the
+        // complexity of this operation is logarithmic in 'lengthB'.
+
     static int maxSupportedBdexVersion(int versionSelector);
         // Return the maximum valid BDEX format version, as indicated by the
         // specified 'versionSelector', to be passed to the 'bdexStreamOut'
@@ -220,6 +244,45 @@ bsl::ostream& operator<<(bsl::ostream& stream, const Crc64& checksum);
     // Write to the specified output 'stream' the specified 'checksum' value
     // and return a reference to the modifiable 'stream'.
 
+                             // =================
+                             // struct Crc64_Impl
+                             // =================
+
+struct Crc64_Impl {
+    // This struct provides alternative implementations of utilities to
+    // calculate a CRC-64 checksum.  Each function returns the checksum of the
+    // concatenation of a message having the specified 'crc' checksum (0 for
+    // the empty message) and the specified 'data' having the specified
+    // 'length' (in bytes).  Note that if 'data' is 0, then 'length' must also
+    // be 0.
+
+    // CLASS METHODS
+    static bsls::Types::Uint64 calculateBytewise(
+                                             const void          *data,
+                                             bsl::size_t          length,
+                                             bsls::Types::Uint64  crc = 0);
+        // Return the checksum described above, computed one byte at a time.
+
+    static bsls::Types::Uint64 calculateSlicingBy8(
+                                             const void          *data,
+                                             bsl::size_t          length,
+                                             bsls::Types::Uint64  crc = 0);
+        // Return the checksum described above, computed eight bytes at a time
+        // using the "slicing-by-8" table-driven algorithm.
+
+    static bsls::Types::Uint64 calculateFolding(
+                                             const void          *data,
+                                             bsl::size_t          length,
+                                             bsls::Types::Uint64  crc = 0);
+        // Return the checksum described above, computed by folding the data
+        // with carry-less multiplication ('PCLMULQDQ') when supported by the
+        // current platform, and as 'calculateSlicingBy8' otherwise.
+
+    static bool isFoldingSupported();
+        // Return 'true' if 'calculateFolding' uses carry-less multiplication
+        // on the current platform, and 'false' otherwise.
+};
+
 // ============================================================================
 //                        INLINE DEFINITIONS
 // ============================================================================
@@ -63,6 +63,7 @@ using namespace bsl;  // automatically added by script
 //
 // ----------------------------------------------------------------------------
 // CLASS METHODS
+// [16] static Uint64 combine(Uint64 crcA, Uint64 crcB, size_t lengthB);
 // [10] static int maxSupportedBdexVersion(int);
 //
 // CREATORS
@@ -87,12 +88,19 @@ using namespace bsl;  // automatically added by script
 // [ 6] bool operator==(const bdlde::Crc64& lhs, const bdlde::Crc64& rhs);
 // [ 6] bool operator!=(const bdlde::Crc64& lhs, const bdlde::Crc64& rhs);
 // [ 5] bsl::ostream& operator<<(bsl::ostream&, const bdlde::Crc64&);
+//
+// bdlde::Crc64_Impl
+// [15] Uint64 calculateBytewise(const void *, size_t, Uint64);
+// [15] Uint64 calculateSlicingBy8(const void *, size_t, Uint64);
+// [15] Uint64 calculateFolding(const void *, size_t, Uint64);
+// [15] bool isFoldingSupported();
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [15] USAGE EXAMPLE
+// [17] USAGE EXAMPLE
 // [ 2] BOOTSTRAP: void update(const void *data, int length);
 // [14] CRC_TABLE TEST
 // [-1] PERFORMANCE TEST
+// [-2] PERFORMANCE TEST: ALTERNATIVE IMPLEMENTATIONS
 //
 // [ 3] int ggg(bdlde::Crc64 *object, const char *spec, int vF = 1);
 // [ 3] bdlde::Crc64& gg(bdlde::Crc64 *object, const char *spec);
@@ -484,7 +492,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 15: {
+      case 17: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   This will test the usage example provided in the component header
@@ -515,6 +523,186 @@ int main(int argc, char *argv[])
         receiverExample(in);
 
       } break;
+      case 16: {
+        // --------------------------------------------------------------------
+        // TESTING 'combine'
+        //
+        // Concerns:
+        //: 1 'combine(crcA, crcB, lengthB)' returns the checksum of the
+        //:   concatenation of the messages having checksums 'crcA' and 'crcB',
+        //:   where the second message has length 'lengthB'.
+        //:
+        //: 2 Combining with an empty message returns the other checksum.
+        //:
+        //: 3 Checksums of many chunks can be combined in sequence, as when a
+        //:   large buffer is checksummed in parallel.
+        //
+        // Plan:
+        //: 1 For every split point of buffers of pseudo-random bytes, compare
+        //:   'combine' of the checksums of both parts against the checksum of
+        //:   the whole.  (C-1..2)
+        //:
+        //: 2 Split a large buffer into chunks of various sizes, combine the
+        //:   checksums of the chunks, and compare against the checksum of the
+        //:   whole buffer.  (C-3)
+        //
+        // Testing:
+        //   static Uint64 combine(Uint64, Uint64, size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'combine'"
+                          << "\n=================" << endl;
+
+        typedef bsls::Types::Uint64 Uint64;
+
+        bsl::vector<unsigned char> buffer(1 << 20);
+        unsigned int               seed = 12345;
+        for (bsl::size_t i = 0; i < buffer.size(); ++i) {
+            seed      = seed * 1103515245 + 12345;
+            buffer[i] = static_cast<unsigned char>(seed >> 16);
+        }
+        const unsigned char *DATA = buffer.data();
+
+        if (verbose) cout << "\tSplitting small buffers." << endl;
+
+        for (bsl::size_t length = 0; length <= 300; ++length) {
+            const Uint64 EXP = Obj(DATA, length).checksum();
+
+            for (bsl::size_t split = 0; split <= length; ++split) {
+                const Uint64 A = Obj(DATA, split).checksum();
+                const Uint64 B = Obj(DATA + split,
+                                           length - split).checksum();
+
+                LOOP2_ASSERT(length, split,
+                             EXP == Obj::combine(A, B, length - split));
+            }
+        }
+
+        const Uint64 V = 0x123456789abcdef0ULL;
+
+        ASSERT(V == Obj::combine(V, 0, 0));
+        ASSERT(V == Obj::combine(0, V, 5));
+
+        if (verbose) cout << "\tCombining chunks of a large buffer." << endl;
+
+        const Uint64 EXP = Obj(DATA, buffer.size()).checksum();
+
+        const bsl::size_t CHUNKS[] = { 1, 7, 64, 1000, 4096, 65537, 300000 };
+        const int         NUM_CHUNKS = sizeof CHUNKS / sizeof *CHUNKS;
+
+        for (int ti = 0; ti < NUM_CHUNKS; ++ti) {
+            const bsl::size_t CHUNK = CHUNKS[ti];
+
+            Uint64 crc = 0;
+            for (bsl::size_t offset = 0; offset < buffer.size();
+                                                             offset += CHUNK) {
+                const bsl::size_t length = bsl::min(CHUNK,
+                                                    buffer.size() - offset);
+                crc = Obj::combine(crc,
+                                   Obj(DATA + offset, length).checksum(),
+                                   length);
+            }
+            LOOP_ASSERT(CHUNK, EXP == crc);
+        }
+      } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // TESTING 'Crc64_Impl'
+        //
+        // Concerns:
+        //: 1 The bytewise, slicing-by-8, and folding implementations, and
+        //:   'update', produce identical checksums for all lengths, including
+        //:   the thresholds at which 'update' switches implementation.
+        //:
+        //: 2 The result does not depend on the alignment of the data.
+        //:
+        //: 3 Each implementation correctly continues from a non-zero 'crc'.
+        //:
+        //: 4 The checksum of "123456789" is the standard check value.
+        //
+        // Plan:
+        //: 1 For all lengths up to 1100 bytes and all offsets modulo 16 of
+        //:   a buffer of pseudo-random bytes, compare each implementation
+        //:   against 'calculateBytewise', both from a zero 'crc' and
+        //:   continuing from the checksum of a prefix.  (C-1..3)
+        //:
+        //: 2 Verify the check value with each implementation.  (C-4)
+        //
+        // Testing:
+        //   Uint64 calculateBytewise(const void *, size_t, Uint64);
+        //   Uint64 calculateSlicingBy8(const void *, size_t, Uint64);
+        //   Uint64 calculateFolding(const void *, size_t, Uint64);
+        //   bool isFoldingSupported();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'Crc64_Impl'"
+                          << "\n====================" << endl;
+
+        typedef bdlde::Crc64_Impl Impl;
+        typedef bsls::Types::Uint64 Uint64;
+
+        if (verbose) {
+            P(Impl::isFoldingSupported());
+        }
+
+        {
+            const char   *CHECK     = "123456789";
+            const Uint64  CHECK_CRC = 0x995dc9bbdf1939faULL;
+
+            ASSERT(CHECK_CRC == Impl::calculateBytewise(CHECK, 9));
+            ASSERT(CHECK_CRC == Impl::calculateSlicingBy8(CHECK, 9));
+            ASSERT(CHECK_CRC == Impl::calculateFolding(CHECK, 9));
+            ASSERT(CHECK_CRC == Obj(CHECK, 9).checksum());
+
+            ASSERT(0 == Impl::calculateBytewise(0, 0));
+            ASSERT(0 == Impl::calculateSlicingBy8(0, 0));
+            ASSERT(0 == Impl::calculateFolding(0, 0));
+        }
+
+        enum { k_MAX_LENGTH = 1100, k_PREFIX = 5 };
+
+        unsigned char buffer[k_MAX_LENGTH + 16 + k_PREFIX];
+        unsigned int  seed = 42;
+        for (bsl::size_t i = 0; i < sizeof buffer; ++i) {
+            seed      = seed * 1103515245 + 12345;
+            buffer[i] = static_cast<unsigned char>(seed >> 16);
+        }
+
+        for (int offset = 0; offset < 16; ++offset) {
+            const unsigned char *PREFIX = buffer + offset;
+            const unsigned char *DATA   = PREFIX + k_PREFIX;
+
+            const Uint64 PRE = Impl::calculateBytewise(PREFIX, k_PREFIX);
+
+            for (bsl::size_t length = 0; length <= k_MAX_LENGTH; ++length) {
+                const Uint64 EXP = Impl::calculateBytewise(DATA,
+                                                                 length);
+                const Uint64 EXP_CONT = Impl::calculateBytewise(DATA,
+                                                                      length,
+                                                                      PRE);
+
+                LOOP2_ASSERT(offset, length,
+                             EXP == Impl::calculateSlicingBy8(DATA, length));
+                LOOP2_ASSERT(offset, length,
+                             EXP == Impl::calculateFolding(DATA, length));
+                LOOP2_ASSERT(offset, length,
+                             EXP == Obj(DATA, length).checksum());
+
+                LOOP2_ASSERT(offset, length,
+                             EXP_CONT == Impl::calculateSlicingBy8(DATA,
+                                                                   length,
+                                                                   PRE));
+                LOOP2_ASSERT(offset, length,
+                             EXP_CONT == Impl::calculateFolding(DATA,
+                                                                length,
+                                                                PRE));
+
+                Obj mX(PREFIX, k_PREFIX);
+                mX.update(DATA, length);
+                LOOP2_ASSERT(offset, length, EXP_CONT == mX.checksum());
+            }
+        }
+      } break;
       case 14: {
         // --------------------------------------------------------------------
         // TESTING CRC_TABLE
@@ -2659,6 +2847,68 @@ int main(int argc, char *argv[])
         }
 
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: ALTERNATIVE IMPLEMENTATIONS
+        //
+        // Concerns:
+        //   We want to compare the throughput of the implementations exposed
+        //   by 'Crc64_Impl' over a range of buffer sizes.
+        //
+        // Plan:
+        //   Time each implementation over the same total number of bytes for
+        //   each buffer size, and report the throughput.
+        //
+        // Testing:
+        //   PERFORMANCE TEST: ALTERNATIVE IMPLEMENTATIONS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nPERFORMANCE TEST: ALTERNATIVE IMPLEMENTATIONS"
+                          << "\n============================================="
+                          << endl;
+
+        typedef bdlde::Crc64_Impl Impl;
+        typedef bsls::Types::Uint64 (*CalculateFn)(const void *,
+                                                   bsl::size_t,
+                                                   bsls::Types::Uint64);
+
+        const struct {
+            const char  *d_name;
+            CalculateFn  d_fn;
+        } IMPLS[] = {
+            { "bytewise",     &Impl::calculateBytewise   },
+            { "slicing-by-8", &Impl::calculateSlicingBy8 },
+            { "folding",      &Impl::calculateFolding    },
+        };
+        const int NUM_IMPLS = sizeof IMPLS / sizeof *IMPLS;
+
+        const bsl::size_t SIZES[] = { 16, 64, 256, 4096, 65536, 1 << 20 };
+        const int         NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        const bsl::size_t TOTAL = 1 << 28;
+
+        bsl::vector<unsigned char> buffer(SIZES[NUM_SIZES - 1], 0x5a);
+
+        cout << "isFoldingSupported: " << Impl::isFoldingSupported() << endl;
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            const bsl::size_t SIZE = SIZES[si];
+
+            for (int ii = 0; ii < NUM_IMPLS; ++ii) {
+                bsls::Types::Uint64 crc = 0;
+                bsls::Stopwatch     timer;
+                timer.start();
+                for (bsl::size_t done = 0; done < TOTAL; done += SIZE) {
+                    crc = IMPLS[ii].d_fn(buffer.data(), SIZE, crc);
+                }
+                timer.stop();
+
+                cout << "size " << SIZE << "\t" << IMPLS[ii].d_name << "\t"
+                     << static_cast<double>(TOTAL) / timer.elapsedTime() / 1e9
+                     << " GB/s\t(" << crc << ")" << endl;
+            }
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
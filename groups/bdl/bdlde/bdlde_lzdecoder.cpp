@@ -0,0 +1,273 @@
+// bdlde_lzdecoder.cpp                                                -*-C++-*-
+#include <bdlde_lzdecoder.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlde_lzdecoder_cpp,"$Id$ $CSID$")
+
+#include <bdlde_crc32c.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+
+namespace BloombergLP {
+namespace bdlde {
+
+                              // ---------------
+                              // class LzDecoder
+                              // ---------------
+
+// PRIVATE MANIPULATORS
+void LzDecoder::emit(char **out, int *numOut, int maxNumOut)
+{
+    int numBytes = d_pendingLength;
+    if (0 <= maxNumOut) {
+        numBytes = bsl::min(numBytes, maxNumOut - *numOut);
+    }
+
+    if (0 == numBytes) {
+        return;                                                       // RETURN
+    }
+
+    bsl::memcpy(*out, d_pending_p, numBytes);
+    *out            += numBytes;
+    *numOut         += numBytes;
+    d_outputLength  += numBytes;
+    d_pending_p     += numBytes;
+    d_pendingLength -= numBytes;
+}
+
+int LzDecoder::processItem(char       **out,
+                           int         *numOut,
+                           int          maxNumOut,
+                           const char  *item,
+                           bool         isTransient)
+{
+    switch (d_state) {
+      case e_INITIAL_STATE: {
+        if (0 != LzUtil::readFrameHeader(item)) {
+            d_state = e_ERROR_STATE;
+            return -1;                                                // RETURN
+        }
+        d_state        = e_BLOCK_HEADER_STATE;
+        d_neededLength = LzUtil::k_BLOCK_HEADER_LENGTH;
+      } break;
+      case e_BLOCK_HEADER_STATE: {
+        int dataLength;
+        if (0 != LzUtil::readBlockHeader(&dataLength, &d_isCompressed, item)) {
+            d_state = e_ERROR_STATE;
+            return -1;                                                // RETURN
+        }
+        if (0 == dataLength) {
+            d_state        = e_CHECKSUM_STATE;
+            d_neededLength = LzUtil::k_CHECKSUM_LENGTH;
+        }
+        else {
+            d_state        = e_BLOCK_STATE;
+            d_neededLength = dataLength;
+        }
+      } break;
+      case e_BLOCK_STATE: {
+        if (d_isCompressed) {
+            // Decompress directly into the caller's buffer if the output limit
+            // leaves room for a block of any length, and stage the output
+            // otherwise.
+
+            const bool isDirect = 0 <= maxNumOut
+                               && LzUtil::k_MAX_BLOCK_LENGTH <=
+                                                          maxNumOut - *numOut;
+            char *output = isDirect ? *out : d_output.data();
+
+            const int length = LzUtil::decompressBlock(
+                                                    output,
+                                                    LzUtil::k_MAX_BLOCK_LENGTH,
+                                                    item,
+                                                    d_neededLength);
+            if (length <= 0) {
+                d_state = e_ERROR_STATE;
+                return -1;                                            // RETURN
+            }
+            d_checksum = Crc32c::calculate(output, length, d_checksum);
+
+            if (isDirect) {
+                *out           += length;
+                *numOut        += length;
+                d_outputLength += length;
+            }
+            else {
+                d_pending_p     = output;
+                d_pendingLength = length;
+                emit(out, numOut, maxNumOut);
+            }
+        }
+        else {
+            d_checksum      = Crc32c::calculate(item,
+                                                d_neededLength,
+                                                d_checksum);
+            d_pending_p     = item;
+            d_pendingLength = d_neededLength;
+            emit(out, numOut, maxNumOut);
+
+            if (isTransient && 0 < d_pendingLength) {
+                bsl::memcpy(d_output.data(), d_pending_p, d_pendingLength);
+                d_pending_p = d_output.data();
+            }
+        }
+        d_state        = e_BLOCK_HEADER_STATE;
+        d_neededLength = LzUtil::k_BLOCK_HEADER_LENGTH;
+      } break;
+      default: {
+        BSLS_ASSERT(e_CHECKSUM_STATE == d_state);
+
+        if (LzUtil::readChecksum(item) != d_checksum) {
+            d_state = e_ERROR_STATE;
+            return -1;                                                // RETURN
+        }
+        d_state        = e_COMPLETE_STATE;
+        d_neededLength = 0;
+      } break;
+    }
+    return 0;
+}
+
+// CREATORS
+LzDecoder::LzDecoder(bslma::Allocator *basicAllocator)
+: d_state(e_INITIAL_STATE)
+, d_input(LzUtil::k_MAX_BLOCK_LENGTH, basicAllocator)
+, d_inputLength(0)
+, d_neededLength(LzUtil::k_FRAME_HEADER_LENGTH)
+, d_isCompressed(false)
+, d_output(LzUtil::k_MAX_BLOCK_LENGTH, basicAllocator)
+, d_pending_p(0)
+, d_pendingLength(0)
+, d_checksum(Crc32c::k_NULL_CRC32C)
+, d_outputLength(0)
+{
+}
+
+// MANIPULATORS
+int LzDecoder::convert(char       *out,
+                       int        *numOut,
+                       int        *numIn,
+                       const char *begin,
+                       const char *end,
+                       int         maxNumOut)
+{
+    BSLS_ASSERT(out || 0 == maxNumOut);
+    BSLS_ASSERT(numOut);
+    BSLS_ASSERT(numIn);
+    BSLS_ASSERT(begin <= end);
+
+    *numOut = 0;
+    *numIn  = 0;
+
+    if (e_COMPLETE_STATE < d_state || e_ERROR_STATE == d_state) {
+        d_state = e_ERROR_STATE;
+        return -1;                                                    // RETURN
+    }
+
+    const char *input = begin;
+    while (true) {
+        if (0 < d_pendingLength) {
+            emit(&out, numOut, maxNumOut);
+            if (0 < d_pendingLength) {
+                break;
+            }
+        }
+        if (input == end) {
+            break;
+        }
+        if (e_COMPLETE_STATE == d_state) {
+            d_state = e_ERROR_STATE;
+            break;
+        }
+
+        // Process the next item directly from the input if it is held there
+        // entirely, and gather it otherwise.
+
+        const char *item;
+        bool        isTransient;
+
+        if (0 == d_inputLength && d_neededLength <= end - input) {
+            item         = input;
+            isTransient  = true;
+            input       += d_neededLength;
+        }
+        else {
+            const int numBytes = static_cast<int>(
+                                     bsl::min<bsls::Types::Int64>(
+                                         end - input,
+                                         d_neededLength - d_inputLength));
+
+            bsl::memcpy(d_input.data() + d_inputLength, input, numBytes);
+            d_inputLength += numBytes;
+            input         += numBytes;
+
+            if (d_inputLength < d_neededLength) {
+                break;
+            }
+            item        = d_input.data();
+            isTransient = false;
+        }
+        d_inputLength = 0;
+
+        if (0 != processItem(&out, numOut, maxNumOut, item, isTransient)) {
+            break;
+        }
+    }
+
+    *numIn = static_cast<int>(input - begin);
+    return e_ERROR_STATE == d_state ? -1 : d_pendingLength;
+}
+
+int LzDecoder::endConvert(char *out, int *numOut, int maxNumOut)
+{
+    BSLS_ASSERT(out || 0 == maxNumOut);
+    BSLS_ASSERT(numOut);
+
+    (void)out;
+    (void)maxNumOut;
+
+    *numOut = 0;
+
+    if (e_COMPLETE_STATE != d_state) {
+        d_state = e_ERROR_STATE;
+        return -1;                                                    // RETURN
+    }
+
+    BSLS_ASSERT(0 == d_pendingLength);
+
+    d_state = e_DONE_STATE;
+    return 0;
+}
+
+void LzDecoder::resetState()
+{
+    d_state         = e_INITIAL_STATE;
+    d_inputLength   = 0;
+    d_neededLength  = LzUtil::k_FRAME_HEADER_LENGTH;
+    d_pending_p     = 0;
+    d_pendingLength = 0;
+    d_checksum      = Crc32c::k_NULL_CRC32C;
+    d_outputLength  = 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,360 @@
+// bdlde_lzdecoder.h                                                  -*-C++-*-
+#ifndef INCLUDED_BDLDE_LZDECODER
+#define INCLUDED_BDLDE_LZDECODER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an automaton decompressing data from an LZ frame.
+//
+//@CLASSES:
+//  bdlde::LzDecoder: automaton performing streaming LZ decompression
+//
+//@SEE_ALSO: bdlde_lzencoder, bdlde_lzutil
+//
+//@DESCRIPTION: This component provides a 'class', 'bdlde::LzDecoder', that
+// decompresses a frame in the format described in 'bdlde_lzutil' (see
+// {'bdlde_lzutil'|Frame Format}), such as those produced by 'bdlde::LzEncoder'
+// and 'bdlde::LzUtil::compressFrame', supplied in segments of arbitrary
+// length.  Like the other decoders in this package (e.g.,
+// 'bdlde::Base64Decoder'), an instance retains the state of the conversion
+// from one call to 'convert' to the next, and the end of the input is
+// indicated by calling 'endConvert'.  The total output may be limited on each
+// call, in which case the decoder retains the output that it could not emit,
+// and stops consuming input, until it is called again.
+//
+// The decoder validates the frame as it is consumed: a frame having an
+// invalid header, an invalid block header, a block that cannot be
+// decompressed, or a checksum that does not match the decompressed data
+// places the decoder in the error state.  No data of a block that cannot be
+// decompressed is emitted, but the checksum of the data, and hence the
+// integrity of the output as a whole, is verified only once the frame is
+// complete (i.e., once 'isDone' returns 'true').  Any input following the
+// end of the frame is an error.
+//
+// The decoder consumes the blocks of a frame directly from the input segment
+// supplied to 'convert' whenever a block is held entirely within it, and
+// decompresses a block directly into the output buffer whenever the output
+// limit leaves room for a block of the maximum length; otherwise, the input
+// is gathered into, and the output staged through, internal buffers.
+//
+///Memory Usage
+///------------
+// A decoder allocates approximately 128 kilobytes on construction (for the
+// input block being gathered and the decompressed output not yet emitted),
+// and does not allocate thereafter.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Decompressing a Stream
+///- - - - - - - - - - - - - - - - -
+// Suppose that we want to decompress a frame read from an input stream, and
+// write the resulting data to an output stream, using buffers of fixed size.
+//
+// First, we define a function that does so:
+//..
+//  int decompressStream(bsl::ostream& os, bsl::istream& is)
+//      // Read the entire contents of the specified input stream 'is',
+//      // decompress the frame that they hold, and write the resulting data
+//      // to the specified output stream 'os'.  Return 0 on success, and a
+//      // non-zero value otherwise.
+//  {
+//      bdlde::LzDecoder decoder;
+//
+//      char inputBuffer[4096];
+//      char outputBuffer[4096];
+//
+//      while (is.good()) {
+//          is.read(inputBuffer, sizeof inputBuffer);
+//
+//          const char *input    = inputBuffer;
+//          const char *inputEnd = input + is.gcount();
+//
+//          while (input < inputEnd) {
+//              int numOut;
+//              int numIn;
+//              int rc = decoder.convert(outputBuffer,
+//                                       &numOut,
+//                                       &numIn,
+//                                       input,
+//                                       inputEnd,
+//                                       sizeof outputBuffer);
+//              if (rc < 0) {
+//                  return -1;                                    // RETURN
+//              }
+//              os.write(outputBuffer, numOut);
+//              input += numIn;
+//          }
+//      }
+//..
+// Then, having consumed all of the input, we call 'endConvert', which
+// reports an error if the input did not hold a complete frame:
+//..
+//      int numOut;
+//      if (0 != decoder.endConvert(outputBuffer, &numOut)) {
+//          return -1;                                                // RETURN
+//      }
+//
+//      return is.eof() && os.good() ? 0 : -1;
+//  }
+//..
+// Next, we compress some data into a frame using 'bdlde::LzUtil':
+//..
+//  bsl::string data;
+//  for (int i = 0; i < 10000; ++i) {
+//      data += "a line of text that is repeated\n";
+//  }
+//
+//  const int         length = static_cast<int>(data.length());
+//  bsl::vector<char> frame(bdlde::LzUtil::maxFrameLength(length));
+//
+//  int frameLength = bdlde::LzUtil::compressFrame(frame.data(),
+//                                                 data.data(),
+//                                                 length);
+//
+//  bsl::string encoded(frame.data(), frameLength);
+//..
+// Then, we decompress the frame, and observe that the result is the original
+// data:
+//..
+//  bsl::istringstream is(encoded);
+//  bsl::ostringstream os;
+//
+//  int rc = decompressStream(os, is);
+//  assert(0 == rc);
+//  assert(data == os.str());
+//..
+// Finally, we observe that a truncated frame is reported as an error:
+//..
+//  bsl::istringstream truncated(encoded.substr(0, encoded.length() - 1));
+//  bsl::ostringstream discarded;
+//
+//  rc = decompressStream(discarded, truncated);
+//  assert(0 != rc);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlde_lzutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_types.h>
+
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlde {
+
+                              // ===============
+                              // class LzDecoder
+                              // ===============
+
+class LzDecoder {
+    // This class implements a mechanism that decompresses the data held in a
+    // frame.  See {'bdlde_lzutil'|Frame Format}.
+
+    // PRIVATE TYPES
+    enum {
+        // Symbolic state values.
+
+        e_ERROR_STATE        = -1,  // Input is irreparably invalid.
+        e_INITIAL_STATE      =  0,  // Expecting the frame header.
+        e_BLOCK_HEADER_STATE =  1,  // Expecting a block header.
+        e_BLOCK_STATE        =  2,  // Expecting the data of a block.
+        e_CHECKSUM_STATE     =  3,  // Expecting the checksum.
+        e_COMPLETE_STATE     =  4,  // Any additional input is an error.
+        e_DONE_STATE         =  5   // 'endConvert' has returned 0.
+    };
+
+    // DATA
+    signed char         d_state;          // state as per above enum
+
+    bsl::vector<char>   d_input;          // input of the item being gathered
+
+    int                 d_inputLength;    // length of the input in 'd_input'
+
+    int                 d_neededLength;   // length of the item (frame
+                                          // header, block header, block data,
+                                          // or checksum) being gathered
+
+    bool                d_isCompressed;   // 'true' if the data of the current
+                                          // block is compressed
+
+    bsl::vector<char>   d_output;         // decompressed output
+
+    const char         *d_pending_p;      // retained output, in 'd_input' or
+                                          // 'd_output'
+
+    int                 d_pendingLength;  // length of the retained output
+
+    unsigned int        d_checksum;       // CRC32-C of the output produced
+
+    bsls::Types::Int64  d_outputLength;   // total length of the output
+                                          // emitted
+
+  private:
+    // NOT IMPLEMENTED
+    LzDecoder(const LzDecoder&);
+    LzDecoder& operator=(const LzDecoder&);
+
+    // PRIVATE MANIPULATORS
+    void emit(char **out, int *numOut, int maxNumOut);
+        // Copy retained output to the specified '*out' buffer, and advance
+        // '*out' and the specified '*numOut' count of bytes emitted past the
+        // bytes copied, without '*numOut' exceeding the specified
+        // 'maxNumOut' unless 'maxNumOut' is negative.
+
+    int processItem(char       **out,
+                    int         *numOut,
+                    int          maxNumOut,
+                    const char  *item,
+                    bool         isTransient);
+        // Process the complete item of 'd_neededLength' bytes at the
+        // specified 'item' address according to the current state, emitting
+        // any data that it holds to the specified '*out' buffer as per 'emit'
+        // (using the specified 'numOut' and 'maxNumOut') and retaining the
+        // rest, and advance the state.  The specified 'isTransient' flag
+        // indicates that 'item' refers to memory that is not valid once the
+        // current call to 'convert' returns.  Return 0 on success, and a
+        // non-zero value, with this decoder in the error state, if the item
+        // is not valid.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(LzDecoder, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit LzDecoder(bslma::Allocator *basicAllocator = 0);
+        // Create an LZ decoder in the initial state.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    //! ~LzDecoder() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    int convert(char       *out,
+                int        *numOut,
+                int        *numIn,
+                const char *begin,
+                const char *end,
+                int         maxNumOut = -1);
+        // Decompress the sequence of input bytes starting at the specified
+        // 'begin' address up to, but not including, the specified 'end'
+        // address, writing any resulting output bytes to the specified 'out'
+        // buffer.  Optionally specify the 'maxNumOut' limit on the number of
+        // bytes to output; if 'maxNumOut' is negative, no limit is imposed.
+        // If the 'maxNumOut' limit is reached, no further input will be
+        // consumed.  Load into the specified 'numOut' and 'numIn' the number
+        // of output bytes produced and input bytes consumed, respectively.
+        // Return a non-negative value on success and a negative value,
+        // placing this decoder in the error state, if the input is not a
+        // valid frame or extends past the end of the frame.  A positive
+        // return status indicates the number of output bytes retained by this
+        // decoder and not written to 'out' because 'maxNumOut' has been
+        // reached; these bytes are available for output if this method (or
+        // 'endConvert') is called again.  The behavior is undefined unless
+        // 'begin <= end', and 'out' can hold 'maxNumOut' bytes if 'maxNumOut'
+        // is non-negative, and the number of retained bytes plus the length
+        // of the data of every block completed by the input otherwise.  Note
+        // that calling this method after 'endConvert' has been invoked
+        // without an intervening 'resetState' call will place this instance
+        // in an error state, and return an error status.
+
+    int endConvert(char *out, int *numOut, int maxNumOut = -1);
+        // Terminate decompression for this decoder, and load into the
+        // specified 'numOut' the number of output bytes produced, which is
+        // always 0.  Return 0 if the input consumed is a complete frame, and
+        // a negative value, placing this decoder in the error state,
+        // otherwise (or if this decoder is already in the error state).  Once
+        // this method returns a zero status, a subsequent call will place
+        // this decoder in the error state, and return an error status.  The
+        // behavior is undefined unless 'out' is non-null or 'maxNumOut' is 0.
+        // Note that this decoder retains output only while the frame is
+        // incomplete (because it stops consuming input when 'maxNumOut' is
+        // reached), so that this method never has output to produce; the
+        // specified 'out' buffer and the optionally specified 'maxNumOut'
+        // limit are accepted for uniformity with 'bdlde::LzEncoder'.
+
+    void resetState();
+        // Reset this instance to its initial state (i.e., as if no input had
+        // been consumed).
+
+    // ACCESSORS
+    bool isDone() const;
+        // Return 'true' if the input consumed is a complete and valid frame
+        // and all resulting output has been emitted, and 'false' otherwise.
+        // Note that once the complete frame has been consumed, any additional
+        // input is an error.
+
+    bool isError() const;
+        // Return 'true' if there is no possibility of achieving an
+        // "acceptable" result, and 'false' otherwise.
+
+    bool isInitialState() const;
+        // Return 'true' if this instance is in the initial state (i.e., as if
+        // no input had been consumed), and 'false' otherwise.
+
+    bsls::Types::Int64 outputLength() const;
+        // Return the total length of the output emitted thus far.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                              // ---------------
+                              // class LzDecoder
+                              // ---------------
+
+// ACCESSORS
+inline
+bool LzDecoder::isDone() const
+{
+    return e_COMPLETE_STATE <= d_state;
+}
+
+inline
+bool LzDecoder::isError() const
+{
+    return e_ERROR_STATE == d_state;
+}
+
+inline
+bool LzDecoder::isInitialState() const
+{
+    return e_INITIAL_STATE == d_state && 0 == d_inputLength;
+}
+
+inline
+bsls::Types::Int64 LzDecoder::outputLength() const
+{
+    return d_outputLength;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
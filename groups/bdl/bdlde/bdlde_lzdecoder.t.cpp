@@ -0,0 +1,1123 @@
+// bdlde_lzdecoder.t.cpp                                              -*-C++-*-
+#include <bdlde_lzdecoder.h>
+
+#include <bdlde_lzencoder.h>
+#include <bdlde_lzutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// The component under test is a mechanism that decompresses a frame, supplied
+// in segments, into the data that it holds.  We verify that frames produced by
+// 'bdlde::LzUtil::compressFrame' over a range of lengths and kinds of data are
+// restored exactly, however the frame is divided among calls to 'convert' and
+// however the output of each call is limited, and that malformed, corrupted,
+// truncated, and over-long frames are reported as errors without any call
+// writing more than permitted.  The state transitions, including the errors
+// reported for calls made after the end of the input, are tested separately.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 4] LzDecoder(bslma::Allocator *basicAllocator = 0);
+// [ 4] ~LzDecoder();
+//
+// MANIPULATORS
+// [ 2] int convert(char*, int*, int*, const char*, const char*, int);
+// [ 2] int endConvert(char *, int *, int);
+// [ 4] void resetState();
+//
+// ACCESSORS
+// [ 4] bool isDone() const;
+// [ 4] bool isError() const;
+// [ 4] bool isInitialState() const;
+// [ 2] bsls::Types::Int64 outputLength() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] DECOMPRESSING MALFORMED FRAMES
+// [ 5] USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlde::LzDecoder Obj;
+typedef bdlde::LzUtil    Util;
+
+const int k_MAX_BLOCK = Util::k_MAX_BLOCK_LENGTH;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+unsigned int nextRandom(unsigned int *state)
+    // Advance the specified linear congruential generator 'state', and
+    // return the next pseudo-random value in the range '[0 .. 32767]'.
+{
+    *state = *state * 1103515245U + 12345U;
+    return (*state >> 16) & 0x7fff;
+}
+
+void generateData(bsl::string *result, char kind, int length, unsigned seed)
+    // Load into the specified 'result' the specified 'length' bytes of data
+    // of the specified 'kind', generated using the specified 'seed': 'T' for
+    // log-like text, 'J' for JSON-like text, 'R' for random bytes, 'Z' for
+    // zero bytes, and 'P' for a short repeating pattern.
+{
+    unsigned int state = seed;
+
+    result->clear();
+    result->reserve(length);
+
+    static const char *const k_WORDS[] = {
+        "connection", "accepted", "from", "session", "closed", "request",
+        "timeout", "retrying", "order", "filled", "rejected", "price"
+    };
+    const int k_NUM_WORDS = sizeof k_WORDS / sizeof *k_WORDS;
+
+    char buffer[256];
+    while (static_cast<int>(result->length()) < length) {
+        int n = 0;
+        switch (kind) {
+          case 'T': {
+            n = bsl::sprintf(buffer,
+                             "2026-10-19 12:%02u:%02u.%03u INFO [%u] "
+                             "app_server.cpp:%u %s %s %s id=%u\n",
+                             nextRandom(&state) % 60,
+                             nextRandom(&state) % 60,
+                             nextRandom(&state) % 1000,
+                             nextRandom(&state) % 32,
+                             nextRandom(&state) % 2000,
+                             k_WORDS[nextRandom(&state) % k_NUM_WORDS],
+                             k_WORDS[nextRandom(&state) % k_NUM_WORDS],
+                             k_WORDS[nextRandom(&state) % k_NUM_WORDS],
+                             nextRandom(&state));
+          } break;
+          case 'J': {
+            n = bsl::sprintf(buffer,
+                             "{\"id\":%u,\"name\":\"%s-%u\",\"price\":%u.%02u,"
+                             "\"tags\":[\"%s\",\"%s\"],\"active\":%s},",
+                             nextRandom(&state),
+                             k_WORDS[nextRandom(&state) % k_NUM_WORDS],
+                             nextRandom(&state) % 100,
+                             nextRandom(&state) % 1000,
+                             nextRandom(&state) % 100,
+                             k_WORDS[nextRandom(&state) % k_NUM_WORDS],
+                             k_WORDS[nextRandom(&state) % k_NUM_WORDS],
+                             nextRandom(&state) % 2 ? "true" : "false");
+          } break;
+          case 'R': {
+            for (; n < 64; ++n) {
+                buffer[n] = static_cast<char>(nextRandom(&state) >> 3);
+            }
+          } break;
+          case 'Z': {
+            bsl::memset(buffer, 0, 64);
+            n = 64;
+          } break;
+          default: {
+            BSLS_ASSERT(kind == 'P');
+            for (; n < 63; ++n) {
+                buffer[n] = static_cast<char>('a' + n % 7);
+            }
+          } break;
+        }
+        result->append(buffer, bsl::min(n, length - int(result->length())));
+    }
+}
+
+bsl::string compressWithUtil(const bsl::string& data)
+    // Return the frame produced by 'bdlde::LzUtil::compressFrame' for the
+    // specified 'data'.
+{
+    const int         length = static_cast<int>(data.length());
+    bsl::vector<char> frame(Util::maxFrameLength(length));
+
+    const int frameLength = Util::compressFrame(frame.data(),
+                                                data.data(),
+                                                length);
+    return bsl::string(frame.data(), frameLength);
+}
+
+enum {
+    // Status values returned by 'decode'.
+
+    e_SUCCESS           = 0,
+    e_CONVERT_FAILED    = 1,
+    e_END_FAILED        = 2,
+    e_LIMIT_EXCEEDED    = 3,
+    e_RETAINED_EARLY    = 4,
+    e_NO_PROGRESS       = 5
+};
+
+int decode(bsl::string        *result,
+           Obj                *decoder,
+           const bsl::string&  frame,
+           int                 segmentLength,
+           int                 maxNumOut,
+           int                 outputCapacity)
+    // Append to the specified 'result' the output of the specified 'decoder'
+    // supplied the specified 'frame' in segments of at most the specified
+    // 'segmentLength' bytes, with the output of each call limited by the
+    // specified 'maxNumOut', followed by the output of 'endConvert'.  Use an
+    // output buffer of the specified 'outputCapacity' bytes if 'maxNumOut' is
+    // negative.  Return 'e_SUCCESS' on success, 'e_CONVERT_FAILED' or
+    // 'e_END_FAILED' if 'convert' or 'endConvert', respectively, reports an
+    // error, and another of the above status values if a call writes more
+    // than permitted, retains output before reaching its limit, or makes no
+    // progress.
+{
+    const int LENGTH = static_cast<int>(frame.length());
+    const int SIZE   = 0 <= maxNumOut ? maxNumOut : outputCapacity;
+
+    bsl::vector<char> buffer(SIZE + 1);
+    char             *out = &buffer[0];
+
+    int position = 0;
+    while (position < LENGTH) {
+        const int segmentEnd = bsl::min(position + segmentLength, LENGTH);
+
+        buffer[SIZE] = '\x5a';
+
+        int       numOut = -1;
+        int       numIn  = -1;
+        const int rc     = decoder->convert(out,
+                                            &numOut,
+                                            &numIn,
+                                            frame.data() + position,
+                                            frame.data() + segmentEnd,
+                                            maxNumOut);
+        if (numOut > SIZE || '\x5a' != buffer[SIZE]) {
+            return e_LIMIT_EXCEEDED;                                  // RETURN
+        }
+        result->append(out, numOut);
+        if (rc < 0) {
+            return e_CONVERT_FAILED;                                  // RETURN
+        }
+        if (0 < rc && numOut != maxNumOut) {
+            return e_RETAINED_EARLY;                                  // RETURN
+        }
+        if (0 == numOut && 0 == numIn) {
+            return e_NO_PROGRESS;                                     // RETURN
+        }
+        position += numIn;
+    }
+
+    int rc;
+    do {
+        buffer[SIZE] = '\x5a';
+
+        int numOut = -1;
+        rc = decoder->endConvert(out, &numOut, maxNumOut);
+        if (numOut > SIZE || '\x5a' != buffer[SIZE]) {
+            return e_LIMIT_EXCEEDED;                                  // RETURN
+        }
+        result->append(out, numOut);
+        if (rc < 0) {
+            return e_END_FAILED;                                      // RETURN
+        }
+    } while (0 < rc);
+
+    return e_SUCCESS;
+}
+
+bool isPrefix(const bsl::string& prefix, const bsl::string& string)
+    // Return 'true' if the specified 'prefix' is a prefix of the specified
+    // 'string', and 'false' otherwise.
+{
+    return prefix.length() <= string.length()
+        && 0 == string.compare(0, prefix.length(), prefix);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                              USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Decompressing a Stream
+///- - - - - - - - - - - - - - - - -
+// Suppose that we want to decompress a frame read from an input stream, and
+// write the resulting data to an output stream, using buffers of fixed size.
+//
+// First, we define a function that does so:
+//..
+int decompressStream(bsl::ostream& os, bsl::istream& is)
+    // Read the entire contents of the specified input stream 'is', decompress
+    // the frame that they hold, and write the resulting data to the specified
+    // output stream 'os'.  Return 0 on success, and a non-zero value
+    // otherwise.
+{
+    bdlde::LzDecoder decoder;
+
+    char inputBuffer[4096];
+    char outputBuffer[4096];
+
+    while (is.good()) {
+        is.read(inputBuffer, sizeof inputBuffer);
+
+        const char *input    = inputBuffer;
+        const char *inputEnd = input + is.gcount();
+
+        while (input < inputEnd) {
+            int numOut;
+            int numIn;
+            int rc = decoder.convert(outputBuffer,
+                                     &numOut,
+                                     &numIn,
+                                     input,
+                                     inputEnd,
+                                     sizeof outputBuffer);
+            if (rc < 0) {
+                return -1;                                            // RETURN
+            }
+            os.write(outputBuffer, numOut);
+            input += numIn;
+        }
+    }
+//..
+// Then, having consumed all of the input, we call 'endConvert', which
+// reports an error if the input did not hold a complete frame:
+//..
+    int numOut;
+    if (0 != decoder.endConvert(outputBuffer, &numOut)) {
+        return -1;                                                    // RETURN
+    }
+
+    return is.eof() && os.good() ? 0 : -1;
+}
+//..
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test                = argc > 1 ? atoi(argv[1]) : 0;
+    const bool verbose             = argc > 2;
+    const bool veryVerbose         = argc > 3;
+    const bool veryVeryVerbose     = argc > 4;
+    const bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::Default::setDefaultAllocator(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file
+        //:   compiles, links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate the usage example from the header file into the test
+        //:   driver, replacing 'assert' with 'ASSERT'.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Next, we compress some data into a frame using 'bdlde::LzUtil':
+//..
+        bsl::string data;
+        for (int i = 0; i < 10000; ++i) {
+            data += "a line of text that is repeated\n";
+        }
+
+        const int         length = static_cast<int>(data.length());
+        bsl::vector<char> frame(bdlde::LzUtil::maxFrameLength(length));
+
+        int frameLength = bdlde::LzUtil::compressFrame(frame.data(),
+                                                       data.data(),
+                                                       length);
+
+        bsl::string encoded(frame.data(), frameLength);
+//..
+// Then, we decompress the frame, and observe that the result is the original
+// data:
+//..
+        bsl::istringstream is(encoded);
+        bsl::ostringstream os;
+
+        int rc = decompressStream(os, is);
+        ASSERT(0 == rc);
+        ASSERT(data == os.str());
+//..
+// Finally, we observe that a truncated frame is reported as an error:
+//..
+        bsl::istringstream truncated(encoded.substr(0, encoded.length() - 1));
+        bsl::ostringstream discarded;
+
+        rc = decompressStream(discarded, truncated);
+        ASSERT(0 != rc);
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // STATE TRANSITIONS
+        //
+        // Concerns:
+        //: 1 A new decoder is in the initial state, and leaves it once any
+        //:   input is consumed.
+        //:
+        //: 2 'isDone' becomes 'true' once the complete frame has been
+        //:   consumed and all of its data emitted, and not before.
+        //:
+        //: 3 Calling 'endConvert' before the frame is complete, calling
+        //:   'convert' once 'endConvert' has been called, or calling
+        //:   'endConvert' once it has returned 0, places the decoder in the
+        //:   error state, from which only 'resetState' recovers.
+        //:
+        //: 4 'resetState' returns the decoder to the initial state, after
+        //:   which it decodes a frame as a new decoder does.
+        //:
+        //: 5 All memory is allocated from the supplied allocator on
+        //:   construction, and none is allocated by the manipulators.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Drive a decoder through each state, checking the accessors and
+        //:   return values after each call.  (C-1..4)
+        //:
+        //: 2 Use a test allocator to verify that memory is allocated only by
+        //:   the constructor, and only from the supplied allocator.  (C-5)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for argument values.  (C-6)
+        //
+        // Testing:
+        //   LzDecoder(bslma::Allocator *basicAllocator = 0);
+        //   ~LzDecoder();
+        //   void resetState();
+        //   bool isDone() const;
+        //   bool isError() const;
+        //   bool isInitialState() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "STATE TRANSITIONS" << endl
+                          << "=================" << endl;
+
+        const bsl::string DATA(1000, 'x');
+        const bsl::string FRAME       = compressWithUtil(DATA);
+        const bsl::string EMPTY_FRAME = compressWithUtil("");
+        const char *const BEGIN       = FRAME.data();
+        const char *const END         = BEGIN + FRAME.length();
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+        {
+            const bsls::Types::Int64 NUM_DEFAULT_ALLOCATIONS =
+                                            defaultAllocator.numAllocations();
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = ta.numAllocations();
+            ASSERT(0 < NUM_ALLOCATIONS);
+
+            ASSERT( X.isInitialState());
+            ASSERT(!X.isDone());
+            ASSERT(!X.isError());
+            ASSERT(0 == X.outputLength());
+
+            char buffer[2048];
+            int  numOut = -1;
+            int  numIn  = -1;
+
+            if (verbose) cout << "\tA frame supplied in two segments.\n";
+
+            ASSERT(0 == mX.convert(buffer, &numOut, &numIn, BEGIN, BEGIN));
+            ASSERT(0 == numOut);
+            ASSERT(0 == numIn);
+            ASSERT( X.isInitialState());
+
+            ASSERT(0 == mX.convert(buffer, &numOut, &numIn, BEGIN, END - 1));
+            ASSERT(int(FRAME.length()) - 1 == numIn);
+            ASSERT(!X.isInitialState());
+            ASSERT(!X.isDone());
+
+            int total = numOut;
+            ASSERT(0 == mX.convert(buffer + total,
+                                   &numOut,
+                                   &numIn,
+                                   END - 1,
+                                   END));
+            ASSERT(1 == numIn);
+            total += numOut;
+            ASSERT(DATA == bsl::string(buffer, total, &sa));
+            ASSERT( X.isDone());
+            ASSERT(!X.isError());
+
+            ASSERT(0 == mX.convert(buffer, &numOut, &numIn, END, END));
+            ASSERT( X.isDone());
+
+            ASSERT(0 == mX.endConvert(buffer, &numOut));
+            ASSERT(0 == numOut);
+            ASSERT( X.isDone());
+            ASSERT(total == X.outputLength());
+
+            if (verbose) cout << "\tCalls following 'endConvert'.\n";
+
+            ASSERT(0 > mX.endConvert(buffer, &numOut));
+            ASSERT(0 == numOut);
+            ASSERT(!X.isDone());
+            ASSERT( X.isError());
+
+            mX.resetState();
+            ASSERT( X.isInitialState());
+            ASSERT(!X.isError());
+            ASSERT(0 == X.outputLength());
+
+            ASSERT(0 == mX.convert(buffer, &numOut, &numIn, BEGIN, END));
+            ASSERT(0 == mX.endConvert(buffer, &numOut));
+            ASSERT(0 > mX.convert(buffer, &numOut, &numIn, BEGIN, BEGIN));
+            ASSERT(0 == numOut);
+            ASSERT(0 == numIn);
+            ASSERT(X.isError());
+
+            if (verbose) cout << "\tAn incomplete frame.\n";
+
+            mX.resetState();
+            ASSERT(0 > mX.endConvert(buffer, &numOut));
+            ASSERT(X.isError());
+
+            mX.resetState();
+            ASSERT(0 == mX.convert(buffer, &numOut, &numIn, BEGIN, BEGIN + 2));
+            ASSERT(!X.isInitialState());
+            ASSERT(0 > mX.endConvert(buffer, &numOut));
+            ASSERT(X.isError());
+            ASSERT(0 > mX.convert(buffer, &numOut, &numIn, BEGIN, END));
+            ASSERT(0 == numIn);
+
+            if (verbose) cout << "\tOutput retained by 'convert'.\n";
+
+            mX.resetState();
+            ASSERT(10 == mX.convert(buffer,
+                                    &numOut,
+                                    &numIn,
+                                    BEGIN,
+                                    END,
+                                    int(DATA.length()) - 10));
+            ASSERT(int(DATA.length()) - 10 == numOut);
+            ASSERT(!X.isDone());
+
+            const char *const REST = BEGIN + numIn;
+            ASSERT(REST + Util::k_TRAILER_LENGTH == END);
+
+            ASSERT(6 == mX.convert(buffer, &numOut, &numIn, REST, END, 4));
+            ASSERT(4 == numOut);
+            ASSERT(0 == numIn);
+            ASSERT(!X.isDone());
+
+            ASSERT(0 > mX.endConvert(buffer, &numOut));
+            ASSERT(X.isError());
+
+            mX.resetState();
+
+            const char *input = BEGIN;
+            total = 0;
+            while (input < END) {
+                ASSERT(0 <= mX.convert(buffer + total,
+                                       &numOut,
+                                       &numIn,
+                                       input,
+                                       END,
+                                       7));
+                ASSERT(numOut <= 7);
+                ASSERT(0 < numOut || 0 < numIn);
+                total += numOut;
+                input += numIn;
+            }
+            ASSERT(X.isDone());
+            ASSERT(DATA == bsl::string(buffer, total, &sa));
+            ASSERT(0 == mX.endConvert(buffer, &numOut));
+
+            if (verbose) cout << "\tInput following the frame.\n";
+
+            mX.resetState();
+            ASSERT(0 == mX.convert(buffer, &numOut, &numIn, BEGIN, END));
+            ASSERT(X.isDone());
+            ASSERT(0 > mX.convert(buffer, &numOut, &numIn, BEGIN, END));
+            ASSERT(0 == numIn);
+            ASSERT(X.isError());
+
+            if (verbose) cout << "\tAn output limit of 0.\n";
+
+            mX.resetState();
+            ASSERT(int(DATA.length()) == mX.convert(0,
+                                                    &numOut,
+                                                    &numIn,
+                                                    BEGIN,
+                                                    END,
+                                                    0));
+            ASSERT(0 == numOut);
+            ASSERT(0 < numIn);
+            ASSERT(!X.isInitialState());
+            ASSERT(!X.isError());
+
+            mX.resetState();
+            ASSERT(0 == mX.convert(buffer,
+                                   &numOut,
+                                   &numIn,
+                                   EMPTY_FRAME.data(),
+                                   EMPTY_FRAME.data() + EMPTY_FRAME.length(),
+                                   0));
+            ASSERT(0 == numOut);
+            ASSERT(X.isDone());
+            ASSERT(0 == mX.endConvert(0, &numOut, 0));
+            ASSERT(X.isDone());
+
+            ASSERT(NUM_ALLOCATIONS == ta.numAllocations());
+            ASSERT(NUM_DEFAULT_ALLOCATIONS ==
+                                            defaultAllocator.numAllocations());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tNegative Testing.\n";
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj  mX;
+            char buffer[16];
+            int  numOut;
+            int  numIn;
+
+            ASSERT_PASS(mX.convert(buffer, &numOut, &numIn, BEGIN, BEGIN, 5));
+            ASSERT_PASS(mX.convert(0,      &numOut, &numIn, BEGIN, BEGIN, 0));
+            ASSERT_FAIL(mX.convert(0,      &numOut, &numIn, BEGIN, BEGIN, 5));
+            ASSERT_FAIL(mX.convert(buffer, 0,       &numIn, BEGIN, BEGIN, 5));
+            ASSERT_FAIL(mX.convert(buffer, &numOut, 0,      BEGIN, BEGIN, 5));
+            ASSERT_FAIL(mX.convert(buffer, &numOut, &numIn, END,   BEGIN, 5));
+
+            ASSERT_FAIL(mX.endConvert(0,      &numOut, 5));
+            ASSERT_FAIL(mX.endConvert(buffer, 0,       5));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // DECOMPRESSING MALFORMED FRAMES
+        //
+        // Concerns:
+        //: 1 A frame having an invalid header, an invalid block header, a
+        //:   block that cannot be decompressed, or a checksum that does not
+        //:   match its data is reported as an error by 'convert', placing the
+        //:   decoder in the error state.
+        //:
+        //: 2 Input following a complete frame is reported as an error by
+        //:   'convert'.
+        //:
+        //: 3 A truncated frame is accepted by 'convert', and reported as an
+        //:   error by 'endConvert', and the output is a prefix of the data.
+        //:
+        //: 4 No corruption of a frame goes undetected (unless it does not
+        //:   affect the data, as for the match length of the final sequence
+        //:   of a block, which is unused), and no call writes more than
+        //:   permitted, however the frame is corrupted.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, decode frames constructed by
+        //:   hand, supplied both in one segment and a byte at a time, and
+        //:   verify the status reported and the state of the decoder.
+        //:   (C-1..2)
+        //:
+        //: 2 Decode every prefix of a frame holding several blocks, and
+        //:   verify the status reported and the output.  (C-3)
+        //:
+        //: 3 Decode the frames obtained by flipping each bit of a frame, and
+        //:   verify that an error is reported, or that the data is restored
+        //:   exactly.  (C-4)
+        //
+        // Testing:
+        //   DECOMPRESSING MALFORMED FRAMES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "DECOMPRESSING MALFORMED FRAMES" << endl
+                          << "==============================" << endl;
+
+        if (verbose) cout << "\tHand-crafted frames.\n";
+        {
+            // "BDLZ\x01", the block headers of a raw block of 3 bytes and of
+            // a compressed block of 3 bytes, and the end mark
+
+#define HEADER     "BDLZ\x01"
+#define RAW3       "\x03\x00\x00\x80"
+#define COMPRESSED "\x03\x00\x00\x00"
+#define END_MARK   "\x00\x00\x00\x00"
+#define ABC_CRC    "\xb7\x3f\x4b\x36"
+
+            static const struct {
+                int         d_line;
+                const char *d_frame;
+                int         d_length;
+                int         d_expected;   // 'decode' status
+            } DATA[] = {
+                { L_, HEADER RAW3 "abc" END_MARK ABC_CRC,
+                                                    20, e_SUCCESS          },
+                { L_, HEADER END_MARK "\x00\x00\x00\x00",
+                                                    13, e_SUCCESS          },
+                { L_, "",                            0, e_END_FAILED       },
+                { L_, "BDLY\x01",                    5, e_CONVERT_FAILED   },
+                { L_, "BDLZ\x02",                    5, e_CONVERT_FAILED   },
+                { L_, HEADER "\x00\x00\x00\x80",     9, e_CONVERT_FAILED   },
+                { L_, HEADER "\x01\x00\x01\x80",     9, e_CONVERT_FAILED   },
+                { L_, HEADER "\x00\x00\x01\x00",     9, e_CONVERT_FAILED   },
+                { L_, HEADER "\x00\x00\x01\x80",     9, e_END_FAILED       },
+                { L_, HEADER COMPRESSED "\x40""ab",
+                                                    12, e_CONVERT_FAILED   },
+                { L_, HEADER RAW3 "abd" END_MARK ABC_CRC,
+                                                    20, e_CONVERT_FAILED   },
+                { L_, HEADER RAW3 "abc" END_MARK ABC_CRC "x",
+                                                    21, e_CONVERT_FAILED   },
+                { L_, HEADER RAW3 "abc" END_MARK ABC_CRC HEADER,
+                                                    25, e_CONVERT_FAILED   },
+                { L_, HEADER RAW3 "abc" END_MARK,   16, e_END_FAILED       },
+                { L_, HEADER RAW3 "abc",            12, e_END_FAILED       },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+#undef HEADER
+#undef RAW3
+#undef COMPRESSED
+#undef END_MARK
+#undef ABC_CRC
+
+            const int SEGMENT_LENGTHS[] = { 1, 1000 };
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE     = DATA[ti].d_line;
+                const bsl::string FRAME(DATA[ti].d_frame, DATA[ti].d_length);
+                const int         EXPECTED = DATA[ti].d_expected;
+
+                for (int ts = 0; ts < 2; ++ts) {
+                    const int SEGMENT = SEGMENT_LENGTHS[ts];
+
+                    Obj mX;  const Obj& X = mX;
+
+                    bsl::string result;
+                    const int   rc = decode(&result,
+                                            &mX,
+                                            FRAME,
+                                            SEGMENT,
+                                            -1,
+                                            k_MAX_BLOCK);
+
+                    ASSERTV(LINE, SEGMENT, rc, EXPECTED == rc);
+                    ASSERTV(LINE, SEGMENT, (e_SUCCESS == rc) == X.isDone());
+                    ASSERTV(LINE, SEGMENT, (e_SUCCESS != rc) == X.isError());
+                    if (e_SUCCESS == rc) {
+                        ASSERTV(LINE, SEGMENT,
+                                result.empty() || "abc" == result);
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\tTruncated frames.\n";
+        {
+            bsl::string data;
+            generateData(&data, 'T', 2 * k_MAX_BLOCK + 1000, 5);
+
+            const bsl::string FRAME  = compressWithUtil(data);
+            const int         LENGTH = static_cast<int>(FRAME.length());
+
+            for (int length = 0;
+                 length < LENGTH;
+                 length += length < 200 || LENGTH - 200 < length ? 1 : 97) {
+                const bsl::string TRUNCATED(FRAME, 0, length);
+
+                const int SEGMENT = 0 == length % 2 ? length + 1 : 777;
+
+                Obj         mX;
+                bsl::string result;
+                const int   rc = decode(&result,
+                                        &mX,
+                                        TRUNCATED,
+                                        SEGMENT,
+                                        -1,
+                                        int(data.length()));
+
+                ASSERTV(length, rc, e_END_FAILED == rc);
+                ASSERTV(length, isPrefix(result, data));
+                if (veryVeryVerbose && 0 == length % 10000) {
+                    T_ P_(length) P(result.length())
+                }
+            }
+        }
+
+        if (verbose) cout << "\tCorrupted frames.\n";
+        {
+            bsl::string data;
+            generateData(&data, 'T', 300, 9);
+
+            const bsl::string FRAME  = compressWithUtil(data);
+            const int         LENGTH = static_cast<int>(FRAME.length());
+
+            for (int position = 0; position < LENGTH; ++position) {
+                for (int bit = 0; bit < 8; ++bit) {
+                    bsl::string corrupted(FRAME);
+                    corrupted[position] = static_cast<char>(
+                                             corrupted[position] ^ (1 << bit));
+
+                    const int MAX_NUM_OUTS[] = { -1, 7 };
+
+                    for (int tm = 0; tm < 2; ++tm) {
+                        const int MAX_NUM_OUT = MAX_NUM_OUTS[tm];
+
+                        Obj         mX;
+                        bsl::string result;
+                        const int   rc = decode(&result,
+                                                &mX,
+                                                corrupted,
+                                                LENGTH,
+                                                MAX_NUM_OUT,
+                                                k_MAX_BLOCK);
+
+                        ASSERTV(position, bit, MAX_NUM_OUT, rc,
+                                e_CONVERT_FAILED == rc ||
+                                e_END_FAILED     == rc ||
+                                (e_SUCCESS == rc && data == result));
+                        if (veryVeryVerbose && e_SUCCESS == rc) {
+                            T_ P_(position) P(bit)
+                        }
+                    }
+                }
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONVERT AND END CONVERT
+        //
+        // Concerns:
+        //: 1 The data of a frame produced by 'LzUtil::compressFrame' is
+        //:   restored exactly, for data that fills no block, one block, and
+        //:   several blocks, with and without a partial last block, and for
+        //:   frames holding both compressed and uncompressed blocks.
+        //:
+        //: 2 The output is independent of the lengths of the segments in
+        //:   which the frame is supplied, and of the limit on the output,
+        //:   including limits that do, and that do not, leave room to
+        //:   decompress a block directly into the output buffer.
+        //:
+        //: 3 No call writes more than 'maxNumOut' bytes.
+        //:
+        //: 4 A call retains output only if it reaches the output limit, and
+        //:   consumes no input while it retains output.
+        //:
+        //: 5 'outputLength' reports the total emitted.
+        //:
+        //: 6 The frames produced by 'LzEncoder' are decoded.
+        //
+        // Plan:
+        //: 1 For each kind of data, and each length in a table of lengths
+        //:   chosen around multiples of the block length, decode the frame
+        //:   produced by 'LzUtil::compressFrame' with each combination of
+        //:   segment length and output limit from two tables, using the helper
+        //:   function 'decode', which checks the results of each call, and
+        //:   compare the output with the data.  (C-1..5)
+        //:
+        //: 2 Decode a frame produced by 'LzEncoder'.  (C-6)
+        //
+        // Testing:
+        //   int convert(char*, int*, int*, const char*, const char*, int);
+        //   int endConvert(char *, int *, int);
+        //   bsls::Types::Int64 outputLength() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONVERT AND END CONVERT" << endl
+                          << "=======================" << endl;
+
+        const char KINDS[]   = { 'T', 'R', 'P' };
+        const int  NUM_KINDS = sizeof KINDS / sizeof *KINDS;
+
+        const int LENGTHS[] = {
+            0, 1, 100, k_MAX_BLOCK - 1, k_MAX_BLOCK, k_MAX_BLOCK + 1,
+            3 * k_MAX_BLOCK + 17
+        };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        const int SEGMENT_LENGTHS[] = { 1, 7, 4096, k_MAX_BLOCK + 3, 0 };
+        const int NUM_SEGMENT_LENGTHS = static_cast<int>(
+                             sizeof SEGMENT_LENGTHS / sizeof *SEGMENT_LENGTHS);
+            // 0 indicates that the frame is supplied in a single segment
+
+        const int MAX_NUM_OUTS[]   = { -1, 1, 100, 4096, k_MAX_BLOCK + 100 };
+        const int NUM_MAX_NUM_OUTS = static_cast<int>(
+                                   sizeof MAX_NUM_OUTS / sizeof *MAX_NUM_OUTS);
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+        Obj                  mX(&ta);  const Obj& X = mX;
+
+        for (int tk = 0; tk < NUM_KINDS; ++tk) {
+            const char KIND = KINDS[tk];
+
+            for (int tl = 0; tl < NUM_LENGTHS; ++tl) {
+                const int LENGTH = LENGTHS[tl];
+
+                bsl::string data;
+                generateData(&data, KIND, LENGTH, 17 + tl);
+
+                const bsl::string FRAME = compressWithUtil(data);
+
+                if (veryVerbose) {
+                    T_ P_(KIND) P_(LENGTH) P(FRAME.length())
+                }
+
+                for (int ts = 0; ts < NUM_SEGMENT_LENGTHS; ++ts) {
+                    const int SEGMENT = 0 < SEGMENT_LENGTHS[ts]
+                                        ? SEGMENT_LENGTHS[ts]
+                                        : int(FRAME.length());
+
+                    for (int tm = 0; tm < NUM_MAX_NUM_OUTS; ++tm) {
+                        const int MAX_NUM_OUT = MAX_NUM_OUTS[tm];
+
+                        mX.resetState();
+
+                        bsl::string result;
+                        const int   rc = decode(&result,
+                                                &mX,
+                                                FRAME,
+                                                SEGMENT,
+                                                MAX_NUM_OUT,
+                                                LENGTH);
+
+                        ASSERTV(KIND, LENGTH, SEGMENT, MAX_NUM_OUT, rc,
+                                e_SUCCESS == rc);
+                        ASSERTV(KIND, LENGTH, SEGMENT, MAX_NUM_OUT,
+                                data == result);
+                        ASSERTV(KIND, LENGTH, SEGMENT, MAX_NUM_OUT,
+                                X.isDone());
+                        ASSERTV(KIND, LENGTH, SEGMENT, MAX_NUM_OUT,
+                                LENGTH == X.outputLength());
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\tFrames produced by 'LzEncoder'.\n";
+        {
+            bsl::string data;
+            generateData(&data, 'J', 2 * k_MAX_BLOCK + 5, 1);
+
+            bdlde::LzEncoder  encoder;
+            bsl::vector<char> frame(bdlde::LzEncoder::maxOutputLength(
+                                                          int(data.length())));
+            int numOut;
+            int numIn;
+            ASSERT(0 == encoder.convert(&frame[0],
+                                        &numOut,
+                                        &numIn,
+                                        data.data(),
+                                        data.data() + data.length()));
+            int frameLength = numOut;
+            ASSERT(0 == encoder.endConvert(&frame[frameLength], &numOut));
+            frameLength += numOut;
+
+            mX.resetState();
+
+            bsl::string result;
+            ASSERT(e_SUCCESS == decode(&result,
+                                       &mX,
+                                       bsl::string(&frame[0], frameLength),
+                                       1000,
+                                       -1,
+                                       int(data.length())));
+            ASSERT(data == result);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Decompress the frame of a short string, supplied in two
+        //:   segments, and verify that the result is the original string.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const bsl::string DATA  = "hello, hello, hello, hello, hello, world";
+        const bsl::string FRAME = compressWithUtil(DATA);
+        const int         SPLIT = 10;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+        Obj                  mX(&ta);  const Obj& X = mX;
+
+        ASSERT(X.isInitialState());
+
+        char buffer[256];
+        int  total = 0;
+        int  numOut;
+        int  numIn;
+
+        ASSERT(0 == mX.convert(buffer,
+                               &numOut,
+                               &numIn,
+                               FRAME.data(),
+                               FRAME.data() + SPLIT));
+        ASSERT(SPLIT == numIn);
+        total += numOut;
+        ASSERT(!X.isDone());
+
+        ASSERT(0 == mX.convert(buffer + total,
+                               &numOut,
+                               &numIn,
+                               FRAME.data() + SPLIT,
+                               FRAME.data() + FRAME.length()));
+        ASSERT(int(FRAME.length()) - SPLIT == numIn);
+        total += numOut;
+        ASSERT(X.isDone());
+
+        ASSERT(0 == mX.endConvert(buffer + total, &numOut));
+        ASSERT(0 == numOut);
+
+        if (veryVerbose) { T_ P_(FRAME.length()) P(total) }
+
+        ASSERT(DATA == bsl::string(buffer, total));
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
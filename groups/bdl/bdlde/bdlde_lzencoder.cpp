@@ -0,0 +1,203 @@
+// bdlde_lzencoder.cpp                                                -*-C++-*-
+#include <bdlde_lzencoder.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlde_lzencoder_cpp,"$Id$ $CSID$")
+
+#include <bdlde_crc32c.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+
+namespace BloombergLP {
+namespace bdlde {
+
+namespace {
+
+enum {
+    k_OUTPUT_CAPACITY = LzUtil::k_FRAME_HEADER_LENGTH
+                      + 2 * LzUtil::k_BLOCK_HEADER_LENGTH
+                      + 2 * (LzUtil::k_MAX_BLOCK_LENGTH
+                             + LzUtil::k_MAX_BLOCK_LENGTH / 255
+                             + 16)
+                      + LzUtil::k_TRAILER_LENGTH
+        // capacity of the retained output, which holds at most the frame
+        // header, or a block not fully emitted by 'convert', followed by the
+        // last block and the trailer written by 'endConvert'
+};
+
+}  // close unnamed namespace
+
+                              // ---------------
+                              // class LzEncoder
+                              // ---------------
+
+// PRIVATE MANIPULATORS
+void LzEncoder::appendBlock()
+{
+    if (0 < d_blockLength) {
+        char *output = d_output.data() + d_outputEnd;
+
+        d_outputEnd   += LzUtil::compressFrameBlock(output,
+                                                    d_block.data(),
+                                                    d_blockLength);
+        d_blockLength  = 0;
+    }
+}
+
+void LzEncoder::emit(char **out, int *numOut, int maxNumOut)
+{
+    int numBytes = d_outputEnd - d_outputBegin;
+    if (0 <= maxNumOut) {
+        numBytes = bsl::min(numBytes, maxNumOut - *numOut);
+    }
+
+    if (0 == numBytes) {
+        return;                                                       // RETURN
+    }
+
+    bsl::memcpy(*out, d_output.data() + d_outputBegin, numBytes);
+    *out           += numBytes;
+    *numOut        += numBytes;
+    d_outputLength += numBytes;
+    d_outputBegin  += numBytes;
+
+    if (d_outputBegin == d_outputEnd) {
+        d_outputBegin = 0;
+        d_outputEnd   = 0;
+    }
+}
+
+// CREATORS
+LzEncoder::LzEncoder(bslma::Allocator *basicAllocator)
+: d_state(e_INITIAL_STATE)
+, d_block(LzUtil::k_MAX_BLOCK_LENGTH, basicAllocator)
+, d_blockLength(0)
+, d_output(k_OUTPUT_CAPACITY, basicAllocator)
+, d_outputBegin(0)
+, d_outputEnd(0)
+, d_checksum(Crc32c::k_NULL_CRC32C)
+, d_inputLength(0)
+, d_outputLength(0)
+{
+}
+
+// MANIPULATORS
+int LzEncoder::convert(char       *out,
+                       int        *numOut,
+                       int        *numIn,
+                       const char *begin,
+                       const char *end,
+                       int         maxNumOut)
+{
+    BSLS_ASSERT(out || 0 == maxNumOut);
+    BSLS_ASSERT(numOut);
+    BSLS_ASSERT(numIn);
+    BSLS_ASSERT(begin <= end);
+
+    *numOut = 0;
+    *numIn  = 0;
+
+    if (e_INPUT_STATE < d_state || e_ERROR_STATE == d_state) {
+        d_state = e_ERROR_STATE;
+        return -1;                                                    // RETURN
+    }
+
+    if (e_INITIAL_STATE == d_state) {
+        LzUtil::writeFrameHeader(d_output.data());
+        d_outputEnd = LzUtil::k_FRAME_HEADER_LENGTH;
+        d_state     = e_INPUT_STATE;
+    }
+
+    const char *input = begin;
+    while (true) {
+        if (d_outputBegin != d_outputEnd) {
+            emit(&out, numOut, maxNumOut);
+            if (d_outputBegin != d_outputEnd) {
+                break;
+            }
+        }
+        if (input == end) {
+            break;
+        }
+
+        const int numBytes = static_cast<int>(bsl::min<bsls::Types::Int64>(
+                                  end - input,
+                                  LzUtil::k_MAX_BLOCK_LENGTH - d_blockLength));
+
+        bsl::memcpy(d_block.data() + d_blockLength, input, numBytes);
+        d_checksum     = Crc32c::calculate(input, numBytes, d_checksum);
+        d_blockLength += numBytes;
+        d_inputLength += numBytes;
+        input         += numBytes;
+
+        if (LzUtil::k_MAX_BLOCK_LENGTH == d_blockLength) {
+            appendBlock();
+        }
+    }
+
+    *numIn = static_cast<int>(input - begin);
+    return d_outputEnd - d_outputBegin;
+}
+
+int LzEncoder::endConvert(char *out, int *numOut, int maxNumOut)
+{
+    BSLS_ASSERT(out || 0 == maxNumOut);
+    BSLS_ASSERT(numOut);
+
+    *numOut = 0;
+
+    if (e_DONE_STATE == d_state || e_ERROR_STATE == d_state) {
+        d_state = e_ERROR_STATE;
+        return -1;                                                    // RETURN
+    }
+
+    if (e_ENDING_STATE != d_state) {
+        if (e_INITIAL_STATE == d_state) {
+            LzUtil::writeFrameHeader(d_output.data());
+            d_outputEnd = LzUtil::k_FRAME_HEADER_LENGTH;
+        }
+        appendBlock();
+        LzUtil::writeTrailer(d_output.data() + d_outputEnd, d_checksum);
+        d_outputEnd += LzUtil::k_TRAILER_LENGTH;
+        d_state      = e_ENDING_STATE;
+    }
+
+    emit(&out, numOut, maxNumOut);
+
+    const int numRetained = d_outputEnd - d_outputBegin;
+    if (0 == numRetained) {
+        d_state = e_DONE_STATE;
+    }
+    return numRetained;
+}
+
+void LzEncoder::resetState()
+{
+    d_state        = e_INITIAL_STATE;
+    d_blockLength  = 0;
+    d_outputBegin  = 0;
+    d_outputEnd    = 0;
+    d_checksum     = Crc32c::k_NULL_CRC32C;
+    d_inputLength  = 0;
+    d_outputLength = 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
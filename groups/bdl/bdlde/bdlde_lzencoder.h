@@ -0,0 +1,369 @@
+// bdlde_lzencoder.h                                                  -*-C++-*-
+#ifndef INCLUDED_BDLDE_LZENCODER
+#define INCLUDED_BDLDE_LZENCODER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an automaton compressing data into an LZ frame.
+//
+//@CLASSES:
+//  bdlde::LzEncoder: automaton performing streaming LZ compression
+//
+//@SEE_ALSO: bdlde_lzdecoder, bdlde_lzutil
+//
+//@DESCRIPTION: This component provides a 'class', 'bdlde::LzEncoder', that
+// compresses data of arbitrary length, supplied in segments, into a frame in
+// the format described in 'bdlde_lzutil' (see {'bdlde_lzutil'|Frame Format}).
+// Like the other encoders in this package (e.g., 'bdlde::Base64Encoder'), an
+// instance retains the state of the conversion from one call to 'convert' to
+// the next, and the end of the input is indicated by calling 'endConvert'.
+// The total output may be limited on each call, in which case the encoder
+// retains the output that it could not emit, and stops consuming input, until
+// it is called again.
+//
+// The encoder gathers its input into blocks of 'LzUtil::k_MAX_BLOCK_LENGTH'
+// bytes, and compresses each block when it is complete, so that the frame
+// produced for given data is the same as that produced by
+// 'LzUtil::compressFrame' for the same data, however the data is divided among
+// calls to 'convert'.  Because the encoder emits output a block at a time, it
+// reads from and writes to 'char' buffers, rather than to the iterators
+// accepted by the encoders of textual encodings.
+//
+///Memory Usage
+///------------
+// An encoder allocates approximately 200 kilobytes on construction (for the
+// input block being gathered and the compressed output not yet emitted), and
+// does not allocate thereafter.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Compressing a Stream
+///- - - - - - - - - - - - - - - -
+// Suppose that we want to compress the data read from an input stream, and
+// write the resulting frame to an output stream, using buffers of fixed size.
+//
+// First, we define a function that does so:
+//..
+//  int compressStream(bsl::ostream& os, bsl::istream& is)
+//      // Read the entire contents of the specified input stream 'is',
+//      // compress them, and write the resulting frame to the specified
+//      // output stream 'os'.  Return 0 on success, and a non-zero value
+//      // otherwise.
+//  {
+//      bdlde::LzEncoder encoder;
+//
+//      char inputBuffer[4096];
+//      char outputBuffer[4096];
+//
+//      while (is.good()) {
+//          is.read(inputBuffer, sizeof inputBuffer);
+//
+//          const char *input    = inputBuffer;
+//          const char *inputEnd = input + is.gcount();
+//
+//          while (input < inputEnd) {
+//              int numOut;
+//              int numIn;
+//              int rc = encoder.convert(outputBuffer,
+//                                       &numOut,
+//                                       &numIn,
+//                                       input,
+//                                       inputEnd,
+//                                       sizeof outputBuffer);
+//              if (rc < 0) {
+//                  return -1;                                    // RETURN
+//              }
+//              os.write(outputBuffer, numOut);
+//              input += numIn;
+//          }
+//      }
+//..
+// Then, having consumed all of the input, we call 'endConvert' until it
+// reports that no output is retained:
+//..
+//      int more;
+//      do {
+//          int numOut;
+//          more = encoder.endConvert(outputBuffer,
+//                                    &numOut,
+//                                    sizeof outputBuffer);
+//          if (more < 0) {
+//              return -1;                                            // RETURN
+//          }
+//          os.write(outputBuffer, numOut);
+//      } while (more);
+//
+//      return is.eof() && os.good() ? 0 : -1;
+//  }
+//..
+// Finally, we compress some data, and observe that the result is the frame
+// that 'bdlde::LzUtil::compressFrame' would produce:
+//..
+//  bsl::string data;
+//  for (int i = 0; i < 10000; ++i) {
+//      data += "a line of text that is repeated\n";
+//  }
+//
+//  bsl::istringstream is(data);
+//  bsl::ostringstream os;
+//
+//  int rc = compressStream(os, is);
+//  assert(0 == rc);
+//  assert(os.str().length() < data.length() / 10);
+//
+//  const int         length = static_cast<int>(data.length());
+//  bsl::vector<char> frame(bdlde::LzUtil::maxFrameLength(length));
+//
+//  int frameLength = bdlde::LzUtil::compressFrame(frame.data(),
+//                                                 data.data(),
+//                                                 length);
+//  assert(os.str() == bsl::string(frame.data(), frameLength));
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlde_lzutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_review.h>
+#include <bsls_types.h>
+
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlde {
+
+                              // ===============
+                              // class LzEncoder
+                              // ===============
+
+class LzEncoder {
+    // This class implements a mechanism that compresses data of arbitrary
+    // length into a frame.  See {'bdlde_lzutil'|Frame Format}.
+
+    // PRIVATE TYPES
+    enum {
+        // Symbolic state values.
+
+        e_ERROR_STATE   = -1,  // Input is irreparably invalid.
+        e_INITIAL_STATE =  0,  // No input has been consumed.
+        e_INPUT_STATE   =  1,  // Ready to accept input.
+        e_ENDING_STATE  =  2,  // 'endConvert' has retained output.
+        e_DONE_STATE    =  3   // Any additional input is an error.
+    };
+
+    // DATA
+    signed char         d_state;         // state as per above enum
+
+    bsl::vector<char>   d_block;         // data of the block being gathered
+
+    int                 d_blockLength;   // length of the data in 'd_block'
+
+    bsl::vector<char>   d_output;        // compressed output
+
+    int                 d_outputBegin;   // offset in 'd_output' of the first
+                                         // retained byte
+
+    int                 d_outputEnd;     // offset in 'd_output' following the
+                                         // last retained byte
+
+    unsigned int        d_checksum;      // CRC32-C of the input consumed
+
+    bsls::Types::Int64  d_inputLength;   // total length of the input
+                                         // consumed
+
+    bsls::Types::Int64  d_outputLength;  // total length of the output emitted
+
+  private:
+    // NOT IMPLEMENTED
+    LzEncoder(const LzEncoder&);
+    LzEncoder& operator=(const LzEncoder&);
+
+    // PRIVATE MANIPULATORS
+    void appendBlock();
+        // Append the gathered block, if it is not empty, to the retained
+        // output, and reset the gathered block to be empty.
+
+    void emit(char **out, int *numOut, int maxNumOut);
+        // Copy retained output to the specified '*out' buffer, and advance
+        // '*out' and the specified '*numOut' count of bytes emitted past the
+        // bytes copied, without '*numOut' exceeding the specified
+        // 'maxNumOut' unless 'maxNumOut' is negative.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(LzEncoder, bslma::UsesBslmaAllocator);
+
+    // CLASS METHODS
+    static int maxOutputLength(int inputLength);
+        // Return the maximum number of bytes, not counting any bytes retained
+        // from previous calls, that are written by a call to 'convert'
+        // supplied the specified 'inputLength' bytes, or by a call to
+        // 'endConvert' if 'inputLength' is 0, when no limit is imposed on
+        // the output.  The behavior is undefined unless
+        // '0 <= inputLength <= 1000000000'.
+
+    // CREATORS
+    explicit LzEncoder(bslma::Allocator *basicAllocator = 0);
+        // Create an LZ encoder in the initial state.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    //! ~LzEncoder() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    int convert(char       *out,
+                int        *numOut,
+                int        *numIn,
+                const char *begin,
+                const char *end,
+                int         maxNumOut = -1);
+        // Compress the sequence of input bytes starting at the specified
+        // 'begin' address up to, but not including, the specified 'end'
+        // address, writing any resulting output bytes to the specified 'out'
+        // buffer.  Optionally specify the 'maxNumOut' limit on the number of
+        // bytes to output; if 'maxNumOut' is negative, no limit is imposed.
+        // If the 'maxNumOut' limit is reached, no further input will be
+        // consumed.  Load into the specified 'numOut' and 'numIn' the number
+        // of output bytes produced and input bytes consumed, respectively.
+        // Return a non-negative value on success and a negative value
+        // otherwise.  A positive return status indicates the number of output
+        // bytes retained by this encoder and not written to 'out' because
+        // 'maxNumOut' has been reached; these bytes are available for output
+        // if this method (or 'endConvert') is called again.  The behavior is
+        // undefined unless 'begin <= end', and 'out' can hold 'maxNumOut'
+        // bytes if 'maxNumOut' is non-negative, and the number of retained
+        // bytes plus 'maxOutputLength(end - begin)' bytes otherwise.  Note
+        // that calling this method after 'endConvert' has been invoked
+        // without an intervening 'resetState' call will place this instance
+        // in an error state, and return an error status.
+
+    int endConvert(char *out, int *numOut, int maxNumOut = -1);
+        // Terminate compression for this encoder, compressing the remaining
+        // input and writing any retained output, followed by the trailer of
+        // the frame, to the specified 'out' buffer.  Optionally specify the
+        // 'maxNumOut' limit on the number of bytes to output; if 'maxNumOut'
+        // is negative, no limit is imposed.  Load into the specified 'numOut'
+        // the number of output bytes produced.  Return 0 on success, the
+        // positive number of bytes *still* retained by this encoder if the
+        // 'maxNumOut' limit was reached, and a negative value otherwise.  Any
+        // retained bytes are available on a subsequent call to 'endConvert'.
+        // Once this method is called, no additional input may be supplied
+        // without an intervening call to 'resetState'; once this method
+        // returns a zero status, a subsequent call will place this encoder in
+        // the error state, and return an error status.  The behavior is
+        // undefined unless 'out' can hold 'maxNumOut' bytes if 'maxNumOut' is
+        // non-negative, and the number of retained bytes plus
+        // 'maxOutputLength(0)' bytes otherwise.
+
+    void resetState();
+        // Reset this instance to its initial state (i.e., as if no input had
+        // been consumed).
+
+    // ACCESSORS
+    bool isDone() const;
+        // Return 'true' if 'endConvert' has been called and all resulting
+        // output has been emitted (so that any additional input, including
+        // 'endConvert', would be an error), and 'false' otherwise.
+
+    bool isError() const;
+        // Return 'true' if there is no possibility of achieving an
+        // "acceptable" result, and 'false' otherwise.
+
+    bool isInitialState() const;
+        // Return 'true' if this instance is in the initial state (i.e., as if
+        // no input had been consumed), and 'false' otherwise.
+
+    bsls::Types::Int64 inputLength() const;
+        // Return the total length of the input consumed thus far.
+
+    bsls::Types::Int64 outputLength() const;
+        // Return the total length of the output emitted thus far.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                              // ---------------
+                              // class LzEncoder
+                              // ---------------
+
+// CLASS METHODS
+inline
+int LzEncoder::maxOutputLength(int inputLength)
+{
+    BSLS_ASSERT(0 <= inputLength);
+    BSLS_ASSERT(inputLength <= 1000000000);
+
+    const int numBlocks = (inputLength + LzUtil::k_MAX_BLOCK_LENGTH - 1)
+                        / LzUtil::k_MAX_BLOCK_LENGTH
+                        + 1;
+
+    return LzUtil::k_FRAME_HEADER_LENGTH
+         + numBlocks * (LzUtil::k_BLOCK_HEADER_LENGTH
+                        + LzUtil::maxCompressedLength(
+                                                 LzUtil::k_MAX_BLOCK_LENGTH))
+         + LzUtil::k_TRAILER_LENGTH;
+}
+
+// ACCESSORS
+inline
+bool LzEncoder::isDone() const
+{
+    return e_DONE_STATE == d_state;
+}
+
+inline
+bool LzEncoder::isError() const
+{
+    return e_ERROR_STATE == d_state;
+}
+
+inline
+bool LzEncoder::isInitialState() const
+{
+    return e_INITIAL_STATE == d_state;
+}
+
+inline
+bsls::Types::Int64 LzEncoder::inputLength() const
+{
+    return d_inputLength;
+}
+
+inline
+bsls::Types::Int64 LzEncoder::outputLength() const
+{
+    return d_outputLength;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
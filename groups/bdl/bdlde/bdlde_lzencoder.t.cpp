@@ -0,0 +1,934 @@
+// bdlde_lzencoder.t.cpp                                              -*-C++-*-
+#include <bdlde_lzencoder.h>
+
+#include <bdlde_lzutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// The component under test is a mechanism that compresses data, supplied in
+// segments, into a frame.  Its essential property is that the frame it
+// produces is the one produced by 'bdlde::LzUtil::compressFrame' for the same
+// data, however the data is divided among calls to 'convert' and however the
+// output of each call is limited; we verify this over a range of lengths
+// (around the block length) and kinds of data, for segment lengths from one
+// byte to the whole input, and for output limits from one byte to none.  The
+// state transitions, including the errors reported for calls made after the
+// end of the input, are tested separately.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] int maxOutputLength(int);
+//
+// CREATORS
+// [ 4] LzEncoder(bslma::Allocator *basicAllocator = 0);
+// [ 4] ~LzEncoder();
+//
+// MANIPULATORS
+// [ 3] int convert(char*, int*, int*, const char*, const char*, int);
+// [ 3] int endConvert(char *, int *, int);
+// [ 4] void resetState();
+//
+// ACCESSORS
+// [ 4] bool isDone() const;
+// [ 4] bool isError() const;
+// [ 4] bool isInitialState() const;
+// [ 3] bsls::Types::Int64 inputLength() const;
+// [ 3] bsls::Types::Int64 outputLength() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlde::LzEncoder Obj;
+typedef bdlde::LzUtil    Util;
+
+const int k_MAX_BLOCK = Util::k_MAX_BLOCK_LENGTH;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+unsigned int nextRandom(unsigned int *state)
+    // Advance the specified linear congruential generator 'state', and
+    // return the next pseudo-random value in the range '[0 .. 32767]'.
+{
+    *state = *state * 1103515245U + 12345U;
+    return (*state >> 16) & 0x7fff;
+}
+
+void generateData(bsl::string *result, char kind, int length, unsigned seed)
+    // Load into the specified 'result' the specified 'length' bytes of data
+    // of the specified 'kind', generated using the specified 'seed': 'T' for
+    // log-like text, 'J' for JSON-like text, 'R' for random bytes, 'Z' for
+    // zero bytes, and 'P' for a short repeating pattern.
+{
+    unsigned int state = seed;
+
+    result->clear();
+    result->reserve(length);
+
+    static const char *const k_WORDS[] = {
+        "connection", "accepted", "from", "session", "closed", "request",
+        "timeout", "retrying", "order", "filled", "rejected", "price"
+    };
+    const int k_NUM_WORDS = sizeof k_WORDS / sizeof *k_WORDS;
+
+    char buffer[256];
+    while (static_cast<int>(result->length()) < length) {
+        int n = 0;
+        switch (kind) {
+          case 'T': {
+            n = bsl::sprintf(buffer,
+                             "2026-10-19 12:%02u:%02u.%03u INFO [%u] "
+                             "app_server.cpp:%u %s %s %s id=%u\n",
+                             nextRandom(&state) % 60,
+                             nextRandom(&state) % 60,
+                             nextRandom(&state) % 1000,
+                             nextRandom(&state) % 32,
+                             nextRandom(&state) % 2000,
+                             k_WORDS[nextRandom(&state) % k_NUM_WORDS],
+                             k_WORDS[nextRandom(&state) % k_NUM_WORDS],
+                             k_WORDS[nextRandom(&state) % k_NUM_WORDS],
+                             nextRandom(&state));
+          } break;
+          case 'J': {
+            n = bsl::sprintf(buffer,
+                             "{\"id\":%u,\"name\":\"%s-%u\",\"price\":%u.%02u,"
+                             "\"tags\":[\"%s\",\"%s\"],\"active\":%s},",
+                             nextRandom(&state),
+                             k_WORDS[nextRandom(&state) % k_NUM_WORDS],
+                             nextRandom(&state) % 100,
+                             nextRandom(&state) % 1000,
+                             nextRandom(&state) % 100,
+                             k_WORDS[nextRandom(&state) % k_NUM_WORDS],
+                             k_WORDS[nextRandom(&state) % k_NUM_WORDS],
+                             nextRandom(&state) % 2 ? "true" : "false");
+          } break;
+          case 'R': {
+            for (; n < 64; ++n) {
+                buffer[n] = static_cast<char>(nextRandom(&state) >> 3);
+            }
+          } break;
+          case 'Z': {
+            bsl::memset(buffer, 0, 64);
+            n = 64;
+          } break;
+          default: {
+            BSLS_ASSERT(kind == 'P');
+            for (; n < 63; ++n) {
+                buffer[n] = static_cast<char>('a' + n % 7);
+            }
+          } break;
+        }
+        result->append(buffer, bsl::min(n, length - int(result->length())));
+    }
+}
+
+bsl::string compressWithUtil(const bsl::string& data)
+    // Return the frame produced by 'bdlde::LzUtil::compressFrame' for the
+    // specified 'data'.
+{
+    const int         length = static_cast<int>(data.length());
+    bsl::vector<char> frame(Util::maxFrameLength(length));
+
+    const int frameLength = Util::compressFrame(frame.data(),
+                                                data.data(),
+                                                length);
+    return bsl::string(frame.data(), frameLength);
+}
+
+int encode(bsl::string        *result,
+           Obj                *encoder,
+           const bsl::string&  data,
+           int                 segmentLength,
+           int                 maxNumOut)
+    // Append to the specified 'result' the output of the specified 'encoder'
+    // supplied the specified 'data' in segments of at most the specified
+    // 'segmentLength' bytes, with the output of each call limited by the
+    // specified 'maxNumOut', followed by the output of 'endConvert'.  Return
+    // 0 on success, and a non-zero value if any call fails, writes more than
+    // permitted, or makes no progress.
+{
+    const int LENGTH = static_cast<int>(data.length());
+    const int SIZE   = 0 <= maxNumOut ? maxNumOut
+                                      : Obj::maxOutputLength(segmentLength);
+
+    bsl::vector<char> buffer(SIZE + 1);
+    char             *out = &buffer[0];
+
+    int position = 0;
+    while (position < LENGTH) {
+        const int segmentEnd = bsl::min(position + segmentLength, LENGTH);
+
+        buffer[SIZE] = '\x5a';
+
+        int       numOut = -1;
+        int       numIn  = -1;
+        const int rc     = encoder->convert(out,
+                                            &numOut,
+                                            &numIn,
+                                            data.data() + position,
+                                            data.data() + segmentEnd,
+                                            maxNumOut);
+        if (rc < 0) {
+            return 1;                                                 // RETURN
+        }
+        if (numOut > SIZE || '\x5a' != buffer[SIZE]) {
+            return 2;                                                 // RETURN
+        }
+        if (0 < rc && numOut != maxNumOut) {
+            return 3;                                                 // RETURN
+        }
+        if (0 == numOut && 0 == numIn) {
+            return 4;                                                 // RETURN
+        }
+        result->append(out, numOut);
+        position += numIn;
+    }
+
+    int rc;
+    do {
+        buffer[SIZE] = '\x5a';
+
+        int numOut = -1;
+        rc = encoder->endConvert(out, &numOut, maxNumOut);
+        if (rc < 0) {
+            return 5;                                                 // RETURN
+        }
+        if (numOut > SIZE || '\x5a' != buffer[SIZE]) {
+            return 6;                                                 // RETURN
+        }
+        result->append(out, numOut);
+    } while (0 < rc);
+
+    return 0;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                              USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Compressing a Stream
+///- - - - - - - - - - - - - - - -
+// Suppose that we want to compress the data read from an input stream, and
+// write the resulting frame to an output stream, using buffers of fixed size.
+//
+// First, we define a function that does so:
+//..
+int compressStream(bsl::ostream& os, bsl::istream& is)
+    // Read the entire contents of the specified input stream 'is', compress
+    // them, and write the resulting frame to the specified output stream
+    // 'os'.  Return 0 on success, and a non-zero value otherwise.
+{
+    bdlde::LzEncoder encoder;
+
+    char inputBuffer[4096];
+    char outputBuffer[4096];
+
+    while (is.good()) {
+        is.read(inputBuffer, sizeof inputBuffer);
+
+        const char *input    = inputBuffer;
+        const char *inputEnd = input + is.gcount();
+
+        while (input < inputEnd) {
+            int numOut;
+            int numIn;
+            int rc = encoder.convert(outputBuffer,
+                                     &numOut,
+                                     &numIn,
+                                     input,
+                                     inputEnd,
+                                     sizeof outputBuffer);
+            if (rc < 0) {
+                return -1;                                            // RETURN
+            }
+            os.write(outputBuffer, numOut);
+            input += numIn;
+        }
+    }
+//..
+// Then, having consumed all of the input, we call 'endConvert' until it
+// reports that no output is retained:
+//..
+    int more;
+    do {
+        int numOut;
+        more = encoder.endConvert(outputBuffer,
+                                  &numOut,
+                                  sizeof outputBuffer);
+        if (more < 0) {
+            return -1;                                                // RETURN
+        }
+        os.write(outputBuffer, numOut);
+    } while (more);
+
+    return is.eof() && os.good() ? 0 : -1;
+}
+//..
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test                = argc > 1 ? atoi(argv[1]) : 0;
+    const bool verbose             = argc > 2;
+    const bool veryVerbose         = argc > 3;
+    const bool veryVeryVerbose     = argc > 4;
+    const bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::Default::setDefaultAllocator(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file
+        //:   compiles, links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate the usage example from the header file into the test
+        //:   driver, replacing 'assert' with 'ASSERT'.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Finally, we compress some data, and observe that the result is the frame
+// that 'bdlde::LzUtil::compressFrame' would produce:
+//..
+        bsl::string data;
+        for (int i = 0; i < 10000; ++i) {
+            data += "a line of text that is repeated\n";
+        }
+
+        bsl::istringstream is(data);
+        bsl::ostringstream os;
+
+        int rc = compressStream(os, is);
+        ASSERT(0 == rc);
+        ASSERT(os.str().length() < data.length() / 10);
+
+        const int         length = static_cast<int>(data.length());
+        bsl::vector<char> frame(bdlde::LzUtil::maxFrameLength(length));
+
+        int frameLength = bdlde::LzUtil::compressFrame(frame.data(),
+                                                       data.data(),
+                                                       length);
+        ASSERT(os.str() == bsl::string(frame.data(), frameLength));
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // STATE TRANSITIONS
+        //
+        // Concerns:
+        //: 1 A new encoder is in the initial state, and leaves it once
+        //:   'convert' or 'endConvert' is called.
+        //:
+        //: 2 The frame header is produced by the first call, even if no input
+        //:   is supplied, and an encoder supplied no input produces the frame
+        //:   of empty data.
+        //:
+        //: 3 'isDone' becomes 'true' only once 'endConvert' has emitted all of
+        //:   its output.
+        //:
+        //: 4 Calling 'convert' once 'endConvert' has been called, or calling
+        //:   'endConvert' once it has returned 0, places the encoder in the
+        //:   error state, from which only 'resetState' recovers.
+        //:
+        //: 5 'resetState' returns the encoder to the initial state, after
+        //:   which it produces the same frame as a new encoder.
+        //:
+        //: 6 All memory is allocated from the supplied allocator on
+        //:   construction, and none is allocated by the manipulators.
+        //:
+        //: 7 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Drive an encoder through each state, checking the accessors and
+        //:   return values after each call.  (C-1..5)
+        //:
+        //: 2 Use a test allocator to verify that memory is allocated only by
+        //:   the constructor, and only from the supplied allocator.  (C-6)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for argument values.  (C-7)
+        //
+        // Testing:
+        //   LzEncoder(bslma::Allocator *basicAllocator = 0);
+        //   ~LzEncoder();
+        //   void resetState();
+        //   bool isDone() const;
+        //   bool isError() const;
+        //   bool isInitialState() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "STATE TRANSITIONS" << endl
+                          << "=================" << endl;
+
+        const bsl::string EMPTY_FRAME = compressWithUtil("");
+        const bsl::string DATA(1000, 'x');
+        const bsl::string FRAME       = compressWithUtil(DATA);
+
+        ASSERT(Util::k_FRAME_HEADER_LENGTH + Util::k_TRAILER_LENGTH ==
+                                                    int(EMPTY_FRAME.length()));
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+        {
+            const bsls::Types::Int64 NUM_DEFAULT_ALLOCATIONS =
+                                            defaultAllocator.numAllocations();
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = ta.numAllocations();
+            ASSERT(0 < NUM_ALLOCATIONS);
+
+            ASSERT( X.isInitialState());
+            ASSERT(!X.isDone());
+            ASSERT(!X.isError());
+            ASSERT(0 == X.inputLength());
+            ASSERT(0 == X.outputLength());
+
+            if (verbose) cout << "\tThe frame of empty data.\n";
+
+            char buffer[256];
+            int  numOut = -1;
+            int  numIn  = -1;
+            ASSERT(0 == mX.convert(buffer,
+                                   &numOut,
+                                   &numIn,
+                                   DATA.data(),
+                                   DATA.data()));
+            ASSERT(Util::k_FRAME_HEADER_LENGTH == numOut);
+            ASSERT(0 == numIn);
+            ASSERT(!X.isInitialState());
+            ASSERT(!X.isDone());
+
+            int total = numOut;
+            ASSERT(0 == mX.endConvert(buffer + total, &numOut));
+            total += numOut;
+            ASSERT(EMPTY_FRAME == bsl::string(buffer, total, &sa));
+            ASSERT( X.isDone());
+            ASSERT(!X.isError());
+            ASSERT(total == X.outputLength());
+
+            if (verbose) cout << "\tCalls following 'endConvert'.\n";
+
+            ASSERT(0 > mX.endConvert(buffer, &numOut));
+            ASSERT(0 == numOut);
+            ASSERT(!X.isDone());
+            ASSERT( X.isError());
+
+            mX.resetState();
+            ASSERT( X.isInitialState());
+            ASSERT(!X.isError());
+            ASSERT(0 == X.outputLength());
+
+            ASSERT(0 == mX.endConvert(buffer, &numOut));
+            ASSERT(EMPTY_FRAME == bsl::string(buffer, numOut, &sa));
+            ASSERT(0 > mX.convert(buffer,
+                                  &numOut,
+                                  &numIn,
+                                  DATA.data(),
+                                  DATA.data() + 1));
+            ASSERT(0 == numOut);
+            ASSERT(0 == numIn);
+            ASSERT(X.isError());
+            ASSERT(0 > mX.convert(buffer,
+                                  &numOut,
+                                  &numIn,
+                                  DATA.data(),
+                                  DATA.data()));
+            ASSERT(X.isError());
+
+            if (verbose) cout << "\tOutput retained by 'endConvert'.\n";
+
+            mX.resetState();
+            ASSERT(0 == mX.convert(buffer,
+                                   &numOut,
+                                   &numIn,
+                                   DATA.data(),
+                                   DATA.data() + DATA.length()));
+            ASSERT(int(DATA.length()) == numIn);
+            ASSERT(1000 == X.inputLength());
+
+            total = numOut;
+            ASSERT(0 < mX.endConvert(buffer + total, &numOut, 1));
+            ASSERT(1 == numOut);
+            ASSERT(!X.isDone());
+            total += numOut;
+
+            ASSERT(0 > mX.convert(buffer,
+                                  &numOut,
+                                  &numIn,
+                                  DATA.data(),
+                                  DATA.data()));
+            ASSERT(X.isError());
+
+            mX.resetState();
+            total = 0;
+            ASSERT(0 == mX.convert(buffer,
+                                   &numOut,
+                                   &numIn,
+                                   DATA.data(),
+                                   DATA.data() + DATA.length()));
+            total += numOut;
+            int rc;
+            do {
+                rc = mX.endConvert(buffer + total, &numOut, 3);
+                ASSERT(0 <= rc);
+                ASSERT(numOut <= 3);
+                total += numOut;
+            } while (0 < rc);
+            ASSERT(FRAME == bsl::string(buffer, total, &sa));
+            ASSERT(X.isDone());
+
+            if (verbose) cout << "\tAn output limit of 0.\n";
+
+            mX.resetState();
+            ASSERT(Util::k_FRAME_HEADER_LENGTH == mX.convert(0,
+                                                             &numOut,
+                                                             &numIn,
+                                                             DATA.data(),
+                                                             DATA.data() + 1,
+                                                             0));
+            ASSERT(0 == numOut);
+            ASSERT(0 == numIn);
+            ASSERT(!X.isInitialState());
+            ASSERT(!X.isError());
+
+            ASSERT(NUM_ALLOCATIONS == ta.numAllocations());
+            ASSERT(NUM_DEFAULT_ALLOCATIONS ==
+                                            defaultAllocator.numAllocations());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tNegative Testing.\n";
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj         mX;
+            char        buffer[Util::k_FRAME_HEADER_LENGTH];
+            const char *INPUT = DATA.data();
+            int         numOut;
+            int         numIn;
+
+            ASSERT_PASS(mX.convert(buffer, &numOut, &numIn, INPUT, INPUT, 5));
+            ASSERT_PASS(mX.convert(0,      &numOut, &numIn, INPUT, INPUT, 0));
+            ASSERT_FAIL(mX.convert(0,      &numOut, &numIn, INPUT, INPUT, 5));
+            ASSERT_FAIL(mX.convert(buffer, 0,       &numIn, INPUT, INPUT, 5));
+            ASSERT_FAIL(mX.convert(buffer, &numOut, 0,      INPUT, INPUT, 5));
+            ASSERT_FAIL(mX.convert(buffer,
+                                   &numOut,
+                                   &numIn,
+                                   INPUT + 1,
+                                   INPUT,
+                                   5));
+
+            ASSERT_FAIL(mX.endConvert(0,      &numOut, 5));
+            ASSERT_FAIL(mX.endConvert(buffer, 0,       5));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CONVERT AND END CONVERT
+        //
+        // Concerns:
+        //: 1 The output is the frame produced by 'LzUtil::compressFrame' for
+        //:   the same data, for data that fills no block, one block, and
+        //:   several blocks, with and without a partial last block, and for
+        //:   both compressible and incompressible data.
+        //:
+        //: 2 The output is independent of the lengths of the segments in
+        //:   which the input is supplied, and of the limit on the output.
+        //:
+        //: 3 No call writes more than 'maxNumOut' bytes, or, absent a limit,
+        //:   more than 'maxOutputLength' of the input supplied.
+        //:
+        //: 4 A call retains output only if it reaches the output limit, and
+        //:   consumes no input while it retains output.
+        //:
+        //: 5 'inputLength' and 'outputLength' report the totals consumed and
+        //:   emitted.
+        //
+        // Plan:
+        //: 1 For each kind of data, and each length in a table of lengths
+        //:   chosen around multiples of the block length, encode the data
+        //:   with each combination of segment length and output limit from
+        //:   two tables, using the helper function 'encode', which checks the
+        //:   results of each call, and compare the output with the frame
+        //:   produced by 'LzUtil::compressFrame'.  (C-1..5)
+        //
+        // Testing:
+        //   int convert(char*, int*, int*, const char*, const char*, int);
+        //   int endConvert(char *, int *, int);
+        //   bsls::Types::Int64 inputLength() const;
+        //   bsls::Types::Int64 outputLength() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONVERT AND END CONVERT" << endl
+                          << "=======================" << endl;
+
+        const char KINDS[]   = { 'T', 'R', 'P' };
+        const int  NUM_KINDS = sizeof KINDS / sizeof *KINDS;
+
+        const int LENGTHS[] = {
+            0, 1, 100, k_MAX_BLOCK - 1, k_MAX_BLOCK, k_MAX_BLOCK + 1,
+            3 * k_MAX_BLOCK + 17
+        };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        const int SEGMENT_LENGTHS[] = { 1, 7, 4096, k_MAX_BLOCK + 3, 0 };
+        const int NUM_SEGMENT_LENGTHS = static_cast<int>(
+                             sizeof SEGMENT_LENGTHS / sizeof *SEGMENT_LENGTHS);
+            // 0 indicates that the input is supplied in a single segment
+
+        const int MAX_NUM_OUTS[]   = { -1, 1, 100, 4096 };
+        const int NUM_MAX_NUM_OUTS = static_cast<int>(
+                                   sizeof MAX_NUM_OUTS / sizeof *MAX_NUM_OUTS);
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+        Obj                  mX(&ta);  const Obj& X = mX;
+
+        for (int tk = 0; tk < NUM_KINDS; ++tk) {
+            const char KIND = KINDS[tk];
+
+            for (int tl = 0; tl < NUM_LENGTHS; ++tl) {
+                const int LENGTH = LENGTHS[tl];
+
+                bsl::string data;
+                generateData(&data, KIND, LENGTH, 17 + tl);
+
+                const bsl::string EXPECTED = compressWithUtil(data);
+
+                if (veryVerbose) {
+                    T_ P_(KIND) P_(LENGTH) P(EXPECTED.length())
+                }
+
+                for (int ts = 0; ts < NUM_SEGMENT_LENGTHS; ++ts) {
+                    const int SEGMENT = 0 < SEGMENT_LENGTHS[ts]
+                                        ? SEGMENT_LENGTHS[ts]
+                                        : bsl::max(LENGTH, 1);
+
+                    for (int tm = 0; tm < NUM_MAX_NUM_OUTS; ++tm) {
+                        const int MAX_NUM_OUT = MAX_NUM_OUTS[tm];
+
+                        mX.resetState();
+
+                        bsl::string result;
+                        const int   rc = encode(&result,
+                                                &mX,
+                                                data,
+                                                SEGMENT,
+                                                MAX_NUM_OUT);
+
+                        ASSERTV(KIND, LENGTH, SEGMENT, MAX_NUM_OUT, rc,
+                                0 == rc);
+                        ASSERTV(KIND, LENGTH, SEGMENT, MAX_NUM_OUT,
+                                EXPECTED == result);
+                        ASSERTV(KIND, LENGTH, SEGMENT, MAX_NUM_OUT,
+                                X.isDone());
+                        ASSERTV(KIND, LENGTH, SEGMENT, MAX_NUM_OUT,
+                                LENGTH == X.inputLength());
+                        ASSERTV(KIND, LENGTH, SEGMENT, MAX_NUM_OUT,
+                                int(result.length()) == X.outputLength());
+                    }
+                }
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CLASS METHOD 'maxOutputLength'
+        //
+        // Concerns:
+        //: 1 'maxOutputLength' allows for the frame header, the trailer, a
+        //:   block for each 'k_MAX_BLOCK_LENGTH' bytes of input (rounded up),
+        //:   and a block completed from input supplied earlier.
+        //:
+        //: 2 The bound is not exceeded by incompressible data.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Compare the result for a table of lengths with values computed
+        //:   by hand.  (C-1)
+        //:
+        //: 2 Encode random data in a single call and check that the output
+        //:   does not exceed the bound.  (C-2)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for argument values.  (C-3)
+        //
+        // Testing:
+        //   int maxOutputLength(int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CLASS METHOD 'maxOutputLength'" << endl
+                          << "==============================" << endl;
+
+        const int BLOCK = Util::k_BLOCK_HEADER_LENGTH
+                        + Util::maxCompressedLength(k_MAX_BLOCK);
+        const int FIXED = Util::k_FRAME_HEADER_LENGTH
+                        + Util::k_TRAILER_LENGTH;
+
+        static const struct {
+            int d_line;
+            int d_length;
+            int d_expected;
+        } DATA[] = {
+            { L_,               0, FIXED +     BLOCK },
+            { L_,               1, FIXED + 2 * BLOCK },
+            { L_, k_MAX_BLOCK - 1, FIXED + 2 * BLOCK },
+            { L_,     k_MAX_BLOCK, FIXED + 2 * BLOCK },
+            { L_, k_MAX_BLOCK + 1, FIXED + 3 * BLOCK },
+            { L_, 4 * k_MAX_BLOCK, FIXED + 5 * BLOCK },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE     = DATA[ti].d_line;
+            const int LENGTH   = DATA[ti].d_length;
+            const int EXPECTED = DATA[ti].d_expected;
+
+            ASSERTV(LINE, EXPECTED == Obj::maxOutputLength(LENGTH));
+        }
+
+        bsl::string data;
+        generateData(&data, 'R', 2 * k_MAX_BLOCK + 5, 3);
+
+        bsl::vector<char> buffer(Obj::maxOutputLength(
+                                                    int(data.length())));
+        Obj mX;
+        int numOut;
+        int numIn;
+        ASSERT(0 == mX.convert(&buffer[0],
+                               &numOut,
+                               &numIn,
+                               data.data(),
+                               data.data() + data.length()));
+        ASSERT(int(data.length()) == numIn);
+        ASSERT(numOut <= Obj::maxOutputLength(numIn));
+
+        ASSERT(0 == mX.endConvert(&buffer[0], &numOut));
+        ASSERT(numOut <= Obj::maxOutputLength(0));
+
+        if (verbose) cout << "\tNegative Testing.\n";
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Obj::maxOutputLength(0));
+            ASSERT_PASS(Obj::maxOutputLength(1000000000));
+            ASSERT_FAIL(Obj::maxOutputLength(-1));
+            ASSERT_FAIL(Obj::maxOutputLength(1000000001));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Compress a short string in two segments, and verify that the
+        //:   result is the frame produced by 'LzUtil::compressFrame' and that
+        //:   it decompresses to the original string.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const char DATA[] = "hello, hello, hello, hello, hello, world";
+        const int  LENGTH = sizeof DATA - 1;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+        Obj                  mX(&ta);  const Obj& X = mX;
+
+        ASSERT(X.isInitialState());
+
+        char buffer[256];
+        int  total = 0;
+        int  numOut;
+        int  numIn;
+
+        ASSERT(0 == mX.convert(buffer, &numOut, &numIn, DATA, DATA + 10));
+        ASSERT(10 == numIn);
+        total += numOut;
+
+        ASSERT(0 == mX.convert(buffer + total,
+                               &numOut,
+                               &numIn,
+                               DATA + 10,
+                               DATA + LENGTH));
+        ASSERT(LENGTH - 10 == numIn);
+        total += numOut;
+
+        ASSERT(0 == mX.endConvert(buffer + total, &numOut));
+        total += numOut;
+        ASSERT(X.isDone());
+
+        if (veryVerbose) { T_ P_(LENGTH) P(total) }
+
+        const bsl::string FRAME(buffer, total);
+        ASSERT(compressWithUtil(DATA) == FRAME);
+
+        bsl::vector<char> output(LENGTH);
+        ASSERT(LENGTH == Util::decompressFrame(output.data(),
+                                               LENGTH,
+                                               buffer,
+                                               total));
+        ASSERT(0 == bsl::memcmp(DATA, output.data(), LENGTH));
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,602 @@
+// bdlde_lzutil.cpp                                                   -*-C++-*-
+#include <bdlde_lzutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlde_lzutil_cpp,"$Id$ $CSID$")
+
+#include <bdlde_crc32c.h>
+
+#include <bdlb_bitutil.h>
+
+#include <bsls_platform.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_climits.h>
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_cstring.h>
+
+namespace BloombergLP {
+namespace {
+
+enum {
+    k_MIN_MATCH     = 4,      // length of the shortest match
+
+    k_LAST_LITERALS = 5,      // minimum length of the final literal run
+
+    k_MATCH_LIMIT   = 12,     // no match starts within this many bytes of
+                              // the end of a block
+
+    k_MAX_OFFSET    = 65535,  // largest distance back to a match
+
+    k_HASH_LOG      = 12,     // base-2 logarithm of the number of hash
+                              // table entries
+
+    k_SKIP_TRIGGER  = 6,      // base-2 logarithm of the number of failed
+                              // searches after which the search step grows
+
+    k_RUN_MASK      = 15      // nibble value indicating that a length
+                              // continues in additional bytes
+};
+
+const unsigned int k_RAW_BLOCK_FLAG = 0x80000000U;
+    // flag set in the header of a block whose data is stored uncompressed
+
+const char k_FRAME_HEADER[bdlde::LzUtil::k_FRAME_HEADER_LENGTH] = {
+    'B', 'D', 'L', 'Z', 1
+};
+
+                        // =================
+                        // Utility Functions
+                        // =================
+
+inline
+unsigned int load32(const char *address)
+    // Return the 4 bytes at the specified 'address' in native byte order.
+{
+    unsigned int value;
+    bsl::memcpy(&value, address, sizeof value);
+    return value;
+}
+
+inline
+bsl::uint64_t load64(const char *address)
+    // Return the 8 bytes at the specified 'address' in native byte order.
+{
+    bsl::uint64_t value;
+    bsl::memcpy(&value, address, sizeof value);
+    return value;
+}
+
+inline
+unsigned int hashPosition(const char *address)
+    // Return the index of the hash table entry for the 4 bytes at the
+    // specified 'address'.
+{
+    return (load32(address) * 2654435761U) >> (32 - k_HASH_LOG);
+}
+
+inline
+unsigned int readUint32(const char *address)
+    // Return the 4-byte little-endian value at the specified 'address'.
+{
+    const unsigned char *bytes =
+                             reinterpret_cast<const unsigned char *>(address);
+    return  static_cast<unsigned int>(bytes[0])
+         | (static_cast<unsigned int>(bytes[1]) << 8)
+         | (static_cast<unsigned int>(bytes[2]) << 16)
+         | (static_cast<unsigned int>(bytes[3]) << 24);
+}
+
+inline
+void writeUint32(char *address, unsigned int value)
+    // Write the specified 'value' to the specified 'address' as a 4-byte
+    // little-endian value.
+{
+    address[0] = static_cast<char>(value);
+    address[1] = static_cast<char>(value >> 8);
+    address[2] = static_cast<char>(value >> 16);
+    address[3] = static_cast<char>(value >> 24);
+}
+
+inline
+int commonLength(const char *first, const char *second, const char *limit)
+    // Return the number of leading bytes that are the same in the sequences
+    // starting at the specified 'first' and 'second' addresses, without
+    // examining 'first' at or beyond the specified 'limit'.  The behavior is
+    // undefined unless 'second < first <= limit'.
+{
+    const char *const start = first;
+
+    while (first + 8 <= limit) {
+        const bsl::uint64_t difference = load64(first) ^ load64(second);
+        if (difference) {
+#if defined(BSLS_PLATFORM_IS_LITTLE_ENDIAN)
+            const int numBits = bdlb::BitUtil::numTrailingUnsetBits(
+                                                                  difference);
+#else
+            const int numBits = bdlb::BitUtil::numLeadingUnsetBits(
+                                                                  difference);
+#endif
+            return static_cast<int>(first - start) + (numBits >> 3);
+                                                                      // RETURN
+        }
+        first  += 8;
+        second += 8;
+    }
+    while (first < limit && *first == *second) {
+        ++first;
+        ++second;
+    }
+    return static_cast<int>(first - start);
+}
+
+inline
+char *writeLength(char *output, int length)
+    // Write to the specified 'output' the additional bytes of a length whose
+    // nibble in the token of its sequence is 'k_RUN_MASK', given the
+    // specified 'length' less 'k_RUN_MASK', and return the address following
+    // the last byte written.
+{
+    for (; length >= 255; length -= 255) {
+        *output++ = static_cast<char>(255);
+    }
+    *output++ = static_cast<char>(length);
+    return output;
+}
+
+inline
+char *writeLiterals(char *output, const char *literals, int length)
+    // Write to the specified 'output' the token of a sequence having the
+    // specified 'length' literal bytes (and a match length nibble of 0),
+    // followed by those bytes, copied from the specified 'literals' address.
+    // Return the address following the last byte written.
+{
+    char *token = output++;
+    if (length >= k_RUN_MASK) {
+        *token = static_cast<char>(k_RUN_MASK << 4);
+        output = writeLength(output, length - k_RUN_MASK);
+    }
+    else {
+        *token = static_cast<char>(length << 4);
+    }
+    bsl::memcpy(output, literals, length);
+    return output + length;
+}
+
+inline
+int readLength(bsl::size_t          *length,
+               const unsigned char **input,
+               const unsigned char  *end)
+    // Add to the specified 'length' the additional bytes of a length read
+    // from the specified '*input' address, and advance '*input' past them.
+    // Return 0 on success, and a non-zero value if the length is not
+    // terminated before the specified 'end' address, or is too large.
+{
+    unsigned int byte;
+    do {
+        if (*input == end) {
+            return -1;                                                // RETURN
+        }
+        byte     = *(*input)++;
+        *length += byte;
+    } while (255 == byte);
+
+    return *length > static_cast<bsl::size_t>(INT_MAX) ? -1 : 0;
+}
+
+inline
+void copyMatch(char *output, bsl::size_t offset, bsl::size_t length)
+    // Copy to the specified 'output' the specified 'length' bytes starting
+    // the specified 'offset' bytes before 'output', where the source and the
+    // destination may overlap (so that the bytes copied repeat with a period
+    // of 'offset').
+{
+    const char *const match = output - offset;
+
+    if (offset >= length) {
+        bsl::memcpy(output, match, length);
+        return;                                                       // RETURN
+    }
+
+    // The bytes from 'match' to 'output' repeat with a period of 'offset', so
+    // copying all of them preserves the period, and doubles the length of
+    // the next copy.
+
+    char *const end = output + length;
+    while (output < end) {
+        const bsl::size_t numBytes = bsl::min<bsl::size_t>(output - match,
+                                                           end - output);
+        bsl::memcpy(output, match, numBytes);
+        output += numBytes;
+    }
+}
+
+}  // close unnamed namespace
+
+namespace bdlde {
+
+                                // -------------
+                                // struct LzUtil
+                                // -------------
+
+// CLASS METHODS
+int LzUtil::compressBlock(char *output, const char *input, int inputLength)
+{
+    BSLS_ASSERT(output);
+    BSLS_ASSERT(input || 0 == inputLength);
+    BSLS_ASSERT(0 <= inputLength);
+
+    const char *const end    = input + inputLength;
+    const char       *anchor = input;  // start of the pending literals
+    char             *out    = output;
+
+    if (inputLength > k_MATCH_LIMIT) {
+        const char *const searchLimit = end - k_MATCH_LIMIT;
+        const char *const matchLimit  = end - k_LAST_LITERALS;
+
+        unsigned int table[1 << k_HASH_LOG];  // positions, relative to
+                                              // 'input', by hash value
+        bsl::memset(table, 0, sizeof table);
+
+        const char *current = input + 1;
+        while (current <= searchLimit) {
+
+            // Find the next position that matches an earlier one, stepping
+            // through the input faster the longer no match is found.
+
+            const char *match    = 0;
+            int         searches = 1 << k_SKIP_TRIGGER;
+            int         step     = 1;
+            for (; current <= searchLimit;
+                   current += step, step = searches++ >> k_SKIP_TRIGGER) {
+                unsigned int&     entry     = table[hashPosition(current)];
+                const char *const candidate = input + entry;
+
+                entry = static_cast<unsigned int>(current - input);
+                if (current - candidate <= k_MAX_OFFSET
+                 && load32(candidate) == load32(current)) {
+                    match = candidate;
+                    break;
+                }
+            }
+            if (0 == match) {
+                break;
+            }
+
+            // Extend the match backwards over the pending literals.
+
+            while (current > anchor
+                && match   > input
+                && current[-1] == match[-1]) {
+                --current;
+                --match;
+            }
+
+            // Write a sequence for the match, and then for each match that
+            // immediately follows it.
+
+            char *token = out;
+            out = writeLiterals(out,
+                                anchor,
+                                static_cast<int>(current - anchor));
+
+            while (true) {
+                const int offset = static_cast<int>(current - match);
+                *out++ = static_cast<char>(offset);
+                *out++ = static_cast<char>(offset >> 8);
+
+                const int length = commonLength(current + k_MIN_MATCH,
+                                                match   + k_MIN_MATCH,
+                                                matchLimit);
+                current += k_MIN_MATCH + length;
+                if (length >= k_RUN_MASK) {
+                    *token = static_cast<char>(*token | k_RUN_MASK);
+                    out    = writeLength(out, length - k_RUN_MASK);
+                }
+                else {
+                    *token = static_cast<char>(*token | length);
+                }
+                anchor = current;
+
+                if (current > searchLimit) {
+                    break;
+                }
+
+                table[hashPosition(current - 2)] =
+                                static_cast<unsigned int>(current - 2 - input);
+
+                unsigned int& entry = table[hashPosition(current)];
+                match = input + entry;
+                entry = static_cast<unsigned int>(current - input);
+                if (current - match > k_MAX_OFFSET
+                 || load32(match) != load32(current)) {
+                    ++current;
+                    break;
+                }
+
+                token  = out++;
+                *token = 0;
+            }
+        }
+    }
+
+    out = writeLiterals(out, anchor, static_cast<int>(end - anchor));
+    return static_cast<int>(out - output);
+}
+
+int LzUtil::decompressBlock(char       *output,
+                            int         outputCapacity,
+                            const char *input,
+                            int         inputLength)
+{
+    BSLS_ASSERT(output || 0 == outputCapacity);
+    BSLS_ASSERT(input  || 0 == inputLength);
+    BSLS_ASSERT(0 <= outputCapacity);
+    BSLS_ASSERT(0 <= inputLength);
+
+    typedef const unsigned char *ConstBytePtr;
+
+    const unsigned char *in    = reinterpret_cast<ConstBytePtr>(input);
+    const unsigned char *inEnd = in + inputLength;
+    char                *out   = output;
+    char *const          outEnd = output + outputCapacity;
+
+    while (true) {
+        if (in == inEnd) {
+            return -1;                                                // RETURN
+        }
+        const unsigned int token = *in++;
+
+        bsl::size_t literalLength = token >> 4;
+        if (k_RUN_MASK == literalLength
+         && 0 != readLength(&literalLength, &in, inEnd)) {
+            return -1;                                                // RETURN
+        }
+        if (literalLength > static_cast<bsl::size_t>(inEnd - in)
+         || literalLength > static_cast<bsl::size_t>(outEnd - out)) {
+            return -1;                                                // RETURN
+        }
+        if (literalLength <= 16 && inEnd - in >= 16 && outEnd - out >= 16) {
+            // Copy a fixed length, which is faster than copying exactly
+            // 'literalLength' bytes.
+
+            bsl::memcpy(out, in, 16);
+        }
+        else {
+            bsl::memcpy(out, in, literalLength);
+        }
+        out += literalLength;
+        in  += literalLength;
+
+        if (in == inEnd) {
+            break;
+        }
+
+        if (inEnd - in < 2) {
+            return -1;                                                // RETURN
+        }
+        const bsl::size_t offset = in[0] | (in[1] << 8);
+        in += 2;
+        if (0 == offset || offset > static_cast<bsl::size_t>(out - output)) {
+            return -1;                                                // RETURN
+        }
+
+        bsl::size_t matchLength = token & k_RUN_MASK;
+        if (k_RUN_MASK == matchLength
+         && 0 != readLength(&matchLength, &in, inEnd)) {
+            return -1;                                                // RETURN
+        }
+        matchLength += k_MIN_MATCH;
+        if (matchLength > static_cast<bsl::size_t>(outEnd - out)) {
+            return -1;                                                // RETURN
+        }
+        if (offset >= 16 && matchLength <= 32 && outEnd - out >= 32) {
+            // Copy a fixed length, in chunks that do not overlap their
+            // source.
+
+            bsl::memcpy(out,      out - offset,      16);
+            bsl::memcpy(out + 16, out - offset + 16, 16);
+        }
+        else {
+            copyMatch(out, offset, matchLength);
+        }
+        out += matchLength;
+    }
+
+    return static_cast<int>(out - output);
+}
+
+int LzUtil::compressFrame(char *output, const char *input, int inputLength)
+{
+    BSLS_ASSERT(output);
+    BSLS_ASSERT(input || 0 == inputLength);
+    BSLS_ASSERT(0 <= inputLength);
+
+    char *out = output;
+
+    writeFrameHeader(out);
+    out += k_FRAME_HEADER_LENGTH;
+
+    for (int offset = 0; offset < inputLength; offset += k_MAX_BLOCK_LENGTH) {
+        const int length = bsl::min(inputLength - offset,
+                                    static_cast<int>(k_MAX_BLOCK_LENGTH));
+
+        out += compressFrameBlock(out, input + offset, length);
+    }
+
+    writeTrailer(out, Crc32c::calculate(input, inputLength));
+    out += k_TRAILER_LENGTH;
+
+    return static_cast<int>(out - output);
+}
+
+int LzUtil::decompressFrame(char       *output,
+                            int         outputCapacity,
+                            const char *input,
+                            int         inputLength)
+{
+    BSLS_ASSERT(output || 0 == outputCapacity);
+    BSLS_ASSERT(0 <= outputCapacity);
+    BSLS_ASSERT(input || 0 == inputLength);
+    BSLS_ASSERT(0 <= inputLength);
+
+    const char *in     = input;
+    const char *inEnd  = input + inputLength;
+    int         length = 0;  // length of the data written to 'output'
+
+    if (inEnd - in < k_FRAME_HEADER_LENGTH || 0 != readFrameHeader(in)) {
+        return -1;                                                    // RETURN
+    }
+    in += k_FRAME_HEADER_LENGTH;
+
+    while (true) {
+        if (inEnd - in < k_BLOCK_HEADER_LENGTH) {
+            return -1;                                                // RETURN
+        }
+
+        int  dataLength;
+        bool isCompressed;
+        if (0 != readBlockHeader(&dataLength, &isCompressed, in)) {
+            return -1;                                                // RETURN
+        }
+        in += k_BLOCK_HEADER_LENGTH;
+
+        if (0 == dataLength) {
+            break;
+        }
+        if (inEnd - in < dataLength) {
+            return -1;                                                // RETURN
+        }
+
+        const int capacity = bsl::min(outputCapacity - length,
+                                      static_cast<int>(k_MAX_BLOCK_LENGTH));
+        int       numBytes;
+
+        if (isCompressed) {
+            numBytes = decompressBlock(output + length,
+                                       capacity,
+                                       in,
+                                       dataLength);
+            if (numBytes <= 0) {
+                return -1;                                            // RETURN
+            }
+        }
+        else {
+            if (dataLength > capacity) {
+                return -1;                                            // RETURN
+            }
+            bsl::memcpy(output + length, in, dataLength);
+            numBytes = dataLength;
+        }
+
+        in     += dataLength;
+        length += numBytes;
+    }
+
+    if (inEnd - in != k_CHECKSUM_LENGTH
+     || readChecksum(in) != Crc32c::calculate(output, length)) {
+        return -1;                                                    // RETURN
+    }
+    return length;
+}
+
+                        // Frame Building Blocks
+
+int LzUtil::compressFrameBlock(char       *output,
+                               const char *input,
+                               int         inputLength)
+{
+    BSLS_ASSERT(output);
+    BSLS_ASSERT(input);
+    BSLS_ASSERT(0 < inputLength);
+    BSLS_ASSERT(inputLength <= k_MAX_BLOCK_LENGTH);
+
+    char *data   = output + k_BLOCK_HEADER_LENGTH;
+    int   length = compressBlock(data, input, inputLength);
+
+    if (length < inputLength) {
+        writeUint32(output, length);
+    }
+    else {
+        bsl::memcpy(data, input, inputLength);
+        length = inputLength;
+        writeUint32(output, k_RAW_BLOCK_FLAG | length);
+    }
+    return k_BLOCK_HEADER_LENGTH + length;
+}
+
+unsigned int LzUtil::readChecksum(const char *checksum)
+{
+    BSLS_ASSERT(checksum);
+
+    return readUint32(checksum);
+}
+
+int LzUtil::readBlockHeader(int        *dataLength,
+                            bool       *isCompressed,
+                            const char *header)
+{
+    BSLS_ASSERT(dataLength);
+    BSLS_ASSERT(isCompressed);
+    BSLS_ASSERT(header);
+
+    const unsigned int value  = readUint32(header);
+    const unsigned int length = value & ~k_RAW_BLOCK_FLAG;
+
+    if (value & k_RAW_BLOCK_FLAG) {
+        if (0 == length || length > k_MAX_BLOCK_LENGTH) {
+            return -1;                                                // RETURN
+        }
+        *isCompressed = false;
+    }
+    else {
+        if (length >= k_MAX_BLOCK_LENGTH) {
+            return -1;                                                // RETURN
+        }
+        *isCompressed = true;
+    }
+    *dataLength = static_cast<int>(length);
+    return 0;
+}
+
+int LzUtil::readFrameHeader(const char *header)
+{
+    BSLS_ASSERT(header);
+
+    return bsl::memcmp(header, k_FRAME_HEADER, k_FRAME_HEADER_LENGTH);
+}
+
+void LzUtil::writeFrameHeader(char *output)
+{
+    BSLS_ASSERT(output);
+
+    bsl::memcpy(output, k_FRAME_HEADER, k_FRAME_HEADER_LENGTH);
+}
+
+void LzUtil::writeTrailer(char *output, unsigned int checksum)
+{
+    BSLS_ASSERT(output);
+
+    writeUint32(output, 0);
+    writeUint32(output + k_BLOCK_HEADER_LENGTH, checksum);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
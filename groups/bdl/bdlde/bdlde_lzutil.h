@@ -0,0 +1,390 @@
+// bdlde_lzutil.h                                                     -*-C++-*-
+#ifndef INCLUDED_BDLDE_LZUTIL
+#define INCLUDED_BDLDE_LZUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide fast LZ-family compression of buffers.
+//
+//@CLASSES:
+//  bdlde::LzUtil: namespace for LZ block and frame compression functions
+//
+//@SEE_ALSO: bdlde_lzencoder, bdlde_lzdecoder, bdlde_crc32c,
+//           bdlbb_bloblzutil
+//
+//@DESCRIPTION: This component provides a 'struct', 'bdlde::LzUtil', that
+// serves as a namespace for functions that compress and decompress data using
+// a byte-oriented Lempel-Ziv algorithm favoring speed over compression ratio,
+// in the same class as LZ4.  The compressor requires no memory other than a
+// 16-kilobyte hash table on the stack, and the decompressor requires none at
+// all; both have no dependencies outside of BDE.  Typical text, JSON, and
+// log data is compressed to between a quarter and a half of its size, and
+// data that cannot be compressed is stored with an overhead of 4 bytes per 64
+// kilobytes.
+//
+// Two levels of interface are provided:
+//
+//: o The *block* functions, 'compressBlock' and 'decompressBlock', convert
+//:   between a contiguous buffer and a single compressed block.  Blocks carry
+//:   no header or checksum, so the caller must record the length of the
+//:   compressed data and a bound on the length of the decompressed data.
+//:
+//: o The *frame* functions, 'compressFrame' and 'decompressFrame', convert
+//:   between a contiguous buffer and a self-describing frame (see
+//:   {Frame Format}) that splits the data into independent blocks of at most
+//:   'k_MAX_BLOCK_LENGTH' bytes, each decompressed directly into the output
+//:   buffer.
+//
+// Frames may also be produced and consumed incrementally using the streaming
+// 'bdlde::LzEncoder' and 'bdlde::LzDecoder' mechanisms, and compressed from
+// and decompressed into 'bdlbb::Blob' objects using 'bdlbb::BlobLzUtil',
+// which are built on the lower-level frame building blocks provided here.
+//
+///Block Format
+///------------
+// A compressed block is a sequence of *sequences*, each of which consists of
+// a run of literal bytes copied to the output as is, followed by a *match*
+// that copies at least 4 bytes from earlier in the output.  Each sequence
+// starts with a one-byte token whose high nibble holds the number of literal
+// bytes and whose low nibble holds the length of the match less 4; a nibble
+// value of 15 indicates that the length continues in additional bytes, each
+// of which is added to the length, the last having a value other than 255.
+// The literal bytes follow the token (and any literal length bytes), and are
+// followed by the 2-byte little-endian distance back to the start of the
+// match (between 1 and 65535, so that a match may overlap the bytes it
+// produces) and any match length bytes.  The last sequence of a block has no
+// match and is at least 5 bytes long (unless the block is shorter), and no
+// match starts within the last 12 bytes of a block.
+//
+// Note that, although the block format has the same structure as that of
+// LZ4, the frame format is specific to this component, and compatibility
+// with other implementations is neither provided nor intended.  Also note
+// that the compressed form of a given input may differ between releases and
+// between platforms, but data compressed on any platform can be decompressed
+// on any other.
+//
+///Frame Format
+///------------
+// A frame consists of a 5-byte header, the 4 magic bytes "BDLZ" followed by a
+// version byte (currently 1), a sequence of blocks, and an 8-byte trailer.
+// Each block starts with a 4-byte little-endian header holding the length of
+// the block data that follows; if the high bit of the header is set, the
+// data was not compressed (because compression would not have made it
+// smaller), and is stored as is.  Each block holds between 1 and
+// 'k_MAX_BLOCK_LENGTH' bytes of uncompressed data, and every block other
+// than the last holds exactly 'k_MAX_BLOCK_LENGTH' bytes.  The trailer
+// consists of a block header having the value 0 (the end mark), followed by
+// the 4-byte little-endian CRC32-C checksum of the uncompressed data (see
+// 'bdlde_crc32c').
+//..
+//  +--------+---+--------+--------+--------+--------+-----+---+--------+
+//  | "BDLZ" | 1 | header | data   | header | data   | ... | 0 | CRC32C |
+//  +--------+---+--------+--------+--------+--------+-----+---+--------+
+//       4     1     4     (header)    4     (header)        4     4
+//..
+// Because each block is compressed independently, a frame of 'N' bytes of
+// data can be decompressed with a fixed amount of memory regardless of 'N',
+// and a corrupt block is detected before any data following it is produced.
+//
+///Performance
+///-----------
+// The compressor finds matches of at least 4 bytes using a 4096-entry hash
+// table of the most recent positions, extending each match 8 bytes at a time,
+// and skips ahead at an increasing rate through data in which no matches are
+// found, so that incompressible data is processed several times faster than
+// compressible data.  The decompressor copies literal runs and
+// non-overlapping matches with 'memcpy'.  See the benchmark in the test
+// driver of this component (test case -1) for the compression ratio and the
+// throughput, in gigabytes per second, achieved on representative data.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Compressing a Message into a Frame
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we have a large, repetitive message (such as a BER- or
+// JSON-encoded payload) that we want to store or send in a compact form.
+//
+// First, we create the message:
+//..
+//  bsl::string message;
+//  for (int i = 0; i < 1000; ++i) {
+//      bsl::ostringstream os;
+//      os << "{\"id\":" << i << ",\"name\":\"item\",\"price\":1.25}\n";
+//      message += os.str();
+//  }
+//  const int messageLength = static_cast<int>(message.length());
+//..
+// Then, we compress the message into a frame held in a buffer large enough
+// for the frame of data of that length, and observe that the frame is much
+// smaller than the message:
+//..
+//  bsl::vector<char> frame(bdlde::LzUtil::maxFrameLength(messageLength));
+//
+//  int frameLength = bdlde::LzUtil::compressFrame(frame.data(),
+//                                                 message.data(),
+//                                                 messageLength);
+//  assert(frameLength < messageLength / 4);
+//..
+// Finally, we decompress the frame, and observe that the result is the
+// original message:
+//..
+//  bsl::vector<char> restored(messageLength);
+//
+//  int restoredLength = bdlde::LzUtil::decompressFrame(restored.data(),
+//                                                      messageLength,
+//                                                      frame.data(),
+//                                                      frameLength);
+//  assert(messageLength == restoredLength);
+//  assert(0 == bsl::memcmp(message.data(),
+//                          restored.data(),
+//                          messageLength));
+//..
+//
+///Example 2: Compressing a Buffer
+///- - - - - - - - - - - - - - - -
+// Suppose that we want to compress a small record held in a contiguous
+// buffer, and that the length of the record is known to the reader of the
+// compressed data (e.g., because it is recorded in a message header).  A
+// single block has less overhead than a frame.
+//
+// First, we compress the record into a buffer large enough to hold the
+// compressed block of data of that length:
+//..
+//  const char record[] = "name=alpha,name=beta,name=gamma,name=delta";
+//  const int  length   = sizeof record - 1;
+//
+//  char compressed[128];
+//  assert(bdlde::LzUtil::maxCompressedLength(length) <=
+//                                                    int(sizeof compressed));
+//
+//  int compressedLength = bdlde::LzUtil::compressBlock(compressed,
+//                                                      record,
+//                                                      length);
+//  assert(compressedLength < length);
+//..
+// Then, we decompress the block, supplying the capacity of the output
+// buffer, which is checked so that corrupt input cannot cause a buffer
+// overrun:
+//..
+//  char result[length];
+//  int  resultLength = bdlde::LzUtil::decompressBlock(result,
+//                                                     length,
+//                                                     compressed,
+//                                                     compressedLength);
+//  assert(length == resultLength);
+//  assert(0 == bsl::memcmp(record, result, length));
+//..
+
+#include <bdlscm_version.h>
+
+#include <bsls_assert.h>
+#include <bsls_review.h>
+
+namespace BloombergLP {
+namespace bdlde {
+
+                                // =============
+                                // struct LzUtil
+                                // =============
+
+struct LzUtil {
+    // This 'struct' provides a namespace for functions that compress and
+    // decompress blocks and frames of data.  See {Block Format} and
+    // {Frame Format}.
+
+    // PUBLIC CONSTANTS
+    enum {
+        k_MAX_BLOCK_LENGTH    = 64 * 1024,  // maximum length of the
+                                            // uncompressed data of a block of
+                                            // a frame
+
+        k_FRAME_HEADER_LENGTH = 5,          // length of a frame header
+
+        k_BLOCK_HEADER_LENGTH = 4,          // length of a block header
+
+        k_CHECKSUM_LENGTH     = 4,          // length of the checksum that
+                                            // follows the end mark
+
+        k_TRAILER_LENGTH      = 8           // length of a frame trailer (the
+                                            // end mark and the checksum)
+    };
+
+    // CLASS METHODS
+    static int compressBlock(char       *output,
+                             const char *input,
+                             int         inputLength);
+        // Compress the specified 'inputLength' bytes starting at the
+        // specified 'input' address into a single block, written to the
+        // specified 'output' buffer.  Return the length of the block.  The
+        // behavior is undefined unless '0 <= inputLength' and 'output' can
+        // hold at least 'maxCompressedLength(inputLength)' bytes.  Note that
+        // the block may be longer than 'inputLength' if the input cannot be
+        // compressed.
+
+    static int decompressBlock(char       *output,
+                               int         outputCapacity,
+                               const char *input,
+                               int         inputLength);
+        // Decompress the single block of the specified 'inputLength' bytes
+        // starting at the specified 'input' address into the specified
+        // 'output' buffer having the specified 'outputCapacity'.  Return the
+        // length of the decompressed data on success, and a negative value,
+        // with the contents of 'output' unspecified, if 'input' is not a
+        // valid block or its decompressed data would be longer than
+        // 'outputCapacity'.  No byte outside of 'input' is read, and no byte
+        // outside of 'output' is written, even if 'input' is not a valid
+        // block; however, the bytes of 'output' following the decompressed
+        // data may be modified.  The behavior is undefined unless
+        // '0 <= outputCapacity' and '0 <= inputLength'.
+
+    static int maxCompressedLength(int inputLength);
+        // Return the maximum length of the block returned by 'compressBlock'
+        // for an input of the specified 'inputLength'.  The behavior is
+        // undefined unless '0 <= inputLength <= 2000000000'.
+
+    static int compressFrame(char       *output,
+                             const char *input,
+                             int         inputLength);
+        // Compress the specified 'inputLength' bytes starting at the
+        // specified 'input' address into a frame, written to the specified
+        // 'output' buffer.  Return the length of the frame.  The behavior is
+        // undefined unless '0 <= inputLength', 'output' can hold at least
+        // 'maxFrameLength(inputLength)' bytes, and 'output' and 'input' do
+        // not overlap.
+
+    static int decompressFrame(char       *output,
+                               int         outputCapacity,
+                               const char *input,
+                               int         inputLength);
+        // Decompress the frame of the specified 'inputLength' bytes starting
+        // at the specified 'input' address into the specified 'output' buffer
+        // having the specified 'outputCapacity'.  Return the length of the
+        // decompressed data on success, and a negative value, with the
+        // contents of 'output' unspecified, if 'input' does not hold exactly
+        // one valid frame, the checksum of the data does not match that
+        // recorded in the frame, or the data would be longer than
+        // 'outputCapacity'.  No byte outside of 'input' is read, and no byte
+        // outside of 'output' is written, even if 'input' is not a valid
+        // frame.  The behavior is undefined unless '0 <= outputCapacity',
+        // '0 <= inputLength', and 'output' and 'input' do not overlap.
+
+    static int maxFrameLength(int inputLength);
+        // Return the maximum length of the frame returned by 'compressFrame'
+        // for an input of the specified 'inputLength'.  The behavior is
+        // undefined unless '0 <= inputLength <= 2000000000'.
+
+                        // Frame Building Blocks
+
+    static int compressFrameBlock(char       *output,
+                                  const char *input,
+                                  int         inputLength);
+        // Write to the specified 'output' buffer a block of a frame, holding
+        // the specified 'inputLength' bytes starting at the specified 'input'
+        // address, compressed unless compression would not make the data
+        // smaller, and preceded by its block header.  Return the number of
+        // bytes written.  The behavior is undefined unless
+        // '0 < inputLength <= k_MAX_BLOCK_LENGTH' and 'output' can hold at
+        // least 'k_BLOCK_HEADER_LENGTH + maxCompressedLength(inputLength)'
+        // bytes.
+
+    static unsigned int readChecksum(const char *checksum);
+        // Return the value of the frame checksum at the specified 'checksum'
+        // address, i.e., the address following the end mark of a frame.  The
+        // behavior is undefined unless 'checksum' refers to at least
+        // 'k_CHECKSUM_LENGTH' bytes.
+
+    static int readBlockHeader(int        *dataLength,
+                               bool       *isCompressed,
+                               const char *header);
+        // Load into the specified 'dataLength' the length of the data of the
+        // block, and into the specified 'isCompressed' flag whether that data
+        // is compressed, described by the block header at the specified
+        // 'header' address.  Return 0 on success, and a non-zero value if the
+        // block header is not valid.  Note that the data of a valid block is
+        // at most 'k_MAX_BLOCK_LENGTH' bytes long, and shorter than that if it
+        // is compressed.  Note that a 'dataLength' of 0 indicates
+        // the end mark of a frame, which is followed by the checksum.  The
+        // behavior is undefined unless 'header' refers to at least
+        // 'k_BLOCK_HEADER_LENGTH' bytes.
+
+    static int readFrameHeader(const char *header);
+        // Return 0 if the specified 'header' refers to a valid frame header,
+        // and a non-zero value otherwise.  The behavior is undefined unless
+        // 'header' refers to at least 'k_FRAME_HEADER_LENGTH' bytes.
+
+    static void writeFrameHeader(char *output);
+        // Write a frame header to the specified 'output' buffer.  The
+        // behavior is undefined unless 'output' can hold at least
+        // 'k_FRAME_HEADER_LENGTH' bytes.
+
+    static void writeTrailer(char *output, unsigned int checksum);
+        // Write to the specified 'output' buffer a frame trailer holding the
+        // specified 'checksum' of the data of the frame.  The behavior is
+        // undefined unless 'output' can hold at least 'k_TRAILER_LENGTH'
+        // bytes.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                                // -------------
+                                // struct LzUtil
+                                // -------------
+
+// CLASS METHODS
+inline
+int LzUtil::maxCompressedLength(int inputLength)
+{
+    BSLS_ASSERT(0 <= inputLength);
+    BSLS_ASSERT(inputLength <= 2000000000);
+
+    return inputLength + inputLength / 255 + 16;
+}
+
+inline
+int LzUtil::maxFrameLength(int inputLength)
+{
+    BSLS_ASSERT(0 <= inputLength);
+    BSLS_ASSERT(inputLength <= 2000000000);
+
+    // Each block is stored raw if compressing it would not make it smaller,
+    // but is compressed in place, so that the space needed to compress a
+    // full block must be available when the last block is written.
+
+    const int numBlocks  = inputLength / k_MAX_BLOCK_LENGTH
+                         + (0 != inputLength % k_MAX_BLOCK_LENGTH);
+    const int maxBlock   = inputLength < k_MAX_BLOCK_LENGTH
+                         ? inputLength
+                         : static_cast<int>(k_MAX_BLOCK_LENGTH);
+
+    return k_FRAME_HEADER_LENGTH
+         + numBlocks * k_BLOCK_HEADER_LENGTH
+         + inputLength
+         + (maxCompressedLength(maxBlock) - maxBlock)
+         + k_TRAILER_LENGTH;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
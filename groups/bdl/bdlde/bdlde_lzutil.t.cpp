@@ -0,0 +1,1437 @@
+// bdlde_lzutil.t.cpp                                                 -*-C++-*-
+#include <bdlde_lzutil.h>
+
+#include <bdlde_crc32c.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// The component under test provides a namespace for stateless functions that
+// compress and decompress blocks and frames.  The block functions are tested
+// by verifying that every input, over a range of lengths and kinds of data
+// chosen to exercise each branch of the compressor (long literal runs, long
+// and overlapping matches, incompressible data), is restored exactly, and
+// that the decompressor rejects, without reading or writing outside of its
+// buffers, malformed and randomly corrupted blocks.  The frame functions are
+// tested by verifying that the frame produced for given data consists of the
+// expected blocks, fits in the space given by 'maxFrameLength', and is
+// restored exactly, and that truncated and corrupted frames are rejected
+// without writing outside of the output buffer.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] int compressBlock(char *, const char *, int);
+// [ 2] int decompressBlock(char *, int, const char *, int);
+// [ 2] int maxCompressedLength(int);
+// [ 5] int compressFrame(char *, const char *, int);
+// [ 5] int decompressFrame(char *, int, const char *, int);
+// [ 5] int maxFrameLength(int);
+// [ 4] int compressFrameBlock(char *, const char *, int);
+// [ 4] unsigned int readChecksum(const char *);
+// [ 4] int readBlockHeader(int *, bool *, const char *);
+// [ 4] int readFrameHeader(const char *);
+// [ 4] void writeFrameHeader(char *);
+// [ 4] void writeTrailer(char *, unsigned int);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] DECOMPRESSING MALFORMED BLOCKS
+// [ 6] DECOMPRESSING MALFORMED FRAMES
+// [ 7] USAGE EXAMPLE
+// [-1] COMPRESSION RATIO AND THROUGHPUT BENCHMARK
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlde::LzUtil Obj;
+
+const int k_MAX_BLOCK = Obj::k_MAX_BLOCK_LENGTH;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+unsigned int nextRandom(unsigned int *state)
+    // Advance the specified linear congruential generator 'state', and
+    // return the next pseudo-random value in the range '[0 .. 32767]'.
+{
+    *state = *state * 1103515245U + 12345U;
+    return (*state >> 16) & 0x7fff;
+}
+
+void generateData(bsl::string *result, char kind, int length, unsigned seed)
+    // Load into the specified 'result' the specified 'length' bytes of data
+    // of the specified 'kind', generated using the specified 'seed': 'T' for
+    // log-like text, 'J' for JSON-like text, 'R' for random bytes, 'Z' for
+    // zero bytes, and 'P' for a short repeating pattern.
+{
+    unsigned int state = seed;
+
+    result->clear();
+    result->reserve(length);
+
+    static const char *const k_WORDS[] = {
+        "connection", "accepted", "from", "session", "closed", "request",
+        "timeout", "retrying", "order", "filled", "rejected", "price"
+    };
+    const int k_NUM_WORDS = sizeof k_WORDS / sizeof *k_WORDS;
+
+    char buffer[256];
+    while (static_cast<int>(result->length()) < length) {
+        int n = 0;
+        switch (kind) {
+          case 'T': {
+            n = bsl::sprintf(buffer,
+                             "2026-10-19 12:%02u:%02u.%03u INFO [%u] "
+                             "app_server.cpp:%u %s %s %s id=%u\n",
+                             nextRandom(&state) % 60,
+                             nextRandom(&state) % 60,
+                             nextRandom(&state) % 1000,
+                             nextRandom(&state) % 32,
+                             nextRandom(&state) % 2000,
+                             k_WORDS[nextRandom(&state) % k_NUM_WORDS],
+                             k_WORDS[nextRandom(&state) % k_NUM_WORDS],
+                             k_WORDS[nextRandom(&state) % k_NUM_WORDS],
+                             nextRandom(&state));
+          } break;
+          case 'J': {
+            n = bsl::sprintf(buffer,
+                             "{\"id\":%u,\"name\":\"%s-%u\",\"price\":%u.%02u,"
+                             "\"tags\":[\"%s\",\"%s\"],\"active\":%s},",
+                             nextRandom(&state),
+                             k_WORDS[nextRandom(&state) % k_NUM_WORDS],
+                             nextRandom(&state) % 100,
+                             nextRandom(&state) % 1000,
+                             nextRandom(&state) % 100,
+                             k_WORDS[nextRandom(&state) % k_NUM_WORDS],
+                             k_WORDS[nextRandom(&state) % k_NUM_WORDS],
+                             nextRandom(&state) % 2 ? "true" : "false");
+          } break;
+          case 'R': {
+            for (; n < 64; ++n) {
+                buffer[n] = static_cast<char>(nextRandom(&state) >> 3);
+            }
+          } break;
+          case 'Z': {
+            bsl::memset(buffer, 0, 64);
+            n = 64;
+          } break;
+          default: {
+            BSLS_ASSERT(kind == 'P');
+            for (; n < 63; ++n) {
+                buffer[n] = static_cast<char>('a' + n % 7);
+            }
+          } break;
+        }
+        result->append(buffer, bsl::min(n, length - int(result->length())));
+    }
+}
+
+int verifyBlockRoundTrip(int line, const char *data, int length)
+    // Verify that the specified 'length' bytes at the specified 'data'
+    // address are restored by decompressing the block to which they are
+    // compressed, and that the block cannot be decompressed into a smaller
+    // buffer, reporting failures using the specified 'line'.  Return the
+    // length of the block.
+{
+    const int MAX = Obj::maxCompressedLength(length);
+
+    bsl::vector<char> block(MAX + 1, '\x5a');
+    const int         blockLength = Obj::compressBlock(&block[0],
+                                                       data,
+                                                       length);
+
+    ASSERTV(line, length, blockLength, MAX, 0 < blockLength);
+    ASSERTV(line, length, blockLength, MAX, blockLength <= MAX);
+    ASSERTV(line, length, '\x5a' == block[MAX]);
+
+    bsl::vector<char> result(length + 1, '\x5a');
+    const int         resultLength = Obj::decompressBlock(&result[0],
+                                                          length,
+                                                          &block[0],
+                                                          blockLength);
+    ASSERTV(line, length, resultLength, length == resultLength);
+    ASSERTV(line, length, 0 == bsl::memcmp(data, &result[0], length));
+    ASSERTV(line, length, '\x5a' == result[length]);
+
+    if (0 < length) {
+        ASSERTV(line, length, 0 > Obj::decompressBlock(&result[0],
+                                                      length - 1,
+                                                      &block[0],
+                                                      blockLength));
+    }
+    return blockLength;
+}
+
+int verifyFrameRoundTrip(int line, const bsl::string& data)
+    // Verify that the specified 'data' is restored by decompressing the frame
+    // to which it is compressed, that the frame is no longer than
+    // 'maxFrameLength', and that the frame cannot be decompressed into a
+    // smaller buffer, reporting failures using the specified 'line'.  Return
+    // the length of the frame.
+{
+    const int length = static_cast<int>(data.length());
+    const int MAX    = Obj::maxFrameLength(length);
+
+    bsl::vector<char> frame(MAX + 1, '\x5a');
+    const int         frameLength = Obj::compressFrame(&frame[0],
+                                                       data.data(),
+                                                       length);
+
+    ASSERTV(line, length, frameLength, MAX, frameLength <= MAX);
+    ASSERTV(line, length, '\x5a' == frame[MAX]);
+
+    bsl::vector<char> result(length + 1, '\x5a');
+    const int         resultLength = Obj::decompressFrame(&result[0],
+                                                          length,
+                                                          &frame[0],
+                                                          frameLength);
+    ASSERTV(line, length, resultLength, length == resultLength);
+    ASSERTV(line, length, 0 == bsl::memcmp(data.data(), &result[0], length));
+    ASSERTV(line, length, '\x5a' == result[length]);
+
+    if (0 < length) {
+        ASSERTV(line, length, 0 > Obj::decompressFrame(&result[0],
+                                                      length - 1,
+                                                      &frame[0],
+                                                      frameLength));
+    }
+    return frameLength;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test                = argc > 1 ? atoi(argv[1]) : 0;
+    const bool verbose             = argc > 2;
+    const bool veryVerbose         = argc > 3;
+    const bool veryVeryVerbose     = argc > 4;
+    const bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::Default::setDefaultAllocator(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage examples provided in the component header file compile,
+        //:   link, and run as shown.
+        //
+        // Plan:
+        //: 1 Incorporate the usage examples from the header file into the test
+        //:   driver, replacing 'assert' with 'ASSERT'.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Compressing a Message into a Frame
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we have a large, repetitive message (such as a BER- or
+// JSON-encoded payload) that we want to store or send in a compact form.
+//
+// First, we create the message:
+//..
+        bsl::string message;
+        for (int i = 0; i < 1000; ++i) {
+            bsl::ostringstream os;
+            os << "{\"id\":" << i << ",\"name\":\"item\",\"price\":1.25}\n";
+            message += os.str();
+        }
+        const int messageLength = static_cast<int>(message.length());
+//..
+// Then, we compress the message into a frame held in a buffer large enough
+// for the frame of data of that length, and observe that the frame is much
+// smaller than the message:
+//..
+        bsl::vector<char> frame(bdlde::LzUtil::maxFrameLength(messageLength));
+
+        int frameLength = bdlde::LzUtil::compressFrame(frame.data(),
+                                                       message.data(),
+                                                       messageLength);
+        ASSERT(frameLength < messageLength / 4);
+//..
+// Finally, we decompress the frame, and observe that the result is the
+// original message:
+//..
+        bsl::vector<char> restored(messageLength);
+
+        int restoredLength = bdlde::LzUtil::decompressFrame(restored.data(),
+                                                            messageLength,
+                                                            frame.data(),
+                                                            frameLength);
+        ASSERT(messageLength == restoredLength);
+        ASSERT(0 == bsl::memcmp(message.data(),
+                                restored.data(),
+                                messageLength));
+//..
+//
+///Example 2: Compressing a Buffer
+///- - - - - - - - - - - - - - - -
+// Suppose that we want to compress a small record held in a contiguous
+// buffer, and that the length of the record is known to the reader of the
+// compressed data (e.g., because it is recorded in a message header).  A
+// single block has less overhead than a frame.
+//
+// First, we compress the record into a buffer large enough to hold the
+// compressed block of data of that length:
+//..
+        const char record[] = "name=alpha,name=beta,name=gamma,name=delta";
+        const int  length   = sizeof record - 1;
+
+        char compressed[128];
+        ASSERT(bdlde::LzUtil::maxCompressedLength(length) <=
+                                                      int(sizeof compressed));
+
+        int compressedLength = bdlde::LzUtil::compressBlock(compressed,
+                                                            record,
+                                                            length);
+        ASSERT(compressedLength < length);
+//..
+// Then, we decompress the block, supplying the capacity of the output
+// buffer, which is checked so that corrupt input cannot cause a buffer
+// overrun:
+//..
+        char decompressed[length];
+        int  decompressedLength = bdlde::LzUtil::decompressBlock(
+                                                             decompressed,
+                                                             length,
+                                                             compressed,
+                                                             compressedLength);
+        ASSERT(length == decompressedLength);
+        ASSERT(0 == bsl::memcmp(record, decompressed, length));
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // DECOMPRESSING MALFORMED FRAMES
+        //
+        // Concerns:
+        //: 1 A frame that is truncated at any point, or that is followed by
+        //:   additional data, is rejected.
+        //:
+        //: 2 A frame having a corrupt header, block header, block, end mark,
+        //:   or checksum is rejected.
+        //:
+        //: 3 No byte outside of the output buffer is written when a frame is
+        //:   rejected.
+        //
+        // Plan:
+        //: 1 Compress data spanning several blocks, and decompress each
+        //:   prefix of the frame, and the frame followed by a byte, into a
+        //:   buffer followed by a guard byte.  Verify that each is rejected,
+        //:   and that the guard byte is unchanged.  (C-1, 3)
+        //:
+        //: 2 Decompress copies of the frame in which one bit of each of a
+        //:   set of bytes (covering each part of the frame) is inverted, and
+        //:   verify that each is rejected without changing the guard byte.
+        //:   (C-2..3)
+        //
+        // Testing:
+        //   DECOMPRESSING MALFORMED FRAMES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "DECOMPRESSING MALFORMED FRAMES" << endl
+                          << "==============================" << endl;
+
+        bsl::string data;
+        generateData(&data, 'T', 2 * k_MAX_BLOCK + 1000, 6);
+        data.append(3000, 'x');
+        {
+            bsl::string random;
+            generateData(&random, 'R', k_MAX_BLOCK, 6);
+            data.append(random);
+        }
+        const int LENGTH = static_cast<int>(data.size());
+
+        bsl::vector<char> frameBuffer(Obj::maxFrameLength(LENGTH));
+        const int         N = Obj::compressFrame(&frameBuffer[0],
+                                                 data.data(),
+                                                 LENGTH);
+
+        const bsl::string FRAME(&frameBuffer[0], N);
+
+        if (veryVerbose) { T_ P_(LENGTH) P(N) }
+
+        bsl::vector<char> result(LENGTH + 1, '\x5a');
+
+        ASSERT(LENGTH == Obj::decompressFrame(&result[0],
+                                              LENGTH,
+                                              FRAME.data(),
+                                              N));
+        ASSERT(0 == bsl::memcmp(data.data(), &result[0], LENGTH));
+
+        if (verbose) cout << "\tTesting truncated and extended frames.\n";
+        {
+            for (int length = 0; length <= N; ++length) {
+                // Test every prefix near the ends of the frame and of the
+                // first block, and a sample of the others.
+
+                if (64 < length && length < N - 64 && 0 != length % 997
+                 && (length < 1000 || 1100 < length)) {
+                    continue;
+                }
+
+                bsl::string frame(FRAME, 0, length);
+                if (N == length) {
+                    frame.push_back('\0');
+                }
+
+                const int FRAME_LENGTH = static_cast<int>(frame.size());
+
+                ASSERTV(length, 0 > Obj::decompressFrame(&result[0],
+                                                         LENGTH,
+                                                         frame.data(),
+                                                         FRAME_LENGTH));
+                ASSERTV(length, '\x5a' == result[LENGTH]);
+            }
+        }
+
+        if (verbose) cout << "\tTesting corrupted frames.\n";
+        {
+            int  blockLength;
+            bool isCompressed;
+            ASSERT(0 == Obj::readBlockHeader(&blockLength,
+                                             &isCompressed,
+                                             FRAME.data() + 5));
+            ASSERT(isCompressed);
+
+            const int POSITIONS[] = {
+                0, 3, 4,                                  // frame header
+                5, 6, 8,                                  // block header
+                9, 10, 50, 9 + blockLength - 1,           // block data
+                N - 8, N - 7, N - 5,                      // end mark
+                N - 4, N - 1                              // checksum
+            };
+            const int NUM_POSITIONS = sizeof POSITIONS / sizeof *POSITIONS;
+
+            for (int ti = 0; ti < NUM_POSITIONS; ++ti) {
+                const int POSITION = POSITIONS[ti];
+
+                for (int bit = 0; bit < 8; ++bit) {
+                    bsl::string frame(FRAME);
+                    frame[POSITION] = static_cast<char>(
+                                                frame[POSITION] ^ (1 << bit));
+
+                    ASSERTV(POSITION, bit, 0 > Obj::decompressFrame(
+                                                                &result[0],
+                                                                LENGTH,
+                                                                frame.data(),
+                                                                N));
+                    ASSERTV(POSITION, bit, '\x5a' == result[LENGTH]);
+                }
+            }
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // COMPRESSING AND DECOMPRESSING FRAMES
+        //
+        // Concerns:
+        //: 1 'decompressFrame' restores the data compressed by
+        //:   'compressFrame', and returns its length.
+        //:
+        //: 2 'compressFrame' writes no more than 'maxFrameLength' bytes, even
+        //:   when the data of the last block cannot be compressed.
+        //:
+        //: 3 The frame consists of blocks holding 'k_MAX_BLOCK_LENGTH' bytes,
+        //:   other than the last, and has a valid trailer.
+        //:
+        //: 4 'decompressFrame' rejects a frame whose data is longer than the
+        //:   capacity of the output buffer, without writing outside of it.
+        //
+        // Plan:
+        //: 1 For data of each of a set of lengths at and around multiples of
+        //:   the block length, and of several kinds, compress the data into a
+        //:   buffer of 'maxFrameLength' bytes followed by a guard byte, and
+        //:   decompress the frame into buffers of the length of the data and
+        //:   of one byte less, using the helper 'verifyFrameRoundTrip'.
+        //:   (C-1..2, 4)
+        //:
+        //: 2 Walk the block headers of the frame, verifying the length of
+        //:   each block and the checksum in the trailer.  (C-3)
+        //
+        // Testing:
+        //   int compressFrame(char *, const char *, int);
+        //   int decompressFrame(char *, int, const char *, int);
+        //   int maxFrameLength(int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COMPRESSING AND DECOMPRESSING FRAMES" << endl
+                          << "====================================" << endl;
+
+        const int LENGTHS[] = {
+            0, 1, 13, 1000, k_MAX_BLOCK - 1, k_MAX_BLOCK, k_MAX_BLOCK + 1,
+            3 * k_MAX_BLOCK + 17
+        };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        const char KINDS[]   = { 'T', 'R', 'Z' };
+        const int  NUM_KINDS = sizeof KINDS;
+
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const int LENGTH = LENGTHS[ti];
+
+            for (int tj = 0; tj < NUM_KINDS; ++tj) {
+                const char KIND = KINDS[tj];
+
+                if (veryVerbose) { T_ P_(LENGTH) P(KIND) }
+
+                bsl::string data;
+                generateData(&data, KIND, LENGTH, ti);
+
+                verifyFrameRoundTrip(L_, data);
+
+                bsl::vector<char> buffer(Obj::maxFrameLength(LENGTH));
+                const int         frameLength = Obj::compressFrame(
+                                                                   &buffer[0],
+                                                                   data.data(),
+                                                                   LENGTH);
+                const bsl::string frame(&buffer[0], frameLength);
+
+                // Walk the blocks of the frame.
+
+                ASSERTV(LENGTH, KIND, 0 == Obj::readFrameHeader(frame.data()));
+
+                int offset    = Obj::k_FRAME_HEADER_LENGTH;
+                int remaining = LENGTH;
+                while (true) {
+                    int  blockLength;
+                    bool isCompressed;
+                    ASSERTV(LENGTH, KIND, offset,
+                            0 == Obj::readBlockHeader(&blockLength,
+                                                      &isCompressed,
+                                                      frame.data() + offset));
+                    if (0 == blockLength) {
+                        break;
+                    }
+
+                    const int EXPECTED = bsl::min(remaining, k_MAX_BLOCK);
+
+                    bsl::vector<char> block(k_MAX_BLOCK);
+                    const int         n = isCompressed
+                                        ? Obj::decompressBlock(
+                                            &block[0],
+                                            k_MAX_BLOCK,
+                                            frame.data() + offset + 4,
+                                            blockLength)
+                                        : blockLength;
+                    ASSERTV(LENGTH, KIND, offset, n, EXPECTED == n);
+                    ASSERTV(LENGTH, KIND, offset,
+                            isCompressed || 'R' == KIND || EXPECTED < 19);
+
+                    remaining -= EXPECTED;
+                    offset    += 4 + blockLength;
+                }
+                ASSERTV(LENGTH, KIND, 0 == remaining);
+                ASSERTV(LENGTH, KIND, offset + 8 == int(frame.size()));
+                ASSERTV(LENGTH, KIND,
+                        bdlde::Crc32c::calculate(data.data(), data.size()) ==
+                                Obj::readChecksum(frame.data() + offset + 4));
+            }
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // FRAME BUILDING BLOCKS
+        //
+        // Concerns:
+        //: 1 'writeFrameHeader' writes the magic bytes and version, which
+        //:   'readFrameHeader' accepts, and 'readFrameHeader' rejects any
+        //:   other header.
+        //:
+        //: 2 'compressFrameBlock' writes a block header followed by the
+        //:   compressed data if it is smaller than the input, and by the
+        //:   input otherwise.
+        //:
+        //: 3 'readBlockHeader' accepts the headers written by
+        //:   'compressFrameBlock', and the end mark, and rejects headers
+        //:   describing blocks that are too long or empty.
+        //:
+        //: 4 'readChecksum' returns the checksum written by 'writeTrailer',
+        //:   and the trailer starts with the end mark.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Write and read back a frame header, and verify that corrupting
+        //:   any byte of it causes it to be rejected.  (C-1)
+        //:
+        //: 2 Compress compressible and incompressible data of several lengths
+        //:   with 'compressFrameBlock', and verify the headers and the data.
+        //:   (C-2..3)
+        //:
+        //: 3 Using the table-driven technique, verify the result of
+        //:   'readBlockHeader' for a set of header values.  (C-3)
+        //:
+        //: 4 Write and read back trailers holding several checksums.  (C-4)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   int compressFrameBlock(char *, const char *, int);
+        //   unsigned int readChecksum(const char *);
+        //   int readBlockHeader(int *, bool *, const char *);
+        //   int readFrameHeader(const char *);
+        //   void writeFrameHeader(char *);
+        //   void writeTrailer(char *, unsigned int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "FRAME BUILDING BLOCKS" << endl
+                          << "=====================" << endl;
+
+        if (verbose) cout << "\tTesting frame headers.\n";
+        {
+            char header[Obj::k_FRAME_HEADER_LENGTH];
+            Obj::writeFrameHeader(header);
+            ASSERT(0 == bsl::memcmp(header, "BDLZ\x01", 5));
+            ASSERT(0 == Obj::readFrameHeader(header));
+
+            for (int i = 0; i < Obj::k_FRAME_HEADER_LENGTH; ++i) {
+                char corrupt[Obj::k_FRAME_HEADER_LENGTH];
+                bsl::memcpy(corrupt, header, sizeof header);
+                corrupt[i] = static_cast<char>(corrupt[i] + 1);
+                ASSERTV(i, 0 != Obj::readFrameHeader(corrupt));
+            }
+        }
+
+        if (verbose) cout << "\tTesting 'compressFrameBlock'.\n";
+        {
+            const int LENGTHS[]   = { 1, 18, 19, 100, 4096, k_MAX_BLOCK };
+            const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+            for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+                const int LENGTH = LENGTHS[ti];
+
+                for (int tj = 0; tj < 2; ++tj) {
+                    bsl::string data;
+                    generateData(&data, tj ? 'R' : 'P', LENGTH, ti);
+
+                    bsl::vector<char> output(
+                              4 + Obj::maxCompressedLength(LENGTH) + 1, '\0');
+                    const int         n = Obj::compressFrameBlock(&output[0],
+                                                                  data.data(),
+                                                                  LENGTH);
+
+                    int  blockLength;
+                    bool isCompressed;
+                    ASSERTV(LENGTH, tj, 0 == Obj::readBlockHeader(
+                                                             &blockLength,
+                                                             &isCompressed,
+                                                             &output[0]));
+                    ASSERTV(LENGTH, tj, n, blockLength, n == 4 + blockLength);
+
+                    // The pattern has a period of 7, and no match starts in
+                    // the last 12 bytes, so at least 19 bytes are needed.
+
+                    const bool EXPECTED = 0 == tj && 19 <= LENGTH;
+                    ASSERTV(LENGTH, tj, EXPECTED == isCompressed);
+
+                    if (isCompressed) {
+                        ASSERTV(LENGTH, blockLength < LENGTH);
+
+                        bsl::vector<char> result(LENGTH);
+                        ASSERTV(LENGTH, LENGTH == Obj::decompressBlock(
+                                                             &result[0],
+                                                             LENGTH,
+                                                             &output[4],
+                                                             blockLength));
+                        ASSERTV(LENGTH, 0 == bsl::memcmp(&result[0],
+                                                         data.data(),
+                                                         LENGTH));
+                    }
+                    else {
+                        ASSERTV(LENGTH, LENGTH == blockLength);
+                        ASSERTV(LENGTH, 0 == bsl::memcmp(&output[4],
+                                                         data.data(),
+                                                         LENGTH));
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\tTesting 'readBlockHeader'.\n";
+        {
+            static const struct {
+                int          d_line;
+                unsigned int d_value;         // header value
+                int          d_rc;            // 0 if valid, 1 otherwise
+                int          d_length;        // expected data length
+                bool         d_isCompressed;  // expected flag
+            } DATA[] = {
+                //LN  VALUE                     RC  LENGTH         COMP
+                //--  ------------------------  --  -------------  -----
+                { L_, 0,                         0, 0,             true  },
+                { L_, 1,                         0, 1,             true  },
+                { L_, k_MAX_BLOCK - 1,           0, k_MAX_BLOCK-1, true  },
+                { L_, k_MAX_BLOCK,               1, 0,             false },
+                { L_, 0x7fffffff,                1, 0,             false },
+                { L_, 0x80000000,                1, 0,             false },
+                { L_, 0x80000001,                0, 1,             false },
+                { L_, 0x80000000 | k_MAX_BLOCK,  0, k_MAX_BLOCK,   false },
+                { L_, 0x80000001 + k_MAX_BLOCK,  1, 0,             false },
+                { L_, 0xffffffff,                1, 0,             false },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int          LINE  = DATA[ti].d_line;
+                const unsigned int VALUE = DATA[ti].d_value;
+
+                const char header[] = {
+                    static_cast<char>(VALUE),
+                    static_cast<char>(VALUE >> 8),
+                    static_cast<char>(VALUE >> 16),
+                    static_cast<char>(VALUE >> 24)
+                };
+
+                int  length       = -1;
+                bool isCompressed = false;
+                const int rc = Obj::readBlockHeader(&length,
+                                                    &isCompressed,
+                                                    header);
+                ASSERTV(LINE, rc, DATA[ti].d_rc == (0 != rc));
+                if (0 == rc) {
+                    ASSERTV(LINE, length, DATA[ti].d_length == length);
+                    ASSERTV(LINE, DATA[ti].d_isCompressed == isCompressed);
+                }
+            }
+        }
+
+        if (verbose) cout << "\tTesting trailers.\n";
+        {
+            const unsigned int CHECKSUMS[] = { 0, 1, 0x12345678, 0xffffffff };
+            const int          NUM_CHECKSUMS = sizeof CHECKSUMS
+                                             / sizeof *CHECKSUMS;
+
+            for (int ti = 0; ti < NUM_CHECKSUMS; ++ti) {
+                char trailer[Obj::k_TRAILER_LENGTH];
+                Obj::writeTrailer(trailer, CHECKSUMS[ti]);
+
+                int  length       = -1;
+                bool isCompressed = false;
+                ASSERTV(ti, 0 == Obj::readBlockHeader(&length,
+                                                      &isCompressed,
+                                                      trailer));
+                ASSERTV(ti, 0 == length);
+                ASSERTV(ti, CHECKSUMS[ti] == Obj::readChecksum(trailer + 4));
+            }
+
+            char trailer[Obj::k_TRAILER_LENGTH];
+            Obj::writeTrailer(trailer, 0x12345678);
+            ASSERT(0 == bsl::memcmp(trailer, "\0\0\0\0\x78\x56\x34\x12", 8));
+        }
+
+        if (verbose) cout << "\tNegative Testing.\n";
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            char output[4 + 16 + k_MAX_BLOCK + k_MAX_BLOCK / 255 + 1];
+            char input[k_MAX_BLOCK + 1] = { 0 };
+
+            ASSERT_PASS(Obj::compressFrameBlock(output, input, 1));
+            ASSERT_PASS(Obj::compressFrameBlock(output, input, k_MAX_BLOCK));
+            ASSERT_FAIL(Obj::compressFrameBlock(output, input, 0));
+            ASSERT_FAIL(Obj::compressFrameBlock(output,
+                                                input,
+                                                k_MAX_BLOCK + 1));
+            ASSERT_FAIL(Obj::compressFrameBlock(0, input, 1));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // DECOMPRESSING MALFORMED BLOCKS
+        //
+        // Concerns:
+        //: 1 'decompressBlock' rejects blocks that are empty, have a literal
+        //:   run or length extending past the end of the block, have an
+        //:   incomplete offset, have an offset of 0 or extending before the
+        //:   start of the output, or end with a match.
+        //:
+        //: 2 'decompressBlock' rejects blocks whose data would not fit in the
+        //:   output buffer.
+        //:
+        //: 3 'decompressBlock' never reads or writes outside of its buffers,
+        //:   whatever the input.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, decompress a set of handcrafted
+        //:   blocks, and verify the result.  (C-1..2)
+        //:
+        //: 2 Decompress prefixes of valid blocks, and valid blocks having
+        //:   random bytes replaced by random values, into a buffer that is
+        //:   surrounded by guard bytes and exactly as large as the data of
+        //:   the original block, and verify that the result is either
+        //:   negative or at most the capacity, and that the guard bytes are
+        //:   unchanged.  The input is copied to a buffer of exactly its
+        //:   length, so that reads past its end are detectable by memory
+        //:   checking tools.  (C-3)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   DECOMPRESSING MALFORMED BLOCKS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "DECOMPRESSING MALFORMED BLOCKS" << endl
+                          << "==============================" << endl;
+
+        if (verbose) cout << "\tTesting handcrafted blocks.\n";
+        {
+            static const struct {
+                int         d_line;
+                const char *d_block;     // block, in escaped form
+                int         d_length;    // length of 'd_block'
+                int         d_capacity;  // capacity of output
+                const char *d_result;    // expected output, or 0 if invalid
+            } DATA[] = {
+                //LN  BLOCK                         LEN  CAP  RESULT
+                //--  ----------------------------  ---  ---  ---------------
+                { L_, "",                             0,  10, 0              },
+                { L_, "\x00",                         1,  10, ""             },
+                { L_, "\x10" "a",                     2,  10, "a"            },
+                { L_, "\x10" "a",                     2,   0, 0              },
+                { L_, "\x20" "a",                     2,  10, 0              },
+                { L_, "\xf0",                         1,  10, 0              },
+                { L_, "\xf0\xff",                     2,  10, 0              },
+                { L_, "\xf0\x01" "abcdefghijklmnop", 18,  20,
+                                                      "abcdefghijklmnop"     },
+                { L_, "\xf0\x01" "abcdefghijklmnop", 18,  15, 0              },
+
+                // "ab", then 6 bytes from offset 2, then "c"
+
+                { L_, "\x22" "ab\x02\x00\x10" "c",    7,  10, "ababababc"    },
+                { L_, "\x22" "ab\x02\x00\x10" "c",    7,   9, "ababababc"    },
+                { L_, "\x22" "ab\x02\x00\x10" "c",    7,   8, "ababababc"    },
+                { L_, "\x22" "ab\x02",                4,  20, 0              },
+                { L_, "\x22" "ab\x02\x00",            5,  20, 0              },
+                { L_, "\x22" "ab\x00\x00\x10" "c",    7,  20, 0              },
+                { L_, "\x22" "ab\x03\x00\x10" "c",    7,  20, 0              },
+                { L_, "\x2f" "ab\x01\x00",            5,  20, 0              },
+                { L_, "\x2f" "ab\x01\x00\x01\x10" "c",
+                                                      8,  40,
+                                          "a" "bbbbbbbbbbbbbbbbbbbbb" "c"  },
+                { L_, "\x2f" "ab\x01\x00\xff",        6, 300, 0              },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE     = DATA[ti].d_line;
+                const bsl::string BLOCK(DATA[ti].d_block, DATA[ti].d_length);
+                const int         CAPACITY = DATA[ti].d_capacity;
+                const char *const RESULT   = DATA[ti].d_result;
+
+                const bool TOO_SMALL = 0 == RESULT
+                                    || int(bsl::strlen(RESULT)) > CAPACITY;
+
+                bsl::vector<char> output(CAPACITY + 1, '#');
+                const int         rc = Obj::decompressBlock(
+                                                        &output[0],
+                                                        CAPACITY,
+                                                        BLOCK.data(),
+                                                        int(BLOCK.size()));
+                if (veryVerbose) { T_ P_(LINE) P(rc) }
+
+                ASSERTV(LINE, '#' == output[CAPACITY]);
+                if (TOO_SMALL) {
+                    ASSERTV(LINE, rc, 0 > rc);
+                }
+                else {
+                    ASSERTV(LINE, rc, int(bsl::strlen(RESULT)) == rc);
+                    ASSERTV(LINE, 0 == bsl::memcmp(&output[0], RESULT, rc));
+                }
+            }
+        }
+
+        if (verbose) cout << "\tTesting truncated and corrupted blocks.\n";
+        {
+            const char KINDS[]   = { 'T', 'J', 'P', 'Z' };
+            const int  NUM_KINDS = sizeof KINDS;
+            const int  GUARD     = 16;
+
+            unsigned int state = 3;
+
+            for (int ti = 0; ti < NUM_KINDS; ++ti) {
+                const char KIND   = KINDS[ti];
+                const int  LENGTH = 5000;
+
+                bsl::string data;
+                generateData(&data, KIND, LENGTH, ti);
+
+                bsl::vector<char> block(Obj::maxCompressedLength(LENGTH));
+                const int         blockLength = Obj::compressBlock(&block[0],
+                                                                 data.data(),
+                                                                 LENGTH);
+
+                bsl::vector<char> output(LENGTH + 2 * GUARD);
+
+                for (int trial = 0; trial < blockLength + 2000; ++trial) {
+                    bsl::vector<char> corrupt(block.begin(),
+                                              block.begin() + blockLength);
+                    if (trial < blockLength) {
+                        corrupt.resize(trial);
+                    }
+                    else {
+                        const int numChanges = 1 + nextRandom(&state) % 3;
+                        for (int i = 0; i < numChanges; ++i) {
+                            const int  index = nextRandom(&state)
+                                                             % blockLength;
+                            const char value = static_cast<char>(
+                                                          nextRandom(&state));
+                            corrupt[index] = value;
+                        }
+                    }
+                    bsl::fill(output.begin(), output.end(), '#');
+
+                    // Copy the input to a buffer of exactly its length.
+
+                    char *input = static_cast<char *>(
+                                  bsl::malloc(bsl::max<size_t>(corrupt.size(),
+                                                               1)));
+                    if (!corrupt.empty()) {
+                        bsl::memcpy(input, &corrupt[0], corrupt.size());
+                    }
+
+                    const int rc = Obj::decompressBlock(&output[GUARD],
+                                                        LENGTH,
+                                                        input,
+                                                        int(corrupt.size()));
+                    bsl::free(input);
+
+                    ASSERTV(KIND, trial, rc, rc <= LENGTH);
+                    for (int i = 0; i < GUARD; ++i) {
+                        ASSERTV(KIND, trial, i, '#' == output[i]);
+                        ASSERTV(KIND, trial, i,
+                                '#' == output[GUARD + LENGTH + i]);
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\tNegative Testing.\n";
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            char output[32];
+            char input[] = "\x10" "a";
+
+            ASSERT_PASS(Obj::decompressBlock(output, 32, input, 2));
+            ASSERT_PASS(Obj::decompressBlock(0,      0,  input, 2));
+            ASSERT_FAIL(Obj::decompressBlock(0,      1,  input, 2));
+            ASSERT_FAIL(Obj::decompressBlock(output, -1, input, 2));
+            ASSERT_PASS(Obj::decompressBlock(output, 32, 0,     0));
+            ASSERT_FAIL(Obj::decompressBlock(output, 32, 0,     1));
+            ASSERT_FAIL(Obj::decompressBlock(output, 32, input, -1));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // COMPRESSING AND DECOMPRESSING BLOCKS
+        //
+        // Concerns:
+        //: 1 'decompressBlock' restores the data compressed by
+        //:   'compressBlock', for any length, including lengths at which the
+        //:   final literal run and the matching limit apply.
+        //:
+        //: 2 Literal runs and matches whose lengths require 0, 1, and several
+        //:   additional length bytes, and matches that overlap the data they
+        //:   produce, are restored.
+        //:
+        //: 3 Matches at the maximum offset are found and restored, and
+        //:   matches beyond it are not used.
+        //:
+        //: 4 The length of the block never exceeds 'maxCompressedLength',
+        //:   and compressible data is compressed.
+        //:
+        //: 5 Data cannot be decompressed into a buffer that is too small.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each length from 0 to 300, and a set of longer lengths, and
+        //:   for each kind of data, verify the round trip of the data and
+        //:   that decompressing into a buffer one byte too small fails.
+        //:   (C-1, 4..5)
+        //:
+        //: 2 Verify the round trip of data consisting of runs of random bytes
+        //:   and of a single repeated byte, having lengths around 15 and
+        //:   270, and 100000.  (C-2)
+        //:
+        //: 3 Verify the round trip of a random sequence that is repeated at
+        //:   distances around 65535, and verify that the repetition is used
+        //:   only within that distance.  (C-3)
+        //:
+        //: 4 Verify that at least 4096 bytes of compressible data of each
+        //:   kind are compressed to less than half of their length.  (C-4)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-6)
+        //
+        // Testing:
+        //   int compressBlock(char *, const char *, int);
+        //   int decompressBlock(char *, int, const char *, int);
+        //   int maxCompressedLength(int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COMPRESSING AND DECOMPRESSING BLOCKS" << endl
+                          << "====================================" << endl;
+
+        const char KINDS[]   = { 'T', 'J', 'R', 'Z', 'P' };
+        const int  NUM_KINDS = sizeof KINDS;
+
+        if (verbose) cout << "\tTesting lengths and kinds of data.\n";
+        {
+            for (int tk = 0; tk < NUM_KINDS; ++tk) {
+                const char KIND = KINDS[tk];
+
+                for (int length = 0; length <= 300; ++length) {
+                    bsl::string data;
+                    generateData(&data, KIND, length, length);
+
+                    verifyBlockRoundTrip(L_, data.data(), length);
+                }
+
+                const int LENGTHS[]   = { 1000, 4096, 65535, 65536, 200000 };
+                const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+                for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+                    const int LENGTH = LENGTHS[ti];
+
+                    bsl::string data;
+                    generateData(&data, KIND, LENGTH, ti);
+
+                    const int n = verifyBlockRoundTrip(L_,
+                                                       data.data(),
+                                                       LENGTH);
+                    if (veryVerbose) { T_ P_(KIND) P_(LENGTH) P(n) }
+
+                    if ('R' != KIND && 4096 <= LENGTH) {
+                        ASSERTV(KIND, LENGTH, n, n < LENGTH / 2);
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\tTesting long literal runs and matches.\n";
+        {
+            const int RUNS[] = {
+                1, 4, 5, 14, 15, 16, 18, 19, 20, 268, 269, 270, 271, 523,
+                524, 525, 100000
+            };
+            const int NUM_RUNS = sizeof RUNS / sizeof *RUNS;
+
+            unsigned int state = 7;
+
+            for (int ti = 0; ti < NUM_RUNS; ++ti) {
+                for (int tj = 0; tj < NUM_RUNS; ++tj) {
+                    const int LITERALS = RUNS[ti];
+                    const int REPEATS  = RUNS[tj];
+
+                    if (100000 == LITERALS && 100000 == REPEATS) {
+                        continue;
+                    }
+
+                    bsl::string data;
+                    for (int i = 0; i < LITERALS; ++i) {
+                        data.push_back(static_cast<char>(
+                                                         nextRandom(&state)));
+                    }
+                    data.append(REPEATS, data[data.size() - 1]);
+                    for (int i = 0; i < 3; ++i) {
+                        data.push_back(static_cast<char>(
+                                                         nextRandom(&state)));
+                    }
+                    data.append(data.substr(0, LITERALS));
+
+                    verifyBlockRoundTrip(L_,
+                                         data.data(),
+                                         static_cast<int>(data.size()));
+                }
+            }
+        }
+
+        if (verbose) cout << "\tTesting the maximum offset.\n";
+        {
+            unsigned int state = 11;
+
+            bsl::string sequence;
+            for (int i = 0; i < 1000; ++i) {
+                sequence.push_back(static_cast<char>(nextRandom(&state)));
+            }
+
+            const int DISTANCES[] = { 65534, 65535, 65536, 70000 };
+            const int NUM_DISTANCES = sizeof DISTANCES / sizeof *DISTANCES;
+
+            for (int ti = 0; ti < NUM_DISTANCES; ++ti) {
+                const int DISTANCE = DISTANCES[ti];
+
+                bsl::string data(sequence);
+                while (static_cast<int>(data.size()) < DISTANCE) {
+                    data.push_back(static_cast<char>(nextRandom(&state)));
+                }
+                data.append(sequence);
+
+                const int n = verifyBlockRoundTrip(L_,
+                                                   data.data(),
+                                                   int(data.size()));
+                if (veryVerbose) { T_ P_(DISTANCE) P(n) }
+
+                // The repeated sequence saves most of its length if, and only
+                // if, it can be referenced (the other bytes being stored as
+                // literals, at a cost of about 1 byte in 255).
+
+                ASSERTV(DISTANCE, n, (DISTANCE <= 65535) ==
+                                          (n < int(data.size()) - 500));
+            }
+        }
+
+        if (verbose) cout << "\tNegative Testing.\n";
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            char output[32];
+            char input[8] = { 0 };
+
+            ASSERT_PASS(Obj::compressBlock(output, input, 8));
+            ASSERT_PASS(Obj::compressBlock(output, 0,     0));
+            ASSERT_FAIL(Obj::compressBlock(0,      input, 8));
+            ASSERT_FAIL(Obj::compressBlock(output, 0,     8));
+            ASSERT_FAIL(Obj::compressBlock(output, input, -1));
+
+            ASSERT_PASS(Obj::maxCompressedLength(0));
+            ASSERT_PASS(Obj::maxCompressedLength(2000000000));
+            ASSERT_FAIL(Obj::maxCompressedLength(-1));
+            ASSERT_FAIL(Obj::maxCompressedLength(2000000001));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Compress and decompress a short string as a block and as a
+        //:   frame.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const char DATA[] = "hello, hello, hello, hello, hello, world";
+        const int  LENGTH = sizeof DATA - 1;
+
+        char block[128];
+        const int blockLength = Obj::compressBlock(block, DATA, LENGTH);
+        if (veryVerbose) { T_ P_(LENGTH) P(blockLength) }
+        ASSERT(blockLength < LENGTH);
+
+        char result[LENGTH];
+        ASSERT(LENGTH == Obj::decompressBlock(result,
+                                              LENGTH,
+                                              block,
+                                              blockLength));
+        ASSERT(0 == bsl::memcmp(DATA, result, LENGTH));
+
+        char frame[128];
+        ASSERT(Obj::maxFrameLength(LENGTH) <= int(sizeof frame));
+
+        const int frameLength = Obj::compressFrame(frame, DATA, LENGTH);
+        if (veryVerbose) { T_ P(frameLength) }
+
+        ASSERT(LENGTH == Obj::decompressFrame(result,
+                                              LENGTH,
+                                              frame,
+                                              frameLength));
+        ASSERT(0 == bsl::memcmp(DATA, result, LENGTH));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // COMPRESSION RATIO AND THROUGHPUT BENCHMARK
+        //
+        // Concerns:
+        //: 1 The compression ratio, and the throughput of compression and
+        //:   decompression, are acceptable for typical data.
+        //
+        // Plan:
+        //: 1 For each kind of data (log-like text, JSON-like text, and random
+        //:   bytes), compress and decompress the data (by default 64
+        //:   megabytes, or the number of megabytes given as the second
+        //:   argument) repeatedly, both as a sequence of blocks and as a
+        //:   frame.  Report the compression ratio and the throughput, in
+        //:   gigabytes of uncompressed data per second.
+        //
+        // Testing:
+        //   COMPRESSION RATIO AND THROUGHPUT BENCHMARK
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COMPRESSION RATIO AND THROUGHPUT BENCHMARK"
+                          << endl
+                          << "=========================================="
+                          << endl;
+
+        const int MEGABYTES = argc > 2 ? atoi(argv[2]) : 64;
+        const int LENGTH    = (MEGABYTES > 0 ? MEGABYTES : 64) << 20;
+
+        static const struct {
+            char        d_kind;
+            const char *d_name;
+        } KINDS[] = {
+            { 'T', "log text" },
+            { 'J', "JSON"     },
+            { 'R', "random"   }
+        };
+        const int NUM_KINDS = sizeof KINDS / sizeof *KINDS;
+
+        printf("%-10s %-6s %8s %12s %12s\n",
+               "data", "level", "ratio", "comp GB/s", "decomp GB/s");
+
+        for (int ti = 0; ti < NUM_KINDS; ++ti) {
+            bsl::string data;
+            generateData(&data, KINDS[ti].d_kind, LENGTH, ti);
+
+            // Blocks
+
+            {
+                bsl::vector<char> blocks(LENGTH / k_MAX_BLOCK
+                                         * Obj::maxCompressedLength(
+                                                                 k_MAX_BLOCK));
+                bsl::vector<int>  lengths(LENGTH / k_MAX_BLOCK);
+                bsl::vector<char> output(LENGTH);
+
+                const int      ITERATIONS = 3;
+                bsls::Stopwatch compressTimer;
+                bsls::Stopwatch decompressTimer;
+                bsls::Types::Int64 compressedLength = 0;
+
+                for (int iteration = 0; iteration < ITERATIONS; ++iteration) {
+                    compressedLength = 0;
+
+                    compressTimer.start();
+                    char *out = &blocks[0];
+                    for (int i = 0; i < LENGTH / k_MAX_BLOCK; ++i) {
+                        lengths[i] = Obj::compressBlock(
+                                               out,
+                                               data.data() + i * k_MAX_BLOCK,
+                                               k_MAX_BLOCK);
+                        out              += lengths[i];
+                        compressedLength += lengths[i];
+                    }
+                    compressTimer.stop();
+
+                    decompressTimer.start();
+                    const char *in = &blocks[0];
+                    for (int i = 0; i < LENGTH / k_MAX_BLOCK; ++i) {
+                        int rc = Obj::decompressBlock(
+                                                   &output[i * k_MAX_BLOCK],
+                                                   k_MAX_BLOCK,
+                                                   in,
+                                                   lengths[i]);
+                        ASSERTV(i, k_MAX_BLOCK == rc);
+                        in += lengths[i];
+                    }
+                    decompressTimer.stop();
+                }
+                ASSERT(0 == bsl::memcmp(data.data(), &output[0], LENGTH));
+
+                const double GB = double(LENGTH) * ITERATIONS / 1e9;
+                printf("%-10s %-6s %8.3f %12.3f %12.3f\n",
+                       KINDS[ti].d_name,
+                       "block",
+                       double(LENGTH) / double(compressedLength),
+                       GB / compressTimer.accumulatedWallTime(),
+                       GB / decompressTimer.accumulatedWallTime());
+            }
+
+            // Frames
+
+            {
+                bsl::vector<char> frame(Obj::maxFrameLength(LENGTH));
+                bsl::vector<char> output(LENGTH);
+
+                const int       ITERATIONS = 3;
+                bsls::Stopwatch compressTimer;
+                bsls::Stopwatch decompressTimer;
+                int             frameLength = 0;
+
+                for (int iteration = 0; iteration < ITERATIONS; ++iteration) {
+                    compressTimer.start();
+                    frameLength = Obj::compressFrame(&frame[0],
+                                                     data.data(),
+                                                     LENGTH);
+                    compressTimer.stop();
+
+                    decompressTimer.start();
+                    int rc = Obj::decompressFrame(&output[0],
+                                                  LENGTH,
+                                                  &frame[0],
+                                                  frameLength);
+                    decompressTimer.stop();
+
+                    ASSERT(LENGTH == rc);
+                }
+                ASSERT(0 == bsl::memcmp(data.data(), &output[0], LENGTH));
+
+                const double GB = double(LENGTH) * ITERATIONS / 1e9;
+                printf("%-10s %-6s %8.3f %12.3f %12.3f\n",
+                       KINDS[ti].d_name,
+                       "frame",
+                       double(LENGTH) / double(frameLength),
+                       GB / compressTimer.accumulatedWallTime(),
+                       GB / decompressTimer.accumulatedWallTime());
+            }
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -1,10 +1,26 @@
 // bdlde_sha2.cpp                                                     -*-C++-*-
 #include <bdlde_sha2.h>
 
+#include <bslmt_once.h>
+
+#include <bsls_platform.h>
+
 #include <bsl_algorithm.h>
 #include <bsl_climits.h>
 #include <bsl_ostream.h>
 
+// Compiler-specific and platform-specific
+#if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+#define LIKE_X86_GCC
+#endif
+#endif
+
+#if defined(LIKE_X86_GCC)
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
 namespace BloombergLP {
 namespace bdlde {
 namespace {
@@ -247,6 +263,589 @@ void transform(INTEGER             *state,
     }
 }
 
+void sha256Portable(bsl::uint32_t       *state,
+                    const unsigned char *message,
+                    bsl::uint64_t        numBlocks)
+    // Update the specified 'state' with the specified 'numBlocks' 64-byte
+    // blocks of the specified 'message' using the portable implementation.
+{
+    transform(state, message, numBlocks, 64, sha256Constants);
+}
+
+#if defined(LIKE_X86_GCC)
+
+__attribute__((target("sha,sse4.1")))
+void sha256ShaNi(bsl::uint32_t       *state,
+                 const unsigned char *message,
+                 bsl::uint64_t        numBlocks)
+    // Update the specified 'state' with the specified 'numBlocks' 64-byte
+    // blocks of the specified 'message' using the SHA extensions.  The
+    // behavior is undefined unless the processor supports the SHA extensions
+    // and SSE4.1.
+{
+    const __m128i byteSwap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL,
+                                            0x0405060700010203ULL);
+
+    // The round instructions operate on the state split into the words
+    // 'ABEF' and 'CDGH'.
+
+    __m128i tmp    = _mm_loadu_si128(reinterpret_cast<const __m128i *>(
+                                                                   state));
+    __m128i state1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(
+                                                               state + 4));
+
+    tmp            = _mm_shuffle_epi32(tmp, 0xb1);            // CDAB
+    state1         = _mm_shuffle_epi32(state1, 0x1b);         // EFGH
+    __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);         // ABEF
+    state1         = _mm_blend_epi16(state1, tmp, 0xf0);      // CDGH
+
+    for (; numBlocks; --numBlocks, message += 64) {
+        const __m128i abefSave = state0;
+        const __m128i cdghSave = state1;
+
+        __m128i w[4];
+        for (int i = 0; i < 4; ++i) {
+            w[i] = _mm_shuffle_epi8(
+                      _mm_loadu_si128(reinterpret_cast<const __m128i *>(
+                                                           message + 16 * i)),
+                      byteSwap);
+        }
+
+        for (int i = 0; i < 16; ++i) {
+            if (4 <= i) {
+                // Compute 'W[4i .. 4i + 3]' from 'w[i & 3]' (holding
+                // 'W[4i - 16 .. 4i - 13]') and the three following groups.
+
+                __m128i next = _mm_sha256msg1_epu32(w[i & 3],
+                                                    w[(i + 1) & 3]);
+                next = _mm_add_epi32(next,
+                                     _mm_alignr_epi8(w[(i + 3) & 3],
+                                                     w[(i + 2) & 3],
+                                                     4));
+                w[i & 3] = _mm_sha256msg2_epu32(next, w[(i + 3) & 3]);
+            }
+
+            __m128i words = _mm_add_epi32(
+                         w[i & 3],
+                         _mm_loadu_si128(reinterpret_cast<const __m128i *>(
+                                                    sha256Constants + 4 * i)));
+            state1 = _mm_sha256rnds2_epu32(state1, state0, words);
+            words  = _mm_shuffle_epi32(words, 0x0e);
+            state0 = _mm_sha256rnds2_epu32(state0, state1, words);
+        }
+
+        state0 = _mm_add_epi32(state0, abefSave);
+        state1 = _mm_add_epi32(state1, cdghSave);
+    }
+
+    tmp    = _mm_shuffle_epi32(state0, 0x1b);                 // FEBA
+    state1 = _mm_shuffle_epi32(state1, 0xb1);                 // DCHG
+    state0 = _mm_blend_epi16(tmp, state1, 0xf0);              // DCBA
+    state1 = _mm_alignr_epi8(state1, tmp, 8);                 // HGFE
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(state),     state0);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(state + 4), state1);
+}
+
+__attribute__((target("avx2")))
+inline
+__m256i rotateRight32x8(__m256i value, int shift)
+    // Return the specified 'value' with each 32-bit lane rotated by the
+    // specified 'shift' bits to the right.
+{
+    return _mm256_or_si256(_mm256_srli_epi32(value, shift),
+                           _mm256_slli_epi32(value, 32 - shift));
+}
+
+__attribute__((target("avx2")))
+void sha256LockstepAvx2(bsl::uint32_t              (*states)[8],
+                        const unsigned char *const  *messages,
+                        bsl::uint64_t                numBlocks)
+    // Update each of the 8 specified 'states' with the specified 'numBlocks'
+    // 64-byte blocks of the corresponding one of the 8 specified 'messages',
+    // hashing one message in each 32-bit lane of 256-bit vectors.  The
+    // behavior is undefined unless the processor supports AVX2.
+{
+    const __m256i byteSwap = _mm256_setr_epi8( 3,  2,  1,  0,  7,  6,  5,  4,
+                                              11, 10,  9,  8, 15, 14, 13, 12,
+                                               3,  2,  1,  0,  7,  6,  5,  4,
+                                              11, 10,  9,  8, 15, 14, 13, 12);
+    __m256i s[8];
+    for (int j = 0; j < 8; ++j) {
+        s[j] = _mm256_setr_epi32(states[0][j], states[1][j], states[2][j],
+                                 states[3][j], states[4][j], states[5][j],
+                                 states[6][j], states[7][j]);
+    }
+
+    for (bsl::uint64_t block = 0; block < numBlocks; ++block) {
+        const bsl::uint64_t offset = block * 64;
+
+        // Load the message words, transposing each 8x8 matrix of words so
+        // that vector 't' holds word 't' of each message.
+
+        __m256i w[16];
+        for (int half = 0; half < 2; ++half) {
+            __m256i r[8];
+            for (int lane = 0; lane < 8; ++lane) {
+                r[lane] = _mm256_loadu_si256(
+                               reinterpret_cast<const __m256i *>(
+                                     messages[lane] + offset + 32 * half));
+            }
+
+            __m256i t[8];
+            for (int k = 0; k < 4; ++k) {
+                t[2 * k]     = _mm256_unpacklo_epi32(r[2 * k], r[2 * k + 1]);
+                t[2 * k + 1] = _mm256_unpackhi_epi32(r[2 * k], r[2 * k + 1]);
+            }
+
+            __m256i u[8];
+            for (int k = 0; k < 2; ++k) {
+                u[4 * k]     = _mm256_unpacklo_epi64(t[4 * k],
+                                                     t[4 * k + 2]);
+                u[4 * k + 1] = _mm256_unpackhi_epi64(t[4 * k],
+                                                     t[4 * k + 2]);
+                u[4 * k + 2] = _mm256_unpacklo_epi64(t[4 * k + 1],
+                                                     t[4 * k + 3]);
+                u[4 * k + 3] = _mm256_unpackhi_epi64(t[4 * k + 1],
+                                                     t[4 * k + 3]);
+            }
+
+            __m256i *words = w + 8 * half;
+            for (int k = 0; k < 4; ++k) {
+                const __m256i low  = _mm256_permute2x128_si256(u[k],
+                                                               u[k + 4],
+                                                               0x20);
+                const __m256i high = _mm256_permute2x128_si256(u[k],
+                                                               u[k + 4],
+                                                               0x31);
+                words[k]     = _mm256_shuffle_epi8(low,  byteSwap);
+                words[k + 4] = _mm256_shuffle_epi8(high, byteSwap);
+            }
+        }
+
+        __m256i v[8];
+        bsl::copy(s, s + 8, v);
+
+        for (int index = 0; index < 64; ++index) {
+            __m256i word;
+            if (index < 16) {
+                word = w[index];
+            }
+            else {
+                const __m256i w2  = w[(index -  2) & 15];
+                const __m256i w15 = w[(index - 15) & 15];
+
+                const __m256i sigma1 = _mm256_xor_si256(
+                                  _mm256_xor_si256(rotateRight32x8(w2, 17),
+                                                   rotateRight32x8(w2, 19)),
+                                  _mm256_srli_epi32(w2, 10));
+                const __m256i sigma0 = _mm256_xor_si256(
+                                  _mm256_xor_si256(rotateRight32x8(w15, 7),
+                                                   rotateRight32x8(w15, 18)),
+                                  _mm256_srli_epi32(w15, 3));
+
+                word = _mm256_add_epi32(
+                                 _mm256_add_epi32(sigma1, w[(index - 7) & 15]),
+                                 _mm256_add_epi32(sigma0, w[index & 15]));
+                w[index & 15] = word;
+            }
+
+            const __m256i bigSigma1 = _mm256_xor_si256(
+                                  _mm256_xor_si256(rotateRight32x8(v[4], 6),
+                                                   rotateRight32x8(v[4], 11)),
+                                  rotateRight32x8(v[4], 25));
+            const __m256i choose = _mm256_xor_si256(
+                                          _mm256_and_si256(v[4], v[5]),
+                                          _mm256_andnot_si256(v[4], v[6]));
+            const __m256i t1 = _mm256_add_epi32(
+                 _mm256_add_epi32(_mm256_add_epi32(v[7], bigSigma1),
+                                  _mm256_add_epi32(choose, word)),
+                 _mm256_set1_epi32(static_cast<int>(sha256Constants[index])));
+
+            const __m256i bigSigma0 = _mm256_xor_si256(
+                                  _mm256_xor_si256(rotateRight32x8(v[0], 2),
+                                                   rotateRight32x8(v[0], 13)),
+                                  rotateRight32x8(v[0], 22));
+            const __m256i majority = _mm256_or_si256(
+                         _mm256_and_si256(v[0], v[1]),
+                         _mm256_and_si256(_mm256_or_si256(v[0], v[1]), v[2]));
+            const __m256i t2 = _mm256_add_epi32(bigSigma0, majority);
+
+            v[7] = v[6];
+            v[6] = v[5];
+            v[5] = v[4];
+            v[4] = _mm256_add_epi32(v[3], t1);
+            v[3] = v[2];
+            v[2] = v[1];
+            v[1] = v[0];
+            v[0] = _mm256_add_epi32(t1, t2);
+        }
+
+        for (int j = 0; j < 8; ++j) {
+            s[j] = _mm256_add_epi32(s[j], v[j]);
+        }
+    }
+
+    for (int j = 0; j < 8; ++j) {
+        bsl::uint32_t lanes[8];
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes), s[j]);
+        for (int lane = 0; lane < 8; ++lane) {
+            states[lane][j] = lanes[lane];
+        }
+    }
+}
+
+__attribute__((target("avx2")))
+inline
+__m256i rotateRight64x4(__m256i value, int shift)
+    // Return the specified 'value' with each 64-bit lane rotated by the
+    // specified 'shift' bits to the right.
+{
+    return _mm256_or_si256(_mm256_srli_epi64(value, shift),
+                           _mm256_slli_epi64(value, 64 - shift));
+}
+
+__attribute__((target("avx2")))
+void sha512LockstepAvx2(bsl::uint64_t              (*states)[8],
+                        const unsigned char *const  *messages,
+                        bsl::uint64_t                numBlocks)
+    // Update each of the 4 specified 'states' with the specified 'numBlocks'
+    // 128-byte blocks of the corresponding one of the 4 specified 'messages',
+    // hashing one message in each 64-bit lane of 256-bit vectors.  The
+    // behavior is undefined unless the processor supports AVX2.
+{
+    const __m256i byteSwap = _mm256_setr_epi8( 7,  6,  5,  4,  3,  2,  1,  0,
+                                              15, 14, 13, 12, 11, 10,  9,  8,
+                                               7,  6,  5,  4,  3,  2,  1,  0,
+                                              15, 14, 13, 12, 11, 10,  9,  8);
+    __m256i s[8];
+    for (int j = 0; j < 8; ++j) {
+        s[j] = _mm256_setr_epi64x(states[0][j], states[1][j],
+                                  states[2][j], states[3][j]);
+    }
+
+    for (bsl::uint64_t block = 0; block < numBlocks; ++block) {
+        const bsl::uint64_t offset = block * 128;
+
+        // Load the message words, transposing each 4x4 matrix of words so
+        // that vector 't' holds word 't' of each message.
+
+        __m256i w[16];
+        for (int quarter = 0; quarter < 4; ++quarter) {
+            __m256i r[4];
+            for (int lane = 0; lane < 4; ++lane) {
+                r[lane] = _mm256_loadu_si256(
+                               reinterpret_cast<const __m256i *>(
+                                  messages[lane] + offset + 32 * quarter));
+            }
+
+            const __m256i t0 = _mm256_unpacklo_epi64(r[0], r[1]);
+            const __m256i t1 = _mm256_unpackhi_epi64(r[0], r[1]);
+            const __m256i t2 = _mm256_unpacklo_epi64(r[2], r[3]);
+            const __m256i t3 = _mm256_unpackhi_epi64(r[2], r[3]);
+
+            __m256i *words = w + 4 * quarter;
+            words[0] = _mm256_shuffle_epi8(
+                                   _mm256_permute2x128_si256(t0, t2, 0x20),
+                                   byteSwap);
+            words[1] = _mm256_shuffle_epi8(
+                                   _mm256_permute2x128_si256(t1, t3, 0x20),
+                                   byteSwap);
+            words[2] = _mm256_shuffle_epi8(
+                                   _mm256_permute2x128_si256(t0, t2, 0x31),
+                                   byteSwap);
+            words[3] = _mm256_shuffle_epi8(
+                                   _mm256_permute2x128_si256(t1, t3, 0x31),
+                                   byteSwap);
+        }
+
+        __m256i v[8];
+        bsl::copy(s, s + 8, v);
+
+        for (int index = 0; index < 80; ++index) {
+            __m256i word;
+            if (index < 16) {
+                word = w[index];
+            }
+            else {
+                const __m256i w2  = w[(index -  2) & 15];
+                const __m256i w15 = w[(index - 15) & 15];
+
+                const __m256i sigma1 = _mm256_xor_si256(
+                                  _mm256_xor_si256(rotateRight64x4(w2, 19),
+                                                   rotateRight64x4(w2, 61)),
+                                  _mm256_srli_epi64(w2, 6));
+                const __m256i sigma0 = _mm256_xor_si256(
+                                  _mm256_xor_si256(rotateRight64x4(w15, 1),
+                                                   rotateRight64x4(w15, 8)),
+                                  _mm256_srli_epi64(w15, 7));
+
+                word = _mm256_add_epi64(
+                                 _mm256_add_epi64(sigma1, w[(index - 7) & 15]),
+                                 _mm256_add_epi64(sigma0, w[index & 15]));
+                w[index & 15] = word;
+            }
+
+            const __m256i bigSigma1 = _mm256_xor_si256(
+                                  _mm256_xor_si256(rotateRight64x4(v[4], 14),
+                                                   rotateRight64x4(v[4], 18)),
+                                  rotateRight64x4(v[4], 41));
+            const __m256i choose = _mm256_xor_si256(
+                                          _mm256_and_si256(v[4], v[5]),
+                                          _mm256_andnot_si256(v[4], v[6]));
+            const __m256i t1 = _mm256_add_epi64(
+                 _mm256_add_epi64(_mm256_add_epi64(v[7], bigSigma1),
+                                  _mm256_add_epi64(choose, word)),
+                 _mm256_set1_epi64x(
+                            static_cast<long long>(sha512Constants[index])));
+
+            const __m256i bigSigma0 = _mm256_xor_si256(
+                                  _mm256_xor_si256(rotateRight64x4(v[0], 28),
+                                                   rotateRight64x4(v[0], 34)),
+                                  rotateRight64x4(v[0], 39));
+            const __m256i majority = _mm256_or_si256(
+                         _mm256_and_si256(v[0], v[1]),
+                         _mm256_and_si256(_mm256_or_si256(v[0], v[1]), v[2]));
+            const __m256i t2 = _mm256_add_epi64(bigSigma0, majority);
+
+            v[7] = v[6];
+            v[6] = v[5];
+            v[5] = v[4];
+            v[4] = _mm256_add_epi64(v[3], t1);
+            v[3] = v[2];
+            v[2] = v[1];
+            v[1] = v[0];
+            v[0] = _mm256_add_epi64(t1, t2);
+        }
+
+        for (int j = 0; j < 8; ++j) {
+            s[j] = _mm256_add_epi64(s[j], v[j]);
+        }
+    }
+
+    for (int j = 0; j < 8; ++j) {
+        bsl::uint64_t lanes[4];
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes), s[j]);
+        for (int lane = 0; lane < 4; ++lane) {
+            states[lane][j] = lanes[lane];
+        }
+    }
+}
+
+int detectFeatures()
+    // Return the bitwise-OR of the 'Sha2_Impl::Feature' values supported by
+    // the processor.
+{
+    unsigned int eax, ebx, ecx, edx;
+
+    if (__get_cpuid_max(0, 0) < 7) {
+        return 0;                                                     // RETURN
+    }
+
+    __cpuid(1, eax, ebx, ecx, edx);
+    const bool hasSse41    = ecx & (1u << 19);
+    const bool hasOsxsave  = ecx & (1u << 27);
+    const bool hasAvx      = ecx & (1u << 28);
+
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    const bool hasAvx2     = ebx & (1u <<  5);
+    const bool hasSha      = ebx & (1u << 29);
+
+    int features = 0;
+
+    if (hasSha && hasSse41) {
+        features |= Sha2_Impl::e_SHA_NI;
+    }
+
+    if (hasAvx2 && hasAvx && hasOsxsave) {
+        // Check that the operating system saves the YMM registers.
+
+        unsigned int xcr0Low, xcr0High;
+        __asm__("xgetbv" : "=a"(xcr0Low), "=d"(xcr0High) : "c"(0));
+        if (6 == (xcr0Low & 6)) {
+            features |= Sha2_Impl::e_AVX2;
+        }
+    }
+
+    return features;
+}
+
+#else
+
+int detectFeatures()
+    // Return the bitwise-OR of the 'Sha2_Impl::Feature' values supported by
+    // the processor.
+{
+    return 0;
+}
+
+#endif  // LIKE_X86_GCC
+
+class Sha2Kernels {
+    // This class provides a namespace for the block-processing kernels used
+    // by the SHA-2 classes, selected according to the features of the
+    // processor detected on first use.
+
+  public:
+    // TYPES
+    typedef void (*Sha256Fn)(bsl::uint32_t       *state,
+                             const unsigned char *message,
+                             bsl::uint64_t        numBlocks);
+        // 'Sha256Fn' is an alias for a function updating a SHA-224/256 state
+        // with a number of consecutive blocks.
+
+    typedef void (*Sha256LockstepFn)(bsl::uint32_t              (*states)[8],
+                                     const unsigned char *const  *messages,
+                                     bsl::uint64_t                numBlocks);
+        // 'Sha256LockstepFn' is an alias for a function updating 8 SHA-224/256
+        // states, each with the same number of blocks of its own message.
+
+    typedef void (*Sha512LockstepFn)(bsl::uint64_t              (*states)[8],
+                                     const unsigned char *const  *messages,
+                                     bsl::uint64_t                numBlocks);
+        // 'Sha512LockstepFn' is an alias for a function updating 4 SHA-384/512
+        // states, each with the same number of blocks of its own message.
+
+  private:
+    // CLASS DATA
+    static int              s_supported;           // supported features
+    static int              s_enabled;             // features in use
+    static Sha256Fn         s_sha256Fn;            // single-message kernel
+    static Sha256LockstepFn s_sha256LockstepFn;    // 0 if not used
+    static Sha512LockstepFn s_sha512LockstepFn;    // 0 if not used
+
+    // PRIVATE CLASS METHODS
+    static void initialize();
+        // Detect the features of the processor and select the kernels to use
+        // if this has not already been done.
+
+    static void selectImpl(int features);
+        // Select the fastest kernels using only those of the specified
+        // 'features' that are supported.  The behavior is undefined unless
+        // the supported features have been detected.
+
+  public:
+    // CLASS METHODS
+    static void select(int features);
+        // Select the fastest kernels using only those of the specified
+        // 'features' that are supported.
+
+    static int enabled();
+        // Return the features used by the selected kernels.
+
+    static int supported();
+        // Return the features supported by the processor.
+
+    static Sha256Fn sha256Fn();
+        // Return the selected SHA-224/256 single-message kernel.
+
+    static Sha256LockstepFn sha256LockstepFn();
+        // Return the selected SHA-224/256 lockstep kernel, or 0 if messages
+        // are to be hashed one after the other.
+
+    static Sha512LockstepFn sha512LockstepFn();
+        // Return the selected SHA-384/512 lockstep kernel, or 0 if messages
+        // are to be hashed one after the other.
+};
+
+// CLASS DATA
+int                           Sha2Kernels::s_supported = 0;
+int                           Sha2Kernels::s_enabled   = 0;
+Sha2Kernels::Sha256Fn         Sha2Kernels::s_sha256Fn  = &sha256Portable;
+Sha2Kernels::Sha256LockstepFn Sha2Kernels::s_sha256LockstepFn = 0;
+Sha2Kernels::Sha512LockstepFn Sha2Kernels::s_sha512LockstepFn = 0;
+
+// PRIVATE CLASS METHODS
+void Sha2Kernels::initialize()
+{
+    BSLMT_ONCE_DO {
+        s_supported = detectFeatures();
+        selectImpl(s_supported);
+    }
+}
+
+void Sha2Kernels::selectImpl(int features)
+{
+    s_enabled          = features & s_supported;
+    s_sha256Fn         = &sha256Portable;
+    s_sha256LockstepFn = 0;
+    s_sha512LockstepFn = 0;
+
+#if defined(LIKE_X86_GCC)
+    if (s_enabled & Sha2_Impl::e_SHA_NI) {
+        // Hashing one message at a time using the SHA extensions is faster
+        // than the AVX2 lockstep kernel.
+
+        s_sha256Fn = &sha256ShaNi;
+    }
+    else if (s_enabled & Sha2_Impl::e_AVX2) {
+        s_sha256LockstepFn = &sha256LockstepAvx2;
+    }
+
+    if (s_enabled & Sha2_Impl::e_AVX2) {
+        s_sha512LockstepFn = &sha512LockstepAvx2;
+    }
+#endif
+}
+
+// CLASS METHODS
+void Sha2Kernels::select(int features)
+{
+    initialize();
+    selectImpl(features);
+}
+
+int Sha2Kernels::enabled()
+{
+    initialize();
+    return s_enabled;
+}
+
+int Sha2Kernels::supported()
+{
+    initialize();
+    return s_supported;
+}
+
+Sha2Kernels::Sha256Fn Sha2Kernels::sha256Fn()
+{
+    initialize();
+    return s_sha256Fn;
+}
+
+Sha2Kernels::Sha256LockstepFn Sha2Kernels::sha256LockstepFn()
+{
+    initialize();
+    return s_sha256LockstepFn;
+}
+
+Sha2Kernels::Sha512LockstepFn Sha2Kernels::sha512LockstepFn()
+{
+    initialize();
+    return s_sha512LockstepFn;
+}
+
+void processBlocks(bsl::uint32_t        *state,
+                   const unsigned char  *message,
+                   bsl::uint64_t         numBlocks,
+                   const bsl::uint32_t (&)[64])
+    // Update the specified SHA-224/256 'state' with the specified 'numBlocks'
+    // 64-byte blocks of the specified 'message'.
+{
+    Sha2Kernels::sha256Fn()(state, message, numBlocks);
+}
+
+void processBlocks(bsl::uint64_t        *state,
+                   const unsigned char  *message,
+                   bsl::uint64_t         numBlocks,
+                   const bsl::uint64_t (&constants)[80])
+    // Update the specified SHA-384/512 'state' with the specified 'numBlocks'
+    // 128-byte blocks of the specified 'message', mixing it with the values
+    // in the specified 'constants'.
+{
+    transform(state, message, numBlocks, 128, constants);
+}
+
 template<bsl::size_t BUFFER_CAPACITY, class INTEGER, bsl::size_t ARRAY_SIZE>
 void updateImpl(INTEGER             *state,
                 bsl::uint64_t       *totalSize,
@@ -277,12 +876,12 @@ void updateImpl(INTEGER             *state,
         return;                                                       // RETURN
     }
 
-    transform(state, buffer, 1, BUFFER_CAPACITY, constants);
+    processBlocks(state, buffer, 1, constants);
 
     const unsigned char *remaining        = message + prologueSize;
     const bsl::uint64_t  remainingSize    = messageSize - prologueSize;
     const bsl::uint64_t  remainingBuffers = remainingSize / BUFFER_CAPACITY;
-    transform(state, remaining, remainingBuffers, BUFFER_CAPACITY, constants);
+    processBlocks(state, remaining, remainingBuffers, constants);
 
     *bufferSize = remainingSize % BUFFER_CAPACITY;
     const unsigned char *epilogue = remaining
@@ -320,17 +919,88 @@ void finalize(unsigned char        *result,
     finalBuffers[bufferSize] = 1 << 7;
     unsigned char *end = finalBuffers + remainingBuffers * BUFFER_CAPACITY;
     unpack(totalSizeInBits, end - sizeof(totalSizeInBits));
-    transform(state,
-              finalBuffers,
-              remainingBuffers,
-              BUFFER_CAPACITY,
-              constants);
+    processBlocks(state, finalBuffers, remainingBuffers, constants);
 
     for (unsigned index = 0 ; index < digestSize / sizeof(INTEGER); ++index) {
         unpack(state[index], &result[index * sizeof(INTEGER)]);
     }
 }
 
+template<bsl::size_t BUFFER_CAPACITY,
+         bsl::size_t NUM_LANES,
+         class       INTEGER,
+         bsl::size_t ARRAY_SIZE>
+void loadDigestsImpl(
+              unsigned char        *results,
+              bsl::size_t           digestSize,
+              const INTEGER       (&initialState)[8],
+              void                (*lockstep)(INTEGER (*)[8],
+                                              const unsigned char *const *,
+                                              bsl::uint64_t),
+              const void *const    *messages,
+              const bsl::size_t    *lengths,
+              bsl::size_t           numMessages,
+              const INTEGER       (&constants)[ARRAY_SIZE])
+    // Store into the specified 'results' the digests, each having the
+    // specified 'digestSize', of the specified 'numMessages' messages
+    // described by the specified 'messages' and 'lengths', starting each from
+    // the specified 'initialState' and mixing with the data in the specified
+    // 'constants'.  Use the specified 'lockstep' function, if not 0, to
+    // process the blocks common to each group of 'NUM_LANES' messages.
+{
+    for (bsl::size_t first = 0; first < numMessages; first += NUM_LANES) {
+        const bsl::size_t numLanes = bsl::min(numMessages - first,
+                                              NUM_LANES);
+
+        // Unused lanes of the last group repeat the first message of the
+        // group, and their results are discarded.
+
+        const unsigned char *data[NUM_LANES];
+        INTEGER              states[NUM_LANES][8];
+        for (bsl::size_t lane = 0; lane < NUM_LANES; ++lane) {
+            const bsl::size_t index = first + (lane < numLanes ? lane : 0);
+            data[lane] = static_cast<const unsigned char *>(messages[index]);
+            bsl::copy(initialState, initialState + 8, states[lane]);
+        }
+
+        bsl::uint64_t numCommonBlocks = 0;
+        if (lockstep && 1 < numLanes) {
+            numCommonBlocks = lengths[first] / BUFFER_CAPACITY;
+            for (bsl::size_t lane = 1; lane < numLanes; ++lane) {
+                numCommonBlocks = bsl::min<bsl::uint64_t>(
+                                   numCommonBlocks,
+                                   lengths[first + lane] / BUFFER_CAPACITY);
+            }
+            if (numCommonBlocks) {
+                lockstep(states, data, numCommonBlocks);
+            }
+        }
+
+        for (bsl::size_t lane = 0; lane < numLanes; ++lane) {
+            const bsl::uint64_t  length    = lengths[first + lane];
+            const bsl::uint64_t  numBlocks = length / BUFFER_CAPACITY;
+            const bsl::uint64_t  tailSize  = length % BUFFER_CAPACITY;
+            const unsigned char *tail      = data[lane]
+                                           + numBlocks * BUFFER_CAPACITY;
+
+            processBlocks(states[lane],
+                          data[lane] + numCommonBlocks * BUFFER_CAPACITY,
+                          numBlocks - numCommonBlocks,
+                          constants);
+
+            unsigned char buffer[BUFFER_CAPACITY];
+            bsl::copy(tail, tail + tailSize, buffer);
+            finalize(results + (first + lane) * digestSize,
+                     digestSize,
+                     states[lane],
+                     length,
+                     tailSize,
+                     buffer,
+                     constants);
+        }
+    }
+}
+
 template<bsl::size_t SIZE>
 void toHex(char *output, const unsigned char (&input)[SIZE])
     // Store into the specified 'output' the hex representation of the bytes in
@@ -346,6 +1016,85 @@ void toHex(char *output, const unsigned char (&input)[SIZE])
 
 } // close unnamed namespace
 
+void Sha224::loadDigests(unsigned char     *results,
+                         const void *const *messages,
+                         const bsl::size_t *lengths,
+                         bsl::size_t        numMessages)
+{
+    const Sha224 initial;
+    loadDigestsImpl<64, 8>(results,
+                           k_DIGEST_SIZE,
+                           initial.d_state,
+                           Sha2Kernels::sha256LockstepFn(),
+                           messages,
+                           lengths,
+                           numMessages,
+                           sha256Constants);
+}
+
+void Sha256::loadDigests(unsigned char     *results,
+                         const void *const *messages,
+                         const bsl::size_t *lengths,
+                         bsl::size_t        numMessages)
+{
+    const Sha256 initial;
+    loadDigestsImpl<64, 8>(results,
+                           k_DIGEST_SIZE,
+                           initial.d_state,
+                           Sha2Kernels::sha256LockstepFn(),
+                           messages,
+                           lengths,
+                           numMessages,
+                           sha256Constants);
+}
+
+void Sha384::loadDigests(unsigned char     *results,
+                         const void *const *messages,
+                         const bsl::size_t *lengths,
+                         bsl::size_t        numMessages)
+{
+    const Sha384 initial;
+    loadDigestsImpl<128, 4>(results,
+                            k_DIGEST_SIZE,
+                            initial.d_state,
+                            Sha2Kernels::sha512LockstepFn(),
+                            messages,
+                            lengths,
+                            numMessages,
+                            sha512Constants);
+}
+
+void Sha512::loadDigests(unsigned char     *results,
+                         const void *const *messages,
+                         const bsl::size_t *lengths,
+                         bsl::size_t        numMessages)
+{
+    const Sha512 initial;
+    loadDigestsImpl<128, 4>(results,
+                            k_DIGEST_SIZE,
+                            initial.d_state,
+                            Sha2Kernels::sha512LockstepFn(),
+                            messages,
+                            lengths,
+                            numMessages,
+                            sha512Constants);
+}
+
+int Sha2_Impl::enabledFeatures()
+{
+    return Sha2Kernels::enabled();
+}
+
+void Sha2_Impl::setEnabledFeatures(int features)
+{
+    Sha2Kernels::select(features);
+}
+
+int Sha2_Impl::supportedFeatures()
+{
+    return Sha2Kernels::supported();
+}
+
 Sha224::Sha224()
 {
     reset();
@@ -12,6 +12,7 @@ BSLS_IDENT("$Id$ $CSID$")
 //  bdlde::Sha256: value-semantic type representing a SHA-256 digest
 //  bdlde::Sha384: value-semantic type representing a SHA-384 digest
 //  bdlde::Sha512: value-semantic type representing a SHA-512 digest
+//  bdlde::Sha2_Impl: namespace controlling processor-specific SHA-2 kernels
 //
 //@SEE_ALSO: bdlde_md5
 //
@@ -25,6 +26,34 @@ BSLS_IDENT("$Id$ $CSID$")
 //
 // Note that a SHA-2 digest does not aid in error correction.
 //
+///Hardware Acceleration
+///---------------------
+// On x86 platforms built with GCC or Clang, the features of the processor are
+// detected the first time a digest is updated, and the fastest available
+// kernel is used to process each 64-byte (SHA-224 and SHA-256) or 128-byte
+// (SHA-384 and SHA-512) block:
+//..
+//  Kernel           Requires             Used by
+//  ---------------  -------------------  ------------------------------------
+//  SHA extensions   SHA-NI               all SHA-224 and SHA-256 hashing
+//  8-lane lockstep  AVX2 (no SHA-NI)     'loadDigests' of 'Sha224', 'Sha256'
+//  4-lane lockstep  AVX2                 'loadDigests' of 'Sha384', 'Sha512'
+//  portable         (none)               everything else
+//..
+// All kernels produce results identical to the portable implementation.  The
+// 'bdlde::Sha2_Impl' 'struct' allows a test driver or benchmark to restrict
+// the set of processor features that are used.
+//
+///Hashing Multiple Messages
+///-------------------------
+// Each class provides a 'loadDigests' class method that computes the digests
+// of a number of independent messages at once.  When a lockstep kernel is
+// available, the messages are processed in groups (of 8 for SHA-224 and
+// SHA-256, and 4 for SHA-384 and SHA-512), the blocks common to all messages
+// of a group being hashed together using one vector lane per message.
+// Messages of similar length therefore benefit the most.  When no lockstep
+// kernel is available, the messages are hashed one after the other.
+//
 ///Usage
 ///-----
 // In this section we show intended usage of this component.  The
@@ -121,6 +150,22 @@ class Sha224 {
     static const bsl::size_t k_DIGEST_SIZE = 224 / 8;
         // The size (in bytes) of the output
 
+    // CLASS METHODS
+    static void loadDigests(unsigned char     *results,
+                            const void *const *messages,
+                            const bsl::size_t *lengths,
+                            bsl::size_t        numMessages);
+        // Load into the specified 'results' the digests of the specified
+        // 'numMessages' independent messages, where the message having index
+        // 'i' starts at 'messages[i]' and has 'lengths[i]' bytes, and its
+        // digest is stored at 'results + i * k_DIGEST_SIZE'.  The digest of
+        // each message is identical to that loaded by 'loadDigest' from a
+        // digest constructed from that message.  The behavior is undefined
+        // unless 'results' refers to at least 'numMessages * k_DIGEST_SIZE'
+        // bytes, and 'messages' and 'lengths' each refer to at least
+        // 'numMessages' elements.  Note that, if supported by the processor,
+        // up to 8 messages are hashed in lockstep.
+
     // CREATORS
     Sha224();
         // Construct a SHA-2 digest having the value corresponding to no data
@@ -201,6 +246,22 @@ class Sha256 {
     static const bsl::size_t k_DIGEST_SIZE = 256 / 8;
         // The size (in bytes) of the output
 
+    // CLASS METHODS
+    static void loadDigests(unsigned char     *results,
+                            const void *const *messages,
+                            const bsl::size_t *lengths,
+                            bsl::size_t        numMessages);
+        // Load into the specified 'results' the digests of the specified
+        // 'numMessages' independent messages, where the message having index
+        // 'i' starts at 'messages[i]' and has 'lengths[i]' bytes, and its
+        // digest is stored at 'results + i * k_DIGEST_SIZE'.  The digest of
+        // each message is identical to that loaded by 'loadDigest' from a
+        // digest constructed from that message.  The behavior is undefined
+        // unless 'results' refers to at least 'numMessages * k_DIGEST_SIZE'
+        // bytes, and 'messages' and 'lengths' each refer to at least
+        // 'numMessages' elements.  Note that, if supported by the processor,
+        // up to 8 messages are hashed in lockstep.
+
     // CREATORS
     Sha256();
         // Construct a SHA-2 digest having the value corresponding to no data
@@ -281,6 +342,22 @@ class Sha384 {
     static const bsl::size_t k_DIGEST_SIZE = 384 / 8;
         // The size (in bytes) of the output
 
+    // CLASS METHODS
+    static void loadDigests(unsigned char     *results,
+                            const void *const *messages,
+                            const bsl::size_t *lengths,
+                            bsl::size_t        numMessages);
+        // Load into the specified 'results' the digests of the specified
+        // 'numMessages' independent messages, where the message having index
+        // 'i' starts at 'messages[i]' and has 'lengths[i]' bytes, and its
+        // digest is stored at 'results + i * k_DIGEST_SIZE'.  The digest of
+        // each message is identical to that loaded by 'loadDigest' from a
+        // digest constructed from that message.  The behavior is undefined
+        // unless 'results' refers to at least 'numMessages * k_DIGEST_SIZE'
+        // bytes, and 'messages' and 'lengths' each refer to at least
+        // 'numMessages' elements.  Note that, if supported by the processor,
+        // up to 4 messages are hashed in lockstep.
+
     // CREATORS
     Sha384();
         // Construct a SHA-2 digest having the value corresponding to no data
@@ -361,6 +438,22 @@ class Sha512 {
     static const bsl::size_t k_DIGEST_SIZE = 512 / 8;
         // The size (in bytes) of the output
 
+    // CLASS METHODS
+    static void loadDigests(unsigned char     *results,
+                            const void *const *messages,
+                            const bsl::size_t *lengths,
+                            bsl::size_t        numMessages);
+        // Load into the specified 'results' the digests of the specified
+        // 'numMessages' independent messages, where the message having index
+        // 'i' starts at 'messages[i]' and has 'lengths[i]' bytes, and its
+        // digest is stored at 'results + i * k_DIGEST_SIZE'.  The digest of
+        // each message is identical to that loaded by 'loadDigest' from a
+        // digest constructed from that message.  The behavior is undefined
+        // unless 'results' refers to at least 'numMessages * k_DIGEST_SIZE'
+        // bytes, and 'messages' and 'lengths' each refer to at least
+        // 'numMessages' elements.  Note that, if supported by the processor,
+        // up to 4 messages are hashed in lockstep.
+
     // CREATORS
     Sha512();
         // Construct a SHA-2 digest having the value corresponding to no data
@@ -403,6 +496,39 @@ class Sha512 {
         // output 'stream' and return a reference to the modifiable 'stream'.
 };
 
+                              // ================
+                              // struct Sha2_Impl
+                              // ================
+
+struct Sha2_Impl {
+    // This 'struct' provides a namespace for functions that report and
+    // restrict the processor features used by the SHA-2 classes in this
+    // component.  These functions are intended for use by test drivers and
+    // benchmarks.
+
+    // TYPES
+    enum Feature {
+        e_AVX2   = 1,  // 256-bit integer vectors (lockstep kernels)
+        e_SHA_NI = 2   // SHA extensions (SHA-224 and SHA-256 kernels)
+    };
+
+    // CLASS METHODS
+    static int enabledFeatures();
+        // Return the bitwise-OR of the 'Feature' values that the SHA-2
+        // classes in this component currently use.
+
+    static void setEnabledFeatures(int features);
+        // Use only those of the specified 'features' (a bitwise-OR of
+        // 'Feature' values) that are also supported by the processor.  The
+        // behavior is undefined if any SHA-2 object is in use by another
+        // thread during this call.  Note that the results of hashing are
+        // identical whatever the features in use.
+
+    static int supportedFeatures();
+        // Return the bitwise-OR of the 'Feature' values supported by both the
+        // processor and this build of the component.
+};
+
 // FREE OPERATORS
 bool operator==(const Sha224& lhs, const Sha224& rhs);
     // Return 'true' if the specified 'lhs' and 'rhs' SHA digests have the same
@@ -5,6 +5,7 @@
 
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>
@@ -86,6 +87,15 @@ using namespace bsl;
 //    o void loadDigest(unsigned char *result) const;
 //
 //-----------------------------------------------------------------------------
+// CLASS METHODS
+// [26] void Sha224::loadDigests(uchar *, const void *const *, size_t *, n);
+// [26] void Sha256::loadDigests(uchar *, const void *const *, size_t *, n);
+// [26] void Sha384::loadDigests(uchar *, const void *const *, size_t *, n);
+// [26] void Sha512::loadDigests(uchar *, const void *const *, size_t *, n);
+// [27] int Sha2_Impl::enabledFeatures();
+// [27] void Sha2_Impl::setEnabledFeatures(int features);
+// [27] int Sha2_Impl::supportedFeatures();
+//
 // CREATORS
 // [ 2] Sha224::Sha224();
 // [ 3] Sha256::Sha256();
@@ -135,7 +145,8 @@ using namespace bsl;
 // [25] bsl::ostream& operator<<(bsl::ostream& stream, const Sha512& digest);
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [26] USAGE EXAMPLE
+// [28] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
 // [ *] CONCERN: This test driver is reusable w/other, similar components.
 // [ *] CONCERN: In no case does memory come from the global allocator.
 // [  ] CONCERN: All memory allocation is from the object's allocator.
@@ -495,6 +506,161 @@ void testTwoArgumentConstructor(const char (&message)[LENGTH])
     ASSERT(digest1 == digest2);
 }
 
+template<class HASHER>
+void testLoadDigests()
+    // Verify that 'HASHER::loadDigests' loads, for various numbers of messages
+    // of various lengths, the same digests as does 'loadDigest' for each
+    // message hashed separately.
+{
+    const bsl::size_t k_MAX_MESSAGES = 19;
+    const bsl::size_t k_DIGEST_SIZE  = HASHER::k_DIGEST_SIZE;
+
+    bsl::vector<unsigned char> data(4096);
+    for (bsl::size_t index = 0; index != data.size(); ++index) {
+        data[index] = static_cast<unsigned char>(index * 131 + index / 7);
+    }
+
+    // Each pattern gives the length of the messages relative to their index,
+    // for lengths that differ, coincide, or are zero.
+
+    for (int pattern = 0; pattern < 5; ++pattern) {
+        for (bsl::size_t numMessages = 0;
+             numMessages <= k_MAX_MESSAGES;
+             ++numMessages) {
+            const void    *messages[k_MAX_MESSAGES];
+            bsl::size_t    lengths[k_MAX_MESSAGES];
+            unsigned char  results[k_MAX_MESSAGES * k_DIGEST_SIZE];
+            unsigned char  expected[k_DIGEST_SIZE];
+
+            for (bsl::size_t index = 0; index != numMessages; ++index) {
+                bsl::size_t length = 0;
+                switch (pattern) {
+                  case 0: length = 0;                                  break;
+                  case 1: length = 1000;                               break;
+                  case 2: length = index * 97;                         break;
+                  case 3: length = (numMessages - index) * 211 % 1500; break;
+                  case 4: length = index % 3 ? 513 + index : 0;        break;
+                }
+                lengths[index]  = length;
+                messages[index] = 0 == length
+                                ? 0
+                                : &data[(index * 53) % (data.size() - length)];
+            }
+
+            HASHER::loadDigests(results, messages, lengths, numMessages);
+
+            for (bsl::size_t index = 0; index != numMessages; ++index) {
+                HASHER hasher(messages[index], lengths[index]);
+                hasher.loadDigest(expected);
+
+                ASSERTV(pattern,
+                        numMessages,
+                        index,
+                        bsl::equal(expected,
+                                   expected + k_DIGEST_SIZE,
+                                   results + index * k_DIGEST_SIZE));
+            }
+        }
+    }
+}
+
+template<class HASHER>
+void testAgainstReference(const bsl::vector<bsl::string>& references)
+    // Verify that an instance of the specified 'HASHER', updated in one call
+    // and in irregular pieces with each prefix of a fixed message, produces
+    // the digest at the corresponding index of the specified 'references'.
+{
+    const bsl::size_t k_DIGEST_SIZE = HASHER::k_DIGEST_SIZE;
+
+    const bsl::string message = allCharacters() + allCharacters();
+
+    unsigned char digest[k_DIGEST_SIZE];
+    bsl::string   hexDigest;
+
+    for (bsl::size_t length = 0; length != references.size(); ++length) {
+        HASHER hasher(message.data(), length);
+        hasher.loadDigest(digest);
+        toHex(&hexDigest, digest);
+        ASSERTV(length, hexDigest == references[length]);
+
+        HASHER      incremental;
+        bsl::size_t position = 0;
+        for (bsl::size_t stride = 1; position < length; ++stride) {
+            const bsl::size_t size = bsl::min(stride * 7, length - position);
+            incremental.update(message.data() + position, size);
+            position += size;
+        }
+        incremental.loadDigest(digest);
+        toHex(&hexDigest, digest);
+        ASSERTV(length, hexDigest == references[length]);
+    }
+}
+
+template<class HASHER>
+void loadReferences(bsl::vector<bsl::string> *references)
+    // Load into the specified 'references' the digests computed by an
+    // instance of the specified 'HASHER' of each of the first 300 prefixes of
+    // the message hashed by 'testAgainstReference'.
+{
+    const bsl::string message = allCharacters() + allCharacters();
+
+    unsigned char digest[HASHER::k_DIGEST_SIZE];
+
+    references->resize(300);
+    for (bsl::size_t length = 0; length != references->size(); ++length) {
+        HASHER hasher(message.data(), length);
+        hasher.loadDigest(digest);
+        toHex(&(*references)[length], digest);
+    }
+}
+
+template<class HASHER>
+void benchmark(const char *name, int features)
+    // Print the throughput of the specified 'HASHER', using only the
+    // specified 'features', hashing one large message and hashing 8 shorter
+    // messages at once, labelled with the specified 'name'.
+{
+    const bsl::size_t k_SIZE       = 1 << 20;
+    const bsl::size_t k_NUM_SHORT  = 8;
+    const int         k_ITERATIONS = 64;
+
+    bdlde::Sha2_Impl::setEnabledFeatures(features);
+
+    bsl::vector<unsigned char> data(k_SIZE, 'x');
+    unsigned char              digests[k_NUM_SHORT * HASHER::k_DIGEST_SIZE];
+
+    bsls::Stopwatch timer;
+    timer.start();
+    for (int iteration = 0; iteration < k_ITERATIONS; ++iteration) {
+        HASHER hasher(data.data(), data.size());
+        hasher.loadDigest(digests);
+    }
+    timer.stop();
+
+    const double megabytes = k_ITERATIONS * static_cast<double>(k_SIZE)
+                                                                 / (1 << 20);
+    cout << name << " (features " << features << ")\n"
+         << "\tsingle message:   " << megabytes / timer.elapsedTime()
+         << " MB/s\n";
+
+    const void  *messages[k_NUM_SHORT];
+    bsl::size_t  lengths[k_NUM_SHORT];
+    for (bsl::size_t index = 0; index != k_NUM_SHORT; ++index) {
+        messages[index] = &data[index * (k_SIZE / k_NUM_SHORT)];
+        lengths[index]  = k_SIZE / k_NUM_SHORT;
+    }
+
+    timer.reset();
+    timer.start();
+    for (int iteration = 0; iteration < k_ITERATIONS; ++iteration) {
+        HASHER::loadDigests(digests, messages, lengths, k_NUM_SHORT);
+    }
+    timer.stop();
+
+    cout << "\t'loadDigests' x8: " << megabytes / timer.elapsedTime()
+         << " MB/s\n";
+}
+
 }  // close unnamed namespace
 
 //=============================================================================
@@ -509,7 +675,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << '\n';
 
     switch (test) { case 0:
-      case 26: {
+      case 28: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   This will test the usage example provided in the component header
@@ -531,6 +697,127 @@ int main(int argc, char *argv[])
 
         assertPasswordIsExpected();
       } break;
+      case 27: {
+        // --------------------------------------------------------------------
+        // TESTING PROCESSOR FEATURES
+        //
+        // Concerns:
+        //: 1 'supportedFeatures' reports a subset of the known features, and
+        //:   'enabledFeatures' initially reports all of them.
+        //:
+        //: 2 'setEnabledFeatures' enables exactly the requested features that
+        //:   are supported.
+        //:
+        //: 3 Every combination of enabled features produces the same digests,
+        //:   whether a message is hashed in one piece, in several pieces, or
+        //:   by 'loadDigests'.
+        //
+        // Plan:
+        //: 1 Compare the reported features with the known features.  (C-1)
+        //:
+        //: 2 With no features enabled, compute reference digests of messages
+        //:   of lengths 0 to 299.  (C-2)
+        //:
+        //: 3 For every subset of the supported features, enable the subset,
+        //:   verify 'enabledFeatures', and compare the digests of known
+        //:   messages, the reference messages hashed in one piece and in
+        //:   pieces, and of messages passed to 'loadDigests' with the expected
+        //:   values.  (C-2..3)
+        //
+        // Testing:
+        //   int Sha2_Impl::enabledFeatures();
+        //   void Sha2_Impl::setEnabledFeatures(int features);
+        //   int Sha2_Impl::supportedFeatures();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING PROCESSOR FEATURES" "\n"
+                             "==========================" "\n";
+
+        typedef bdlde::Sha2_Impl Impl;
+
+        const int ALL       = Impl::e_AVX2 | Impl::e_SHA_NI;
+        const int SUPPORTED = Impl::supportedFeatures();
+
+        if (verbose) { P(SUPPORTED) }
+
+        ASSERTV(SUPPORTED, 0 == (SUPPORTED & ~ALL));
+        ASSERTV(SUPPORTED, SUPPORTED == Impl::enabledFeatures());
+
+        Impl::setEnabledFeatures(0);
+        ASSERTV(Impl::enabledFeatures(), 0 == Impl::enabledFeatures());
+
+        bsl::vector<bsl::string> references224, references256;
+        bsl::vector<bsl::string> references384, references512;
+        loadReferences<bdlde::Sha224>(&references224);
+        loadReferences<bdlde::Sha256>(&references256);
+        loadReferences<bdlde::Sha384>(&references384);
+        loadReferences<bdlde::Sha512>(&references512);
+
+        for (int features = 0; features <= ALL; ++features) {
+            if (features & ~SUPPORTED) {
+                continue;
+            }
+
+            if (verbose) { P(features) }
+
+            Impl::setEnabledFeatures(features | ~ALL);
+            ASSERTV(features, Impl::enabledFeatures(),
+                    features == Impl::enabledFeatures());
+
+            testKnownHashes<bdlde::Sha224>(sha224Results);
+            testKnownHashes<bdlde::Sha256>(sha256Results);
+            testKnownHashes<bdlde::Sha384>(sha384Results);
+            testKnownHashes<bdlde::Sha512>(sha512Results);
+
+            testAgainstReference<bdlde::Sha224>(references224);
+            testAgainstReference<bdlde::Sha256>(references256);
+            testAgainstReference<bdlde::Sha384>(references384);
+            testAgainstReference<bdlde::Sha512>(references512);
+
+            testLoadDigests<bdlde::Sha224>();
+            testLoadDigests<bdlde::Sha256>();
+            testLoadDigests<bdlde::Sha384>();
+            testLoadDigests<bdlde::Sha512>();
+        }
+
+        Impl::setEnabledFeatures(SUPPORTED);
+        ASSERTV(SUPPORTED == Impl::enabledFeatures());
+      } break;
+      case 26: {
+        // --------------------------------------------------------------------
+        // TESTING 'loadDigests'
+        //
+        // Concerns:
+        //: 1 'loadDigests' loads the digest of each message at the offset
+        //:   corresponding to its index.
+        //:
+        //: 2 The digests are correct for any number of messages, including
+        //:   none, and in particular for numbers that are not a multiple of
+        //:   the number of messages hashed in lockstep.
+        //:
+        //: 3 Messages of different lengths, of identical lengths, and of zero
+        //:   length (with a null address) are hashed correctly.
+        //
+        // Plan:
+        //: 1 For 0 to 19 messages whose lengths follow several patterns,
+        //:   compare the digests loaded by 'loadDigests' with those loaded by
+        //:   'loadDigest' for each message separately.  (C-1..3)
+        //
+        // Testing:
+        //   void Sha224::loadDigests(uchar *, const void *const *, ...);
+        //   void Sha256::loadDigests(uchar *, const void *const *, ...);
+        //   void Sha384::loadDigests(uchar *, const void *const *, ...);
+        //   void Sha512::loadDigests(uchar *, const void *const *, ...);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING 'loadDigests'" "\n"
+                             "=====================" "\n";
+
+        testLoadDigests<bdlde::Sha224>();
+        testLoadDigests<bdlde::Sha256>();
+        testLoadDigests<bdlde::Sha384>();
+        testLoadDigests<bdlde::Sha512>();
+      } break;
       case 25: {
         // --------------------------------------------------------------------
         // TESTING PRINTING AND OUTPUT (<<) OPERATOR FOR SHA-512
@@ -1250,6 +1537,40 @@ int main(int argc, char *argv[])
             ASSERT(hasher == hasher);
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 The hardware-accelerated kernels are faster than the portable
+        //:   implementation.
+        //
+        // Plan:
+        //: 1 For every subset of the supported features, time hashing one
+        //:   1 MiB message and 8 messages of 128 KiB with 'loadDigests', for
+        //:   SHA-256 and SHA-512.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        cout << "PERFORMANCE TEST" "\n"
+                "================" "\n";
+
+        typedef bdlde::Sha2_Impl Impl;
+
+        const int SUPPORTED = Impl::supportedFeatures();
+
+        for (int features = 0; features <= SUPPORTED; ++features) {
+            if (features & ~SUPPORTED) {
+                continue;
+            }
+            benchmark<bdlde::Sha256>("SHA-256", features);
+            benchmark<bdlde::Sha512>("SHA-512", features);
+        }
+
+        Impl::setEnabledFeatures(SUPPORTED);
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." "\n";
         testStatus = -1;
@@ -15,11 +15,17 @@ BSLS_IDENT_RCSID(bdlde_utf8util_cpp,"$Id$ $CSID$")
 #include <bsla_fallthrough.h>
 #include <bsls_assert.h>
 #include <bsls_performancehint.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
 
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 #include <bsl_streambuf.h>
 
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+#include <emmintrin.h>
+#endif
+
 // LOCAL MACROS
 
 #define UNLIKELY(EXPRESSION) BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(EXPRESSION)
@@ -109,6 +115,53 @@ int utf8Size(char character)
     return 4;
 }
 
+const char *skipAscii(const char *begin, const char *end)
+    // Return the address of the first byte in the range '[begin, end)' whose
+    // high bit is set, or 'end' if there is no such byte.  The behavior is
+    // undefined unless 'begin <= end'.
+{
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    // Test 32 bytes per iteration: the high bit of each byte is exactly what
+    // '_mm_movemask_epi8' collects.
+
+    while (end - begin >= 32) {
+        const __m128i lo = _mm_loadu_si128(
+                                  reinterpret_cast<const __m128i *>(begin));
+        const __m128i hi = _mm_loadu_si128(
+                                  reinterpret_cast<const __m128i *>(begin + 16));
+        if (_mm_movemask_epi8(_mm_or_si128(lo, hi))) {
+            break;
+        }
+        begin += 32;
+    }
+    if (end - begin >= 16 && !_mm_movemask_epi8(_mm_loadu_si128(
+                                  reinterpret_cast<const __m128i *>(begin)))) {
+        begin += 16;
+    }
+#else
+    // Test 8 bytes per iteration.  'memcpy' makes no alignment assumptions
+    // and is compiled to a single load.
+
+    while (end - begin >= 8) {
+        bsls::Types::Uint64 word;
+        bsl::memcpy(&word, begin, sizeof word);
+        if (word & 0x8080808080808080ULL) {
+            break;
+        }
+        begin += 8;
+    }
+#endif
+
+    // Locate the non-ASCII byte within the block where the loop stopped, or
+    // finish the tail.
+
+    while (begin < end && 0 == (*begin & 0x80)) {
+        ++begin;
+    }
+
+    return begin;
+}
+
 }  // close unnamed namespace
 
 // STATIC HELPER FUNCTIONS
@@ -342,7 +395,12 @@ static int validateAndCountCodePoints(const char             **invalidString,
           case 0x5: BSLA_FALLTHROUGH;
           case 0x6: BSLA_FALLTHROUGH;
           case 0x7: {
-            ++pc;
+            // Consume the whole run of ASCII starting at 'pc'; 'count' is
+            // incremented for the first byte below.
+
+            const char *asciiEnd = skipAscii(pc + 1, pcEnd4 + 4);
+            count += static_cast<int>(asciiEnd - pc - 1);
+            pc     = asciiEnd;
           } break;
           case 0x8: BSLA_FALLTHROUGH;
           case 0x9: BSLA_FALLTHROUGH;
@@ -1217,6 +1275,14 @@ bool Utf8Util::isValid(const char **invalidString,
     return validateAndCountCodePoints(invalidString, string, length) >= 0;
 }
 
+Utf8Util::size_type Utf8Util::numAsciiBytes(const char *string,
+                                             size_type   length)
+{
+    BSLS_ASSERT(string || 0 == length);
+
+    return skipAscii(string, string + length) - string;
+}
+
 Utf8Util::IntPtr Utf8Util::numBytesRaw(const bslstl::StringRef& string,
                                        IntPtr                   numCodePoints)
 {
@@ -1331,7 +1397,9 @@ Utf8Util::IntPtr Utf8Util::numCodePointsRaw(const char *string,
           case 5: BSLA_FALLTHROUGH;
           case 6: BSLA_FALLTHROUGH;
           case 7: {
-            ++string;
+            const char *asciiEnd = skipAscii(string + 1, end);
+            count += asciiEnd - string - 1;
+            string = asciiEnd;
           } break;
           case 0xc: BSLA_FALLTHROUGH;
           case 0xd: {
@@ -548,6 +548,16 @@ struct Utf8Util {
         // contain embedded null bytes, and 'string' may be null if
         // '0 == length' (see {Empty Input Strings}).
 
+    static size_type numAsciiBytes(const char *string, size_type length);
+        // Return the number of bytes at the start of the specified 'string'
+        // having the specified 'length' (in bytes) that precede the first
+        // byte whose value is not 7-bit ASCII (i.e., whose high bit is set),
+        // or 'length' if there is no such byte.  'string' need not be
+        // null-terminated and can contain embedded null bytes, and 'string'
+        // may be null if '0 == length'.  Note that each such byte is a valid
+        // single-byte UTF-8 code point, and that this function examines
+        // several bytes at a time where the platform supports it.
+
     static IntPtr numBytesIfValid(const bslstl::StringRef& string,
                                   IntPtr                   numCodePoints);
         // !DEPRECATED!: Use 'numBytesRaw' instead.
@@ -17,6 +17,7 @@
 #include <bsls_asserttest.h>
 #include <bsls_log.h>
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>
@@ -83,7 +84,11 @@ using bsl::size_t;
 //:
 //: o Test case 14 is negative testing.
 //:
-//: o Test cases 15, 16, and 17 are USAGE EXAMPLES.
+//: o Test case 15 tests 'numAsciiBytes', and the ASCII fast paths of the
+//:   length-based validation and counting functions against the functions
+//:   taking null-terminated input.
+//:
+//: o Test cases 16, 17, and 18 are USAGE EXAMPLES.
 //
 //-----------------------------------------------------------------------------
 // To fit functions on one line, 'typedef const char cchar'.
@@ -144,6 +149,7 @@ using bsl::size_t;
 // [ 8] IntPtr numCodePointsIfValid(const char **, const char *, int);
 // [ 5] IntPtr numCodePointsRaw(const char *s);
 // [ 5] IntPtr numCodePointsRaw(const char *s, int len);
+// [15] size_type numAsciiBytes(const char *, size_type);
 // [ 8] size_t readIfValid(int *, char *, size_t, streambuf *);
 // [ 9] IntPtr readIfValid(int *, cchar *, size_t, streambuf *);
 // [13] const char *toAscii(IntPtr);
@@ -151,11 +157,13 @@ using bsl::size_t;
 // [ 1] BREATHING TEST
 // [ 2] TABLE-DRIVEN ENCODING / DECODING / VALIDATION TEST
 // [14] NEGATIVE TESTING
-// [15] USAGE EXAMPLE 1
-// [16] USAGE EXAMPLE 2
-// [17] USAGE EXAMPLE 3
+// [15] CONCERN: ASCII FAST PATHS MATCH NULL-TERMINATED OVERLOADS
+// [16] USAGE EXAMPLE 1
+// [17] USAGE EXAMPLE 2
+// [18] USAGE EXAMPLE 3
 // [-1] random number generator
 // [-2] 'utf8Encode', 'decode'
+// [-3] PERFORMANCE: 'isValid' AND 'numCodePointsIfValid'
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -3026,7 +3034,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 17: {
+      case 18: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 3: 'readIfValid'
         //
@@ -3108,7 +3116,7 @@ int main(int argc, char *argv[])
         ASSERT(out.length() == validLen);
         ASSERT(validChineseUtf8 == out);
       } break;
-      case 16: {
+      case 17: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 2: 'advance'
         //
@@ -3221,7 +3229,7 @@ int main(int argc, char *argv[])
     ASSERT(static_cast<int>(string.length()) == result - start);
 //..
       } break;
-      case 15: {
+      case 16: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 1: 'isValid' AND 'numCodePoints*'
         //
@@ -3341,6 +3349,130 @@ int main(int argc, char *argv[])
     ASSERT(invalidPosition == stringWithOverlong.data() + string.length());
 //..
       } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // TESTING 'numAsciiBytes' AND ASCII FAST PATHS
+        //
+        // Concerns:
+        //: 1 'numAsciiBytes' returns the offset of the first byte having its
+        //:   high bit set, or the length if there is none, for every offset
+        //:   and length, including lengths spanning several blocks of the
+        //:   multi-byte scan, and regardless of embedded null bytes.
+        //:
+        //: 2 The length-based 'isValid', 'numCodePointsIfValid', and
+        //:   'numCodePointsRaw', which skip runs of ASCII several bytes at a
+        //:   time, return exactly the same results, including the reported
+        //:   'invalidString' and error status, as the overloads taking
+        //:   null-terminated input, which examine one code point at a time.
+        //
+        // Plan:
+        //: 1 For lengths up to 100, and each position in the string, place a
+        //:   byte having its high bit set at that position in an otherwise
+        //:   ASCII string, and verify the result of 'numAsciiBytes'.  Repeat
+        //:   with a string containing embedded null bytes.  (C-1)
+        //:
+        //: 2 For each valid and invalid sequence in 'DATA', and for ASCII
+        //:   prefixes and suffixes of lengths up to 70, compare the results of
+        //:   the length-based functions with those of the null-terminated
+        //:   overloads.  (C-2)
+        //
+        // Testing:
+        //   size_type numAsciiBytes(const char *, size_type);
+        //   CONCERN: ASCII FAST PATHS MATCH NULL-TERMINATED OVERLOADS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING 'numAsciiBytes' AND ASCII FAST PATHS\n"
+                             "============================================\n";
+
+        if (verbose) cout << "\tTesting 'numAsciiBytes'.\n";
+        {
+            ASSERT(0 == Obj::numAsciiBytes(0, 0));
+
+            const char HIGH[] = { '\x80', '\xc3', '\xff' };
+
+            for (int withNulls = 0; withNulls < 2; ++withNulls) {
+                for (int len = 0; len <= 100; ++len) {
+                    bsl::string str(len, 'a');
+                    if (withNulls) {
+                        for (int ii = 0; ii < len; ii += 3) {
+                            str[ii] = '\0';
+                        }
+                    }
+
+                    ASSERTV(withNulls, len,
+                           size_t(len) == Obj::numAsciiBytes(str.data(), len));
+
+                    for (int pos = 0; pos < len; ++pos) {
+                        for (int hi = 0; hi < 3; ++hi) {
+                            bsl::string s(str);
+                            s[pos] = HIGH[hi];
+
+                            ASSERTV(withNulls, len, pos, hi,
+                                    size_t(pos) == Obj::numAsciiBytes(s.data(),
+                                                                      len));
+
+                            // Also examine only a prefix, stopping either
+                            // before or after 'pos'.
+
+                            const int half = len / 2;
+                            ASSERTV(withNulls, len, pos, hi,
+                                    size_t(bsl::min(pos, half)) ==
+                                          Obj::numAsciiBytes(s.data(), half));
+                        }
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\tComparing with null-terminated overloads.\n";
+        {
+            const int MAX_AFFIX = 70;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int   LINE = DATA[ti].d_lineNum;
+                const char *UTF8 = DATA[ti].d_utf8_p;
+
+                for (int pre = 0; pre <= MAX_AFFIX; pre += 1 + pre / 8) {
+                    for (int post = 0; post <= MAX_AFFIX;
+                                                        post += 1 + post / 8) {
+                        bsl::string str(pre, 'x');
+                        str += UTF8;
+                        str.append(post, 'y');
+
+                        const char   *S   = str.c_str();
+                        const size_t  LEN = str.length();
+
+                        const char *expInvalid = 0;
+                        const char *invalid    = 0;
+
+                        const IntPtr EXP = Obj::numCodePointsIfValid(
+                                                                  &expInvalid,
+                                                                  S);
+                        const IntPtr RESULT = Obj::numCodePointsIfValid(
+                                                                     &invalid,
+                                                                     S,
+                                                                     LEN);
+
+                        ASSERTV(LINE, pre, post, EXP, RESULT, EXP == RESULT);
+                        ASSERTV(LINE, pre, post, expInvalid == invalid);
+
+                        ASSERTV(LINE, pre, post,
+                                (0 <= EXP) == Obj::isValid(S, LEN));
+
+                        invalid = 0;
+                        ASSERTV(LINE, pre, post,
+                                (0 <= EXP) == Obj::isValid(&invalid, S, LEN));
+                        ASSERTV(LINE, pre, post, expInvalid == invalid);
+
+                        if (0 <= EXP) {
+                            ASSERTV(LINE, pre, post,
+                                    EXP == Obj::numCodePointsRaw(S, LEN));
+                        }
+                    }
+                }
+            }
+        }
+      } break;
       case 14: {
         // --------------------------------------------------------------------
         // NEGATIVE TESTING
@@ -6232,6 +6364,89 @@ int main(int argc, char *argv[])
             ASSERT(bsl::strlen(str.c_str()) == str.length());
         }
       } break;
+      case -3: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'isValid' AND 'numCodePointsIfValid'
+        //
+        // Concerns:
+        //: 1 Validating and counting mostly-ASCII input with the length-based
+        //:   functions, which skip runs of ASCII several bytes at a time, is
+        //:   faster than with the null-terminated overloads, which examine
+        //:   one code point at a time.
+        //
+        // Plan:
+        //: 1 Build 1 MB strings that are pure ASCII, ASCII with a 2-byte code
+        //:   point every 64 bytes, and entirely 3-byte code points, and time
+        //:   repeated validation and counting of each with both overloads.
+        //:   An optional second argument specifies the number of iterations.
+        //
+        // Testing:
+        //   PERFORMANCE: 'isValid' AND 'numCodePointsIfValid'
+        // --------------------------------------------------------------------
+
+        cout << "PERFORMANCE: 'isValid' AND 'numCodePointsIfValid'\n"
+                "=================================================\n";
+
+        const int ITERATIONS = verbose ? bsl::atoi(argv[2]) : 100;
+        const int SIZE       = 1024 * 1024;
+
+        bsl::string ascii(SIZE, 'a');
+
+        bsl::string mixed;
+        mixed.reserve(SIZE);
+        while (mixed.length() + 64 <= size_t(SIZE)) {
+            mixed.append(62, 'b');
+            mixed += "\xc3\xa9";
+        }
+
+        bsl::string wide;
+        wide.reserve(SIZE);
+        while (wide.length() + 3 <= size_t(SIZE)) {
+            wide += "\xe2\x82\xac";
+        }
+
+        const struct {
+            const char        *d_name;
+            const bsl::string *d_string;
+        } INPUTS[] = {
+            { "ascii", &ascii },
+            { "mixed", &mixed },
+            { "3-byte", &wide },
+        };
+
+        for (int ii = 0; ii < 3; ++ii) {
+            const bsl::string& STR = *INPUTS[ii].d_string;
+
+            const char *invalid = 0;
+            IntPtr      sum     = 0;
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int jj = 0; jj < ITERATIONS; ++jj) {
+                sum += Obj::numCodePointsIfValid(&invalid, STR.c_str());
+            }
+            timer.stop();
+            const double nullTerminated = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            for (int jj = 0; jj < ITERATIONS; ++jj) {
+                sum -= Obj::numCodePointsIfValid(&invalid,
+                                                 STR.data(),
+                                                 STR.length());
+            }
+            timer.stop();
+            const double withLength = timer.elapsedTime();
+
+            ASSERT(0 == sum);
+
+            const double MB = double(STR.length()) * ITERATIONS / SIZE;
+            cout << INPUTS[ii].d_name
+                 << ":\tnull-terminated: " << MB / nullTerminated << " MB/s"
+                 << "\tlength: "           << MB / withLength     << " MB/s"
+                 << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
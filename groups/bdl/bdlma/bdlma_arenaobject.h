@@ -0,0 +1,308 @@
+// bdlma_arenaobject.h                                                -*-C++-*-
+#ifndef INCLUDED_BDLMA_ARENAOBJECT
+#define INCLUDED_BDLMA_ARENAOBJECT
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an object whose memory comes from a rewindable arena.
+//
+//@CLASSES:
+//  bdlma::ArenaObject: object constructed on a rewindable sequential arena
+//
+//@SEE_ALSO: bdlma_sequentialallocator, bdlma_autoreleaser
+//
+//@DESCRIPTION: This component provides a class template,
+// 'bdlma::ArenaObject', that owns a 'bdlma::SequentialAllocator' (the
+// "arena") and an object of its (template parameter) 'TYPE' constructed using
+// that arena to supply memory.  The object, and everything it allocates, can
+// be discarded in one step by calling 'reset', which destroys the object,
+// rewinds the arena, and constructs a new default-valued object on it.
+//
+// 'bdlma::ArenaObject' is intended for code that repeatedly fills a large,
+// allocator-aware object, such as a message decoded by one of the 'bdlat'
+// codecs ('balber::BerDecoder', 'baljsn::Decoder', and 'balxml::Decoder').
+// Because 'rewind' retains the blocks that the arena obtained through its
+// geometric growth, once the arena has grown large enough to hold the largest
+// object seen, subsequent 'reset'/fill cycles obtain no memory at all from the
+// allocator supplied at construction.
+//
+///Destruction on 'reset'
+///----------------------
+// 'reset' destroys the held object with 'bslma::DestructionUtil::destroy', so
+// no destructor is run for a 'TYPE' that is bitwise copyable (and therefore
+// trivially destructible).  Containers such as 'bsl::vector' likewise skip the
+// destruction of bitwise-copyable elements, so the cost of destroying an
+// object is proportional to the number of its non-trivial sub-objects only.
+// Deallocations made by those destructors are no-ops on the arena.
+//
+///Reusing Capacity Without Rewinding
+///----------------------------------
+// The codecs reset the object they decode into (see
+// 'bdlat_ValueTypeFunctions::reset') rather than destroying it.  Decoding
+// again into 'object()' *without* calling 'reset' therefore reuses whatever
+// capacity the previous value left behind (e.g., that of its top-level
+// arrays), but the memory released by the object to the arena is not
+// reclaimed until the next 'reset'.  Clients that decode many messages should
+// call 'reset' before each decode, or at least periodically.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Filling an Object Repeatedly
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose that we receive a stream of messages, each of which is parsed into a
+// vector of strings and then processed, and that we wish to avoid allocating
+// memory from the global allocator for every message.
+//
+// First, we define a function that "parses" a message into a vector of
+// strings, standing in for a decoder:
+//..
+//  void parse(bsl::vector<bsl::string> *result, const char *message)
+//      // Load into the specified 'result' the space-separated words of the
+//      // specified 'message'.
+//  {
+//      result->clear();
+//      const char *begin = message;
+//      while (*begin) {
+//          const char *end = begin;
+//          while (*end && ' ' != *end) {
+//              ++end;
+//          }
+//          result->push_back(bsl::string(begin, end));
+//          begin = *end ? end + 1 : end;
+//      }
+//  }
+//..
+// Then, we create a 'bdlma::ArenaObject' holding the vector, supplying a test
+// allocator so that we can observe the memory the arena obtains:
+//..
+//  bslma::TestAllocator ta;
+//
+//  bdlma::ArenaObject<bsl::vector<bsl::string> > message(&ta);
+//..
+// Next, we parse a few messages, calling 'reset' before each, so that all the
+// memory used by the previous message is reclaimed at once:
+//..
+//  const char *MESSAGES[] = {
+//      "a first message having more words than any of the others here",
+//      "another message",
+//      "the last message, which is also long, but not the longest"
+//  };
+//
+//  for (int i = 0; i < 3; ++i) {
+//      message.reset();
+//      parse(message.object(), MESSAGES[i]);
+//  }
+//  assert(11 == message.object()->size());
+//..
+// Finally, we observe that, once the arena has grown to accommodate the
+// messages, parsing more messages obtains no more memory from 'ta':
+//..
+//  const bsls::Types::Int64 numAllocations = ta.numAllocations();
+//
+//  for (int i = 0; i < 100; ++i) {
+//      message.reset();
+//      parse(message.object(), MESSAGES[i % 3]);
+//  }
+//  assert(numAllocations == ta.numAllocations());
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlma_sequentialallocator.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_destructionutil.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_objectbuffer.h>
+
+namespace BloombergLP {
+namespace bdlma {
+
+                             // =================
+                             // class ArenaObject
+                             // =================
+
+template <class TYPE>
+class ArenaObject {
+    // This class template owns a sequential arena and an object of the
+    // (template parameter) 'TYPE' constructed using that arena, and provides a
+    // 'reset' method that discards the object and all the memory it uses at
+    // once.  'TYPE' must be default constructible.
+
+    // DATA
+    SequentialAllocator      d_arena;           // supplies memory to the
+                                                // object
+
+    bsls::ObjectBuffer<TYPE> d_object;          // held object
+
+    bool                     d_isConstructed;   // 'true' unless constructing
+                                                // the object threw
+
+  private:
+    // PRIVATE MANIPULATORS
+    void destroyObject();
+        // Destroy the held object if it is constructed.
+
+    // NOT IMPLEMENTED
+    ArenaObject(const ArenaObject&);
+    ArenaObject& operator=(const ArenaObject&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(ArenaObject, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit ArenaObject(bslma::Allocator *basicAllocator = 0);
+    explicit ArenaObject(int               initialSize,
+                         bslma::Allocator *basicAllocator = 0);
+        // Create an arena object holding a default-constructed 'TYPE' object
+        // whose memory is supplied by an internal sequential arena.
+        // Optionally specify an 'initialSize' (in bytes) of the arena's
+        // internal buffer; if 'initialSize' is not specified, an
+        // implementation-defined value is used.  Optionally specify a
+        // 'basicAllocator' used to supply memory to the arena.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless '0 < initialSize'.
+
+    ~ArenaObject();
+        // Destroy the held object and release all memory obtained by the
+        // arena.
+
+    // MANIPULATORS
+    TYPE *object();
+        // Return the address of the modifiable held object.  The behavior is
+        // undefined if the last call to 'reset' threw an exception.
+
+    void reset();
+        // Destroy the held object (running no destructor if 'TYPE' is bitwise
+        // copyable), rewind the arena, retaining the memory it obtained
+        // through geometric growth, and construct a new default-valued 'TYPE'
+        // object on the arena.  Any reference or pointer to the previous
+        // object, or to memory it allocated, is invalidated.  If an exception
+        // is thrown, this object holds no 'TYPE' object until the next
+        // successful call to 'reset'.
+
+    // ACCESSORS
+    const TYPE& object() const;
+        // Return a 'const' reference to the held object.  The behavior is
+        // undefined if the last call to 'reset' threw an exception.
+
+    bslma::Allocator *arena() const;
+        // Return the address of the arena that supplies memory to the held
+        // object.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                             // -----------------
+                             // class ArenaObject
+                             // -----------------
+
+// PRIVATE MANIPULATORS
+template <class TYPE>
+inline
+void ArenaObject<TYPE>::destroyObject()
+{
+    if (d_isConstructed) {
+        d_isConstructed = false;
+        bslma::DestructionUtil::destroy(d_object.address());
+    }
+}
+
+// CREATORS
+template <class TYPE>
+inline
+ArenaObject<TYPE>::ArenaObject(bslma::Allocator *basicAllocator)
+: d_arena(basicAllocator)
+, d_isConstructed(false)
+{
+    bslma::ConstructionUtil::construct(d_object.address(), &d_arena);
+    d_isConstructed = true;
+}
+
+template <class TYPE>
+inline
+ArenaObject<TYPE>::ArenaObject(int               initialSize,
+                               bslma::Allocator *basicAllocator)
+: d_arena(initialSize, basicAllocator)
+, d_isConstructed(false)
+{
+    bslma::ConstructionUtil::construct(d_object.address(), &d_arena);
+    d_isConstructed = true;
+}
+
+template <class TYPE>
+inline
+ArenaObject<TYPE>::~ArenaObject()
+{
+    destroyObject();
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+TYPE *ArenaObject<TYPE>::object()
+{
+    BSLS_ASSERT(d_isConstructed);
+
+    return d_object.address();
+}
+
+template <class TYPE>
+inline
+void ArenaObject<TYPE>::reset()
+{
+    destroyObject();
+    d_arena.rewind();
+
+    bslma::ConstructionUtil::construct(d_object.address(), &d_arena);
+    d_isConstructed = true;
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+const TYPE& ArenaObject<TYPE>::object() const
+{
+    BSLS_ASSERT(d_isConstructed);
+
+    return d_object.object();
+}
+
+template <class TYPE>
+inline
+bslma::Allocator *ArenaObject<TYPE>::arena() const
+{
+    return const_cast<SequentialAllocator *>(&d_arena);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
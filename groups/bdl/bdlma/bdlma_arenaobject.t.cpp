@@ -0,0 +1,617 @@
+// bdlma_arenaobject.t.cpp                                            -*-C++-*-
+#include <bdlma_arenaobject.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_istriviallycopyable.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// 'bdlma::ArenaObject' is a class template holding an object constructed on
+// an owned 'bdlma::SequentialAllocator'.  We verify that the held object uses
+// the arena, that the arena uses the allocator supplied at construction, that
+// 'reset' destroys (only non-bitwise-copyable) objects and reclaims their
+// memory without returning it to the supplied allocator, and that an object
+// whose construction throws during 'reset' is not destroyed twice.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit ArenaObject(bslma::Allocator *basicAllocator = 0);
+// [ 2] explicit ArenaObject(int initialSize, bslma::Allocator *ba = 0);
+// [ 2] ~ArenaObject();
+//
+// MANIPULATORS
+// [ 2] TYPE *object();
+// [ 3] void reset();
+//
+// ACCESSORS
+// [ 2] const TYPE& object() const;
+// [ 2] bslma::Allocator *arena() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bsl::vector<bsl::string> Strings;
+typedef bdlma::ArenaObject<Strings> Obj;
+
+// ============================================================================
+//                               TEST APPARATUS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+class Counted {
+    // This allocator-aware class counts its constructions and destructions,
+    // and throws from its default constructor when requested.
+
+    // DATA
+    bslma::Allocator *d_allocator_p;  // held, not owned
+
+  public:
+    // CLASS DATA
+    static int  s_numConstructed;
+    static int  s_numDestroyed;
+    static bool s_throwOnConstruction;
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(Counted, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit Counted(bslma::Allocator *basicAllocator = 0)
+    : d_allocator_p(bslma::Default::allocator(basicAllocator))
+    {
+        if (s_throwOnConstruction) {
+            throw 1;
+        }
+        ++s_numConstructed;
+    }
+
+    ~Counted()
+    {
+        ++s_numDestroyed;
+    }
+
+    // ACCESSORS
+    bslma::Allocator *allocator() const
+    {
+        return d_allocator_p;
+    }
+};
+
+int  Counted::s_numConstructed      = 0;
+int  Counted::s_numDestroyed        = 0;
+bool Counted::s_throwOnConstruction = false;
+
+class Bitwise {
+    // This class has a destructor that counts its invocations, but is
+    // nevertheless declared to be bitwise copyable, so that its destructor
+    // need not be run.
+
+  public:
+    // CLASS DATA
+    static int s_numDestroyed;
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(Bitwise, bsl::is_trivially_copyable);
+
+    // CREATORS
+    ~Bitwise()
+    {
+        ++s_numDestroyed;
+    }
+};
+
+int Bitwise::s_numDestroyed = 0;
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Filling an Object Repeatedly
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose that we receive a stream of messages, each of which is parsed into a
+// vector of strings and then processed, and that we wish to avoid allocating
+// memory from the global allocator for every message.
+//
+// First, we define a function that "parses" a message into a vector of
+// strings, standing in for a decoder:
+//..
+    void parse(bsl::vector<bsl::string> *result, const char *message)
+        // Load into the specified 'result' the space-separated words of the
+        // specified 'message'.
+    {
+        result->clear();
+        const char *begin = message;
+        while (*begin) {
+            const char *end = begin;
+            while (*end && ' ' != *end) {
+                ++end;
+            }
+            result->push_back(bsl::string(begin, end));
+            begin = *end ? end + 1 : end;
+        }
+    }
+//..
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    (void)veryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Then, we create a 'bdlma::ArenaObject' holding the vector, supplying a test
+// allocator so that we can observe the memory the arena obtains:
+//..
+    bslma::TestAllocator ta;
+
+    bdlma::ArenaObject<bsl::vector<bsl::string> > message(&ta);
+//..
+// Next, we parse a few messages, calling 'reset' before each, so that all the
+// memory used by the previous message is reclaimed at once:
+//..
+    const char *MESSAGES[] = {
+        "a first message having more words than any of the others here",
+        "another message",
+        "the last message, which is also long, but not the longest"
+    };
+
+    for (int i = 0; i < 3; ++i) {
+        message.reset();
+        parse(message.object(), MESSAGES[i]);
+    }
+    ASSERT(11 == message.object()->size());
+//..
+// Finally, we observe that, once the arena has grown to accommodate the
+// messages, parsing more messages obtains no more memory from 'ta':
+//..
+    const bsls::Types::Int64 numAllocations = ta.numAllocations();
+
+    for (int i = 0; i < 100; ++i) {
+        message.reset();
+        parse(message.object(), MESSAGES[i % 3]);
+    }
+    ASSERT(numAllocations == ta.numAllocations());
+//..
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'reset'
+        //
+        // Concerns:
+        //: 1 'reset' destroys the held object and constructs a new one, with
+        //:   the default value, on the arena.
+        //:
+        //: 2 No destructor is run for a bitwise-copyable 'TYPE'.
+        //:
+        //: 3 Memory used by the previous object is reused, and is not returned
+        //:   to the allocator supplied at construction.
+        //:
+        //: 4 Once the arena has grown large enough, filling and resetting the
+        //:   object obtains no memory from the supplied allocator.
+        //:
+        //: 5 If constructing the new object throws, the previous object is
+        //:   not destroyed again, either by 'reset' or by the destructor.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Use 'Counted' to observe constructions and destructions across
+        //:   calls to 'reset'.  (C-1)
+        //:
+        //: 2 Use 'Bitwise' to observe that no destructor is run.  (C-2)
+        //:
+        //: 3 Fill a vector of strings, reset, and refill it, checking the
+        //:   supplied test allocator's counts.  (C-3..4)
+        //:
+        //: 4 Make the construction of 'Counted' throw during 'reset', then
+        //:   check the destruction count after further 'reset' calls and
+        //:   after destruction.  (C-5)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered by calling 'object' after a throwing 'reset'.  (C-6)
+        //
+        // Testing:
+        //   void reset();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'reset'" << endl
+                          << "===============" << endl;
+
+        bslma::TestAllocator sa("supplied", veryVeryVerbose);
+
+        if (verbose) cout << "\nConstruction and destruction." << endl;
+        {
+            Counted::s_numConstructed = 0;
+            Counted::s_numDestroyed   = 0;
+            {
+                bdlma::ArenaObject<Counted> mX(&sa);
+
+                ASSERT(1 == Counted::s_numConstructed);
+                ASSERT(0 == Counted::s_numDestroyed);
+
+                mX.reset();
+
+                ASSERT(2 == Counted::s_numConstructed);
+                ASSERT(1 == Counted::s_numDestroyed);
+                ASSERT(mX.arena() == mX.object()->allocator());
+            }
+            ASSERT(2 == Counted::s_numDestroyed);
+        }
+
+        if (verbose) cout << "\nBitwise-copyable type." << endl;
+        {
+            Bitwise::s_numDestroyed = 0;
+            {
+                bdlma::ArenaObject<Bitwise> mX(&sa);
+
+                mX.reset();
+                mX.reset();
+            }
+            ASSERT(0 == Bitwise::s_numDestroyed);
+        }
+
+        if (verbose) cout << "\nMemory reuse." << endl;
+        {
+            const bsl::string LONG(
+                         "a string long enough not to fit in the short buffer",
+                         &sa);
+
+            Obj mX(&sa);  const Obj& X = mX;
+
+            for (int i = 0; i < 64; ++i) {
+                mX.object()->push_back(LONG);
+            }
+            const bsls::Types::Int64 numBlocks = sa.numBlocksInUse();
+            const bsls::Types::Int64 numBytes  = sa.numBytesInUse();
+
+            mX.reset();
+
+            ASSERT(X.object().empty());
+            ASSERT(X.object().get_allocator().mechanism() == X.arena());
+            ASSERTV(numBytes, sa.numBytesInUse(),
+                    numBytes == sa.numBytesInUse());
+
+            const bsls::Types::Int64 numAllocations = sa.numAllocations();
+
+            for (int j = 0; j < 10; ++j) {
+                for (int i = 0; i < 64; ++i) {
+                    mX.object()->push_back(LONG);
+                }
+                ASSERT(64 == X.object().size());
+                mX.reset();
+            }
+            ASSERTV(numAllocations, sa.numAllocations(),
+                    numAllocations == sa.numAllocations());
+            ASSERT(numBlocks >= sa.numBlocksInUse());
+        }
+        ASSERT(0 == sa.numBytesInUse());
+
+#ifdef BDE_BUILD_TARGET_EXC
+        if (verbose) cout << "\nThrowing construction." << endl;
+        {
+            Counted::s_numConstructed = 0;
+            Counted::s_numDestroyed   = 0;
+            {
+                bdlma::ArenaObject<Counted> mX(&sa);
+
+                Counted::s_throwOnConstruction = true;
+                bool caught = false;
+                try {
+                    mX.reset();
+                }
+                catch (int) {
+                    caught = true;
+                }
+                Counted::s_throwOnConstruction = false;
+
+                ASSERT(caught);
+                ASSERT(1 == Counted::s_numConstructed);
+                ASSERT(1 == Counted::s_numDestroyed);
+
+                if (verbose) cout << "\nNegative Testing." << endl;
+                {
+                    bsls::AssertTestHandlerGuard hG;
+
+                    const bdlma::ArenaObject<Counted>& X = mX;
+
+                    ASSERT_FAIL(mX.object());
+                    ASSERT_FAIL(X.object());
+                }
+
+                mX.reset();
+
+                ASSERT(2 == Counted::s_numConstructed);
+                ASSERT(1 == Counted::s_numDestroyed);
+
+                Counted::s_throwOnConstruction = true;
+                try {
+                    mX.reset();
+                }
+                catch (int) {
+                }
+                Counted::s_throwOnConstruction = false;
+
+                ASSERT(2 == Counted::s_numDestroyed);
+            }
+            ASSERT(2 == Counted::s_numDestroyed);
+        }
+        ASSERT(0 == sa.numBytesInUse());
+#endif
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 The held object is default constructed using the arena.
+        //:
+        //: 2 The arena obtains its memory from the allocator supplied at
+        //:   construction, or from the default allocator if none is supplied.
+        //:
+        //: 3 An 'initialSize' is honored.
+        //:
+        //: 4 All memory is released on destruction.
+        //
+        // Plan:
+        //: 1 Create objects using each constructor, with and without an
+        //:   allocator, fill the held vector, and check the allocators used.
+        //:   (C-1..4)
+        //
+        // Testing:
+        //   explicit ArenaObject(bslma::Allocator *basicAllocator = 0);
+        //   explicit ArenaObject(int initialSize, bslma::Allocator *ba = 0);
+        //   ~ArenaObject();
+        //   TYPE *object();
+        //   const TYPE& object() const;
+        //   bslma::Allocator *arena() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND ACCESSORS" << endl
+                          << "======================" << endl;
+
+        bslma::TestAllocator sa("supplied", veryVeryVerbose);
+
+        for (char cfg = 'a'; cfg <= 'd'; ++cfg) {
+            const char CONFIG = cfg;
+
+            if (veryVerbose) { T_ P(CONFIG) }
+
+            Obj *objPtr = 0;
+            bslma::TestAllocator *objAllocatorPtr = 0;
+
+            switch (CONFIG) {
+              case 'a': {
+                objPtr          = new Obj();
+                objAllocatorPtr = &defaultAllocator;
+              } break;
+              case 'b': {
+                objPtr          = new Obj(&sa);
+                objAllocatorPtr = &sa;
+              } break;
+              case 'c': {
+                objPtr          = new Obj(4096);
+                objAllocatorPtr = &defaultAllocator;
+              } break;
+              case 'd': {
+                objPtr          = new Obj(4096, &sa);
+                objAllocatorPtr = &sa;
+              } break;
+            }
+
+            Obj& mX = *objPtr;  const Obj& X = mX;
+
+            bslma::TestAllocator& oa = *objAllocatorPtr;
+
+            ASSERTV(CONFIG, X.arena());
+            ASSERTV(CONFIG, X.object().empty());
+            ASSERTV(CONFIG, &X.object() == mX.object());
+            ASSERTV(CONFIG,
+                    X.object().get_allocator().mechanism() == X.arena());
+
+            if ('c' <= CONFIG) {
+                ASSERTV(CONFIG, oa.numBytesInUse(),
+                        4096 <= oa.numBytesInUse());
+            }
+
+            mX.object()->push_back("a string too long for the short buffer");
+            mX.object()->push_back("another");
+
+            ASSERTV(CONFIG, 2 == X.object().size());
+            ASSERTV(CONFIG, X.object()[0].get_allocator().mechanism() ==
+                                                                  X.arena());
+            ASSERTV(CONFIG, 0 < oa.numBytesInUse());
+
+            delete objPtr;
+
+            ASSERTV(CONFIG, 0 == oa.numBytesInUse());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Fill, reset, and refill a held vector of strings.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator sa("supplied", veryVeryVerbose);
+        {
+            Obj mX(&sa);  const Obj& X = mX;
+
+            ASSERT(X.object().empty());
+
+            mX.object()->push_back("hello");
+            mX.object()->push_back("world");
+            ASSERT(2 == X.object().size());
+
+            mX.reset();
+            ASSERT(X.object().empty());
+
+            mX.object()->push_back("again");
+            ASSERT(1       == X.object().size());
+            ASSERT("again" == X.object()[0]);
+        }
+        ASSERT(0 == sa.numBytesInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
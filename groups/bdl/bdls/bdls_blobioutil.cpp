@@ -0,0 +1,319 @@
+// bdls_blobioutil.cpp                                                -*-C++-*-
+#include <bdls_blobioutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdls_blobioutil_cpp,"$Id$ $CSID$")
+
+#include <bdlbb_blobutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_utility.h>
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+#include <bsl_c_errno.h>
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
+namespace BloombergLP {
+namespace {
+namespace u {
+
+using namespace bdls;
+
+typedef BlobIoUtil::FileDescriptor FileDescriptor;
+typedef BlobIoUtil::Offset         Offset;
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+
+int readSome(FileDescriptor     descriptor,
+             const bdlbb::Blob& blob,
+             int                position,
+             int                length)
+    // Read at most the specified 'length' bytes from the file having the
+    // specified 'descriptor' into the buffers of the specified 'blob' starting
+    // at the specified 'position', using a single successful system call.
+    // Return the number of bytes read, 0 on end-of-file, or a negative value
+    // on error.
+{
+    struct iovec vectors[BlobIoUtil::k_MAX_IO_VECTORS];
+    const int    numVectors = BlobIoUtil::loadIoVectors(
+                                                  vectors,
+                                                  BlobIoUtil::k_MAX_IO_VECTORS,
+                                                  blob,
+                                                  position,
+                                                  length);
+    ssize_t rc;
+    do {
+        rc = ::readv(descriptor, vectors, numVectors);
+    } while (rc < 0 && EINTR == errno);
+
+    return static_cast<int>(rc);
+}
+
+int writeSome(FileDescriptor     descriptor,
+              Offset             fileOffset,
+              const bdlbb::Blob& blob,
+              int                position,
+              int                length)
+    // Write at most the specified 'length' bytes starting at the specified
+    // 'position' in the specified 'blob' to the file having the specified
+    // 'descriptor', using a single successful system call.  Write at the
+    // current file position if the specified 'fileOffset' is negative, and at
+    // 'fileOffset' otherwise.  Return the number of bytes written, or a
+    // negative value on error.
+{
+    struct iovec vectors[BlobIoUtil::k_MAX_IO_VECTORS];
+    const int    numVectors = BlobIoUtil::loadIoVectors(
+                                                  vectors,
+                                                  BlobIoUtil::k_MAX_IO_VECTORS,
+                                                  blob,
+                                                  position,
+                                                  length);
+    ssize_t rc;
+    do {
+        if (fileOffset < 0) {
+            rc = ::writev(descriptor, vectors, numVectors);
+        }
+        else {
+#if defined(BSLS_PLATFORM_OS_LINUX)
+            rc = ::pwritev(descriptor,
+                           vectors,
+                           numVectors,
+                           static_cast<off_t>(fileOffset));
+#else
+            // 'pwritev' is not universally available; write only the first
+            // segment, and let the caller resume with the remainder.
+
+            rc = ::pwrite(descriptor,
+                          vectors[0].iov_base,
+                          vectors[0].iov_len,
+                          static_cast<off_t>(fileOffset));
+#endif
+        }
+    } while (rc < 0 && EINTR == errno);
+
+    return static_cast<int>(rc);
+}
+
+#else  // Windows
+
+bsl::pair<char *, int> firstSegment(const bdlbb::Blob& blob,
+                                    int                position,
+                                    int                length)
+    // Return the address and length of the longest contiguous segment of the
+    // specified 'blob' that starts at the specified 'position' and extends no
+    // further than the specified 'length' bytes.
+{
+    bsl::pair<int, int> place = bdlbb::BlobUtil::findBufferIndexAndOffset(
+                                                                     blob,
+                                                                     position);
+    const bdlbb::BlobBuffer& buffer = blob.buffer(place.first);
+
+    return bsl::make_pair(buffer.data() + place.second,
+                          bsl::min(length, buffer.size() - place.second));
+}
+
+int readSome(FileDescriptor     descriptor,
+             const bdlbb::Blob& blob,
+             int                position,
+             int                length)
+{
+    bsl::pair<char *, int> segment = firstSegment(blob, position, length);
+
+    return FilesystemUtil::read(descriptor, segment.first, segment.second);
+}
+
+int writeSome(FileDescriptor     descriptor,
+              Offset             fileOffset,
+              const bdlbb::Blob& blob,
+              int                position,
+              int                length)
+{
+    bsl::pair<char *, int> segment = firstSegment(blob, position, length);
+
+    if (0 <= fileOffset && fileOffset != FilesystemUtil::seek(
+                                         descriptor,
+                                         fileOffset,
+                                         FilesystemUtil::e_SEEK_FROM_BEGINNING)) {
+        return -1;                                                    // RETURN
+    }
+
+    return FilesystemUtil::write(descriptor, segment.first, segment.second);
+}
+
+#endif
+
+int writeAll(FileDescriptor     descriptor,
+             Offset             fileOffset,
+             const bdlbb::Blob& blob,
+             int                position,
+             int                length)
+    // Write the specified 'length' bytes starting at the specified 'position'
+    // in the specified 'blob' to the file having the specified 'descriptor',
+    // at the current file position if the specified 'fileOffset' is negative,
+    // and at 'fileOffset' otherwise, resuming after short writes.  Return the
+    // number of bytes written, or a negative value if an error occurred
+    // before any bytes were written.
+{
+    int numWritten = 0;
+
+    while (numWritten < length) {
+        const int rc = writeSome(descriptor,
+                                 fileOffset < 0 ? fileOffset
+                                                : fileOffset + numWritten,
+                                 blob,
+                                 position + numWritten,
+                                 length - numWritten);
+        if (rc <= 0) {
+            return 0 == numWritten && rc < 0 ? rc : numWritten;      // RETURN
+        }
+        numWritten += rc;
+    }
+
+    return numWritten;
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+namespace bdls {
+
+                              // -----------------
+                              // struct BlobIoUtil
+                              // -----------------
+
+// CLASS METHODS
+#ifdef BSLS_PLATFORM_OS_UNIX
+int BlobIoUtil::loadIoVectors(struct iovec       *vectors,
+                              int                 maxNumVectors,
+                              const bdlbb::Blob&  blob,
+                              int                 position,
+                              int                 length)
+{
+    BSLS_ASSERT(vectors);
+    BSLS_ASSERT(0 < maxNumVectors);
+    BSLS_ASSERT(0 <= position);
+    BSLS_ASSERT(0 <= length);
+    BSLS_ASSERT(position <= blob.length() - length);
+
+    if (0 == length) {
+        return 0;                                                     // RETURN
+    }
+
+    bsl::pair<int, int> place = bdlbb::BlobUtil::findBufferIndexAndOffset(
+                                                                     blob,
+                                                                     position);
+    int index      = place.first;
+    int offset     = place.second;
+    int numVectors = 0;
+
+    while (0 < length && numVectors < maxNumVectors) {
+        const bdlbb::BlobBuffer& buffer = blob.buffer(index);
+        const int                size   = bsl::min(length,
+                                                   buffer.size() - offset);
+        if (0 < size) {
+            vectors[numVectors].iov_base = buffer.data() + offset;
+            vectors[numVectors].iov_len  = size;
+            ++numVectors;
+            length -= size;
+        }
+        offset = 0;
+        ++index;
+    }
+
+    return numVectors;
+}
+#endif
+
+int BlobIoUtil::read(bdlbb::Blob    *blob,
+                     FileDescriptor  descriptor,
+                     int             numBytes)
+{
+    BSLS_ASSERT(blob);
+    BSLS_ASSERT(0 <= numBytes);
+
+    const int startLength = blob->length();
+
+    blob->setLength(startLength + numBytes);
+
+    int numRead = 0;
+    int rc      = 0;
+
+    while (numRead < numBytes) {
+        rc = u::readSome(descriptor,
+                         *blob,
+                         startLength + numRead,
+                         numBytes - numRead);
+        if (rc <= 0) {
+            break;
+        }
+        numRead += rc;
+    }
+
+    blob->setLength(startLength + numRead);
+
+    return 0 == numRead && rc < 0 ? rc : numRead;
+}
+
+int BlobIoUtil::write(FileDescriptor descriptor, const bdlbb::Blob& blob)
+{
+    return u::writeAll(descriptor, -1, blob, 0, blob.length());
+}
+
+int BlobIoUtil::write(FileDescriptor     descriptor,
+                      const bdlbb::Blob& blob,
+                      int                position,
+                      int                length)
+{
+    BSLS_ASSERT(0 <= position);
+    BSLS_ASSERT(0 <= length);
+    BSLS_ASSERT(position <= blob.length() - length);
+
+    return u::writeAll(descriptor, -1, blob, position, length);
+}
+
+int BlobIoUtil::writeAt(FileDescriptor     descriptor,
+                        Offset             fileOffset,
+                        const bdlbb::Blob& blob)
+{
+    BSLS_ASSERT(0 <= fileOffset);
+
+    return u::writeAll(descriptor, fileOffset, blob, 0, blob.length());
+}
+
+int BlobIoUtil::writeAt(FileDescriptor     descriptor,
+                        Offset             fileOffset,
+                        const bdlbb::Blob& blob,
+                        int                position,
+                        int                length)
+{
+    BSLS_ASSERT(0 <= fileOffset);
+    BSLS_ASSERT(0 <= position);
+    BSLS_ASSERT(0 <= length);
+    BSLS_ASSERT(position <= blob.length() - length);
+
+    return u::writeAll(descriptor, fileOffset, blob, position, length);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
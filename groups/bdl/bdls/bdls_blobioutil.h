@@ -0,0 +1,229 @@
+// bdls_blobioutil.h                                                  -*-C++-*-
+#ifndef INCLUDED_BDLS_BLOBIOUTIL
+#define INCLUDED_BDLS_BLOBIOUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide scatter/gather I/O between 'bdlbb::Blob' and files.
+//
+//@CLASSES:
+//  bdls::BlobIoUtil: namespace for vectored blob I/O on file descriptors
+//
+//@SEE_ALSO: bdlbb_blob, bdlbb_blobutil, bdls_filesystemutil
+//
+//@DESCRIPTION: This component provides a namespace, 'bdls::BlobIoUtil',
+// containing functions that transfer data between a 'bdlbb::Blob' and a file
+// descriptor (as obtained from 'bdls::FilesystemUtil::open', or any other
+// native descriptor such as a pipe) without first flattening the blob into a
+// contiguous buffer.
+//
+// A 'bdlbb::Blob' is a sequence of separately allocated buffers.  Writing a
+// blob with 'bdls::FilesystemUtil::write' requires either copying the blob
+// into a contiguous buffer (e.g., with 'bdlbb::BlobUtil::copy'), or issuing
+// one system call per buffer.  The functions in this component instead
+// describe the blob's buffers to the operating system directly, using
+// 'writev', 'pwritev', and 'readv' on Unix platforms, so that an entire blob
+// (or any byte range of it) is transferred with a single system call in the
+// common case.
+//
+///Short Transfers
+///---------------
+// The operating system may transfer fewer bytes than requested (e.g., when
+// writing to a pipe or socket, or when a call is interrupted by a signal).
+// The 'write' and 'writeAt' functions resume from the position at which a
+// short transfer stopped, until either all of the requested bytes have been
+// written or no further progress can be made.  Similarly, 'read' keeps
+// reading until the requested number of bytes has been read or end-of-file is
+// reached.
+//
+///Platform-Specific Behavior
+///--------------------------
+// On Unix platforms the number of buffers described to the operating system
+// by a single call is bounded by 'k_MAX_IO_VECTORS'; blobs having more
+// buffers are transferred using several calls.  On Windows, where vectored
+// I/O is not generally available for regular files, each blob buffer is
+// transferred with a separate call; the observable behavior is otherwise the
+// same.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Appending a Blob to a Journal File
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a message has been serialized into a 'bdlbb::Blob', and must
+// be appended to a journal file.  First, we create the blob, whose buffers of
+// 8 bytes each are provided by a 'bdlbb::SimpleBlobBufferFactory':
+//..
+//  bdlbb::SimpleBlobBufferFactory factory(8);
+//  bdlbb::Blob                    blob(&factory);
+//
+//  const char MESSAGE[] = "Scatter/gather I/O avoids flattening the blob.";
+//  const int  LENGTH    = static_cast<int>(sizeof MESSAGE - 1);
+//
+//  bdlbb::BlobUtil::append(&blob, MESSAGE, LENGTH);
+//  assert(1 < blob.numDataBuffers());
+//..
+// Then, we open the journal file:
+//..
+//  typedef bdls::FilesystemUtil FsUtil;
+//
+//  FsUtil::FileDescriptor fd = FsUtil::open(fileName,
+//                                           FsUtil::e_OPEN_OR_CREATE,
+//                                           FsUtil::e_READ_APPEND);
+//  assert(FsUtil::k_INVALID_FD != fd);
+//..
+// Next, we write the whole blob to the file, without copying its contents:
+//..
+//  int rc = bdls::BlobIoUtil::write(fd, blob);
+//  assert(LENGTH == rc);
+//..
+// Now, we rewind the file and read the message back into a second blob,
+// which obtains its buffers from the same factory:
+//..
+//  FsUtil::seek(fd, 0, FsUtil::e_SEEK_FROM_BEGINNING);
+//
+//  bdlbb::Blob copy(&factory);
+//
+//  rc = bdls::BlobIoUtil::read(&copy, fd, LENGTH);
+//  assert(LENGTH == rc);
+//  assert(0      == bdlbb::BlobUtil::compare(blob, copy));
+//..
+// Finally, we close the file:
+//..
+//  FsUtil::close(fd);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdls_filesystemutil.h>
+
+#include <bdlbb_blob.h>
+
+#include <bsls_platform.h>
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+#include <sys/uio.h>
+#endif
+
+namespace BloombergLP {
+namespace bdls {
+
+                              // =================
+                              // struct BlobIoUtil
+                              // =================
+
+struct BlobIoUtil {
+    // This 'struct' provides a namespace for utility functions that perform
+    // vectored (scatter/gather) I/O between 'bdlbb::Blob' objects and file
+    // descriptors.
+
+    // TYPES
+    typedef FilesystemUtil::FileDescriptor FileDescriptor;
+        // 'FileDescriptor' is an alias for the operating system's native file
+        // descriptor / file handle type.
+
+    typedef FilesystemUtil::Offset Offset;
+        // 'Offset' is an alias for a signed value, representing the offset of
+        // a location within a file.
+
+    // CONSTANTS
+    enum { k_MAX_IO_VECTORS = 64 };
+        // Maximum number of I/O vectors described to the operating system by
+        // a single system call.
+
+    // CLASS METHODS
+#ifdef BSLS_PLATFORM_OS_UNIX
+    static int loadIoVectors(struct iovec       *vectors,
+                             int                 maxNumVectors,
+                             const bdlbb::Blob&  blob,
+                             int                 position,
+                             int                 length);
+        // Load into the specified 'vectors' array, having room for at most the
+        // specified 'maxNumVectors' elements, a description of the data
+        // buffers of the specified 'blob' holding the specified 'length' bytes
+        // starting at the specified 'position' in 'blob'.  Return the number
+        // of elements loaded.  If 'maxNumVectors' elements are not sufficient
+        // to describe the entire range, the loaded elements describe a prefix
+        // of the range.  Zero-size buffers are skipped.  The behavior is
+        // undefined unless '0 < maxNumVectors', '0 <= position',
+        // '0 <= length', and 'position + length <= blob.length()'.  Note that
+        // the loaded elements refer to the buffers of 'blob', and are
+        // invalidated by any subsequent modification of 'blob'.
+#endif
+
+    static int read(bdlbb::Blob    *blob,
+                    FileDescriptor  descriptor,
+                    int             numBytes);
+        // Read at most the specified 'numBytes' from the current position of
+        // the file having the specified 'descriptor', and append them to the
+        // specified 'blob', growing 'blob' with buffers obtained from its blob
+        // buffer factory as needed.  Return the number of bytes read, which is
+        // less than 'numBytes' only if end-of-file was reached or no further
+        // progress could be made, or a negative value if an error occurred
+        // before any bytes were read.  On return, the length of 'blob' has
+        // been increased by the number of bytes read.  Note that buffers
+        // allocated for bytes that could not be read remain in 'blob' as
+        // unused capacity.  The behavior is undefined unless
+        // '0 <= numBytes', and 'blob' was supplied a blob buffer factory at
+        // construction or already has sufficient capacity for 'numBytes'
+        // additional bytes.
+
+    static int write(FileDescriptor descriptor, const bdlbb::Blob& blob);
+    static int write(FileDescriptor     descriptor,
+                     const bdlbb::Blob& blob,
+                     int                position,
+                     int                length);
+        // Write the data of the specified 'blob' (or, if specified, the
+        // 'length' bytes starting at the specified 'position' in 'blob') at
+        // the current position of the file having the specified 'descriptor'.
+        // Return the number of bytes requested to be written on success; the
+        // number of bytes written if no further progress could be made (e.g.,
+        // because space was exhausted); or a negative value if an error
+        // occurred before any bytes were written.  The behavior is undefined
+        // unless '0 <= position', '0 <= length', and
+        // 'position + length <= blob.length()'.
+
+    static int writeAt(FileDescriptor     descriptor,
+                       Offset             fileOffset,
+                       const bdlbb::Blob& blob);
+    static int writeAt(FileDescriptor     descriptor,
+                       Offset             fileOffset,
+                       const bdlbb::Blob& blob,
+                       int                position,
+                       int                length);
+        // Write the data of the specified 'blob' (or, if specified, the
+        // 'length' bytes starting at the specified 'position' in 'blob') at
+        // the specified 'fileOffset' of the file having the specified
+        // 'descriptor', without using or updating the current position of the
+        // file on Unix platforms.  Return the number of bytes requested to be
+        // written on success; the number of bytes written if no further
+        // progress could be made; or a negative value if an error occurred
+        // before any bytes were written.  The behavior is undefined unless
+        // '0 <= fileOffset', '0 <= position', '0 <= length',
+        // 'position + length <= blob.length()', and 'descriptor' refers to a
+        // file capable of seeking.  Note that on Windows the current position
+        // of the file is unspecified after this call.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,746 @@
+// bdls_blobioutil.t.cpp                                              -*-C++-*-
+#include <bdls_blobioutil.h>
+
+#include <bdls_filesystemutil.h>
+#include <bdls_pathutil.h>
+
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_simpleblobbufferfactory.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_platform.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+#include <unistd.h>
+#else
+#include <windows.h>
+#endif
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a utility that performs vectored I/O between a
+// 'bdlbb::Blob' and a file descriptor.  We test that the I/O vectors loaded
+// for every sub-range of blobs having various buffer layouts describe exactly
+// the requested bytes, and that 'write', 'writeAt', and 'read' transfer every
+// sub-range correctly through a temporary file.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] int loadIoVectors(iovec *, int, const Blob&, int, int);
+// [ 3] int write(FileDescriptor, const Blob&);
+// [ 3] int write(FileDescriptor, const Blob&, int, int);
+// [ 3] int writeAt(FileDescriptor, Offset, const Blob&);
+// [ 3] int writeAt(FileDescriptor, Offset, const Blob&, int, int);
+// [ 4] int read(Blob *, FileDescriptor, int);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdls::BlobIoUtil     Obj;
+typedef bdls::FilesystemUtil FsUtil;
+
+static const char DATA[] = "The quick brown fox jumps over the lazy dog; "
+                           "pack my box with five dozen liquor jugs!";
+static const int  DATA_LENGTH = static_cast<int>(sizeof DATA - 1);
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int localGetPId()
+    // Return the process id of the current process.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return static_cast<int>(GetCurrentProcessId());
+#else
+    return static_cast<int>(getpid());
+#endif
+}
+
+void makeBlob(bdlbb::Blob *result, const char *spec, const char *data)
+    // Load into the specified 'result' a blob whose buffers have the sizes
+    // indicated by the specified 'spec', and whose data are the leading bytes
+    // of the specified 'data'.  Each character of 'spec' is a decimal digit
+    // giving the size of one buffer; a '|' marks the end of the data buffers,
+    // and subsequent buffers are capacity only.
+{
+    result->removeAll();
+
+    bslma::Allocator *allocator = bslma::Default::defaultAllocator();
+    int               length    = 0;
+    bool              inData    = true;
+
+    for (const char *p = spec; *p; ++p) {
+        if ('|' == *p) {
+            inData = false;
+            continue;
+        }
+        const int             size = *p - '0';
+        bsl::shared_ptr<char> buffer(
+                    static_cast<char *>(allocator->allocate(size ? size : 1)),
+                    allocator);
+        bsl::memset(buffer.get(), '#', size ? size : 1);
+        result->appendBuffer(bdlbb::BlobBuffer(buffer, size));
+        if (inData) {
+            length += size;
+        }
+    }
+    result->setLength(length);
+    if (length) {
+        bdlbb::BlobUtil::copy(result, 0, data, length);
+    }
+}
+
+FsUtil::FileDescriptor reopenEmpty(FsUtil::FileDescriptor  fd,
+                                   const bsl::string&      fileName)
+    // Close the specified 'fd', if valid, and return a descriptor, open for
+    // reading and writing, to the emptied file having the specified
+    // 'fileName'.
+{
+    if (FsUtil::k_INVALID_FD != fd) {
+        FsUtil::close(fd);
+    }
+    return FsUtil::open(fileName,
+                        FsUtil::e_OPEN_OR_CREATE,
+                        FsUtil::e_READ_WRITE,
+                        FsUtil::e_TRUNCATE);
+}
+
+bsl::string readFile(FsUtil::FileDescriptor fd)
+    // Return the entire contents of the file having the specified 'fd', and
+    // leave the file position at the end of the file.
+{
+    bsl::string result;
+    char        buffer[256];
+
+    FsUtil::seek(fd, 0, FsUtil::e_SEEK_FROM_BEGINNING);
+    for (int rc; 0 < (rc = FsUtil::read(fd, buffer, sizeof buffer)); ) {
+        result.append(buffer, rc);
+    }
+    return result;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test        = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    const bool verbose     = argc > 2;
+    const bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    bsl::string fileName;
+    {
+        bsl::ostringstream oss;
+        oss << "tmp.bdls_blobioutil." << test << '.' << localGetPId();
+        fileName = oss.str();
+    }
+    FsUtil::remove(fileName);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Appending a Blob to a Journal File
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a message has been serialized into a 'bdlbb::Blob', and must
+// be appended to a journal file.  First, we create the blob, whose buffers of
+// 8 bytes each are provided by a 'bdlbb::SimpleBlobBufferFactory':
+//..
+    bdlbb::SimpleBlobBufferFactory factory(8);
+    bdlbb::Blob                    blob(&factory);
+
+    const char MESSAGE[] = "Scatter/gather I/O avoids flattening the blob.";
+    const int  LENGTH    = static_cast<int>(sizeof MESSAGE - 1);
+
+    bdlbb::BlobUtil::append(&blob, MESSAGE, LENGTH);
+    ASSERT(1 < blob.numDataBuffers());
+//..
+// Then, we open the journal file:
+//..
+    typedef bdls::FilesystemUtil FsUtil;
+
+    FsUtil::FileDescriptor fd = FsUtil::open(fileName,
+                                             FsUtil::e_OPEN_OR_CREATE,
+                                             FsUtil::e_READ_APPEND);
+    ASSERT(FsUtil::k_INVALID_FD != fd);
+//..
+// Next, we write the whole blob to the file, without copying its contents:
+//..
+    int rc = bdls::BlobIoUtil::write(fd, blob);
+    ASSERT(LENGTH == rc);
+//..
+// Now, we rewind the file and read the message back into a second blob,
+// which obtains its buffers from the same factory:
+//..
+    FsUtil::seek(fd, 0, FsUtil::e_SEEK_FROM_BEGINNING);
+
+    bdlbb::Blob copy(&factory);
+
+    rc = bdls::BlobIoUtil::read(&copy, fd, LENGTH);
+    ASSERT(LENGTH == rc);
+    ASSERT(0      == bdlbb::BlobUtil::compare(blob, copy));
+//..
+// Finally, we close the file:
+//..
+    FsUtil::close(fd);
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'read'
+        //
+        // Concerns:
+        //: 1 'read' appends the bytes read after the existing data of the
+        //:   blob, using existing capacity before allocating new buffers.
+        //:
+        //: 2 'read' returns fewer bytes than requested only at end-of-file,
+        //:   and the blob length reflects the number of bytes read.
+        //:
+        //: 3 Reading more bytes than 'k_MAX_IO_VECTORS' buffers can hold
+        //:   completes correctly.
+        //:
+        //: 4 'read' returns a negative value on error.
+        //
+        // Plan:
+        //: 1 Write 'DATA' to a file and read it back, in pieces of varying
+        //:   sizes, into blobs using factories of various buffer sizes, with
+        //:   and without initial data and capacity.  (C-1..2)
+        //:
+        //: 2 Read a large file through a factory with 1-byte buffers.  (C-3)
+        //:
+        //: 3 Read from an invalid descriptor.  (C-4)
+        //
+        // Testing:
+        //   int read(Blob *, FileDescriptor, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'read'" << endl
+                          << "==============" << endl;
+
+        FsUtil::FileDescriptor fd = FsUtil::open(fileName,
+                                                 FsUtil::e_OPEN_OR_CREATE,
+                                                 FsUtil::e_READ_WRITE);
+        ASSERT(FsUtil::k_INVALID_FD != fd);
+        ASSERT(DATA_LENGTH == FsUtil::write(fd, DATA, DATA_LENGTH));
+
+        for (int bufSize = 1; bufSize <= 17; bufSize += 4) {
+            bdlbb::SimpleBlobBufferFactory factory(bufSize);
+
+            for (int prefix = 0; prefix < 3; ++prefix) {
+            for (int chunk = 1; chunk <= DATA_LENGTH + 5; chunk += 7) {
+                if (veryVerbose) { T_ P_(bufSize) P_(prefix) P(chunk) }
+
+                bdlbb::Blob blob(&factory);
+                bdlbb::BlobUtil::append(&blob, "<<", prefix);
+                if (prefix) {
+                    blob.appendBuffer(bdlbb::BlobBuffer(
+                                 bsl::shared_ptr<char>(new char[3],
+                                                       bsl::default_delete<
+                                                                 char[]>()),
+                                 3));
+                }
+
+                FsUtil::seek(fd, 0, FsUtil::e_SEEK_FROM_BEGINNING);
+
+                int total = 0;
+                int rc;
+                while (0 < (rc = Obj::read(&blob, fd, chunk))) {
+                    ASSERTV(bufSize, chunk, rc,
+                            rc == chunk || total + rc == DATA_LENGTH);
+                    total += rc;
+                    ASSERTV(bufSize, chunk, prefix + total == blob.length());
+                }
+                ASSERTV(bufSize, chunk, rc, 0 == rc);
+                ASSERTV(bufSize, chunk, total, DATA_LENGTH == total);
+
+                bsl::string result(blob.length(), '\0');
+                bdlbb::BlobUtil::copy(&result[0], blob, 0, blob.length());
+                ASSERTV(bufSize, chunk, result,
+                        bsl::string("<<", prefix) + DATA == result);
+            }
+            }
+        }
+
+        if (verbose) cout << "\tMore than 'k_MAX_IO_VECTORS' buffers." << endl;
+        {
+            const int SIZE = Obj::k_MAX_IO_VECTORS * 3 + 7;
+
+            bsl::string expected;
+            for (int i = 0; i < SIZE; ++i) {
+                expected.push_back(static_cast<char>('a' + i % 26));
+            }
+            fd = reopenEmpty(fd, fileName);
+            ASSERT(SIZE == FsUtil::write(fd, expected.data(), SIZE));
+            FsUtil::seek(fd, 0, FsUtil::e_SEEK_FROM_BEGINNING);
+
+            bdlbb::SimpleBlobBufferFactory factory(1);
+            bdlbb::Blob                    blob(&factory);
+
+            ASSERT(SIZE == Obj::read(&blob, fd, SIZE));
+            ASSERT(SIZE == blob.length());
+            ASSERT(SIZE == blob.numDataBuffers());
+
+            bsl::string result(SIZE, '\0');
+            bdlbb::BlobUtil::copy(&result[0], blob, 0, SIZE);
+            ASSERT(expected == result);
+        }
+
+        FsUtil::close(fd);
+
+        if (verbose) cout << "\tReading from an invalid descriptor." << endl;
+        {
+            bdlbb::SimpleBlobBufferFactory factory(8);
+            bdlbb::Blob                    blob(&factory);
+
+            ASSERT(0 >  Obj::read(&blob, FsUtil::k_INVALID_FD, 5));
+            ASSERT(0 == blob.length());
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bdlbb::SimpleBlobBufferFactory factory(8);
+            bdlbb::Blob                    blob(&factory);
+
+            ASSERT_FAIL(Obj::read(0,     FsUtil::k_INVALID_FD,  0));
+            ASSERT_FAIL(Obj::read(&blob, FsUtil::k_INVALID_FD, -1));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'write' AND 'writeAt'
+        //
+        // Concerns:
+        //: 1 'write' writes exactly the requested range of the blob at the
+        //:   current file position, and advances the file position.
+        //:
+        //: 2 'writeAt' writes exactly the requested range of the blob at the
+        //:   requested file offset.
+        //:
+        //: 3 Ranges spanning more than 'k_MAX_IO_VECTORS' buffers are
+        //:   written completely.
+        //:
+        //: 4 Both functions return a negative value on error.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For a set of blob layouts, and for every sub-range of each blob,
+        //:   write the sub-range to an empty file with 'write' and with
+        //:   'writeAt', and verify the contents of the file.  (C-1..2)
+        //:
+        //: 2 Write a blob having more than 'k_MAX_IO_VECTORS' buffers.  (C-3)
+        //:
+        //: 3 Write to an invalid descriptor.  (C-4)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   int write(FileDescriptor, const Blob&);
+        //   int write(FileDescriptor, const Blob&, int, int);
+        //   int writeAt(FileDescriptor, Offset, const Blob&);
+        //   int writeAt(FileDescriptor, Offset, const Blob&, int, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'write' AND 'writeAt'" << endl
+                          << "=============================" << endl;
+
+        static const char *SPECS[] = {
+            "", "1", "5", "05", "50|", "123", "4444|44", "9090909", "1111111"
+        };
+        const int NUM_SPECS = static_cast<int>(sizeof SPECS / sizeof *SPECS);
+
+        FsUtil::FileDescriptor fd = FsUtil::open(fileName,
+                                                 FsUtil::e_OPEN_OR_CREATE,
+                                                 FsUtil::e_READ_WRITE);
+        ASSERT(FsUtil::k_INVALID_FD != fd);
+
+        for (int ti = 0; ti < NUM_SPECS; ++ti) {
+            const char *const SPEC = SPECS[ti];
+
+            bdlbb::Blob blob;
+            makeBlob(&blob, SPEC, DATA);
+
+            const int LENGTH = blob.length();
+
+            for (int pos = 0; pos <= LENGTH; ++pos) {
+            for (int len = 0; pos + len <= LENGTH; ++len) {
+                if (veryVerbose) { T_ P_(SPEC) P_(pos) P(len) }
+
+                const bsl::string EXPECTED(DATA + pos, len);
+
+                fd = reopenEmpty(fd, fileName);
+                ASSERT(0 == FsUtil::getFileSize(fd));
+
+                ASSERTV(SPEC, pos, len, len == Obj::write(fd, blob, pos, len));
+                ASSERTV(SPEC, pos, len,
+                        len == FsUtil::seek(fd,
+                                            0,
+                                            FsUtil::e_SEEK_FROM_CURRENT));
+                ASSERTV(SPEC, pos, len, EXPECTED == readFile(fd));
+
+                // Overwrite the same range, shifted by 3 bytes.
+
+                ASSERTV(SPEC, pos, len,
+                        len == Obj::writeAt(fd, 3, blob, pos, len));
+                const bsl::string RESULT = readFile(fd);
+                if (0 == len) {
+                    ASSERTV(SPEC, pos, RESULT, RESULT.empty());
+                    continue;
+                }
+                const bsl::size_t HEAD = bsl::min<bsl::size_t>(3, len);
+                ASSERTV(SPEC, pos, len, RESULT,
+                        3 + len == static_cast<int>(RESULT.length()));
+                ASSERTV(SPEC, pos, len, RESULT,
+                        EXPECTED == RESULT.substr(3));
+                ASSERTV(SPEC, pos, len, RESULT,
+                        EXPECTED.substr(0, HEAD) == RESULT.substr(0, HEAD));
+            }
+            }
+
+            fd = reopenEmpty(fd, fileName);
+
+            ASSERTV(SPEC, LENGTH == Obj::write(fd, blob));
+            ASSERTV(SPEC, LENGTH == Obj::writeAt(fd, LENGTH, blob));
+            ASSERTV(SPEC, bsl::string(DATA, LENGTH) + bsl::string(DATA, LENGTH)
+                                                             == readFile(fd));
+        }
+
+        if (verbose) cout << "\tMore than 'k_MAX_IO_VECTORS' buffers." << endl;
+        {
+            bdlbb::SimpleBlobBufferFactory factory(1);
+            bdlbb::Blob                    blob(&factory);
+
+            const int SIZE = Obj::k_MAX_IO_VECTORS * 2 + 5;
+
+            bsl::string expected;
+            for (int i = 0; i < SIZE; ++i) {
+                expected.push_back(static_cast<char>('A' + i % 26));
+            }
+            bdlbb::BlobUtil::append(&blob, expected.data(), SIZE);
+            ASSERT(SIZE == blob.numDataBuffers());
+
+            fd = reopenEmpty(fd, fileName);
+
+            ASSERT(SIZE     == Obj::write(fd, blob));
+            ASSERT(expected == readFile(fd));
+
+            ASSERT(SIZE - 2 == Obj::writeAt(fd, 0, blob, 2, SIZE - 2));
+            ASSERT(expected.substr(2) + expected.substr(SIZE - 2)
+                                                             == readFile(fd));
+        }
+
+        FsUtil::close(fd);
+
+        if (verbose) cout << "\tWriting to an invalid descriptor." << endl;
+        {
+            bdlbb::Blob blob;
+            makeBlob(&blob, "44", DATA);
+
+            ASSERT(0 > Obj::write(FsUtil::k_INVALID_FD, blob));
+            ASSERT(0 > Obj::writeAt(FsUtil::k_INVALID_FD, 0, blob));
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bdlbb::Blob blob;
+            makeBlob(&blob, "44", DATA);
+
+            ASSERT_PASS(Obj::write(FsUtil::k_INVALID_FD, blob, 0, 8));
+            ASSERT_FAIL(Obj::write(FsUtil::k_INVALID_FD, blob, 0, 9));
+            ASSERT_FAIL(Obj::write(FsUtil::k_INVALID_FD, blob, -1, 1));
+            ASSERT_FAIL(Obj::write(FsUtil::k_INVALID_FD, blob, 1, -1));
+
+            ASSERT_PASS(Obj::writeAt(FsUtil::k_INVALID_FD, 0, blob, 8, 0));
+            ASSERT_FAIL(Obj::writeAt(FsUtil::k_INVALID_FD, -1, blob));
+            ASSERT_FAIL(Obj::writeAt(FsUtil::k_INVALID_FD, 0, blob, 5, 4));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'loadIoVectors'
+        //
+        // Concerns:
+        //: 1 The loaded vectors describe exactly the requested range, in
+        //:   order, and refer to the blob's own buffers.
+        //:
+        //: 2 Zero-size buffers are skipped.
+        //:
+        //: 3 At most 'maxNumVectors' vectors are loaded, describing a prefix
+        //:   of the requested range.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For a set of blob layouts, for every sub-range of each blob, and
+        //:   for several values of 'maxNumVectors', load the vectors and
+        //:   verify that their concatenation is a prefix of the expected data,
+        //:   that it is complete unless 'maxNumVectors' vectors were loaded,
+        //:   and that no vector is empty.  (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   int loadIoVectors(iovec *, int, const Blob&, int, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'loadIoVectors'" << endl
+                          << "=======================" << endl;
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+        static const char *SPECS[] = {
+            "", "1", "7", "0", "05", "50", "50|7", "123", "30403", "1111111"
+        };
+        const int NUM_SPECS = static_cast<int>(sizeof SPECS / sizeof *SPECS);
+
+        for (int ti = 0; ti < NUM_SPECS; ++ti) {
+            const char *const SPEC = SPECS[ti];
+
+            bdlbb::Blob blob;
+            makeBlob(&blob, SPEC, DATA);
+
+            const int LENGTH = blob.length();
+
+            for (int pos = 0; pos <= LENGTH; ++pos) {
+            for (int len = 0; pos + len <= LENGTH; ++len) {
+            for (int max = 1; max <= 8; ++max) {
+                if (veryVerbose) { T_ P_(SPEC) P_(pos) P_(len) P(max) }
+
+                struct iovec vectors[8];
+
+                const int n = Obj::loadIoVectors(vectors, max, blob, pos, len);
+                ASSERTV(SPEC, pos, len, max, n, 0 <= n && n <= max);
+
+                bsl::string result;
+                for (int i = 0; i < n; ++i) {
+                    ASSERTV(SPEC, pos, len, i, 0 < vectors[i].iov_len);
+                    result.append(static_cast<char *>(vectors[i].iov_base),
+                                  vectors[i].iov_len);
+                }
+                ASSERTV(SPEC, pos, len, max, result,
+                        bsl::string(DATA + pos, result.length()) == result);
+                ASSERTV(SPEC, pos, len, max, n,
+                        n == max || len == static_cast<int>(result.length()));
+            }
+            }
+            }
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bdlbb::Blob blob;
+            makeBlob(&blob, "44", DATA);
+
+            struct iovec vectors[2];
+
+            ASSERT_PASS(Obj::loadIoVectors(vectors,  2, blob, 0,  8));
+            ASSERT_FAIL(Obj::loadIoVectors(      0,  2, blob, 0,  8));
+            ASSERT_FAIL(Obj::loadIoVectors(vectors,  0, blob, 0,  8));
+            ASSERT_FAIL(Obj::loadIoVectors(vectors,  2, blob, -1, 1));
+            ASSERT_FAIL(Obj::loadIoVectors(vectors,  2, blob, 0, -1));
+            ASSERT_FAIL(Obj::loadIoVectors(vectors,  2, blob, 1,  8));
+        }
+#else
+        if (verbose) cout << "\tNot applicable on this platform." << endl;
+#endif
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Write a multi-buffer blob to a file, and read it back into a
+        //:   blob having a different buffer size.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bdlbb::SimpleBlobBufferFactory smallFactory(3);
+        bdlbb::SimpleBlobBufferFactory largeFactory(50);
+
+        bdlbb::Blob source(&smallFactory);
+        bdlbb::BlobUtil::append(&source, DATA, DATA_LENGTH);
+
+        FsUtil::FileDescriptor fd = FsUtil::open(fileName,
+                                                 FsUtil::e_OPEN_OR_CREATE,
+                                                 FsUtil::e_READ_WRITE);
+        ASSERT(FsUtil::k_INVALID_FD != fd);
+
+        ASSERT(DATA_LENGTH == Obj::write(fd, source));
+        ASSERT(DATA_LENGTH == FsUtil::getFileSize(fd));
+
+        FsUtil::seek(fd, 0, FsUtil::e_SEEK_FROM_BEGINNING);
+
+        bdlbb::Blob target(&largeFactory);
+        ASSERT(DATA_LENGTH == Obj::read(&target, fd, DATA_LENGTH + 10));
+        ASSERT(DATA_LENGTH == target.length());
+        ASSERT(0           == bdlbb::BlobUtil::compare(source, target));
+
+        ASSERT(0 == Obj::read(&target, fd, 10));
+        ASSERT(DATA_LENGTH == target.length());
+
+        FsUtil::close(fd);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    FsUtil::remove(fileName);
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------